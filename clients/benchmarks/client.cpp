@@ -35,15 +35,28 @@
 // Level2
 #include "testing_coomv.hpp"
 #include "testing_csrmv.hpp"
+#include "testing_csrmv_multi.hpp"
+#include "testing_csrmv_mixed.hpp"
 #include "testing_csrsv.hpp"
+#include "testing_csritsv.hpp"
 #include "testing_ellmv.hpp"
 #include "testing_hybmv.hpp"
+#include "testing_hybmv_mixed.hpp"
+#include "testing_bsrmv.hpp"
+#include "testing_sellcmv.hpp"
+#include "testing_csr5mv.hpp"
+#include "testing_diamv.hpp"
 
 // Level3
 #include "testing_csrmm.hpp"
+#include "testing_csrsm.hpp"
 
 // Preconditioner
 #include "testing_csrilu0.hpp"
+#include "testing_csriluk.hpp"
+#include "testing_csrilut.hpp"
+#include "testing_csritilu0.hpp"
+#include "testing_csric0.hpp"
 
 // Conversion
 #include "testing_csr2coo.hpp"
@@ -52,6 +65,12 @@
 #include "testing_csr2hyb.hpp"
 #include "testing_coo2csr.hpp"
 #include "testing_ell2csr.hpp"
+#include "testing_csr2bsr.hpp"
+#include "testing_bsr2csr.hpp"
+#include "testing_csr2sellc.hpp"
+#include "testing_csr2csr5.hpp"
+#include "testing_csr2dia.hpp"
+#include "testing_dia2csr.hpp"
 #include "testing_identity.hpp"
 #include "testing_csrsort.hpp"
 #include "testing_coosort.hpp"
@@ -70,7 +89,12 @@ int main(int argc, char* argv[])
     argus.timing     = 1;
 
     std::string function;
+    std::string csrmv_alg;
+    std::string solve_policy;
     char precision = 's';
+    char transA;
+    char transB;
+    rocsparse_int direction;
 
     rocsparse_int device_id;
 
@@ -87,6 +111,12 @@ int main(int argc, char* argv[])
          "Specific matrix/vector size testing: SPARSE-1: the length of the "
          "dense vector. SPARSE-2 & SPARSE-3: the number of columns")
 
+        ("sizek,k",
+         po::value<rocsparse_int>(&argus.K)->default_value(128),
+         "Specific matrix size testing: sizek is only applicable to SPARSE-3 "
+         "and csrmv_multi: the number of columns of the dense matrix or the number "
+         "of dense vectors. csrsm: the number of right-hand sides.")
+
         ("sizennz,z",
          po::value<rocsparse_int>(&argus.nnz)->default_value(32),
          "Specific vector size testing, LEVEL-1: the number of non-zero elements "
@@ -111,17 +141,76 @@ int main(int argc, char* argv[])
          po::value<std::string>(&function)->default_value("axpyi"),
          "SPARSE function to test. Options:\n"
          "  Level1: axpyi, doti, gthr, gthrz, roti, sctr\n"
-         "  Level2: coomv, csrmv, csrsv, ellmv, hybmv\n"
-         "  Level3: csrmm\n"
-         "  Preconditioner: csrilu0\n"
+         "  Level2: coomv, csrmv, csrmv_multi, csrsv, csritsv, ellmv, hybmv,\n"
+         "          bsrmv, sellcmv, csr5mv, diamv\n"
+         "  Mixed precision (single precision matrix, d only): csrmv_mixed, hybmv_mixed\n"
+         "  Level3: csrmm, csrsm\n"
+         "  Preconditioner: csrilu0, csriluk, csrilut, csritilu0, csric0\n"
          "  Conversion: csr2coo, csr2csc, csr2ell,\n"
-         "              csr2hyb, coo2csr, ell2csr\n"
+         "              csr2hyb, coo2csr, ell2csr, csr2bsr, bsr2csr, csr2sellc,\n"
+         "              csr2csr5, csr2dia, dia2csr\n"
          "  Sorting: csrsort, coosort\n"
          "  Misc: identity")
         
         ("precision,r",
-         po::value<char>(&precision)->default_value('s'), "Options: s,d")
+         po::value<char>(&precision)->default_value('s'), "Options: s,d,c,z")
         
+        ("transposeA",
+         po::value<char>(&transA)->default_value('N'),
+         "N = no transpose, T = transpose, C = conjugate transpose")
+
+        ("transposeB",
+         po::value<char>(&transB)->default_value('N'),
+         "N = no transpose, T = transpose, C = conjugate transpose")
+
+        ("blockdim",
+         po::value<rocsparse_int>(&argus.block_dim)->default_value(2),
+         "BSR block dimension (default: 2)")
+
+        ("direction",
+         po::value<rocsparse_int>(&direction)->default_value(0),
+         "BSR block storage order: 0 = row, 1 = column (default: 0)")
+
+        ("sigma",
+         po::value<rocsparse_int>(&argus.sigma)->default_value(1),
+         "SELL-C-sigma sorting window in rows (default: 1)")
+
+        ("csrmv-alg",
+         po::value<std::string>(&csrmv_alg)->default_value("general"),
+         "csrmv algorithm. Options: general, adaptive, merge")
+
+        ("solve-policy",
+         po::value<std::string>(&solve_policy)->default_value("auto"),
+         "csrsv and csrsm solve policy. Options: auto, sync_free, level")
+        
+        ("level",
+         po::value<rocsparse_int>(&argus.level)->default_value(0),
+         "csriluk level of fill")
+
+        ("tau",
+         po::value<double>(&argus.tau)->default_value(0.0),
+         "csrilut relative drop tolerance")
+
+        ("max-fill",
+         po::value<rocsparse_int>(&argus.max_fill)->default_value(0),
+         "csrilut maximum number of lower and upper entries per row")
+
+        ("boost",
+         po::value<rocsparse_int>(&argus.boost)->default_value(0),
+         "csrilu0 numeric boost of tiny pivots? 0 = No, 1 = Yes (default: No)")
+
+        ("boost-tol",
+         po::value<double>(&argus.boost_tol)->default_value(0.0),
+         "csrilu0 boost tolerance")
+
+        ("boost-val",
+         po::value<double>(&argus.boost_val)->default_value(1.0),
+         "csrilu0 boost value")
+
+        ("sweeps",
+         po::value<rocsparse_int>(&argus.sweeps)->default_value(10),
+         "csritsv and csritilu0 number of sweeps")
+
         ("verify,v",
          po::value<rocsparse_int>(&argus.unit_check)->default_value(0),
          "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
@@ -145,12 +234,100 @@ int main(int argc, char* argv[])
         return 0;
     }
 
-    if(precision != 's' && precision != 'd')
+    if(precision != 's' && precision != 'd' && precision != 'c' && precision != 'z')
     {
         fprintf(stderr, "Invalid value for --precision\n");
         return -1;
     }
 
+    if(transA == 'N')
+    {
+        argus.transA = rocsparse_operation_none;
+    }
+    else if(transA == 'T')
+    {
+        argus.transA = rocsparse_operation_transpose;
+    }
+    else if(transA == 'C')
+    {
+        argus.transA = rocsparse_operation_conjugate_transpose;
+    }
+    else
+    {
+        fprintf(stderr, "Invalid value for --transposeA\n");
+        return -1;
+    }
+
+    if(transB == 'N')
+    {
+        argus.transB = rocsparse_operation_none;
+    }
+    else if(transB == 'T')
+    {
+        argus.transB = rocsparse_operation_transpose;
+    }
+    else if(transB == 'C')
+    {
+        argus.transB = rocsparse_operation_conjugate_transpose;
+    }
+    else
+    {
+        fprintf(stderr, "Invalid value for --transposeB\n");
+        return -1;
+    }
+
+    if(direction == 0)
+    {
+        argus.direction = rocsparse_direction_row;
+    }
+    else if(direction == 1)
+    {
+        argus.direction = rocsparse_direction_column;
+    }
+    else
+    {
+        fprintf(stderr, "Invalid value for --direction\n");
+        return -1;
+    }
+
+    if(csrmv_alg == "general")
+    {
+        argus.bswitch = false;
+    }
+    else if(csrmv_alg == "adaptive")
+    {
+        argus.bswitch   = true;
+        argus.csrmv_alg = rocsparse_csrmv_alg_adaptive;
+    }
+    else if(csrmv_alg == "merge")
+    {
+        argus.bswitch   = true;
+        argus.csrmv_alg = rocsparse_csrmv_alg_merge;
+    }
+    else
+    {
+        fprintf(stderr, "Invalid value for --csrmv-alg\n");
+        return -1;
+    }
+
+    if(solve_policy == "auto")
+    {
+        argus.solve = rocsparse_solve_policy_auto;
+    }
+    else if(solve_policy == "sync_free")
+    {
+        argus.solve = rocsparse_solve_policy_sync_free;
+    }
+    else if(solve_policy == "level")
+    {
+        argus.solve = rocsparse_solve_policy_level;
+    }
+    else
+    {
+        fprintf(stderr, "Invalid value for --solve-policy\n");
+        return -1;
+    }
+
     // Device Query
     rocsparse_int device_count = query_device_property();
 
@@ -221,6 +398,10 @@ int main(int argc, char* argv[])
             testing_coomv<float>(argus);
         else if(precision == 'd')
             testing_coomv<double>(argus);
+        else if(precision == 'c')
+            testing_coomv<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_coomv<rocsparse_double_complex>(argus);
     }
     else if(function == "csrmv")
     {
@@ -229,12 +410,35 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_csrmv<double>(argus);
     }
+    else if(function == "csrmv_mixed")
+    {
+        if(precision == 'd')
+            testing_csrmv_mixed<double, float>(argus);
+    }
+    else if(function == "csrmv_multi")
+    {
+        if(precision == 's')
+            testing_csrmv_multi<float>(argus);
+        else if(precision == 'd')
+            testing_csrmv_multi<double>(argus);
+    }
     else if(function == "csrsv")
     {
         if(precision == 's')
             testing_csrsv<float>(argus);
         else if(precision == 'd')
             testing_csrsv<double>(argus);
+        else if(precision == 'c')
+            testing_csrsv<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csrsv<rocsparse_double_complex>(argus);
+    }
+    else if(function == "csritsv")
+    {
+        if(precision == 's')
+            testing_csritsv<float>(argus);
+        else if(precision == 'd')
+            testing_csritsv<double>(argus);
     }
     else if(function == "ellmv")
     {
@@ -242,6 +446,10 @@ int main(int argc, char* argv[])
             testing_ellmv<float>(argus);
         else if(precision == 'd')
             testing_ellmv<double>(argus);
+        else if(precision == 'c')
+            testing_ellmv<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_ellmv<rocsparse_double_complex>(argus);
     }
     else if(function == "hybmv")
     {
@@ -249,6 +457,59 @@ int main(int argc, char* argv[])
             testing_hybmv<float>(argus);
         else if(precision == 'd')
             testing_hybmv<double>(argus);
+        else if(precision == 'c')
+            testing_hybmv<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_hybmv<rocsparse_double_complex>(argus);
+    }
+    else if(function == "hybmv_mixed")
+    {
+        if(precision == 'd')
+            testing_hybmv_mixed<double, float>(argus);
+    }
+    else if(function == "bsrmv")
+    {
+        if(precision == 's')
+            testing_bsrmv<float>(argus);
+        else if(precision == 'd')
+            testing_bsrmv<double>(argus);
+        else if(precision == 'c')
+            testing_bsrmv<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_bsrmv<rocsparse_double_complex>(argus);
+    }
+    else if(function == "sellcmv")
+    {
+        if(precision == 's')
+            testing_sellcmv<float>(argus);
+        else if(precision == 'd')
+            testing_sellcmv<double>(argus);
+        else if(precision == 'c')
+            testing_sellcmv<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_sellcmv<rocsparse_double_complex>(argus);
+    }
+    else if(function == "csr5mv")
+    {
+        if(precision == 's')
+            testing_csr5mv<float>(argus);
+        else if(precision == 'd')
+            testing_csr5mv<double>(argus);
+        else if(precision == 'c')
+            testing_csr5mv<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csr5mv<rocsparse_double_complex>(argus);
+    }
+    else if(function == "diamv")
+    {
+        if(precision == 's')
+            testing_diamv<float>(argus);
+        else if(precision == 'd')
+            testing_diamv<double>(argus);
+        else if(precision == 'c')
+            testing_diamv<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_diamv<rocsparse_double_complex>(argus);
     }
     else if(function == "csrmm")
     {
@@ -257,12 +518,51 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_csrmm<double>(argus);
     }
+    else if(function == "csrsm")
+    {
+        if(precision == 's')
+            testing_csrsm<float>(argus);
+        else if(precision == 'd')
+            testing_csrsm<double>(argus);
+    }
     else if(function == "csrilu0")
     {
         if(precision == 's')
             testing_csrilu0<float>(argus);
         else if(precision == 'd')
             testing_csrilu0<double>(argus);
+        else if(precision == 'c')
+            testing_csrilu0<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csrilu0<rocsparse_double_complex>(argus);
+    }
+    else if(function == "csriluk")
+    {
+        if(precision == 's')
+            testing_csriluk<float>(argus);
+        else if(precision == 'd')
+            testing_csriluk<double>(argus);
+    }
+    else if(function == "csrilut")
+    {
+        if(precision == 's')
+            testing_csrilut<float>(argus);
+        else if(precision == 'd')
+            testing_csrilut<double>(argus);
+    }
+    else if(function == "csritilu0")
+    {
+        if(precision == 's')
+            testing_csritilu0<float>(argus);
+        else if(precision == 'd')
+            testing_csritilu0<double>(argus);
+    }
+    else if(function == "csric0")
+    {
+        if(precision == 's')
+            testing_csric0<float>(argus);
+        else if(precision == 'd')
+            testing_csric0<double>(argus);
     }
     else if(function == "csr2coo")
     {
@@ -274,6 +574,10 @@ int main(int argc, char* argv[])
             testing_csr2csc<float>(argus);
         else if(precision == 'd')
             testing_csr2csc<double>(argus);
+        else if(precision == 'c')
+            testing_csr2csc<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csr2csc<rocsparse_double_complex>(argus);
     }
     else if(function == "csr2ell")
     {
@@ -281,6 +585,10 @@ int main(int argc, char* argv[])
             testing_csr2ell<float>(argus);
         else if(precision == 'd')
             testing_csr2ell<double>(argus);
+        else if(precision == 'c')
+            testing_csr2ell<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csr2ell<rocsparse_double_complex>(argus);
     }
     else if(function == "csr2hyb")
     {
@@ -288,6 +596,10 @@ int main(int argc, char* argv[])
             testing_csr2hyb<float>(argus);
         else if(precision == 'd')
             testing_csr2hyb<double>(argus);
+        else if(precision == 'c')
+            testing_csr2hyb<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csr2hyb<rocsparse_double_complex>(argus);
     }
     else if(function == "coo2csr")
     {
@@ -299,6 +611,69 @@ int main(int argc, char* argv[])
             testing_ell2csr<float>(argus);
         else if(precision == 'd')
             testing_ell2csr<double>(argus);
+        else if(precision == 'c')
+            testing_ell2csr<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_ell2csr<rocsparse_double_complex>(argus);
+    }
+    else if(function == "csr2bsr")
+    {
+        if(precision == 's')
+            testing_csr2bsr<float>(argus);
+        else if(precision == 'd')
+            testing_csr2bsr<double>(argus);
+        else if(precision == 'c')
+            testing_csr2bsr<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csr2bsr<rocsparse_double_complex>(argus);
+    }
+    else if(function == "bsr2csr")
+    {
+        if(precision == 's')
+            testing_bsr2csr<float>(argus);
+        else if(precision == 'd')
+            testing_bsr2csr<double>(argus);
+        else if(precision == 'c')
+            testing_bsr2csr<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_bsr2csr<rocsparse_double_complex>(argus);
+    }
+    else if(function == "csr2sellc")
+    {
+        if(precision == 's')
+            testing_csr2sellc<float>(argus);
+        else if(precision == 'd')
+            testing_csr2sellc<double>(argus);
+        else if(precision == 'c')
+            testing_csr2sellc<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csr2sellc<rocsparse_double_complex>(argus);
+    }
+    else if(function == "csr2csr5")
+    {
+        testing_csr2csr5(argus);
+    }
+    else if(function == "csr2dia")
+    {
+        if(precision == 's')
+            testing_csr2dia<float>(argus);
+        else if(precision == 'd')
+            testing_csr2dia<double>(argus);
+        else if(precision == 'c')
+            testing_csr2dia<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csr2dia<rocsparse_double_complex>(argus);
+    }
+    else if(function == "dia2csr")
+    {
+        if(precision == 's')
+            testing_dia2csr<float>(argus);
+        else if(precision == 'd')
+            testing_dia2csr<double>(argus);
+        else if(precision == 'c')
+            testing_dia2csr<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_dia2csr<rocsparse_double_complex>(argus);
     }
     else if(function == "csrsort")
     {
@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "hip_sync_counter.hpp"
+
+#include <hip/hip_runtime_api.h>
+
+static size_t sync_calls   = 0;
+static size_t malloc_calls = 0;
+
+void hip_sync_counter_reset() { sync_calls = 0; }
+
+size_t hip_sync_counter_get() { return sync_calls; }
+
+void hip_malloc_counter_reset() { malloc_calls = 0; }
+
+size_t hip_malloc_counter_get() { return malloc_calls; }
+
+#if defined(__HIP_PLATFORM_HCC__)
+
+#include <dlfcn.h>
+
+bool hip_sync_counter_available() { return true; }
+
+// Look up the HIP runtime function that is interposed
+#define HIP_SYNC_FORWARD(NAME, TYPE) reinterpret_cast<TYPE>(dlsym(RTLD_NEXT, #NAME))
+
+extern "C" {
+
+hipError_t hipMalloc(void** ptr, size_t size)
+{
+    typedef hipError_t (*func_t)(void**, size_t);
+    static func_t func = HIP_SYNC_FORWARD(hipMalloc, func_t);
+
+    ++malloc_calls;
+    return func(ptr, size);
+}
+
+hipError_t hipMemcpy(void* dst, const void* src, size_t size, hipMemcpyKind kind)
+{
+    typedef hipError_t (*func_t)(void*, const void*, size_t, hipMemcpyKind);
+    static func_t func = HIP_SYNC_FORWARD(hipMemcpy, func_t);
+
+    ++sync_calls;
+    return func(dst, src, size, kind);
+}
+
+hipError_t hipMemset(void* dst, int value, size_t size)
+{
+    typedef hipError_t (*func_t)(void*, int, size_t);
+    static func_t func = HIP_SYNC_FORWARD(hipMemset, func_t);
+
+    ++sync_calls;
+    return func(dst, value, size);
+}
+
+hipError_t hipFree(void* ptr)
+{
+    typedef hipError_t (*func_t)(void*);
+    static func_t func = HIP_SYNC_FORWARD(hipFree, func_t);
+
+    ++sync_calls;
+    return func(ptr);
+}
+
+hipError_t hipHostFree(void* ptr)
+{
+    typedef hipError_t (*func_t)(void*);
+    static func_t func = HIP_SYNC_FORWARD(hipHostFree, func_t);
+
+    ++sync_calls;
+    return func(ptr);
+}
+
+hipError_t hipStreamSynchronize(hipStream_t stream)
+{
+    typedef hipError_t (*func_t)(hipStream_t);
+    static func_t func = HIP_SYNC_FORWARD(hipStreamSynchronize, func_t);
+
+    ++sync_calls;
+    return func(stream);
+}
+
+hipError_t hipDeviceSynchronize(void)
+{
+    typedef hipError_t (*func_t)(void);
+    static func_t func = HIP_SYNC_FORWARD(hipDeviceSynchronize, func_t);
+
+    ++sync_calls;
+    return func();
+}
+
+hipError_t hipEventSynchronize(hipEvent_t event)
+{
+    typedef hipError_t (*func_t)(hipEvent_t);
+    static func_t func = HIP_SYNC_FORWARD(hipEventSynchronize, func_t);
+
+    ++sync_calls;
+    return func(event);
+}
+
+} // extern "C"
+
+#undef HIP_SYNC_FORWARD
+
+#else
+
+// HIP runtime functions are inlined on this platform and cannot be interposed
+bool hip_sync_counter_available() { return false; }
+
+#endif
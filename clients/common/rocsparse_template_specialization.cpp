@@ -205,6 +205,44 @@ rocsparse_status rocsparse_coomv(rocsparse_handle handle,
         handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
 }
 
+template <>
+rocsparse_status rocsparse_coomv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 rocsparse_int m,
+                                 rocsparse_int n,
+                                 rocsparse_int nnz,
+                                 const rocsparse_float_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_float_complex* coo_val,
+                                 const rocsparse_int* coo_row_ind,
+                                 const rocsparse_int* coo_col_ind,
+                                 const rocsparse_float_complex* x,
+                                 const rocsparse_float_complex* beta,
+                                 rocsparse_float_complex* y)
+{
+    return rocsparse_ccoomv(
+        handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_coomv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 rocsparse_int m,
+                                 rocsparse_int n,
+                                 rocsparse_int nnz,
+                                 const rocsparse_double_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_double_complex* coo_val,
+                                 const rocsparse_int* coo_row_ind,
+                                 const rocsparse_int* coo_col_ind,
+                                 const rocsparse_double_complex* x,
+                                 const rocsparse_double_complex* beta,
+                                 rocsparse_double_complex* y)
+{
+    return rocsparse_zcoomv(
+        handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+}
+
 template <>
 rocsparse_status rocsparse_csrmv_analysis(rocsparse_handle handle,
                                           rocsparse_operation trans,
@@ -317,6 +355,106 @@ rocsparse_status rocsparse_csrmv(rocsparse_handle handle,
                             y);
 }
 
+template <>
+rocsparse_status rocsparse_csrmv_mixed(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       rocsparse_int nnz,
+                                       const double* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const float* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_mat_info info,
+                                       const double* x,
+                                       const double* beta,
+                                       double* y)
+{
+    return rocsparse_dscsrmv(handle,
+                             trans,
+                             m,
+                             n,
+                             nnz,
+                             alpha,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             info,
+                             x,
+                             beta,
+                             y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_multi(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       rocsparse_int nnz,
+                                       rocsparse_int k,
+                                       const float* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const float* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_mat_info info,
+                                       const float* x,
+                                       const float* beta,
+                                       float* y)
+{
+    return rocsparse_scsrmv_multi(handle,
+                                  trans,
+                                  m,
+                                  n,
+                                  nnz,
+                                  k,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  info,
+                                  x,
+                                  beta,
+                                  y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_multi(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       rocsparse_int nnz,
+                                       rocsparse_int k,
+                                       const double* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const double* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_mat_info info,
+                                       const double* x,
+                                       const double* beta,
+                                       double* y)
+{
+    return rocsparse_dcsrmv_multi(handle,
+                                  trans,
+                                  m,
+                                  n,
+                                  nnz,
+                                  k,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  info,
+                                  x,
+                                  beta,
+                                  y);
+}
+
 template <>
 rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle handle,
                                              rocsparse_operation trans,
@@ -349,6 +487,38 @@ rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle handle,
         handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
 }
 
+template <>
+rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle handle,
+                                             rocsparse_operation trans,
+                                             rocsparse_int m,
+                                             rocsparse_int nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_mat_info info,
+                                             size_t* buffer_size)
+{
+    return rocsparse_ccsrsv_buffer_size(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle handle,
+                                             rocsparse_operation trans,
+                                             rocsparse_int m,
+                                             rocsparse_int nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_mat_info info,
+                                             size_t* buffer_size)
+{
+    return rocsparse_zcsrsv_buffer_size(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
 template <>
 rocsparse_status rocsparse_csrsv_analysis(rocsparse_handle handle,
                                           rocsparse_operation trans,
@@ -405,6 +575,62 @@ rocsparse_status rocsparse_csrsv_analysis(rocsparse_handle handle,
                                      temp_buffer);
 }
 
+template <>
+rocsparse_status rocsparse_csrsv_analysis(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_int m,
+                                          rocsparse_int nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_float_complex* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          rocsparse_mat_info info,
+                                          rocsparse_analysis_policy analysis,
+                                          rocsparse_solve_policy solve,
+                                          void* temp_buffer)
+{
+    return rocsparse_ccsrsv_analysis(handle,
+                                     trans,
+                                     m,
+                                     nnz,
+                                     descr,
+                                     csr_val,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_analysis(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_int m,
+                                          rocsparse_int nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_double_complex* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          rocsparse_mat_info info,
+                                          rocsparse_analysis_policy analysis,
+                                          rocsparse_solve_policy solve,
+                                          void* temp_buffer)
+{
+    return rocsparse_zcsrsv_analysis(handle,
+                                     trans,
+                                     m,
+                                     nnz,
+                                     descr,
+                                     csr_val,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
 template <>
 rocsparse_status rocsparse_csrsv_solve(rocsparse_handle handle,
                                        rocsparse_operation trans,
@@ -469,6 +695,164 @@ rocsparse_status rocsparse_csrsv_solve(rocsparse_handle handle,
                                   temp_buffer);
 }
 
+template <>
+rocsparse_status rocsparse_csrsv_solve(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int nnz,
+                                       const rocsparse_float_complex* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_float_complex* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_mat_info info,
+                                       const rocsparse_float_complex* x,
+                                       rocsparse_float_complex* y,
+                                       rocsparse_solve_policy policy,
+                                       void* temp_buffer)
+{
+    return rocsparse_ccsrsv_solve(handle,
+                                  trans,
+                                  m,
+                                  nnz,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  info,
+                                  x,
+                                  y,
+                                  policy,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_solve(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int nnz,
+                                       const rocsparse_double_complex* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_double_complex* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_mat_info info,
+                                       const rocsparse_double_complex* x,
+                                       rocsparse_double_complex* y,
+                                       rocsparse_solve_policy policy,
+                                       void* temp_buffer)
+{
+    return rocsparse_zcsrsv_solve(handle,
+                                  trans,
+                                  m,
+                                  nnz,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  info,
+                                  x,
+                                  y,
+                                  policy,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csritsv_buffer_size(rocsparse_handle handle,
+                                               rocsparse_operation trans,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               size_t* buffer_size)
+{
+    return rocsparse_scsritsv_buffer_size(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csritsv_buffer_size(rocsparse_handle handle,
+                                               rocsparse_operation trans,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               size_t* buffer_size)
+{
+    return rocsparse_dcsritsv_buffer_size(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csritsv_solve(rocsparse_handle handle,
+                                         rocsparse_operation trans,
+                                         rocsparse_int m,
+                                         rocsparse_int nnz,
+                                         const float* alpha,
+                                         const rocsparse_mat_descr descr,
+                                         const float* csr_val,
+                                         const rocsparse_int* csr_row_ptr,
+                                         const rocsparse_int* csr_col_ind,
+                                         const float* x,
+                                         float* y,
+                                         rocsparse_int nsweeps,
+                                         float* residual,
+                                         void* temp_buffer)
+{
+    return rocsparse_scsritsv_solve(handle,
+                                    trans,
+                                    m,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    x,
+                                    y,
+                                    nsweeps,
+                                    residual,
+                                    temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csritsv_solve(rocsparse_handle handle,
+                                         rocsparse_operation trans,
+                                         rocsparse_int m,
+                                         rocsparse_int nnz,
+                                         const double* alpha,
+                                         const rocsparse_mat_descr descr,
+                                         const double* csr_val,
+                                         const rocsparse_int* csr_row_ptr,
+                                         const rocsparse_int* csr_col_ind,
+                                         const double* x,
+                                         double* y,
+                                         rocsparse_int nsweeps,
+                                         double* residual,
+                                         void* temp_buffer)
+{
+    return rocsparse_dcsritsv_solve(handle,
+                                    trans,
+                                    m,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    x,
+                                    y,
+                                    nsweeps,
+                                    residual,
+                                    temp_buffer);
+}
+
 template <>
 rocsparse_status rocsparse_ellmv(rocsparse_handle handle,
                                  rocsparse_operation trans,
@@ -506,10 +890,46 @@ rocsparse_status rocsparse_ellmv(rocsparse_handle handle,
 }
 
 template <>
-rocsparse_status rocsparse_hybmv(rocsparse_handle handle,
+rocsparse_status rocsparse_ellmv(rocsparse_handle handle,
                                  rocsparse_operation trans,
-                                 const float* alpha,
-                                 const rocsparse_mat_descr descr,
+                                 rocsparse_int m,
+                                 rocsparse_int n,
+                                 const rocsparse_float_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_float_complex* ell_val,
+                                 const rocsparse_int* ell_col_ind,
+                                 rocsparse_int ell_width,
+                                 const rocsparse_float_complex* x,
+                                 const rocsparse_float_complex* beta,
+                                 rocsparse_float_complex* y)
+{
+    return rocsparse_cellmv(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_ellmv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 rocsparse_int m,
+                                 rocsparse_int n,
+                                 const rocsparse_double_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_double_complex* ell_val,
+                                 const rocsparse_int* ell_col_ind,
+                                 rocsparse_int ell_width,
+                                 const rocsparse_double_complex* x,
+                                 const rocsparse_double_complex* beta,
+                                 rocsparse_double_complex* y)
+{
+    return rocsparse_zellmv(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_hybmv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 const float* alpha,
+                                 const rocsparse_mat_descr descr,
                                  const rocsparse_hyb_mat hyb,
                                  const float* x,
                                  const float* beta,
@@ -531,6 +951,433 @@ rocsparse_status rocsparse_hybmv(rocsparse_handle handle,
     return rocsparse_dhybmv(handle, trans, alpha, descr, hyb, x, beta, y);
 }
 
+template <>
+rocsparse_status rocsparse_hybmv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 const rocsparse_float_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_hyb_mat hyb,
+                                 const rocsparse_float_complex* x,
+                                 const rocsparse_float_complex* beta,
+                                 rocsparse_float_complex* y)
+{
+    return rocsparse_chybmv(handle, trans, alpha, descr, hyb, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_hybmv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 const rocsparse_double_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_hyb_mat hyb,
+                                 const rocsparse_double_complex* x,
+                                 const rocsparse_double_complex* beta,
+                                 rocsparse_double_complex* y)
+{
+    return rocsparse_zhybmv(handle, trans, alpha, descr, hyb, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_hybmv_mixed<double, float>(rocsparse_handle handle,
+                                                      rocsparse_operation trans,
+                                                      const double* alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const rocsparse_hyb_mat hyb,
+                                                      const double* x,
+                                                      const double* beta,
+                                                      double* y)
+{
+    return rocsparse_dshybmv(handle, trans, alpha, descr, hyb, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv(rocsparse_handle handle,
+                                 rocsparse_direction dir,
+                                 rocsparse_operation trans,
+                                 rocsparse_int mb,
+                                 rocsparse_int nb,
+                                 rocsparse_int nnzb,
+                                 const float* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const float* bsr_val,
+                                 const rocsparse_int* bsr_row_ptr,
+                                 const rocsparse_int* bsr_col_ind,
+                                 rocsparse_int block_dim,
+                                 const float* x,
+                                 const float* beta,
+                                 float* y)
+{
+    return rocsparse_sbsrmv(handle,
+                            dir,
+                            trans,
+                            mb,
+                            nb,
+                            nnzb,
+                            alpha,
+                            descr,
+                            bsr_val,
+                            bsr_row_ptr,
+                            bsr_col_ind,
+                            block_dim,
+                            x,
+                            beta,
+                            y);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv(rocsparse_handle handle,
+                                 rocsparse_direction dir,
+                                 rocsparse_operation trans,
+                                 rocsparse_int mb,
+                                 rocsparse_int nb,
+                                 rocsparse_int nnzb,
+                                 const double* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const double* bsr_val,
+                                 const rocsparse_int* bsr_row_ptr,
+                                 const rocsparse_int* bsr_col_ind,
+                                 rocsparse_int block_dim,
+                                 const double* x,
+                                 const double* beta,
+                                 double* y)
+{
+    return rocsparse_dbsrmv(handle,
+                            dir,
+                            trans,
+                            mb,
+                            nb,
+                            nnzb,
+                            alpha,
+                            descr,
+                            bsr_val,
+                            bsr_row_ptr,
+                            bsr_col_ind,
+                            block_dim,
+                            x,
+                            beta,
+                            y);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv(rocsparse_handle handle,
+                                 rocsparse_direction dir,
+                                 rocsparse_operation trans,
+                                 rocsparse_int mb,
+                                 rocsparse_int nb,
+                                 rocsparse_int nnzb,
+                                 const rocsparse_float_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_float_complex* bsr_val,
+                                 const rocsparse_int* bsr_row_ptr,
+                                 const rocsparse_int* bsr_col_ind,
+                                 rocsparse_int block_dim,
+                                 const rocsparse_float_complex* x,
+                                 const rocsparse_float_complex* beta,
+                                 rocsparse_float_complex* y)
+{
+    return rocsparse_cbsrmv(handle,
+                            dir,
+                            trans,
+                            mb,
+                            nb,
+                            nnzb,
+                            alpha,
+                            descr,
+                            bsr_val,
+                            bsr_row_ptr,
+                            bsr_col_ind,
+                            block_dim,
+                            x,
+                            beta,
+                            y);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv(rocsparse_handle handle,
+                                 rocsparse_direction dir,
+                                 rocsparse_operation trans,
+                                 rocsparse_int mb,
+                                 rocsparse_int nb,
+                                 rocsparse_int nnzb,
+                                 const rocsparse_double_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_double_complex* bsr_val,
+                                 const rocsparse_int* bsr_row_ptr,
+                                 const rocsparse_int* bsr_col_ind,
+                                 rocsparse_int block_dim,
+                                 const rocsparse_double_complex* x,
+                                 const rocsparse_double_complex* beta,
+                                 rocsparse_double_complex* y)
+{
+    return rocsparse_zbsrmv(handle,
+                            dir,
+                            trans,
+                            mb,
+                            nb,
+                            nnzb,
+                            alpha,
+                            descr,
+                            bsr_val,
+                            bsr_row_ptr,
+                            bsr_col_ind,
+                            block_dim,
+                            x,
+                            beta,
+                            y);
+}
+
+template <>
+rocsparse_status rocsparse_sellcmv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   const float* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_sellc_mat sellc,
+                                   const float* x,
+                                   const float* beta,
+                                   float* y)
+{
+    return rocsparse_ssellcmv(handle, trans, alpha, descr, sellc, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_sellcmv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   const double* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_sellc_mat sellc,
+                                   const double* x,
+                                   const double* beta,
+                                   double* y)
+{
+    return rocsparse_dsellcmv(handle, trans, alpha, descr, sellc, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_sellcmv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   const rocsparse_float_complex* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_sellc_mat sellc,
+                                   const rocsparse_float_complex* x,
+                                   const rocsparse_float_complex* beta,
+                                   rocsparse_float_complex* y)
+{
+    return rocsparse_csellcmv(handle, trans, alpha, descr, sellc, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_sellcmv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   const rocsparse_double_complex* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_sellc_mat sellc,
+                                   const rocsparse_double_complex* x,
+                                   const rocsparse_double_complex* beta,
+                                   rocsparse_double_complex* y)
+{
+    return rocsparse_zsellcmv(handle, trans, alpha, descr, sellc, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_csr5mv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int nnz,
+                                  const float* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  const rocsparse_csr5_mat csr5,
+                                  const float* x,
+                                  const float* beta,
+                                  float* y)
+{
+    return rocsparse_scsr5mv(handle,
+                             trans,
+                             m,
+                             n,
+                             nnz,
+                             alpha,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             csr5,
+                             x,
+                             beta,
+                             y);
+}
+
+template <>
+rocsparse_status rocsparse_csr5mv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int nnz,
+                                  const double* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  const rocsparse_csr5_mat csr5,
+                                  const double* x,
+                                  const double* beta,
+                                  double* y)
+{
+    return rocsparse_dcsr5mv(handle,
+                             trans,
+                             m,
+                             n,
+                             nnz,
+                             alpha,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             csr5,
+                             x,
+                             beta,
+                             y);
+}
+
+template <>
+rocsparse_status rocsparse_csr5mv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int nnz,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_float_complex* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  const rocsparse_csr5_mat csr5,
+                                  const rocsparse_float_complex* x,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex* y)
+{
+    return rocsparse_ccsr5mv(handle,
+                             trans,
+                             m,
+                             n,
+                             nnz,
+                             alpha,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             csr5,
+                             x,
+                             beta,
+                             y);
+}
+
+template <>
+rocsparse_status rocsparse_csr5mv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int nnz,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_double_complex* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  const rocsparse_csr5_mat csr5,
+                                  const rocsparse_double_complex* x,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex* y)
+{
+    return rocsparse_zcsr5mv(handle,
+                             trans,
+                             m,
+                             n,
+                             nnz,
+                             alpha,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             csr5,
+                             x,
+                             beta,
+                             y);
+}
+
+template <>
+rocsparse_status rocsparse_diamv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 rocsparse_int m,
+                                 rocsparse_int n,
+                                 const float* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const float* dia_val,
+                                 const rocsparse_int* dia_offset,
+                                 rocsparse_int ndiag,
+                                 const float* x,
+                                 const float* beta,
+                                 float* y)
+{
+    return rocsparse_sdiamv(
+        handle, trans, m, n, alpha, descr, dia_val, dia_offset, ndiag, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_diamv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 rocsparse_int m,
+                                 rocsparse_int n,
+                                 const double* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const double* dia_val,
+                                 const rocsparse_int* dia_offset,
+                                 rocsparse_int ndiag,
+                                 const double* x,
+                                 const double* beta,
+                                 double* y)
+{
+    return rocsparse_ddiamv(
+        handle, trans, m, n, alpha, descr, dia_val, dia_offset, ndiag, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_diamv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 rocsparse_int m,
+                                 rocsparse_int n,
+                                 const rocsparse_float_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_float_complex* dia_val,
+                                 const rocsparse_int* dia_offset,
+                                 rocsparse_int ndiag,
+                                 const rocsparse_float_complex* x,
+                                 const rocsparse_float_complex* beta,
+                                 rocsparse_float_complex* y)
+{
+    return rocsparse_cdiamv(
+        handle, trans, m, n, alpha, descr, dia_val, dia_offset, ndiag, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_diamv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 rocsparse_int m,
+                                 rocsparse_int n,
+                                 const rocsparse_double_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_double_complex* dia_val,
+                                 const rocsparse_int* dia_offset,
+                                 rocsparse_int ndiag,
+                                 const rocsparse_double_complex* x,
+                                 const rocsparse_double_complex* beta,
+                                 rocsparse_double_complex* y)
+{
+    return rocsparse_zdiamv(
+        handle, trans, m, n, alpha, descr, dia_val, dia_offset, ndiag, x, beta, y);
+}
+
 template <>
 rocsparse_status rocsparse_csrmm(rocsparse_handle handle,
                                  rocsparse_operation trans_A,
@@ -608,295 +1455,1799 @@ rocsparse_status rocsparse_csrmm(rocsparse_handle handle,
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle handle,
-                                               rocsparse_int m,
-                                               rocsparse_int nnz,
-                                               const rocsparse_mat_descr descr,
-                                               const float* csr_val,
-                                               const rocsparse_int* csr_row_ptr,
-                                               const rocsparse_int* csr_col_ind,
-                                               rocsparse_mat_info info,
-                                               size_t* buffer_size)
+rocsparse_status rocsparse_csrsm_buffer_size(rocsparse_handle handle,
+                                             rocsparse_operation trans_A,
+                                             rocsparse_operation trans_B,
+                                             rocsparse_int m,
+                                             rocsparse_int nrhs,
+                                             rocsparse_int nnz,
+                                             const float* alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const float* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             const float* B,
+                                             rocsparse_int ldb,
+                                             rocsparse_mat_info info,
+                                             rocsparse_solve_policy policy,
+                                             size_t* buffer_size)
+{
+    return rocsparse_scsrsm_buffer_size(handle,
+                                        trans_A,
+                                        trans_B,
+                                        m,
+                                        nrhs,
+                                        nnz,
+                                        alpha,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        B,
+                                        ldb,
+                                        info,
+                                        policy,
+                                        buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_buffer_size(rocsparse_handle handle,
+                                             rocsparse_operation trans_A,
+                                             rocsparse_operation trans_B,
+                                             rocsparse_int m,
+                                             rocsparse_int nrhs,
+                                             rocsparse_int nnz,
+                                             const double* alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const double* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             const double* B,
+                                             rocsparse_int ldb,
+                                             rocsparse_mat_info info,
+                                             rocsparse_solve_policy policy,
+                                             size_t* buffer_size)
+{
+    return rocsparse_dcsrsm_buffer_size(handle,
+                                        trans_A,
+                                        trans_B,
+                                        m,
+                                        nrhs,
+                                        nnz,
+                                        alpha,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        B,
+                                        ldb,
+                                        info,
+                                        policy,
+                                        buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle handle,
+                                          rocsparse_operation trans_A,
+                                          rocsparse_operation trans_B,
+                                          rocsparse_int m,
+                                          rocsparse_int nrhs,
+                                          rocsparse_int nnz,
+                                          const float* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const float* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          const float* B,
+                                          rocsparse_int ldb,
+                                          rocsparse_mat_info info,
+                                          rocsparse_analysis_policy analysis,
+                                          rocsparse_solve_policy solve,
+                                          void* temp_buffer)
+{
+    return rocsparse_scsrsm_analysis(handle,
+                                     trans_A,
+                                     trans_B,
+                                     m,
+                                     nrhs,
+                                     nnz,
+                                     alpha,
+                                     descr,
+                                     csr_val,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     B,
+                                     ldb,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle handle,
+                                          rocsparse_operation trans_A,
+                                          rocsparse_operation trans_B,
+                                          rocsparse_int m,
+                                          rocsparse_int nrhs,
+                                          rocsparse_int nnz,
+                                          const double* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const double* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          const double* B,
+                                          rocsparse_int ldb,
+                                          rocsparse_mat_info info,
+                                          rocsparse_analysis_policy analysis,
+                                          rocsparse_solve_policy solve,
+                                          void* temp_buffer)
+{
+    return rocsparse_dcsrsm_analysis(handle,
+                                     trans_A,
+                                     trans_B,
+                                     m,
+                                     nrhs,
+                                     nnz,
+                                     alpha,
+                                     descr,
+                                     csr_val,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     B,
+                                     ldb,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_solve(rocsparse_handle handle,
+                                       rocsparse_operation trans_A,
+                                       rocsparse_operation trans_B,
+                                       rocsparse_int m,
+                                       rocsparse_int nrhs,
+                                       rocsparse_int nnz,
+                                       const float* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const float* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       float* B,
+                                       rocsparse_int ldb,
+                                       rocsparse_mat_info info,
+                                       rocsparse_solve_policy policy,
+                                       void* temp_buffer)
+{
+    return rocsparse_scsrsm_solve(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  nrhs,
+                                  nnz,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  B,
+                                  ldb,
+                                  info,
+                                  policy,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_solve(rocsparse_handle handle,
+                                       rocsparse_operation trans_A,
+                                       rocsparse_operation trans_B,
+                                       rocsparse_int m,
+                                       rocsparse_int nrhs,
+                                       rocsparse_int nnz,
+                                       const double* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const double* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       double* B,
+                                       rocsparse_int ldb,
+                                       rocsparse_mat_info info,
+                                       rocsparse_solve_policy policy,
+                                       void* temp_buffer)
+{
+    return rocsparse_dcsrsm_solve(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  nrhs,
+                                  nnz,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  B,
+                                  ldb,
+                                  info,
+                                  policy,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               size_t* buffer_size)
+{
+    return rocsparse_scsrilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               size_t* buffer_size)
+{
+    return rocsparse_dcsrilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               size_t* buffer_size)
+{
+    return rocsparse_ccsrilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               size_t* buffer_size)
+{
+    return rocsparse_zcsrilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy solve,
+                                            void* temp_buffer)
+{
+    return rocsparse_scsrilu0_analysis(handle,
+                                       m,
+                                       nnz,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy solve,
+                                            void* temp_buffer)
+{
+    return rocsparse_dcsrilu0_analysis(handle,
+                                       m,
+                                       nnz,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const rocsparse_float_complex* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy solve,
+                                            void* temp_buffer)
+{
+    return rocsparse_ccsrilu0_analysis(handle,
+                                       m,
+                                       nnz,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const rocsparse_double_complex* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy solve,
+                                            void* temp_buffer)
+{
+    return rocsparse_zcsrilu0_analysis(handle,
+                                       m,
+                                       nnz,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int nnz,
+                                   const rocsparse_mat_descr descr,
+                                   float* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_mat_info info,
+                                   rocsparse_solve_policy policy,
+                                   void* temp_buffer)
+{
+    return rocsparse_scsrilu0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int nnz,
+                                   const rocsparse_mat_descr descr,
+                                   double* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_mat_info info,
+                                   rocsparse_solve_policy policy,
+                                   void* temp_buffer)
+{
+    return rocsparse_dcsrilu0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int nnz,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_float_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_mat_info info,
+                                   rocsparse_solve_policy policy,
+                                   void* temp_buffer)
+{
+    return rocsparse_ccsrilu0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int nnz,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_double_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_mat_info info,
+                                   rocsparse_solve_policy policy,
+                                   void* temp_buffer)
+{
+    return rocsparse_zcsrilu0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle handle,
+                                                 rocsparse_mat_info info,
+                                                 int enable_boost,
+                                                 const float* boost_tol,
+                                                 const float* boost_val)
+{
+    return rocsparse_scsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle handle,
+                                                 rocsparse_mat_info info,
+                                                 int enable_boost,
+                                                 const double* boost_tol,
+                                                 const double* boost_val)
+{
+    return rocsparse_dcsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle handle,
+                                                 rocsparse_mat_info info,
+                                                 int enable_boost,
+                                                 const float* boost_tol,
+                                                 const rocsparse_float_complex* boost_val)
+{
+    return rocsparse_ccsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle handle,
+                                                 rocsparse_mat_info info,
+                                                 int enable_boost,
+                                                 const double* boost_tol,
+                                                 const rocsparse_double_complex* boost_val)
+{
+    return rocsparse_zcsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+}
+
+template <>
+rocsparse_status rocsparse_csriluk_numeric(rocsparse_handle handle,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const float* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           float* csr_val_M,
+                                           const rocsparse_int* csr_row_ptr_M,
+                                           const rocsparse_int* csr_col_ind_M,
+                                           rocsparse_solve_policy policy,
+                                           void* temp_buffer)
+{
+    return rocsparse_scsriluk_numeric(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      csr_val_M,
+                                      csr_row_ptr_M,
+                                      csr_col_ind_M,
+                                      policy,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csriluk_numeric(rocsparse_handle handle,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const double* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           double* csr_val_M,
+                                           const rocsparse_int* csr_row_ptr_M,
+                                           const rocsparse_int* csr_col_ind_M,
+                                           rocsparse_solve_policy policy,
+                                           void* temp_buffer)
+{
+    return rocsparse_dcsriluk_numeric(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      csr_val_M,
+                                      csr_row_ptr_M,
+                                      csr_col_ind_M,
+                                      policy,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilut_nnz(rocsparse_handle handle,
+                                       rocsparse_int m,
+                                       rocsparse_int nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const float* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       float tau,
+                                       rocsparse_int p,
+                                       rocsparse_mat_info info,
+                                       rocsparse_int* csr_row_ptr_M,
+                                       rocsparse_int* nnz_M)
+{
+    return rocsparse_scsrilut_nnz(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  tau,
+                                  p,
+                                  info,
+                                  csr_row_ptr_M,
+                                  nnz_M);
+}
+
+template <>
+rocsparse_status rocsparse_csrilut_nnz(rocsparse_handle handle,
+                                       rocsparse_int m,
+                                       rocsparse_int nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const double* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       double tau,
+                                       rocsparse_int p,
+                                       rocsparse_mat_info info,
+                                       rocsparse_int* csr_row_ptr_M,
+                                       rocsparse_int* nnz_M)
+{
+    return rocsparse_dcsrilut_nnz(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  tau,
+                                  p,
+                                  info,
+                                  csr_row_ptr_M,
+                                  nnz_M);
+}
+
+template <>
+rocsparse_status rocsparse_csrilut_numeric(rocsparse_handle handle,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const float* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           float* csr_val_M,
+                                           rocsparse_int* csr_row_ptr_M,
+                                           rocsparse_int* csr_col_ind_M,
+                                           rocsparse_solve_policy policy,
+                                           void* temp_buffer)
+{
+    return rocsparse_scsrilut_numeric(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      csr_val_M,
+                                      csr_row_ptr_M,
+                                      csr_col_ind_M,
+                                      policy,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilut_numeric(rocsparse_handle handle,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const double* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           double* csr_val_M,
+                                           rocsparse_int* csr_row_ptr_M,
+                                           rocsparse_int* csr_col_ind_M,
+                                           rocsparse_solve_policy policy,
+                                           void* temp_buffer)
+{
+    return rocsparse_dcsrilut_numeric(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      csr_val_M,
+                                      csr_row_ptr_M,
+                                      csr_col_ind_M,
+                                      policy,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csritilu0_buffer_size(rocsparse_handle handle,
+                                                 rocsparse_int m,
+                                                 rocsparse_int nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float* csr_val,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 const rocsparse_int* csr_col_ind,
+                                                 size_t* buffer_size)
+{
+    return rocsparse_scsritilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csritilu0_buffer_size(rocsparse_handle handle,
+                                                 rocsparse_int m,
+                                                 rocsparse_int nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double* csr_val,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 const rocsparse_int* csr_col_ind,
+                                                 size_t* buffer_size)
+{
+    return rocsparse_dcsritilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csritilu0(rocsparse_handle handle,
+                                     rocsparse_int m,
+                                     rocsparse_int nnz,
+                                     const rocsparse_mat_descr descr,
+                                     float* csr_val,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_int nsweeps,
+                                     float* residual,
+                                     void* temp_buffer)
+{
+    return rocsparse_scsritilu0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, nsweeps, residual, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csritilu0(rocsparse_handle handle,
+                                     rocsparse_int m,
+                                     rocsparse_int nnz,
+                                     const rocsparse_mat_descr descr,
+                                     double* csr_val,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_int nsweeps,
+                                     double* residual,
+                                     void* temp_buffer)
+{
+    return rocsparse_dcsritilu0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, nsweeps, residual, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle handle,
+                                              rocsparse_int m,
+                                              rocsparse_int nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const float* csr_val,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              rocsparse_mat_info info,
+                                              size_t* buffer_size)
+{
+    return rocsparse_scsric0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle handle,
+                                              rocsparse_int m,
+                                              rocsparse_int nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const double* csr_val,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              rocsparse_mat_info info,
+                                              size_t* buffer_size)
+{
+    return rocsparse_dcsric0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csric0_analysis(rocsparse_handle handle,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const float* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy solve,
+                                           void* temp_buffer)
+{
+    return rocsparse_scsric0_analysis(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      analysis,
+                                      solve,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csric0_analysis(rocsparse_handle handle,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const double* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy solve,
+                                           void* temp_buffer)
+{
+    return rocsparse_dcsric0_analysis(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      analysis,
+                                      solve,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csric0(rocsparse_handle handle,
+                                  rocsparse_int m,
+                                  rocsparse_int nnz,
+                                  const rocsparse_mat_descr descr,
+                                  float* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  rocsparse_mat_info info,
+                                  rocsparse_solve_policy policy,
+                                  void* temp_buffer)
+{
+    return rocsparse_scsric0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csric0(rocsparse_handle handle,
+                                  rocsparse_int m,
+                                  rocsparse_int nnz,
+                                  const rocsparse_mat_descr descr,
+                                  double* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  rocsparse_mat_info info,
+                                  rocsparse_solve_policy policy,
+                                  void* temp_buffer)
+{
+    return rocsparse_dcsric0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csr2csc(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const float* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   float* csc_val,
+                                   rocsparse_int* csc_row_ind,
+                                   rocsparse_int* csc_col_ptr,
+                                   rocsparse_action copy_values,
+                                   rocsparse_index_base idx_base,
+                                   void* temp_buffer)
+{
+    return rocsparse_scsr2csc(handle,
+                              m,
+                              n,
+                              nnz,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              csc_val,
+                              csc_row_ind,
+                              csc_col_ptr,
+                              copy_values,
+                              idx_base,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csr2csc(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const double* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   double* csc_val,
+                                   rocsparse_int* csc_row_ind,
+                                   rocsparse_int* csc_col_ptr,
+                                   rocsparse_action copy_values,
+                                   rocsparse_index_base idx_base,
+                                   void* temp_buffer)
+{
+    return rocsparse_dcsr2csc(handle,
+                              m,
+                              n,
+                              nnz,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              csc_val,
+                              csc_row_ind,
+                              csc_col_ptr,
+                              copy_values,
+                              idx_base,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csr2csc(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_float_complex* csc_val,
+                                   rocsparse_int* csc_row_ind,
+                                   rocsparse_int* csc_col_ptr,
+                                   rocsparse_action copy_values,
+                                   rocsparse_index_base idx_base,
+                                   void* temp_buffer)
+{
+    return rocsparse_ccsr2csc(handle,
+                              m,
+                              n,
+                              nnz,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              csc_val,
+                              csc_row_ind,
+                              csc_col_ptr,
+                              copy_values,
+                              idx_base,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csr2csc(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_double_complex* csc_val,
+                                   rocsparse_int* csc_row_ind,
+                                   rocsparse_int* csc_col_ptr,
+                                   rocsparse_action copy_values,
+                                   rocsparse_index_base idx_base,
+                                   void* temp_buffer)
+{
+    return rocsparse_zcsr2csc(handle,
+                              m,
+                              n,
+                              nnz,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              csc_val,
+                              csc_row_ind,
+                              csc_col_ptr,
+                              copy_values,
+                              idx_base,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csr2ell(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const float* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   const rocsparse_mat_descr ell_descr,
+                                   rocsparse_int ell_width,
+                                   float* ell_val,
+                                   rocsparse_int* ell_col_ind)
+{
+    return rocsparse_scsr2ell(handle,
+                              m,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              ell_descr,
+                              ell_width,
+                              ell_val,
+                              ell_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csr2ell(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const double* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   const rocsparse_mat_descr ell_descr,
+                                   rocsparse_int ell_width,
+                                   double* ell_val,
+                                   rocsparse_int* ell_col_ind)
+{
+    return rocsparse_dcsr2ell(handle,
+                              m,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              ell_descr,
+                              ell_width,
+                              ell_val,
+                              ell_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csr2ell(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   const rocsparse_mat_descr ell_descr,
+                                   rocsparse_int ell_width,
+                                   rocsparse_float_complex* ell_val,
+                                   rocsparse_int* ell_col_ind)
+{
+    return rocsparse_ccsr2ell(handle,
+                              m,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              ell_descr,
+                              ell_width,
+                              ell_val,
+                              ell_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csr2ell(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   const rocsparse_mat_descr ell_descr,
+                                   rocsparse_int ell_width,
+                                   rocsparse_double_complex* ell_val,
+                                   rocsparse_int* ell_col_ind)
+{
+    return rocsparse_zcsr2ell(handle,
+                              m,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              ell_descr,
+                              ell_width,
+                              ell_val,
+                              ell_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr descr,
+                                   const float* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_hyb_mat hyb,
+                                   rocsparse_int user_ell_width,
+                                   rocsparse_hyb_partition partition_type)
+{
+    return rocsparse_scsr2hyb(handle,
+                              m,
+                              n,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              hyb,
+                              user_ell_width,
+                              partition_type);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr descr,
+                                   const double* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_hyb_mat hyb,
+                                   rocsparse_int user_ell_width,
+                                   rocsparse_hyb_partition partition_type)
+{
+    return rocsparse_dcsr2hyb(handle,
+                              m,
+                              n,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              hyb,
+                              user_ell_width,
+                              partition_type);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_hyb_mat hyb,
+                                   rocsparse_int user_ell_width,
+                                   rocsparse_hyb_partition partition_type)
+{
+    return rocsparse_ccsr2hyb(handle,
+                              m,
+                              n,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              hyb,
+                              user_ell_width,
+                              partition_type);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_hyb_mat hyb,
+                                   rocsparse_int user_ell_width,
+                                   rocsparse_hyb_partition partition_type)
+{
+    return rocsparse_zcsr2hyb(handle,
+                              m,
+                              n,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              hyb,
+                              user_ell_width,
+                              partition_type);
+}
+
+template <>
+rocsparse_status rocsparse_ell2csr(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr ell_descr,
+                                   rocsparse_int ell_width,
+                                   const float* ell_val,
+                                   const rocsparse_int* ell_col_ind,
+                                   const rocsparse_mat_descr csr_descr,
+                                   float* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   rocsparse_int* csr_col_ind)
+{
+    return rocsparse_sell2csr(handle,
+                              m,
+                              n,
+                              ell_descr,
+                              ell_width,
+                              ell_val,
+                              ell_col_ind,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_ell2csr(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr ell_descr,
+                                   rocsparse_int ell_width,
+                                   const double* ell_val,
+                                   const rocsparse_int* ell_col_ind,
+                                   const rocsparse_mat_descr csr_descr,
+                                   double* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   rocsparse_int* csr_col_ind)
+{
+    return rocsparse_dell2csr(handle,
+                              m,
+                              n,
+                              ell_descr,
+                              ell_width,
+                              ell_val,
+                              ell_col_ind,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_ell2csr(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr ell_descr,
+                                   rocsparse_int ell_width,
+                                   const rocsparse_float_complex* ell_val,
+                                   const rocsparse_int* ell_col_ind,
+                                   const rocsparse_mat_descr csr_descr,
+                                   rocsparse_float_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   rocsparse_int* csr_col_ind)
+{
+    return rocsparse_cell2csr(handle,
+                              m,
+                              n,
+                              ell_descr,
+                              ell_width,
+                              ell_val,
+                              ell_col_ind,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_ell2csr(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr ell_descr,
+                                   rocsparse_int ell_width,
+                                   const rocsparse_double_complex* ell_val,
+                                   const rocsparse_int* ell_col_ind,
+                                   const rocsparse_mat_descr csr_descr,
+                                   rocsparse_double_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   rocsparse_int* csr_col_ind)
+{
+    return rocsparse_zell2csr(handle,
+                              m,
+                              n,
+                              ell_descr,
+                              ell_width,
+                              ell_val,
+                              ell_col_ind,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csr2bsr(rocsparse_handle handle,
+                                   rocsparse_direction dir,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const float* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_int block_dim,
+                                   const rocsparse_mat_descr bsr_descr,
+                                   float* bsr_val,
+                                   const rocsparse_int* bsr_row_ptr,
+                                   rocsparse_int* bsr_col_ind)
+{
+    return rocsparse_scsr2bsr(handle,
+                              dir,
+                              m,
+                              n,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              block_dim,
+                              bsr_descr,
+                              bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csr2bsr(rocsparse_handle handle,
+                                   rocsparse_direction dir,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const double* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_int block_dim,
+                                   const rocsparse_mat_descr bsr_descr,
+                                   double* bsr_val,
+                                   const rocsparse_int* bsr_row_ptr,
+                                   rocsparse_int* bsr_col_ind)
+{
+    return rocsparse_dcsr2bsr(handle,
+                              dir,
+                              m,
+                              n,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              block_dim,
+                              bsr_descr,
+                              bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csr2bsr(rocsparse_handle handle,
+                                   rocsparse_direction dir,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_int block_dim,
+                                   const rocsparse_mat_descr bsr_descr,
+                                   rocsparse_float_complex* bsr_val,
+                                   const rocsparse_int* bsr_row_ptr,
+                                   rocsparse_int* bsr_col_ind)
+{
+    return rocsparse_ccsr2bsr(handle,
+                              dir,
+                              m,
+                              n,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              block_dim,
+                              bsr_descr,
+                              bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csr2bsr(rocsparse_handle handle,
+                                   rocsparse_direction dir,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_int block_dim,
+                                   const rocsparse_mat_descr bsr_descr,
+                                   rocsparse_double_complex* bsr_val,
+                                   const rocsparse_int* bsr_row_ptr,
+                                   rocsparse_int* bsr_col_ind)
+{
+    return rocsparse_zcsr2bsr(handle,
+                              dir,
+                              m,
+                              n,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              block_dim,
+                              bsr_descr,
+                              bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_bsr2csr(rocsparse_handle handle,
+                                   rocsparse_direction dir,
+                                   rocsparse_int mb,
+                                   rocsparse_int nb,
+                                   const rocsparse_mat_descr bsr_descr,
+                                   const float* bsr_val,
+                                   const rocsparse_int* bsr_row_ptr,
+                                   const rocsparse_int* bsr_col_ind,
+                                   rocsparse_int block_dim,
+                                   const rocsparse_mat_descr csr_descr,
+                                   float* csr_val,
+                                   rocsparse_int* csr_row_ptr,
+                                   rocsparse_int* csr_col_ind)
+{
+    return rocsparse_sbsr2csr(handle,
+                              dir,
+                              mb,
+                              nb,
+                              bsr_descr,
+                              bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind,
+                              block_dim,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_bsr2csr(rocsparse_handle handle,
+                                   rocsparse_direction dir,
+                                   rocsparse_int mb,
+                                   rocsparse_int nb,
+                                   const rocsparse_mat_descr bsr_descr,
+                                   const double* bsr_val,
+                                   const rocsparse_int* bsr_row_ptr,
+                                   const rocsparse_int* bsr_col_ind,
+                                   rocsparse_int block_dim,
+                                   const rocsparse_mat_descr csr_descr,
+                                   double* csr_val,
+                                   rocsparse_int* csr_row_ptr,
+                                   rocsparse_int* csr_col_ind)
 {
-    return rocsparse_scsrilu0_buffer_size(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    return rocsparse_dbsr2csr(handle,
+                              dir,
+                              mb,
+                              nb,
+                              bsr_descr,
+                              bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind,
+                              block_dim,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle handle,
-                                               rocsparse_int m,
-                                               rocsparse_int nnz,
-                                               const rocsparse_mat_descr descr,
-                                               const double* csr_val,
-                                               const rocsparse_int* csr_row_ptr,
-                                               const rocsparse_int* csr_col_ind,
-                                               rocsparse_mat_info info,
-                                               size_t* buffer_size)
+rocsparse_status rocsparse_bsr2csr(rocsparse_handle handle,
+                                   rocsparse_direction dir,
+                                   rocsparse_int mb,
+                                   rocsparse_int nb,
+                                   const rocsparse_mat_descr bsr_descr,
+                                   const rocsparse_float_complex* bsr_val,
+                                   const rocsparse_int* bsr_row_ptr,
+                                   const rocsparse_int* bsr_col_ind,
+                                   rocsparse_int block_dim,
+                                   const rocsparse_mat_descr csr_descr,
+                                   rocsparse_float_complex* csr_val,
+                                   rocsparse_int* csr_row_ptr,
+                                   rocsparse_int* csr_col_ind)
 {
-    return rocsparse_dcsrilu0_buffer_size(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    return rocsparse_cbsr2csr(handle,
+                              dir,
+                              mb,
+                              nb,
+                              bsr_descr,
+                              bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind,
+                              block_dim,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle handle,
-                                            rocsparse_int m,
-                                            rocsparse_int nnz,
-                                            const rocsparse_mat_descr descr,
-                                            const float* csr_val,
-                                            const rocsparse_int* csr_row_ptr,
-                                            const rocsparse_int* csr_col_ind,
-                                            rocsparse_mat_info info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy solve,
-                                            void* temp_buffer)
+rocsparse_status rocsparse_bsr2csr(rocsparse_handle handle,
+                                   rocsparse_direction dir,
+                                   rocsparse_int mb,
+                                   rocsparse_int nb,
+                                   const rocsparse_mat_descr bsr_descr,
+                                   const rocsparse_double_complex* bsr_val,
+                                   const rocsparse_int* bsr_row_ptr,
+                                   const rocsparse_int* bsr_col_ind,
+                                   rocsparse_int block_dim,
+                                   const rocsparse_mat_descr csr_descr,
+                                   rocsparse_double_complex* csr_val,
+                                   rocsparse_int* csr_row_ptr,
+                                   rocsparse_int* csr_col_ind)
 {
-    return rocsparse_scsrilu0_analysis(handle,
-                                       m,
-                                       nnz,
-                                       descr,
-                                       csr_val,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       info,
-                                       analysis,
-                                       solve,
-                                       temp_buffer);
+    return rocsparse_zbsr2csr(handle,
+                              dir,
+                              mb,
+                              nb,
+                              bsr_descr,
+                              bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind,
+                              block_dim,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle handle,
-                                            rocsparse_int m,
-                                            rocsparse_int nnz,
-                                            const rocsparse_mat_descr descr,
-                                            const double* csr_val,
-                                            const rocsparse_int* csr_row_ptr,
-                                            const rocsparse_int* csr_col_ind,
-                                            rocsparse_mat_info info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy solve,
-                                            void* temp_buffer)
+rocsparse_status rocsparse_csr2sellc(rocsparse_handle handle,
+                                     rocsparse_int m,
+                                     rocsparse_int n,
+                                     const rocsparse_mat_descr descr,
+                                     const float* csr_val,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_sellc_mat sellc,
+                                     rocsparse_int sigma)
 {
-    return rocsparse_dcsrilu0_analysis(handle,
-                                       m,
-                                       nnz,
-                                       descr,
-                                       csr_val,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       info,
-                                       analysis,
-                                       solve,
-                                       temp_buffer);
+    return rocsparse_scsr2sellc(
+        handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, sellc, sigma);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0(rocsparse_handle handle,
-                                   rocsparse_int m,
-                                   rocsparse_int nnz,
-                                   const rocsparse_mat_descr descr,
-                                   float* csr_val,
-                                   const rocsparse_int* csr_row_ptr,
-                                   const rocsparse_int* csr_col_ind,
-                                   rocsparse_mat_info info,
-                                   rocsparse_solve_policy policy,
-                                   void* temp_buffer)
+rocsparse_status rocsparse_csr2sellc(rocsparse_handle handle,
+                                     rocsparse_int m,
+                                     rocsparse_int n,
+                                     const rocsparse_mat_descr descr,
+                                     const double* csr_val,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_sellc_mat sellc,
+                                     rocsparse_int sigma)
 {
-    return rocsparse_scsrilu0(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    return rocsparse_dcsr2sellc(
+        handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, sellc, sigma);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0(rocsparse_handle handle,
-                                   rocsparse_int m,
-                                   rocsparse_int nnz,
-                                   const rocsparse_mat_descr descr,
-                                   double* csr_val,
-                                   const rocsparse_int* csr_row_ptr,
-                                   const rocsparse_int* csr_col_ind,
-                                   rocsparse_mat_info info,
-                                   rocsparse_solve_policy policy,
-                                   void* temp_buffer)
+rocsparse_status rocsparse_csr2sellc(rocsparse_handle handle,
+                                     rocsparse_int m,
+                                     rocsparse_int n,
+                                     const rocsparse_mat_descr descr,
+                                     const rocsparse_float_complex* csr_val,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_sellc_mat sellc,
+                                     rocsparse_int sigma)
 {
-    return rocsparse_dcsrilu0(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    return rocsparse_ccsr2sellc(
+        handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, sellc, sigma);
 }
 
 template <>
-rocsparse_status rocsparse_csr2csc(rocsparse_handle handle,
+rocsparse_status rocsparse_csr2sellc(rocsparse_handle handle,
+                                     rocsparse_int m,
+                                     rocsparse_int n,
+                                     const rocsparse_mat_descr descr,
+                                     const rocsparse_double_complex* csr_val,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_sellc_mat sellc,
+                                     rocsparse_int sigma)
+{
+    return rocsparse_zcsr2sellc(
+        handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, sellc, sigma);
+}
+
+template <>
+rocsparse_status rocsparse_csr2dia(rocsparse_handle handle,
                                    rocsparse_int m,
                                    rocsparse_int n,
-                                   rocsparse_int nnz,
+                                   const rocsparse_mat_descr csr_descr,
                                    const float* csr_val,
                                    const rocsparse_int* csr_row_ptr,
                                    const rocsparse_int* csr_col_ind,
-                                   float* csc_val,
-                                   rocsparse_int* csc_row_ind,
-                                   rocsparse_int* csc_col_ptr,
-                                   rocsparse_action copy_values,
-                                   rocsparse_index_base idx_base,
-                                   void* temp_buffer)
+                                   const rocsparse_mat_descr dia_descr,
+                                   rocsparse_int ndiag,
+                                   float* dia_val,
+                                   rocsparse_int* dia_offset)
 {
-    return rocsparse_scsr2csc(handle,
+    return rocsparse_scsr2dia(handle,
                               m,
                               n,
-                              nnz,
+                              csr_descr,
                               csr_val,
                               csr_row_ptr,
                               csr_col_ind,
-                              csc_val,
-                              csc_row_ind,
-                              csc_col_ptr,
-                              copy_values,
-                              idx_base,
-                              temp_buffer);
+                              dia_descr,
+                              ndiag,
+                              dia_val,
+                              dia_offset);
 }
 
 template <>
-rocsparse_status rocsparse_csr2csc(rocsparse_handle handle,
+rocsparse_status rocsparse_csr2dia(rocsparse_handle handle,
                                    rocsparse_int m,
                                    rocsparse_int n,
-                                   rocsparse_int nnz,
+                                   const rocsparse_mat_descr csr_descr,
                                    const double* csr_val,
                                    const rocsparse_int* csr_row_ptr,
                                    const rocsparse_int* csr_col_ind,
-                                   double* csc_val,
-                                   rocsparse_int* csc_row_ind,
-                                   rocsparse_int* csc_col_ptr,
-                                   rocsparse_action copy_values,
-                                   rocsparse_index_base idx_base,
-                                   void* temp_buffer)
+                                   const rocsparse_mat_descr dia_descr,
+                                   rocsparse_int ndiag,
+                                   double* dia_val,
+                                   rocsparse_int* dia_offset)
 {
-    return rocsparse_dcsr2csc(handle,
+    return rocsparse_dcsr2dia(handle,
                               m,
                               n,
-                              nnz,
+                              csr_descr,
                               csr_val,
                               csr_row_ptr,
                               csr_col_ind,
-                              csc_val,
-                              csc_row_ind,
-                              csc_col_ptr,
-                              copy_values,
-                              idx_base,
-                              temp_buffer);
+                              dia_descr,
+                              ndiag,
+                              dia_val,
+                              dia_offset);
 }
 
 template <>
-rocsparse_status rocsparse_csr2ell(rocsparse_handle handle,
+rocsparse_status rocsparse_csr2dia(rocsparse_handle handle,
                                    rocsparse_int m,
+                                   rocsparse_int n,
                                    const rocsparse_mat_descr csr_descr,
-                                   const float* csr_val,
+                                   const rocsparse_float_complex* csr_val,
                                    const rocsparse_int* csr_row_ptr,
                                    const rocsparse_int* csr_col_ind,
-                                   const rocsparse_mat_descr ell_descr,
-                                   rocsparse_int ell_width,
-                                   float* ell_val,
-                                   rocsparse_int* ell_col_ind)
+                                   const rocsparse_mat_descr dia_descr,
+                                   rocsparse_int ndiag,
+                                   rocsparse_float_complex* dia_val,
+                                   rocsparse_int* dia_offset)
 {
-    return rocsparse_scsr2ell(handle,
+    return rocsparse_ccsr2dia(handle,
                               m,
+                              n,
                               csr_descr,
                               csr_val,
                               csr_row_ptr,
                               csr_col_ind,
-                              ell_descr,
-                              ell_width,
-                              ell_val,
-                              ell_col_ind);
+                              dia_descr,
+                              ndiag,
+                              dia_val,
+                              dia_offset);
 }
 
 template <>
-rocsparse_status rocsparse_csr2ell(rocsparse_handle handle,
+rocsparse_status rocsparse_csr2dia(rocsparse_handle handle,
                                    rocsparse_int m,
+                                   rocsparse_int n,
                                    const rocsparse_mat_descr csr_descr,
-                                   const double* csr_val,
+                                   const rocsparse_double_complex* csr_val,
                                    const rocsparse_int* csr_row_ptr,
                                    const rocsparse_int* csr_col_ind,
-                                   const rocsparse_mat_descr ell_descr,
-                                   rocsparse_int ell_width,
-                                   double* ell_val,
-                                   rocsparse_int* ell_col_ind)
+                                   const rocsparse_mat_descr dia_descr,
+                                   rocsparse_int ndiag,
+                                   rocsparse_double_complex* dia_val,
+                                   rocsparse_int* dia_offset)
 {
-    return rocsparse_dcsr2ell(handle,
+    return rocsparse_zcsr2dia(handle,
                               m,
+                              n,
                               csr_descr,
                               csr_val,
                               csr_row_ptr,
                               csr_col_ind,
-                              ell_descr,
-                              ell_width,
-                              ell_val,
-                              ell_col_ind);
+                              dia_descr,
+                              ndiag,
+                              dia_val,
+                              dia_offset);
 }
 
 template <>
-rocsparse_status rocsparse_csr2hyb(rocsparse_handle handle,
+rocsparse_status rocsparse_dia2csr_nnz(rocsparse_handle handle,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       const rocsparse_mat_descr dia_descr,
+                                       rocsparse_int ndiag,
+                                       const float* dia_val,
+                                       const rocsparse_int* dia_offset,
+                                       const rocsparse_mat_descr csr_descr,
+                                       rocsparse_int* csr_row_ptr,
+                                       rocsparse_int* csr_nnz)
+{
+    return rocsparse_sdia2csr_nnz(
+        handle, m, n, dia_descr, ndiag, dia_val, dia_offset, csr_descr, csr_row_ptr, csr_nnz);
+}
+
+template <>
+rocsparse_status rocsparse_dia2csr_nnz(rocsparse_handle handle,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       const rocsparse_mat_descr dia_descr,
+                                       rocsparse_int ndiag,
+                                       const double* dia_val,
+                                       const rocsparse_int* dia_offset,
+                                       const rocsparse_mat_descr csr_descr,
+                                       rocsparse_int* csr_row_ptr,
+                                       rocsparse_int* csr_nnz)
+{
+    return rocsparse_ddia2csr_nnz(
+        handle, m, n, dia_descr, ndiag, dia_val, dia_offset, csr_descr, csr_row_ptr, csr_nnz);
+}
+
+template <>
+rocsparse_status rocsparse_dia2csr_nnz(rocsparse_handle handle,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       const rocsparse_mat_descr dia_descr,
+                                       rocsparse_int ndiag,
+                                       const rocsparse_float_complex* dia_val,
+                                       const rocsparse_int* dia_offset,
+                                       const rocsparse_mat_descr csr_descr,
+                                       rocsparse_int* csr_row_ptr,
+                                       rocsparse_int* csr_nnz)
+{
+    return rocsparse_cdia2csr_nnz(
+        handle, m, n, dia_descr, ndiag, dia_val, dia_offset, csr_descr, csr_row_ptr, csr_nnz);
+}
+
+template <>
+rocsparse_status rocsparse_dia2csr_nnz(rocsparse_handle handle,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       const rocsparse_mat_descr dia_descr,
+                                       rocsparse_int ndiag,
+                                       const rocsparse_double_complex* dia_val,
+                                       const rocsparse_int* dia_offset,
+                                       const rocsparse_mat_descr csr_descr,
+                                       rocsparse_int* csr_row_ptr,
+                                       rocsparse_int* csr_nnz)
+{
+    return rocsparse_zdia2csr_nnz(
+        handle, m, n, dia_descr, ndiag, dia_val, dia_offset, csr_descr, csr_row_ptr, csr_nnz);
+}
+
+template <>
+rocsparse_status rocsparse_dia2csr(rocsparse_handle handle,
                                    rocsparse_int m,
                                    rocsparse_int n,
-                                   const rocsparse_mat_descr descr,
-                                   const float* csr_val,
+                                   const rocsparse_mat_descr dia_descr,
+                                   rocsparse_int ndiag,
+                                   const float* dia_val,
+                                   const rocsparse_int* dia_offset,
+                                   const rocsparse_mat_descr csr_descr,
+                                   float* csr_val,
                                    const rocsparse_int* csr_row_ptr,
-                                   const rocsparse_int* csr_col_ind,
-                                   rocsparse_hyb_mat hyb,
-                                   rocsparse_int user_ell_width,
-                                   rocsparse_hyb_partition partition_type)
+                                   rocsparse_int* csr_col_ind)
 {
-    return rocsparse_scsr2hyb(handle,
+    return rocsparse_sdia2csr(handle,
                               m,
                               n,
-                              descr,
+                              dia_descr,
+                              ndiag,
+                              dia_val,
+                              dia_offset,
+                              csr_descr,
                               csr_val,
                               csr_row_ptr,
-                              csr_col_ind,
-                              hyb,
-                              user_ell_width,
-                              partition_type);
+                              csr_col_ind);
 }
 
 template <>
-rocsparse_status rocsparse_csr2hyb(rocsparse_handle handle,
+rocsparse_status rocsparse_dia2csr(rocsparse_handle handle,
                                    rocsparse_int m,
                                    rocsparse_int n,
-                                   const rocsparse_mat_descr descr,
-                                   const double* csr_val,
+                                   const rocsparse_mat_descr dia_descr,
+                                   rocsparse_int ndiag,
+                                   const double* dia_val,
+                                   const rocsparse_int* dia_offset,
+                                   const rocsparse_mat_descr csr_descr,
+                                   double* csr_val,
                                    const rocsparse_int* csr_row_ptr,
-                                   const rocsparse_int* csr_col_ind,
-                                   rocsparse_hyb_mat hyb,
-                                   rocsparse_int user_ell_width,
-                                   rocsparse_hyb_partition partition_type)
+                                   rocsparse_int* csr_col_ind)
 {
-    return rocsparse_dcsr2hyb(handle,
+    return rocsparse_ddia2csr(handle,
                               m,
                               n,
-                              descr,
+                              dia_descr,
+                              ndiag,
+                              dia_val,
+                              dia_offset,
+                              csr_descr,
                               csr_val,
                               csr_row_ptr,
-                              csr_col_ind,
-                              hyb,
-                              user_ell_width,
-                              partition_type);
+                              csr_col_ind);
 }
 
 template <>
-rocsparse_status rocsparse_ell2csr(rocsparse_handle handle,
+rocsparse_status rocsparse_dia2csr(rocsparse_handle handle,
                                    rocsparse_int m,
                                    rocsparse_int n,
-                                   const rocsparse_mat_descr ell_descr,
-                                   rocsparse_int ell_width,
-                                   const float* ell_val,
-                                   const rocsparse_int* ell_col_ind,
+                                   const rocsparse_mat_descr dia_descr,
+                                   rocsparse_int ndiag,
+                                   const rocsparse_float_complex* dia_val,
+                                   const rocsparse_int* dia_offset,
                                    const rocsparse_mat_descr csr_descr,
-                                   float* csr_val,
+                                   rocsparse_float_complex* csr_val,
                                    const rocsparse_int* csr_row_ptr,
                                    rocsparse_int* csr_col_ind)
 {
-    return rocsparse_sell2csr(handle,
+    return rocsparse_cdia2csr(handle,
                               m,
                               n,
-                              ell_descr,
-                              ell_width,
-                              ell_val,
-                              ell_col_ind,
+                              dia_descr,
+                              ndiag,
+                              dia_val,
+                              dia_offset,
                               csr_descr,
                               csr_val,
                               csr_row_ptr,
@@ -904,25 +3255,25 @@ rocsparse_status rocsparse_ell2csr(rocsparse_handle handle,
 }
 
 template <>
-rocsparse_status rocsparse_ell2csr(rocsparse_handle handle,
+rocsparse_status rocsparse_dia2csr(rocsparse_handle handle,
                                    rocsparse_int m,
                                    rocsparse_int n,
-                                   const rocsparse_mat_descr ell_descr,
-                                   rocsparse_int ell_width,
-                                   const double* ell_val,
-                                   const rocsparse_int* ell_col_ind,
+                                   const rocsparse_mat_descr dia_descr,
+                                   rocsparse_int ndiag,
+                                   const rocsparse_double_complex* dia_val,
+                                   const rocsparse_int* dia_offset,
                                    const rocsparse_mat_descr csr_descr,
-                                   double* csr_val,
+                                   rocsparse_double_complex* csr_val,
                                    const rocsparse_int* csr_row_ptr,
                                    rocsparse_int* csr_col_ind)
 {
-    return rocsparse_dell2csr(handle,
+    return rocsparse_zdia2csr(handle,
                               m,
                               n,
-                              ell_descr,
-                              ell_width,
-                              ell_val,
-                              ell_col_ind,
+                              dia_descr,
+                              ndiag,
+                              dia_val,
+                              dia_offset,
                               csr_descr,
                               csr_val,
                               csr_row_ptr,
@@ -82,6 +82,48 @@ void unit_check_general(
     }
 }
 
+template <>
+void unit_check_general(rocsparse_int M,
+                        rocsparse_int N,
+                        rocsparse_int lda,
+                        rocsparse_float_complex* hCPU,
+                        rocsparse_float_complex* hGPU)
+{
+    for(rocsparse_int j = 0; j < N; j++)
+    {
+        for(rocsparse_int i = 0; i < M; i++)
+        {
+#ifdef GOOGLE_TEST
+            ASSERT_FLOAT_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
+            ASSERT_FLOAT_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
+#else
+            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+#endif
+        }
+    }
+}
+
+template <>
+void unit_check_general(rocsparse_int M,
+                        rocsparse_int N,
+                        rocsparse_int lda,
+                        rocsparse_double_complex* hCPU,
+                        rocsparse_double_complex* hGPU)
+{
+    for(rocsparse_int j = 0; j < N; j++)
+    {
+        for(rocsparse_int i = 0; i < M; i++)
+        {
+#ifdef GOOGLE_TEST
+            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
+            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
+#else
+            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+#endif
+        }
+    }
+}
+
 template <>
 void unit_check_general(
     rocsparse_int M, rocsparse_int N, rocsparse_int lda, rocsparse_int* hCPU, rocsparse_int* hGPU)
@@ -116,6 +158,43 @@ void unit_check_general(
     }
 }
 
+template <>
+void unit_check_general(rocsparse_int M,
+                        rocsparse_int N,
+                        rocsparse_int lda,
+                        unsigned long long* hCPU,
+                        unsigned long long* hGPU)
+{
+    for(rocsparse_int j = 0; j < N; j++)
+    {
+        for(rocsparse_int i = 0; i < M; i++)
+        {
+#ifdef GOOGLE_TEST
+            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
+#else
+            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+#endif
+        }
+    }
+}
+
+template <>
+void unit_check_general(
+    rocsparse_int M, rocsparse_int N, rocsparse_int lda, uint32_t* hCPU, uint32_t* hGPU)
+{
+    for(rocsparse_int j = 0; j < N; j++)
+    {
+        for(rocsparse_int i = 0; i < M; i++)
+        {
+#ifdef GOOGLE_TEST
+            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
+#else
+            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+#endif
+        }
+    }
+}
+
 /*! \brief Template: gtest unit compare two matrices float/double/complex */
 // Do not put a wrapper over ASSERT_FLOAT_EQ, since assert exit the current function NOT the test
 // case
@@ -157,3 +236,49 @@ void unit_check_near(
         }
     }
 }
+
+template <>
+void unit_check_near(rocsparse_int M,
+                     rocsparse_int N,
+                     rocsparse_int lda,
+                     rocsparse_float_complex* hCPU,
+                     rocsparse_float_complex* hGPU)
+{
+    for(rocsparse_int j = 0; j < N; j++)
+    {
+        for(rocsparse_int i = 0; i < M; i++)
+        {
+            float compare_val = std::max(std::abs(hCPU[i + j * lda]) * 1e-3f,
+                                         10 * std::numeric_limits<float>::epsilon());
+#ifdef GOOGLE_TEST
+            ASSERT_NEAR(hCPU[i + j * lda].x, hGPU[i + j * lda].x, compare_val);
+            ASSERT_NEAR(hCPU[i + j * lda].y, hGPU[i + j * lda].y, compare_val);
+#else
+            assert(std::abs(hCPU[i + j * lda] - hGPU[i + j * lda]) < compare_val);
+#endif
+        }
+    }
+}
+
+template <>
+void unit_check_near(rocsparse_int M,
+                     rocsparse_int N,
+                     rocsparse_int lda,
+                     rocsparse_double_complex* hCPU,
+                     rocsparse_double_complex* hGPU)
+{
+    for(rocsparse_int j = 0; j < N; j++)
+    {
+        for(rocsparse_int i = 0; i < M; i++)
+        {
+            double compare_val = std::max(std::abs(hCPU[i + j * lda]) * 1e-10,
+                                          10 * std::numeric_limits<double>::epsilon());
+#ifdef GOOGLE_TEST
+            ASSERT_NEAR(hCPU[i + j * lda].x, hGPU[i + j * lda].x, compare_val);
+            ASSERT_NEAR(hCPU[i + j * lda].y, hGPU[i + j * lda].y, compare_val);
+#else
+            assert(std::abs(hCPU[i + j * lda] - hGPU[i + j * lda]) < compare_val);
+#endif
+        }
+    }
+}
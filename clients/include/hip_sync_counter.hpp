@@ -0,0 +1,54 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef HIP_SYNC_COUNTER_HPP
+#define HIP_SYNC_COUNTER_HPP
+
+#include <cstddef>
+
+/*!\file
+ * \brief counts HIP runtime calls that block the host until the device is idle.
+ * The HIP runtime functions are interposed by the test executable, such that calls
+ * of the rocSPARSE library are counted as well.
+ */
+
+/*! \brief returns true, if synchronizing HIP calls can be counted on this platform */
+bool hip_sync_counter_available();
+
+/*! \brief reset the number of synchronizing HIP calls */
+void hip_sync_counter_reset();
+
+/*! \brief number of synchronizing HIP calls since the last reset */
+size_t hip_sync_counter_get();
+
+/*! \brief reset the number of hipMalloc calls */
+void hip_malloc_counter_reset();
+
+/*! \brief number of hipMalloc calls since the last reset. hipMalloc may synchronize
+ *  the device and is not expected from routines that serve their device memory from
+ *  the memory pool of the handle */
+size_t hip_malloc_counter_get();
+
+#endif // HIP_SYNC_COUNTER_HPP
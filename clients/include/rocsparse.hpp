@@ -124,6 +124,39 @@ rocsparse_status rocsparse_csrmv(rocsparse_handle handle,
                                  const T* beta,
                                  T* y);
 
+template <typename T, typename A>
+rocsparse_status rocsparse_csrmv_mixed(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       rocsparse_int nnz,
+                                       const T* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const A* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_mat_info info,
+                                       const T* x,
+                                       const T* beta,
+                                       T* y);
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_multi(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       rocsparse_int nnz,
+                                       rocsparse_int k,
+                                       const T* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const T* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_mat_info info,
+                                       const T* x,
+                                       const T* beta,
+                                       T* y);
+
 template <typename T>
 rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle handle,
                                              rocsparse_operation trans,
@@ -166,6 +199,33 @@ rocsparse_status rocsparse_csrsv_solve(rocsparse_handle handle,
                                        rocsparse_solve_policy policy,
                                        void* temp_buffer);
 
+template <typename T>
+rocsparse_status rocsparse_csritsv_buffer_size(rocsparse_handle handle,
+                                               rocsparse_operation trans,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const T* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               size_t* buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_csritsv_solve(rocsparse_handle handle,
+                                         rocsparse_operation trans,
+                                         rocsparse_int m,
+                                         rocsparse_int nnz,
+                                         const T* alpha,
+                                         const rocsparse_mat_descr descr,
+                                         const T* csr_val,
+                                         const rocsparse_int* csr_row_ptr,
+                                         const rocsparse_int* csr_col_ind,
+                                         const T* x,
+                                         T* y,
+                                         rocsparse_int nsweeps,
+                                         T* residual,
+                                         void* temp_buffer);
+
 template <typename T>
 rocsparse_status rocsparse_ellmv(rocsparse_handle handle,
                                  rocsparse_operation trans,
@@ -190,6 +250,73 @@ rocsparse_status rocsparse_hybmv(rocsparse_handle handle,
                                  const T* beta,
                                  T* y);
 
+template <typename T, typename A>
+rocsparse_status rocsparse_hybmv_mixed(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       const T* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_hyb_mat hyb,
+                                       const T* x,
+                                       const T* beta,
+                                       T* y);
+
+template <typename T>
+rocsparse_status rocsparse_bsrmv(rocsparse_handle handle,
+                                 rocsparse_direction dir,
+                                 rocsparse_operation trans,
+                                 rocsparse_int mb,
+                                 rocsparse_int nb,
+                                 rocsparse_int nnzb,
+                                 const T* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const T* bsr_val,
+                                 const rocsparse_int* bsr_row_ptr,
+                                 const rocsparse_int* bsr_col_ind,
+                                 rocsparse_int block_dim,
+                                 const T* x,
+                                 const T* beta,
+                                 T* y);
+
+template <typename T>
+rocsparse_status rocsparse_sellcmv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   const T* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_sellc_mat sellc,
+                                   const T* x,
+                                   const T* beta,
+                                   T* y);
+
+template <typename T>
+rocsparse_status rocsparse_csr5mv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int nnz,
+                                  const T* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const T* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  const rocsparse_csr5_mat csr5,
+                                  const T* x,
+                                  const T* beta,
+                                  T* y);
+
+template <typename T>
+rocsparse_status rocsparse_diamv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 rocsparse_int m,
+                                 rocsparse_int n,
+                                 const T* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const T* dia_val,
+                                 const rocsparse_int* dia_offset,
+                                 rocsparse_int ndiag,
+                                 const T* x,
+                                 const T* beta,
+                                 T* y);
+
 template <typename T>
 rocsparse_status rocsparse_csrmm(rocsparse_handle handle,
                                  rocsparse_operation trans_A,
@@ -209,6 +336,61 @@ rocsparse_status rocsparse_csrmm(rocsparse_handle handle,
                                  T* C,
                                  rocsparse_int ldc);
 
+template <typename T>
+rocsparse_status rocsparse_csrsm_buffer_size(rocsparse_handle handle,
+                                             rocsparse_operation trans_A,
+                                             rocsparse_operation trans_B,
+                                             rocsparse_int m,
+                                             rocsparse_int nrhs,
+                                             rocsparse_int nnz,
+                                             const T* alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const T* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             const T* B,
+                                             rocsparse_int ldb,
+                                             rocsparse_mat_info info,
+                                             rocsparse_solve_policy policy,
+                                             size_t* buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle handle,
+                                          rocsparse_operation trans_A,
+                                          rocsparse_operation trans_B,
+                                          rocsparse_int m,
+                                          rocsparse_int nrhs,
+                                          rocsparse_int nnz,
+                                          const T* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const T* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          const T* B,
+                                          rocsparse_int ldb,
+                                          rocsparse_mat_info info,
+                                          rocsparse_analysis_policy analysis,
+                                          rocsparse_solve_policy solve,
+                                          void* temp_buffer);
+
+template <typename T>
+rocsparse_status rocsparse_csrsm_solve(rocsparse_handle handle,
+                                       rocsparse_operation trans_A,
+                                       rocsparse_operation trans_B,
+                                       rocsparse_int m,
+                                       rocsparse_int nrhs,
+                                       rocsparse_int nnz,
+                                       const T* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const T* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       T* B,
+                                       rocsparse_int ldb,
+                                       rocsparse_mat_info info,
+                                       rocsparse_solve_policy policy,
+                                       void* temp_buffer);
+
 template <typename T>
 rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle handle,
                                                rocsparse_int m,
@@ -245,6 +427,115 @@ rocsparse_status rocsparse_csrilu0(rocsparse_handle handle,
                                    rocsparse_solve_policy policy,
                                    void* temp_buffer);
 
+template <typename T, typename U>
+rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle handle,
+                                                 rocsparse_mat_info info,
+                                                 int enable_boost,
+                                                 const U* boost_tol,
+                                                 const T* boost_val);
+
+template <typename T>
+rocsparse_status rocsparse_csriluk_numeric(rocsparse_handle handle,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const T* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           T* csr_val_M,
+                                           const rocsparse_int* csr_row_ptr_M,
+                                           const rocsparse_int* csr_col_ind_M,
+                                           rocsparse_solve_policy policy,
+                                           void* temp_buffer);
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_nnz(rocsparse_handle handle,
+                                       rocsparse_int m,
+                                       rocsparse_int nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const T* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       T tau,
+                                       rocsparse_int p,
+                                       rocsparse_mat_info info,
+                                       rocsparse_int* csr_row_ptr_M,
+                                       rocsparse_int* nnz_M);
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_numeric(rocsparse_handle handle,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const T* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           T* csr_val_M,
+                                           rocsparse_int* csr_row_ptr_M,
+                                           rocsparse_int* csr_col_ind_M,
+                                           rocsparse_solve_policy policy,
+                                           void* temp_buffer);
+
+template <typename T>
+rocsparse_status rocsparse_csritilu0_buffer_size(rocsparse_handle handle,
+                                                 rocsparse_int m,
+                                                 rocsparse_int nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T* csr_val,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 const rocsparse_int* csr_col_ind,
+                                                 size_t* buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_csritilu0(rocsparse_handle handle,
+                                     rocsparse_int m,
+                                     rocsparse_int nnz,
+                                     const rocsparse_mat_descr descr,
+                                     T* csr_val,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_int nsweeps,
+                                     T* residual,
+                                     void* temp_buffer);
+
+template <typename T>
+rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle handle,
+                                              rocsparse_int m,
+                                              rocsparse_int nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const T* csr_val,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              rocsparse_mat_info info,
+                                              size_t* buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_csric0_analysis(rocsparse_handle handle,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const T* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy solve,
+                                           void* temp_buffer);
+
+template <typename T>
+rocsparse_status rocsparse_csric0(rocsparse_handle handle,
+                                  rocsparse_int m,
+                                  rocsparse_int nnz,
+                                  const rocsparse_mat_descr descr,
+                                  T* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  rocsparse_mat_info info,
+                                  rocsparse_solve_policy policy,
+                                  void* temp_buffer);
+
 template <typename T>
 rocsparse_status rocsparse_csr2csc(rocsparse_handle handle,
                                    rocsparse_int m,
@@ -297,6 +588,85 @@ rocsparse_status rocsparse_ell2csr(rocsparse_handle handle,
                                    const rocsparse_int* csr_row_ptr,
                                    rocsparse_int* csr_col_ind);
 
+template <typename T>
+rocsparse_status rocsparse_csr2bsr(rocsparse_handle handle,
+                                   rocsparse_direction dir,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const T* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_int block_dim,
+                                   const rocsparse_mat_descr bsr_descr,
+                                   T* bsr_val,
+                                   const rocsparse_int* bsr_row_ptr,
+                                   rocsparse_int* bsr_col_ind);
+
+template <typename T>
+rocsparse_status rocsparse_bsr2csr(rocsparse_handle handle,
+                                   rocsparse_direction dir,
+                                   rocsparse_int mb,
+                                   rocsparse_int nb,
+                                   const rocsparse_mat_descr bsr_descr,
+                                   const T* bsr_val,
+                                   const rocsparse_int* bsr_row_ptr,
+                                   const rocsparse_int* bsr_col_ind,
+                                   rocsparse_int block_dim,
+                                   const rocsparse_mat_descr csr_descr,
+                                   T* csr_val,
+                                   rocsparse_int* csr_row_ptr,
+                                   rocsparse_int* csr_col_ind);
+
+template <typename T>
+rocsparse_status rocsparse_csr2sellc(rocsparse_handle handle,
+                                     rocsparse_int m,
+                                     rocsparse_int n,
+                                     const rocsparse_mat_descr descr,
+                                     const T* csr_val,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_sellc_mat sellc,
+                                     rocsparse_int sigma);
+
+template <typename T>
+rocsparse_status rocsparse_csr2dia(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const T* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   const rocsparse_mat_descr dia_descr,
+                                   rocsparse_int ndiag,
+                                   T* dia_val,
+                                   rocsparse_int* dia_offset);
+
+template <typename T>
+rocsparse_status rocsparse_dia2csr_nnz(rocsparse_handle handle,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       const rocsparse_mat_descr dia_descr,
+                                       rocsparse_int ndiag,
+                                       const T* dia_val,
+                                       const rocsparse_int* dia_offset,
+                                       const rocsparse_mat_descr csr_descr,
+                                       rocsparse_int* csr_row_ptr,
+                                       rocsparse_int* csr_nnz);
+
+template <typename T>
+rocsparse_status rocsparse_dia2csr(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr dia_descr,
+                                   rocsparse_int ndiag,
+                                   const T* dia_val,
+                                   const rocsparse_int* dia_offset,
+                                   const rocsparse_mat_descr csr_descr,
+                                   T* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   rocsparse_int* csr_col_ind);
+
 } // namespace rocsparse
 
 #endif // _ROCSPARSE_HPP_
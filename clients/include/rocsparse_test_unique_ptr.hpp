@@ -105,6 +105,38 @@ struct hyb_struct
     }
 };
 
+struct sellc_struct
+{
+    rocsparse_sellc_mat sellc;
+    sellc_struct()
+    {
+        rocsparse_status status = rocsparse_create_sellc_mat(&sellc);
+        verify_rocsparse_status_success(status, "ERROR: sellc_struct constructor");
+    }
+
+    ~sellc_struct()
+    {
+        rocsparse_status status = rocsparse_destroy_sellc_mat(sellc);
+        verify_rocsparse_status_success(status, "ERROR: sellc_struct destructor");
+    }
+};
+
+struct csr5_struct
+{
+    rocsparse_csr5_mat csr5;
+    csr5_struct()
+    {
+        rocsparse_status status = rocsparse_create_csr5_mat(&csr5);
+        verify_rocsparse_status_success(status, "ERROR: csr5_struct constructor");
+    }
+
+    ~csr5_struct()
+    {
+        rocsparse_status status = rocsparse_destroy_csr5_mat(csr5);
+        verify_rocsparse_status_success(status, "ERROR: csr5_struct destructor");
+    }
+};
+
 struct mat_info_struct
 {
     rocsparse_mat_info info;
@@ -0,0 +1,601 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_BSR2CSR_HPP
+#define TESTING_BSR2CSR_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <rocsparse.h>
+#include <algorithm>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_bsr2csr_bad_arg(void)
+{
+    rocsparse_int mb        = 100;
+    rocsparse_int nb        = 100;
+    rocsparse_int block_dim = 2;
+    rocsparse_int safe_size = 100;
+    rocsparse_direction dir = rocsparse_direction_row;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_csr_descr(new descr_struct);
+    rocsparse_mat_descr csr_descr = unique_ptr_csr_descr->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_bsr_descr(new descr_struct);
+    rocsparse_mat_descr bsr_descr = unique_ptr_bsr_descr->descr;
+
+    auto dbsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dbsr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dbsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dcsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcsr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* dbsr_row_ptr = (rocsparse_int*)dbsr_row_ptr_managed.get();
+    rocsparse_int* dbsr_col_ind = (rocsparse_int*)dbsr_col_ind_managed.get();
+    T* dbsr_val                 = (T*)dbsr_val_managed.get();
+    rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+    rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+    T* dcsr_val                 = (T*)dcsr_val_managed.get();
+
+    if(!dbsr_row_ptr || !dbsr_col_ind || !dbsr_val || !dcsr_row_ptr || !dcsr_col_ind || !dcsr_val)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing for(nullptr == dbsr_val)
+    {
+        T* dbsr_val_null = nullptr;
+
+        status = rocsparse_bsr2csr(handle,
+                                   dir,
+                                   mb,
+                                   nb,
+                                   bsr_descr,
+                                   dbsr_val_null,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind,
+                                   block_dim,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: bsr_val is nullptr");
+    }
+    // testing for(nullptr == dbsr_row_ptr)
+    {
+        rocsparse_int* dbsr_row_ptr_null = nullptr;
+
+        status = rocsparse_bsr2csr(handle,
+                                   dir,
+                                   mb,
+                                   nb,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr_null,
+                                   dbsr_col_ind,
+                                   block_dim,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: bsr_row_ptr is nullptr");
+    }
+    // testing for(nullptr == dbsr_col_ind)
+    {
+        rocsparse_int* dbsr_col_ind_null = nullptr;
+
+        status = rocsparse_bsr2csr(handle,
+                                   dir,
+                                   mb,
+                                   nb,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind_null,
+                                   block_dim,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: bsr_col_ind is nullptr");
+    }
+    // testing for(nullptr == dcsr_val)
+    {
+        T* dcsr_val_null = nullptr;
+
+        status = rocsparse_bsr2csr(handle,
+                                   dir,
+                                   mb,
+                                   nb,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind,
+                                   block_dim,
+                                   csr_descr,
+                                   dcsr_val_null,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_val is nullptr");
+    }
+    // testing for(nullptr == dcsr_row_ptr)
+    {
+        rocsparse_int* dcsr_row_ptr_null = nullptr;
+
+        status = rocsparse_bsr2csr(handle,
+                                   dir,
+                                   mb,
+                                   nb,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind,
+                                   block_dim,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr_null,
+                                   dcsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+    // testing for(nullptr == dcsr_col_ind)
+    {
+        rocsparse_int* dcsr_col_ind_null = nullptr;
+
+        status = rocsparse_bsr2csr(handle,
+                                   dir,
+                                   mb,
+                                   nb,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind,
+                                   block_dim,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
+    }
+    // testing for(nullptr == bsr_descr)
+    {
+        rocsparse_mat_descr bsr_descr_null = nullptr;
+
+        status = rocsparse_bsr2csr(handle,
+                                   dir,
+                                   mb,
+                                   nb,
+                                   bsr_descr_null,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind,
+                                   block_dim,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: bsr_descr is nullptr");
+    }
+    // testing for(nullptr == csr_descr)
+    {
+        rocsparse_mat_descr csr_descr_null = nullptr;
+
+        status = rocsparse_bsr2csr(handle,
+                                   dir,
+                                   mb,
+                                   nb,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind,
+                                   block_dim,
+                                   csr_descr_null,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_bsr2csr(handle_null,
+                                   dir,
+                                   mb,
+                                   nb,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind,
+                                   block_dim,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for(block_dim == 0)
+    {
+        status = rocsparse_bsr2csr(handle,
+                                   dir,
+                                   mb,
+                                   nb,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind,
+                                   0,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind);
+        verify_rocsparse_status_invalid_size(status, "Error: block_dim is 0");
+    }
+}
+
+template <typename T>
+rocsparse_status testing_bsr2csr(Arguments argus)
+{
+    rocsparse_int safe_size       = 100;
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    rocsparse_int block_dim       = argus.block_dim;
+    rocsparse_direction dir       = argus.direction;
+    rocsparse_index_base idx_base = argus.idx_base;
+    std::string binfile           = "";
+    std::string filename          = "";
+    rocsparse_status status;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && n == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m = n = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_csr_descr(new descr_struct);
+    rocsparse_mat_descr csr_descr = unique_ptr_csr_descr->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_bsr_descr(new descr_struct);
+    rocsparse_mat_descr bsr_descr = unique_ptr_bsr_descr->descr;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(csr_descr, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(bsr_descr, idx_base));
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0 || block_dim <= 0)
+    {
+        auto dbsr_row_ptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dbsr_col_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dbsr_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dcsr_row_ptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcsr_col_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcsr_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dbsr_row_ptr = (rocsparse_int*)dbsr_row_ptr_managed.get();
+        rocsparse_int* dbsr_col_ind = (rocsparse_int*)dbsr_col_ind_managed.get();
+        T* dbsr_val                 = (T*)dbsr_val_managed.get();
+        rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+        rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+        T* dcsr_val                 = (T*)dcsr_val_managed.get();
+
+        if(!dbsr_row_ptr || !dbsr_col_ind || !dbsr_val
+           || !dcsr_row_ptr || !dcsr_col_ind || !dcsr_val)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dbsr_row_ptr || !dbsr_col_ind || !dbsr_val || "
+                                            "!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val");
+            return rocsparse_status_memory_error;
+        }
+
+        status = rocsparse_bsr2csr(handle,
+                                   dir,
+                                   m,
+                                   n,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind,
+                                   block_dim,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind);
+
+        if(m < 0 || n < 0 || block_dim <= 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0 || block_dim <= 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && block_dim > 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        if(read_bin_matrix(
+               binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        nnz   = hcsr_row_ptr[m];
+    }
+    else
+    {
+        if(filename != "")
+        {
+            if(read_mtx_matrix(
+                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base)
+               != 0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Convert CSR to BSR on the host
+    std::vector<rocsparse_int> hbsr_row_ptr;
+    std::vector<rocsparse_int> hbsr_col_ind;
+    std::vector<T> hbsr_val;
+
+    rocsparse_int mb   = (m + block_dim - 1) / block_dim;
+    rocsparse_int nb   = (n + block_dim - 1) / block_dim;
+    rocsparse_int nnzb = csr_to_bsr(dir,
+                                    m,
+                                    n,
+                                    block_dim,
+                                    hcsr_row_ptr,
+                                    hcsr_col_ind,
+                                    hcsr_val,
+                                    idx_base,
+                                    hbsr_row_ptr,
+                                    hbsr_col_ind,
+                                    hbsr_val,
+                                    idx_base);
+
+    // Determine CSR gold structures on the host, including explicit zeros of the blocks
+    std::vector<rocsparse_int> hcsr_row_ptr_gold;
+    std::vector<rocsparse_int> hcsr_col_ind_gold;
+    std::vector<T> hcsr_val_gold;
+
+    bsr_to_csr(dir,
+               mb,
+               block_dim,
+               hbsr_row_ptr,
+               hbsr_col_ind,
+               hbsr_val,
+               idx_base,
+               hcsr_row_ptr_gold,
+               hcsr_col_ind_gold,
+               hcsr_val_gold,
+               idx_base);
+
+    rocsparse_int csr_m   = mb * block_dim;
+    rocsparse_int csr_nnz = nnzb * block_dim * block_dim;
+
+    // Allocate memory on the device
+    auto dbsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (mb + 1)), device_free};
+    auto dbsr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnzb), device_free};
+    auto dbsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * csr_nnz), device_free};
+    auto dcsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (csr_m + 1)), device_free};
+    auto dcsr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * csr_nnz), device_free};
+    auto dcsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * csr_nnz), device_free};
+
+    rocsparse_int* dbsr_row_ptr = (rocsparse_int*)dbsr_row_ptr_managed.get();
+    rocsparse_int* dbsr_col_ind = (rocsparse_int*)dbsr_col_ind_managed.get();
+    T* dbsr_val                 = (T*)dbsr_val_managed.get();
+    rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+    rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+    T* dcsr_val                 = (T*)dcsr_val_managed.get();
+
+    if(!dbsr_row_ptr || !dbsr_col_ind || !dbsr_val || !dcsr_row_ptr || !dcsr_col_ind || !dcsr_val)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dbsr_row_ptr || !dbsr_col_ind || !dbsr_val || "
+                                        "!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val");
+        return rocsparse_status_memory_error;
+    }
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(hipMemcpy(dbsr_row_ptr,
+                              hbsr_row_ptr.data(),
+                              sizeof(rocsparse_int) * (mb + 1),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_col_ind, hbsr_col_ind.data(), sizeof(rocsparse_int) * nnzb, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dbsr_val, hbsr_val.data(), sizeof(T) * csr_nnz, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsr2csr(handle,
+                                                dir,
+                                                mb,
+                                                nb,
+                                                bsr_descr,
+                                                dbsr_val,
+                                                dbsr_row_ptr,
+                                                dbsr_col_ind,
+                                                block_dim,
+                                                csr_descr,
+                                                dcsr_val,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind));
+
+        // Verification host structures
+        std::vector<rocsparse_int> hcsr_row_ptr_conv(csr_m + 1);
+        std::vector<rocsparse_int> hcsr_col_ind_conv(csr_nnz);
+        std::vector<T> hcsr_val_conv(csr_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_conv.data(),
+                                  dcsr_row_ptr,
+                                  sizeof(rocsparse_int) * (csr_m + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_conv.data(),
+                                  dcsr_col_ind,
+                                  sizeof(rocsparse_int) * csr_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsr_val_conv.data(), dcsr_val, sizeof(T) * csr_nnz, hipMemcpyDeviceToHost));
+
+        // Unit check
+        unit_check_general(1, csr_m + 1, 1, hcsr_row_ptr_gold.data(), hcsr_row_ptr_conv.data());
+        unit_check_general(1, csr_nnz, 1, hcsr_col_ind_gold.data(), hcsr_col_ind_conv.data());
+        unit_check_general(1, csr_nnz, 1, hcsr_val_gold.data(), hcsr_val_conv.data());
+    }
+
+    if(argus.timing)
+    {
+        rocsparse_int number_cold_calls = 2;
+        rocsparse_int number_hot_calls  = argus.iters;
+
+        for(rocsparse_int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            rocsparse_bsr2csr(handle,
+                              dir,
+                              mb,
+                              nb,
+                              bsr_descr,
+                              dbsr_val,
+                              dbsr_row_ptr,
+                              dbsr_col_ind,
+                              block_dim,
+                              csr_descr,
+                              dcsr_val,
+                              dcsr_row_ptr,
+                              dcsr_col_ind);
+        }
+
+        double gpu_time_used = get_time_us();
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_bsr2csr(handle,
+                              dir,
+                              mb,
+                              nb,
+                              bsr_descr,
+                              dbsr_val,
+                              dbsr_row_ptr,
+                              dbsr_col_ind,
+                              block_dim,
+                              csr_descr,
+                              dcsr_val,
+                              dcsr_row_ptr,
+                              dcsr_col_ind);
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        printf("m\t\tn\t\tnnz\t\tbdim\tdir\tmsec\n");
+        printf("%8d\t%8d\t%9d\t%4d\t%s\t%0.2lf\n",
+               m,
+               n,
+               nnz,
+               block_dim,
+               (dir == rocsparse_direction_row) ? "row" : "col",
+               gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_BSR2CSR_HPP
@@ -0,0 +1,779 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSR2BSR_HPP
+#define TESTING_CSR2BSR_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <rocsparse.h>
+#include <algorithm>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csr2bsr_bad_arg(void)
+{
+    rocsparse_int m         = 100;
+    rocsparse_int n         = 100;
+    rocsparse_int block_dim = 2;
+    rocsparse_int safe_size = 100;
+    rocsparse_int nnzb;
+    rocsparse_direction dir = rocsparse_direction_row;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_csr_descr(new descr_struct);
+    rocsparse_mat_descr csr_descr = unique_ptr_csr_descr->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_bsr_descr(new descr_struct);
+    rocsparse_mat_descr bsr_descr = unique_ptr_bsr_descr->descr;
+
+    auto dcsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcsr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dbsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dbsr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dbsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+    rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+    T* dcsr_val                 = (T*)dcsr_val_managed.get();
+    rocsparse_int* dbsr_row_ptr = (rocsparse_int*)dbsr_row_ptr_managed.get();
+    rocsparse_int* dbsr_col_ind = (rocsparse_int*)dbsr_col_ind_managed.get();
+    T* dbsr_val                 = (T*)dbsr_val_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dbsr_row_ptr || !dbsr_col_ind || !dbsr_val)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Testing rocsparse_csr2bsr_nnz()
+
+    // testing for(nullptr == dcsr_row_ptr)
+    {
+        rocsparse_int* dcsr_row_ptr_null = nullptr;
+
+        status = rocsparse_csr2bsr_nnz(handle,
+                                       m,
+                                       n,
+                                       csr_descr,
+                                       dcsr_row_ptr_null,
+                                       dcsr_col_ind,
+                                       block_dim,
+                                       bsr_descr,
+                                       dbsr_row_ptr,
+                                       &nnzb);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+    // testing for(nullptr == dcsr_col_ind)
+    {
+        rocsparse_int* dcsr_col_ind_null = nullptr;
+
+        status = rocsparse_csr2bsr_nnz(handle,
+                                       m,
+                                       n,
+                                       csr_descr,
+                                       dcsr_row_ptr,
+                                       dcsr_col_ind_null,
+                                       block_dim,
+                                       bsr_descr,
+                                       dbsr_row_ptr,
+                                       &nnzb);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
+    }
+    // testing for(nullptr == dbsr_row_ptr)
+    {
+        rocsparse_int* dbsr_row_ptr_null = nullptr;
+
+        status = rocsparse_csr2bsr_nnz(handle,
+                                       m,
+                                       n,
+                                       csr_descr,
+                                       dcsr_row_ptr,
+                                       dcsr_col_ind,
+                                       block_dim,
+                                       bsr_descr,
+                                       dbsr_row_ptr_null,
+                                       &nnzb);
+        verify_rocsparse_status_invalid_pointer(status, "Error: bsr_row_ptr is nullptr");
+    }
+    // testing for(nullptr == nnzb)
+    {
+        rocsparse_int* nnzb_null = nullptr;
+
+        status = rocsparse_csr2bsr_nnz(handle,
+                                       m,
+                                       n,
+                                       csr_descr,
+                                       dcsr_row_ptr,
+                                       dcsr_col_ind,
+                                       block_dim,
+                                       bsr_descr,
+                                       dbsr_row_ptr,
+                                       nnzb_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: bsr_nnz is nullptr");
+    }
+    // testing for(nullptr == csr_descr)
+    {
+        rocsparse_mat_descr csr_descr_null = nullptr;
+
+        status = rocsparse_csr2bsr_nnz(handle,
+                                       m,
+                                       n,
+                                       csr_descr_null,
+                                       dcsr_row_ptr,
+                                       dcsr_col_ind,
+                                       block_dim,
+                                       bsr_descr,
+                                       dbsr_row_ptr,
+                                       &nnzb);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_descr is nullptr");
+    }
+    // testing for(nullptr == bsr_descr)
+    {
+        rocsparse_mat_descr bsr_descr_null = nullptr;
+
+        status = rocsparse_csr2bsr_nnz(handle,
+                                       m,
+                                       n,
+                                       csr_descr,
+                                       dcsr_row_ptr,
+                                       dcsr_col_ind,
+                                       block_dim,
+                                       bsr_descr_null,
+                                       dbsr_row_ptr,
+                                       &nnzb);
+        verify_rocsparse_status_invalid_pointer(status, "Error: bsr_descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csr2bsr_nnz(handle_null,
+                                       m,
+                                       n,
+                                       csr_descr,
+                                       dcsr_row_ptr,
+                                       dcsr_col_ind,
+                                       block_dim,
+                                       bsr_descr,
+                                       dbsr_row_ptr,
+                                       &nnzb);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for(block_dim == 0)
+    {
+        status = rocsparse_csr2bsr_nnz(
+            handle, m, n, csr_descr, dcsr_row_ptr, dcsr_col_ind, 0, bsr_descr, dbsr_row_ptr, &nnzb);
+        verify_rocsparse_status_invalid_size(status, "Error: block_dim is 0");
+    }
+
+    // Testing rocsparse_csr2bsr()
+
+    // testing for(nullptr == dcsr_val)
+    {
+        T* dcsr_val_null = nullptr;
+
+        status = rocsparse_csr2bsr(handle,
+                                   dir,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   dcsr_val_null,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind,
+                                   block_dim,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_val is nullptr");
+    }
+    // testing for(nullptr == dcsr_row_ptr)
+    {
+        rocsparse_int* dcsr_row_ptr_null = nullptr;
+
+        status = rocsparse_csr2bsr(handle,
+                                   dir,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr_null,
+                                   dcsr_col_ind,
+                                   block_dim,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+    // testing for(nullptr == dcsr_col_ind)
+    {
+        rocsparse_int* dcsr_col_ind_null = nullptr;
+
+        status = rocsparse_csr2bsr(handle,
+                                   dir,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind_null,
+                                   block_dim,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
+    }
+    // testing for(nullptr == dbsr_val)
+    {
+        T* dbsr_val_null = nullptr;
+
+        status = rocsparse_csr2bsr(handle,
+                                   dir,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind,
+                                   block_dim,
+                                   bsr_descr,
+                                   dbsr_val_null,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: bsr_val is nullptr");
+    }
+    // testing for(nullptr == dbsr_row_ptr)
+    {
+        rocsparse_int* dbsr_row_ptr_null = nullptr;
+
+        status = rocsparse_csr2bsr(handle,
+                                   dir,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind,
+                                   block_dim,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr_null,
+                                   dbsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: bsr_row_ptr is nullptr");
+    }
+    // testing for(nullptr == dbsr_col_ind)
+    {
+        rocsparse_int* dbsr_col_ind_null = nullptr;
+
+        status = rocsparse_csr2bsr(handle,
+                                   dir,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind,
+                                   block_dim,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: bsr_col_ind is nullptr");
+    }
+    // testing for(nullptr == csr_descr)
+    {
+        rocsparse_mat_descr csr_descr_null = nullptr;
+
+        status = rocsparse_csr2bsr(handle,
+                                   dir,
+                                   m,
+                                   n,
+                                   csr_descr_null,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind,
+                                   block_dim,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_descr is nullptr");
+    }
+    // testing for(nullptr == bsr_descr)
+    {
+        rocsparse_mat_descr bsr_descr_null = nullptr;
+
+        status = rocsparse_csr2bsr(handle,
+                                   dir,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind,
+                                   block_dim,
+                                   bsr_descr_null,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: bsr_descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csr2bsr(handle_null,
+                                   dir,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind,
+                                   block_dim,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csr2bsr(Arguments argus)
+{
+    rocsparse_int safe_size       = 100;
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    rocsparse_int block_dim       = argus.block_dim;
+    rocsparse_direction dir       = argus.direction;
+    rocsparse_index_base idx_base = argus.idx_base;
+    std::string binfile           = "";
+    std::string filename          = "";
+    rocsparse_status status;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && n == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m = n = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_csr_descr(new descr_struct);
+    rocsparse_mat_descr csr_descr = unique_ptr_csr_descr->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_bsr_descr(new descr_struct);
+    rocsparse_mat_descr bsr_descr = unique_ptr_bsr_descr->descr;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(csr_descr, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(bsr_descr, idx_base));
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0 || block_dim <= 0)
+    {
+        auto dcsr_row_ptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcsr_col_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcsr_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dbsr_row_ptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dbsr_col_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dbsr_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+        rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+        T* dcsr_val                 = (T*)dcsr_val_managed.get();
+        rocsparse_int* dbsr_row_ptr = (rocsparse_int*)dbsr_row_ptr_managed.get();
+        rocsparse_int* dbsr_col_ind = (rocsparse_int*)dbsr_col_ind_managed.get();
+        T* dbsr_val                 = (T*)dbsr_val_managed.get();
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val
+           || !dbsr_row_ptr || !dbsr_col_ind || !dbsr_val)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || "
+                                            "!dbsr_row_ptr || !dbsr_col_ind || !dbsr_val");
+            return rocsparse_status_memory_error;
+        }
+
+        rocsparse_int nnzb;
+        status = rocsparse_csr2bsr_nnz(handle,
+                                       m,
+                                       n,
+                                       csr_descr,
+                                       dcsr_row_ptr,
+                                       dcsr_col_ind,
+                                       block_dim,
+                                       bsr_descr,
+                                       dbsr_row_ptr,
+                                       &nnzb);
+
+        if(m < 0 || n < 0 || block_dim <= 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0 || block_dim <= 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && block_dim > 0");
+        }
+
+        status = rocsparse_csr2bsr(handle,
+                                   dir,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   dcsr_val,
+                                   dcsr_row_ptr,
+                                   dcsr_col_ind,
+                                   block_dim,
+                                   bsr_descr,
+                                   dbsr_val,
+                                   dbsr_row_ptr,
+                                   dbsr_col_ind);
+
+        if(m < 0 || n < 0 || block_dim <= 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0 || block_dim <= 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && block_dim > 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        if(read_bin_matrix(
+               binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        nnz   = hcsr_row_ptr[m];
+    }
+    else
+    {
+        if(filename != "")
+        {
+            if(read_mtx_matrix(
+                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base)
+               != 0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Determine BSR gold structures on the host
+    std::vector<rocsparse_int> hbsr_row_ptr_gold;
+    std::vector<rocsparse_int> hbsr_col_ind_gold;
+    std::vector<T> hbsr_val_gold;
+
+    rocsparse_int mb        = (m + block_dim - 1) / block_dim;
+    rocsparse_int nnzb_gold = csr_to_bsr(dir,
+                                         m,
+                                         n,
+                                         block_dim,
+                                         hcsr_row_ptr,
+                                         hcsr_col_ind,
+                                         hcsr_val,
+                                         idx_base,
+                                         hbsr_row_ptr_gold,
+                                         hbsr_col_ind_gold,
+                                         hbsr_val_gold,
+                                         idx_base);
+
+    // Allocate memory on the device
+    auto dcsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dcsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dbsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (mb + 1)), device_free};
+
+    rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+    rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+    T* dcsr_val                 = (T*)dcsr_val_managed.get();
+    rocsparse_int* dbsr_row_ptr = (rocsparse_int*)dbsr_row_ptr_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dbsr_row_ptr)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dcsr_row_ptr || !dcsr_col_ind || "
+                                        "!dcsr_val || !dbsr_row_ptr");
+        return rocsparse_status_memory_error;
+    }
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                              hcsr_row_ptr.data(),
+                              sizeof(rocsparse_int) * (m + 1),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        // Determine bsr non-zero blocks
+        rocsparse_int nnzb;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz(handle,
+                                                    m,
+                                                    n,
+                                                    csr_descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    block_dim,
+                                                    bsr_descr,
+                                                    dbsr_row_ptr,
+                                                    &nnzb));
+
+        // Check if BSR nnzb does match
+        unit_check_general(1, 1, 1, &nnzb_gold, &nnzb);
+
+        // Allocate BSR column and values arrays
+        auto dbsr_col_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnzb), device_free};
+        auto dbsr_val_managed = rocsparse_unique_ptr{
+            device_malloc(sizeof(T) * nnzb * block_dim * block_dim), device_free};
+
+        rocsparse_int* dbsr_col_ind = (rocsparse_int*)dbsr_col_ind_managed.get();
+        T* dbsr_val                 = (T*)dbsr_val_managed.get();
+
+        if(!dbsr_col_ind || !dbsr_val)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dbsr_col_ind || !dbsr_val");
+            return rocsparse_status_memory_error;
+        }
+
+        // Perform actual BSR conversion
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr(handle,
+                                                dir,
+                                                m,
+                                                n,
+                                                csr_descr,
+                                                dcsr_val,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                block_dim,
+                                                bsr_descr,
+                                                dbsr_val,
+                                                dbsr_row_ptr,
+                                                dbsr_col_ind));
+
+        // Verification host structures
+        std::vector<rocsparse_int> hbsr_row_ptr(mb + 1);
+        std::vector<rocsparse_int> hbsr_col_ind(nnzb);
+        std::vector<T> hbsr_val(nnzb * block_dim * block_dim);
+
+        CHECK_HIP_ERROR(hipMemcpy(hbsr_row_ptr.data(),
+                                  dbsr_row_ptr,
+                                  sizeof(rocsparse_int) * (mb + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hbsr_col_ind.data(),
+                                  dbsr_col_ind,
+                                  sizeof(rocsparse_int) * nnzb,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hbsr_val.data(),
+                                  dbsr_val,
+                                  sizeof(T) * nnzb * block_dim * block_dim,
+                                  hipMemcpyDeviceToHost));
+
+        // Unit check
+        unit_check_general(1, mb + 1, 1, hbsr_row_ptr_gold.data(), hbsr_row_ptr.data());
+        unit_check_general(1, nnzb, 1, hbsr_col_ind_gold.data(), hbsr_col_ind.data());
+        unit_check_general(
+            1, nnzb * block_dim * block_dim, 1, hbsr_val_gold.data(), hbsr_val.data());
+    }
+
+    if(argus.timing)
+    {
+        rocsparse_int number_cold_calls = 2;
+        rocsparse_int number_hot_calls  = argus.iters;
+
+        for(rocsparse_int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            rocsparse_int nnzb;
+            rocsparse_csr2bsr_nnz(handle,
+                                  m,
+                                  n,
+                                  csr_descr,
+                                  dcsr_row_ptr,
+                                  dcsr_col_ind,
+                                  block_dim,
+                                  bsr_descr,
+                                  dbsr_row_ptr,
+                                  &nnzb);
+
+            auto dbsr_col_ind_managed =
+                rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnzb), device_free};
+            auto dbsr_val_managed = rocsparse_unique_ptr{
+                device_malloc(sizeof(T) * nnzb * block_dim * block_dim), device_free};
+
+            rocsparse_int* dbsr_col_ind = (rocsparse_int*)dbsr_col_ind_managed.get();
+            T* dbsr_val                 = (T*)dbsr_val_managed.get();
+
+            rocsparse_csr2bsr(handle,
+                              dir,
+                              m,
+                              n,
+                              csr_descr,
+                              dcsr_val,
+                              dcsr_row_ptr,
+                              dcsr_col_ind,
+                              block_dim,
+                              bsr_descr,
+                              dbsr_val,
+                              dbsr_row_ptr,
+                              dbsr_col_ind);
+        }
+
+        double gpu_time_used = get_time_us();
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_int nnzb;
+            rocsparse_csr2bsr_nnz(handle,
+                                  m,
+                                  n,
+                                  csr_descr,
+                                  dcsr_row_ptr,
+                                  dcsr_col_ind,
+                                  block_dim,
+                                  bsr_descr,
+                                  dbsr_row_ptr,
+                                  &nnzb);
+
+            auto dbsr_col_ind_managed =
+                rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnzb), device_free};
+            auto dbsr_val_managed = rocsparse_unique_ptr{
+                device_malloc(sizeof(T) * nnzb * block_dim * block_dim), device_free};
+
+            rocsparse_int* dbsr_col_ind = (rocsparse_int*)dbsr_col_ind_managed.get();
+            T* dbsr_val                 = (T*)dbsr_val_managed.get();
+
+            rocsparse_csr2bsr(handle,
+                              dir,
+                              m,
+                              n,
+                              csr_descr,
+                              dcsr_val,
+                              dcsr_row_ptr,
+                              dcsr_col_ind,
+                              block_dim,
+                              bsr_descr,
+                              dbsr_val,
+                              dbsr_row_ptr,
+                              dbsr_col_ind);
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        printf("m\t\tn\t\tnnz\t\tbdim\tdir\tmsec\n");
+        printf("%8d\t%8d\t%9d\t%4d\t%s\t%0.2lf\n",
+               m,
+               n,
+               nnz,
+               block_dim,
+               (dir == rocsparse_direction_row) ? "row" : "col",
+               gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSR2BSR_HPP
@@ -0,0 +1,378 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSR2CSR5_HPP
+#define TESTING_CSR2CSR5_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <rocsparse.h>
+#include <algorithm>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+struct test_csr5
+{
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+    rocsparse_int omega;
+    rocsparse_int sigma;
+    rocsparse_int ntiles;
+    rocsparse_int* tile_ptr;
+    uint32_t* tile_desc_flag;
+    uint32_t* tile_desc_offset;
+    rocsparse_int* tile_desc_rows_ptr;
+    rocsparse_int* tile_desc_rows;
+    rocsparse_int nempty;
+    rocsparse_int* empty_rows;
+};
+
+void testing_csr2csr5_bad_arg(void)
+{
+    rocsparse_int m         = 100;
+    rocsparse_int n         = 100;
+    rocsparse_int nnz       = 100;
+    rocsparse_int safe_size = 100;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<csr5_struct> unique_ptr_csr5(new csr5_struct);
+    rocsparse_csr5_mat csr5 = unique_ptr_csr5->csr5;
+
+    auto csr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+
+    rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+
+    if(!csr_row_ptr)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Testing for(csr_row_ptr == nullptr)
+    {
+        rocsparse_int* csr_row_ptr_null = nullptr;
+
+        status = rocsparse_csr2csr5(handle, m, n, nnz, descr, csr_row_ptr_null, csr5);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+    // Testing for(csr5 == nullptr)
+    {
+        rocsparse_csr5_mat csr5_null = nullptr;
+
+        status = rocsparse_csr2csr5(handle, m, n, nnz, descr, csr_row_ptr, csr5_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr5 is nullptr");
+    }
+    // Testing for(descr == nullptr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csr2csr5(handle, m, n, nnz, descr_null, csr_row_ptr, csr5);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // Testing for(handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csr2csr5(handle_null, m, n, nnz, descr, csr_row_ptr, csr5);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+rocsparse_status testing_csr2csr5(Arguments argus)
+{
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    rocsparse_int safe_size       = 100;
+    rocsparse_index_base idx_base = argus.idx_base;
+    std::string binfile           = "";
+    std::string filename          = "";
+    rocsparse_status status;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && n == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m = n = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    std::unique_ptr<csr5_struct> unique_ptr_csr5(new csr5_struct);
+    rocsparse_csr5_mat csr5 = unique_ptr_csr5->csr5;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0)
+    {
+        auto csr_row_ptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+
+        rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+
+        if(!csr_row_ptr)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error, "!csr_row_ptr");
+            return rocsparse_status_memory_error;
+        }
+
+        status = rocsparse_csr2csr5(handle, m, n, nnz, descr, csr_row_ptr, csr5);
+
+        if(m < 0 || n < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && nnz >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<float> hcsr_val;
+
+    // Sample initial COO matrix on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        if(read_bin_matrix(
+               binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base) != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        nnz   = hcsr_row_ptr[m] - idx_base;
+    }
+    else
+    {
+        if(filename != "")
+        {
+            if(read_mtx_matrix(
+                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base) !=
+               0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Allocate memory on the device
+    auto dcsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+
+    rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+
+    if(!dcsr_row_ptr)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dcsr_row_ptr");
+        return rocsparse_status_memory_error;
+    }
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2csr5(handle, m, n, nnz, descr, dcsr_row_ptr, csr5));
+
+        test_csr5* dcsr5 = (test_csr5*)csr5;
+
+        // Tiles are as wide as a wavefront
+        rocsparse_int omega = dcsr5->omega;
+        rocsparse_int sigma = (nnz / m <= 4) ? 4 : ((nnz / m <= 8) ? 8 : 16);
+
+        rocsparse_int ntiles = (nnz - 1) / (omega * sigma) + 1;
+
+        // Host csr2csr5 conversion
+        std::vector<rocsparse_int> htile_ptr_gold;
+        std::vector<uint32_t> htile_desc_flag_gold;
+        std::vector<uint32_t> htile_desc_offset_gold;
+        std::vector<rocsparse_int> htile_desc_rows_ptr_gold;
+        std::vector<rocsparse_int> htile_desc_rows_gold;
+        std::vector<rocsparse_int> hempty_rows_gold;
+
+        csr_to_csr5(m,
+                    nnz,
+                    omega,
+                    sigma,
+                    hcsr_row_ptr,
+                    idx_base,
+                    htile_ptr_gold,
+                    htile_desc_flag_gold,
+                    htile_desc_offset_gold,
+                    htile_desc_rows_ptr_gold,
+                    htile_desc_rows_gold,
+                    hempty_rows_gold);
+
+        rocsparse_int nempty = hempty_rows_gold.size();
+        rocsparse_int nrows  = htile_desc_rows_ptr_gold[ntiles];
+
+        // Check if sizes match
+        unit_check_general(1, 1, 1, &m, &dcsr5->m);
+        unit_check_general(1, 1, 1, &n, &dcsr5->n);
+        unit_check_general(1, 1, 1, &nnz, &dcsr5->nnz);
+        unit_check_general(1, 1, 1, &sigma, &dcsr5->sigma);
+        unit_check_general(1, 1, 1, &ntiles, &dcsr5->ntiles);
+        unit_check_general(1, 1, 1, &nempty, &dcsr5->nempty);
+
+        // Copy output from device to host
+        std::vector<rocsparse_int> htile_ptr(ntiles);
+        std::vector<uint32_t> htile_desc_flag(omega * ntiles);
+        std::vector<uint32_t> htile_desc_offset(omega * ntiles);
+        std::vector<rocsparse_int> htile_desc_rows_ptr(ntiles + 1);
+        std::vector<rocsparse_int> htile_desc_rows(nrows);
+        std::vector<rocsparse_int> hempty_rows(nempty);
+
+        CHECK_HIP_ERROR(hipMemcpy(htile_ptr.data(),
+                                  dcsr5->tile_ptr,
+                                  sizeof(rocsparse_int) * ntiles,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(htile_desc_flag.data(),
+                                  dcsr5->tile_desc_flag,
+                                  sizeof(uint32_t) * omega * ntiles,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(htile_desc_offset.data(),
+                                  dcsr5->tile_desc_offset,
+                                  sizeof(uint32_t) * omega * ntiles,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(htile_desc_rows_ptr.data(),
+                                  dcsr5->tile_desc_rows_ptr,
+                                  sizeof(rocsparse_int) * (ntiles + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(htile_desc_rows.data(),
+                                  dcsr5->tile_desc_rows,
+                                  sizeof(rocsparse_int) * nrows,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hempty_rows.data(),
+                                  dcsr5->empty_rows,
+                                  sizeof(rocsparse_int) * nempty,
+                                  hipMemcpyDeviceToHost));
+
+        // Unit check
+        unit_check_general(1, ntiles, 1, htile_ptr_gold.data(), htile_ptr.data());
+        unit_check_general(
+            1, omega * ntiles, 1, htile_desc_flag_gold.data(), htile_desc_flag.data());
+        unit_check_general(
+            1, omega * ntiles, 1, htile_desc_offset_gold.data(), htile_desc_offset.data());
+        unit_check_general(
+            1, ntiles + 1, 1, htile_desc_rows_ptr_gold.data(), htile_desc_rows_ptr.data());
+        unit_check_general(1, nrows, 1, htile_desc_rows_gold.data(), htile_desc_rows.data());
+        unit_check_general(1, nempty, 1, hempty_rows_gold.data(), hempty_rows.data());
+    }
+
+    if(argus.timing)
+    {
+        rocsparse_int number_cold_calls = 2;
+        rocsparse_int number_hot_calls  = argus.iters;
+
+        for(rocsparse_int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            rocsparse_csr2csr5(handle, m, n, nnz, descr, dcsr_row_ptr, csr5);
+        }
+
+        double gpu_time_used = get_time_us();
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_csr2csr5(handle, m, n, nnz, descr, dcsr_row_ptr, csr5);
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        test_csr5* dcsr5 = (test_csr5*)csr5;
+
+        printf("m\t\tn\t\tnnz\t\tomega\tsigma\tntiles\t\tmsec\n");
+        printf("%8d\t%8d\t%9d\t%5d\t%5d\t%9d\t%0.2lf\n",
+               m,
+               n,
+               nnz,
+               dcsr5->omega,
+               dcsr5->sigma,
+               dcsr5->ntiles,
+               gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSR2CSR5_HPP
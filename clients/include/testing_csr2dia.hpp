@@ -0,0 +1,673 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSR2DIA_HPP
+#define TESTING_CSR2DIA_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <rocsparse.h>
+#include <algorithm>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csr2dia_bad_arg(void)
+{
+    rocsparse_int m         = 100;
+    rocsparse_int n         = 100;
+    rocsparse_int safe_size = 100;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_csr_descr(new descr_struct);
+    rocsparse_mat_descr csr_descr = unique_ptr_csr_descr->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_dia_descr(new descr_struct);
+    rocsparse_mat_descr dia_descr = unique_ptr_dia_descr->descr;
+
+    auto csr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto csr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto csr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+    rocsparse_int* csr_col_ind = (rocsparse_int*)csr_col_ind_managed.get();
+    T* csr_val                 = (T*)csr_val_managed.get();
+
+    if(!csr_row_ptr || !csr_col_ind || !csr_val)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // CSR to DIA conversion is a two step process - test both functions for bad arguments
+
+    // Step 1: Determine number of diagonals of DIA storage format
+    rocsparse_int ndiag;
+
+    // Testing for (csr_row_ptr == nullptr)
+    {
+        rocsparse_int* csr_row_ptr_null = nullptr;
+
+        status = rocsparse_csr2dia_ndiag(
+            handle, m, n, csr_descr, csr_row_ptr_null, csr_col_ind, dia_descr, &ndiag);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+
+    // Testing for (csr_col_ind == nullptr)
+    {
+        rocsparse_int* csr_col_ind_null = nullptr;
+
+        status = rocsparse_csr2dia_ndiag(
+            handle, m, n, csr_descr, csr_row_ptr, csr_col_ind_null, dia_descr, &ndiag);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
+    }
+
+    // Testing for (ndiag == nullptr)
+    {
+        rocsparse_int* ndiag_null = nullptr;
+
+        status = rocsparse_csr2dia_ndiag(
+            handle, m, n, csr_descr, csr_row_ptr, csr_col_ind, dia_descr, ndiag_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: ndiag is nullptr");
+    }
+
+    // Testing for (csr_descr == nullptr)
+    {
+        rocsparse_mat_descr csr_descr_null = nullptr;
+
+        status = rocsparse_csr2dia_ndiag(
+            handle, m, n, csr_descr_null, csr_row_ptr, csr_col_ind, dia_descr, &ndiag);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_descr is nullptr");
+    }
+
+    // Testing for (dia_descr == nullptr)
+    {
+        rocsparse_mat_descr dia_descr_null = nullptr;
+
+        status = rocsparse_csr2dia_ndiag(
+            handle, m, n, csr_descr, csr_row_ptr, csr_col_ind, dia_descr_null, &ndiag);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dia_descr is nullptr");
+    }
+
+    // Testing for (handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csr2dia_ndiag(
+            handle_null, m, n, csr_descr, csr_row_ptr, csr_col_ind, dia_descr, &ndiag);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // Allocate memory for DIA storage format
+    auto dia_offset_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dia_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* dia_offset = (rocsparse_int*)dia_offset_managed.get();
+    T* dia_val                = (T*)dia_val_managed.get();
+
+    if(!dia_offset || !dia_val)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Step 2: Perform the actual conversion
+
+    // Set ndiag to some valid value, to avoid invalid_size status
+    ndiag = 1;
+
+    // Testing for (csr_val == nullptr)
+    {
+        T* csr_val_null = nullptr;
+
+        status = rocsparse_csr2dia(handle,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   csr_val_null,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_val is nullptr");
+    }
+
+    // Testing for (csr_row_ptr == nullptr)
+    {
+        rocsparse_int* csr_row_ptr_null = nullptr;
+
+        status = rocsparse_csr2dia(handle,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr_null,
+                                   csr_col_ind,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+
+    // Testing for (csr_col_ind == nullptr)
+    {
+        rocsparse_int* csr_col_ind_null = nullptr;
+
+        status = rocsparse_csr2dia(handle,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind_null,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
+    }
+
+    // Testing for (dia_val == nullptr)
+    {
+        T* dia_val_null = nullptr;
+
+        status = rocsparse_csr2dia(handle,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val_null,
+                                   dia_offset);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dia_val is nullptr");
+    }
+
+    // Testing for (dia_offset == nullptr)
+    {
+        rocsparse_int* dia_offset_null = nullptr;
+
+        status = rocsparse_csr2dia(handle,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dia_offset is nullptr");
+    }
+
+    // Testing for (csr_descr == nullptr)
+    {
+        rocsparse_mat_descr csr_descr_null = nullptr;
+
+        status = rocsparse_csr2dia(handle,
+                                   m,
+                                   n,
+                                   csr_descr_null,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_descr is nullptr");
+    }
+
+    // Testing for (dia_descr == nullptr)
+    {
+        rocsparse_mat_descr dia_descr_null = nullptr;
+
+        status = rocsparse_csr2dia(handle,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   dia_descr_null,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dia_descr is nullptr");
+    }
+
+    // Testing for (handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csr2dia(handle_null,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csr2dia(Arguments argus)
+{
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    rocsparse_int safe_size       = 100;
+    rocsparse_index_base csr_base = argus.idx_base;
+    rocsparse_index_base dia_base = argus.idx_base2;
+    std::string binfile           = "";
+    std::string filename          = "";
+    rocsparse_status status;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && n == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m = n = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    // A laplacian determines its own size
+    if(argus.laplacian > 0)
+    {
+        m = n = argus.laplacian * argus.laplacian;
+    }
+
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_csr_descr(new descr_struct);
+    rocsparse_mat_descr csr_descr = unique_ptr_csr_descr->descr;
+
+    // Set CSR matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(csr_descr, csr_base));
+
+    std::unique_ptr<descr_struct> unique_ptr_dia_descr(new descr_struct);
+    rocsparse_mat_descr dia_descr = unique_ptr_dia_descr->descr;
+
+    // Set DIA matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(dia_descr, dia_base));
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0)
+    {
+        auto csr_row_ptr_managed =
+            (m > 0)
+                ? rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free}
+                : rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size),
+                                       device_free};
+        auto csr_col_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto csr_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+        rocsparse_int* csr_col_ind = (rocsparse_int*)csr_col_ind_managed.get();
+        T* csr_val                 = (T*)csr_val_managed.get();
+
+        if(!csr_row_ptr || !csr_col_ind || !csr_val)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!csr_row_ptr || !csr_col_ind || !csr_val");
+            return rocsparse_status_memory_error;
+        }
+
+        // To obtain valid input, csr_row_ptr need to be 0 (because either m, n or nnz is 0)
+        hipMemset(csr_row_ptr, 0, sizeof(rocsparse_int) * ((m > 0) ? (m + 1) : safe_size));
+
+        // Step 1
+        rocsparse_int ndiag;
+        status = rocsparse_csr2dia_ndiag(
+            handle, m, n, csr_descr, csr_row_ptr, csr_col_ind, dia_descr, &ndiag);
+
+        if(m < 0 || n < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0");
+        }
+
+        auto dia_offset_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dia_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dia_offset = (rocsparse_int*)dia_offset_managed.get();
+        T* dia_val                = (T*)dia_val_managed.get();
+
+        if(!dia_offset || !dia_val)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dia_offset || !dia_val");
+            return rocsparse_status_memory_error;
+        }
+
+        // Step 2
+        status = rocsparse_csr2dia(handle,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   dia_descr,
+                                   0,
+                                   dia_val,
+                                   dia_offset);
+
+        if(m < 0 || n < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // For testing, assemble a COO matrix and convert it to CSR first (on host)
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Sample initial COO matrix on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        if(read_bin_matrix(
+               binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, csr_base) != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, csr_base);
+        nnz   = hcsr_row_ptr[m] - csr_base;
+    }
+    else
+    {
+        if(filename != "")
+        {
+            if(read_mtx_matrix(
+                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, csr_base) !=
+               0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, csr_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - csr_base];
+        }
+
+        hcsr_row_ptr[0] = csr_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Allocate memory on the device
+    auto dcsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dcsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dndiag_managed = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int)), device_free};
+
+    rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+    rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+    T* dcsr_val                 = (T*)dcsr_val_managed.get();
+    rocsparse_int* dndiag       = (rocsparse_int*)dndiag_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dndiag)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dndiag");
+        return rocsparse_status_memory_error;
+    }
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Host csr2dia conversion
+    std::vector<rocsparse_int> hdia_offset_gold;
+    std::vector<T> hdia_val_gold;
+
+    rocsparse_int ndiag_gold = csr_to_dia(
+        m, n, hcsr_row_ptr, hcsr_col_ind, hcsr_val, csr_base, hdia_offset_gold, hdia_val_gold);
+
+    // Matrices with too many padded entries are rejected
+    bool reject = static_cast<int64_t>(ndiag_gold) * m > static_cast<int64_t>(nnz) * 2;
+
+    if(argus.unit_check)
+    {
+        rocsparse_int ndiag;
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        rocsparse_status status_host = rocsparse_csr2dia_ndiag(
+            handle, m, n, csr_descr, dcsr_row_ptr, dcsr_col_ind, dia_descr, &ndiag);
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        rocsparse_status status_device = rocsparse_csr2dia_ndiag(
+            handle, m, n, csr_descr, dcsr_row_ptr, dcsr_col_ind, dia_descr, dndiag);
+
+        rocsparse_int ndiag_device;
+        CHECK_HIP_ERROR(
+            hipMemcpy(&ndiag_device, dndiag, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Check if number of diagonals does match
+        unit_check_general(1, 1, 1, &ndiag_gold, &ndiag);
+        unit_check_general(1, 1, 1, &ndiag_gold, &ndiag_device);
+
+        if(reject)
+        {
+            verify_rocsparse_status_invalid_value(status_host, "Error: DIA fill exceeds limit");
+            verify_rocsparse_status_invalid_value(status_device, "Error: DIA fill exceeds limit");
+
+            return rocsparse_status_success;
+        }
+
+        verify_rocsparse_status_success(status_host, "DIA fill within limit");
+        verify_rocsparse_status_success(status_device, "DIA fill within limit");
+
+        rocsparse_int dia_nnz = m * ndiag;
+
+        // Allocate DIA device memory
+        auto ddia_offset_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * ndiag), device_free};
+        auto ddia_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * dia_nnz), device_free};
+
+        rocsparse_int* ddia_offset = (rocsparse_int*)ddia_offset_managed.get();
+        T* ddia_val                = (T*)ddia_val_managed.get();
+
+        // Perform actual DIA conversion
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2dia(handle,
+                                                m,
+                                                n,
+                                                csr_descr,
+                                                dcsr_val,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                dia_descr,
+                                                ndiag,
+                                                ddia_val,
+                                                ddia_offset));
+
+        std::vector<rocsparse_int> hdia_offset(ndiag);
+        std::vector<T> hdia_val(dia_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hdia_offset.data(),
+                                  ddia_offset,
+                                  sizeof(rocsparse_int) * ndiag,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hdia_val.data(), ddia_val, sizeof(T) * dia_nnz, hipMemcpyDeviceToHost));
+
+        // Unit check
+        unit_check_general(1, ndiag, 1, hdia_offset_gold.data(), hdia_offset.data());
+        unit_check_general(1, dia_nnz, 1, hdia_val_gold.data(), hdia_val.data());
+    }
+
+    if(argus.timing)
+    {
+        // Matrices that do not qualify for DIA format cannot be benchmarked
+        if(reject)
+        {
+            printf("m\t\tn\t\tnnz\t\tndiag\n");
+            printf("%8d\t%8d\t%9d\t%8d\tDIA fill exceeds limit\n", m, n, nnz, ndiag_gold);
+
+            return rocsparse_status_success;
+        }
+
+        rocsparse_int number_cold_calls = 2;
+        rocsparse_int number_hot_calls  = argus.iters;
+
+        rocsparse_int ndiag;
+
+        for(rocsparse_int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            rocsparse_csr2dia_ndiag(
+                handle, m, n, csr_descr, dcsr_row_ptr, dcsr_col_ind, dia_descr, &ndiag);
+
+            auto ddia_offset_managed =
+                rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * ndiag), device_free};
+            auto ddia_val_managed =
+                rocsparse_unique_ptr{device_malloc(sizeof(T) * m * ndiag), device_free};
+
+            rocsparse_int* ddia_offset = (rocsparse_int*)ddia_offset_managed.get();
+            T* ddia_val                = (T*)ddia_val_managed.get();
+
+            rocsparse_csr2dia(handle,
+                              m,
+                              n,
+                              csr_descr,
+                              dcsr_val,
+                              dcsr_row_ptr,
+                              dcsr_col_ind,
+                              dia_descr,
+                              ndiag,
+                              ddia_val,
+                              ddia_offset);
+        }
+
+        double gpu_time_used = get_time_us();
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_csr2dia_ndiag(
+                handle, m, n, csr_descr, dcsr_row_ptr, dcsr_col_ind, dia_descr, &ndiag);
+
+            auto ddia_offset_managed =
+                rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * ndiag), device_free};
+            auto ddia_val_managed =
+                rocsparse_unique_ptr{device_malloc(sizeof(T) * m * ndiag), device_free};
+
+            rocsparse_int* ddia_offset = (rocsparse_int*)ddia_offset_managed.get();
+            T* ddia_val                = (T*)ddia_val_managed.get();
+
+            rocsparse_csr2dia(handle,
+                              m,
+                              n,
+                              csr_descr,
+                              dcsr_val,
+                              dcsr_row_ptr,
+                              dcsr_col_ind,
+                              dia_descr,
+                              ndiag,
+                              ddia_val,
+                              ddia_offset);
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        printf("m\t\tn\t\tnnz\t\tndiag\t\tmsec\n");
+        printf("%8d\t%8d\t%9d\t%8d\t%0.2lf\n", m, n, nnz, ndiag, gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSR2DIA_HPP
@@ -46,6 +46,7 @@ struct test_hyb
     rocsparse_int m;
     rocsparse_int n;
     rocsparse_hyb_partition partition;
+    rocsparse_int nnz_bound;
     rocsparse_int ell_nnz;
     rocsparse_int ell_width;
     rocsparse_int* ell_col_ind;
@@ -54,6 +55,7 @@ struct test_hyb
     rocsparse_int* coo_row_ind;
     rocsparse_int* coo_col_ind;
     void* coo_val;
+    size_t predicted_bytes;
 };
 
 template <typename T>
@@ -387,13 +389,35 @@ rocsparse_status testing_csr2hyb(Arguments argus)
     rocsparse_int ell_width = 0;
     rocsparse_int ell_nnz   = 0;
     rocsparse_int coo_nnz   = 0;
+    size_t predicted_bytes  = 0;
 
     if(part == rocsparse_hyb_partition_auto || part == rocsparse_hyb_partition_user)
     {
         if(part == rocsparse_hyb_partition_auto)
         {
-            // ELL width is average nnz per row
-            ell_width = (nnz - 1) / m + 1;
+            // ELL width minimizes the bytes moved by hybmv
+            rocsparse_int max_width = (2 * nnz - 1) / m + 1;
+
+            for(rocsparse_int w = 0; w <= max_width; ++w)
+            {
+                size_t bytes = sizeof(T) * (nnz + m) + (sizeof(T) + sizeof(rocsparse_int)) * m * w;
+
+                for(rocsparse_int i = 0; i < m; ++i)
+                {
+                    rocsparse_int row_nnz = hcsr_row_ptr[i + 1] - hcsr_row_ptr[i];
+                    if(row_nnz > w)
+                    {
+                        bytes += (sizeof(T) + 2 * sizeof(rocsparse_int)) * (row_nnz - w);
+                        bytes += 2 * sizeof(T);
+                    }
+                }
+
+                if(w == 0 || bytes < predicted_bytes)
+                {
+                    ell_width       = w;
+                    predicted_bytes = bytes;
+                }
+            }
         }
         else
         {
@@ -483,6 +507,7 @@ rocsparse_status testing_csr2hyb(Arguments argus)
         unit_check_general(1, 1, 1, &ell_width, &dhyb->ell_width);
         unit_check_general(1, 1, 1, &ell_nnz, &dhyb->ell_nnz);
         unit_check_general(1, 1, 1, &coo_nnz, &dhyb->coo_nnz);
+        unit_check_general(1, 1, 1, &predicted_bytes, &dhyb->predicted_bytes);
 
         CHECK_HIP_ERROR(hipMemcpy(hhyb_ell_col_ind.data(),
                                   dhyb->ell_col_ind,
@@ -507,6 +532,68 @@ rocsparse_status testing_csr2hyb(Arguments argus)
         unit_check_general(1, coo_nnz, 1, hhyb_coo_row_ind_gold.data(), hhyb_coo_row_ind.data());
         unit_check_general(1, coo_nnz, 1, hhyb_coo_col_ind_gold.data(), hhyb_coo_col_ind.data());
         unit_check_general(1, coo_nnz, 1, hhyb_coo_val_gold.data(), hhyb_coo_val.data());
+
+        // Async conversion without ELL part, where the bound is below the number of
+        // non-zero entries. The COO part is sized by the bound and keeps the leading
+        // entries, all others are discarded.
+        rocsparse_int csr_nnz   = hcsr_row_ptr[m] - idx_base;
+        rocsparse_int nnz_bound = csr_nnz / 2;
+
+        if(nnz_bound > 0)
+        {
+            std::unique_ptr<hyb_struct> unique_ptr_hyb_bound(new hyb_struct);
+            rocsparse_hyb_mat hyb_bound = unique_ptr_hyb_bound->hyb;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_hyb_mat_nnz_bound(hyb_bound, nnz_bound));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_exec_mode(handle, rocsparse_exec_mode_async));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb(handle,
+                                                    m,
+                                                    n,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    hyb_bound,
+                                                    0,
+                                                    rocsparse_hyb_partition_user));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_exec_mode(handle, rocsparse_exec_mode_sync));
+
+            test_hyb* dhyb_bound = (test_hyb*)hyb_bound;
+
+            unit_check_general(1, 1, 1, &nnz_bound, &dhyb_bound->coo_nnz);
+
+            std::vector<rocsparse_int> hbound_row_ind_gold(nnz_bound);
+            std::vector<rocsparse_int> hbound_row_ind(nnz_bound);
+            std::vector<rocsparse_int> hbound_col_ind(nnz_bound);
+            std::vector<T> hbound_val(nnz_bound);
+
+            for(rocsparse_int i = 0; i < m; ++i)
+            {
+                for(rocsparse_int j = hcsr_row_ptr[i] - idx_base;
+                    j < hcsr_row_ptr[i + 1] - idx_base && j < nnz_bound;
+                    ++j)
+                {
+                    hbound_row_ind_gold[j] = i + idx_base;
+                }
+            }
+
+            CHECK_HIP_ERROR(hipMemcpy(hbound_row_ind.data(),
+                                      dhyb_bound->coo_row_ind,
+                                      sizeof(rocsparse_int) * nnz_bound,
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hbound_col_ind.data(),
+                                      dhyb_bound->coo_col_ind,
+                                      sizeof(rocsparse_int) * nnz_bound,
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hbound_val.data(),
+                                      dhyb_bound->coo_val,
+                                      sizeof(T) * nnz_bound,
+                                      hipMemcpyDeviceToHost));
+
+            unit_check_general(1, nnz_bound, 1, hbound_row_ind_gold.data(), hbound_row_ind.data());
+            unit_check_general(1, nnz_bound, 1, hcsr_col_ind.data(), hbound_col_ind.data());
+            unit_check_general(1, nnz_bound, 1, hcsr_val.data(), hbound_val.data());
+        }
     }
 
     if(argus.timing)
@@ -546,8 +633,16 @@ rocsparse_status testing_csr2hyb(Arguments argus)
 
         gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
 
-        printf("m\t\tn\t\tnnz\t\tmsec\n");
-        printf("%8d\t%8d\t%9d\t%0.2lf\n", m, n, nnz, gpu_time_used);
+        test_hyb* dhyb = (test_hyb*)hyb;
+
+        printf("m\t\tn\t\tnnz\t\tell_width\tcoo_nnz\t\tmsec\n");
+        printf("%8d\t%8d\t%9d\t%8d\t%9d\t%0.2lf\n",
+               m,
+               n,
+               nnz,
+               dhyb->ell_width,
+               dhyb->coo_nnz,
+               gpu_time_used);
     }
 
     return rocsparse_status_success;
@@ -0,0 +1,418 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSR2SELLC_HPP
+#define TESTING_CSR2SELLC_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <rocsparse.h>
+#include <algorithm>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+struct test_sellc
+{
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+    rocsparse_int slice_size;
+    rocsparse_int sigma;
+    rocsparse_int nslices;
+    rocsparse_int sell_nnz;
+    double padding;
+    rocsparse_int* slice_ptr;
+    rocsparse_int* perm;
+    rocsparse_int* col_ind;
+    void* val;
+};
+
+template <typename T>
+void testing_csr2sellc_bad_arg(void)
+{
+    rocsparse_int m         = 100;
+    rocsparse_int n         = 100;
+    rocsparse_int sigma     = 32;
+    rocsparse_int safe_size = 100;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<sellc_struct> unique_ptr_sellc(new sellc_struct);
+    rocsparse_sellc_mat sellc = unique_ptr_sellc->sellc;
+
+    auto csr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto csr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto csr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+    rocsparse_int* csr_col_ind = (rocsparse_int*)csr_col_ind_managed.get();
+    T* csr_val                 = (T*)csr_val_managed.get();
+
+    if(!csr_row_ptr || !csr_col_ind || !csr_val)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Testing for(csr_row_ptr == nullptr)
+    {
+        rocsparse_int* csr_row_ptr_null = nullptr;
+
+        status = rocsparse_csr2sellc(
+            handle, m, n, descr, csr_val, csr_row_ptr_null, csr_col_ind, sellc, sigma);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+    // Testing for(csr_col_ind == nullptr)
+    {
+        rocsparse_int* csr_col_ind_null = nullptr;
+
+        status = rocsparse_csr2sellc(
+            handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind_null, sellc, sigma);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
+    }
+    // Testing for(csr_val == nullptr)
+    {
+        T* csr_val_null = nullptr;
+
+        status = rocsparse_csr2sellc(
+            handle, m, n, descr, csr_val_null, csr_row_ptr, csr_col_ind, sellc, sigma);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_val is nullptr");
+    }
+    // Testing for(sellc == nullptr)
+    {
+        rocsparse_sellc_mat sellc_null = nullptr;
+
+        status = rocsparse_csr2sellc(
+            handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, sellc_null, sigma);
+        verify_rocsparse_status_invalid_pointer(status, "Error: sellc is nullptr");
+    }
+    // Testing for(descr == nullptr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csr2sellc(
+            handle, m, n, descr_null, csr_val, csr_row_ptr, csr_col_ind, sellc, sigma);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // Testing for(sigma <= 0)
+    {
+        status =
+            rocsparse_csr2sellc(handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, sellc, 0);
+        verify_rocsparse_status_invalid_size(status, "Error: sigma <= 0");
+    }
+    // Testing for(handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csr2sellc(
+            handle_null, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, sellc, sigma);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csr2sellc(Arguments argus)
+{
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    rocsparse_int sigma           = argus.sigma;
+    rocsparse_int safe_size       = 100;
+    rocsparse_index_base idx_base = argus.idx_base;
+    std::string binfile           = "";
+    std::string filename          = "";
+    rocsparse_status status;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && n == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m = n = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    std::unique_ptr<sellc_struct> unique_ptr_sellc(new sellc_struct);
+    rocsparse_sellc_mat sellc = unique_ptr_sellc->sellc;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0)
+    {
+        auto csr_row_ptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto csr_col_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto csr_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+        rocsparse_int* csr_col_ind = (rocsparse_int*)csr_col_ind_managed.get();
+        T* csr_val                 = (T*)csr_val_managed.get();
+
+        if(!csr_row_ptr || !csr_col_ind || !csr_val)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!csr_row_ptr || !csr_col_ind || !csr_val");
+            return rocsparse_status_memory_error;
+        }
+
+        status = rocsparse_csr2sellc(
+            handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, sellc, sigma);
+
+        if(m < 0 || n < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // For testing, assemble a COO matrix and convert it to CSR first (on host)
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Sample initial COO matrix on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        if(read_bin_matrix(
+               binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base) != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        nnz   = hcsr_row_ptr[m];
+    }
+    else
+    {
+        if(filename != "")
+        {
+            if(read_mtx_matrix(
+                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base) !=
+               0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Allocate memory on the device
+    auto dcsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dcsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+    rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+    T* dcsr_val                 = (T*)dcsr_val_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val");
+        return rocsparse_status_memory_error;
+    }
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2sellc(
+            handle, m, n, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, sellc, sigma));
+
+        test_sellc* dsellc = (test_sellc*)sellc;
+
+        // Slices are as high as a wavefront
+        rocsparse_int slice_size = dsellc->slice_size;
+        rocsparse_int nslices    = (m + slice_size - 1) / slice_size;
+
+        // Host csr2sellc conversion
+        std::vector<rocsparse_int> hslice_ptr_gold;
+        std::vector<rocsparse_int> hperm_gold;
+        std::vector<rocsparse_int> hsell_col_ind_gold;
+        std::vector<T> hsell_val_gold;
+
+        rocsparse_int sell_nnz = csr_to_sellc(m,
+                                              slice_size,
+                                              sigma,
+                                              hcsr_row_ptr,
+                                              hcsr_col_ind,
+                                              hcsr_val,
+                                              idx_base,
+                                              hslice_ptr_gold,
+                                              hperm_gold,
+                                              hsell_col_ind_gold,
+                                              hsell_val_gold);
+
+        // Check if sizes match
+        unit_check_general(1, 1, 1, &m, &dsellc->m);
+        unit_check_general(1, 1, 1, &n, &dsellc->n);
+        unit_check_general(1, 1, 1, &nnz, &dsellc->nnz);
+        unit_check_general(1, 1, 1, &sigma, &dsellc->sigma);
+        unit_check_general(1, 1, 1, &nslices, &dsellc->nslices);
+        unit_check_general(1, 1, 1, &sell_nnz, &dsellc->sell_nnz);
+
+        // Check padding query
+        rocsparse_int query_nnz;
+        double query_padding;
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_sellc_mat_padding(sellc, &query_nnz, &query_padding));
+
+        double padding = static_cast<double>(sell_nnz - nnz) / nnz;
+
+        unit_check_general(1, 1, 1, &sell_nnz, &query_nnz);
+        unit_check_near(1, 1, 1, &padding, &query_padding);
+
+        // Copy output from device to host
+        std::vector<rocsparse_int> hslice_ptr(nslices + 1);
+        std::vector<rocsparse_int> hperm(m);
+        std::vector<rocsparse_int> hsell_col_ind(sell_nnz);
+        std::vector<T> hsell_val(sell_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hslice_ptr.data(),
+                                  dsellc->slice_ptr,
+                                  sizeof(rocsparse_int) * (nslices + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hperm.data(), dsellc->perm, sizeof(rocsparse_int) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hsell_col_ind.data(),
+                                  dsellc->col_ind,
+                                  sizeof(rocsparse_int) * sell_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hsell_val.data(), dsellc->val, sizeof(T) * sell_nnz, hipMemcpyDeviceToHost));
+
+        // Unit check
+        unit_check_general(1, nslices + 1, 1, hslice_ptr_gold.data(), hslice_ptr.data());
+        unit_check_general(1, m, 1, hperm_gold.data(), hperm.data());
+        unit_check_general(1, sell_nnz, 1, hsell_col_ind_gold.data(), hsell_col_ind.data());
+        unit_check_general(1, sell_nnz, 1, hsell_val_gold.data(), hsell_val.data());
+    }
+
+    if(argus.timing)
+    {
+        rocsparse_int number_cold_calls = 2;
+        rocsparse_int number_hot_calls  = argus.iters;
+
+        for(rocsparse_int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            rocsparse_csr2sellc(
+                handle, m, n, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, sellc, sigma);
+        }
+
+        double gpu_time_used = get_time_us();
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_csr2sellc(
+                handle, m, n, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, sellc, sigma);
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        rocsparse_int sell_nnz;
+        double padding;
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_sellc_mat_padding(sellc, &sell_nnz, &padding));
+
+        printf("m\t\tn\t\tnnz\t\tsigma\tsell_nnz\tpadding\tmsec\n");
+        printf("%8d\t%8d\t%9d\t%5d\t%9d\t%0.2lf\t%0.2lf\n",
+               m,
+               n,
+               nnz,
+               sigma,
+               sell_nnz,
+               padding,
+               gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSR2SELLC_HPP
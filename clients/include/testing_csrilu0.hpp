@@ -278,6 +278,71 @@ void testing_csrilu0_bad_arg(void)
         verify_rocsparse_status_invalid_handle(status);
     }
 
+    // testing rocsparse_csrilu0_numeric_boost
+    real_t<T> boost_tol = static_cast<real_t<T>>(0);
+    T boost_val         = static_cast<T>(1);
+
+    // testing for(nullptr == boost_tol)
+    {
+        real_t<T>* boost_tol_null = nullptr;
+
+        status = rocsparse_csrilu0_numeric_boost(handle, info, 1, boost_tol_null, &boost_val);
+        verify_rocsparse_status_invalid_pointer(status, "Error: boost_tol is nullptr");
+    }
+    // testing for(nullptr == boost_val)
+    {
+        T* boost_val_null = nullptr;
+
+        status = rocsparse_csrilu0_numeric_boost(handle, info, 1, &boost_tol, boost_val_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: boost_val is nullptr");
+    }
+    // testing for(boost_tol < 0)
+    {
+        real_t<T> boost_tol_neg = static_cast<real_t<T>>(-1);
+
+        status = rocsparse_csrilu0_numeric_boost(handle, info, 1, &boost_tol_neg, &boost_val);
+        verify_rocsparse_status_invalid_value(status, "Error: boost_tol is negative");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrilu0_numeric_boost(handle, info_null, 1, &boost_tol, &boost_val);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrilu0_numeric_boost(handle_null, info, 1, &boost_tol, &boost_val);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csrilu0_boost_count
+    rocsparse_int count;
+
+    // testing for(nullptr == count)
+    {
+        rocsparse_int* count_null = nullptr;
+
+        status = rocsparse_csrilu0_boost_count(handle, info, count_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: count is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrilu0_boost_count(handle, info_null, &count);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrilu0_boost_count(handle_null, info, &count);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
     // testing rocsparse_csrilu0_clear
 
     // testing for(nullptr == info)
@@ -487,16 +552,19 @@ rocsparse_status testing_csrilu0(Arguments argus)
     auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
     auto d_position_managed =
         rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int)), device_free};
+    auto d_boost_count_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int)), device_free};
 
-    rocsparse_int* dptr       = (rocsparse_int*)dptr_managed.get();
-    rocsparse_int* dcol       = (rocsparse_int*)dcol_managed.get();
-    T* dval                   = (T*)dval_managed.get();
-    rocsparse_int* d_position = (rocsparse_int*)d_position_managed.get();
+    rocsparse_int* dptr          = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol          = (rocsparse_int*)dcol_managed.get();
+    T* dval                      = (T*)dval_managed.get();
+    rocsparse_int* d_position    = (rocsparse_int*)d_position_managed.get();
+    rocsparse_int* d_boost_count = (rocsparse_int*)d_boost_count_managed.get();
 
-    if(!dval || !dptr || !dcol || !d_position)
+    if(!dval || !dptr || !dcol || !d_position || !d_boost_count)
     {
         verify_rocsparse_status_success(rocsparse_status_memory_error,
-                                        "!dval || !dptr || !dcol || !d_position");
+                                        "!dval || !dptr || !dcol || !d_position || !d_boost_count");
         return rocsparse_status_memory_error;
     }
 
@@ -535,6 +603,14 @@ rocsparse_status testing_csrilu0(Arguments argus)
                                                      rocsparse_solve_policy_auto,
                                                      dbuffer));
 
+    // Numeric boost of tiny pivots
+    real_t<T> boost_tol = static_cast<real_t<T>>(argus.boost_tol);
+    T boost_val         = static_cast<T>(argus.boost_val);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrilu0_numeric_boost(handle, info, argus.boost, &boost_tol, &boost_val));
+
     if(argus.unit_check)
     {
         CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0(
@@ -547,24 +623,40 @@ rocsparse_status testing_csrilu0(Arguments argus)
         rocsparse_status pivot_status_1;
         pivot_status_1 = rocsparse_csrilu0_zero_pivot(handle, info, &hposition_1);
 
+        rocsparse_int hboost_count_1;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_boost_count(handle, info, &hboost_count_1));
+
         // Pointer mode device
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
 
         rocsparse_status pivot_status_2;
         pivot_status_2 = rocsparse_csrilu0_zero_pivot(handle, info, d_position);
 
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_boost_count(handle, info, d_boost_count));
+
         // Copy output from device to CPU
         rocsparse_int hposition_2;
+        rocsparse_int hboost_count_2;
         std::vector<T> result(nnz);
         CHECK_HIP_ERROR(hipMemcpy(result.data(), dval, sizeof(T) * nnz, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(
             hipMemcpy(&hposition_2, d_position, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            &hboost_count_2, d_boost_count, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
 
         // Host csrilu0
         double cpu_time_used = get_time_us();
 
-        rocsparse_int position_gold =
-            csrilu0(m, hcsr_row_ptr.data(), hcsr_col_ind.data(), hcsr_val.data(), idx_base);
+        rocsparse_int boost_count_gold = 0;
+        rocsparse_int position_gold    = csrilu0(m,
+                                              hcsr_row_ptr.data(),
+                                              hcsr_col_ind.data(),
+                                              hcsr_val.data(),
+                                              idx_base,
+                                              argus.boost != 0,
+                                              boost_tol,
+                                              boost_val,
+                                              &boost_count_gold);
 
         cpu_time_used = get_time_us() - cpu_time_used;
 
@@ -585,6 +677,8 @@ rocsparse_status testing_csrilu0(Arguments argus)
             return rocsparse_status_success;
         }
 
+        unit_check_general(1, 1, 1, &boost_count_gold, &hboost_count_1);
+        unit_check_general(1, 1, 1, &boost_count_gold, &hboost_count_2);
         unit_check_general(1, nnz, 1, hcsr_val.data(), result.data());
     }
 
@@ -0,0 +1,464 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSRITILU0_HPP
+#define TESTING_CSRITILU0_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <string>
+#include <cmath>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csritilu0_bad_arg(void)
+{
+    rocsparse_int m         = 100;
+    rocsparse_int nnz       = 100;
+    rocsparse_int safe_size = 100;
+    rocsparse_int nsweeps   = 10;
+    T* residual             = nullptr;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dbuffer_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+    void* dbuffer       = (void*)dbuffer_managed.get();
+
+    if(!dval || !dptr || !dcol || !dbuffer)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_csritilu0_buffer_size
+    size_t size;
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status =
+            rocsparse_csritilu0_buffer_size(handle, m, nnz, descr, dval, dptr_null, dcol, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status =
+            rocsparse_csritilu0_buffer_size(handle, m, nnz, descr, dval, dptr, dcol_null, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status =
+            rocsparse_csritilu0_buffer_size(handle, m, nnz, descr, dval_null, dptr, dcol, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == buffer_size)
+    {
+        size_t* size_null = nullptr;
+
+        status =
+            rocsparse_csritilu0_buffer_size(handle, m, nnz, descr, dval, dptr, dcol, size_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: size is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status =
+            rocsparse_csritilu0_buffer_size(handle, m, nnz, descr_null, dval, dptr, dcol, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status =
+            rocsparse_csritilu0_buffer_size(handle_null, m, nnz, descr, dval, dptr, dcol, &size);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csritilu0
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csritilu0(
+            handle, m, nnz, descr, dval, dptr_null, dcol, nsweeps, residual, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csritilu0(
+            handle, m, nnz, descr, dval, dptr, dcol_null, nsweeps, residual, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csritilu0(
+            handle, m, nnz, descr, dval_null, dptr, dcol, nsweeps, residual, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == dbuffer)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_csritilu0(
+            handle, m, nnz, descr, dval, dptr, dcol, nsweeps, residual, dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dbuffer is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csritilu0(
+            handle, m, nnz, descr_null, dval, dptr, dcol, nsweeps, residual, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csritilu0(
+            handle_null, m, nnz, descr, dval, dptr, dcol, nsweeps, residual, dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for(nsweeps < 0)
+    {
+        rocsparse_int nsweeps_neg = -1;
+
+        status = rocsparse_csritilu0(
+            handle, m, nnz, descr, dval, dptr, dcol, nsweeps_neg, residual, dbuffer);
+        verify_rocsparse_status_invalid_value(status, "Error: nsweeps is negative");
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csritilu0(Arguments argus)
+{
+    rocsparse_int safe_size       = 100;
+    rocsparse_int ndim            = argus.laplacian;
+    rocsparse_int nsweeps         = argus.sweeps;
+    rocsparse_index_base idx_base = argus.idx_base;
+    std::string filename          = "";
+    rocsparse_status status;
+    size_t size;
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Argument sanity check before allocating invalid memory, a negative laplacian
+    // dimension is used to test invalid sizes
+    if(filename == "" && ndim <= 0)
+    {
+        rocsparse_int m   = (ndim < 0) ? -1 : 0;
+        rocsparse_int nnz = m;
+
+        auto dptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto buffer_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+        rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+        T* dval             = (T*)dval_managed.get();
+        void* buffer        = (void*)buffer_managed.get();
+
+        if(!dval || !dptr || !dcol || !buffer)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || !buffer");
+            return rocsparse_status_memory_error;
+        }
+
+        // Test rocsparse_csritilu0_buffer_size
+        status = rocsparse_csritilu0_buffer_size(handle, m, nnz, descr, dval, dptr, dcol, &size);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        // Test rocsparse_csritilu0
+        T* residual = nullptr;
+
+        status = rocsparse_csritilu0(
+            handle, m, nnz, descr, dval, dptr, dcol, nsweeps, residual, buffer);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(filename != "")
+    {
+        std::vector<rocsparse_int> hcoo_row_ind;
+
+        if(read_mtx_matrix(
+               filename.c_str(), m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base) != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+            return rocsparse_status_internal_error;
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+    else
+    {
+        m = n = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        nnz   = hcsr_row_ptr[m] - idx_base;
+    }
+
+    std::vector<T> hcsr_val_1(nnz);
+    std::vector<T> hcsr_val_2(nnz);
+    std::vector<T> hcsr_val_gold(hcsr_val);
+    std::vector<T> hresidual_1(nsweeps);
+    std::vector<T> hresidual_2(nsweeps);
+
+    // Allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dval_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dresidual_managed = rocsparse_unique_ptr{
+        device_malloc(sizeof(T) * std::max(nsweeps, static_cast<rocsparse_int>(1))),
+        device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval_1           = (T*)dval_1_managed.get();
+    T* dval_2           = (T*)dval_2_managed.get();
+    T* dresidual        = (T*)dresidual_managed.get();
+
+    if(!dval_1 || !dval_2 || !dptr || !dcol || !dresidual)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval_1 || !dval_2 || !dptr || !dcol || !dresidual");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_1, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_2, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain csritilu0 buffer size
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csritilu0_buffer_size(handle, m, nnz, descr, dval_1, dptr, dcol, &size));
+
+    // Allocate buffer on the device
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    if(argus.unit_check)
+    {
+        // ROCSPARSE pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csritilu0(
+            handle, m, nnz, descr, dval_1, dptr, dcol, nsweeps, hresidual_1.data(), dbuffer));
+
+        // ROCSPARSE pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csritilu0(
+            handle, m, nnz, descr, dval_2, dptr, dcol, nsweeps, dresidual, dbuffer));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_1.data(), dval_1, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_2.data(), dval_2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hresidual_2.data(), dresidual, sizeof(T) * nsweeps, hipMemcpyDeviceToHost));
+
+        // Sweeps update the factors asynchronously, thus each run is checked against the
+        // residual of its own factors. Residuals are compared relative to the norm of A.
+        if(nsweeps > 0)
+        {
+            T nrm_a = static_cast<T>(0);
+            for(rocsparse_int i = 0; i < nnz; ++i)
+            {
+                nrm_a += hcsr_val[i] * hcsr_val[i];
+            }
+            nrm_a = std::sqrt(nrm_a);
+
+            T residual_gold_1 = csritilu0_residual(m,
+                                                   hcsr_row_ptr.data(),
+                                                   hcsr_col_ind.data(),
+                                                   hcsr_val.data(),
+                                                   hcsr_val_1.data(),
+                                                   idx_base)
+                                + nrm_a;
+            T residual_gold_2 = csritilu0_residual(m,
+                                                   hcsr_row_ptr.data(),
+                                                   hcsr_col_ind.data(),
+                                                   hcsr_val.data(),
+                                                   hcsr_val_2.data(),
+                                                   idx_base)
+                                + nrm_a;
+
+            hresidual_1[nsweeps - 1] += nrm_a;
+            hresidual_2[nsweeps - 1] += nrm_a;
+
+            unit_check_near(1, 1, 1, &residual_gold_1, &hresidual_1[nsweeps - 1]);
+            unit_check_near(1, 1, 1, &residual_gold_2, &hresidual_2[nsweeps - 1]);
+        }
+
+        // Fixed-point iteration reaches the exact ILU(0) factors after at most 2m sweeps
+        if(nsweeps >= 2 * m)
+        {
+            csrilu0(m, hcsr_row_ptr.data(), hcsr_col_ind.data(), hcsr_val_gold.data(), idx_base);
+
+            unit_check_near(1, nnz, 1, hcsr_val_gold.data(), hcsr_val_1.data());
+            unit_check_near(1, nnz, 1, hcsr_val_gold.data(), hcsr_val_2.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        T* residual = nullptr;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csritilu0(
+                handle, m, nnz, descr, dval_1, dptr, dcol, nsweeps, residual, dbuffer);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csritilu0(
+                handle, m, nnz, descr, dval_1, dptr, dcol, nsweeps, residual, dbuffer);
+        }
+
+        // Convert to miliseconds per call
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        // Bandwidth, each sweep processes all entries of the matrix
+        size_t int_data  = (m + 1 + nnz) * sizeof(rocsparse_int) * static_cast<size_t>(nsweeps);
+        size_t flt_data  = (nnz + nnz) * sizeof(T) * static_cast<size_t>(nsweeps);
+        double bandwidth = (int_data + flt_data) / gpu_time_used / 1e6;
+
+        printf("m\t\tnnz\t\tsweeps\tGB/s\tmsec\n");
+        printf("%8d\t%9d\t%d\t%0.2lf\t%0.2lf\n", m, nnz, nsweeps, bandwidth, gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRITILU0_HPP
@@ -0,0 +1,739 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRITSV_HPP
+#define TESTING_CSRITSV_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <string>
+#include <cmath>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csritsv_bad_arg(void)
+{
+    rocsparse_int m            = 100;
+    rocsparse_int nnz          = 100;
+    rocsparse_int safe_size    = 100;
+    rocsparse_int nsweeps      = 10;
+    T h_alpha                  = 0.6;
+    T* residual                = nullptr;
+    rocsparse_operation transA = rocsparse_operation_none;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dbuffer_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+    T* dx               = (T*)dx_managed.get();
+    T* dy               = (T*)dy_managed.get();
+    void* dbuffer       = (void*)dbuffer_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy || !dbuffer)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_csritsv_buffer_size
+    size_t size;
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csritsv_buffer_size(
+            handle, transA, m, nnz, descr, dval, dptr_null, dcol, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csritsv_buffer_size(
+            handle, transA, m, nnz, descr, dval, dptr, dcol_null, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csritsv_buffer_size(
+            handle, transA, m, nnz, descr, dval_null, dptr, dcol, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == buffer_size)
+    {
+        size_t* size_null = nullptr;
+
+        status = rocsparse_csritsv_buffer_size(
+            handle, transA, m, nnz, descr, dval, dptr, dcol, size_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: size is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csritsv_buffer_size(
+            handle, transA, m, nnz, descr_null, dval, dptr, dcol, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csritsv_buffer_size(
+            handle_null, transA, m, nnz, descr, dval, dptr, dcol, &size);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csritsv_solve
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csritsv_solve(handle,
+                                         transA,
+                                         m,
+                                         nnz,
+                                         &h_alpha,
+                                         descr,
+                                         dval,
+                                         dptr_null,
+                                         dcol,
+                                         dx,
+                                         dy,
+                                         nsweeps,
+                                         residual,
+                                         dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csritsv_solve(handle,
+                                         transA,
+                                         m,
+                                         nnz,
+                                         &h_alpha,
+                                         descr,
+                                         dval,
+                                         dptr,
+                                         dcol_null,
+                                         dx,
+                                         dy,
+                                         nsweeps,
+                                         residual,
+                                         dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csritsv_solve(handle,
+                                         transA,
+                                         m,
+                                         nnz,
+                                         &h_alpha,
+                                         descr,
+                                         dval_null,
+                                         dptr,
+                                         dcol,
+                                         dx,
+                                         dy,
+                                         nsweeps,
+                                         residual,
+                                         dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == dx)
+    {
+        T* dx_null = nullptr;
+
+        status = rocsparse_csritsv_solve(handle,
+                                         transA,
+                                         m,
+                                         nnz,
+                                         &h_alpha,
+                                         descr,
+                                         dval,
+                                         dptr,
+                                         dcol,
+                                         dx_null,
+                                         dy,
+                                         nsweeps,
+                                         residual,
+                                         dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dx is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T* dy_null = nullptr;
+
+        status = rocsparse_csritsv_solve(handle,
+                                         transA,
+                                         m,
+                                         nnz,
+                                         &h_alpha,
+                                         descr,
+                                         dval,
+                                         dptr,
+                                         dcol,
+                                         dx,
+                                         dy_null,
+                                         nsweeps,
+                                         residual,
+                                         dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dy is nullptr");
+    }
+    // testing for(nullptr == d_alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_csritsv_solve(handle,
+                                         transA,
+                                         m,
+                                         nnz,
+                                         d_alpha_null,
+                                         descr,
+                                         dval,
+                                         dptr,
+                                         dcol,
+                                         dx,
+                                         dy,
+                                         nsweeps,
+                                         residual,
+                                         dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(nullptr == dbuffer)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_csritsv_solve(handle,
+                                         transA,
+                                         m,
+                                         nnz,
+                                         &h_alpha,
+                                         descr,
+                                         dval,
+                                         dptr,
+                                         dcol,
+                                         dx,
+                                         dy,
+                                         nsweeps,
+                                         residual,
+                                         dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dbuffer is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csritsv_solve(handle,
+                                         transA,
+                                         m,
+                                         nnz,
+                                         &h_alpha,
+                                         descr_null,
+                                         dval,
+                                         dptr,
+                                         dcol,
+                                         dx,
+                                         dy,
+                                         nsweeps,
+                                         residual,
+                                         dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csritsv_solve(handle_null,
+                                         transA,
+                                         m,
+                                         nnz,
+                                         &h_alpha,
+                                         descr,
+                                         dval,
+                                         dptr,
+                                         dcol,
+                                         dx,
+                                         dy,
+                                         nsweeps,
+                                         residual,
+                                         dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for(nsweeps < 0)
+    {
+        rocsparse_int nsweeps_neg = -1;
+
+        status = rocsparse_csritsv_solve(handle,
+                                         transA,
+                                         m,
+                                         nnz,
+                                         &h_alpha,
+                                         descr,
+                                         dval,
+                                         dptr,
+                                         dcol,
+                                         dx,
+                                         dy,
+                                         nsweeps_neg,
+                                         residual,
+                                         dbuffer);
+        verify_rocsparse_status_invalid_value(status, "Error: nsweeps is negative");
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csritsv(Arguments argus)
+{
+    rocsparse_int safe_size       = 100;
+    rocsparse_int ndim            = argus.laplacian;
+    rocsparse_int nsweeps         = argus.sweeps;
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_operation trans     = argus.transA;
+    rocsparse_diag_type diag_type = argus.diag_type;
+    rocsparse_fill_mode fill_mode = argus.fill_mode;
+    T h_alpha                     = argus.alpha;
+    std::string filename          = "";
+    rocsparse_status status;
+    size_t size;
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Set matrix diag type
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, diag_type));
+
+    // Set matrix fill mode
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, fill_mode));
+
+    // Argument sanity check before allocating invalid memory, a negative laplacian
+    // dimension is used to test invalid sizes
+    if(filename == "" && ndim <= 0)
+    {
+        rocsparse_int m   = (ndim < 0) ? -1 : 0;
+        rocsparse_int nnz = m;
+
+        auto dptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto buffer_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+        rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+        T* dval             = (T*)dval_managed.get();
+        T* dx               = (T*)dx_managed.get();
+        T* dy               = (T*)dy_managed.get();
+        void* buffer        = (void*)buffer_managed.get();
+
+        if(!dval || !dptr || !dcol || !dx || !dy || !buffer)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || "
+                                            "!dx || !dy || !buffer");
+            return rocsparse_status_memory_error;
+        }
+
+        // Test rocsparse_csritsv_buffer_size
+        status =
+            rocsparse_csritsv_buffer_size(handle, trans, m, nnz, descr, dval, dptr, dcol, &size);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        // Test rocsparse_csritsv_solve
+        T* residual = nullptr;
+
+        status = rocsparse_csritsv_solve(handle,
+                                         trans,
+                                         m,
+                                         nnz,
+                                         &h_alpha,
+                                         descr,
+                                         dval,
+                                         dptr,
+                                         dcol,
+                                         dx,
+                                         dy,
+                                         nsweeps,
+                                         residual,
+                                         buffer);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(filename != "")
+    {
+        std::vector<rocsparse_int> hcoo_row_ind;
+
+        if(read_mtx_matrix(
+               filename.c_str(), m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base) != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+            return rocsparse_status_internal_error;
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+    else
+    {
+        m = n = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        nnz   = hcsr_row_ptr[m] - idx_base;
+    }
+
+    std::vector<T> hx(m);
+    std::vector<T> hy_1(n);
+    std::vector<T> hy_2(n);
+    std::vector<T> hy_gold(n);
+    std::vector<T> hresidual_1(nsweeps);
+    std::vector<T> hresidual_2(nsweeps);
+
+    rocsparse_init<T>(hx, 1, m);
+
+    // Allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed        = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_1_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dy_2_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto d_alpha_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto dresidual_managed = rocsparse_unique_ptr{
+        device_malloc(sizeof(T) * std::max(nsweeps, static_cast<rocsparse_int>(1))),
+        device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+    T* dx               = (T*)dx_managed.get();
+    T* dy_1             = (T*)dy_1_managed.get();
+    T* dy_2             = (T*)dy_2_managed.get();
+    T* d_alpha          = (T*)d_alpha_managed.get();
+    T* dresidual        = (T*)dresidual_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy_1 || !dy_2 || !d_alpha || !dresidual)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !dx || "
+                                        "!dy_1 || !dy_2 || !d_alpha || !dresidual");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // Obtain csritsv buffer size
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csritsv_buffer_size(handle, trans, m, nnz, descr, dval, dptr, dcol, &size));
+
+    // Allocate buffer on the device
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    if(argus.unit_check)
+    {
+        // ROCSPARSE pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csritsv_solve(handle,
+                                                      trans,
+                                                      m,
+                                                      nnz,
+                                                      &h_alpha,
+                                                      descr,
+                                                      dval,
+                                                      dptr,
+                                                      dcol,
+                                                      dx,
+                                                      dy_1,
+                                                      nsweeps,
+                                                      hresidual_1.data(),
+                                                      dbuffer));
+
+        // ROCSPARSE pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csritsv_solve(handle,
+                                                      trans,
+                                                      m,
+                                                      nnz,
+                                                      d_alpha,
+                                                      descr,
+                                                      dval,
+                                                      dptr,
+                                                      dcol,
+                                                      dx,
+                                                      dy_2,
+                                                      nsweeps,
+                                                      dresidual,
+                                                      dbuffer));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * n, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * n, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hresidual_2.data(), dresidual, sizeof(T) * nsweeps, hipMemcpyDeviceToHost));
+
+        // Jacobi sweeps are deterministic, both pointer modes have to match
+        unit_check_general(1, n, 1, hy_1.data(), hy_2.data());
+        unit_check_general(1, nsweeps, 1, hresidual_1.data(), hresidual_2.data());
+
+        // Residual of the last sweep
+        if(nsweeps > 0)
+        {
+            T residual_gold = csritsv_residual(m,
+                                               hcsr_row_ptr.data(),
+                                               hcsr_col_ind.data(),
+                                               hcsr_val.data(),
+                                               h_alpha,
+                                               hx.data(),
+                                               hy_1.data(),
+                                               idx_base,
+                                               fill_mode,
+                                               diag_type);
+
+            // Residuals are compared relative to the norm of the right-hand side
+            T nrm_x = std::abs(h_alpha) * csritsv_residual(m,
+                                                           hcsr_row_ptr.data(),
+                                                           hcsr_col_ind.data(),
+                                                           hcsr_val.data(),
+                                                           static_cast<T>(1),
+                                                           hx.data(),
+                                                           hy_gold.data(),
+                                                           idx_base,
+                                                           fill_mode,
+                                                           diag_type);
+
+            residual_gold += nrm_x;
+            hresidual_1[nsweeps - 1] += nrm_x;
+
+            unit_check_near(1, 1, 1, &residual_gold, &hresidual_1[nsweeps - 1]);
+        }
+
+        // Jacobi iteration converges after at most m sweeps
+        if(nsweeps >= m)
+        {
+            hipDeviceProp_t prop;
+            hipGetDeviceProperties(&prop, 0);
+
+            if(fill_mode == rocsparse_fill_mode_lower)
+            {
+                lsolve(m,
+                       hcsr_row_ptr.data(),
+                       hcsr_col_ind.data(),
+                       hcsr_val.data(),
+                       h_alpha,
+                       hx.data(),
+                       hy_gold.data(),
+                       idx_base,
+                       diag_type,
+                       prop.warpSize);
+            }
+            else
+            {
+                usolve(m,
+                       hcsr_row_ptr.data(),
+                       hcsr_col_ind.data(),
+                       hcsr_val.data(),
+                       h_alpha,
+                       hx.data(),
+                       hy_gold.data(),
+                       idx_base,
+                       diag_type,
+                       prop.warpSize);
+            }
+
+            unit_check_near(1, n, 1, hy_gold.data(), hy_1.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        T* residual = nullptr;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csritsv_solve(handle,
+                                    trans,
+                                    m,
+                                    nnz,
+                                    &h_alpha,
+                                    descr,
+                                    dval,
+                                    dptr,
+                                    dcol,
+                                    dx,
+                                    dy_1,
+                                    nsweeps,
+                                    residual,
+                                    dbuffer);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csritsv_solve(handle,
+                                    trans,
+                                    m,
+                                    nnz,
+                                    &h_alpha,
+                                    descr,
+                                    dval,
+                                    dptr,
+                                    dcol,
+                                    dx,
+                                    dy_1,
+                                    nsweeps,
+                                    residual,
+                                    dbuffer);
+        }
+
+        // Convert to miliseconds per call
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        // GFlops, each sweep processes all entries of the matrix
+        size_t flops = (2 * nnz + 2 * m) * static_cast<size_t>(nsweeps);
+
+        double gpu_gflops = flops / gpu_time_used / 1e6;
+
+        // Bandwidth
+        size_t int_data  = (m + 1 + nnz) * sizeof(rocsparse_int) * static_cast<size_t>(nsweeps);
+        size_t flt_data  = (nnz + m + m + m) * sizeof(T) * static_cast<size_t>(nsweeps);
+        double bandwidth = (int_data + flt_data) / gpu_time_used / 1e6;
+
+        printf("m\t\tnnz\t\talpha\tsweeps\tGFlops\tGB/s\tmsec\n");
+        printf("%8d\t%9d\t%0.2lf\t%d\t%0.2lf\t%0.2lf\t%0.2lf\n",
+               m,
+               nnz,
+               h_alpha,
+               nsweeps,
+               gpu_gflops,
+               bandwidth,
+               gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRITSV_HPP
@@ -29,6 +29,7 @@
 #include "rocsparse.hpp"
 #include "utility.hpp"
 #include "unit.hpp"
+#include "merge_path.h"
 
 #include <string>
 #include <cmath>
@@ -37,6 +38,20 @@
 using namespace rocsparse;
 using namespace rocsparse_test;
 
+// Leading fields of _rocsparse_csrmv_info and _rocsparse_mat_info
+struct test_csrmv_info
+{
+    rocsparse_csrmv_alg alg;
+    size_t size;
+    unsigned long long* row_blocks;
+};
+
+struct test_mat_info
+{
+    rocsparse_csrmv_alg csrmv_alg;
+    test_csrmv_info* csrmv_info;
+};
+
 template <typename T>
 void testing_csrmv_bad_arg(void)
 {
@@ -324,6 +339,373 @@ void testing_csrmv_bad_arg(void)
     }
 }
 
+template <typename T>
+static rocsparse_status csrmv_init_row_ptr(Arguments argus,
+                                           rocsparse_int& m,
+                                           std::vector<rocsparse_int>& hcsr_row_ptr,
+                                           rocsparse_index_base& idx_base)
+{
+    rocsparse_int n     = argus.N;
+    rocsparse_int nnz   = 0;
+    std::string binfile = "";
+
+    m        = argus.M;
+    idx_base = argus.idx_base;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && n == -99)
+    {
+        binfile = argus.filename;
+    }
+
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        std::vector<rocsparse_int> hcol_ind;
+        std::vector<T> hval;
+
+        if(read_bin_matrix(binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else
+    {
+        // Random row lengths, mixing short, long and very long rows with exact block sizes
+        rocsparse_int row_length[] = {0, 1, 7, 31, 32, 64, 128, 129, 512, 1023, 1024, 3072, 3073};
+
+        hcsr_row_ptr.resize(m + 1, idx_base);
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            rocsparse_int len = (rand() % 4) ? rand() % 48 : row_length[rand() % 13];
+
+            hcsr_row_ptr[i + 1] = hcsr_row_ptr[i] + len;
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status testing_csrmv_row_blocks(Arguments argus)
+{
+    rocsparse_int m;
+    rocsparse_index_base idx_base;
+    std::vector<rocsparse_int> hcsr_row_ptr;
+
+    rocsparse_status status = csrmv_init_row_ptr<T>(argus, m, hcsr_row_ptr, idx_base);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    // Nothing to analyse
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    rocsparse_int nnz = hcsr_row_ptr[m] - idx_base;
+
+    // Column indices are not inspected by the row blocks analysis
+    std::vector<rocsparse_int> hcsr_col_ind(nnz, idx_base);
+    std::vector<T> hcsr_val(nnz, static_cast<T>(1));
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info info = unique_ptr_mat_info->info;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+
+    if(!dptr || !dcol || !dval)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dptr || !dcol || !dval");
+        return rocsparse_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Row blocks built on the device by the analysis
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+        handle, rocsparse_operation_none, m, m, nnz, descr, dval, dptr, dcol, info));
+
+    test_csrmv_info* dinfo = ((test_mat_info*)info)->csrmv_info;
+
+    std::vector<unsigned long long> row_blocks_device(dinfo->size);
+    CHECK_HIP_ERROR(hipMemcpy(row_blocks_device.data(),
+                              dinfo->row_blocks,
+                              sizeof(unsigned long long) * dinfo->size,
+                              hipMemcpyDeviceToHost));
+
+    // Serial and multi-threaded host row blocks have to be identical
+    std::vector<unsigned long long> row_blocks_gold;
+    std::vector<unsigned long long> row_blocks_mt;
+
+    csrmv_row_blocks(m, hcsr_row_ptr.data(), row_blocks_gold);
+    csrmv_row_blocks_mt(m, hcsr_row_ptr.data(), row_blocks_mt);
+
+    size_t size_gold = row_blocks_gold.size();
+    size_t size_mt   = row_blocks_mt.size();
+
+    unit_check_general(1, 1, 1, &size_gold, &size_mt);
+    unit_check_general(1, size_gold, 1, row_blocks_gold.data(), row_blocks_mt.data());
+
+    // The device array reserves twice the space for the extended precision reduction,
+    // the second half is zero
+    row_blocks_gold.resize(2 * size_gold, 0);
+
+    size_gold          = row_blocks_gold.size();
+    size_t size_device = row_blocks_device.size();
+
+    unit_check_general(1, 1, 1, &size_gold, &size_device);
+    unit_check_general(1, size_gold, 1, row_blocks_gold.data(), row_blocks_device.data());
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status testing_csrmv_merge_path(Arguments argus)
+{
+    rocsparse_int m;
+    rocsparse_index_base idx_base;
+    std::vector<rocsparse_int> hcsr_row_ptr;
+
+    rocsparse_status status = csrmv_init_row_ptr<T>(argus, m, hcsr_row_ptr, idx_base);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    rocsparse_int nnz = hcsr_row_ptr[m] - idx_base;
+
+    // Brute force, walk along the merge path and store the coordinate of each diagonal
+    std::vector<rocsparse_int> row_gold(m + nnz + 1);
+    std::vector<rocsparse_int> nnz_gold(m + nnz + 1);
+
+    rocsparse_int row = 0;
+    rocsparse_int nz  = 0;
+
+    for(rocsparse_int d = 0; d <= m + nnz; ++d)
+    {
+        row_gold[d] = row;
+        nnz_gold[d] = nz;
+
+        if(nz < nnz && (row == m || nz < hcsr_row_ptr[row + 1] - idx_base))
+        {
+            ++nz;
+        }
+        else
+        {
+            ++row;
+        }
+    }
+
+    // Merge path search on all diagonals
+    std::vector<rocsparse_int> row_search(m + nnz + 1);
+    std::vector<rocsparse_int> nnz_search(m + nnz + 1);
+
+    for(rocsparse_int d = 0; d <= m + nnz; ++d)
+    {
+        rocsparse_merge_path_search(
+            d, m, nnz, hcsr_row_ptr.data() + 1, 0, idx_base, row_search[d], nnz_search[d]);
+    }
+
+    unit_check_general(1, m + nnz + 1, 1, row_gold.data(), row_search.data());
+    unit_check_general(1, m + nnz + 1, 1, nnz_gold.data(), nnz_search.data());
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status testing_csrmv_cache(Arguments argus)
+{
+    rocsparse_int m;
+    rocsparse_index_base idx_base;
+    std::vector<rocsparse_int> hcsr_row_ptr;
+
+    rocsparse_status status = csrmv_init_row_ptr<T>(argus, m, hcsr_row_ptr, idx_base);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    rocsparse_int n   = m;
+    rocsparse_int nnz = hcsr_row_ptr[m] - idx_base;
+
+    // Analysis does not touch the cache for empty matrices
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Random column indices and values
+    std::vector<rocsparse_int> hcol_ind(nnz);
+    std::vector<T> hval(nnz);
+    std::vector<T> hx(n);
+    std::vector<T> hy_gold(m, static_cast<T>(0));
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        hcol_ind[i] = rand() % n + idx_base;
+    }
+
+    rocsparse_init<T>(hval, 1, nnz);
+    rocsparse_init<T>(hx, 1, n);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            hy_gold[i] += hval[j] * hx[hcol_ind[j] - idx_base];
+        }
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info_1(new mat_info_struct);
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info_2(new mat_info_struct);
+    rocsparse_mat_info info_1 = unique_ptr_mat_info_1->info;
+    rocsparse_mat_info info_2 = unique_ptr_mat_info_2->info;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // The same pattern is stored in two separate sets of buffers
+    auto dptr_1_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dptr_2_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_1_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dcol_2_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dy_1_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    rocsparse_int* dptr_1 = (rocsparse_int*)dptr_1_managed.get();
+    rocsparse_int* dptr_2 = (rocsparse_int*)dptr_2_managed.get();
+    rocsparse_int* dcol_1 = (rocsparse_int*)dcol_1_managed.get();
+    rocsparse_int* dcol_2 = (rocsparse_int*)dcol_2_managed.get();
+    T* dval               = (T*)dval_managed.get();
+    T* dx                 = (T*)dx_managed.get();
+    T* dy_1               = (T*)dy_1_managed.get();
+    T* dy_2               = (T*)dy_2_managed.get();
+
+    if(!dptr_1 || !dptr_2 || !dcol_1 || !dcol_2 || !dval || !dx || !dy_1 || !dy_2)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr_1 || !dptr_2 || !dcol_1 || !dcol_2 || "
+                                        "!dval || !dx || !dy_1 || !dy_2");
+        return rocsparse_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr_1, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr_2, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol_1, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol_2, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+
+    rocsparse_operation trans = rocsparse_operation_none;
+
+    size_t hits;
+    size_t misses;
+    rocsparse_int stats[2];
+    rocsparse_int stats_gold[2];
+
+    // Cache two patterns
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_csrmv_cache_capacity(handle, 2));
+
+    // First analysis computes the row blocks, second one finds them in the cache
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrmv_analysis(handle, trans, m, n, nnz, descr, dval, dptr_1, dcol_1, info_1));
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrmv_analysis(handle, trans, m, n, nnz, descr, dval, dptr_2, dcol_2, info_2));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_csrmv_cache_stats(handle, &hits, &misses));
+    stats[0]      = hits;
+    stats[1]      = misses;
+    stats_gold[0] = 1;
+    stats_gold[1] = 1;
+    unit_check_general(1, 2, 1, stats_gold, stats);
+
+    // Both infos have to produce the correct product
+    T h_alpha = static_cast<T>(1);
+    T h_beta  = static_cast<T>(0);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(
+        handle, trans, m, n, nnz, &h_alpha, descr, dval, dptr_1, dcol_1, info_1, dx, &h_beta, dy_1));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(
+        handle, trans, m, n, nnz, &h_alpha, descr, dval, dptr_2, dcol_2, info_2, dx, &h_beta, dy_2));
+
+    std::vector<T> hy_1(m);
+    std::vector<T> hy_2(m);
+
+    CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
+    unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+
+    // Two further patterns (different number of columns) evict the first pattern
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+        handle, trans, m, n + 1, nnz, descr, dval, dptr_2, dcol_2, info_2));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+        handle, trans, m, n + 2, nnz, descr, dval, dptr_2, dcol_2, info_2));
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrmv_analysis(handle, trans, m, n, nnz, descr, dval, dptr_1, dcol_1, info_1));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_csrmv_cache_stats(handle, &hits, &misses));
+    stats[0]      = hits;
+    stats[1]      = misses;
+    stats_gold[0] = 1;
+    stats_gold[1] = 4;
+    unit_check_general(1, 2, 1, stats_gold, stats);
+
+    // Disabled cache does not count
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_csrmv_cache_capacity(handle, 0));
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrmv_analysis(handle, trans, m, n, nnz, descr, dval, dptr_1, dcol_1, info_1));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_csrmv_cache_stats(handle, &hits, &misses));
+    stats[0] = hits;
+    stats[1] = misses;
+    unit_check_general(1, 2, 1, stats_gold, stats);
+
+    return rocsparse_status_success;
+}
+
 template <typename T>
 static T two_sum(T x, T y, T* sumk_err)
 {
@@ -343,6 +725,8 @@ rocsparse_status testing_csrmv(Arguments argus)
     T h_beta                      = argus.beta;
     rocsparse_operation transA    = argus.transA;
     rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_matrix_type type    = argus.mat_type;
+    rocsparse_fill_mode fill_mode = argus.fill_mode;
     bool adaptive                 = argus.bswitch;
     std::string binfile           = "";
     std::string filename          = "";
@@ -373,11 +757,18 @@ rocsparse_status testing_csrmv(Arguments argus)
     if(adaptive)
     {
         info = unique_ptr_mat_info->info;
+
+        // Set csrmv algorithm
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_info_csrmv_alg(info, argus.csrmv_alg));
     }
 
     // Set matrix index base
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
 
+    // Set matrix type and fill mode
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, type));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, fill_mode));
+
     // Determine number of non-zero elements
     double scale = 0.02;
     if(m > 1000 || n > 1000)
@@ -500,13 +891,25 @@ rocsparse_status testing_csrmv(Arguments argus)
         }
     }
 
-    std::vector<T> hx(n);
-    std::vector<T> hy_1(m);
-    std::vector<T> hy_2(m);
-    std::vector<T> hy_gold(m);
+    // Symmetric matrices only store one triangle
+    if(type != rocsparse_matrix_type_general)
+    {
+        nnz = csr_extract_triangle(m, hcsr_row_ptr, hcol_ind, hval, fill_mode, idx_base);
+    }
 
-    rocsparse_init<T>(hx, 1, n);
-    rocsparse_init<T>(hy_1, 1, m);
+    // Vector sizes depend on the operation
+    bool transpose = (transA != rocsparse_operation_none && type == rocsparse_matrix_type_general);
+
+    rocsparse_int xsize = transpose ? m : n;
+    rocsparse_int ysize = transpose ? n : m;
+
+    std::vector<T> hx(xsize);
+    std::vector<T> hy_1(ysize);
+    std::vector<T> hy_2(ysize);
+    std::vector<T> hy_gold(ysize);
+
+    rocsparse_init<T>(hx, 1, xsize);
+    rocsparse_init<T>(hy_1, 1, ysize);
 
     // copy vector is easy in STL; hy_gold = hx: save a copy in hy_gold which will be output of CPU
     hy_2    = hy_1;
@@ -518,9 +921,9 @@ rocsparse_status testing_csrmv(Arguments argus)
     auto dcol_managed =
         rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
     auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
-    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
-    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
-    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * xsize), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ysize), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ysize), device_free};
     auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
     auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
 
@@ -547,8 +950,8 @@ rocsparse_status testing_csrmv(Arguments argus)
     CHECK_HIP_ERROR(
         hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * xsize, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
@@ -561,7 +964,7 @@ rocsparse_status testing_csrmv(Arguments argus)
 
     if(argus.unit_check)
     {
-        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
 
         // ROCSPARSE pointer mode host
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
@@ -574,14 +977,57 @@ rocsparse_status testing_csrmv(Arguments argus)
             handle, transA, m, n, nnz, d_alpha, descr, dval, dptr, dcol, info, dx, d_beta, dy_2));
 
         // copy output from device to CPU
-        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * ysize, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * ysize, hipMemcpyDeviceToHost));
 
         // CPU - do the csrmv row reduction in the same order as the GPU
         double cpu_time_used = get_time_us();
 
         // Different csrmv algorithms require different CPU summation
-        if(adaptive)
+        if(type != rocsparse_matrix_type_general)
+        {
+            // Symmetric product, mirror the stored triangle
+            for(rocsparse_int i = 0; i < m; ++i)
+            {
+                hy_gold[i] = (h_beta == 0.0) ? static_cast<T>(0) : h_beta * hy_gold[i];
+            }
+
+            for(rocsparse_int i = 0; i < m; ++i)
+            {
+                for(rocsparse_int j = hcsr_row_ptr[i] - idx_base;
+                    j < hcsr_row_ptr[i + 1] - idx_base;
+                    ++j)
+                {
+                    rocsparse_int col = hcol_ind[j] - idx_base;
+
+                    hy_gold[i] += h_alpha * hval[j] * hx[col];
+
+                    if(col != i)
+                    {
+                        hy_gold[col] += h_alpha * hval[j] * hx[i];
+                    }
+                }
+            }
+        }
+        else if(transpose)
+        {
+            // Transposed product, scatter each row into y
+            for(rocsparse_int i = 0; i < n; ++i)
+            {
+                hy_gold[i] = (h_beta == 0.0) ? static_cast<T>(0) : h_beta * hy_gold[i];
+            }
+
+            for(rocsparse_int i = 0; i < m; ++i)
+            {
+                for(rocsparse_int j = hcsr_row_ptr[i] - idx_base;
+                    j < hcsr_row_ptr[i + 1] - idx_base;
+                    ++j)
+                {
+                    hy_gold[hcol_ind[j] - idx_base] += h_alpha * hval[j] * hx[i];
+                }
+            }
+        }
+        else if(adaptive)
         {
             for(rocsparse_int i = 0; i < m; ++i)
             {
@@ -680,15 +1126,15 @@ rocsparse_status testing_csrmv(Arguments argus)
 
         cpu_time_used = get_time_us() - cpu_time_used;
 
-        if(adaptive)
+        if(adaptive || transpose || type != rocsparse_matrix_type_general)
         {
-            unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
-            unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+            unit_check_near(1, ysize, 1, hy_gold.data(), hy_1.data());
+            unit_check_near(1, ysize, 1, hy_gold.data(), hy_2.data());
         }
         else
         {
-            unit_check_general(1, m, 1, hy_gold.data(), hy_1.data());
-            unit_check_general(1, m, 1, hy_gold.data(), hy_2.data());
+            unit_check_general(1, ysize, 1, hy_gold.data(), hy_1.data());
+            unit_check_general(1, ysize, 1, hy_gold.data(), hy_2.data());
         }
     }
 
@@ -739,10 +1185,10 @@ rocsparse_status testing_csrmv(Arguments argus)
         // Convert to miliseconds per call
         gpu_time_used     = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
         size_t flops      = (h_alpha != 1.0) ? 3.0 * nnz : 2.0 * nnz;
-        flops             = (h_beta != 0.0) ? flops + m : flops;
+        flops             = (h_beta != 0.0) ? flops + ysize : flops;
         double gpu_gflops = flops / gpu_time_used / 1e6;
-        size_t memtrans   = 2.0 * m + nnz;
-        memtrans          = (h_beta != 0.0) ? memtrans + m : memtrans;
+        size_t memtrans   = xsize + ysize + nnz;
+        memtrans          = (h_beta != 0.0) ? memtrans + ysize : memtrans;
         double bandwidth =
             (memtrans * sizeof(T) + (m + 1 + nnz) * sizeof(rocsparse_int)) / gpu_time_used / 1e6;
 
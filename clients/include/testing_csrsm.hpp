@@ -0,0 +1,1265 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRSM_HPP
+#define TESTING_CSRSM_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <string>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csrsm_bad_arg(void)
+{
+    rocsparse_int m                    = 100;
+    rocsparse_int nrhs                 = 10;
+    rocsparse_int nnz                  = 100;
+    rocsparse_int ldb                  = 100;
+    rocsparse_int safe_size            = 100;
+    T h_alpha                          = 0.6;
+    rocsparse_operation transA         = rocsparse_operation_none;
+    rocsparse_operation transB         = rocsparse_operation_none;
+    rocsparse_analysis_policy analysis = rocsparse_analysis_policy_reuse;
+    rocsparse_solve_policy solve       = rocsparse_solve_policy_auto;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info info = unique_ptr_mat_info->info;
+
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dB_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dbuffer_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+    T* dB               = (T*)dB_managed.get();
+    void* dbuffer       = (void*)dbuffer_managed.get();
+
+    if(!dval || !dptr || !dcol || !dB || !dbuffer)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_csrsm_buffer_size
+    size_t size;
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrsm_buffer_size(handle,
+                                             transA,
+                                             transB,
+                                             m,
+                                             nrhs,
+                                             nnz,
+                                             &h_alpha,
+                                             descr,
+                                             dval,
+                                             dptr_null,
+                                             dcol,
+                                             dB,
+                                             ldb,
+                                             info,
+                                             solve,
+                                             &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrsm_buffer_size(handle,
+                                             transA,
+                                             transB,
+                                             m,
+                                             nrhs,
+                                             nnz,
+                                             &h_alpha,
+                                             descr,
+                                             dval,
+                                             dptr,
+                                             dcol_null,
+                                             dB,
+                                             ldb,
+                                             info,
+                                             solve,
+                                             &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrsm_buffer_size(handle,
+                                             transA,
+                                             transB,
+                                             m,
+                                             nrhs,
+                                             nnz,
+                                             &h_alpha,
+                                             descr,
+                                             dval_null,
+                                             dptr,
+                                             dcol,
+                                             dB,
+                                             ldb,
+                                             info,
+                                             solve,
+                                             &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == buffer_size)
+    {
+        size_t* size_null = nullptr;
+
+        status = rocsparse_csrsm_buffer_size(handle,
+                                             transA,
+                                             transB,
+                                             m,
+                                             nrhs,
+                                             nnz,
+                                             &h_alpha,
+                                             descr,
+                                             dval,
+                                             dptr,
+                                             dcol,
+                                             dB,
+                                             ldb,
+                                             info,
+                                             solve,
+                                             size_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: size is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrsm_buffer_size(handle,
+                                             transA,
+                                             transB,
+                                             m,
+                                             nrhs,
+                                             nnz,
+                                             &h_alpha,
+                                             descr_null,
+                                             dval,
+                                             dptr,
+                                             dcol,
+                                             dB,
+                                             ldb,
+                                             info,
+                                             solve,
+                                             &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrsm_buffer_size(handle,
+                                             transA,
+                                             transB,
+                                             m,
+                                             nrhs,
+                                             nnz,
+                                             &h_alpha,
+                                             descr,
+                                             dval,
+                                             dptr,
+                                             dcol,
+                                             dB,
+                                             ldb,
+                                             info_null,
+                                             solve,
+                                             &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrsm_buffer_size(handle_null,
+                                             transA,
+                                             transB,
+                                             m,
+                                             nrhs,
+                                             nnz,
+                                             &h_alpha,
+                                             descr,
+                                             dval,
+                                             dptr,
+                                             dcol,
+                                             dB,
+                                             ldb,
+                                             info,
+                                             solve,
+                                             &size);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csrsm_analysis
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrsm_analysis(handle,
+                                          transA,
+                                          transB,
+                                          m,
+                                          nrhs,
+                                          nnz,
+                                          &h_alpha,
+                                          descr,
+                                          dval,
+                                          dptr_null,
+                                          dcol,
+                                          dB,
+                                          ldb,
+                                          info,
+                                          analysis,
+                                          solve,
+                                          dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrsm_analysis(handle,
+                                          transA,
+                                          transB,
+                                          m,
+                                          nrhs,
+                                          nnz,
+                                          &h_alpha,
+                                          descr,
+                                          dval,
+                                          dptr,
+                                          dcol_null,
+                                          dB,
+                                          ldb,
+                                          info,
+                                          analysis,
+                                          solve,
+                                          dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrsm_analysis(handle,
+                                          transA,
+                                          transB,
+                                          m,
+                                          nrhs,
+                                          nnz,
+                                          &h_alpha,
+                                          descr,
+                                          dval_null,
+                                          dptr,
+                                          dcol,
+                                          dB,
+                                          ldb,
+                                          info,
+                                          analysis,
+                                          solve,
+                                          dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == dbuffer)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_csrsm_analysis(handle,
+                                          transA,
+                                          transB,
+                                          m,
+                                          nrhs,
+                                          nnz,
+                                          &h_alpha,
+                                          descr,
+                                          dval,
+                                          dptr,
+                                          dcol,
+                                          dB,
+                                          ldb,
+                                          info,
+                                          analysis,
+                                          solve,
+                                          dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dbuffer is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrsm_analysis(handle,
+                                          transA,
+                                          transB,
+                                          m,
+                                          nrhs,
+                                          nnz,
+                                          &h_alpha,
+                                          descr_null,
+                                          dval,
+                                          dptr,
+                                          dcol,
+                                          dB,
+                                          ldb,
+                                          info,
+                                          analysis,
+                                          solve,
+                                          dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrsm_analysis(handle,
+                                          transA,
+                                          transB,
+                                          m,
+                                          nrhs,
+                                          nnz,
+                                          &h_alpha,
+                                          descr,
+                                          dval,
+                                          dptr,
+                                          dcol,
+                                          dB,
+                                          ldb,
+                                          info_null,
+                                          analysis,
+                                          solve,
+                                          dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrsm_analysis(handle_null,
+                                          transA,
+                                          transB,
+                                          m,
+                                          nrhs,
+                                          nnz,
+                                          &h_alpha,
+                                          descr,
+                                          dval,
+                                          dptr,
+                                          dcol,
+                                          dB,
+                                          ldb,
+                                          info,
+                                          analysis,
+                                          solve,
+                                          dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csrsm_solve
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrsm_solve(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       nrhs,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr_null,
+                                       dcol,
+                                       dB,
+                                       ldb,
+                                       info,
+                                       solve,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrsm_solve(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       nrhs,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol_null,
+                                       dB,
+                                       ldb,
+                                       info,
+                                       solve,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrsm_solve(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       nrhs,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval_null,
+                                       dptr,
+                                       dcol,
+                                       dB,
+                                       ldb,
+                                       info,
+                                       solve,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_csrsm_solve(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       nrhs,
+                                       nnz,
+                                       d_alpha_null,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       dB,
+                                       ldb,
+                                       info,
+                                       solve,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(nullptr == dB)
+    {
+        T* dB_null = nullptr;
+
+        status = rocsparse_csrsm_solve(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       nrhs,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       dB_null,
+                                       ldb,
+                                       info,
+                                       solve,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dB is nullptr");
+    }
+    // testing for(nullptr == dbuffer)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_csrsm_solve(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       nrhs,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       dB,
+                                       ldb,
+                                       info,
+                                       solve,
+                                       dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dbuffer is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrsm_solve(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       nrhs,
+                                       nnz,
+                                       &h_alpha,
+                                       descr_null,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       dB,
+                                       ldb,
+                                       info,
+                                       solve,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrsm_solve(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       nrhs,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       dB,
+                                       ldb,
+                                       info_null,
+                                       solve,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrsm_solve(handle_null,
+                                       transA,
+                                       transB,
+                                       m,
+                                       nrhs,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       dB,
+                                       ldb,
+                                       info,
+                                       solve,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for(ldb < m)
+    {
+        status = rocsparse_csrsm_solve(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       nrhs,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       dB,
+                                       m - 1,
+                                       info,
+                                       solve,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_size(status, "Error: ldb < m");
+    }
+    // testing for(ldb < nrhs) with transposed B
+    {
+        status = rocsparse_csrsm_solve(handle,
+                                       transA,
+                                       rocsparse_operation_transpose,
+                                       m,
+                                       nrhs,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       dB,
+                                       nrhs - 1,
+                                       info,
+                                       solve,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_size(status, "Error: ldb < nrhs");
+    }
+    // testing for invalid solve policy
+    {
+        rocsparse_solve_policy solve_invalid = static_cast<rocsparse_solve_policy>(-1);
+
+        status = rocsparse_csrsm_solve(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       nrhs,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       dB,
+                                       ldb,
+                                       info,
+                                       solve_invalid,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_value(status, "Error: solve policy is invalid");
+    }
+
+    // testing rocsparse_csrsm_zero_pivot
+    rocsparse_int position;
+
+    // testing for(nullptr == position)
+    {
+        rocsparse_int* position_null = nullptr;
+
+        status = rocsparse_csrsm_zero_pivot(handle, descr, info, position_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: position is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrsm_zero_pivot(handle, descr, info_null, &position);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrsm_zero_pivot(handle_null, descr, info, &position);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csrsm_clear
+
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrsm_clear(handle, descr_null, info);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrsm_clear(handle, descr, info_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrsm_clear(handle_null, descr, info);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csrsm(Arguments argus)
+{
+    rocsparse_int safe_size       = 100;
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.M;
+    rocsparse_int nrhs            = argus.K;
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_operation transA    = argus.transA;
+    rocsparse_operation transB    = argus.transB;
+    rocsparse_diag_type diag_type = argus.diag_type;
+    rocsparse_fill_mode fill_mode = argus.fill_mode;
+    rocsparse_solve_policy policy = argus.solve;
+    T h_alpha                     = argus.alpha;
+    std::string filename          = "";
+    rocsparse_status status;
+    size_t size;
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info info = unique_ptr_mat_info->info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Set matrix diag type
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, diag_type));
+
+    // Set matrix fill mode
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, fill_mode));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000)
+    {
+        scale = 2.0 / m;
+    }
+    rocsparse_int nnz = m * scale * m;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || nrhs <= 0 || nnz <= 0)
+    {
+        auto dptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dB_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto buffer_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+        rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+        T* dval             = (T*)dval_managed.get();
+        T* dB               = (T*)dB_managed.get();
+        void* buffer        = (void*)buffer_managed.get();
+
+        if(!dval || !dptr || !dcol || !dB || !buffer)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || "
+                                            "!dB || !buffer");
+            return rocsparse_status_memory_error;
+        }
+
+        rocsparse_int ldb = std::max(m, safe_size);
+
+        // Test rocsparse_csrsm_buffer_size
+        status = rocsparse_csrsm_buffer_size(handle,
+                                             transA,
+                                             transB,
+                                             m,
+                                             nrhs,
+                                             nnz,
+                                             &h_alpha,
+                                             descr,
+                                             dval,
+                                             dptr,
+                                             dcol,
+                                             dB,
+                                             ldb,
+                                             info,
+                                             policy,
+                                             &size);
+
+        if(m < 0 || nrhs < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nrhs < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nrhs >= 0 && nnz >= 0");
+        }
+
+        // Test rocsparse_csrsm_analysis
+        status = rocsparse_csrsm_analysis(handle,
+                                          transA,
+                                          transB,
+                                          m,
+                                          nrhs,
+                                          nnz,
+                                          &h_alpha,
+                                          descr,
+                                          dval,
+                                          dptr,
+                                          dcol,
+                                          dB,
+                                          ldb,
+                                          info,
+                                          rocsparse_analysis_policy_reuse,
+                                          policy,
+                                          buffer);
+
+        if(m < 0 || nrhs < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nrhs < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nrhs >= 0 && nnz >= 0");
+        }
+
+        // Test rocsparse_csrsm_solve
+        status = rocsparse_csrsm_solve(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       nrhs,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       dB,
+                                       ldb,
+                                       info,
+                                       policy,
+                                       buffer);
+
+        if(m < 0 || nrhs < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nrhs < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nrhs >= 0 && nnz >= 0");
+        }
+
+        // Test rocsparse_csrsm_zero_pivot
+        rocsparse_int zero_pivot;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_zero_pivot(handle, descr, info, &zero_pivot));
+
+        // Zero pivot should be -1
+        rocsparse_int res = -1;
+        unit_check_general(1, 1, 1, &res, &zero_pivot);
+
+        // Test rocsparse_csrsm_clear
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_clear(handle, descr, info));
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(argus.laplacian)
+    {
+        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        nnz   = hcsr_row_ptr[m];
+    }
+    else
+    {
+        std::vector<rocsparse_int> hcoo_row_ind;
+
+        if(filename != "")
+        {
+            if(read_mtx_matrix(
+                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base) !=
+               0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // B is column-major m x nrhs, or row-major if transposed
+    rocsparse_int ldb        = (transB == rocsparse_operation_none) ? m : nrhs;
+    rocsparse_int ncol_B     = (transB == rocsparse_operation_none) ? nrhs : m;
+    rocsparse_int row_stride = (transB == rocsparse_operation_none) ? 1 : ldb;
+    rocsparse_int rhs_stride = (transB == rocsparse_operation_none) ? ldb : 1;
+
+    std::vector<T> hB(ldb * ncol_B);
+    std::vector<T> hB_1(ldb * ncol_B);
+    std::vector<T> hB_2(ldb * ncol_B);
+    std::vector<T> hB_gold(ldb * ncol_B);
+
+    rocsparse_init<T>(hB, 1, ldb * ncol_B);
+
+    // Allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dB_1_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * ldb * ncol_B), device_free};
+    auto dB_2_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * ldb * ncol_B), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_position_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int)), device_free};
+
+    rocsparse_int* dptr       = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol       = (rocsparse_int*)dcol_managed.get();
+    T* dval                   = (T*)dval_managed.get();
+    T* dB_1                   = (T*)dB_1_managed.get();
+    T* dB_2                   = (T*)dB_2_managed.get();
+    T* d_alpha                = (T*)d_alpha_managed.get();
+    rocsparse_int* d_position = (rocsparse_int*)d_position_managed.get();
+
+    if(!dval || !dptr || !dcol || !dB_1 || !dB_2 || !d_alpha || !d_position)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !dB_1 || "
+                                        "!dB_2 || !d_alpha || !d_position");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB_1, hB.data(), sizeof(T) * ldb * ncol_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // Obtain csrsm buffer size
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_buffer_size(handle,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      nrhs,
+                                                      nnz,
+                                                      &h_alpha,
+                                                      descr,
+                                                      dval,
+                                                      dptr,
+                                                      dcol,
+                                                      dB_1,
+                                                      ldb,
+                                                      info,
+                                                      policy,
+                                                      &size));
+
+    // Allocate buffer on the device
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    // csrsm analysis
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_analysis(handle,
+                                                   transA,
+                                                   transB,
+                                                   m,
+                                                   nrhs,
+                                                   nnz,
+                                                   &h_alpha,
+                                                   descr,
+                                                   dval,
+                                                   dptr,
+                                                   dcol,
+                                                   dB_1,
+                                                   ldb,
+                                                   info,
+                                                   rocsparse_analysis_policy_reuse,
+                                                   policy,
+                                                   dbuffer));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIP_ERROR(
+            hipMemcpy(dB_2, hB.data(), sizeof(T) * ldb * ncol_B, hipMemcpyHostToDevice));
+
+        // ROCSPARSE pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_solve(handle,
+                                                    transA,
+                                                    transB,
+                                                    m,
+                                                    nrhs,
+                                                    nnz,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dval,
+                                                    dptr,
+                                                    dcol,
+                                                    dB_1,
+                                                    ldb,
+                                                    info,
+                                                    policy,
+                                                    dbuffer));
+
+        rocsparse_int hposition_1;
+        rocsparse_status pivot_status_1;
+        pivot_status_1 = rocsparse_csrsm_zero_pivot(handle, descr, info, &hposition_1);
+
+        // ROCSPARSE pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_solve(handle,
+                                                    transA,
+                                                    transB,
+                                                    m,
+                                                    nrhs,
+                                                    nnz,
+                                                    d_alpha,
+                                                    descr,
+                                                    dval,
+                                                    dptr,
+                                                    dcol,
+                                                    dB_2,
+                                                    ldb,
+                                                    info,
+                                                    policy,
+                                                    dbuffer));
+
+        rocsparse_status pivot_status_2;
+        pivot_status_2 = rocsparse_csrsm_zero_pivot(handle, descr, info, d_position);
+
+        // Copy output from device to CPU
+        rocsparse_int hposition_2;
+        CHECK_HIP_ERROR(
+            hipMemcpy(hB_1.data(), dB_1, sizeof(T) * ldb * ncol_B, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hB_2.data(), dB_2, sizeof(T) * ldb * ncol_B, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hposition_2, d_position, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Host csrsm, solve each right-hand side separately. The device accumulates
+        // each right-hand side sequentially, which equals a wavefront size of 1.
+        double cpu_time_used = get_time_us();
+
+        std::vector<T> hx(m);
+        std::vector<T> hy(m);
+
+        rocsparse_int position_gold = -1;
+        for(rocsparse_int j = 0; j < nrhs; ++j)
+        {
+            for(rocsparse_int i = 0; i < m; ++i)
+            {
+                hx[i] = hB[i * row_stride + j * rhs_stride];
+            }
+
+            if(fill_mode == rocsparse_fill_mode_lower)
+            {
+                position_gold = lsolve(m,
+                                       hcsr_row_ptr.data(),
+                                       hcsr_col_ind.data(),
+                                       hcsr_val.data(),
+                                       h_alpha,
+                                       hx.data(),
+                                       hy.data(),
+                                       idx_base,
+                                       diag_type,
+                                       1);
+            }
+            else
+            {
+                position_gold = usolve(m,
+                                       hcsr_row_ptr.data(),
+                                       hcsr_col_ind.data(),
+                                       hcsr_val.data(),
+                                       h_alpha,
+                                       hx.data(),
+                                       hy.data(),
+                                       idx_base,
+                                       diag_type,
+                                       1);
+            }
+
+            for(rocsparse_int i = 0; i < m; ++i)
+            {
+                hB_gold[i * row_stride + j * rhs_stride] = hy[i];
+            }
+        }
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+
+        unit_check_general(1, 1, 1, &position_gold, &hposition_1);
+        unit_check_general(1, 1, 1, &position_gold, &hposition_2);
+
+        if(hposition_1 != -1)
+        {
+            verify_rocsparse_status_zero_pivot(pivot_status_1,
+                                               "expected rocsparse_status_zero_pivot");
+            return rocsparse_status_success;
+        }
+
+        if(hposition_2 != -1)
+        {
+            verify_rocsparse_status_zero_pivot(pivot_status_2,
+                                               "expected rocsparse_status_zero_pivot");
+            return rocsparse_status_success;
+        }
+
+        if(transB == rocsparse_operation_none)
+        {
+            unit_check_near(m, nrhs, ldb, hB_gold.data(), hB_1.data());
+            unit_check_near(m, nrhs, ldb, hB_gold.data(), hB_2.data());
+        }
+        else
+        {
+            unit_check_near(nrhs, m, ldb, hB_gold.data(), hB_1.data());
+            unit_check_near(nrhs, m, ldb, hB_gold.data(), hB_2.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csrsm_solve(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  nrhs,
+                                  nnz,
+                                  &h_alpha,
+                                  descr,
+                                  dval,
+                                  dptr,
+                                  dcol,
+                                  dB_1,
+                                  ldb,
+                                  info,
+                                  policy,
+                                  dbuffer);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csrsm_solve(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  nrhs,
+                                  nnz,
+                                  &h_alpha,
+                                  descr,
+                                  dval,
+                                  dptr,
+                                  dcol,
+                                  dB_1,
+                                  ldb,
+                                  info,
+                                  policy,
+                                  dbuffer);
+        }
+
+        // Convert to miliseconds per call
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        // GFlops
+        size_t flops = 2 * nnz;
+
+        if(h_alpha != 1.0)
+        {
+            flops += m;
+        }
+
+        if(diag_type == rocsparse_diag_type_non_unit)
+        {
+            flops += m;
+        }
+
+        flops *= nrhs;
+
+        double gpu_gflops = flops / gpu_time_used / 1e6;
+
+        // Bandwidth
+        size_t int_data  = (m + 1 + nnz) * sizeof(rocsparse_int);
+        size_t flt_data  = (nnz + 2 * m * nrhs) * sizeof(T);
+        double bandwidth = (int_data + flt_data) / gpu_time_used / 1e6;
+
+        printf("m\t\tnrhs\tnnz\t\talpha\tGFlops\tGB/s\tmsec\n");
+        printf("%8d\t%4d\t%9d\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\n",
+               m,
+               nrhs,
+               nnz,
+               h_alpha,
+               gpu_gflops,
+               bandwidth,
+               gpu_time_used);
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_clear(handle, descr, info));
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRSM_HPP
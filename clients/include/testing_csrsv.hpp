@@ -404,6 +404,40 @@ void testing_csrsv_bad_arg(void)
                                        dbuffer);
         verify_rocsparse_status_invalid_handle(status);
     }
+    // testing for invalid solve policy
+    {
+        rocsparse_solve_policy solve_invalid = (rocsparse_solve_policy)3;
+
+        status = rocsparse_csrsv_analysis(handle,
+                                          transA,
+                                          m,
+                                          nnz,
+                                          descr,
+                                          dval,
+                                          dptr,
+                                          dcol,
+                                          info,
+                                          analysis,
+                                          solve_invalid,
+                                          dbuffer);
+        verify_rocsparse_status_invalid_value(status, "Error: solve policy is invalid");
+
+        status = rocsparse_csrsv_solve(handle,
+                                       transA,
+                                       m,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       info,
+                                       dx,
+                                       dy,
+                                       solve_invalid,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_value(status, "Error: solve policy is invalid");
+    }
 
     // testing rocsparse_csrsv_zero_pivot
     rocsparse_int position;
@@ -465,6 +499,7 @@ rocsparse_status testing_csrsv(Arguments argus)
     rocsparse_operation trans     = argus.transA;
     rocsparse_diag_type diag_type = argus.diag_type;
     rocsparse_fill_mode fill_mode = argus.fill_mode;
+    rocsparse_solve_policy policy = argus.solve;
     T h_alpha                     = argus.alpha;
     std::string binfile           = "";
     std::string filename          = "";
@@ -562,7 +597,7 @@ rocsparse_status testing_csrsv(Arguments argus)
                                           dcol,
                                           info,
                                           rocsparse_analysis_policy_reuse,
-                                          rocsparse_solve_policy_auto,
+                                          policy,
                                           buffer);
 
         if(m < 0 || nnz < 0)
@@ -587,7 +622,7 @@ rocsparse_status testing_csrsv(Arguments argus)
                                        info,
                                        dx,
                                        dy,
-                                       rocsparse_solve_policy_auto,
+                                       policy,
                                        buffer);
 
         if(m < 0 || nnz < 0)
@@ -740,7 +775,7 @@ rocsparse_status testing_csrsv(Arguments argus)
                                                    dcol,
                                                    info,
                                                    rocsparse_analysis_policy_reuse,
-                                                   rocsparse_solve_policy_auto,
+                                                   policy,
                                                    dbuffer));
 
     if(argus.unit_check)
@@ -761,7 +796,7 @@ rocsparse_status testing_csrsv(Arguments argus)
                                                     info,
                                                     dx,
                                                     dy_1,
-                                                    rocsparse_solve_policy_auto,
+                                                    policy,
                                                     dbuffer));
 
         rocsparse_int hposition_1;
@@ -782,7 +817,7 @@ rocsparse_status testing_csrsv(Arguments argus)
                                                     info,
                                                     dx,
                                                     dy_2,
-                                                    rocsparse_solve_policy_auto,
+                                                    policy,
                                                     dbuffer));
 
         rocsparse_status pivot_status_2;
@@ -801,13 +836,48 @@ rocsparse_status testing_csrsv(Arguments argus)
 
         double cpu_time_used = get_time_us();
 
+        // The transpose of a lower (upper) triangular matrix is upper (lower) triangular
+        std::vector<rocsparse_int> hcsr_row_ptr_T;
+        std::vector<rocsparse_int> hcsr_col_ind_T;
+        std::vector<T> hcsr_val_T;
+
+        if(trans != rocsparse_operation_none)
+        {
+            csr_transpose(m,
+                          n,
+                          hcsr_row_ptr,
+                          hcsr_col_ind,
+                          hcsr_val,
+                          hcsr_row_ptr_T,
+                          hcsr_col_ind_T,
+                          hcsr_val_T,
+                          idx_base);
+        }
+
+        if(trans == rocsparse_operation_conjugate_transpose)
+        {
+            for(size_t i = 0; i < hcsr_val_T.size(); ++i)
+            {
+                hcsr_val_T[i] = rocsparse_conj(hcsr_val_T[i]);
+            }
+        }
+
+        const std::vector<rocsparse_int>& hptr =
+            (trans == rocsparse_operation_none) ? hcsr_row_ptr : hcsr_row_ptr_T;
+        const std::vector<rocsparse_int>& hcol =
+            (trans == rocsparse_operation_none) ? hcsr_col_ind : hcsr_col_ind_T;
+        const std::vector<T>& hval = (trans == rocsparse_operation_none) ? hcsr_val : hcsr_val_T;
+
+        bool lower =
+            (fill_mode == rocsparse_fill_mode_lower) == (trans == rocsparse_operation_none);
+
         rocsparse_int position_gold;
-        if(fill_mode == rocsparse_fill_mode_lower)
+        if(lower)
         {
             position_gold = lsolve(m,
-                                   hcsr_row_ptr.data(),
-                                   hcsr_col_ind.data(),
-                                   hcsr_val.data(),
+                                   hptr.data(),
+                                   hcol.data(),
+                                   hval.data(),
                                    h_alpha,
                                    hx.data(),
                                    hy_gold.data(),
@@ -818,9 +888,9 @@ rocsparse_status testing_csrsv(Arguments argus)
         else
         {
             position_gold = usolve(m,
-                                   hcsr_row_ptr.data(),
-                                   hcsr_col_ind.data(),
-                                   hcsr_val.data(),
+                                   hptr.data(),
+                                   hcol.data(),
+                                   hval.data(),
                                    h_alpha,
                                    hx.data(),
                                    hy_gold.data(),
@@ -872,7 +942,7 @@ rocsparse_status testing_csrsv(Arguments argus)
                                   info,
                                   dx,
                                   dy_1,
-                                  rocsparse_solve_policy_auto,
+                                  policy,
                                   dbuffer);
         }
 
@@ -892,7 +962,7 @@ rocsparse_status testing_csrsv(Arguments argus)
                                   info,
                                   dx,
                                   dy_1,
-                                  rocsparse_solve_policy_auto,
+                                  policy,
                                   dbuffer);
         }
 
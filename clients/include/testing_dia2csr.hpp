@@ -0,0 +1,787 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_DIA2CSR_HPP
+#define TESTING_DIA2CSR_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <rocsparse.h>
+#include <algorithm>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_dia2csr_bad_arg(void)
+{
+    rocsparse_int m         = 100;
+    rocsparse_int n         = 100;
+    rocsparse_int ndiag     = 10;
+    rocsparse_int safe_size = 100;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_csr_descr(new descr_struct);
+    rocsparse_mat_descr csr_descr = unique_ptr_csr_descr->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_dia_descr(new descr_struct);
+    rocsparse_mat_descr dia_descr = unique_ptr_dia_descr->descr;
+
+    auto dia_offset_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dia_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto csr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+
+    rocsparse_int* dia_offset  = (rocsparse_int*)dia_offset_managed.get();
+    T* dia_val                 = (T*)dia_val_managed.get();
+    rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+
+    if(!dia_offset || !dia_val || !csr_row_ptr)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // DIA to CSR conversion is a two step process - test both functions for bad arguments
+
+    // Step 1: Determine number of non-zero elements of CSR storage format
+    rocsparse_int csr_nnz;
+
+    // Testing for (dia_val == nullptr)
+    {
+        T* dia_val_null = nullptr;
+
+        status = rocsparse_dia2csr_nnz(handle,
+                                       m,
+                                       n,
+                                       dia_descr,
+                                       ndiag,
+                                       dia_val_null,
+                                       dia_offset,
+                                       csr_descr,
+                                       csr_row_ptr,
+                                       &csr_nnz);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dia_val is nullptr");
+    }
+
+    // Testing for (dia_offset == nullptr)
+    {
+        rocsparse_int* dia_offset_null = nullptr;
+
+        status = rocsparse_dia2csr_nnz(handle,
+                                       m,
+                                       n,
+                                       dia_descr,
+                                       ndiag,
+                                       dia_val,
+                                       dia_offset_null,
+                                       csr_descr,
+                                       csr_row_ptr,
+                                       &csr_nnz);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dia_offset is nullptr");
+    }
+
+    // Testing for (csr_row_ptr == nullptr)
+    {
+        rocsparse_int* csr_row_ptr_null = nullptr;
+
+        status = rocsparse_dia2csr_nnz(handle,
+                                       m,
+                                       n,
+                                       dia_descr,
+                                       ndiag,
+                                       dia_val,
+                                       dia_offset,
+                                       csr_descr,
+                                       csr_row_ptr_null,
+                                       &csr_nnz);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+
+    // Testing for (csr_nnz == nullptr)
+    {
+        rocsparse_int* csr_nnz_null = nullptr;
+
+        status = rocsparse_dia2csr_nnz(handle,
+                                       m,
+                                       n,
+                                       dia_descr,
+                                       ndiag,
+                                       dia_val,
+                                       dia_offset,
+                                       csr_descr,
+                                       csr_row_ptr,
+                                       csr_nnz_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_nnz is nullptr");
+    }
+
+    // Testing for (dia_descr == nullptr)
+    {
+        rocsparse_mat_descr dia_descr_null = nullptr;
+
+        status = rocsparse_dia2csr_nnz(handle,
+                                       m,
+                                       n,
+                                       dia_descr_null,
+                                       ndiag,
+                                       dia_val,
+                                       dia_offset,
+                                       csr_descr,
+                                       csr_row_ptr,
+                                       &csr_nnz);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dia_descr is nullptr");
+    }
+
+    // Testing for (csr_descr == nullptr)
+    {
+        rocsparse_mat_descr csr_descr_null = nullptr;
+
+        status = rocsparse_dia2csr_nnz(handle,
+                                       m,
+                                       n,
+                                       dia_descr,
+                                       ndiag,
+                                       dia_val,
+                                       dia_offset,
+                                       csr_descr_null,
+                                       csr_row_ptr,
+                                       &csr_nnz);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_descr is nullptr");
+    }
+
+    // Testing for (handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_dia2csr_nnz(handle_null,
+                                       m,
+                                       n,
+                                       dia_descr,
+                                       ndiag,
+                                       dia_val,
+                                       dia_offset,
+                                       csr_descr,
+                                       csr_row_ptr,
+                                       &csr_nnz);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // Allocate memory for CSR storage format
+    auto csr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto csr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* csr_col_ind = (rocsparse_int*)csr_col_ind_managed.get();
+    T* csr_val                 = (T*)csr_val_managed.get();
+
+    if(!csr_col_ind || !csr_val)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Step 2: Perform the actual conversion
+
+    // Testing for (dia_val == nullptr)
+    {
+        T* dia_val_null = nullptr;
+
+        status = rocsparse_dia2csr(handle,
+                                   m,
+                                   n,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val_null,
+                                   dia_offset,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dia_val is nullptr");
+    }
+
+    // Testing for (dia_offset == nullptr)
+    {
+        rocsparse_int* dia_offset_null = nullptr;
+
+        status = rocsparse_dia2csr(handle,
+                                   m,
+                                   n,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset_null,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dia_offset is nullptr");
+    }
+
+    // Testing for (csr_row_ptr == nullptr)
+    {
+        rocsparse_int* csr_row_ptr_null = nullptr;
+
+        status = rocsparse_dia2csr(handle,
+                                   m,
+                                   n,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr_null,
+                                   csr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+
+    // Testing for (csr_col_ind == nullptr)
+    {
+        rocsparse_int* csr_col_ind_null = nullptr;
+
+        status = rocsparse_dia2csr(handle,
+                                   m,
+                                   n,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
+    }
+
+    // Testing for (csr_val == nullptr)
+    {
+        T* csr_val_null = nullptr;
+
+        status = rocsparse_dia2csr(handle,
+                                   m,
+                                   n,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset,
+                                   csr_descr,
+                                   csr_val_null,
+                                   csr_row_ptr,
+                                   csr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_val is nullptr");
+    }
+
+    // Testing for (dia_descr == nullptr)
+    {
+        rocsparse_mat_descr dia_descr_null = nullptr;
+
+        status = rocsparse_dia2csr(handle,
+                                   m,
+                                   n,
+                                   dia_descr_null,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dia_descr is nullptr");
+    }
+
+    // Testing for (csr_descr == nullptr)
+    {
+        rocsparse_mat_descr csr_descr_null = nullptr;
+
+        status = rocsparse_dia2csr(handle,
+                                   m,
+                                   n,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset,
+                                   csr_descr_null,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_descr is nullptr");
+    }
+
+    // Testing for (handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_dia2csr(handle_null,
+                                   m,
+                                   n,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_dia2csr(Arguments argus)
+{
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    rocsparse_int safe_size       = 100;
+    rocsparse_index_base dia_base = argus.idx_base;
+    rocsparse_index_base csr_base = argus.idx_base2;
+    std::string binfile           = "";
+    std::string filename          = "";
+    rocsparse_status status;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && n == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m = n = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    // A laplacian determines its own size
+    if(argus.laplacian > 0)
+    {
+        m = n = argus.laplacian * argus.laplacian;
+    }
+
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_dia_descr(new descr_struct);
+    rocsparse_mat_descr dia_descr = unique_ptr_dia_descr->descr;
+
+    // Set DIA matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(dia_descr, dia_base));
+
+    std::unique_ptr<descr_struct> unique_ptr_csr_descr(new descr_struct);
+    rocsparse_mat_descr csr_descr = unique_ptr_csr_descr->descr;
+
+    // Set CSR matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(csr_descr, csr_base));
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0)
+    {
+        auto dia_offset_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dia_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto csr_row_ptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+
+        rocsparse_int* dia_offset  = (rocsparse_int*)dia_offset_managed.get();
+        T* dia_val                 = (T*)dia_val_managed.get();
+        rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+
+        if(!dia_offset || !dia_val || !csr_row_ptr)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dia_offset || !dia_val || !csr_row_ptr");
+            return rocsparse_status_memory_error;
+        }
+
+        rocsparse_int ndiag = 0;
+
+        // Step 1 - obtain CSR nnz
+        rocsparse_int csr_nnz;
+        status = rocsparse_dia2csr_nnz(
+            handle, m, n, dia_descr, ndiag, dia_val, dia_offset, csr_descr, csr_row_ptr, &csr_nnz);
+
+        if(m < 0 || n < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0");
+        }
+
+        // Step 2 - perform actual conversion
+        auto csr_col_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto csr_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* csr_col_ind = (rocsparse_int*)csr_col_ind_managed.get();
+        T* csr_val                 = (T*)csr_val_managed.get();
+
+        if(!csr_col_ind || !csr_val)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!csr_col_ind || !csr_val");
+            return rocsparse_status_memory_error;
+        }
+
+        status = rocsparse_dia2csr(handle,
+                                   m,
+                                   n,
+                                   dia_descr,
+                                   ndiag,
+                                   dia_val,
+                                   dia_offset,
+                                   csr_descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind);
+
+        if(m < 0 || n < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // For testing, assemble a CSR matrix and convert it to DIA first (on host)
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Sample initial COO matrix on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        if(read_bin_matrix(binfile.c_str(),
+                           m,
+                           n,
+                           nnz,
+                           hcsr_row_ptr,
+                           hcsr_col_ind,
+                           hcsr_val,
+                           rocsparse_index_base_zero) != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m = n = gen_2d_laplacian(
+            argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, rocsparse_index_base_zero);
+        nnz = hcsr_row_ptr[m];
+    }
+    else
+    {
+        if(filename != "")
+        {
+            if(read_mtx_matrix(filename.c_str(),
+                               m,
+                               n,
+                               nnz,
+                               hcoo_row_ind,
+                               hcsr_col_ind,
+                               hcsr_val,
+                               rocsparse_index_base_zero) != 0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(
+                m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, rocsparse_index_base_zero);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1];
+        }
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Convert CSR to DIA
+    std::vector<rocsparse_int> hdia_offset;
+    std::vector<T> hdia_val;
+
+    rocsparse_int ndiag = csr_to_dia(m,
+                                     n,
+                                     hcsr_row_ptr,
+                                     hcsr_col_ind,
+                                     hcsr_val,
+                                     rocsparse_index_base_zero,
+                                     hdia_offset,
+                                     hdia_val);
+
+    // Host dia2csr conversion
+    std::vector<rocsparse_int> hcsr_row_ptr_gold;
+    std::vector<rocsparse_int> hcsr_col_ind_gold;
+    std::vector<T> hcsr_val_gold;
+
+    rocsparse_int csr_nnz_gold = dia_to_csr(m,
+                                            n,
+                                            ndiag,
+                                            hdia_offset,
+                                            hdia_val,
+                                            hcsr_row_ptr_gold,
+                                            hcsr_col_ind_gold,
+                                            hcsr_val_gold,
+                                            csr_base);
+
+    // Allocate memory on the device
+    auto ddia_offset_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * ndiag), device_free};
+    auto ddia_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m * ndiag), device_free};
+    auto dcsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcsr_nnz_managed = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int)), device_free};
+
+    rocsparse_int* ddia_offset  = (rocsparse_int*)ddia_offset_managed.get();
+    T* ddia_val                 = (T*)ddia_val_managed.get();
+    rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+    rocsparse_int* dcsr_nnz     = (rocsparse_int*)dcsr_nnz_managed.get();
+
+    if(!ddia_offset || !ddia_val || !dcsr_row_ptr || !dcsr_nnz)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!ddia_offset || !ddia_val || !dcsr_row_ptr || !dcsr_nnz");
+        return rocsparse_status_memory_error;
+    }
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        ddia_offset, hdia_offset.data(), sizeof(rocsparse_int) * ndiag, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(ddia_val, hdia_val.data(), sizeof(T) * m * ndiag, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        rocsparse_int csr_nnz;
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_dia2csr_nnz(handle,
+                                                    m,
+                                                    n,
+                                                    dia_descr,
+                                                    ndiag,
+                                                    ddia_val,
+                                                    ddia_offset,
+                                                    csr_descr,
+                                                    dcsr_row_ptr,
+                                                    &csr_nnz));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_dia2csr_nnz(handle,
+                                                    m,
+                                                    n,
+                                                    dia_descr,
+                                                    ndiag,
+                                                    ddia_val,
+                                                    ddia_offset,
+                                                    csr_descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_nnz));
+
+        rocsparse_int csr_nnz_device;
+        CHECK_HIP_ERROR(
+            hipMemcpy(&csr_nnz_device, dcsr_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Check if CSR nnz does match
+        unit_check_general(1, 1, 1, &csr_nnz_gold, &csr_nnz);
+        unit_check_general(1, 1, 1, &csr_nnz_gold, &csr_nnz_device);
+
+        // Allocate CSR column and value arrays
+        auto dcsr_col_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * csr_nnz), device_free};
+        auto dcsr_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * csr_nnz), device_free};
+
+        rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+        T* dcsr_val                 = (T*)dcsr_val_managed.get();
+
+        if(!dcsr_col_ind || !dcsr_val)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dcsr_col_ind || !dcsr_val");
+            return rocsparse_status_memory_error;
+        }
+
+        // Perform actual CSR conversion
+        CHECK_ROCSPARSE_ERROR(rocsparse_dia2csr(handle,
+                                                m,
+                                                n,
+                                                dia_descr,
+                                                ndiag,
+                                                ddia_val,
+                                                ddia_offset,
+                                                csr_descr,
+                                                dcsr_val,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind));
+
+        // Copy output from device to host
+        std::vector<rocsparse_int> hcsr_row_ptr_dev(m + 1);
+        std::vector<rocsparse_int> hcsr_col_ind_dev(csr_nnz);
+        std::vector<T> hcsr_val_dev(csr_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_dev.data(),
+                                  dcsr_row_ptr,
+                                  sizeof(rocsparse_int) * (m + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_dev.data(),
+                                  dcsr_col_ind,
+                                  sizeof(rocsparse_int) * csr_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_dev.data(), dcsr_val, sizeof(T) * csr_nnz, hipMemcpyDeviceToHost));
+
+        // Unit check
+        unit_check_general(1, m + 1, 1, hcsr_row_ptr_gold.data(), hcsr_row_ptr_dev.data());
+        unit_check_general(1, csr_nnz, 1, hcsr_col_ind_gold.data(), hcsr_col_ind_dev.data());
+        unit_check_general(1, csr_nnz, 1, hcsr_val_gold.data(), hcsr_val_dev.data());
+    }
+
+    if(argus.timing)
+    {
+        rocsparse_int number_cold_calls = 2;
+        rocsparse_int number_hot_calls  = argus.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_int csr_nnz;
+
+        for(rocsparse_int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            rocsparse_dia2csr_nnz(handle,
+                                  m,
+                                  n,
+                                  dia_descr,
+                                  ndiag,
+                                  ddia_val,
+                                  ddia_offset,
+                                  csr_descr,
+                                  dcsr_row_ptr,
+                                  &csr_nnz);
+
+            auto dcsr_col_ind_managed =
+                rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * csr_nnz), device_free};
+            auto dcsr_val_managed =
+                rocsparse_unique_ptr{device_malloc(sizeof(T) * csr_nnz), device_free};
+
+            rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+            T* dcsr_val                 = (T*)dcsr_val_managed.get();
+
+            rocsparse_dia2csr(handle,
+                              m,
+                              n,
+                              dia_descr,
+                              ndiag,
+                              ddia_val,
+                              ddia_offset,
+                              csr_descr,
+                              dcsr_val,
+                              dcsr_row_ptr,
+                              dcsr_col_ind);
+        }
+
+        double gpu_time_used = get_time_us();
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_dia2csr_nnz(handle,
+                                  m,
+                                  n,
+                                  dia_descr,
+                                  ndiag,
+                                  ddia_val,
+                                  ddia_offset,
+                                  csr_descr,
+                                  dcsr_row_ptr,
+                                  &csr_nnz);
+
+            auto dcsr_col_ind_managed =
+                rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * csr_nnz), device_free};
+            auto dcsr_val_managed =
+                rocsparse_unique_ptr{device_malloc(sizeof(T) * csr_nnz), device_free};
+
+            rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+            T* dcsr_val                 = (T*)dcsr_val_managed.get();
+
+            rocsparse_dia2csr(handle,
+                              m,
+                              n,
+                              dia_descr,
+                              ndiag,
+                              ddia_val,
+                              ddia_offset,
+                              csr_descr,
+                              dcsr_val,
+                              dcsr_row_ptr,
+                              dcsr_col_ind);
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        printf("m\t\tn\t\tnnz\t\tndiag\t\tmsec\n");
+        printf("%8d\t%8d\t%9d\t%8d\t%0.2lf\n", m, n, csr_nnz_gold, ndiag, gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_DIA2CSR_HPP
@@ -0,0 +1,482 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_EXEC_MODE_HPP
+#define TESTING_EXEC_MODE_HPP
+
+#include "hip_sync_counter.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_exec_mode_bad_arg(void)
+{
+    rocsparse_int m         = 100;
+    rocsparse_int safe_size = 100;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<hyb_struct> unique_ptr_hyb(new hyb_struct);
+    rocsparse_hyb_mat hyb = unique_ptr_hyb->hyb;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_info(new mat_info_struct);
+    rocsparse_mat_info info = unique_ptr_info->info;
+
+    auto dind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* dind = (rocsparse_int*)dind_managed.get();
+    T* dval             = (T*)dval_managed.get();
+
+    if(!dind || !dval)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dind || !dval");
+        return;
+    }
+
+    // Testing rocsparse_set_exec_mode and rocsparse_get_exec_mode
+    {
+        rocsparse_exec_mode mode;
+
+        status = rocsparse_set_exec_mode(nullptr, rocsparse_exec_mode_async);
+        verify_rocsparse_status_invalid_handle(status);
+
+        status = rocsparse_set_exec_mode(handle, (rocsparse_exec_mode)2);
+        verify_rocsparse_status_invalid_value(status, "Error: exec_mode is invalid");
+
+        status = rocsparse_get_exec_mode(nullptr, &mode);
+        verify_rocsparse_status_invalid_handle(status);
+
+        status = rocsparse_get_exec_mode(handle, nullptr);
+        verify_rocsparse_status_invalid_pointer(status, "Error: exec_mode is nullptr");
+
+        // Default is sync
+        status = rocsparse_get_exec_mode(handle, &mode);
+        verify_rocsparse_status_success(status, "Success");
+
+        rocsparse_int mode_gold = rocsparse_exec_mode_sync;
+        rocsparse_int mode_int  = mode;
+        unit_check_general(1, 1, 1, &mode_gold, &mode_int);
+    }
+
+    // Testing rocsparse_set_hyb_mat_nnz_bound
+    {
+        status = rocsparse_set_hyb_mat_nnz_bound(nullptr, safe_size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: hyb is nullptr");
+
+        status = rocsparse_set_hyb_mat_nnz_bound(hyb, -1);
+        verify_rocsparse_status_invalid_size(status, "Error: nnz_bound is invalid");
+    }
+
+    status = rocsparse_set_exec_mode(handle, rocsparse_exec_mode_async);
+    verify_rocsparse_status_success(status, "Success");
+
+    // Testing rocsparse_doti with host result
+    {
+        T result;
+
+        status = rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host);
+        verify_rocsparse_status_success(status, "Success");
+
+        status = rocsparse_doti(handle, 0, dval, dind, dval, &result, rocsparse_index_base_zero);
+        verify_rocsparse_status_invalid_value(status, "Error: host result in async mode");
+    }
+
+    // Testing rocsparse_csr2hyb
+    {
+        status = rocsparse_csr2hyb(
+            handle, m, m, descr, dval, dind, dind, hyb, 0, rocsparse_hyb_partition_auto);
+        verify_rocsparse_status_invalid_value(status, "Error: nnz bound not set");
+
+        status = rocsparse_set_hyb_mat_nnz_bound(hyb, safe_size);
+        verify_rocsparse_status_success(status, "Success");
+
+        status = rocsparse_csr2hyb(
+            handle, m, m, descr, dval, dind, dind, hyb, 0, rocsparse_hyb_partition_max);
+        verify_rocsparse_status_invalid_value(status, "Error: max partition in async mode");
+    }
+
+    // Testing rocsparse_csrmv_analysis with adaptive algorithm
+    {
+        status = rocsparse_csrmv_analysis(
+            handle, rocsparse_operation_none, m, m, safe_size, descr, dval, dind, dind, info);
+        verify_rocsparse_status_invalid_value(status, "Error: adaptive analysis in async mode");
+    }
+
+    // Testing rocsparse_csrilu0_numeric_boost with device boost tolerance and value
+    {
+        status = rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device);
+        verify_rocsparse_status_success(status, "Success");
+
+        status = rocsparse_csrilu0_numeric_boost(handle, info, 1, dval, dval);
+        verify_rocsparse_status_invalid_value(status, "Error: device boost in async mode");
+    }
+}
+
+template <typename T>
+rocsparse_status testing_exec_mode(Arguments argus)
+{
+    rocsparse_index_base idx_base = argus.idx_base;
+    T h_alpha                     = argus.alpha;
+    T h_beta                      = argus.beta;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Triangular solves use the lower part of the matrix
+    std::unique_ptr<descr_struct> test_descr_lower(new descr_struct);
+    rocsparse_mat_descr descr_lower = test_descr_lower->descr;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_lower, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr_lower, rocsparse_fill_mode_lower));
+
+    // One HYB matrix and matrix info per execution mode
+    std::unique_ptr<hyb_struct> test_hyb_1(new hyb_struct);
+    std::unique_ptr<hyb_struct> test_hyb_2(new hyb_struct);
+    std::unique_ptr<mat_info_struct> test_info_1(new mat_info_struct);
+    std::unique_ptr<mat_info_struct> test_info_2(new mat_info_struct);
+
+    rocsparse_hyb_mat hyb_1   = test_hyb_1->hyb;
+    rocsparse_hyb_mat hyb_2   = test_hyb_2->hyb;
+    rocsparse_mat_info info_1 = test_info_1->info;
+    rocsparse_mat_info info_2 = test_info_2->info;
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    rocsparse_int m   = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    rocsparse_int nnz = (m > 0) ? hcsr_row_ptr[m] - idx_base : 0;
+
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    std::vector<T> hx(m);
+    std::vector<T> hy(m);
+
+    rocsparse_init<T>(hx, 1, m);
+    rocsparse_init<T>(hy, 1, m);
+
+    // Allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed     = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_1_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dz_1_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dz_2_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dw_1_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dw_2_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dscal_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T) * 4), device_free};
+    auto dpivot_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * 2), device_free};
+
+    rocsparse_int* dptr   = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol   = (rocsparse_int*)dcol_managed.get();
+    T* dval               = (T*)dval_managed.get();
+    T* dx                 = (T*)dx_managed.get();
+    T* dy_1               = (T*)dy_1_managed.get();
+    T* dy_2               = (T*)dy_2_managed.get();
+    T* dz_1               = (T*)dz_1_managed.get();
+    T* dz_2               = (T*)dz_2_managed.get();
+    T* dw_1               = (T*)dw_1_managed.get();
+    T* dw_2               = (T*)dw_2_managed.get();
+    T* dscal              = (T*)dscal_managed.get();
+    rocsparse_int* dpivot = (rocsparse_int*)dpivot_managed.get();
+
+    if(!dptr || !dcol || !dval || !dx || !dy_1 || !dy_2 || !dz_1 || !dz_2 || !dw_1 || !dw_2 ||
+       !dscal || !dpivot)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr || !dcol || !dval || !dx || !dy_1 || !dy_2 || "
+                                        "!dz_1 || !dz_2 || !dw_1 || !dw_2 || !dscal || !dpivot");
+        return rocsparse_status_memory_error;
+    }
+
+    // alpha, beta, dot product sync, dot product async
+    T* d_alpha = dscal;
+    T* d_beta  = dscal + 1;
+    T* d_dot_1 = dscal + 2;
+    T* d_dot_2 = dscal + 3;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dw_1, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dw_2, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // csrsv buffer, shared by both execution modes
+    size_t size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size(handle,
+                                                      rocsparse_operation_none,
+                                                      m,
+                                                      nnz,
+                                                      descr_lower,
+                                                      dval,
+                                                      dptr,
+                                                      dcol,
+                                                      info_1,
+                                                      &size));
+
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+    void* dbuffer        = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+    // Scalar results, conversion, SpMV and triangular solve in sync mode, using the
+    // default adaptive csrmv algorithm
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_exec_mode(handle, rocsparse_exec_mode_sync));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_doti(handle, nnz, dval, dcol, dx, d_dot_1, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb(
+        handle, m, m, descr, dval, dptr, dcol, hyb_1, 0, rocsparse_hyb_partition_auto));
+    CHECK_ROCSPARSE_ERROR(rocsparse_hybmv(
+        handle, rocsparse_operation_none, d_alpha, descr, hyb_1, dx, d_beta, dy_1));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+        handle, rocsparse_operation_none, m, m, nnz, descr, dval, dptr, dcol, info_1));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(handle,
+                                          rocsparse_operation_none,
+                                          m,
+                                          m,
+                                          nnz,
+                                          d_alpha,
+                                          descr,
+                                          dval,
+                                          dptr,
+                                          dcol,
+                                          info_1,
+                                          dx,
+                                          d_beta,
+                                          dw_1));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                   rocsparse_operation_none,
+                                                   m,
+                                                   nnz,
+                                                   descr_lower,
+                                                   dval,
+                                                   dptr,
+                                                   dcol,
+                                                   info_1,
+                                                   rocsparse_analysis_policy_force,
+                                                   rocsparse_solve_policy_auto,
+                                                   dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve(handle,
+                                                rocsparse_operation_none,
+                                                m,
+                                                nnz,
+                                                d_alpha,
+                                                descr_lower,
+                                                dval,
+                                                dptr,
+                                                dcol,
+                                                info_1,
+                                                dx,
+                                                dz_1,
+                                                rocsparse_solve_policy_auto,
+                                                dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_zero_pivot(handle, descr_lower, info_1, dpivot));
+
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    // Same sequence in async mode, the COO part is padded since the bound exceeds nnz
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_exec_mode(handle, rocsparse_exec_mode_async));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_hyb_mat_nnz_bound(hyb_2, nnz + m));
+
+    // The row blocks of the adaptive algorithm require synchronization, the merge path
+    // partition is computed on the device
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_info_csrmv_alg(info_2, rocsparse_csrmv_alg_merge));
+
+    // Warm up the memory pool with the HYB matrix, the analysis data and the temporary
+    // storage of the async run, the SpMV result is overwritten by the triangular solve.
+    // Repeating the conversion and the analyses returns the arrays to the pool and
+    // reuses them without device allocations.
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb(
+        handle, m, m, descr, dval, dptr, dcol, hyb_2, 0, rocsparse_hyb_partition_auto));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+        handle, rocsparse_operation_none, m, m, nnz, descr, dval, dptr, dcol, info_2));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(handle,
+                                          rocsparse_operation_none,
+                                          m,
+                                          m,
+                                          nnz,
+                                          d_alpha,
+                                          descr,
+                                          dval,
+                                          dptr,
+                                          dcol,
+                                          info_2,
+                                          dx,
+                                          d_beta,
+                                          dz_2));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                   rocsparse_operation_none,
+                                                   m,
+                                                   nnz,
+                                                   descr_lower,
+                                                   dval,
+                                                   dptr,
+                                                   dcol,
+                                                   info_2,
+                                                   rocsparse_analysis_policy_force,
+                                                   rocsparse_solve_policy_auto,
+                                                   dbuffer));
+
+    hip_sync_counter_reset();
+    hip_malloc_counter_reset();
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_doti(handle, nnz, dval, dcol, dx, d_dot_2, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb(
+        handle, m, m, descr, dval, dptr, dcol, hyb_2, 0, rocsparse_hyb_partition_auto));
+    CHECK_ROCSPARSE_ERROR(rocsparse_hybmv(
+        handle, rocsparse_operation_none, d_alpha, descr, hyb_2, dx, d_beta, dy_2));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+        handle, rocsparse_operation_none, m, m, nnz, descr, dval, dptr, dcol, info_2));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(handle,
+                                          rocsparse_operation_none,
+                                          m,
+                                          m,
+                                          nnz,
+                                          d_alpha,
+                                          descr,
+                                          dval,
+                                          dptr,
+                                          dcol,
+                                          info_2,
+                                          dx,
+                                          d_beta,
+                                          dw_2));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                   rocsparse_operation_none,
+                                                   m,
+                                                   nnz,
+                                                   descr_lower,
+                                                   dval,
+                                                   dptr,
+                                                   dcol,
+                                                   info_2,
+                                                   rocsparse_analysis_policy_force,
+                                                   rocsparse_solve_policy_auto,
+                                                   dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve(handle,
+                                                rocsparse_operation_none,
+                                                m,
+                                                nnz,
+                                                d_alpha,
+                                                descr_lower,
+                                                dval,
+                                                dptr,
+                                                dcol,
+                                                info_2,
+                                                dx,
+                                                dz_2,
+                                                rocsparse_solve_policy_auto,
+                                                dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_zero_pivot(handle, descr_lower, info_2, dpivot + 1));
+
+    rocsparse_int sync_calls   = hip_sync_counter_get();
+    rocsparse_int malloc_calls = hip_malloc_counter_get();
+
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    // No routine blocks the host or allocates device memory in async mode, temporary
+    // storage and analysis data are served from the memory pool
+    if(hip_sync_counter_available())
+    {
+        rocsparse_int sync_calls_gold   = 0;
+        rocsparse_int malloc_calls_gold = 0;
+        unit_check_general(1, 1, 1, &sync_calls_gold, &sync_calls);
+        unit_check_general(1, 1, 1, &malloc_calls_gold, &malloc_calls);
+    }
+
+    // Both execution modes yield the same results
+    T hdot[2];
+    rocsparse_int hpivot[2];
+    std::vector<T> hy_1(m);
+    std::vector<T> hy_2(m);
+    std::vector<T> hz_1(m);
+    std::vector<T> hz_2(m);
+    std::vector<T> hw_1(m);
+    std::vector<T> hw_2(m);
+
+    CHECK_HIP_ERROR(hipMemcpy(hdot, d_dot_1, sizeof(T) * 2, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hpivot, dpivot, sizeof(rocsparse_int) * 2, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hz_1.data(), dz_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hz_2.data(), dz_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hw_1.data(), dw_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hw_2.data(), dw_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, 1, 1, &hdot[0], &hdot[1]);
+    unit_check_general(1, 1, 1, &hpivot[0], &hpivot[1]);
+    unit_check_near(1, m, 1, hy_1.data(), hy_2.data());
+    unit_check_near(1, m, 1, hz_1.data(), hz_2.data());
+    unit_check_near(1, m, 1, hw_1.data(), hw_2.data());
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_EXEC_MODE_HPP
@@ -45,6 +45,7 @@ struct testhyb
     rocsparse_int m;
     rocsparse_int n;
     rocsparse_hyb_partition partition;
+    rocsparse_int nnz_bound;
     rocsparse_int ell_nnz;
     rocsparse_int ell_width;
     rocsparse_int* ell_col_ind;
@@ -53,6 +54,7 @@ struct testhyb
     rocsparse_int* coo_row_ind;
     rocsparse_int* coo_col_ind;
     void* coo_val;
+    size_t predicted_bytes;
 };
 
 template <typename T>
@@ -30,8 +30,11 @@
 #include <math.h>
 #include <string>
 #include <vector>
+#include <map>
 #include <algorithm>
 #include <sstream>
+#include <limits>
+#include <thread>
 #include <rocsparse.h>
 #include <hip/hip_runtime_api.h>
 
@@ -87,6 +90,50 @@
         return error;                                             \
     }
 
+/* ============================================================================================ */
+/*! \brief  real type of a value type, e.g. the type of its absolute value */
+template <typename T>
+struct real_type
+{
+    typedef T type;
+};
+
+template <>
+struct real_type<rocsparse_float_complex>
+{
+    typedef float type;
+};
+
+template <>
+struct real_type<rocsparse_double_complex>
+{
+    typedef double type;
+};
+
+template <typename T>
+using real_t = typename real_type<T>::type;
+
+/*! \brief  complex conjugate, identity for real types */
+inline float rocsparse_conj(float x)
+{
+    return x;
+}
+
+inline double rocsparse_conj(double x)
+{
+    return x;
+}
+
+inline rocsparse_float_complex rocsparse_conj(rocsparse_float_complex x)
+{
+    return std::conj(x);
+}
+
+inline rocsparse_double_complex rocsparse_conj(rocsparse_double_complex x)
+{
+    return std::conj(x);
+}
+
 /* ============================================================================================ */
 /* generate random number :*/
 
@@ -98,6 +145,19 @@ T random_generator()
     return (T)(rand() % 10 + 1); // generate a integer number between [1, 10]
 };
 
+/*! \brief  generate a random complex number with real and imaginary part in [1, 10]. */
+template <>
+inline rocsparse_float_complex random_generator<rocsparse_float_complex>()
+{
+    return rocsparse_float_complex(rand() % 10 + 1, rand() % 10 + 1);
+};
+
+template <>
+inline rocsparse_double_complex random_generator<rocsparse_double_complex>()
+{
+    return rocsparse_double_complex(rand() % 10 + 1, rand() % 10 + 1);
+};
+
 /* ============================================================================================ */
 /*! \brief  matrix/vector initialization: */
 // for vector x (M=1, N=lengthX);
@@ -456,14 +516,14 @@ rocsparse_int read_mtx_matrix(const char* filename,
 
         rocsparse_int irow;
         rocsparse_int icol;
-        T ival;
+        double ival;
 
         std::istringstream ss(line);
 
         if(!strcmp(data, "pattern"))
         {
             ss >> irow >> icol;
-            ival = static_cast<T>(1);
+            ival = 1.0;
         }
         else
         {
@@ -478,7 +538,7 @@ rocsparse_int read_mtx_matrix(const char* filename,
 
         unsorted_row[idx] = irow;
         unsorted_col[idx] = icol;
-        unsorted_val[idx] = ival;
+        unsorted_val[idx] = static_cast<T>(ival);
 
         ++idx;
 
@@ -491,7 +551,7 @@ rocsparse_int read_mtx_matrix(const char* filename,
 
             unsorted_row[idx] = icol;
             unsorted_col[idx] = irow;
-            unsorted_val[idx] = ival;
+            unsorted_val[idx] = static_cast<T>(ival);
             ++idx;
         }
     }
@@ -600,256 +660,1435 @@ rocsparse_int read_bin_matrix(const char* filename,
 }
 
 /* ============================================================================================ */
-/*! \brief  Compute incomplete LU factorization without fill-ins and no pivoting using CSR
- *  matrix storage format.
- */
+/*! \brief  Extract the lower or upper triangular part, including the diagonal, of a CSR
+ *  matrix in place. Returns the number of non-zero entries of the triangular part. */
 template <typename T>
-rocsparse_int csrilu0(rocsparse_int m,
-                      const rocsparse_int* ptr,
-                      const rocsparse_int* col,
-                      T* val,
-                      rocsparse_index_base idx_base)
+rocsparse_int csr_extract_triangle(rocsparse_int m,
+                                   std::vector<rocsparse_int>& ptr,
+                                   std::vector<rocsparse_int>& col,
+                                   std::vector<T>& val,
+                                   rocsparse_fill_mode fill_mode,
+                                   rocsparse_index_base idx_base)
 {
-    // pointer of upper part of each row
-    std::vector<rocsparse_int> diag_offset(m);
-    std::vector<rocsparse_int> nnz_entries(m, 0);
+    rocsparse_int nnz       = 0;
+    rocsparse_int row_begin = ptr[0] - idx_base;
 
-    // ai = 0 to N loop over all rows
-    for(rocsparse_int ai = 0; ai < m; ++ai)
+    for(rocsparse_int i = 0; i < m; ++i)
     {
-        // ai-th row entries
-        rocsparse_int row_start = ptr[ai] - idx_base;
-        rocsparse_int row_end   = ptr[ai + 1] - idx_base;
-        rocsparse_int j;
+        rocsparse_int row_end = ptr[i + 1] - idx_base;
 
-        // nnz position of ai-th row in val array
-        for(j = row_start; j < row_end; ++j)
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
         {
-            nnz_entries[col[j] - idx_base] = j;
+            rocsparse_int c = col[j] - idx_base;
+
+            if((fill_mode == rocsparse_fill_mode_lower && c <= i)
+               || (fill_mode == rocsparse_fill_mode_upper && c >= i))
+            {
+                col[nnz] = col[j];
+                val[nnz] = val[j];
+                ++nnz;
+            }
         }
 
-        bool has_diag = false;
+        row_begin  = row_end;
+        ptr[i + 1] = nnz + idx_base;
+    }
 
-        // loop over ai-th row nnz entries
-        for(j = row_start; j < row_end; ++j)
-        {
-            // if nnz entry is in lower matrix
-            if(col[j] - idx_base < ai)
-            {
+    col.resize(nnz);
+    val.resize(nnz);
 
-                rocsparse_int col_j  = col[j] - idx_base;
-                rocsparse_int diag_j = diag_offset[col_j];
+    return nnz;
+}
 
-                if(val[diag_j] != static_cast<T>(0))
-                {
-                    // multiplication factor
-                    val[j] = val[j] / val[diag_j];
+/* ============================================================================================ */
+/*! \brief  Transpose a \p m x \p n CSR matrix. Column indices of the transposed matrix
+ *  are sorted. */
+template <typename T>
+void csr_transpose(rocsparse_int m,
+                   rocsparse_int n,
+                   const std::vector<rocsparse_int>& ptr,
+                   const std::vector<rocsparse_int>& col,
+                   const std::vector<T>& val,
+                   std::vector<rocsparse_int>& tptr,
+                   std::vector<rocsparse_int>& tcol,
+                   std::vector<T>& tval,
+                   rocsparse_index_base idx_base)
+{
+    rocsparse_int nnz = ptr[m] - idx_base;
 
-                    // loop over upper offset pointer and do linear combination for nnz entry
-                    for(rocsparse_int k = diag_j + 1; k < ptr[col_j + 1] - idx_base; ++k)
-                    {
-                        // if nnz at this position do linear combination
-                        if(nnz_entries[col[k] - idx_base] != 0)
-                        {
-                            val[nnz_entries[col[k] - idx_base]] -= val[j] * val[k];
-                        }
-                    }
-                }
-                else
-                {
-                    // Numerical zero diagonal
-                    return col_j + idx_base;
-                }
-            }
-            else if(col[j] - idx_base == ai)
-            {
-                has_diag = true;
-                break;
-            }
-            else
-            {
-                break;
-            }
-        }
+    tptr.assign(n + 1, 0);
+    tcol.resize(nnz);
+    tval.resize(nnz);
 
-        if(!has_diag)
-        {
-            // Structural zero digonal
-            return ai + idx_base;
-        }
+    // Count entries per column
+    for(rocsparse_int j = 0; j < nnz; ++j)
+    {
+        ++tptr[col[j] - idx_base + 1];
+    }
 
-        // set diagonal pointer to diagonal element
-        diag_offset[ai] = j;
+    for(rocsparse_int i = 0; i < n; ++i)
+    {
+        tptr[i + 1] += tptr[i];
+    }
 
-        // clear nnz entries
-        for(j = row_start; j < row_end; ++j)
+    // Scatter rows in ascending order, such that the result is sorted
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
         {
-            nnz_entries[col[j] - idx_base] = 0;
+            rocsparse_int idx = tptr[col[j] - idx_base]++;
+
+            tcol[idx] = i + idx_base;
+            tval[idx] = val[j];
         }
     }
 
-    return -1;
+    // Shift back and apply index base
+    for(rocsparse_int i = n; i > 0; --i)
+    {
+        tptr[i] = tptr[i - 1] + idx_base;
+    }
+
+    tptr[0] = idx_base;
 }
 
 /* ============================================================================================ */
-/*! \brief  Sparse triangular lower solve using CSR storage format. */
+/*! \brief  Convert a \p m x \p n CSR matrix with sorted column indices into BSR format with
+ *  square blocks of dimension \p block_dim, stored in \p dir order. Blocks are padded with
+ *  zeros. */
 template <typename T>
-rocsparse_int lsolve(rocsparse_int m,
-                     const rocsparse_int* ptr,
-                     const rocsparse_int* col,
-                     const T* val,
-                     T alpha,
-                     const T* x,
-                     T* y,
-                     rocsparse_index_base idx_base,
-                     rocsparse_diag_type diag_type,
-                     unsigned int wf_size)
+rocsparse_int csr_to_bsr(rocsparse_direction dir,
+                         rocsparse_int m,
+                         rocsparse_int n,
+                         rocsparse_int block_dim,
+                         const std::vector<rocsparse_int>& csr_row_ptr,
+                         const std::vector<rocsparse_int>& csr_col_ind,
+                         const std::vector<T>& csr_val,
+                         rocsparse_index_base csr_base,
+                         std::vector<rocsparse_int>& bsr_row_ptr,
+                         std::vector<rocsparse_int>& bsr_col_ind,
+                         std::vector<T>& bsr_val,
+                         rocsparse_index_base bsr_base)
 {
-    rocsparse_int pivot = std::numeric_limits<rocsparse_int>::max();
-    std::vector<T> temp(wf_size);
-
-    for(rocsparse_int i = 0; i < m; ++i)
-    {
-        temp.assign(wf_size, static_cast<T>(0));
-        temp[0] = alpha * x[i];
-
-        rocsparse_int diag      = -1;
-        rocsparse_int row_begin = ptr[i] - idx_base;
-        rocsparse_int row_end   = ptr[i + 1] - idx_base;
+    rocsparse_int mb = (m + block_dim - 1) / block_dim;
+    rocsparse_int nb = (n + block_dim - 1) / block_dim;
 
-        T diag_val;
+    bsr_row_ptr.resize(mb + 1);
+    bsr_col_ind.clear();
+    bsr_val.clear();
 
-        for(rocsparse_int l = row_begin; l < row_end; l += wf_size)
-        {
-            for(rocsparse_int k = 0; k < wf_size; ++k)
-            {
-                rocsparse_int j = l + k;
+    // Position of each block column within the current block row, or -1
+    std::vector<rocsparse_int> pos(nb, -1);
 
-                // Do not run out of bounds
-                if(j >= row_end)
-                {
-                    break;
-                }
+    bsr_row_ptr[0] = bsr_base;
 
-                rocsparse_int col_j = col[j] - idx_base;
-                T val_j             = val[j];
+    for(rocsparse_int brow = 0; brow < mb; ++brow)
+    {
+        rocsparse_int row_begin = std::min(brow * block_dim, m);
+        rocsparse_int row_end   = std::min(row_begin + block_dim, m);
+        rocsparse_int nnzb      = bsr_row_ptr[brow] - bsr_base;
 
-                if(col_j < i)
-                {
-                    // Lower part
-                    temp[k] -= val[j] * y[col_j];
-                }
-                else if(col_j == i)
-                {
-                    // Diagonal
-                    if(diag_type == rocsparse_diag_type_non_unit)
-                    {
-                        // Check for numerical zero
-                        if(val_j == static_cast<T>(0))
-                        {
-                            pivot = std::min(pivot, i + idx_base);
-                            val_j = static_cast<T>(1);
-                        }
+        // Collect the sorted non-zero block columns of this block row
+        std::vector<rocsparse_int> bcols;
 
-                        diag     = j;
-                        diag_val = static_cast<T>(1) / val_j;
-                    }
+        for(rocsparse_int i = row_begin; i < row_end; ++i)
+        {
+            for(rocsparse_int j = csr_row_ptr[i] - csr_base; j < csr_row_ptr[i + 1] - csr_base;
+                ++j)
+            {
+                rocsparse_int bcol = (csr_col_ind[j] - csr_base) / block_dim;
 
-                    break;
-                }
-                else
+                if(pos[bcol] == -1)
                 {
-                    // Upper part
-                    break;
+                    pos[bcol] = 0;
+                    bcols.push_back(bcol);
                 }
             }
         }
 
-        for(rocsparse_int j = 1; j < wf_size; j <<= 1)
+        std::sort(bcols.begin(), bcols.end());
+
+        bsr_val.resize((nnzb + bcols.size()) * block_dim * block_dim, static_cast<T>(0));
+
+        for(size_t k = 0; k < bcols.size(); ++k)
         {
-            for(rocsparse_int k = 0; k < wf_size - j; ++k)
-            {
-                temp[k] += temp[k + j];
-            }
+            pos[bcols[k]] = nnzb + k;
+            bsr_col_ind.push_back(bcols[k] + bsr_base);
         }
 
-        if(diag_type == rocsparse_diag_type_non_unit)
+        // Scatter the CSR entries into their blocks
+        for(rocsparse_int i = row_begin; i < row_end; ++i)
         {
-            if(diag == -1)
+            for(rocsparse_int j = csr_row_ptr[i] - csr_base; j < csr_row_ptr[i + 1] - csr_base;
+                ++j)
             {
-                pivot = std::min(pivot, i + idx_base);
-            }
+                rocsparse_int col = csr_col_ind[j] - csr_base;
+                rocsparse_int r   = i % block_dim;
+                rocsparse_int c   = col % block_dim;
+                rocsparse_int idx = (dir == rocsparse_direction_row) ? r * block_dim + c
+                                                                     : c * block_dim + r;
 
-            y[i] = temp[0] * diag_val;
+                bsr_val[pos[col / block_dim] * block_dim * block_dim + idx] = csr_val[j];
+            }
         }
-        else
+
+        for(size_t k = 0; k < bcols.size(); ++k)
         {
-            y[i] = temp[0];
+            pos[bcols[k]] = -1;
         }
-    }
 
-    if(pivot != std::numeric_limits<rocsparse_int>::max())
-    {
-        return pivot;
+        bsr_row_ptr[brow + 1] = bsr_row_ptr[brow] + bcols.size();
     }
 
-    return -1;
+    return bsr_row_ptr[mb] - bsr_base;
 }
 
 /* ============================================================================================ */
-/*! \brief  Sparse triangular upper solve using CSR storage format. */
+/*! \brief  Convert a BSR matrix with \p mb x \p nb blocks of dimension \p block_dim into a
+ *  CSR matrix, keeping all entries of the blocks. */
 template <typename T>
-rocsparse_int usolve(rocsparse_int m,
-                     const rocsparse_int* ptr,
-                     const rocsparse_int* col,
-                     const T* val,
-                     T alpha,
-                     const T* x,
-                     T* y,
-                     rocsparse_index_base idx_base,
-                     rocsparse_diag_type diag_type,
-                     unsigned int wf_size)
+void bsr_to_csr(rocsparse_direction dir,
+                rocsparse_int mb,
+                rocsparse_int block_dim,
+                const std::vector<rocsparse_int>& bsr_row_ptr,
+                const std::vector<rocsparse_int>& bsr_col_ind,
+                const std::vector<T>& bsr_val,
+                rocsparse_index_base bsr_base,
+                std::vector<rocsparse_int>& csr_row_ptr,
+                std::vector<rocsparse_int>& csr_col_ind,
+                std::vector<T>& csr_val,
+                rocsparse_index_base csr_base)
 {
-    rocsparse_int pivot = std::numeric_limits<rocsparse_int>::max();
-    std::vector<T> temp(wf_size);
-
-    for(rocsparse_int i = m - 1; i >= 0; --i)
-    {
-        temp.assign(wf_size, static_cast<T>(0));
-        temp[0] = alpha * x[i];
+    csr_row_ptr.resize(mb * block_dim + 1);
+    csr_col_ind.clear();
+    csr_val.clear();
 
-        rocsparse_int diag      = -1;
-        rocsparse_int row_begin = ptr[i] - idx_base;
-        rocsparse_int row_end   = ptr[i + 1] - idx_base;
-
-        T diag_val;
+    csr_row_ptr[0] = csr_base;
 
-        for(rocsparse_int l = row_begin; l < row_end; l += wf_size)
+    for(rocsparse_int brow = 0; brow < mb; ++brow)
+    {
+        for(rocsparse_int r = 0; r < block_dim; ++r)
         {
-            for(rocsparse_int k = 0; k < wf_size; ++k)
-            {
-                rocsparse_int j = l + k;
+            rocsparse_int row_begin = bsr_row_ptr[brow] - bsr_base;
+            rocsparse_int row_end   = bsr_row_ptr[brow + 1] - bsr_base;
 
-                // Do not run out of bounds
-                if(j >= row_end)
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                for(rocsparse_int c = 0; c < block_dim; ++c)
                 {
-                    break;
+                    rocsparse_int idx = (dir == rocsparse_direction_row) ? r * block_dim + c
+                                                                         : c * block_dim + r;
+
+                    csr_col_ind.push_back((bsr_col_ind[j] - bsr_base) * block_dim + c + csr_base);
+                    csr_val.push_back(bsr_val[j * block_dim * block_dim + idx]);
                 }
+            }
 
-                rocsparse_int col_j = col[j] - idx_base;
-                T val_j             = val[j];
+            csr_row_ptr[brow * block_dim + r + 1] = csr_col_ind.size() + csr_base;
+        }
+    }
+}
 
-                if(col_j < i)
-                {
-                    // Lower part
-                    continue;
-                }
-                else if(col_j == i)
-                {
-                    // Diagonal
-                    if(diag_type == rocsparse_diag_type_non_unit)
-                    {
-                        // Check for numerical zero
+/* ============================================================================================ */
+/*! \brief  Convert a \p m x \p n CSR matrix into SELL-C-sigma format with slices of
+ *  \p slice_size rows. Rows are sorted by decreasing length within windows of \p sigma rows,
+ *  keeping the original order of rows with equal length. Within each slice, entries are
+ *  stored column-major and padded with column index -1 and value zero. Column indices keep
+ *  the index base of the CSR matrix. Returns the number of stored entries. */
+template <typename T>
+rocsparse_int csr_to_sellc(rocsparse_int m,
+                           rocsparse_int slice_size,
+                           rocsparse_int sigma,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           const std::vector<T>& csr_val,
+                           rocsparse_index_base csr_base,
+                           std::vector<rocsparse_int>& slice_ptr,
+                           std::vector<rocsparse_int>& perm,
+                           std::vector<rocsparse_int>& sell_col_ind,
+                           std::vector<T>& sell_val)
+{
+    rocsparse_int nslices = (m + slice_size - 1) / slice_size;
+
+    // Sort rows by decreasing length within each window
+    perm.resize(m);
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        perm[i] = i;
+    }
+
+    for(rocsparse_int i = 0; i < m; i += sigma)
+    {
+        rocsparse_int end = std::min(i + sigma, m);
+
+        std::stable_sort(
+            perm.begin() + i, perm.begin() + end, [&](rocsparse_int a, rocsparse_int b) {
+                return csr_row_ptr[a + 1] - csr_row_ptr[a] > csr_row_ptr[b + 1] - csr_row_ptr[b];
+            });
+    }
+
+    // Slice widths
+    slice_ptr.resize(nslices + 1);
+    slice_ptr[0] = 0;
+
+    for(rocsparse_int s = 0; s < nslices; ++s)
+    {
+        rocsparse_int width = 0;
+
+        for(rocsparse_int p = s * slice_size; p < std::min((s + 1) * slice_size, m); ++p)
+        {
+            width = std::max(width, csr_row_ptr[perm[p] + 1] - csr_row_ptr[perm[p]]);
+        }
+
+        slice_ptr[s + 1] = slice_ptr[s] + width * slice_size;
+    }
+
+    // Fill slices
+    sell_col_ind.assign(slice_ptr[nslices], -1);
+    sell_val.assign(slice_ptr[nslices], static_cast<T>(0));
+
+    for(rocsparse_int p = 0; p < m; ++p)
+    {
+        rocsparse_int s   = p / slice_size;
+        rocsparse_int lid = p % slice_size;
+        rocsparse_int row = perm[p];
+
+        rocsparse_int row_begin = csr_row_ptr[row] - csr_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - csr_base;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int idx = slice_ptr[s] + (j - row_begin) * slice_size + lid;
+
+            sell_col_ind[idx] = csr_col_ind[j];
+            sell_val[idx]     = csr_val[j];
+        }
+    }
+
+    return slice_ptr[nslices];
+}
+
+/* ============================================================================================ */
+/*! \brief  Compute the CSR5 tile descriptor of a \p m x \p n CSR matrix with \p nnz entries,
+ *  partitioned into tiles of \p omega x \p sigma consecutive entries. Bit s of the flag of a
+ *  thread is set if its s-th entry starts a row. The lower 16 bits of the offset hold the
+ *  number of row starts in preceding threads of the tile, the upper 16 bits the number of
+ *  subsequent threads without row start. Segment rows are stored explicitly only for tiles
+ *  that span empty rows. */
+inline void csr_to_csr5(rocsparse_int m,
+                        rocsparse_int nnz,
+                        rocsparse_int omega,
+                        rocsparse_int sigma,
+                        const std::vector<rocsparse_int>& csr_row_ptr,
+                        rocsparse_index_base csr_base,
+                        std::vector<rocsparse_int>& tile_ptr,
+                        std::vector<uint32_t>& tile_desc_flag,
+                        std::vector<uint32_t>& tile_desc_offset,
+                        std::vector<rocsparse_int>& tile_desc_rows_ptr,
+                        std::vector<rocsparse_int>& tile_desc_rows,
+                        std::vector<rocsparse_int>& empty_rows)
+{
+    rocsparse_int tile_size = omega * sigma;
+    rocsparse_int ntiles    = (nnz - 1) / tile_size + 1;
+
+    // Row of each entry and number of empty rows in front of each row
+    std::vector<rocsparse_int> entry_row(nnz);
+    std::vector<rocsparse_int> nempty(m + 1, 0);
+
+    empty_rows.clear();
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - csr_base; j < csr_row_ptr[i + 1] - csr_base; ++j)
+        {
+            entry_row[j] = i;
+        }
+
+        if(csr_row_ptr[i + 1] == csr_row_ptr[i])
+        {
+            empty_rows.push_back(i);
+        }
+
+        nempty[i + 1] = empty_rows.size();
+    }
+
+    tile_ptr.resize(ntiles);
+    tile_desc_flag.assign(omega * ntiles, 0);
+    tile_desc_offset.resize(omega * ntiles);
+    tile_desc_rows_ptr.resize(ntiles + 1);
+    tile_desc_rows.clear();
+
+    tile_desc_rows_ptr[0] = 0;
+
+    for(rocsparse_int t = 0; t < ntiles; ++t)
+    {
+        rocsparse_int tile_begin = t * tile_size;
+        rocsparse_int tile_end   = std::min(tile_begin + tile_size, nnz);
+
+        tile_ptr[t] = entry_row[tile_begin];
+
+        // Row start flags and number of row starts of each thread
+        std::vector<rocsparse_int> nstart(omega, 0);
+        std::vector<rocsparse_int> rows;
+
+        for(rocsparse_int j = tile_begin; j < tile_end; ++j)
+        {
+            rocsparse_int lid = (j - tile_begin) / sigma;
+            rocsparse_int s   = (j - tile_begin) % sigma;
+
+            if(csr_row_ptr[entry_row[j]] - csr_base == j)
+            {
+                tile_desc_flag[t * omega + lid] |= (1u << s);
+                ++nstart[lid];
+                rows.push_back(entry_row[j]);
+            }
+        }
+
+        // y and segment offsets
+        rocsparse_int y_offset = 0;
+
+        for(rocsparse_int lid = 0; lid < omega; ++lid)
+        {
+            rocsparse_int seg_offset = 0;
+            for(rocsparse_int k = lid + 1; k < omega && nstart[k] == 0; ++k)
+            {
+                ++seg_offset;
+            }
+
+            tile_desc_offset[t * omega + lid] = y_offset | (seg_offset << 16);
+
+            y_offset += nstart[lid];
+        }
+
+        // Tiles that span empty rows store their segment rows
+        if(nempty[entry_row[tile_end - 1]] != nempty[tile_ptr[t]])
+        {
+            tile_desc_rows.insert(tile_desc_rows.end(), rows.begin(), rows.end());
+        }
+
+        tile_desc_rows_ptr[t + 1] = tile_desc_rows.size();
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Convert a \p m x \p n CSR matrix into DIA format. Diagonals that hold at least one
+ *  entry are stored in increasing order of their offsets, \p m entries each, padded with
+ *  zero. Returns the number of diagonals. */
+template <typename T>
+rocsparse_int csr_to_dia(rocsparse_int m,
+                         rocsparse_int n,
+                         const std::vector<rocsparse_int>& csr_row_ptr,
+                         const std::vector<rocsparse_int>& csr_col_ind,
+                         const std::vector<T>& csr_val,
+                         rocsparse_index_base csr_base,
+                         std::vector<rocsparse_int>& dia_offset,
+                         std::vector<T>& dia_val)
+{
+    // Flag occupied diagonals and determine their position
+    std::vector<rocsparse_int> diag_pos(m + n - 1, -1);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - csr_base; j < csr_row_ptr[i + 1] - csr_base; ++j)
+        {
+            diag_pos[csr_col_ind[j] - csr_base - i + m - 1] = 0;
+        }
+    }
+
+    dia_offset.clear();
+
+    for(rocsparse_int d = 0; d < m + n - 1; ++d)
+    {
+        if(diag_pos[d] == 0)
+        {
+            diag_pos[d] = dia_offset.size();
+            dia_offset.push_back(d - m + 1);
+        }
+    }
+
+    rocsparse_int ndiag = dia_offset.size();
+
+    // Fill diagonals
+    dia_val.assign(m * ndiag, static_cast<T>(0));
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - csr_base; j < csr_row_ptr[i + 1] - csr_base; ++j)
+        {
+            rocsparse_int d = diag_pos[csr_col_ind[j] - csr_base - i + m - 1];
+
+            dia_val[d * m + i] = csr_val[j];
+        }
+    }
+
+    return ndiag;
+}
+
+/* ============================================================================================ */
+/*! \brief  Convert a \p m x \p n DIA matrix into CSR format. Entries outside of the matrix are
+ *  considered padding and are dropped, explicit zeros are kept. Returns the number of CSR
+ *  non-zero entries. */
+template <typename T>
+rocsparse_int dia_to_csr(rocsparse_int m,
+                         rocsparse_int n,
+                         rocsparse_int ndiag,
+                         const std::vector<rocsparse_int>& dia_offset,
+                         const std::vector<T>& dia_val,
+                         std::vector<rocsparse_int>& csr_row_ptr,
+                         std::vector<rocsparse_int>& csr_col_ind,
+                         std::vector<T>& csr_val,
+                         rocsparse_index_base csr_base)
+{
+    csr_row_ptr.resize(m + 1);
+    csr_col_ind.clear();
+    csr_val.clear();
+
+    csr_row_ptr[0] = csr_base;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int d = 0; d < ndiag; ++d)
+        {
+            rocsparse_int col = i + dia_offset[d];
+
+            // Positions outside of the matrix are padding, explicit zeros are kept
+            if(col >= 0 && col < n)
+            {
+                csr_col_ind.push_back(col + csr_base);
+                csr_val.push_back(dia_val[d * m + i]);
+            }
+        }
+
+        csr_row_ptr[i + 1] = csr_col_ind.size() + csr_base;
+    }
+
+    return csr_col_ind.size();
+}
+
+/* ============================================================================================ */
+/*! \brief  CSR-Adaptive row blocks parameters, see csrmv_analysis. */
+#define CSRMV_BLOCKSIZE 1024
+#define CSRMV_BLOCK_MULTIPLIER 3
+#define CSRMV_ROWS_FOR_VECTOR 1
+#define CSRMV_WG_BITS 24
+#define CSRMV_ROW_BITS 32
+#define CSRMV_WG_SIZE 256
+
+/*! \brief  Number of threads that team up to reduce a CSR-Stream row block. */
+inline unsigned long long csrmv_threads_for_reduction(unsigned long long num_rows)
+{
+    return CSRMV_WG_SIZE >> (8 * sizeof(int) - __builtin_clz(num_rows - 1));
+}
+
+/*! \brief  Compute CSR-Adaptive row blocks serially, row by row. */
+inline void csrmv_row_blocks(rocsparse_int m,
+                             const rocsparse_int* ptr,
+                             std::vector<unsigned long long>& row_blocks)
+{
+    row_blocks.clear();
+    row_blocks.push_back(0);
+
+    unsigned long long sum = 0;
+    unsigned long long i;
+    unsigned long long last_i = 0;
+
+    rocsparse_int consecutive_long_rows = 0;
+    for(i = 1; i <= static_cast<unsigned long long>(m); ++i)
+    {
+        rocsparse_int row_length = (ptr[i] - ptr[i - 1]);
+        sum += row_length;
+
+        // Do not mix short and long rows in a row block
+        if(row_length > 128)
+        {
+            ++consecutive_long_rows;
+        }
+        else if(consecutive_long_rows > 0)
+        {
+            if(row_length < 32)
+            {
+                consecutive_long_rows = -1;
+            }
+            else
+            {
+                ++consecutive_long_rows;
+            }
+        }
+
+        // Cut off short rows when entering a long row region
+        if(consecutive_long_rows == 1)
+        {
+            if(i - last_i > 1)
+            {
+                if(((i - 1) - last_i) > static_cast<unsigned long long>(CSRMV_ROWS_FOR_VECTOR))
+                {
+                    row_blocks.back() |= csrmv_threads_for_reduction((i - 1) - last_i);
+                }
+
+                row_blocks.push_back((i - 1) << (64 - CSRMV_ROW_BITS));
+
+                last_i = i - 1;
+                sum    = row_length;
+            }
+        }
+        // Cut off long rows when entering a short row region
+        else if(consecutive_long_rows == -1)
+        {
+            if(((i - 1) - last_i) > static_cast<unsigned long long>(CSRMV_ROWS_FOR_VECTOR))
+            {
+                row_blocks.back() |= csrmv_threads_for_reduction((i - 1) - last_i);
+            }
+
+            row_blocks.push_back((i - 1) << (64 - CSRMV_ROW_BITS));
+
+            last_i                = i - 1;
+            sum                   = row_length;
+            consecutive_long_rows = 0;
+        }
+
+        // CSR-Vector / CSR-LongRows case
+        if((i - last_i == 1) && sum > static_cast<unsigned long long>(CSRMV_BLOCKSIZE))
+        {
+            rocsparse_int nwg = static_cast<rocsparse_int>(ceil(
+                static_cast<double>(row_length) / (CSRMV_BLOCK_MULTIPLIER * CSRMV_BLOCKSIZE)));
+
+            nwg = std::min(nwg, static_cast<rocsparse_int>(1 << CSRMV_WG_BITS));
+
+            for(rocsparse_int w = 1; w < nwg; ++w)
+            {
+                row_blocks.push_back(((i - 1) << (64 - CSRMV_ROW_BITS)) |
+                                     static_cast<unsigned long long>(w));
+            }
+
+            row_blocks.push_back(i << (64 - CSRMV_ROW_BITS));
+
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+        // CSR-Stream case, back off one row
+        else if((i - last_i > 1) && sum > static_cast<unsigned long long>(CSRMV_BLOCKSIZE))
+        {
+            --i;
+
+            if((i - last_i) > static_cast<unsigned long long>(CSRMV_ROWS_FOR_VECTOR))
+            {
+                row_blocks.back() |= csrmv_threads_for_reduction(i - last_i);
+            }
+
+            row_blocks.push_back(i << (64 - CSRMV_ROW_BITS));
+
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+        // CSR-Stream case
+        else if(sum == static_cast<unsigned long long>(CSRMV_BLOCKSIZE))
+        {
+            if((i - last_i) > static_cast<unsigned long long>(CSRMV_ROWS_FOR_VECTOR))
+            {
+                row_blocks.back() |= csrmv_threads_for_reduction(i - last_i);
+            }
+
+            row_blocks.push_back(i << (64 - CSRMV_ROW_BITS));
+
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+    }
+
+    // Remaining rows
+    if((row_blocks.back() >> (64 - CSRMV_ROW_BITS)) != static_cast<unsigned long long>(m))
+    {
+        if((m - last_i) > static_cast<unsigned long long>(CSRMV_ROWS_FOR_VECTOR))
+        {
+            row_blocks.back() |= csrmv_threads_for_reduction(i - last_i);
+        }
+
+        row_blocks.push_back(static_cast<unsigned long long>(m) << (64 - CSRMV_ROW_BITS));
+    }
+}
+
+/*! \brief  Compute the CSR-Adaptive row block that starts at row s. Returns the first row of
+ *  the next row block, the number of row block entries and the reduction bits of row s.
+ *  nl is the first long row at or after s.
+ */
+inline void csrmv_row_block_segment(rocsparse_int m,
+                                    const rocsparse_int* ptr,
+                                    rocsparse_int s,
+                                    rocsparse_int nl,
+                                    rocsparse_int& next,
+                                    rocsparse_int& count,
+                                    unsigned long long& bits)
+{
+    rocsparse_int row_begin = ptr[s];
+    rocsparse_int row_len   = ptr[s + 1] - row_begin;
+
+    bool last = false;
+
+    count = 1;
+    bits  = 0;
+
+    if(row_len > CSRMV_BLOCKSIZE)
+    {
+        // CSR-LongRows, row is processed by multiple workgroups
+        count = (row_len - 1) / (CSRMV_BLOCK_MULTIPLIER * CSRMV_BLOCKSIZE) + 1;
+        count = std::min(count, static_cast<rocsparse_int>(1 << CSRMV_WG_BITS));
+        next  = s + 1;
+
+        return;
+    }
+    else if(row_len == CSRMV_BLOCKSIZE)
+    {
+        next = s + 1;
+    }
+    else if(row_len > 128)
+    {
+        // Long row region, ends with a short row or a full block
+        next = m;
+        last = true;
+
+        for(rocsparse_int r = s + 1; r < m; ++r)
+        {
+            rocsparse_int sum = ptr[r + 1] - row_begin;
+
+            if(ptr[r + 1] - ptr[r] < 32 || sum > CSRMV_BLOCKSIZE)
+            {
+                next = r;
+                last = false;
+                break;
+            }
+            else if(sum == CSRMV_BLOCKSIZE)
+            {
+                next = r + 1;
+                last = false;
+                break;
+            }
+        }
+    }
+    else
+    {
+        // Short row region, ends with a long row or a full block
+        rocsparse_int lo = s;
+        rocsparse_int hi = nl;
+
+        while(lo < hi)
+        {
+            rocsparse_int mid = lo + ((hi - lo) >> 1);
+
+            if(ptr[mid + 1] - row_begin >= CSRMV_BLOCKSIZE)
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid + 1;
+            }
+        }
+
+        if(lo < nl)
+        {
+            next = (ptr[lo + 1] - row_begin == CSRMV_BLOCKSIZE) ? lo + 1 : lo;
+        }
+        else
+        {
+            next = nl;
+            last = (nl == m);
+        }
+    }
+
+    // Reduction bits, the final block of rows counts one more row
+    rocsparse_int nrows = next - s;
+
+    if(nrows > CSRMV_ROWS_FOR_VECTOR)
+    {
+        bits = csrmv_threads_for_reduction(last ? nrows + 1 : nrows);
+    }
+}
+
+/*! \brief  Compute CSR-Adaptive row blocks using multiple threads. Each row computes the row
+ *  block it would start, the chain of row blocks starting at row 0 is then emitted.
+ */
+inline void csrmv_row_blocks_mt(rocsparse_int m,
+                                const rocsparse_int* ptr,
+                                std::vector<unsigned long long>& row_blocks)
+{
+    rocsparse_int nthreads = std::max(std::thread::hardware_concurrency(), 1U);
+
+    std::vector<rocsparse_int> long_rows(nthreads + 1, 0);
+    std::vector<rocsparse_int> next(m + 1, m);
+    std::vector<rocsparse_int> count(m + 1, 0);
+    std::vector<unsigned long long> bits(m + 1, 0);
+    std::vector<std::thread> threads(nthreads);
+
+    rocsparse_int chunk = (m - 1) / nthreads + 1;
+
+    // Count long rows per chunk
+    for(rocsparse_int t = 0; t < nthreads; ++t)
+    {
+        threads[t] = std::thread([&, t]() {
+            for(rocsparse_int i = t * chunk; i < std::min((t + 1) * chunk, m); ++i)
+            {
+                long_rows[t + 1] += (ptr[i + 1] - ptr[i] > 128);
+            }
+        });
+    }
+
+    for(rocsparse_int t = 0; t < nthreads; ++t)
+    {
+        threads[t].join();
+    }
+
+    // Exclusive scan of long rows per chunk
+    for(rocsparse_int t = 0; t < nthreads; ++t)
+    {
+        long_rows[t + 1] += long_rows[t];
+    }
+
+    // Compaction of long row indices, padded with m
+    std::vector<rocsparse_int> long_ind(long_rows[nthreads] + 1, m);
+
+    for(rocsparse_int t = 0; t < nthreads; ++t)
+    {
+        threads[t] = std::thread([&, t]() {
+            rocsparse_int pos = long_rows[t];
+
+            for(rocsparse_int i = t * chunk; i < std::min((t + 1) * chunk, m); ++i)
+            {
+                if(ptr[i + 1] - ptr[i] > 128)
+                {
+                    long_ind[pos++] = i;
+                }
+            }
+        });
+    }
+
+    for(rocsparse_int t = 0; t < nthreads; ++t)
+    {
+        threads[t].join();
+    }
+
+    // Row block starting at each row
+    for(rocsparse_int t = 0; t < nthreads; ++t)
+    {
+        threads[t] = std::thread([&, t]() {
+            rocsparse_int pos = long_rows[t];
+
+            for(rocsparse_int i = t * chunk; i < std::min((t + 1) * chunk, m); ++i)
+            {
+                csrmv_row_block_segment(m, ptr, i, long_ind[pos], next[i], count[i], bits[i]);
+
+                pos += (ptr[i + 1] - ptr[i] > 128);
+            }
+        });
+    }
+
+    for(rocsparse_int t = 0; t < nthreads; ++t)
+    {
+        threads[t].join();
+    }
+
+    // Follow the chain of row blocks
+    row_blocks.clear();
+    row_blocks.push_back(bits[0]);
+
+    for(rocsparse_int s = 0; s < m; s = next[s])
+    {
+        for(rocsparse_int w = 1; w < count[s]; ++w)
+        {
+            row_blocks.push_back((static_cast<unsigned long long>(s) << (64 - CSRMV_ROW_BITS)) |
+                                 static_cast<unsigned long long>(w));
+        }
+
+        row_blocks.push_back((static_cast<unsigned long long>(next[s]) << (64 - CSRMV_ROW_BITS)) |
+                             bits[next[s]]);
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Compute incomplete LU factorization without fill-ins and no pivoting using CSR
+ *  matrix storage format.
+ */
+template <typename T>
+rocsparse_int csrilu0(rocsparse_int m,
+                      const rocsparse_int* ptr,
+                      const rocsparse_int* col,
+                      T* val,
+                      rocsparse_index_base idx_base,
+                      bool boost                 = false,
+                      real_t<T> boost_tol        = static_cast<real_t<T>>(0),
+                      T boost_val                = static_cast<T>(0),
+                      rocsparse_int* boost_count = nullptr)
+{
+    // pointer of upper part of each row
+    std::vector<rocsparse_int> diag_offset(m);
+    std::vector<rocsparse_int> nnz_entries(m, 0);
+
+    // ai = 0 to N loop over all rows
+    for(rocsparse_int ai = 0; ai < m; ++ai)
+    {
+        // ai-th row entries
+        rocsparse_int row_start = ptr[ai] - idx_base;
+        rocsparse_int row_end   = ptr[ai + 1] - idx_base;
+        rocsparse_int j;
+
+        // nnz position of ai-th row in val array
+        for(j = row_start; j < row_end; ++j)
+        {
+            nnz_entries[col[j] - idx_base] = j;
+        }
+
+        bool has_diag = false;
+
+        // loop over ai-th row nnz entries
+        for(j = row_start; j < row_end; ++j)
+        {
+            // if nnz entry is in lower matrix
+            if(col[j] - idx_base < ai)
+            {
+
+                rocsparse_int col_j  = col[j] - idx_base;
+                rocsparse_int diag_j = diag_offset[col_j];
+
+                if(val[diag_j] != static_cast<T>(0))
+                {
+                    // multiplication factor
+                    val[j] = val[j] / val[diag_j];
+
+                    // loop over upper offset pointer and do linear combination for nnz entry
+                    for(rocsparse_int k = diag_j + 1; k < ptr[col_j + 1] - idx_base; ++k)
+                    {
+                        // if nnz at this position do linear combination
+                        if(nnz_entries[col[k] - idx_base] != 0)
+                        {
+                            val[nnz_entries[col[k] - idx_base]] -= val[j] * val[k];
+                        }
+                    }
+                }
+                else
+                {
+                    // Numerical zero diagonal
+                    return col_j + idx_base;
+                }
+            }
+            else if(col[j] - idx_base == ai)
+            {
+                has_diag = true;
+                break;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if(!has_diag)
+        {
+            // Structural zero digonal
+            return ai + idx_base;
+        }
+
+        // set diagonal pointer to diagonal element
+        diag_offset[ai] = j;
+
+        // replace tiny pivot by the boost value
+        if(boost && std::abs(val[j]) <= boost_tol)
+        {
+            val[j] = boost_val;
+            ++(*boost_count);
+        }
+
+        // clear nnz entries
+        for(j = row_start; j < row_end; ++j)
+        {
+            nnz_entries[col[j] - idx_base] = 0;
+        }
+    }
+
+    return -1;
+}
+
+/* ============================================================================================ */
+/*! \brief  Compute the sparsity pattern of the incomplete LU factorization with level of fill
+ *  using CSR matrix storage format. The values of A are scattered into the pattern.
+ */
+template <typename T>
+void csriluk_symbolic(rocsparse_int m,
+                      const std::vector<rocsparse_int>& ptr,
+                      const std::vector<rocsparse_int>& col,
+                      const std::vector<T>& val,
+                      rocsparse_int level,
+                      std::vector<rocsparse_int>& ptr_M,
+                      std::vector<rocsparse_int>& col_M,
+                      std::vector<T>& val_M,
+                      rocsparse_index_base idx_base)
+{
+    // level of fill of each entry of M
+    std::vector<rocsparse_int> lev_M;
+
+    ptr_M.resize(m + 1);
+    col_M.clear();
+    val_M.clear();
+
+    ptr_M[0] = idx_base;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        // column and level of fill of the entries of row i
+        std::map<rocsparse_int, rocsparse_int> row;
+
+        for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+        {
+            row[col[j] - idx_base] = 0;
+        }
+
+        // eliminate lower entries in ascending order, including fill-ins
+        for(auto it = row.begin(); it != row.end() && it->first < i; ++it)
+        {
+            rocsparse_int k = it->first;
+
+            for(rocsparse_int p = ptr_M[k] - idx_base; p < ptr_M[k + 1] - idx_base; ++p)
+            {
+                rocsparse_int c = col_M[p] - idx_base;
+
+                if(c <= k)
+                {
+                    continue;
+                }
+
+                rocsparse_int fill = it->second + lev_M[p] + 1;
+
+                if(fill > level)
+                {
+                    continue;
+                }
+
+                auto entry = row.find(c);
+
+                if(entry == row.end())
+                {
+                    row[c] = fill;
+                }
+                else
+                {
+                    entry->second = std::min(entry->second, fill);
+                }
+            }
+        }
+
+        for(auto it = row.begin(); it != row.end(); ++it)
+        {
+            col_M.push_back(it->first + idx_base);
+            lev_M.push_back(it->second);
+            val_M.push_back(static_cast<T>(0));
+        }
+
+        ptr_M[i + 1] = col_M.size() + idx_base;
+
+        // scatter values of A into M
+        rocsparse_int p = ptr_M[i] - idx_base;
+
+        for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+        {
+            while(col_M[p] < col[j])
+            {
+                ++p;
+            }
+
+            val_M[p] = val[j];
+        }
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Compute incomplete LU factorization with threshold dropping and no pivoting using
+ *  CSR matrix storage format. Returns the first row with zero pivot, or -1.
+ */
+template <typename T>
+rocsparse_int csrilut(rocsparse_int m,
+                      const std::vector<rocsparse_int>& ptr,
+                      const std::vector<rocsparse_int>& col,
+                      const std::vector<T>& val,
+                      T tau,
+                      rocsparse_int p,
+                      std::vector<rocsparse_int>& ptr_M,
+                      std::vector<rocsparse_int>& col_M,
+                      std::vector<T>& val_M,
+                      rocsparse_index_base idx_base)
+{
+    // first row with zero pivot
+    rocsparse_int position = -1;
+    // pivot of each row, zero if the diagonal entry has not been kept
+    std::vector<T> pivot(m);
+
+    ptr_M.resize(m + 1);
+    col_M.clear();
+    val_M.clear();
+
+    ptr_M[0] = idx_base;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        // column and value of the entries of row i
+        std::map<rocsparse_int, T> row;
+
+        T norm = static_cast<T>(0);
+
+        for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+        {
+            row[col[j] - idx_base] = val[j];
+            norm += val[j] * val[j];
+        }
+
+        T tol = tau * std::sqrt(norm);
+
+        // eliminate lower entries in ascending order, including fill-ins
+        for(auto it = row.begin(); it != row.end() && it->first < i; ++it)
+        {
+            rocsparse_int k = it->first;
+
+            if(pivot[k] == static_cast<T>(0))
+            {
+                continue;
+            }
+
+            it->second /= pivot[k];
+
+            if(std::abs(it->second) < tol)
+            {
+                continue;
+            }
+
+            for(rocsparse_int q = ptr_M[k] - idx_base; q < ptr_M[k + 1] - idx_base; ++q)
+            {
+                rocsparse_int c = col_M[q] - idx_base;
+
+                if(c <= k)
+                {
+                    continue;
+                }
+
+                row[c] -= it->second * val_M[q];
+            }
+        }
+
+        // drop small entries and keep the p largest of the lower and upper part
+        bool diag = false;
+        std::vector<rocsparse_int> lower;
+        std::vector<rocsparse_int> upper;
+
+        for(auto it = row.begin(); it != row.end(); ++it)
+        {
+            if(it->first == i)
+            {
+                diag = true;
+            }
+            else if(std::abs(it->second) >= tol)
+            {
+                (it->first < i ? lower : upper).push_back(it->first);
+            }
+        }
+
+        auto larger = [&row](rocsparse_int a, rocsparse_int b) {
+            return std::abs(row[a]) > std::abs(row[b]) ||
+                   (std::abs(row[a]) == std::abs(row[b]) && a < b);
+        };
+
+        if(lower.size() > static_cast<size_t>(p))
+        {
+            std::sort(lower.begin(), lower.end(), larger);
+            lower.resize(p);
+            std::sort(lower.begin(), lower.end());
+        }
+
+        if(upper.size() > static_cast<size_t>(p))
+        {
+            std::sort(upper.begin(), upper.end(), larger);
+            upper.resize(p);
+            std::sort(upper.begin(), upper.end());
+        }
+
+        if(diag)
+        {
+            lower.push_back(i);
+        }
+
+        lower.insert(lower.end(), upper.begin(), upper.end());
+
+        pivot[i] = diag ? row[i] : static_cast<T>(0);
+
+        if(pivot[i] == static_cast<T>(0) && position == -1)
+        {
+            position = i + idx_base;
+        }
+
+        for(size_t q = 0; q < lower.size(); ++q)
+        {
+            col_M.push_back(lower[q] + idx_base);
+            val_M.push_back(row[lower[q]]);
+        }
+
+        ptr_M[i + 1] = col_M.size() + idx_base;
+    }
+
+    return position;
+}
+
+/* ============================================================================================ */
+/*! \brief  Compute incomplete Cholesky factorization without fill-ins and no pivoting using
+ *  the lower triangular part of a CSR matrix.
+ */
+template <typename T>
+rocsparse_int csric0(rocsparse_int m,
+                     const rocsparse_int* ptr,
+                     const rocsparse_int* col,
+                     T* val,
+                     rocsparse_index_base idx_base)
+{
+    // pointer of diagonal entry of each row
+    std::vector<rocsparse_int> diag_offset(m);
+    std::vector<rocsparse_int> nnz_entries(m, -1);
+
+    for(rocsparse_int ai = 0; ai < m; ++ai)
+    {
+        rocsparse_int row_start = ptr[ai] - idx_base;
+        rocsparse_int row_end   = ptr[ai + 1] - idx_base;
+        rocsparse_int j;
+
+        // nnz position of ai-th row in val array
+        for(j = row_start; j < row_end; ++j)
+        {
+            nnz_entries[col[j] - idx_base] = j;
+        }
+
+        bool has_diag = false;
+
+        // loop over lower part of ai-th row
+        for(j = row_start; j < row_end; ++j)
+        {
+            rocsparse_int col_j = col[j] - idx_base;
+
+            if(col_j < ai)
+            {
+                // inner product of row ai and row col_j of L
+                T sum = static_cast<T>(0);
+
+                for(rocsparse_int k = ptr[col_j] - idx_base; k < diag_offset[col_j]; ++k)
+                {
+                    if(nnz_entries[col[k] - idx_base] != -1)
+                    {
+                        sum += val[k] * val[nnz_entries[col[k] - idx_base]];
+                    }
+                }
+
+                val[j] = (val[j] - sum) / val[diag_offset[col_j]];
+            }
+            else if(col_j == ai)
+            {
+                has_diag = true;
+                break;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if(!has_diag)
+        {
+            // Structural zero digonal
+            return ai + idx_base;
+        }
+
+        // diagonal entry
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int k = row_start; k < j; ++k)
+        {
+            sum += val[k] * val[k];
+        }
+
+        if(val[j] - sum <= static_cast<T>(0))
+        {
+            // Matrix is not positive definite
+            return ai + idx_base;
+        }
+
+        val[j] = sqrt(val[j] - sum);
+
+        // set diagonal pointer to diagonal element
+        diag_offset[ai] = j;
+
+        // clear nnz entries
+        for(j = row_start; j < row_end; ++j)
+        {
+            nnz_entries[col[j] - idx_base] = -1;
+        }
+    }
+
+    return -1;
+}
+
+/* ============================================================================================ */
+/*! \brief  Sparse triangular lower solve using CSR storage format. */
+template <typename T>
+rocsparse_int lsolve(rocsparse_int m,
+                     const rocsparse_int* ptr,
+                     const rocsparse_int* col,
+                     const T* val,
+                     T alpha,
+                     const T* x,
+                     T* y,
+                     rocsparse_index_base idx_base,
+                     rocsparse_diag_type diag_type,
+                     unsigned int wf_size)
+{
+    rocsparse_int pivot = std::numeric_limits<rocsparse_int>::max();
+    std::vector<T> temp(wf_size);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        temp.assign(wf_size, static_cast<T>(0));
+        temp[0] = alpha * x[i];
+
+        rocsparse_int diag      = -1;
+        rocsparse_int row_begin = ptr[i] - idx_base;
+        rocsparse_int row_end   = ptr[i + 1] - idx_base;
+
+        T diag_val;
+
+        for(rocsparse_int l = row_begin; l < row_end; l += wf_size)
+        {
+            for(rocsparse_int k = 0; k < wf_size; ++k)
+            {
+                rocsparse_int j = l + k;
+
+                // Do not run out of bounds
+                if(j >= row_end)
+                {
+                    break;
+                }
+
+                rocsparse_int col_j = col[j] - idx_base;
+                T val_j             = val[j];
+
+                if(col_j < i)
+                {
+                    // Lower part
+                    temp[k] -= val[j] * y[col_j];
+                }
+                else if(col_j == i)
+                {
+                    // Diagonal
+                    if(diag_type == rocsparse_diag_type_non_unit)
+                    {
+                        // Check for numerical zero
+                        if(val_j == static_cast<T>(0))
+                        {
+                            pivot = std::min(pivot, i + idx_base);
+                            val_j = static_cast<T>(1);
+                        }
+
+                        diag     = j;
+                        diag_val = static_cast<T>(1) / val_j;
+                    }
+
+                    break;
+                }
+                else
+                {
+                    // Upper part
+                    break;
+                }
+            }
+        }
+
+        for(rocsparse_int j = 1; j < wf_size; j <<= 1)
+        {
+            for(rocsparse_int k = 0; k < wf_size - j; ++k)
+            {
+                temp[k] += temp[k + j];
+            }
+        }
+
+        if(diag_type == rocsparse_diag_type_non_unit)
+        {
+            if(diag == -1)
+            {
+                pivot = std::min(pivot, i + idx_base);
+            }
+
+            y[i] = temp[0] * diag_val;
+        }
+        else
+        {
+            y[i] = temp[0];
+        }
+    }
+
+    if(pivot != std::numeric_limits<rocsparse_int>::max())
+    {
+        return pivot;
+    }
+
+    return -1;
+}
+
+/* ============================================================================================ */
+/*! \brief  Sparse triangular upper solve using CSR storage format. */
+template <typename T>
+rocsparse_int usolve(rocsparse_int m,
+                     const rocsparse_int* ptr,
+                     const rocsparse_int* col,
+                     const T* val,
+                     T alpha,
+                     const T* x,
+                     T* y,
+                     rocsparse_index_base idx_base,
+                     rocsparse_diag_type diag_type,
+                     unsigned int wf_size)
+{
+    rocsparse_int pivot = std::numeric_limits<rocsparse_int>::max();
+    std::vector<T> temp(wf_size);
+
+    for(rocsparse_int i = m - 1; i >= 0; --i)
+    {
+        temp.assign(wf_size, static_cast<T>(0));
+        temp[0] = alpha * x[i];
+
+        rocsparse_int diag      = -1;
+        rocsparse_int row_begin = ptr[i] - idx_base;
+        rocsparse_int row_end   = ptr[i + 1] - idx_base;
+
+        T diag_val;
+
+        for(rocsparse_int l = row_begin; l < row_end; l += wf_size)
+        {
+            for(rocsparse_int k = 0; k < wf_size; ++k)
+            {
+                rocsparse_int j = l + k;
+
+                // Do not run out of bounds
+                if(j >= row_end)
+                {
+                    break;
+                }
+
+                rocsparse_int col_j = col[j] - idx_base;
+                T val_j             = val[j];
+
+                if(col_j < i)
+                {
+                    // Lower part
+                    continue;
+                }
+                else if(col_j == i)
+                {
+                    // Diagonal
+                    if(diag_type == rocsparse_diag_type_non_unit)
+                    {
+                        // Check for numerical zero
                         if(val_j == static_cast<T>(0))
                         {
                             pivot = std::min(pivot, i + idx_base);
@@ -901,6 +2140,121 @@ rocsparse_int usolve(rocsparse_int m,
     return -1;
 }
 
+/* ============================================================================================ */
+/*! \brief  Residual norm of a sparse triangular system using CSR storage format. */
+template <typename T>
+T csritsv_residual(rocsparse_int m,
+                   const rocsparse_int* ptr,
+                   const rocsparse_int* col,
+                   const T* val,
+                   T alpha,
+                   const T* x,
+                   const T* y,
+                   rocsparse_index_base idx_base,
+                   rocsparse_fill_mode fill_mode,
+                   rocsparse_diag_type diag_type)
+{
+    T nrm = static_cast<T>(0);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        T sum  = alpha * x[i];
+        T diag = static_cast<T>(1);
+
+        for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+        {
+            rocsparse_int c = col[j] - idx_base;
+
+            if(c == i)
+            {
+                if(diag_type == rocsparse_diag_type_non_unit)
+                {
+                    diag = val[j];
+                }
+            }
+            else if((fill_mode == rocsparse_fill_mode_lower && c < i)
+                    || (fill_mode == rocsparse_fill_mode_upper && c > i))
+            {
+                sum -= val[j] * y[c];
+            }
+        }
+
+        sum -= diag * y[i];
+        nrm += sum * sum;
+    }
+
+    return std::sqrt(nrm);
+}
+
+/* ============================================================================================ */
+/*! \brief  Residual norm of A - LU on the sparsity pattern of A, where L and U are stored in
+ *  M = L + U - I, using CSR storage format.
+ */
+template <typename T>
+T csritilu0_residual(rocsparse_int m,
+                     const rocsparse_int* ptr,
+                     const rocsparse_int* col,
+                     const T* a_val,
+                     const T* m_val,
+                     rocsparse_index_base idx_base)
+{
+    T nrm = static_cast<T>(0);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int idx = ptr[i] - idx_base; idx < ptr[i + 1] - idx_base; ++idx)
+        {
+            rocsparse_int j = col[idx] - idx_base;
+            T sum           = a_val[idx];
+
+            // Sum over l_ik * u_kj with k < min(i, j)
+            for(rocsparse_int k = ptr[i] - idx_base; k < ptr[i + 1] - idx_base; ++k)
+            {
+                rocsparse_int ck = col[k] - idx_base;
+
+                if(ck >= std::min(i, j))
+                {
+                    break;
+                }
+
+                for(rocsparse_int l = ptr[ck] - idx_base; l < ptr[ck + 1] - idx_base; ++l)
+                {
+                    if(col[l] - idx_base == j)
+                    {
+                        sum -= m_val[k] * m_val[l];
+                        break;
+                    }
+                }
+            }
+
+            if(i > j)
+            {
+                // Diagonal entry u_jj
+                T u_jj = static_cast<T>(0);
+
+                for(rocsparse_int l = ptr[j] - idx_base; l < ptr[j + 1] - idx_base; ++l)
+                {
+                    if(col[l] - idx_base == j)
+                    {
+                        u_jj = m_val[l];
+                        break;
+                    }
+                }
+
+                sum -= m_val[idx] * u_jj;
+            }
+            else
+            {
+                sum -= m_val[idx];
+            }
+
+            nrm += sum * sum;
+        }
+    }
+
+    return std::sqrt(nrm);
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -956,6 +2310,10 @@ class Arguments
     rocsparse_diag_type diag_type      = rocsparse_diag_type_non_unit;
     rocsparse_fill_mode fill_mode      = rocsparse_fill_mode_lower;
     rocsparse_analysis_policy analysis = rocsparse_analysis_policy_reuse;
+    rocsparse_solve_policy solve       = rocsparse_solve_policy_auto;
+    rocsparse_csrmv_alg csrmv_alg      = rocsparse_csrmv_alg_adaptive;
+    rocsparse_matrix_type mat_type     = rocsparse_matrix_type_general;
+    rocsparse_direction direction      = rocsparse_direction_row;
 
     rocsparse_int norm_check = 0;
     rocsparse_int unit_check = 1;
@@ -964,7 +2322,17 @@ class Arguments
     rocsparse_int iters     = 10;
     rocsparse_int laplacian = 0;
     rocsparse_int ell_width = 0;
+    rocsparse_int level     = 0;
+    rocsparse_int max_fill  = 0;
+    rocsparse_int boost     = 0;
+    rocsparse_int sweeps    = 0;
     rocsparse_int temp      = 0;
+    rocsparse_int block_dim = 2;
+    rocsparse_int sigma     = 1;
+
+    double tau       = 0.0;
+    double boost_tol = 0.0;
+    double boost_val = 1.0;
 
     std::string filename = "";
     bool bswitch         = false;
@@ -991,6 +2359,10 @@ class Arguments
         this->diag_type = rhs.diag_type;
         this->fill_mode = rhs.fill_mode;
         this->analysis  = rhs.analysis;
+        this->solve     = rhs.solve;
+        this->csrmv_alg = rhs.csrmv_alg;
+        this->mat_type  = rhs.mat_type;
+        this->direction = rhs.direction;
 
         this->norm_check = rhs.norm_check;
         this->unit_check = rhs.unit_check;
@@ -999,7 +2371,17 @@ class Arguments
         this->iters     = rhs.iters;
         this->laplacian = rhs.laplacian;
         this->ell_width = rhs.ell_width;
+        this->level     = rhs.level;
+        this->max_fill  = rhs.max_fill;
+        this->boost     = rhs.boost;
+        this->sweeps    = rhs.sweeps;
         this->temp      = rhs.temp;
+        this->block_dim = rhs.block_dim;
+        this->sigma     = rhs.sigma;
+
+        this->tau       = rhs.tau;
+        this->boost_tol = rhs.boost_tol;
+        this->boost_val = rhs.boost_val;
 
         this->filename = rhs.filename;
         this->bswitch  = rhs.bswitch;
@@ -0,0 +1,184 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_bsr2csr.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+
+typedef rocsparse_index_base base;
+typedef rocsparse_direction dir;
+typedef std::tuple<int, int, int, dir, base> bsr2csr_tuple;
+typedef std::tuple<int, dir, base, std::string> bsr2csr_bin_tuple;
+
+int bsr2csr_M_range[]         = {-1, 0, 10, 500, 7111};
+int bsr2csr_N_range[]         = {-3, 0, 33, 842, 4441};
+int bsr2csr_block_dim_range[] = {-1, 1, 2, 3, 4, 7, 8, 12};
+
+dir bsr2csr_dir_range[] = {rocsparse_direction_row, rocsparse_direction_column};
+
+base bsr2csr_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+int bsr2csr_bin_block_dim_range[] = {2, 4, 5};
+
+std::string bsr2csr_bin[] = {"rma10.bin",
+                             "mac_econ_fwd500.bin",
+                             "bibd_22_8.bin",
+                             "mc2depi.bin",
+                             "scircuit.bin",
+                             "nos1.bin",
+                             "nos2.bin",
+                             "nos3.bin",
+                             "nos4.bin",
+                             "nos5.bin",
+                             "nos6.bin",
+                             "nos7.bin"};
+
+class parameterized_bsr2csr : public testing::TestWithParam<bsr2csr_tuple>
+{
+    protected:
+    parameterized_bsr2csr() {}
+    virtual ~parameterized_bsr2csr() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_bsr2csr_bin : public testing::TestWithParam<bsr2csr_bin_tuple>
+{
+    protected:
+    parameterized_bsr2csr_bin() {}
+    virtual ~parameterized_bsr2csr_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_bsr2csr_arguments(bsr2csr_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.block_dim = std::get<2>(tup);
+    arg.direction = std::get<3>(tup);
+    arg.idx_base  = std::get<4>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+Arguments setup_bsr2csr_arguments(bsr2csr_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M         = -99;
+    arg.N         = -99;
+    arg.block_dim = std::get<0>(tup);
+    arg.direction = std::get<1>(tup);
+    arg.idx_base  = std::get<2>(tup);
+    arg.timing    = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<3>(tup);
+
+    // Get current executables absolute path
+    char path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(bsr2csr_bad_arg, bsr2csr_float) { testing_bsr2csr_bad_arg<float>(); }
+
+TEST_P(parameterized_bsr2csr, bsr2csr_float)
+{
+    Arguments arg = setup_bsr2csr_arguments(GetParam());
+
+    rocsparse_status status = testing_bsr2csr<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_bsr2csr, bsr2csr_double)
+{
+    Arguments arg = setup_bsr2csr_arguments(GetParam());
+
+    rocsparse_status status = testing_bsr2csr<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_bsr2csr, bsr2csr_float_complex)
+{
+    Arguments arg = setup_bsr2csr_arguments(GetParam());
+
+    rocsparse_status status = testing_bsr2csr<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_bsr2csr, bsr2csr_double_complex)
+{
+    Arguments arg = setup_bsr2csr_arguments(GetParam());
+
+    rocsparse_status status = testing_bsr2csr<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_bsr2csr_bin, bsr2csr_bin_float)
+{
+    Arguments arg = setup_bsr2csr_arguments(GetParam());
+
+    rocsparse_status status = testing_bsr2csr<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_bsr2csr_bin, bsr2csr_bin_double)
+{
+    Arguments arg = setup_bsr2csr_arguments(GetParam());
+
+    rocsparse_status status = testing_bsr2csr<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(bsr2csr,
+                        parameterized_bsr2csr,
+                        testing::Combine(testing::ValuesIn(bsr2csr_M_range),
+                                         testing::ValuesIn(bsr2csr_N_range),
+                                         testing::ValuesIn(bsr2csr_block_dim_range),
+                                         testing::ValuesIn(bsr2csr_dir_range),
+                                         testing::ValuesIn(bsr2csr_idxbase_range)));
+
+INSTANTIATE_TEST_CASE_P(bsr2csr_bin,
+                        parameterized_bsr2csr_bin,
+                        testing::Combine(testing::ValuesIn(bsr2csr_bin_block_dim_range),
+                                         testing::ValuesIn(bsr2csr_dir_range),
+                                         testing::ValuesIn(bsr2csr_idxbase_range),
+                                         testing::ValuesIn(bsr2csr_bin)));
@@ -135,6 +135,22 @@ TEST_P(parameterized_coomv, coomv_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_coomv, coomv_float_complex)
+{
+    Arguments arg = setup_coomv_arguments(GetParam());
+
+    rocsparse_status status = testing_coomv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_coomv, coomv_double_complex)
+{
+    Arguments arg = setup_coomv_arguments(GetParam());
+
+    rocsparse_status status = testing_coomv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_coomv_bin, coomv_bin_float)
 {
     Arguments arg = setup_coomv_arguments(GetParam());
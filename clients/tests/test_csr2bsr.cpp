@@ -0,0 +1,184 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csr2bsr.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+
+typedef rocsparse_index_base base;
+typedef rocsparse_direction dir;
+typedef std::tuple<int, int, int, dir, base> csr2bsr_tuple;
+typedef std::tuple<int, dir, base, std::string> csr2bsr_bin_tuple;
+
+int csr2bsr_M_range[]         = {-1, 0, 10, 500, 7111};
+int csr2bsr_N_range[]         = {-3, 0, 33, 842, 4441};
+int csr2bsr_block_dim_range[] = {-1, 1, 2, 3, 4, 7, 8, 12};
+
+dir csr2bsr_dir_range[] = {rocsparse_direction_row, rocsparse_direction_column};
+
+base csr2bsr_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+int csr2bsr_bin_block_dim_range[] = {2, 4, 5};
+
+std::string csr2bsr_bin[] = {"rma10.bin",
+                             "mac_econ_fwd500.bin",
+                             "bibd_22_8.bin",
+                             "mc2depi.bin",
+                             "scircuit.bin",
+                             "nos1.bin",
+                             "nos2.bin",
+                             "nos3.bin",
+                             "nos4.bin",
+                             "nos5.bin",
+                             "nos6.bin",
+                             "nos7.bin"};
+
+class parameterized_csr2bsr : public testing::TestWithParam<csr2bsr_tuple>
+{
+    protected:
+    parameterized_csr2bsr() {}
+    virtual ~parameterized_csr2bsr() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csr2bsr_bin : public testing::TestWithParam<csr2bsr_bin_tuple>
+{
+    protected:
+    parameterized_csr2bsr_bin() {}
+    virtual ~parameterized_csr2bsr_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csr2bsr_arguments(csr2bsr_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.block_dim = std::get<2>(tup);
+    arg.direction = std::get<3>(tup);
+    arg.idx_base  = std::get<4>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+Arguments setup_csr2bsr_arguments(csr2bsr_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M         = -99;
+    arg.N         = -99;
+    arg.block_dim = std::get<0>(tup);
+    arg.direction = std::get<1>(tup);
+    arg.idx_base  = std::get<2>(tup);
+    arg.timing    = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<3>(tup);
+
+    // Get current executables absolute path
+    char path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(csr2bsr_bad_arg, csr2bsr_float) { testing_csr2bsr_bad_arg<float>(); }
+
+TEST_P(parameterized_csr2bsr, csr2bsr_float)
+{
+    Arguments arg = setup_csr2bsr_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2bsr<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2bsr, csr2bsr_double)
+{
+    Arguments arg = setup_csr2bsr_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2bsr<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2bsr, csr2bsr_float_complex)
+{
+    Arguments arg = setup_csr2bsr_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2bsr<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2bsr, csr2bsr_double_complex)
+{
+    Arguments arg = setup_csr2bsr_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2bsr<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2bsr_bin, csr2bsr_bin_float)
+{
+    Arguments arg = setup_csr2bsr_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2bsr<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2bsr_bin, csr2bsr_bin_double)
+{
+    Arguments arg = setup_csr2bsr_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2bsr<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csr2bsr,
+                        parameterized_csr2bsr,
+                        testing::Combine(testing::ValuesIn(csr2bsr_M_range),
+                                         testing::ValuesIn(csr2bsr_N_range),
+                                         testing::ValuesIn(csr2bsr_block_dim_range),
+                                         testing::ValuesIn(csr2bsr_dir_range),
+                                         testing::ValuesIn(csr2bsr_idxbase_range)));
+
+INSTANTIATE_TEST_CASE_P(csr2bsr_bin,
+                        parameterized_csr2bsr_bin,
+                        testing::Combine(testing::ValuesIn(csr2bsr_bin_block_dim_range),
+                                         testing::ValuesIn(csr2bsr_dir_range),
+                                         testing::ValuesIn(csr2bsr_idxbase_range),
+                                         testing::ValuesIn(csr2bsr_bin)));
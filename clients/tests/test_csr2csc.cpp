@@ -132,6 +132,22 @@ TEST_P(parameterized_csr2csc, csr2csc_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csr2csc, csr2csc_float_complex)
+{
+    Arguments arg = setup_csr2csc_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2csc<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2csc, csr2csc_double_complex)
+{
+    Arguments arg = setup_csr2csc_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2csc<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_csr2csc_bin, csr2csc_bin_float)
 {
     Arguments arg = setup_csr2csc_arguments(GetParam());
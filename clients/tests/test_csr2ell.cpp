@@ -131,6 +131,22 @@ TEST_P(parameterized_csr2ell, csr2ell_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csr2ell, csr2ell_float_complex)
+{
+    Arguments arg = setup_csr2ell_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2ell<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2ell, csr2ell_double_complex)
+{
+    Arguments arg = setup_csr2ell_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2ell<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_csr2ell_bin, csr2ell_bin_float)
 {
     Arguments arg = setup_csr2ell_arguments(GetParam());
@@ -138,6 +138,22 @@ TEST_P(parameterized_csr2hyb, csr2hyb_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csr2hyb, csr2hyb_float_complex)
+{
+    Arguments arg = setup_csr2hyb_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2hyb<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2hyb, csr2hyb_double_complex)
+{
+    Arguments arg = setup_csr2hyb_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2hyb<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_csr2hyb_bin, csr2hyb_bin_float)
 {
     Arguments arg = setup_csr2hyb_arguments(GetParam());
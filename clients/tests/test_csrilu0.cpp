@@ -31,10 +31,11 @@
 #include <string>
 
 typedef rocsparse_index_base base;
-typedef std::tuple<int, base> csrilu0_tuple;
+typedef std::tuple<int, int, base> csrilu0_tuple;
 typedef std::tuple<base, std::string> csrilu0_bin_tuple;
 
-int csrilu0_M_range[] = {-1, 0, 50, 647};
+int csrilu0_M_range[]     = {-1, 0, 50, 647};
+int csrilu0_boost_range[] = {0, 1};
 
 base csrilu0_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
 
@@ -73,9 +74,12 @@ class parameterized_csrilu0_bin : public testing::TestWithParam<csrilu0_bin_tupl
 Arguments setup_csrilu0_arguments(csrilu0_tuple tup)
 {
     Arguments arg;
-    arg.M        = std::get<0>(tup);
-    arg.idx_base = std::get<1>(tup);
-    arg.timing   = 0;
+    arg.M         = std::get<0>(tup);
+    arg.boost     = std::get<1>(tup);
+    arg.idx_base  = std::get<2>(tup);
+    arg.boost_tol = 1.0;
+    arg.boost_val = 10.0;
+    arg.timing    = 0;
     return arg;
 }
 
@@ -125,6 +129,22 @@ TEST_P(parameterized_csrilu0, csrilu0_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csrilu0, csrilu0_float_complex)
+{
+    Arguments arg = setup_csrilu0_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrilu0, csrilu0_double_complex)
+{
+    Arguments arg = setup_csrilu0_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_csrilu0_bin, csrilu0_bin_float)
 {
     Arguments arg = setup_csrilu0_arguments(GetParam());
@@ -144,6 +164,7 @@ TEST_P(parameterized_csrilu0_bin, csrilu0_bin_double)
 INSTANTIATE_TEST_CASE_P(csrilu0,
                         parameterized_csrilu0,
                         testing::Combine(testing::ValuesIn(csrilu0_M_range),
+                                         testing::ValuesIn(csrilu0_boost_range),
                                          testing::ValuesIn(csrilu0_idxbase_range)));
 
 INSTANTIATE_TEST_CASE_P(csrilu0_bin,
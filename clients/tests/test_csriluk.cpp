@@ -0,0 +1,153 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csriluk.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <vector>
+#include <string>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, base> csriluk_tuple;
+typedef std::tuple<int, base, std::string> csriluk_bin_tuple;
+
+int csriluk_M_range[] = {-1, 0, 50, 647};
+
+int csriluk_level_range[] = {0, 1, 2};
+
+base csriluk_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+std::string csriluk_bin[] = {"nos1.bin",
+                             "nos2.bin",
+                             "nos3.bin",
+                             "nos4.bin",
+                             "nos5.bin",
+                             "nos6.bin",
+                             "nos7.bin"};
+
+class parameterized_csriluk : public testing::TestWithParam<csriluk_tuple>
+{
+    protected:
+    parameterized_csriluk() {}
+    virtual ~parameterized_csriluk() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csriluk_bin : public testing::TestWithParam<csriluk_bin_tuple>
+{
+    protected:
+    parameterized_csriluk_bin() {}
+    virtual ~parameterized_csriluk_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csriluk_arguments(csriluk_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.level    = std::get<1>(tup);
+    arg.idx_base = std::get<2>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+Arguments setup_csriluk_arguments(csriluk_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M        = -99;
+    arg.level    = std::get<0>(tup);
+    arg.idx_base = std::get<1>(tup);
+    arg.timing   = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<2>(tup);
+
+    // Get current executables absolute path
+    char path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(csriluk_bad_arg, csriluk_float) { testing_csriluk_bad_arg<float>(); }
+
+TEST_P(parameterized_csriluk, csriluk_float)
+{
+    Arguments arg = setup_csriluk_arguments(GetParam());
+
+    rocsparse_status status = testing_csriluk<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csriluk, csriluk_double)
+{
+    Arguments arg = setup_csriluk_arguments(GetParam());
+
+    rocsparse_status status = testing_csriluk<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csriluk_bin, csriluk_bin_float)
+{
+    Arguments arg = setup_csriluk_arguments(GetParam());
+
+    rocsparse_status status = testing_csriluk<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csriluk_bin, csriluk_bin_double)
+{
+    Arguments arg = setup_csriluk_arguments(GetParam());
+
+    rocsparse_status status = testing_csriluk<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csriluk,
+                        parameterized_csriluk,
+                        testing::Combine(testing::ValuesIn(csriluk_M_range),
+                                         testing::ValuesIn(csriluk_level_range),
+                                         testing::ValuesIn(csriluk_idxbase_range)));
+
+INSTANTIATE_TEST_CASE_P(csriluk_bin,
+                        parameterized_csriluk_bin,
+                        testing::Combine(testing::ValuesIn(csriluk_level_range),
+                                         testing::ValuesIn(csriluk_idxbase_range),
+                                         testing::ValuesIn(csriluk_bin)));
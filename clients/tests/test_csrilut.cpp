@@ -0,0 +1,159 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csrilut.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <vector>
+#include <string>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, double, int, base> csrilut_tuple;
+typedef std::tuple<double, int, base, std::string> csrilut_bin_tuple;
+
+int csrilut_M_range[] = {-1, 0, 50, 647};
+
+double csrilut_tau_range[] = {0.0, 0.01, 0.1};
+
+int csrilut_p_range[] = {1, 5, 20};
+
+base csrilut_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+std::string csrilut_bin[] = {"nos1.bin",
+                             "nos2.bin",
+                             "nos3.bin",
+                             "nos4.bin",
+                             "nos5.bin",
+                             "nos6.bin",
+                             "nos7.bin"};
+
+class parameterized_csrilut : public testing::TestWithParam<csrilut_tuple>
+{
+    protected:
+    parameterized_csrilut() {}
+    virtual ~parameterized_csrilut() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csrilut_bin : public testing::TestWithParam<csrilut_bin_tuple>
+{
+    protected:
+    parameterized_csrilut_bin() {}
+    virtual ~parameterized_csrilut_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrilut_arguments(csrilut_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.tau      = std::get<1>(tup);
+    arg.max_fill = std::get<2>(tup);
+    arg.idx_base = std::get<3>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+Arguments setup_csrilut_arguments(csrilut_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M        = -99;
+    arg.tau      = std::get<0>(tup);
+    arg.max_fill = std::get<1>(tup);
+    arg.idx_base = std::get<2>(tup);
+    arg.timing   = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<3>(tup);
+
+    // Get current executables absolute path
+    char path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(csrilut_bad_arg, csrilut_float) { testing_csrilut_bad_arg<float>(); }
+
+TEST_P(parameterized_csrilut, csrilut_float)
+{
+    Arguments arg = setup_csrilut_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilut<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrilut, csrilut_double)
+{
+    Arguments arg = setup_csrilut_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilut<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrilut_bin, csrilut_bin_float)
+{
+    Arguments arg = setup_csrilut_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilut<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrilut_bin, csrilut_bin_double)
+{
+    Arguments arg = setup_csrilut_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilut<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrilut,
+                        parameterized_csrilut,
+                        testing::Combine(testing::ValuesIn(csrilut_M_range),
+                                         testing::ValuesIn(csrilut_tau_range),
+                                         testing::ValuesIn(csrilut_p_range),
+                                         testing::ValuesIn(csrilut_idxbase_range)));
+
+INSTANTIATE_TEST_CASE_P(csrilut_bin,
+                        parameterized_csrilut_bin,
+                        testing::Combine(testing::ValuesIn(csrilut_tau_range),
+                                         testing::ValuesIn(csrilut_p_range),
+                                         testing::ValuesIn(csrilut_idxbase_range),
+                                         testing::ValuesIn(csrilut_bin)));
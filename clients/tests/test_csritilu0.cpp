@@ -0,0 +1,81 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csritilu0.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, base> csritilu0_tuple;
+
+int csritilu0_dim_range[]    = {-1, 0, 1, 8, 21};
+int csritilu0_sweeps_range[] = {1, 10, 1000};
+
+base csritilu0_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_csritilu0 : public testing::TestWithParam<csritilu0_tuple>
+{
+    protected:
+    parameterized_csritilu0() {}
+    virtual ~parameterized_csritilu0() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csritilu0_arguments(csritilu0_tuple tup)
+{
+    Arguments arg;
+    arg.laplacian = std::get<0>(tup);
+    arg.sweeps    = std::get<1>(tup);
+    arg.idx_base  = std::get<2>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(csritilu0_bad_arg, csritilu0_float) { testing_csritilu0_bad_arg<float>(); }
+
+TEST_P(parameterized_csritilu0, csritilu0_float)
+{
+    Arguments arg = setup_csritilu0_arguments(GetParam());
+
+    rocsparse_status status = testing_csritilu0<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csritilu0, csritilu0_double)
+{
+    Arguments arg = setup_csritilu0_arguments(GetParam());
+
+    rocsparse_status status = testing_csritilu0<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csritilu0,
+                        parameterized_csritilu0,
+                        testing::Combine(testing::ValuesIn(csritilu0_dim_range),
+                                         testing::ValuesIn(csritilu0_sweeps_range),
+                                         testing::ValuesIn(csritilu0_idxbase_range)));
@@ -0,0 +1,91 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csritsv.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef rocsparse_diag_type diag;
+typedef rocsparse_fill_mode fill;
+
+typedef std::tuple<int, int, base, diag, fill> csritsv_tuple;
+
+int csritsv_dim_range[]    = {-1, 0, 1, 8, 21};
+int csritsv_sweeps_range[] = {1, 10, 1000};
+
+base csritsv_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+diag csritsv_diag_range[]    = {rocsparse_diag_type_non_unit, rocsparse_diag_type_unit};
+fill csritsv_fill_range[]    = {rocsparse_fill_mode_lower, rocsparse_fill_mode_upper};
+
+class parameterized_csritsv : public testing::TestWithParam<csritsv_tuple>
+{
+    protected:
+    parameterized_csritsv() {}
+    virtual ~parameterized_csritsv() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csritsv_arguments(csritsv_tuple tup)
+{
+    Arguments arg;
+    arg.laplacian = std::get<0>(tup);
+    arg.sweeps    = std::get<1>(tup);
+    arg.idx_base  = std::get<2>(tup);
+    arg.diag_type = std::get<3>(tup);
+    arg.fill_mode = std::get<4>(tup);
+    arg.transA    = rocsparse_operation_none;
+    arg.alpha     = 2.0;
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(csritsv_bad_arg, csritsv_float) { testing_csritsv_bad_arg<float>(); }
+
+TEST_P(parameterized_csritsv, csritsv_float)
+{
+    Arguments arg = setup_csritsv_arguments(GetParam());
+
+    rocsparse_status status = testing_csritsv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csritsv, csritsv_double)
+{
+    Arguments arg = setup_csritsv_arguments(GetParam());
+
+    rocsparse_status status = testing_csritsv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csritsv,
+                        parameterized_csritsv,
+                        testing::Combine(testing::ValuesIn(csritsv_dim_range),
+                                         testing::ValuesIn(csritsv_sweeps_range),
+                                         testing::ValuesIn(csritsv_idxbase_range),
+                                         testing::ValuesIn(csritsv_diag_range),
+                                         testing::ValuesIn(csritsv_fill_range)));
@@ -31,8 +31,13 @@
 #include <string>
 
 typedef rocsparse_index_base base;
-typedef std::tuple<int, int, double, double, base, bool> csrmv_tuple;
-typedef std::tuple<double, double, base, std::string, bool> csrmv_bin_tuple;
+typedef rocsparse_operation trans;
+typedef rocsparse_csrmv_alg alg;
+typedef std::tuple<int, int, double, double, base, bool, alg, trans> csrmv_tuple;
+typedef std::tuple<double, double, base, std::string, bool, alg, trans> csrmv_bin_tuple;
+typedef rocsparse_fill_mode fill;
+typedef std::tuple<int, double, double, base, bool, alg, fill> csrmv_symm_tuple;
+typedef std::tuple<double, double, base, std::string, bool, fill> csrmv_symm_bin_tuple;
 
 int csr_M_range[] = {-1, 0, 500, 7111};
 int csr_N_range[] = {-3, 0, 842, 4441};
@@ -41,6 +46,7 @@ std::vector<double> csr_alpha_range = {2.0, 3.0};
 std::vector<double> csr_beta_range  = {0.0, 1.0};
 
 base csr_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+trans csr_transA_range[]  = {rocsparse_operation_none, rocsparse_operation_transpose};
 
 std::string csr_bin[] = {"rma10.bin",
                          "mac_econ_fwd500.bin",
@@ -57,8 +63,24 @@ std::string csr_bin[] = {"rma10.bin",
                          "nos6.bin",
                          "nos7.bin"};
 
+std::string csr_symm_bin[] = {"bmwcra_1.bin",
+                              "nos1.bin",
+                              "nos2.bin",
+                              "nos3.bin",
+                              "nos4.bin",
+                              "nos5.bin",
+                              "nos6.bin",
+                              "nos7.bin"};
+
 bool csr_adaptive[] = {false, true};
 
+alg csr_alg_range[] = {rocsparse_csrmv_alg_adaptive, rocsparse_csrmv_alg_merge};
+
+int csr_row_blocks_M_range[] = {0, 1, 500, 7111, 250000};
+
+int csr_symm_M_range[]     = {-1, 0, 500, 7111};
+fill csr_fill_mode_range[] = {rocsparse_fill_mode_lower, rocsparse_fill_mode_upper};
+
 class parameterized_csrmv : public testing::TestWithParam<csrmv_tuple>
 {
     protected:
@@ -77,29 +99,69 @@ class parameterized_csrmv_bin : public testing::TestWithParam<csrmv_bin_tuple>
     virtual void TearDown() {}
 };
 
+class parameterized_csrmv_symm : public testing::TestWithParam<csrmv_symm_tuple>
+{
+    protected:
+    parameterized_csrmv_symm() {}
+    virtual ~parameterized_csrmv_symm() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csrmv_symm_bin : public testing::TestWithParam<csrmv_symm_bin_tuple>
+{
+    protected:
+    parameterized_csrmv_symm_bin() {}
+    virtual ~parameterized_csrmv_symm_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csrmv_row_blocks : public testing::TestWithParam<int>
+{
+    protected:
+    parameterized_csrmv_row_blocks() {}
+    virtual ~parameterized_csrmv_row_blocks() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csrmv_row_blocks_bin : public testing::TestWithParam<std::string>
+{
+    protected:
+    parameterized_csrmv_row_blocks_bin() {}
+    virtual ~parameterized_csrmv_row_blocks_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
 Arguments setup_csrmv_arguments(csrmv_tuple tup)
 {
     Arguments arg;
-    arg.M        = std::get<0>(tup);
-    arg.N        = std::get<1>(tup);
-    arg.alpha    = std::get<2>(tup);
-    arg.beta     = std::get<3>(tup);
-    arg.idx_base = std::get<4>(tup);
-    arg.bswitch  = std::get<5>(tup);
-    arg.timing   = 0;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.alpha     = std::get<2>(tup);
+    arg.beta      = std::get<3>(tup);
+    arg.idx_base  = std::get<4>(tup);
+    arg.bswitch   = std::get<5>(tup);
+    arg.csrmv_alg = std::get<6>(tup);
+    arg.transA    = std::get<7>(tup);
+    arg.timing    = 0;
     return arg;
 }
 
 Arguments setup_csrmv_arguments(csrmv_bin_tuple tup)
 {
     Arguments arg;
-    arg.M        = -99;
-    arg.N        = -99;
-    arg.alpha    = std::get<0>(tup);
-    arg.beta     = std::get<1>(tup);
-    arg.idx_base = std::get<2>(tup);
-    arg.bswitch  = std::get<4>(tup);
-    arg.timing   = 0;
+    arg.M         = -99;
+    arg.N         = -99;
+    arg.alpha     = std::get<0>(tup);
+    arg.beta      = std::get<1>(tup);
+    arg.idx_base  = std::get<2>(tup);
+    arg.bswitch   = std::get<4>(tup);
+    arg.csrmv_alg = std::get<5>(tup);
+    arg.transA    = std::get<6>(tup);
+    arg.timing    = 0;
 
     // Determine absolute path of test matrix
     std::string bin_file = std::get<3>(tup);
@@ -122,6 +184,57 @@ Arguments setup_csrmv_arguments(csrmv_bin_tuple tup)
     return arg;
 }
 
+Arguments setup_csrmv_arguments(csrmv_symm_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<0>(tup);
+    arg.alpha     = std::get<1>(tup);
+    arg.beta      = std::get<2>(tup);
+    arg.idx_base  = std::get<3>(tup);
+    arg.bswitch   = std::get<4>(tup);
+    arg.csrmv_alg = std::get<5>(tup);
+    arg.fill_mode = std::get<6>(tup);
+    arg.mat_type  = rocsparse_matrix_type_symmetric;
+    arg.timing    = 0;
+    return arg;
+}
+
+Arguments setup_csrmv_arguments(csrmv_symm_bin_tuple tup)
+{
+    Arguments arg = setup_csrmv_arguments(csrmv_bin_tuple(std::get<0>(tup),
+                                                          std::get<1>(tup),
+                                                          std::get<2>(tup),
+                                                          std::get<3>(tup),
+                                                          std::get<4>(tup),
+                                                          rocsparse_csrmv_alg_adaptive,
+                                                          rocsparse_operation_none));
+    arg.fill_mode = std::get<5>(tup);
+    arg.mat_type  = rocsparse_matrix_type_symmetric;
+    return arg;
+}
+
+Arguments setup_csrmv_row_blocks_arguments(int m)
+{
+    Arguments arg;
+    arg.M      = m;
+    arg.N      = m;
+    arg.timing = 0;
+    return arg;
+}
+
+Arguments setup_csrmv_row_blocks_arguments(std::string bin_file)
+{
+    Arguments arg = setup_csrmv_arguments(csrmv_bin_tuple(1.0,
+                                                          0.0,
+                                                          rocsparse_index_base_zero,
+                                                          bin_file,
+                                                          true,
+                                                          rocsparse_csrmv_alg_adaptive,
+                                                          rocsparse_operation_none));
+    return arg;
+}
+
 TEST(csrmv_bad_arg, csrmv_float) { testing_csrmv_bad_arg<float>(); }
 
 TEST_P(parameterized_csrmv, csrmv_float)
@@ -156,6 +269,78 @@ TEST_P(parameterized_csrmv_bin, csrmv_bin_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csrmv_symm, csrmv_symm_float)
+{
+    Arguments arg = setup_csrmv_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_symm, csrmv_symm_double)
+{
+    Arguments arg = setup_csrmv_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_symm_bin, csrmv_symm_bin_float)
+{
+    Arguments arg = setup_csrmv_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_symm_bin, csrmv_symm_bin_double)
+{
+    Arguments arg = setup_csrmv_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_row_blocks, csrmv_row_blocks)
+{
+    Arguments arg = setup_csrmv_row_blocks_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_row_blocks<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_row_blocks, csrmv_cache)
+{
+    Arguments arg = setup_csrmv_row_blocks_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_cache<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_row_blocks_bin, csrmv_row_blocks_bin)
+{
+    Arguments arg = setup_csrmv_row_blocks_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_row_blocks<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_row_blocks, csrmv_merge_path)
+{
+    Arguments arg = setup_csrmv_row_blocks_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_merge_path<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_row_blocks_bin, csrmv_merge_path_bin)
+{
+    Arguments arg = setup_csrmv_row_blocks_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_merge_path<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 INSTANTIATE_TEST_CASE_P(csrmv,
                         parameterized_csrmv,
                         testing::Combine(testing::ValuesIn(csr_M_range),
@@ -163,7 +348,9 @@ INSTANTIATE_TEST_CASE_P(csrmv,
                                          testing::ValuesIn(csr_alpha_range),
                                          testing::ValuesIn(csr_beta_range),
                                          testing::ValuesIn(csr_idxbase_range),
-                                         testing::ValuesIn(csr_adaptive)));
+                                         testing::ValuesIn(csr_adaptive),
+                                         testing::ValuesIn(csr_alg_range),
+                                         testing::ValuesIn(csr_transA_range)));
 
 INSTANTIATE_TEST_CASE_P(csrmv_bin,
                         parameterized_csrmv_bin,
@@ -171,4 +358,33 @@ INSTANTIATE_TEST_CASE_P(csrmv_bin,
                                          testing::ValuesIn(csr_beta_range),
                                          testing::ValuesIn(csr_idxbase_range),
                                          testing::ValuesIn(csr_bin),
-                                         testing::ValuesIn(csr_adaptive)));
+                                         testing::ValuesIn(csr_adaptive),
+                                         testing::ValuesIn(csr_alg_range),
+                                         testing::ValuesIn(csr_transA_range)));
+
+INSTANTIATE_TEST_CASE_P(csrmv_symm,
+                        parameterized_csrmv_symm,
+                        testing::Combine(testing::ValuesIn(csr_symm_M_range),
+                                         testing::ValuesIn(csr_alpha_range),
+                                         testing::ValuesIn(csr_beta_range),
+                                         testing::ValuesIn(csr_idxbase_range),
+                                         testing::ValuesIn(csr_adaptive),
+                                         testing::ValuesIn(csr_alg_range),
+                                         testing::ValuesIn(csr_fill_mode_range)));
+
+INSTANTIATE_TEST_CASE_P(csrmv_symm_bin,
+                        parameterized_csrmv_symm_bin,
+                        testing::Combine(testing::ValuesIn(csr_alpha_range),
+                                         testing::ValuesIn(csr_beta_range),
+                                         testing::ValuesIn(csr_idxbase_range),
+                                         testing::ValuesIn(csr_symm_bin),
+                                         testing::ValuesIn(csr_adaptive),
+                                         testing::ValuesIn(csr_fill_mode_range)));
+
+INSTANTIATE_TEST_CASE_P(csrmv_row_blocks,
+                        parameterized_csrmv_row_blocks,
+                        testing::ValuesIn(csr_row_blocks_M_range));
+
+INSTANTIATE_TEST_CASE_P(csrmv_row_blocks_bin,
+                        parameterized_csrmv_row_blocks_bin,
+                        testing::ValuesIn(csr_bin));
@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrmv_mixed.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <vector>
+#include <string>
+
+typedef rocsparse_index_base base;
+typedef rocsparse_operation trans;
+typedef rocsparse_csrmv_alg alg;
+typedef std::tuple<int, int, double, double, base, bool, alg, trans> csrmv_mixed_tuple;
+typedef std::tuple<double, double, base, std::string, bool, alg> csrmv_mixed_bin_tuple;
+
+int csr_mixed_M_range[] = {-1, 0, 500, 7111};
+int csr_mixed_N_range[] = {-3, 0, 842, 4441};
+
+std::vector<double> csr_mixed_alpha_range = {2.0, 3.0};
+std::vector<double> csr_mixed_beta_range  = {0.0, 1.0};
+
+base csr_mixed_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+trans csr_mixed_transA_range[] = {rocsparse_operation_none, rocsparse_operation_transpose};
+
+std::string csr_mixed_bin[] = {"rma10.bin",
+                               "mac_econ_fwd500.bin",
+                               "bibd_22_8.bin",
+                               "mc2depi.bin",
+                               "scircuit.bin",
+                               "bmwcra_1.bin"};
+
+bool csr_mixed_adaptive[] = {false, true};
+
+alg csr_mixed_alg_range[] = {rocsparse_csrmv_alg_adaptive, rocsparse_csrmv_alg_merge};
+
+class parameterized_csrmv_mixed : public testing::TestWithParam<csrmv_mixed_tuple>
+{
+    protected:
+    parameterized_csrmv_mixed() {}
+    virtual ~parameterized_csrmv_mixed() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csrmv_mixed_bin : public testing::TestWithParam<csrmv_mixed_bin_tuple>
+{
+    protected:
+    parameterized_csrmv_mixed_bin() {}
+    virtual ~parameterized_csrmv_mixed_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrmv_mixed_arguments(csrmv_mixed_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.alpha     = std::get<2>(tup);
+    arg.beta      = std::get<3>(tup);
+    arg.idx_base  = std::get<4>(tup);
+    arg.bswitch   = std::get<5>(tup);
+    arg.csrmv_alg = std::get<6>(tup);
+    arg.transA    = std::get<7>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+Arguments setup_csrmv_mixed_arguments(csrmv_mixed_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M         = -99;
+    arg.N         = -99;
+    arg.alpha     = std::get<0>(tup);
+    arg.beta      = std::get<1>(tup);
+    arg.idx_base  = std::get<2>(tup);
+    arg.bswitch   = std::get<4>(tup);
+    arg.csrmv_alg = std::get<5>(tup);
+    arg.transA    = rocsparse_operation_none;
+    arg.timing    = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<3>(tup);
+
+    // Get current executables absolute path
+    char path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(csrmv_mixed_bad_arg, csrmv_mixed_double_float)
+{
+    testing_csrmv_mixed_bad_arg<double, float>();
+}
+
+TEST_P(parameterized_csrmv_mixed, csrmv_mixed_double_float)
+{
+    Arguments arg = setup_csrmv_mixed_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_mixed<double, float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_mixed_bin, csrmv_mixed_bin_double_float)
+{
+    Arguments arg = setup_csrmv_mixed_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_mixed<double, float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrmv_mixed,
+                        parameterized_csrmv_mixed,
+                        testing::Combine(testing::ValuesIn(csr_mixed_M_range),
+                                         testing::ValuesIn(csr_mixed_N_range),
+                                         testing::ValuesIn(csr_mixed_alpha_range),
+                                         testing::ValuesIn(csr_mixed_beta_range),
+                                         testing::ValuesIn(csr_mixed_idxbase_range),
+                                         testing::ValuesIn(csr_mixed_adaptive),
+                                         testing::ValuesIn(csr_mixed_alg_range),
+                                         testing::ValuesIn(csr_mixed_transA_range)));
+
+INSTANTIATE_TEST_CASE_P(csrmv_mixed_bin,
+                        parameterized_csrmv_mixed_bin,
+                        testing::Combine(testing::ValuesIn(csr_mixed_alpha_range),
+                                         testing::ValuesIn(csr_mixed_beta_range),
+                                         testing::ValuesIn(csr_mixed_idxbase_range),
+                                         testing::ValuesIn(csr_mixed_bin),
+                                         testing::ValuesIn(csr_mixed_adaptive),
+                                         testing::ValuesIn(csr_mixed_alg_range)));
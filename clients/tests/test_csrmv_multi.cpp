@@ -0,0 +1,180 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csrmv_multi.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <unistd.h>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, int, double, double, base, bool> csrmv_multi_tuple;
+typedef std::tuple<int, double, double, base, bool, std::string> csrmv_multi_bin_tuple;
+
+int csrmv_multi_M_range[] = {-1, 0, 10, 500, 7111, 10000};
+int csrmv_multi_N_range[] = {-3, 0, 33, 842, 4441, 10000};
+int csrmv_multi_K_range[] = {-1, 0, 2, 3, 4, 7, 8, 16, 17};
+
+double csrmv_multi_alpha_range[] = {2.0, 3.0};
+double csrmv_multi_beta_range[]  = {0.0, 1.0};
+
+base csrmv_multi_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+bool csrmv_multi_adaptive[]      = {false, true};
+
+int csrmv_multi_bin_K_range[] = {2, 5, 16};
+
+std::string csrmv_multi_bin[] = {"rma10.bin",
+                                 "mac_econ_fwd500.bin",
+                                 "bibd_22_8.bin",
+                                 "mc2depi.bin",
+                                 "scircuit.bin",
+                                 "ASIC_320k.bin",
+                                 "bmwcra_1.bin",
+                                 "nos1.bin",
+                                 "nos2.bin",
+                                 "nos3.bin",
+                                 "nos4.bin",
+                                 "nos5.bin",
+                                 "nos6.bin",
+                                 "nos7.bin"};
+
+class parameterized_csrmv_multi : public testing::TestWithParam<csrmv_multi_tuple>
+{
+    protected:
+    parameterized_csrmv_multi() {}
+    virtual ~parameterized_csrmv_multi() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csrmv_multi_bin : public testing::TestWithParam<csrmv_multi_bin_tuple>
+{
+    protected:
+    parameterized_csrmv_multi_bin() {}
+    virtual ~parameterized_csrmv_multi_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrmv_multi_arguments(csrmv_multi_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.K        = std::get<2>(tup);
+    arg.alpha    = std::get<3>(tup);
+    arg.beta     = std::get<4>(tup);
+    arg.idx_base = std::get<5>(tup);
+    arg.bswitch  = std::get<6>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+Arguments setup_csrmv_multi_arguments(csrmv_multi_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M        = -99;
+    arg.N        = -99;
+    arg.K        = std::get<0>(tup);
+    arg.alpha    = std::get<1>(tup);
+    arg.beta     = std::get<2>(tup);
+    arg.idx_base = std::get<3>(tup);
+    arg.bswitch  = std::get<4>(tup);
+    arg.timing   = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<5>(tup);
+
+    // Get current executables absolute path
+    char path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(csrmv_multi_bad_arg, csrmv_multi_float) { testing_csrmv_multi_bad_arg<float>(); }
+
+TEST_P(parameterized_csrmv_multi, csrmv_multi_float)
+{
+    Arguments arg = setup_csrmv_multi_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_multi<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_multi, csrmv_multi_double)
+{
+    Arguments arg = setup_csrmv_multi_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_multi<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_multi_bin, csrmv_multi_bin_float)
+{
+    Arguments arg = setup_csrmv_multi_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_multi<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_multi_bin, csrmv_multi_bin_double)
+{
+    Arguments arg = setup_csrmv_multi_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_multi<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrmv_multi,
+                        parameterized_csrmv_multi,
+                        testing::Combine(testing::ValuesIn(csrmv_multi_M_range),
+                                         testing::ValuesIn(csrmv_multi_N_range),
+                                         testing::ValuesIn(csrmv_multi_K_range),
+                                         testing::ValuesIn(csrmv_multi_alpha_range),
+                                         testing::ValuesIn(csrmv_multi_beta_range),
+                                         testing::ValuesIn(csrmv_multi_idxbase_range),
+                                         testing::ValuesIn(csrmv_multi_adaptive)));
+
+INSTANTIATE_TEST_CASE_P(csrmv_multi_bin,
+                        parameterized_csrmv_multi_bin,
+                        testing::Combine(testing::ValuesIn(csrmv_multi_bin_K_range),
+                                         testing::ValuesIn(csrmv_multi_alpha_range),
+                                         testing::ValuesIn(csrmv_multi_beta_range),
+                                         testing::ValuesIn(csrmv_multi_idxbase_range),
+                                         testing::ValuesIn(csrmv_multi_adaptive),
+                                         testing::ValuesIn(csrmv_multi_bin)));
@@ -0,0 +1,102 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrsm.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef rocsparse_operation op;
+typedef rocsparse_diag_type diag;
+typedef rocsparse_fill_mode fill;
+typedef rocsparse_solve_policy policy;
+
+typedef std::tuple<int, int, double, base, op, diag, fill, policy> csrsm_tuple;
+
+int csrsm_M_range[]    = {-1, 0, 50, 647};
+int csrsm_nrhs_range[] = {-1, 0, 1, 8, 33, 64};
+
+double csrsm_alpha_range[] = {1.0, -3.7};
+
+base csrsm_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+op csrsm_transB_range[]    = {rocsparse_operation_none, rocsparse_operation_transpose};
+diag csrsm_diag_range[]    = {rocsparse_diag_type_non_unit};
+fill csrsm_fill_range[]    = {rocsparse_fill_mode_lower, rocsparse_fill_mode_upper};
+policy csrsm_policy_range[] = {
+    rocsparse_solve_policy_auto, rocsparse_solve_policy_sync_free, rocsparse_solve_policy_level};
+
+class parameterized_csrsm : public testing::TestWithParam<csrsm_tuple>
+{
+    protected:
+    parameterized_csrsm() {}
+    virtual ~parameterized_csrsm() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrsm_arguments(csrsm_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.K         = std::get<1>(tup);
+    arg.alpha     = std::get<2>(tup);
+    arg.idx_base  = std::get<3>(tup);
+    arg.transB    = std::get<4>(tup);
+    arg.diag_type = std::get<5>(tup);
+    arg.fill_mode = std::get<6>(tup);
+    arg.solve     = std::get<7>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(csrsm_bad_arg, csrsm_float) { testing_csrsm_bad_arg<float>(); }
+
+TEST_P(parameterized_csrsm, csrsm_float)
+{
+    Arguments arg = setup_csrsm_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsm<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrsm, csrsm_double)
+{
+    Arguments arg = setup_csrsm_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsm<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrsm,
+                        parameterized_csrsm,
+                        testing::Combine(testing::ValuesIn(csrsm_M_range),
+                                         testing::ValuesIn(csrsm_nrhs_range),
+                                         testing::ValuesIn(csrsm_alpha_range),
+                                         testing::ValuesIn(csrsm_idxbase_range),
+                                         testing::ValuesIn(csrsm_transB_range),
+                                         testing::ValuesIn(csrsm_diag_range),
+                                         testing::ValuesIn(csrsm_fill_range),
+                                         testing::ValuesIn(csrsm_policy_range)));
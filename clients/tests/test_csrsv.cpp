@@ -34,8 +34,9 @@ typedef rocsparse_index_base base;
 typedef rocsparse_operation op;
 typedef rocsparse_diag_type diag;
 typedef rocsparse_fill_mode fill;
+typedef rocsparse_solve_policy policy;
 
-typedef std::tuple<int, double, base, op, diag, fill> csrsv_tuple;
+typedef std::tuple<int, double, base, op, diag, fill, policy> csrsv_tuple;
 typedef std::tuple<double, base, op, diag, fill, std::string> csrsv_bin_tuple;
 
 int csrsv_M_range[] = {-1, 0, 50, 647};
@@ -43,9 +44,13 @@ int csrsv_M_range[] = {-1, 0, 50, 647};
 double csrsv_alpha_range[] = {1.0, 2.3, -3.7};
 
 base csrsv_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
-op csrsv_op_range[]        = {rocsparse_operation_none};
+op csrsv_op_range[]        = {rocsparse_operation_none,
+                             rocsparse_operation_transpose,
+                             rocsparse_operation_conjugate_transpose};
 diag csrsv_diag_range[]    = {rocsparse_diag_type_non_unit};
 fill csrsv_fill_range[]    = {rocsparse_fill_mode_lower, rocsparse_fill_mode_upper};
+policy csrsv_policy_range[] = {
+    rocsparse_solve_policy_auto, rocsparse_solve_policy_sync_free, rocsparse_solve_policy_level};
 
 std::string csrsv_bin[] = {"rma10.bin",
                            "mac_econ_fwd500.bin",
@@ -87,6 +92,7 @@ Arguments setup_csrsv_arguments(csrsv_tuple tup)
     arg.transA    = std::get<3>(tup);
     arg.diag_type = std::get<4>(tup);
     arg.fill_mode = std::get<5>(tup);
+    arg.solve     = std::get<6>(tup);
     arg.timing    = 0;
     return arg;
 }
@@ -141,6 +147,22 @@ TEST_P(parameterized_csrsv, csrsv_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csrsv, csrsv_float_complex)
+{
+    Arguments arg = setup_csrsv_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrsv, csrsv_double_complex)
+{
+    Arguments arg = setup_csrsv_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_csrsv_bin, csrsv_bin_float)
 {
     Arguments arg = setup_csrsv_arguments(GetParam());
@@ -164,7 +186,8 @@ INSTANTIATE_TEST_CASE_P(csrsv,
                                          testing::ValuesIn(csrsv_idxbase_range),
                                          testing::ValuesIn(csrsv_op_range),
                                          testing::ValuesIn(csrsv_diag_range),
-                                         testing::ValuesIn(csrsv_fill_range)));
+                                         testing::ValuesIn(csrsv_fill_range),
+                                         testing::ValuesIn(csrsv_policy_range)));
 
 INSTANTIATE_TEST_CASE_P(csrsv_bin,
                         parameterized_csrsv_bin,
@@ -0,0 +1,223 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_diamv.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, double, double, base> diamv_tuple;
+typedef std::tuple<int, double, double, base> diamv_lap_tuple;
+typedef std::tuple<double, double, base, std::string> diamv_bin_tuple;
+
+int dia_M_range[]   = {-1, 0, 10, 500, 1000};
+int dia_N_range[]   = {-3, 0, 33, 842, 1000};
+int dia_dim_range[] = {1, 4, 16, 50, 200};
+
+std::vector<double> dia_alpha_range = {2.0, 3.0};
+std::vector<double> dia_beta_range  = {0.0, 0.6};
+
+base dia_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+std::string dia_bin[] = {"nos1.bin",
+                         "nos2.bin",
+                         "nos3.bin",
+                         "nos4.bin",
+                         "nos5.bin",
+                         "nos6.bin",
+                         "nos7.bin"};
+
+class parameterized_diamv : public testing::TestWithParam<diamv_tuple>
+{
+    protected:
+    parameterized_diamv() {}
+    virtual ~parameterized_diamv() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_diamv_lap : public testing::TestWithParam<diamv_lap_tuple>
+{
+    protected:
+    parameterized_diamv_lap() {}
+    virtual ~parameterized_diamv_lap() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_diamv_bin : public testing::TestWithParam<diamv_bin_tuple>
+{
+    protected:
+    parameterized_diamv_bin() {}
+    virtual ~parameterized_diamv_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_diamv_arguments(diamv_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.alpha    = std::get<2>(tup);
+    arg.beta     = std::get<3>(tup);
+    arg.idx_base = std::get<4>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+Arguments setup_diamv_arguments(diamv_lap_tuple tup)
+{
+    Arguments arg;
+    arg.M         = 0;
+    arg.N         = 0;
+    arg.laplacian = std::get<0>(tup);
+    arg.alpha     = std::get<1>(tup);
+    arg.beta      = std::get<2>(tup);
+    arg.idx_base  = std::get<3>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+Arguments setup_diamv_arguments(diamv_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M        = -99;
+    arg.N        = -99;
+    arg.alpha    = std::get<0>(tup);
+    arg.beta     = std::get<1>(tup);
+    arg.idx_base = std::get<2>(tup);
+    arg.timing   = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<3>(tup);
+
+    // Get current executables absolute path
+    char path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(diamv_bad_arg, diamv_float) { testing_diamv_bad_arg<float>(); }
+
+TEST_P(parameterized_diamv, diamv_float)
+{
+    Arguments arg = setup_diamv_arguments(GetParam());
+
+    rocsparse_status status = testing_diamv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_diamv, diamv_double)
+{
+    Arguments arg = setup_diamv_arguments(GetParam());
+
+    rocsparse_status status = testing_diamv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_diamv, diamv_float_complex)
+{
+    Arguments arg = setup_diamv_arguments(GetParam());
+
+    rocsparse_status status = testing_diamv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_diamv, diamv_double_complex)
+{
+    Arguments arg = setup_diamv_arguments(GetParam());
+
+    rocsparse_status status = testing_diamv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_diamv_lap, diamv_lap_float)
+{
+    Arguments arg = setup_diamv_arguments(GetParam());
+
+    rocsparse_status status = testing_diamv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_diamv_lap, diamv_lap_double)
+{
+    Arguments arg = setup_diamv_arguments(GetParam());
+
+    rocsparse_status status = testing_diamv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_diamv_bin, diamv_bin_float)
+{
+    Arguments arg = setup_diamv_arguments(GetParam());
+
+    rocsparse_status status = testing_diamv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_diamv_bin, diamv_bin_double)
+{
+    Arguments arg = setup_diamv_arguments(GetParam());
+
+    rocsparse_status status = testing_diamv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(diamv,
+                        parameterized_diamv,
+                        testing::Combine(testing::ValuesIn(dia_M_range),
+                                         testing::ValuesIn(dia_N_range),
+                                         testing::ValuesIn(dia_alpha_range),
+                                         testing::ValuesIn(dia_beta_range),
+                                         testing::ValuesIn(dia_idxbase_range)));
+
+INSTANTIATE_TEST_CASE_P(diamv_lap,
+                        parameterized_diamv_lap,
+                        testing::Combine(testing::ValuesIn(dia_dim_range),
+                                         testing::ValuesIn(dia_alpha_range),
+                                         testing::ValuesIn(dia_beta_range),
+                                         testing::ValuesIn(dia_idxbase_range)));
+
+INSTANTIATE_TEST_CASE_P(diamv_bin,
+                        parameterized_diamv_bin,
+                        testing::Combine(testing::ValuesIn(dia_alpha_range),
+                                         testing::ValuesIn(dia_beta_range),
+                                         testing::ValuesIn(dia_idxbase_range),
+                                         testing::ValuesIn(dia_bin)));
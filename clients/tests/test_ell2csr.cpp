@@ -131,6 +131,22 @@ TEST_P(parameterized_ell2csr, ell2csr_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_ell2csr, ell2csr_float_complex)
+{
+    Arguments arg = setup_ell2csr_arguments(GetParam());
+
+    rocsparse_status status = testing_ell2csr<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_ell2csr, ell2csr_double_complex)
+{
+    Arguments arg = setup_ell2csr_arguments(GetParam());
+
+    rocsparse_status status = testing_ell2csr<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_ell2csr_bin, ell2csr_bin_float)
 {
     Arguments arg = setup_ell2csr_arguments(GetParam());
@@ -134,6 +134,22 @@ TEST_P(parameterized_ellmv, ellmv_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_ellmv, ellmv_float_complex)
+{
+    Arguments arg = setup_ellmv_arguments(GetParam());
+
+    rocsparse_status status = testing_ellmv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_ellmv, ellmv_double_complex)
+{
+    Arguments arg = setup_ellmv_arguments(GetParam());
+
+    rocsparse_status status = testing_ellmv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_ellmv_bin, ellmv_bin_float)
 {
     Arguments arg = setup_ellmv_arguments(GetParam());
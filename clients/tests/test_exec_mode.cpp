@@ -0,0 +1,85 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_exec_mode.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+
+typedef std::tuple<int, double, double, base> exec_mode_tuple;
+
+int exec_mode_dim_range[] = {0, 1, 17, 63};
+
+double exec_mode_alpha_range[] = {2.0};
+double exec_mode_beta_range[]  = {1.0};
+
+base exec_mode_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_exec_mode : public testing::TestWithParam<exec_mode_tuple>
+{
+    protected:
+    parameterized_exec_mode() {}
+    virtual ~parameterized_exec_mode() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_exec_mode_arguments(exec_mode_tuple tup)
+{
+    Arguments arg;
+    arg.laplacian = std::get<0>(tup);
+    arg.alpha     = std::get<1>(tup);
+    arg.beta      = std::get<2>(tup);
+    arg.idx_base  = std::get<3>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(exec_mode_bad_arg, exec_mode_float) { testing_exec_mode_bad_arg<float>(); }
+
+TEST_P(parameterized_exec_mode, exec_mode_float)
+{
+    Arguments arg = setup_exec_mode_arguments(GetParam());
+
+    rocsparse_status status = testing_exec_mode<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_exec_mode, exec_mode_double)
+{
+    Arguments arg = setup_exec_mode_arguments(GetParam());
+
+    rocsparse_status status = testing_exec_mode<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(exec_mode,
+                        parameterized_exec_mode,
+                        testing::Combine(testing::ValuesIn(exec_mode_dim_range),
+                                         testing::ValuesIn(exec_mode_alpha_range),
+                                         testing::ValuesIn(exec_mode_beta_range),
+                                         testing::ValuesIn(exec_mode_idxbase_range)));
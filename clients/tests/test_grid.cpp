@@ -0,0 +1,197 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "grid.h"
+#include "merge_path.h"
+
+#include <gtest/gtest.h>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <rocsparse.h>
+
+// GTEST_SKIP is not available before googletest 1.10, report the skip in the test
+// output and in the xml properties instead
+#ifdef GTEST_SKIP
+#define ROCSPARSE_SKIP(msg) GTEST_SKIP() << msg
+#else
+#define ROCSPARSE_SKIP(msg)                               \
+    do                                                    \
+    {                                                     \
+        ::testing::Test::RecordProperty("skipped", msg);  \
+        std::cout << "[  SKIPPED ] " << msg << std::endl; \
+        return;                                           \
+    } while(0)
+#endif
+
+TEST(grid, grid_size)
+{
+    EXPECT_EQ(rocsparse_grid_size(0, 256), 1);
+    EXPECT_EQ(rocsparse_grid_size(1, 256), 1);
+    EXPECT_EQ(rocsparse_grid_size(256, 256), 1);
+    EXPECT_EQ(rocsparse_grid_size(257, 256), 2);
+
+    // One wavefront per row, wavefront_size * m exceeds 2^31
+    int64_t m = (int64_t(1) << 31) - 1;
+    EXPECT_EQ(rocsparse_grid_size(64 * m, 1024), (int64_t(1) << 27));
+    EXPECT_EQ(rocsparse_grid_size(64 * (m + 1) + 1, 1024), (int64_t(1) << 27) + 1);
+}
+
+TEST(grid, grid_dim)
+{
+    dim3 grid;
+
+    ASSERT_EQ(rocsparse_grid_dim(1000, 256, grid), rocsparse_status_success);
+    EXPECT_EQ(grid.x, 4u);
+    EXPECT_EQ(grid.y, 1u);
+
+    // Largest launch of 64 threads per row for m rows
+    int64_t m = ROCSPARSE_GRID_MAX_ITEMS / 64 / 1024 * 1024;
+    ASSERT_EQ(rocsparse_grid_dim(64 * m, 1024, grid), rocsparse_status_success);
+    EXPECT_EQ(int64_t(grid.x) * 1024, 64 * m);
+
+    // Launches beyond 2^32 work items are rejected instead of silently wrapping
+    EXPECT_EQ(rocsparse_grid_dim(64 * (m + 1024), 1024, grid), rocsparse_status_invalid_size);
+    EXPECT_EQ(rocsparse_grid_dim(int64_t(64) << 31, 1024, grid), rocsparse_status_invalid_size);
+}
+
+TEST(grid, wavefront_per_row)
+{
+    // Largest number of rows, such that one wavefront of 64 lanes per row can be launched.
+    // wavefront_size * m exceeds 2^31, while m itself fits into 32 bit rocsparse_int.
+    rocsparse_int m = (rocsparse_int(1) << 26) - 1;
+
+    for(int64_t wavefront_size : {32, 64})
+    {
+        dim3 grid;
+        ASSERT_EQ(rocsparse_grid_dim(wavefront_size * m, 1024, grid), rocsparse_status_success);
+
+        // The grid covers all rows, with less than one block to spare
+        EXPECT_GE(int64_t(grid.x) * 1024, wavefront_size * m);
+        EXPECT_LT(int64_t(grid.x - 1) * 1024, wavefront_size * m);
+    }
+
+    // One more row exceeds the 2^32 work items of a single grid
+    dim3 grid;
+    EXPECT_EQ(rocsparse_grid_dim(int64_t(64) * (m + 1), 1024, grid),
+              rocsparse_status_invalid_size);
+}
+
+TEST(grid, row_ptr)
+{
+    // Four rows holding 2^31 - 2 non-zeros, such that the one based row pointers still fit
+    // into 32 bit. The merge path diagonals of csrmv exceed 2^31 in the last row.
+    rocsparse_int nrows = 4;
+    rocsparse_int nnz   = std::numeric_limits<int32_t>::max() - 1;
+
+    for(rocsparse_index_base base : {rocsparse_index_base_zero, rocsparse_index_base_one})
+    {
+        std::vector<rocsparse_int> row_end = {rocsparse_int(1) << 29,
+                                              rocsparse_int(1) << 30,
+                                              (rocsparse_int(1) << 30) + (rocsparse_int(1) << 29),
+                                              nnz};
+
+        for(rocsparse_int& end : row_end)
+        {
+            end += base;
+        }
+
+        rocsparse_int row;
+        rocsparse_int nz;
+
+        // The diagonal right after the end of each row starts the next row
+        for(rocsparse_int i = 0; i < nrows; ++i)
+        {
+            int64_t diagonal = int64_t(row_end[i] - base) + i + 1;
+
+            rocsparse_merge_path_search(
+                diagonal, nrows, nnz, row_end.data(), 0, base, row, nz);
+
+            EXPECT_EQ(row, i + 1);
+            EXPECT_EQ(nz, row_end[i] - base);
+        }
+
+        // Diagonal above 2^31 inside the last row
+        rocsparse_merge_path_search(
+            int64_t(nnz) + 2, nrows, nnz, row_end.data(), 0, base, row, nz);
+
+        EXPECT_EQ(row, 3);
+        EXPECT_EQ(nz, nnz - 1);
+    }
+}
+
+TEST(grid, row_ptr_64)
+{
+    // 32 bit rocsparse_int cannot hold row pointers above 2^31
+    if(sizeof(rocsparse_int) < sizeof(int64_t))
+    {
+        ROCSPARSE_SKIP("row pointers above 2^31 require the 64 bit index build");
+    }
+
+    // Four rows holding 2^33 non-zeros
+    int64_t nrows = 4;
+    int64_t nnz   = int64_t(1) << 33;
+
+    std::vector<rocsparse_int> row_end(nrows);
+    for(int64_t i = 0; i < nrows; ++i)
+    {
+        row_end[i] = static_cast<rocsparse_int>((i + 1) * (nnz / nrows));
+    }
+
+    rocsparse_int row;
+    rocsparse_int nz;
+
+    // Each row starts on the diagonal right after the end of the previous row
+    for(int64_t i = 0; i < nrows; ++i)
+    {
+        int64_t diagonal = int64_t(row_end[i]) + i + 1;
+
+        rocsparse_merge_path_search(diagonal,
+                                    static_cast<rocsparse_int>(nrows),
+                                    static_cast<rocsparse_int>(nnz),
+                                    row_end.data(),
+                                    0,
+                                    rocsparse_index_base_zero,
+                                    row,
+                                    nz);
+
+        EXPECT_EQ(int64_t(row), i + 1);
+        EXPECT_EQ(int64_t(nz), int64_t(row_end[i]));
+    }
+
+    // Partitioning the merge path into tiles of 256 items starting at 2^32 + 2^31
+    int64_t diagonal = (int64_t(1) << 32) + (int64_t(1) << 31) + 256;
+
+    rocsparse_merge_path_search(diagonal,
+                                static_cast<rocsparse_int>(nrows),
+                                static_cast<rocsparse_int>(nnz),
+                                row_end.data(),
+                                0,
+                                rocsparse_index_base_zero,
+                                row,
+                                nz);
+
+    EXPECT_EQ(int64_t(row), 3);
+    EXPECT_EQ(int64_t(nz), diagonal - 3);
+}
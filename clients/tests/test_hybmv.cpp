@@ -145,6 +145,22 @@ TEST_P(parameterized_hybmv, hybmv_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_hybmv, hybmv_float_complex)
+{
+    Arguments arg = setup_hybmv_arguments(GetParam());
+
+    rocsparse_status status = testing_hybmv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_hybmv, hybmv_double_complex)
+{
+    Arguments arg = setup_hybmv_arguments(GetParam());
+
+    rocsparse_status status = testing_hybmv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_hybmv_bin, hybmv_bin_float)
 {
     Arguments arg = setup_hybmv_arguments(GetParam());
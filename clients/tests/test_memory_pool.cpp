@@ -0,0 +1,263 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "memory_pool.h"
+
+#include <cstdlib>
+#include <set>
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+
+// Host backend for the memory pool, that tracks live memory and the streams that
+// still have work queued
+struct host_allocator
+{
+    static size_t capacity;
+    static size_t live_bytes;
+    static size_t live_blocks;
+    static std::set<hipStream_t> busy;
+
+    static hipError_t allocate(void** ptr, size_t size)
+    {
+        if(live_bytes + size > capacity)
+        {
+            return hipErrorOutOfMemory;
+        }
+
+        *ptr = malloc(size + sizeof(size_t));
+        *reinterpret_cast<size_t*>(*ptr) = size;
+        *ptr = reinterpret_cast<size_t*>(*ptr) + 1;
+
+        live_bytes += size;
+        ++live_blocks;
+
+        return hipSuccess;
+    }
+
+    static hipError_t deallocate(void* ptr)
+    {
+        size_t* base = reinterpret_cast<size_t*>(ptr) - 1;
+
+        live_bytes -= *base;
+        --live_blocks;
+
+        free(base);
+
+        return hipSuccess;
+    }
+
+    static bool idle(hipStream_t stream)
+    {
+        return busy.count(stream) == 0;
+    }
+
+    static void reset()
+    {
+        capacity    = size_t(1) << 30;
+        live_bytes  = 0;
+        live_blocks = 0;
+        busy.clear();
+    }
+};
+
+size_t host_allocator::capacity    = size_t(1) << 30;
+size_t host_allocator::live_bytes  = 0;
+size_t host_allocator::live_blocks = 0;
+std::set<hipStream_t> host_allocator::busy;
+
+typedef rocsparse_memory_pool_t<host_allocator> host_memory_pool;
+
+static hipStream_t stream1 = reinterpret_cast<hipStream_t>(0x10);
+static hipStream_t stream2 = reinterpret_cast<hipStream_t>(0x20);
+
+TEST(memory_pool, bin_size)
+{
+    EXPECT_EQ(rocsparse_memory_pool_bin(0), 0);
+    EXPECT_EQ(rocsparse_memory_pool_bin(1), 0);
+    EXPECT_EQ(rocsparse_memory_pool_bin(256), 0);
+    EXPECT_EQ(rocsparse_memory_pool_bin(257), 1);
+    EXPECT_EQ(rocsparse_memory_pool_bin(512), 1);
+    EXPECT_EQ(rocsparse_memory_pool_bin(513), 2);
+    EXPECT_EQ(rocsparse_memory_pool_bin_size(0), size_t(256));
+    EXPECT_EQ(rocsparse_memory_pool_bin_size(2), size_t(1024));
+
+    // Each request fits its size class and wastes less than half of it
+    for(size_t size = 1; size < (size_t(1) << 20); size = size * 3 / 2 + 1)
+    {
+        size_t bin_size = rocsparse_memory_pool_bin_size(rocsparse_memory_pool_bin(size));
+
+        EXPECT_GE(bin_size, size);
+        EXPECT_TRUE(bin_size == 256 || bin_size < 2 * size);
+    }
+
+    // Requests above 2^31 bytes
+    size_t large = (size_t(1) << 33) + 1;
+    EXPECT_EQ(rocsparse_memory_pool_bin_size(rocsparse_memory_pool_bin(large)), size_t(1) << 34);
+}
+
+TEST(memory_pool, reuse_same_stream)
+{
+    host_allocator::reset();
+    {
+        host_memory_pool pool;
+
+        void* ptr1;
+        void* ptr2;
+        void* ptr3;
+
+        ASSERT_EQ(pool.allocate(&ptr1, 1000, stream1), hipSuccess);
+        EXPECT_EQ(pool.get_bytes_in_use(), size_t(1024));
+        ASSERT_EQ(pool.deallocate(ptr1, stream1), hipSuccess);
+        EXPECT_EQ(pool.get_bytes_in_use(), size_t(0));
+        EXPECT_EQ(pool.get_bytes_cached(), size_t(1024));
+
+        // Same size class, queued work on the same stream does not prevent reuse
+        host_allocator::busy.insert(stream1);
+
+        ASSERT_EQ(pool.allocate(&ptr2, 600, stream1), hipSuccess);
+        EXPECT_EQ(ptr2, ptr1);
+        EXPECT_EQ(pool.get_hits(), size_t(1));
+        EXPECT_EQ(pool.get_misses(), size_t(1));
+        EXPECT_EQ(pool.get_bytes_cached(), size_t(0));
+
+        // Different size class
+        ASSERT_EQ(pool.allocate(&ptr3, 2000, stream1), hipSuccess);
+        EXPECT_NE(ptr3, ptr1);
+        EXPECT_EQ(pool.get_misses(), size_t(2));
+        EXPECT_EQ(host_allocator::live_blocks, size_t(2));
+
+        ASSERT_EQ(pool.deallocate(ptr2, stream1), hipSuccess);
+        ASSERT_EQ(pool.deallocate(ptr3, stream1), hipSuccess);
+        EXPECT_EQ(pool.get_bytes_cached(), size_t(3072));
+    }
+
+    // All memory is returned on destruction
+    EXPECT_EQ(host_allocator::live_blocks, size_t(0));
+}
+
+TEST(memory_pool, reuse_other_stream)
+{
+    host_allocator::reset();
+    {
+        host_memory_pool pool;
+
+        void* ptr1;
+        void* ptr2;
+        void* ptr3;
+
+        ASSERT_EQ(pool.allocate(&ptr1, 4096, stream1), hipSuccess);
+        ASSERT_EQ(pool.deallocate(ptr1, stream1), hipSuccess);
+
+        // Work using the block may still be queued on stream1
+        host_allocator::busy.insert(stream1);
+
+        ASSERT_EQ(pool.allocate(&ptr2, 4096, stream2), hipSuccess);
+        EXPECT_NE(ptr2, ptr1);
+        EXPECT_EQ(pool.get_hits(), size_t(0));
+
+        // Once stream1 is idle, its block can be used on stream2
+        host_allocator::busy.clear();
+
+        ASSERT_EQ(pool.allocate(&ptr3, 4096, stream2), hipSuccess);
+        EXPECT_EQ(ptr3, ptr1);
+        EXPECT_EQ(pool.get_hits(), size_t(1));
+
+        ASSERT_EQ(pool.deallocate(ptr2, stream2), hipSuccess);
+        ASSERT_EQ(pool.deallocate(ptr3, stream2), hipSuccess);
+    }
+
+    EXPECT_EQ(host_allocator::live_blocks, size_t(0));
+}
+
+TEST(memory_pool, limit)
+{
+    host_allocator::reset();
+    {
+        host_memory_pool pool;
+
+        void* ptr1;
+        void* ptr2;
+        void* ptr3;
+
+        ASSERT_EQ(pool.set_limit(2048), hipSuccess);
+        EXPECT_EQ(pool.get_limit(), size_t(2048));
+
+        ASSERT_EQ(pool.allocate(&ptr1, 1024, stream1), hipSuccess);
+        ASSERT_EQ(pool.allocate(&ptr2, 1024, stream1), hipSuccess);
+        ASSERT_EQ(pool.allocate(&ptr3, 4096, stream1), hipSuccess);
+
+        // Blocks larger than the limit are not cached
+        ASSERT_EQ(pool.deallocate(ptr3, stream1), hipSuccess);
+        EXPECT_EQ(pool.get_bytes_cached(), size_t(0));
+        EXPECT_EQ(host_allocator::live_blocks, size_t(2));
+
+        ASSERT_EQ(pool.deallocate(ptr1, stream1), hipSuccess);
+        ASSERT_EQ(pool.deallocate(ptr2, stream1), hipSuccess);
+        EXPECT_EQ(pool.get_bytes_cached(), size_t(2048));
+        EXPECT_EQ(host_allocator::live_blocks, size_t(2));
+
+        // Lowering the limit releases idle memory
+        ASSERT_EQ(pool.set_limit(1024), hipSuccess);
+        EXPECT_EQ(pool.get_bytes_cached(), size_t(1024));
+        EXPECT_EQ(host_allocator::live_blocks, size_t(1));
+
+        ASSERT_EQ(pool.set_limit(0), hipSuccess);
+        EXPECT_EQ(pool.get_bytes_cached(), size_t(0));
+        EXPECT_EQ(host_allocator::live_blocks, size_t(0));
+    }
+
+    EXPECT_EQ(host_allocator::live_blocks, size_t(0));
+}
+
+TEST(memory_pool, out_of_memory)
+{
+    host_allocator::reset();
+    host_allocator::capacity = 8192;
+    {
+        host_memory_pool pool;
+
+        void* ptr1;
+        void* ptr2;
+
+        ASSERT_EQ(pool.allocate(&ptr1, 4096, stream1), hipSuccess);
+        ASSERT_EQ(pool.deallocate(ptr1, stream1), hipSuccess);
+
+        // Idle memory is released to serve the request
+        ASSERT_EQ(pool.allocate(&ptr2, 8192, stream1), hipSuccess);
+        EXPECT_EQ(pool.get_bytes_cached(), size_t(0));
+        EXPECT_EQ(host_allocator::live_blocks, size_t(1));
+
+        // Request that cannot be served
+        void* ptr3 = &ptr1;
+        EXPECT_EQ(pool.allocate(&ptr3, 256, stream1), hipErrorOutOfMemory);
+        EXPECT_EQ(ptr3, nullptr);
+
+        // Unknown pointers are rejected
+        EXPECT_EQ(pool.deallocate(&ptr1, stream1), hipErrorInvalidValue);
+        EXPECT_EQ(pool.deallocate(nullptr, stream1), hipSuccess);
+
+        ASSERT_EQ(pool.deallocate(ptr2, stream1), hipSuccess);
+    }
+
+    EXPECT_EQ(host_allocator::live_blocks, size_t(0));
+}
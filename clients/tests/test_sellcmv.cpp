@@ -0,0 +1,188 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_sellcmv.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, int, double, double, base> sellcmv_tuple;
+typedef std::tuple<int, double, double, base, std::string> sellcmv_bin_tuple;
+
+int sellc_M_range[]     = {-1, 0, 10, 500, 7111};
+int sellc_N_range[]     = {-3, 0, 33, 842, 4441};
+int sellc_sigma_range[] = {1, 32, 64, 256, 4096};
+
+std::vector<double> sellc_alpha_range = {2.0, 3.0};
+std::vector<double> sellc_beta_range  = {0.0, 0.6};
+
+base sellc_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+int sellc_bin_sigma_range[] = {1, 64, 1024};
+
+std::string sellc_bin[] = {"rma10.bin",
+                           "mac_econ_fwd500.bin",
+                           "bibd_22_8.bin",
+                           "mc2depi.bin",
+                           "scircuit.bin",
+                           "nos1.bin",
+                           "nos2.bin",
+                           "nos3.bin",
+                           "nos4.bin",
+                           "nos5.bin",
+                           "nos6.bin",
+                           "nos7.bin"};
+
+class parameterized_sellcmv : public testing::TestWithParam<sellcmv_tuple>
+{
+    protected:
+    parameterized_sellcmv() {}
+    virtual ~parameterized_sellcmv() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_sellcmv_bin : public testing::TestWithParam<sellcmv_bin_tuple>
+{
+    protected:
+    parameterized_sellcmv_bin() {}
+    virtual ~parameterized_sellcmv_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_sellcmv_arguments(sellcmv_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.sigma    = std::get<2>(tup);
+    arg.alpha    = std::get<3>(tup);
+    arg.beta     = std::get<4>(tup);
+    arg.idx_base = std::get<5>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+Arguments setup_sellcmv_arguments(sellcmv_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M        = -99;
+    arg.N        = -99;
+    arg.sigma    = std::get<0>(tup);
+    arg.alpha    = std::get<1>(tup);
+    arg.beta     = std::get<2>(tup);
+    arg.idx_base = std::get<3>(tup);
+    arg.timing   = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<4>(tup);
+
+    // Get current executables absolute path
+    char path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(sellcmv_bad_arg, sellcmv_float) { testing_sellcmv_bad_arg<float>(); }
+
+TEST_P(parameterized_sellcmv, sellcmv_float)
+{
+    Arguments arg = setup_sellcmv_arguments(GetParam());
+
+    rocsparse_status status = testing_sellcmv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_sellcmv, sellcmv_double)
+{
+    Arguments arg = setup_sellcmv_arguments(GetParam());
+
+    rocsparse_status status = testing_sellcmv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_sellcmv, sellcmv_float_complex)
+{
+    Arguments arg = setup_sellcmv_arguments(GetParam());
+
+    rocsparse_status status = testing_sellcmv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_sellcmv, sellcmv_double_complex)
+{
+    Arguments arg = setup_sellcmv_arguments(GetParam());
+
+    rocsparse_status status = testing_sellcmv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_sellcmv_bin, sellcmv_bin_float)
+{
+    Arguments arg = setup_sellcmv_arguments(GetParam());
+
+    rocsparse_status status = testing_sellcmv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_sellcmv_bin, sellcmv_bin_double)
+{
+    Arguments arg = setup_sellcmv_arguments(GetParam());
+
+    rocsparse_status status = testing_sellcmv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(sellcmv,
+                        parameterized_sellcmv,
+                        testing::Combine(testing::ValuesIn(sellc_M_range),
+                                         testing::ValuesIn(sellc_N_range),
+                                         testing::ValuesIn(sellc_sigma_range),
+                                         testing::ValuesIn(sellc_alpha_range),
+                                         testing::ValuesIn(sellc_beta_range),
+                                         testing::ValuesIn(sellc_idxbase_range)));
+
+INSTANTIATE_TEST_CASE_P(sellcmv_bin,
+                        parameterized_sellcmv_bin,
+                        testing::Combine(testing::ValuesIn(sellc_bin_sigma_range),
+                                         testing::ValuesIn(sellc_alpha_range),
+                                         testing::ValuesIn(sellc_beta_range),
+                                         testing::ValuesIn(sellc_idxbase_range),
+                                         testing::ValuesIn(sellc_bin)));
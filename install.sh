@@ -18,6 +18,7 @@ function display_help()
   echo "    [-g|--debug] -DCMAKE_BUILD_TYPE=Debug (default is =Release)"
 #  echo "    [--cuda] build library for cuda backend"
   echo "    [--hip-clang] build library for amdgpu backend using hip-clang"
+  echo "    [--ilp64] build library with 64 bit rocsparse_int"
 }
 
 # This function is helpful for dockerfiles that do not have sudo installed, but the default user is root
@@ -200,6 +201,7 @@ build_clients=false
 build_cuda=false
 build_release=true
 build_hip_clang=false
+build_ilp64=false
 
 # #################################################
 # Parameter parsing
@@ -208,7 +210,7 @@ build_hip_clang=false
 # check if we have a modern version of getopt that can handle whitespace and long parameters
 getopt -T
 if [[ $? -eq 4 ]]; then
-  GETOPT_PARSE=$(getopt --name "${0}" --longoptions help,install,clients,dependencies,debug,hip-clang --options hicdg -- "$@")
+  GETOPT_PARSE=$(getopt --name "${0}" --longoptions help,install,clients,dependencies,debug,hip-clang,ilp64 --options hicdg -- "$@")
 else
   echo "Need a new version of getopt"
   exit 1
@@ -245,6 +247,9 @@ while true; do
     --hip-clang)
         build_hip_clang=true
         shift ;;
+    --ilp64)
+        build_ilp64=true
+        shift ;;
     --prefix)
         install_prefix=${2}
         shift 2 ;;
@@ -319,6 +324,11 @@ pushd .
     cmake_client_options="${cmake_client_options} -DBUILD_CLIENTS_SAMPLES=ON -DBUILD_CLIENTS_TESTS=ON -DBUILD_CLIENTS_BENCHMARKS=ON"
   fi
 
+  # 64 bit indices
+  if [[ "${build_ilp64}" == true ]]; then
+    cmake_common_options="${cmake_common_options} -DBUILD_WITH_ILP64=ON"
+  fi
+
   # cpack
   cmake_common_options="${cmake_common_options} -DCPACK_SET_DESTDIR=OFF -DCPACK_PACKAGING_INSTALL_PREFIX=/opt/rocm"
 
@@ -173,6 +173,67 @@ ROCSPARSE_EXPORT
 rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle handle,
                                             rocsparse_pointer_mode* pointer_mode);
 
+/*! \ingroup aux_module
+ *  \brief Specify execution mode
+ *
+ *  \details
+ *  \p rocsparse_set_exec_mode specifies the execution mode to be used by the rocSPARSE
+ *  library context and all subsequent function calls. By default, routines may block
+ *  the host until scalar results or sizes of output structures are available. In
+ *  \ref rocsparse_exec_mode_async mode, the following routines only enqueue work on
+ *  the stream of the library context and never synchronize with the device:
+ *  - rocsparse_sdoti() and rocsparse_ddoti(). Scalar results are written to device
+ *    memory, thus \ref rocsparse_pointer_mode_device is required.
+ *  - rocsparse_scsr2hyb() and rocsparse_dcsr2hyb(). The number of CSR non-zero
+ *    entries is bounded by rocsparse_set_hyb_mat_nnz_bound() and the COO part of the
+ *    HYB matrix is sized by this bound. Its unused entries are padded such that they
+ *    do not contribute to rocsparse_shybmv() and rocsparse_dhybmv().
+ *    \ref rocsparse_hyb_partition_max is not supported.
+ *  - rocsparse_scsrmv_analysis() and rocsparse_dcsrmv_analysis() with
+ *    \ref rocsparse_csrmv_alg_merge, and rocsparse_scsrmv() and rocsparse_dcsrmv().
+ *    \ref rocsparse_csrmv_alg_adaptive is not supported.
+ *  - rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+ *    rocsparse_scsrilu0_analysis() and rocsparse_dcsrilu0_analysis(). Meta data of the
+ *    analysis, such as the maximum depth, is kept in device memory and the rows are
+ *    processed in their natural order.
+ *  - rocsparse_scsrsv_solve(), rocsparse_dcsrsv_solve(), rocsparse_scsrilu0() and
+ *    rocsparse_dcsrilu0().
+ *  - rocsparse_csrsv_zero_pivot() and rocsparse_csrilu0_zero_pivot() in
+ *    \ref rocsparse_pointer_mode_device. The position is written to device memory and
+ *    \ref rocsparse_status_zero_pivot is not reported.
+ *
+ *  @param[in]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  exec_mode   the execution mode to be used by the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value \p exec_mode is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_exec_mode(rocsparse_handle handle, rocsparse_exec_mode exec_mode);
+
+/*! \ingroup aux_module
+ *  \brief Get current execution mode from library context
+ *
+ *  \details
+ *  \p rocsparse_get_exec_mode gets the rocSPARSE library context execution mode which
+ *  is currently used for all subsequent function calls.
+ *
+ *  @param[in]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  exec_mode   the execution mode that is currently used by the rocSPARSE library
+ *              context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p exec_mode pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_exec_mode(rocsparse_handle handle, rocsparse_exec_mode* exec_mode);
+
 /*! \ingroup aux_module
  *  \brief Get rocSPARSE version
  *
@@ -193,6 +254,131 @@ rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle handle,
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_get_version(rocsparse_handle handle, int* version);
 
+/*! \ingroup aux_module
+ *  \brief Specify the capacity of the csrmv analysis cache
+ *
+ *  \details
+ *  \p rocsparse_set_csrmv_cache_capacity enables the csrmv analysis cache of the
+ *  rocSPARSE library context. The cache holds the row blocks computed by
+ *  rocsparse_scsrmv_analysis() and rocsparse_dcsrmv_analysis(), identified by the
+ *  matrix dimensions, the number of non-zero entries and a fingerprint of the row
+ *  pointer array. Subsequent analysis calls on a known sparsity pattern copy the cached
+ *  row blocks instead of computing them, even if the matrix is stored in different
+ *  buffers. If the cache is full, the least recently used entry is evicted.
+ *  By default, the cache is disabled.
+ *
+ *  \note
+ *  Only the row blocks of \ref rocsparse_csrmv_alg_adaptive are cached.
+ *
+ *  \note
+ *  Each entry keeps a copy of the row pointer array in device memory. A matching
+ *  fingerprint is verified against this copy, such that different sparsity patterns
+ *  with the same fingerprint never share row blocks. A cache hit still computes the
+ *  fingerprint and verifies the row pointers on the device, and reads both results
+ *  back to the host.
+ *
+ *  @param[inout]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  capacity    maximum number of cached sparsity patterns. A capacity of 0 disables
+ *              the cache and frees all cached entries.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_size \p capacity is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_csrmv_cache_capacity(rocsparse_handle handle,
+                                                    rocsparse_int capacity);
+
+/*! \ingroup aux_module
+ *  \brief Get csrmv analysis cache statistics
+ *
+ *  \details
+ *  \p rocsparse_get_csrmv_cache_stats returns the number of csrmv analysis calls of the
+ *  rocSPARSE library context that found their sparsity pattern in the csrmv analysis
+ *  cache (hits) and that had to compute the row blocks (misses), while the cache was
+ *  enabled.
+ *
+ *  @param[in]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  hits        number of cache hits.
+ *  @param[out]
+ *  misses      number of cache misses.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p hits or \p misses pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_get_csrmv_cache_stats(rocsparse_handle handle, size_t* hits, size_t* misses);
+
+/*! \ingroup aux_module
+ *  \brief Set the memory pool limit
+ *
+ *  \details
+ *  \p rocsparse_set_memory_pool_limit sets the amount of idle device memory that the
+ *  rocSPARSE library context keeps for reuse. Temporary device memory that is required
+ *  by rocSPARSE routines, e.g. during analysis or format conversion, is served from a
+ *  memory pool with power of two size classes. Memory that has been released by a
+ *  routine is handed out again to subsequent routines on the same stream without
+ *  device synchronization. Idle memory that exceeds the limit is freed. By default,
+ *  the limit is 256 MB.
+ *
+ *  \note
+ *  Device memory that is owned by info structures or matrices, e.g. the meta data of
+ *  rocsparse_scsrmv_analysis(), rocsparse_scsrsv_analysis() and
+ *  rocsparse_scsrilu0_analysis() or the arrays of a HYB, SELL-C-sigma or CSR5 matrix,
+ *  is allocated from the memory pool as well. It is returned to the pool when the info
+ *  structure or matrix is destroyed, which keeps the pool alive beyond the lifetime of
+ *  the rocSPARSE library context if necessary.
+ *
+ *  @param[inout]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  limit       maximum number of idle bytes kept in the memory pool. A limit of 0
+ *              frees all idle memory and disables caching.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_memory_pool_limit(rocsparse_handle handle, size_t limit);
+
+/*! \ingroup aux_module
+ *  \brief Get memory pool statistics
+ *
+ *  \details
+ *  \p rocsparse_get_memory_pool_stats returns the device memory that is currently
+ *  used by rocSPARSE routines and kept idle in the memory pool of the rocSPARSE
+ *  library context, as well as the number of requests that have been served from
+ *  idle memory (hits) and that required a device allocation (misses).
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  bytes_in_use    number of bytes currently used by rocSPARSE routines.
+ *  @param[out]
+ *  bytes_cached    number of idle bytes kept for reuse.
+ *  @param[out]
+ *  hits            number of requests served from idle memory.
+ *  @param[out]
+ *  misses          number of requests that required a device allocation.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p bytes_in_use, \p bytes_cached,
+ *          \p hits or \p misses pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_memory_pool_stats(rocsparse_handle handle,
+                                                 size_t* bytes_in_use,
+                                                 size_t* bytes_cached,
+                                                 size_t* hits,
+                                                 size_t* misses);
+
 /*! \ingroup aux_module
  *  \brief Create a matrix descriptor
  *  \details
@@ -418,6 +604,128 @@ rocsparse_status rocsparse_create_hyb_mat(rocsparse_hyb_mat* hyb);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb);
 
+/*! \ingroup aux_module
+ *  \brief Specify an upper bound of the non-zero entries of a \p HYB matrix
+ *
+ *  \details
+ *  \p rocsparse_set_hyb_mat_nnz_bound sets an upper bound of the number of non-zero
+ *  entries of the CSR matrix that is converted into the \p HYB matrix. The bound is
+ *  required by rocsparse_scsr2hyb() and rocsparse_dcsr2hyb() in
+ *  \ref rocsparse_exec_mode_async mode, where the size of the \p HYB matrix cannot be
+ *  obtained from the device.
+ *
+ *  \note
+ *  If the CSR matrix holds more non-zero entries than \p nnz_bound, the entries that
+ *  exceed the COO part of the \p HYB matrix are discarded and the \p HYB matrix is
+ *  incomplete. Memory outside of the \p HYB matrix is never accessed.
+ *
+ *  @param[inout]
+ *  hyb         the hybrid matrix structure.
+ *  @param[in]
+ *  nnz_bound   upper bound of the number of non-zero entries.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p hyb pointer is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz_bound is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_hyb_mat_nnz_bound(rocsparse_hyb_mat hyb, rocsparse_int nnz_bound);
+
+/*! \ingroup aux_module
+ *  \brief Create a \p SELL-C-\f$\sigma\f$ matrix structure
+ *
+ *  \details
+ *  \p rocsparse_create_sellc_mat creates a structure that holds the matrix in
+ *  \p SELL-C-\f$\sigma\f$ storage format. It should be destroyed at the end using
+ *  rocsparse_destroy_sellc_mat().
+ *
+ *  @param[inout]
+ *  sellc   the pointer to the SELL-C-\f$\sigma\f$ matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p sellc pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_sellc_mat(rocsparse_sellc_mat* sellc);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a \p SELL-C-\f$\sigma\f$ matrix structure
+ *
+ *  \details
+ *  \p rocsparse_destroy_sellc_mat destroys a \p SELL-C-\f$\sigma\f$ structure.
+ *
+ *  @param[in]
+ *  sellc   the SELL-C-\f$\sigma\f$ matrix structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p sellc pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_sellc_mat(rocsparse_sellc_mat sellc);
+
+/*! \ingroup aux_module
+ *  \brief Get the padding of a \p SELL-C-\f$\sigma\f$ matrix
+ *
+ *  \details
+ *  \p rocsparse_get_sellc_mat_padding returns the number of entries that are stored
+ *  in the \p SELL-C-\f$\sigma\f$ matrix, including the padding of each slice, and the
+ *  relative padding overhead \f$(\text{sell_nnz} - \text{nnz}) / \text{nnz}\f$ with
+ *  respect to the CSR matrix it has been converted from. The overhead is computed on
+ *  the host during rocsparse_scsr2sellc(), rocsparse_dcsr2sellc(),
+ *  rocsparse_ccsr2sellc() and rocsparse_zcsr2sellc() and can be compared to the
+ *  padding of the ELL and HYB formats, e.g. \f$(m \cdot \text{ell_width} -
+ *  \text{nnz}) / \text{nnz}\f$.
+ *
+ *  @param[in]
+ *  sellc       the SELL-C-\f$\sigma\f$ matrix structure.
+ *  @param[out]
+ *  sell_nnz    number of stored entries, including padding.
+ *  @param[out]
+ *  padding     relative padding overhead.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p sellc, \p sell_nnz or \p padding
+ *          pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_sellc_mat_padding(const rocsparse_sellc_mat sellc,
+                                                 rocsparse_int* sell_nnz,
+                                                 double* padding);
+
+/*! \ingroup aux_module
+ *  \brief Create a \p CSR5 matrix structure
+ *
+ *  \details
+ *  \p rocsparse_create_csr5_mat creates a structure that holds the tile descriptor of
+ *  a matrix in \p CSR5 storage format. It should be destroyed at the end using
+ *  rocsparse_destroy_csr5_mat().
+ *
+ *  @param[inout]
+ *  csr5    the pointer to the CSR5 matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p csr5 pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_csr5_mat(rocsparse_csr5_mat* csr5);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a \p CSR5 matrix structure
+ *
+ *  \details
+ *  \p rocsparse_destroy_csr5_mat destroys a \p CSR5 structure.
+ *
+ *  @param[in]
+ *  csr5    the CSR5 matrix structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p csr5 pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_csr5_mat(rocsparse_csr5_mat csr5);
+
 /*! \ingroup aux_module
  *  \brief Create a matrix info structure
  *
@@ -451,6 +759,43 @@ rocsparse_status rocsparse_create_mat_info(rocsparse_mat_info* info);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info);
 
+/*! \ingroup aux_module
+ *  \brief Specify the csrmv algorithm of a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_set_mat_info_csrmv_alg sets the algorithm that is used by
+ *  rocsparse_csrmv_analysis() and rocsparse_csrmv() for the given matrix info
+ *  structure. Valid algorithms are \ref rocsparse_csrmv_alg_adaptive and
+ *  \ref rocsparse_csrmv_alg_merge. The algorithm has to be set prior to the analysis.
+ *
+ *  @param[inout]
+ *  info    the info structure.
+ *  @param[in]
+ *  alg     \ref rocsparse_csrmv_alg_adaptive or \ref rocsparse_csrmv_alg_merge.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p alg is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_mat_info_csrmv_alg(rocsparse_mat_info info,
+                                                  rocsparse_csrmv_alg alg);
+
+/*! \ingroup aux_module
+ *  \brief Get the csrmv algorithm of a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_get_mat_info_csrmv_alg returns the csrmv algorithm of a matrix info
+ *  structure.
+ *
+ *  @param[in]
+ *  info    the info structure.
+ *
+ *  \returns   \ref rocsparse_csrmv_alg_adaptive or \ref rocsparse_csrmv_alg_merge.
+ */
+ROCSPARSE_EXPORT
+rocsparse_csrmv_alg rocsparse_get_mat_info_csrmv_alg(const rocsparse_mat_info info);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,259 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+/*! \file
+ * \brief rocsparse-complex-types.h defines complex data types used by rocsparse
+ */
+
+#pragma once
+#ifndef _ROCSPARSE_COMPLEX_TYPES_H_
+#define _ROCSPARSE_COMPLEX_TYPES_H_
+
+#if !defined(__cplusplus) || (!defined(__HCC__) && !defined(__HIPCC__))
+
+/* C compilers and host-only C++ compilers only see the memory layout of the
+ * complex types, which is compatible to the full C++ class below.
+ */
+
+/*! \ingroup types_module
+ *  \brief Single precision complex number.
+ */
+typedef struct
+{
+    float x, y;
+} rocsparse_float_complex;
+
+/*! \ingroup types_module
+ *  \brief Double precision complex number.
+ */
+typedef struct
+{
+    double x, y;
+} rocsparse_double_complex;
+
+#else
+
+#include <cmath>
+#include <ostream>
+#include <hip/hip_runtime.h>
+
+/*! \ingroup types_module
+ *  \brief Complex number with host and device arithmetic.
+ *
+ *  \details
+ *  \p rocsparse_complex_num stores the real part in \p x and the imaginary part in
+ *  \p y. It is trivially copyable and has the same memory layout as two consecutive
+ *  numbers of type \p T, thus arrays can be shared with other complex types such as
+ *  \p hipFloatComplex or \p std::complex<float>.
+ */
+template <typename T>
+class rocsparse_complex_num
+{
+    public:
+    T x; ///< Real part.
+    T y; ///< Imaginary part.
+
+    rocsparse_complex_num() = default;
+
+    __device__ __host__ constexpr rocsparse_complex_num(T real, T imag = static_cast<T>(0))
+        : x(real)
+        , y(imag)
+    {
+    }
+
+    // Conversion between precisions
+    template <typename U>
+    __device__ __host__ explicit constexpr rocsparse_complex_num(const rocsparse_complex_num<U>& z)
+        : x(static_cast<T>(z.x))
+        , y(static_cast<T>(z.y))
+    {
+    }
+
+    __device__ __host__ constexpr T real() const
+    {
+        return x;
+    }
+
+    __device__ __host__ constexpr T imag() const
+    {
+        return y;
+    }
+
+    __device__ __host__ rocsparse_complex_num& operator+=(const rocsparse_complex_num& rhs)
+    {
+        x += rhs.x;
+        y += rhs.y;
+        return *this;
+    }
+
+    __device__ __host__ rocsparse_complex_num& operator-=(const rocsparse_complex_num& rhs)
+    {
+        x -= rhs.x;
+        y -= rhs.y;
+        return *this;
+    }
+
+    __device__ __host__ rocsparse_complex_num& operator*=(const rocsparse_complex_num& rhs)
+    {
+        T re = x * rhs.x - y * rhs.y;
+
+        y = x * rhs.y + y * rhs.x;
+        x = re;
+
+        return *this;
+    }
+
+    // Smith's algorithm, avoids overflow of the squared magnitude of rhs
+    __device__ __host__ rocsparse_complex_num& operator/=(const rocsparse_complex_num& rhs)
+    {
+        T re;
+
+        if((rhs.x < 0 ? -rhs.x : rhs.x) >= (rhs.y < 0 ? -rhs.y : rhs.y))
+        {
+            T ratio = rhs.y / rhs.x;
+            T scale = static_cast<T>(1) / (rhs.x + rhs.y * ratio);
+
+            re = (x + y * ratio) * scale;
+            y    = (y - x * ratio) * scale;
+        }
+        else
+        {
+            T ratio = rhs.x / rhs.y;
+            T scale = static_cast<T>(1) / (rhs.x * ratio + rhs.y);
+
+            re = (y + x * ratio) * scale;
+            y    = (y * ratio - x) * scale;
+        }
+
+        x = re;
+
+        return *this;
+    }
+
+    friend __device__ __host__ constexpr rocsparse_complex_num
+        operator+(const rocsparse_complex_num& z)
+    {
+        return z;
+    }
+
+    friend __device__ __host__ constexpr rocsparse_complex_num
+        operator-(const rocsparse_complex_num& z)
+    {
+        return rocsparse_complex_num(-z.x, -z.y);
+    }
+
+    friend __device__ __host__ rocsparse_complex_num operator+(rocsparse_complex_num lhs,
+                                                               const rocsparse_complex_num& rhs)
+    {
+        return lhs += rhs;
+    }
+
+    friend __device__ __host__ rocsparse_complex_num operator-(rocsparse_complex_num lhs,
+                                                               const rocsparse_complex_num& rhs)
+    {
+        return lhs -= rhs;
+    }
+
+    friend __device__ __host__ rocsparse_complex_num operator*(rocsparse_complex_num lhs,
+                                                               const rocsparse_complex_num& rhs)
+    {
+        return lhs *= rhs;
+    }
+
+    friend __device__ __host__ rocsparse_complex_num operator/(rocsparse_complex_num lhs,
+                                                               const rocsparse_complex_num& rhs)
+    {
+        return lhs /= rhs;
+    }
+
+    friend __device__ __host__ constexpr bool operator==(const rocsparse_complex_num& lhs,
+                                                         const rocsparse_complex_num& rhs)
+    {
+        return lhs.x == rhs.x && lhs.y == rhs.y;
+    }
+
+    friend __device__ __host__ constexpr bool operator!=(const rocsparse_complex_num& lhs,
+                                                         const rocsparse_complex_num& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const rocsparse_complex_num& z)
+    {
+        return os << '(' << z.x << ',' << z.y << ')';
+    }
+};
+
+/*! \ingroup types_module
+ *  \brief Single precision complex number.
+ */
+typedef rocsparse_complex_num<float> rocsparse_float_complex;
+
+/*! \ingroup types_module
+ *  \brief Double precision complex number.
+ */
+typedef rocsparse_complex_num<double> rocsparse_double_complex;
+
+// Overloads of the std complex functions, such that templated code can use
+// std::real, std::imag, std::conj and std::abs on rocsparse complex types
+namespace std {
+template <typename T>
+__device__ __host__ constexpr T real(const rocsparse_complex_num<T>& z)
+{
+    return z.x;
+}
+
+template <typename T>
+__device__ __host__ constexpr T imag(const rocsparse_complex_num<T>& z)
+{
+    return z.y;
+}
+
+template <typename T>
+__device__ __host__ constexpr rocsparse_complex_num<T> conj(const rocsparse_complex_num<T>& z)
+{
+    return rocsparse_complex_num<T>(z.x, -z.y);
+}
+
+template <typename T>
+__device__ __host__ inline T abs(const rocsparse_complex_num<T>& z)
+{
+    return hypot(z.x, z.y);
+}
+
+// Fused multiply-add p * q + r, using two fused multiply-adds for each of the
+// real and imaginary part
+template <typename T>
+__device__ __host__ inline rocsparse_complex_num<T> fma(const rocsparse_complex_num<T>& p,
+                                                        const rocsparse_complex_num<T>& q,
+                                                        const rocsparse_complex_num<T>& r)
+{
+    return rocsparse_complex_num<T>(fma(p.x, q.x, fma(-p.y, q.y, r.x)),
+                                    fma(p.x, q.y, fma(p.y, q.x, r.y)));
+}
+}
+
+#endif
+
+#endif // _ROCSPARSE_COMPLEX_TYPES_H_
@@ -166,7 +166,8 @@ rocsparse_status rocsparse_zaxpyi(rocsparse_handle handle,
  *
  *  \retval rocsparse_status_success the operation completed successfully.
  *  \retval rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid, or \p result is
+ *          a host pointer in \ref rocsparse_exec_mode_async mode.
  *  \retval rocsparse_status_invalid_size \p nnz is invalid.
  *  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind, \p y or \p result
  *          pointer is invalid.
@@ -633,7 +634,7 @@ rocsparse_status rocsparse_dcoomv(rocsparse_handle handle,
                                   const double* x,
                                   const double* beta,
                                   double* y);
-/*
+
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_ccoomv(rocsparse_handle handle,
                                   rocsparse_operation trans,
@@ -663,7 +664,142 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle handle,
                                   const rocsparse_double_complex* x,
                                   const rocsparse_double_complex* beta,
                                   rocsparse_double_complex* y);
-*/
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix multi-vector multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrmv_multi multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times n\f$ matrix, defined in CSR storage format, and \p k dense vectors
+ *  \f$X\f$ and adds the result to the \p k dense vectors \f$Y\f$ that are multiplied
+ *  by the scalar \f$\beta\f$, such that
+ *  \f[
+ *    Y := \alpha \cdot op(A) \cdot X + \beta \cdot Y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  The vectors are stored interleaved, i.e. \f$X\f$ and \f$Y\f$ are dense matrices in
+ *  row-major storage format with leading dimension \p k. The sparse matrix is read only
+ *  once for all \p k vectors.
+ *
+ *  The \p info parameter is optional and contains information collected by
+ *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis(). If present, the row
+ *  blocks of \ref rocsparse_csrmv_alg_adaptive are used to balance the work.
+ *
+ *  \code{.c}
+ *      for(i = 0; i < m; ++i)
+ *      {
+ *          for(v = 0; v < k; ++v)
+ *          {
+ *              y[i * k + v] = beta * y[i * k + v];
+ *
+ *              for(j = csr_row_ptr[i]; j < csr_row_ptr[i + 1]; ++j)
+ *              {
+ *                  y[i * k + v] += alpha * csr_val[j] * x[csr_col_ind[j] * k + v];
+ *              }
+ *          }
+ *      }
+ *  \endcode
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported. For a large
+ *  number of vectors, rocsparse_scsrmm() and rocsparse_dcsrmm() should be used instead.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  k           number of dense vectors, at most 16.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        information collected by rocsparse_scsrmv_analysis() or
+ *              rocsparse_dcsrmv_analysis(), can be \p NULL if no information is
+ *              available.
+ *  @param[in]
+ *  x           array of \p n * \p k elements, the \p k vectors stored interleaved.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m * \p k elements, the \p k vectors stored interleaved.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz or \p k is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmv_multi(rocsparse_handle handle,
+                                        rocsparse_operation trans,
+                                        rocsparse_int m,
+                                        rocsparse_int n,
+                                        rocsparse_int nnz,
+                                        rocsparse_int k,
+                                        const float* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const float* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        rocsparse_mat_info info,
+                                        const float* x,
+                                        const float* beta,
+                                        float* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_multi(rocsparse_handle handle,
+                                        rocsparse_operation trans,
+                                        rocsparse_int m,
+                                        rocsparse_int n,
+                                        rocsparse_int nnz,
+                                        rocsparse_int k,
+                                        const double* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const double* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        rocsparse_mat_info info,
+                                        const double* x,
+                                        const double* beta,
+                                        double* y);
 /**@}*/
 
 /*! \ingroup level2_module
@@ -675,12 +811,21 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle handle,
  *  a given matrix and particular operation type. The gathered analysis meta data can be
  *  cleared by rocsparse_csrmv_clear().
  *
+ *  The algorithm that is prepared by the analysis step can be selected with
+ *  rocsparse_set_mat_info_csrmv_alg() prior to calling this function. The default
+ *  \ref rocsparse_csrmv_alg_adaptive computes row blocks, whereas
+ *  \ref rocsparse_csrmv_alg_merge partitions the merge path of rows and non-zero
+ *  entries evenly among all thread blocks.
+ *
  *  \note
  *  If the matrix sparsity pattern changes, the gathered information will become invalid.
  *
  *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  The number of row blocks of \ref rocsparse_csrmv_alg_adaptive depends on the matrix
+ *  structure and requires synchronization with the host. Therefore, it is not supported
+ *  in \ref rocsparse_exec_mode_async mode, where \ref rocsparse_csrmv_alg_merge has to
+ *  be used. The latter is non blocking and executed asynchronously with respect to the
+ *  host. It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
@@ -707,15 +852,18 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle handle,
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid,
+ *              \p m != \p n for symmetric and hermitian matrices, or \p m exceeds
+ *              2^32 - 1 for \ref rocsparse_csrmv_alg_adaptive.
+ *  \retval     rocsparse_status_invalid_value \ref rocsparse_csrmv_alg_adaptive is
+ *              used in \ref rocsparse_exec_mode_async mode.
  *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
  *              \p csr_col_ind or \p info pointer is invalid.
  *  \retval     rocsparse_status_memory_error the buffer for the gathered information
  *              could not be allocated.
  *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *              \ref rocsparse_matrix_type == \ref rocsparse_matrix_type_triangular.
  */
 /**@{*/
 ROCSPARSE_EXPORT
@@ -816,7 +964,22 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
  *  It may return before the actual computation has finished.
  *
  *  \note
- *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *  For \p trans != \ref rocsparse_operation_none, the rows of the matrix are scattered
+ *  into \p y using atomics. If \p info is present and the rows of the matrix are long
+ *  on average, rocsparse_scsrmv_analysis() and rocsparse_dcsrmv_analysis() cache the
+ *  transposed sparsity pattern instead, and the product is gathered without atomics.
+ *  Results of the scattered product may differ slightly between runs.
+ *
+ *  \note
+ *  For \ref rocsparse_matrix_type_symmetric and \ref rocsparse_matrix_type_hermitian,
+ *  only the triangular part selected by \ref rocsparse_fill_mode, including the
+ *  diagonal, must be stored. The stored triangle is mirrored using atomics, thus
+ *  results may differ slightly between runs. Hermitian matrices mirror the conjugate
+ *  of the stored triangle. For real types, \f$op(A) == A\f$ for any \p trans. For
+ *  complex types, \f$op(A) == A\f$ holds for symmetric matrices with \p trans !=
+ *  \ref rocsparse_operation_conjugate_transpose and for hermitian matrices with
+ *  \p trans != \ref rocsparse_operation_transpose, the remaining combinations
+ *  conjugate \f$A\f$ and are not supported.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
@@ -832,7 +995,8 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
  *  alpha       scalar \f$\alpha\f$.
  *  @param[in]
  *  descr       descriptor of the sparse CSR matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
+ *              \ref rocsparse_matrix_type_general, \ref rocsparse_matrix_type_symmetric
+ *              and \ref rocsparse_matrix_type_hermitian are supported.
  *  @param[in]
  *  csr_val     array of \p nnz elements of the sparse CSR matrix.
  *  @param[in]
@@ -856,14 +1020,15 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid, or
+ *              \p m != \p n for symmetric and hermitian matrices.
  *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
  *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
  *              invalid.
  *  \retval     rocsparse_status_arch_mismatch the device is not supported.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *              \ref rocsparse_matrix_type == \ref rocsparse_matrix_type_triangular, or
+ *              \p trans conjugates a complex symmetric or hermitian matrix.
  *
  *  \par Example
  *  This example performs a sparse matrix vector multiplication in CSR format
@@ -975,6 +1140,83 @@ rocsparse_status rocsparse_zcsrmv(rocsparse_handle handle,
 */
 /**@}*/
 
+/*! \ingroup level2_module
+ *  \brief Mixed precision sparse matrix vector multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_dscsrmv computes \f$y := \alpha \cdot op(A) \cdot x + \beta \cdot y\f$
+ *  like rocsparse_dcsrmv(), but the values of the sparse CSR matrix are stored in single
+ *  precision. Each matrix value is converted to double precision when it is loaded, such
+ *  that all products and sums are accumulated in double precision. This halves the
+ *  memory traffic of the matrix values, which dominates the runtime of \p csrmv.
+ *
+ *  The \p info parameter is optional and contains information collected by
+ *  rocsparse_scsrmv_analysis() for the single precision matrix.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz single precision elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        information collected by rocsparse_scsrmv_analysis(), can be \p NULL
+ *              if no information is available.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type == \ref rocsparse_matrix_type_triangular.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dscsrmv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const double* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const float* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_mat_info info,
+                                   const double* x,
+                                   const double* beta,
+                                   double* y);
+
 /*! \ingroup level2_module
  *  \brief Sparse triangular solve using CSR storage format
  *
@@ -1056,7 +1298,6 @@ rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
  *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
  *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
@@ -1083,6 +1324,30 @@ rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle handle,
                                               const rocsparse_int* csr_col_ind,
                                               rocsparse_mat_info info,
                                               size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrsv_buffer_size(rocsparse_handle handle,
+                                              rocsparse_operation trans,
+                                              rocsparse_int m,
+                                              rocsparse_int nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_float_complex* csr_val,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              rocsparse_mat_info info,
+                                              size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrsv_buffer_size(rocsparse_handle handle,
+                                              rocsparse_operation trans,
+                                              rocsparse_int m,
+                                              rocsparse_int nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_double_complex* csr_val,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              rocsparse_mat_info info,
+                                              size_t* buffer_size);
 /**@}*/
 
 /*! \ingroup level2_module
@@ -1095,7 +1360,9 @@ rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle handle,
  *  cleared by rocsparse_csrsv_clear().
  *
  *  \p rocsparse_csrsv_analysis can share its meta data with
- *  rocsparse_scsrilu0_analysis() and rocsparse_dcsrilu0_analysis(). Selecting
+ *  rocsparse_scsrilu0_analysis() and rocsparse_dcsrilu0_analysis(), if \p trans ==
+ *  \ref rocsparse_operation_none. Meta data of transposed solves is kept separately
+ *  and is not shared with other functions. Selecting
  *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
  *  performance of meta data. However, the user need to make sure that the sparsity
  *  pattern remains unchanged. If this cannot be assured,
@@ -1133,18 +1400,20 @@ rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle handle,
  *  analysis    \ref rocsparse_analysis_policy_reuse or
  *              \ref rocsparse_analysis_policy_force.
  *  @param[in]
- *  solve       \ref rocsparse_solve_policy_auto.
+ *  solve       \ref rocsparse_solve_policy_auto, \ref rocsparse_solve_policy_sync_free
+ *              or \ref rocsparse_solve_policy_level. If the solve is going to be level
+ *              scheduled, the level information is copied to the host.
  *  @param[in]
  *  temp_buffer temporary storage buffer allocated by the user.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
  *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \p analysis or \p solve is invalid.
  *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
  *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
  *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
@@ -1175,6 +1444,34 @@ rocsparse_status rocsparse_dcsrsv_analysis(rocsparse_handle handle,
                                            rocsparse_analysis_policy analysis,
                                            rocsparse_solve_policy solve,
                                            void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrsv_analysis(rocsparse_handle handle,
+                                           rocsparse_operation trans,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_float_complex* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy solve,
+                                           void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrsv_analysis(rocsparse_handle handle,
+                                           rocsparse_operation trans,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_double_complex* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy solve,
+                                           void* temp_buffer);
 /**@}*/
 
 /*! \ingroup level2_module
@@ -1247,7 +1544,10 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle handle,
  *  It may return before the actual computation has finished.
  *
  *  \note
- *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *  For \p trans != \ref rocsparse_operation_none, \f$A\f$ is not transposed. Each row
+ *  of \f$A\f$ is solved once all of its dependencies in \f$op(A)\f$ have been
+ *  resolved and its result is then scattered to the rows of \f$op(A)\f$ that depend on
+ *  it. The analysis step has to be performed with the same operation type.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
@@ -1276,19 +1576,22 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle handle,
  *  @param[out]
  *  y           array of \p m elements, holding the solution.
  *  @param[in]
- *  policy      \ref rocsparse_solve_policy_auto.
+ *  policy      \ref rocsparse_solve_policy_auto, \ref rocsparse_solve_policy_sync_free
+ *              or \ref rocsparse_solve_policy_level. The level scheduled solve is not
+ *              available in \ref rocsparse_exec_mode_async, where the sync-free solve is
+ *              used instead.
  *  @param[in]
  *  temp_buffer temporary storage buffer allocated by the user.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
  *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \p policy is invalid.
  *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
  *              \p csr_row_ptr, \p csr_col_ind, \p x or \p y pointer is invalid.
  *  \retval     rocsparse_status_arch_mismatch the device is not supported.
  *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  *
  *  \par Example
@@ -1397,17 +1700,246 @@ rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle handle,
                                         double* y,
                                         rocsparse_solve_policy policy,
                                         void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrsv_solve(rocsparse_handle handle,
+                                        rocsparse_operation trans,
+                                        rocsparse_int m,
+                                        rocsparse_int nnz,
+                                        const rocsparse_float_complex* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const rocsparse_float_complex* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        rocsparse_mat_info info,
+                                        const rocsparse_float_complex* x,
+                                        rocsparse_float_complex* y,
+                                        rocsparse_solve_policy policy,
+                                        void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrsv_solve(rocsparse_handle handle,
+                                        rocsparse_operation trans,
+                                        rocsparse_int m,
+                                        rocsparse_int nnz,
+                                        const rocsparse_double_complex* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const rocsparse_double_complex* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        rocsparse_mat_info info,
+                                        const rocsparse_double_complex* x,
+                                        rocsparse_double_complex* y,
+                                        rocsparse_solve_policy policy,
+                                        void* temp_buffer);
 /**@}*/
 
 /*! \ingroup level2_module
- *  \brief Sparse matrix vector multiplication using ELL storage format
+ *  \brief Iterative sparse triangular solve using CSR storage format
  *
  *  \details
- *  \p rocsparse_ellmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
- *  matrix, defined in ELL storage format, and the dense vector \f$x\f$ and adds the
- *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
- *  such that
- *  \f[
+ *  \p rocsparse_csritsv_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_scsritsv_solve() and rocsparse_dcsritsv_solve(). The
+ *  temporary storage buffer must be allocated by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsritsv_solve() and rocsparse_dcsritsv_solve().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsritsv_buffer_size(rocsparse_handle handle,
+                                                rocsparse_operation trans,
+                                                rocsparse_int m,
+                                                rocsparse_int nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsritsv_buffer_size(rocsparse_handle handle,
+                                                rocsparse_operation trans,
+                                                rocsparse_int m,
+                                                rocsparse_int nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                size_t* buffer_size);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Iterative sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csritsv_solve approximately solves a sparse triangular linear system of
+ *  a sparse \f$m \times m\f$ matrix, defined in CSR storage format, a dense solution
+ *  vector \f$y\f$ and the right-hand side \f$x\f$ that is multiplied by \f$\alpha\f$,
+ *  such that
+ *  \f[
+ *    op(A) \cdot y = \alpha \cdot x,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  Instead of resolving the dependencies between the rows, \p nsweeps Jacobi iterations
+ *  \f[
+ *    y_{k+1} = D^{-1} \cdot (\alpha \cdot x - (T - D) \cdot y_k)
+ *  \f]
+ *  are performed, starting with \f$y_0 = 0\f$, where \f$T\f$ is the triangular part of
+ *  \f$A\f$ and \f$D\f$ its diagonal. All rows are updated in parallel within each
+ *  sweep, which makes \p rocsparse_csritsv_solve an alternative to
+ *  rocsparse_scsrsv_solve() for matrices with long dependency chains, e.g. when applying
+ *  an incomplete LU factorization computed by rocsparse_scsritilu0(). The iteration
+ *  converges to the exact solution after at most \p m sweeps.
+ *
+ *  If \p residual is not a null pointer, the residual norm
+ *  \f$\|\alpha \cdot x - T \cdot y_{k+1}\|_2\f$ of each sweep \f$k\f$ is stored in
+ *  \p residual[k]. Computing the residual norms requires an additional pass over the
+ *  matrix per sweep.
+ *
+ *  \p rocsparse_csritsv_solve requires a user allocated temporary buffer. Its size is
+ *  returned by rocsparse_scsritsv_buffer_size() or rocsparse_dcsritsv_buffer_size().
+ *
+ *  \note
+ *  The diagonal entries of a matrix with \ref rocsparse_diag_type_non_unit have to be
+ *  present and non-zero. No zero pivots are reported.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host,
+ *  unless residuals are requested in \ref rocsparse_pointer_mode_host. It may return
+ *  before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  x           array of \p m elements, holding the right-hand side.
+ *  @param[out]
+ *  y           array of \p m elements, holding the solution.
+ *  @param[in]
+ *  nsweeps     number of Jacobi sweeps.
+ *  @param[out]
+ *  residual    array of \p nsweeps elements, holding the residual norm of each sweep,
+ *              or a null pointer. Can be in host or device memory.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \p nsweeps is negative, or residuals are
+ *              requested in \ref rocsparse_pointer_mode_host and
+ *              \ref rocsparse_exec_mode_async.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p y or \p temp_buffer pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsritsv_solve(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_int m,
+                                          rocsparse_int nnz,
+                                          const float* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const float* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          const float* x,
+                                          float* y,
+                                          rocsparse_int nsweeps,
+                                          float* residual,
+                                          void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsritsv_solve(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_int m,
+                                          rocsparse_int nnz,
+                                          const double* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const double* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          const double* x,
+                                          double* y,
+                                          rocsparse_int nsweeps,
+                                          double* residual,
+                                          void* temp_buffer);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using ELL storage format
+ *
+ *  \details
+ *  \p rocsparse_ellmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in ELL storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
  *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
  *  \f]
  *  with
@@ -1513,6 +2045,34 @@ rocsparse_status rocsparse_dellmv(rocsparse_handle handle,
                                   const double* beta,
                                   double* y);
 
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cellmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_float_complex* ell_val,
+                                  const rocsparse_int* ell_col_ind,
+                                  rocsparse_int ell_width,
+                                  const rocsparse_float_complex* x,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zellmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_double_complex* ell_val,
+                                  const rocsparse_int* ell_col_ind,
+                                  rocsparse_int ell_width,
+                                  const rocsparse_double_complex* x,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex* y);
+
 /*
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
@@ -1544,6 +2104,69 @@ rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
 */
 /**@}*/
 
+/*! \ingroup level2_module
+ *  \brief Mixed precision sparse matrix vector multiplication using ELL storage format
+ *
+ *  \details
+ *  \p rocsparse_dsellmv computes \f$y := \alpha \cdot A \cdot x + \beta \cdot y\f$
+ *  like rocsparse_dellmv(), but the values of the sparse ELL matrix are stored in single
+ *  precision. Products and sums are accumulated in double precision.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse ELL matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse ELL matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse ELL matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  ell_val     array that contains the single precision elements of the sparse ELL
+ *              matrix. Padded elements should be zero.
+ *  @param[in]
+ *  ell_col_ind array that contains the column indices of the sparse ELL matrix.
+ *              Padded column indices should be -1.
+ *  @param[in]
+ *  ell_width   number of non-zero elements per row of the sparse ELL matrix.
+ *  @param[in]
+ *  x           array of \p n elements.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ell_width is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p ell_val,
+ *              \p ell_col_ind, \p x, \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dsellmv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const double* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const float* ell_val,
+                                   const rocsparse_int* ell_col_ind,
+                                   rocsparse_int ell_width,
+                                   const double* x,
+                                   const double* beta,
+                                   double* y);
+
 /*! \ingroup level2_module
  *  \brief Sparse matrix vector multiplication using HYB storage format
  *
@@ -1628,6 +2251,26 @@ rocsparse_status rocsparse_dhybmv(rocsparse_handle handle,
                                   const double* x,
                                   const double* beta,
                                   double* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_chybmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat hyb,
+                                  const rocsparse_float_complex* x,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zhybmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat hyb,
+                                  const rocsparse_double_complex* x,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex* y);
 /*
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_shybmv(rocsparse_handle handle,
@@ -1651,54 +2294,105 @@ rocsparse_status rocsparse_dhybmv(rocsparse_handle handle,
 */
 /**@}*/
 
-/*
- * ===========================================================================
- *    level 3 SPARSE
- * ===========================================================================
- */
-
-/*! \ingroup level3_module
- *  \brief Sparse matrix dense matrix multiplication using CSR storage format
+/*! \ingroup level2_module
+ *  \brief Mixed precision sparse matrix vector multiplication using HYB storage format
  *
  *  \details
- *  \p rocsparse_csrmm multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times k\f$
- *  matrix \f$A\f$, defined in CSR storage format, and the dense \f$k \times n\f$
- *  matrix \f$B\f$ and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
- *  is multiplied by the scalar \f$\beta\f$, such that
- *  \f[
- *    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
- *  \f]
- *  with
- *  \f[
- *    op(A) = \left\{
- *    \begin{array}{ll}
- *        A,   & \text{if trans_A == rocsparse_operation_none} \\
- *        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
- *        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
- *    \end{array}
- *    \right.
+ *  \p rocsparse_dshybmv computes \f$y := \alpha \cdot A \cdot x + \beta \cdot y\f$
+ *  like rocsparse_dhybmv(), for a sparse HYB matrix that has been converted with
+ *  rocsparse_scsr2hyb() and thus stores its values in single precision. Products and
+ *  sums are accumulated in double precision.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse HYB matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  hyb         matrix in HYB storage format with single precision values.
+ *  @param[in]
+ *  x           array of \p n elements.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p hyb structure was not initialized with
+ *              valid matrix sizes.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p hyb, \p x,
+ *              \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value \p hyb structure was not initialized
+ *              with a valid partitioning type.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dshybmv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   const double* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_hyb_mat hyb,
+                                   const double* x,
+                                   const double* beta,
+                                   double* y);
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using BSR storage format
+ *
+ *  \details
+ *  \p rocsparse_bsrmv multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$(mb \cdot \text{block_dim}) \times (nb \cdot \text{block_dim})\f$
+ *  matrix, defined in BSR storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
  *  \f]
- *  and
+ *  with
  *  \f[
- *    op(B) = \left\{
+ *    op(A) = \left\{
  *    \begin{array}{ll}
- *        B,   & \text{if trans_B == rocsparse_operation_none} \\
- *        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
- *        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
  *    \end{array}
  *    \right.
  *  \f]
  *
  *  \code{.c}
- *      for(i = 0; i < ldc; ++i)
+ *      for(i = 0; i < mb * block_dim; ++i)
  *      {
- *          for(j = 0; j < n; ++j)
+ *          y[i] = beta * y[i];
+ *      }
+ *
+ *      for(bi = 0; bi < mb; ++bi)
+ *      {
+ *          for(k = bsr_row_ptr[bi]; k < bsr_row_ptr[bi + 1]; ++k)
  *          {
- *              C[i][j] = beta * C[i][j];
+ *              bj = bsr_col_ind[k];
  *
- *              for(k = csr_row_ptr[i]; k < csr_row_ptr[i + 1]; ++k)
+ *              for(r = 0; r < block_dim; ++r)
  *              {
- *                  C[i][j] += alpha * csr_val[k] * B[csr_col_ind[k]][j];
+ *                  for(c = 0; c < block_dim; ++c)
+ *                  {
+ *                      idx = (dir == rocsparse_direction_row) ? r * block_dim + c
+ *                                                             : c * block_dim + r;
+ *
+ *                      y[bi * block_dim + r] += alpha * bsr_val[k * block_dim * block_dim + idx]
+ *                                                     * x[bj * block_dim + c];
+ *                  }
  *              }
  *          }
  *      }
@@ -1709,796 +2403,4206 @@ rocsparse_status rocsparse_dhybmv(rocsparse_handle handle,
  *  It may return before the actual computation has finished.
  *
  *  \note
- *  Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  \note
+ *  Block dimensions up to 8 are processed by kernels that are specialized for the
+ *  block dimension.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  trans_A     matrix \f$A\f$ operation type.
- *  @param[in]
- *  trans_B     matrix \f$B\f$ operation type.
+ *  dir         storage order of the dense blocks, either row-major or column-major.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix \f$A\f$.
+ *  trans       matrix operation type.
  *  @param[in]
- *  n           number of columns of the dense matrix \f$op(B)\f$ and \f$C\f$.
+ *  mb          number of block rows of the sparse BSR matrix.
  *  @param[in]
- *  k           number of columns of the sparse CSR matrix \f$A\f$.
+ *  nb          number of block columns of the sparse BSR matrix.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  nnzb        number of non-zero blocks of the sparse BSR matrix.
  *  @param[in]
  *  alpha       scalar \f$\alpha\f$.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix \f$A\f$. Currently, only
+ *  descr       descriptor of the sparse BSR matrix. Currently, only
  *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+ *  bsr_val     array of \p nnzb blocks of the sparse BSR matrix, each holding
+ *              \p block_dim times \p block_dim elements.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix \f$A\f$.
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row
+ *              of the sparse BSR matrix.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix \f$A\f$.
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the
+ *              sparse BSR matrix.
  *  @param[in]
- *  B           array of dimension \f$ldb \times n\f$ (\f$op(B) == B\f$) or
- *              \f$ldb \times k\f$ (\f$op(B) == B^T\f$ or \f$op(B) == B^H\f$).
+ *  block_dim   row and column dimension of the dense blocks.
  *  @param[in]
- *  ldb         leading dimension of \f$B\f$, must be at least \f$\max{(1, k)}\f$
- *              (\f$op(A) == A\f$) or \f$\max{(1, m)}\f$ (\f$op(A) == A^T\f$ or
- *              \f$op(A) == A^H\f$).
+ *  x           array of \p nb times \p block_dim elements (\f$op(A) == A\f$) or \p mb
+ *              times \p block_dim elements (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
  *  @param[in]
  *  beta        scalar \f$\beta\f$.
  *  @param[inout]
- *  C           array of dimension \f$ldc \times n\f$.
- *  @param[in]
- *  ldc         leading dimension of \f$C\f$, must be at least \f$\max{(1, m)}\f$
- *              (\f$op(A) == A\f$) or \f$\max{(1, k)}\f$ (\f$op(A) == A^T\f$ or
- *              \f$op(A) == A^H\f$).
+ *  y           array of \p mb times \p block_dim elements (\f$op(A) == A\f$) or \p nb
+ *              times \p block_dim elements (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p ldb or \p ldc
- *              is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
- *              \p csr_row_ptr, \p csr_col_ind, \p B, \p beta or \p C pointer is invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nb, \p nnzb or \p block_dim is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_value \p dir is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p bsr_val,
+ *              \p bsr_row_ptr, \p bsr_col_ind, \p x, \p beta or \p y pointer is invalid.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans_A != \ref rocsparse_operation_none or
+ *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  This example multiplies a CSR matrix with a dense matrix.
- *  \code{.c}
- *      //     1 2 0 3 0
- *      // A = 0 4 5 0 0
- *      //     6 0 0 7 8
- *
- *      rocsparse_int m   = 3;
- *      rocsparse_int k   = 5;
- *      rocsparse_int nnz = 8;
- *
- *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
- *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
- *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
- *
- *      // Set dimension n of B
- *      rocsparse_int n = 64;
- *
- *      // Allocate and generate dense matrix B
- *      std::vector<float> hB(k * n);
- *      for(rocsparse_int i = 0; i < k * n; ++i)
- *      {
- *          hB[i] = static_cast<float>(rand()) / RAND_MAX;
- *      }
- *
- *      // Copy B to the device
- *      float* B;
- *      hipMalloc((void**)&B, sizeof(float) * k * n);
- *      hipMemcpy(B, hB.data(), sizeof(float) * k * n, hipMemcpyHostToDevice);
- *
- *      // alpha and beta
- *      float alpha = 1.0f;
- *      float beta  = 0.0f;
- *
- *      // Allocate memory for the resulting matrix C
- *      float* C;
- *      hipMalloc((void**)&C, sizeof(float) * m * n);
- *
- *      // Perform the matrix multiplication
- *      rocsparse_scsrmm(handle,
- *                       rocsparse_operation_none,
- *                       rocsparse_operation_none,
- *                       m,
- *                       n,
- *                       k,
- *                       nnz,
- *                       &alpha,
- *                       descr,
- *                       csr_val,
- *                       csr_row_ptr,
- *                       csr_col_ind,
- *                       B,
- *                       k,
- *                       &beta,
- *                       C,
- *                       m);
- *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrmm(rocsparse_handle handle,
-                                  rocsparse_operation trans_A,
-                                  rocsparse_operation trans_B,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int k,
-                                  rocsparse_int nnz,
+rocsparse_status rocsparse_sbsrmv(rocsparse_handle handle,
+                                  rocsparse_direction dir,
+                                  rocsparse_operation trans,
+                                  rocsparse_int mb,
+                                  rocsparse_int nb,
+                                  rocsparse_int nnzb,
                                   const float* alpha,
                                   const rocsparse_mat_descr descr,
-                                  const float* csr_val,
-                                  const rocsparse_int* csr_row_ptr,
-                                  const rocsparse_int* csr_col_ind,
-                                  const float* B,
-                                  rocsparse_int ldb,
+                                  const float* bsr_val,
+                                  const rocsparse_int* bsr_row_ptr,
+                                  const rocsparse_int* bsr_col_ind,
+                                  rocsparse_int block_dim,
+                                  const float* x,
                                   const float* beta,
-                                  float* C,
-                                  rocsparse_int ldc);
+                                  float* y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrmm(rocsparse_handle handle,
-                                  rocsparse_operation trans_A,
-                                  rocsparse_operation trans_B,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int k,
-                                  rocsparse_int nnz,
+rocsparse_status rocsparse_dbsrmv(rocsparse_handle handle,
+                                  rocsparse_direction dir,
+                                  rocsparse_operation trans,
+                                  rocsparse_int mb,
+                                  rocsparse_int nb,
+                                  rocsparse_int nnzb,
                                   const double* alpha,
                                   const rocsparse_mat_descr descr,
-                                  const double* csr_val,
-                                  const rocsparse_int* csr_row_ptr,
-                                  const rocsparse_int* csr_col_ind,
-                                  const double* B,
-                                  rocsparse_int ldb,
+                                  const double* bsr_val,
+                                  const rocsparse_int* bsr_row_ptr,
+                                  const rocsparse_int* bsr_col_ind,
+                                  rocsparse_int block_dim,
+                                  const double* x,
                                   const double* beta,
-                                  double* C,
-                                  rocsparse_int ldc);
-/*
+                                  double* y);
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrmm(rocsparse_handle handle,
-                                  rocsparse_operation trans_A,
-                                  rocsparse_operation trans_B,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int k,
-                                  rocsparse_int nnz,
+rocsparse_status rocsparse_cbsrmv(rocsparse_handle handle,
+                                  rocsparse_direction dir,
+                                  rocsparse_operation trans,
+                                  rocsparse_int mb,
+                                  rocsparse_int nb,
+                                  rocsparse_int nnzb,
                                   const rocsparse_float_complex* alpha,
                                   const rocsparse_mat_descr descr,
-                                  const rocsparse_float_complex* csr_val,
-                                  const rocsparse_int* csr_row_ptr,
-                                  const rocsparse_int* csr_col_ind,
-                                  const rocsparse_float_complex* B,
-                                  rocsparse_int ldb,
+                                  const rocsparse_float_complex* bsr_val,
+                                  const rocsparse_int* bsr_row_ptr,
+                                  const rocsparse_int* bsr_col_ind,
+                                  rocsparse_int block_dim,
+                                  const rocsparse_float_complex* x,
                                   const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex* C,
-                                  rocsparse_int ldc);
+                                  rocsparse_float_complex* y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrmm(rocsparse_handle handle,
-                                  rocsparse_operation trans_A,
-                                  rocsparse_operation trans_B,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int k,
-                                  rocsparse_int nnz,
+rocsparse_status rocsparse_zbsrmv(rocsparse_handle handle,
+                                  rocsparse_direction dir,
+                                  rocsparse_operation trans,
+                                  rocsparse_int mb,
+                                  rocsparse_int nb,
+                                  rocsparse_int nnzb,
                                   const rocsparse_double_complex* alpha,
                                   const rocsparse_mat_descr descr,
-                                  const rocsparse_double_complex* csr_val,
-                                  const rocsparse_int* csr_row_ptr,
-                                  const rocsparse_int* csr_col_ind,
-                                  const rocsparse_double_complex* B,
-                                  rocsparse_int ldb,
+                                  const rocsparse_double_complex* bsr_val,
+                                  const rocsparse_int* bsr_row_ptr,
+                                  const rocsparse_int* bsr_col_ind,
+                                  rocsparse_int block_dim,
+                                  const rocsparse_double_complex* x,
                                   const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex* C,
-                                  rocsparse_int ldc);
-*/
+                                  rocsparse_double_complex* y);
 /**@}*/
 
-/*
- * ===========================================================================
- *    preconditioner SPARSE
- * ===========================================================================
- */
-
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using SELL-C-\f$\sigma\f$ storage format
  *
  *  \details
- *  \p rocsparse_csrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
- *  structural or numerical zero has been found during rocsparse_scsrilu0() or
- *  rocsparse_dcsrilu0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
- *  is stored in \p position, using same index base as the CSR matrix.
+ *  \p rocsparse_sellcmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in SELL-C-\f$\sigma\f$ storage format, and the dense vector \f$x\f$ and
+ *  adds the result to the dense vector \f$y\f$ that is multiplied by the scalar
+ *  \f$\beta\f$, such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
  *
- *  \p position can be in host or device memory. If no zero pivot has been found,
- *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *  Each thread of a wavefront processes one row of a slice, such that all loads of
+ *  the slice are coalesced. The result of each row is written back to its original
+ *  position in \f$y\f$ using the row permutation stored in \p sellc.
  *
- *  \note \p rocsparse_csrilu0_zero_pivot is a blocking function. It might influence
- *  performance negatively.
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse SELL-C-\f$\sigma\f$ matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  sellc       matrix in SELL-C-\f$\sigma\f$ storage format.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
  *  @param[inout]
- *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
- *              invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ *  \retval     rocsparse_status_invalid_size \p sellc structure was not initialized with
+ *              valid matrix sizes.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p sellc, \p x,
+ *              \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value \p sellc structure was not initialized
+ *              with a valid slice size.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle handle,
-                                              rocsparse_mat_info info,
-                                              rocsparse_int* position);
+rocsparse_status rocsparse_ssellcmv(rocsparse_handle handle,
+                                    rocsparse_operation trans,
+                                    const float* alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_sellc_mat sellc,
+                                    const float* x,
+                                    const float* beta,
+                                    float* y);
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dsellcmv(rocsparse_handle handle,
+                                    rocsparse_operation trans,
+                                    const double* alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_sellc_mat sellc,
+                                    const double* x,
+                                    const double* beta,
+                                    double* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csellcmv(rocsparse_handle handle,
+                                    rocsparse_operation trans,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_sellc_mat sellc,
+                                    const rocsparse_float_complex* x,
+                                    const rocsparse_float_complex* beta,
+                                    rocsparse_float_complex* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zsellcmv(rocsparse_handle handle,
+                                    rocsparse_operation trans,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_sellc_mat sellc,
+                                    const rocsparse_double_complex* x,
+                                    const rocsparse_double_complex* beta,
+                                    rocsparse_double_complex* y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using CSR5 storage format
  *
  *  \details
- *  \p rocsparse_csrilu0_buffer_size returns the size of the temporary storage buffer
- *  that is required by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
- *  rocsparse_scsrilu0() and rocsparse_dcsrilu0(). The temporary storage buffer must
- *  be allocated by the user. The size of the temporary storage buffer is identical to
- *  the size returned by rocsparse_scsrsv_buffer_size() and
- *  rocsparse_dcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
- *  allocated buffer can thus be shared between subsequent calls to those functions.
+ *  \p rocsparse_csr5mv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in CSR storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  The non-zero entries are processed in tiles of equal size, as described by the
+ *  \p csr5 tile descriptor that has been obtained by rocsparse_csr2csr5(). Thus, the
+ *  work is balanced independently of the row lengths. Partial row sums of rows that
+ *  span several tiles are combined in a subsequent pass.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
  *  m           number of rows of the sparse CSR matrix.
  *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
  *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
  *  csr_val     array of \p nnz elements of the sparse CSR matrix.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
  *  @param[in]
  *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
  *              CSR matrix.
- *  @param[out]
- *  info        structure that holds the information collected during the analysis step.
  *  @param[in]
- *  buffer_size number of bytes of the temporary storage buffer required by
- *              rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
- *              rocsparse_scsrilu0() and rocsparse_dcsrilu0().
+ *  csr5        tile descriptor of the sparse CSR matrix, obtained by
+ *              rocsparse_csr2csr5().
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
- *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid or does
+ *              not match the \p csr5 structure.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p csr5, \p x, \p beta or \p y pointer
+ *              is invalid.
+ *  \retval     rocsparse_status_invalid_value \p csr5 structure was not initialized
+ *              with a valid tile size.
+ *  \retval     rocsparse_status_memory_error the buffer for the partial row sums could
+ *              not be allocated.
  *  \retval     rocsparse_status_not_implemented
  *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_buffer_size(rocsparse_handle handle,
-                                                rocsparse_int m,
-                                                rocsparse_int nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const float* csr_val,
-                                                const rocsparse_int* csr_row_ptr,
-                                                const rocsparse_int* csr_col_ind,
-                                                rocsparse_mat_info info,
-                                                size_t* buffer_size);
+rocsparse_status rocsparse_scsr5mv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const float* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const float* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   const rocsparse_csr5_mat csr5,
+                                   const float* x,
+                                   const float* beta,
+                                   float* y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle handle,
-                                                rocsparse_int m,
-                                                rocsparse_int nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const double* csr_val,
-                                                const rocsparse_int* csr_row_ptr,
-                                                const rocsparse_int* csr_col_ind,
-                                                rocsparse_mat_info info,
-                                                size_t* buffer_size);
+rocsparse_status rocsparse_dcsr5mv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const double* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const double* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   const rocsparse_csr5_mat csr5,
+                                   const double* x,
+                                   const double* beta,
+                                   double* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr5mv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const rocsparse_float_complex* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   const rocsparse_csr5_mat csr5,
+                                   const rocsparse_float_complex* x,
+                                   const rocsparse_float_complex* beta,
+                                   rocsparse_float_complex* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr5mv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const rocsparse_double_complex* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   const rocsparse_csr5_mat csr5,
+                                   const rocsparse_double_complex* x,
+                                   const rocsparse_double_complex* beta,
+                                   rocsparse_double_complex* y);
 /**@}*/
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using DIA storage format
  *
  *  \details
- *  \p rocsparse_csrilu0_analysis performs the analysis step for rocsparse_scsrilu0()
- *  and rocsparse_dcsrilu0(). It is expected that this function will be executed only
- *  once for a given matrix and particular operation type. The analysis meta data can be
- *  cleared by rocsparse_csrilu0_clear().
+ *  \p rocsparse_diamv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in DIA storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
  *
- *  \p rocsparse_csrilu0_analysis can share its meta data with
- *  rocsparse_scsrsv_analysis() and rocsparse_dcsrsv_analysis(). Selecting
- *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
- *  performance of meta data. However, the user need to make sure that the sparsity
- *  pattern remains unchanged. If this cannot be assured,
- *  \ref rocsparse_analysis_policy_force has to be used.
+ *  \code{.c}
+ *      for(i = 0; i < m; ++i)
+ *      {
+ *          y[i] = beta * y[i];
  *
- *  \note
- *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *          for(d = 0; d < ndiag; ++d)
+ *          {
+ *              col = i + dia_offset[d];
+ *
+ *              if((col >= 0) && (col < n))
+ *              {
+ *                  y[i] = y[i] + alpha * dia_val[d * m + i] * x[col];
+ *              }
+ *          }
+ *      }
+ *  \endcode
+ *
+ *  Unlike ELL, no column indices are stored. Only the \p ndiag diagonal offsets
+ *  and the values are read, and consecutive rows access consecutive entries of
+ *  \p x.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
  *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
+ *  trans       matrix operation type.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  m           number of rows of the sparse DIA matrix.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  n           number of columns of the sparse DIA matrix.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  alpha       scalar \f$\alpha\f$.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  descr       descriptor of the sparse DIA matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
- *  @param[out]
- *  info        structure that holds the information collected during
- *              the analysis step.
+ *  dia_val     array of \p m times \p ndiag elements of the sparse DIA matrix, stored
+ *              diagonal by diagonal. Padded elements should be zero.
  *  @param[in]
- *  analysis    \ref rocsparse_analysis_policy_reuse or
- *              \ref rocsparse_analysis_policy_force.
+ *  dia_offset  array of \p ndiag elements containing the offsets of the stored
+ *              diagonals, where 0 denotes the main diagonal, positive offsets denote
+ *              super-diagonals and negative offsets denote sub-diagonals.
  *  @param[in]
- *  solve       \ref rocsparse_solve_policy_auto.
+ *  ndiag       number of stored diagonals of the sparse DIA matrix.
  *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
- *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ndiag is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p dia_val,
+ *              \p dia_offset, \p x, \p beta or \p y pointer is invalid.
  *  \retval     rocsparse_status_not_implemented
  *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle handle,
-                                             rocsparse_int m,
-                                             rocsparse_int nnz,
-                                             const rocsparse_mat_descr descr,
-                                             const float* csr_val,
-                                             const rocsparse_int* csr_row_ptr,
-                                             const rocsparse_int* csr_col_ind,
-                                             rocsparse_mat_info info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy solve,
-                                             void* temp_buffer);
+rocsparse_status rocsparse_sdiamv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  const float* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float* dia_val,
+                                  const rocsparse_int* dia_offset,
+                                  rocsparse_int ndiag,
+                                  const float* x,
+                                  const float* beta,
+                                  float* y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle handle,
-                                             rocsparse_int m,
-                                             rocsparse_int nnz,
-                                             const rocsparse_mat_descr descr,
-                                             const double* csr_val,
-                                             const rocsparse_int* csr_row_ptr,
-                                             const rocsparse_int* csr_col_ind,
-                                             rocsparse_mat_info info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy solve,
-                                             void* temp_buffer);
+rocsparse_status rocsparse_ddiamv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  const double* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double* dia_val,
+                                  const rocsparse_int* dia_offset,
+                                  rocsparse_int ndiag,
+                                  const double* x,
+                                  const double* beta,
+                                  double* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cdiamv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_float_complex* dia_val,
+                                  const rocsparse_int* dia_offset,
+                                  rocsparse_int ndiag,
+                                  const rocsparse_float_complex* x,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zdiamv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_double_complex* dia_val,
+                                  const rocsparse_int* dia_offset,
+                                  rocsparse_int ndiag,
+                                  const rocsparse_double_complex* x,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex* y);
 /**@}*/
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
- *
- *  \details
- *  \p rocsparse_csrilu0_clear deallocates all memory that was allocated by
- *  rocsparse_scsrilu0_analysis() or rocsparse_dcsrilu0_analysis(). This is especially
- *  useful, if memory is an issue and the analysis data is not required for further
- *  computation.
- *
- *  \note
- *  Calling \p rocsparse_csrilu0_clear is optional. All allocated resources will be
- *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
- *  rocsparse_destroy_mat_info().
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[inout]
- *  info        structure that holds the information collected during the analysis step.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
- *              be deallocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+/*
+ * ===========================================================================
+ *    level 3 SPARSE
+ * ===========================================================================
  */
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
+/*! \ingroup level3_module
+ *  \brief Sparse matrix dense matrix multiplication using CSR storage format
  *
  *  \details
- *  \p rocsparse_csrilu0 computes the incomplete LU factorization with 0 fill-ins and no
- *  pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+ *  \p rocsparse_csrmm multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times k\f$
+ *  matrix \f$A\f$, defined in CSR storage format, and the dense \f$k \times n\f$
+ *  matrix \f$B\f$ and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
+ *  is multiplied by the scalar \f$\beta\f$, such that
  *  \f[
- *    A \approx LU
+ *    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans_A == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *  and
+ *  \f[
+ *    op(B) = \left\{
+ *    \begin{array}{ll}
+ *        B,   & \text{if trans_B == rocsparse_operation_none} \\
+ *        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+ *        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
  *  \f]
  *
- *  \p rocsparse_csrilu0 requires a user allocated temporary buffer. Its size is returned
- *  by rocsparse_scsrilu0_buffer_size() or rocsparse_dcsrilu0_buffer_size(). Furthermore,
- *  analysis meta data is required. It can be obtained by rocsparse_scsrilu0_analysis()
- *  or rocsparse_dcsrilu0_analysis(). \p rocsparse_csrilu0 reports the first zero pivot
- *  (either numerical or structural zero). The zero pivot status can be obtained by
- *  calling rocsparse_csrilu0_zero_pivot().
+ *  \code{.c}
+ *      for(i = 0; i < ldc; ++i)
+ *      {
+ *          for(j = 0; j < n; ++j)
+ *          {
+ *              C[i][j] = beta * C[i][j];
  *
- *  \note
- *  The sparse CSR matrix has to be sorted. This can be achieved by calling
- *  rocsparse_csrsort().
+ *              for(k = csr_row_ptr[i]; k < csr_row_ptr[i + 1]; ++k)
+ *              {
+ *                  C[i][j] += alpha * csr_val[k] * B[csr_col_ind[k]][j];
+ *              }
+ *          }
+ *      }
+ *  \endcode
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
  *
+ *  \note
+ *  Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+ *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
+ *  trans_A     matrix \f$A\f$ operation type.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  trans_B     matrix \f$B\f$ operation type.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
- *  @param[inout]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  m           number of rows of the sparse CSR matrix \f$A\f$.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start
- *              of every row of the sparse CSR matrix.
+ *  n           number of columns of the dense matrix \f$op(B)\f$ and \f$C\f$.
+ *  @param[in]
+ *  k           number of columns of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix \f$A\f$. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix \f$A\f$.
  *  @param[in]
  *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
+ *              CSR matrix \f$A\f$.
  *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
+ *  B           array of dimension \f$ldb \times n\f$ (\f$op(B) == B\f$) or
+ *              \f$ldb \times k\f$ (\f$op(B) == B^T\f$ or \f$op(B) == B^H\f$).
  *  @param[in]
- *  policy      \ref rocsparse_solve_policy_auto.
+ *  ldb         leading dimension of \f$B\f$, must be at least \f$\max{(1, k)}\f$
+ *              (\f$op(A) == A\f$) or \f$\max{(1, m)}\f$ (\f$op(A) == A^T\f$ or
+ *              \f$op(A) == A^H\f$).
  *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  C           array of dimension \f$ldc \times n\f$.
+ *  @param[in]
+ *  ldc         leading dimension of \f$C\f$, must be at least \f$\max{(1, m)}\f$
+ *              (\f$op(A) == A\f$) or \f$\max{(1, k)}\f$ (\f$op(A) == A^T\f$ or
+ *              \f$op(A) == A^H\f$).
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
- *              or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p ldb or \p ldc
+ *              is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p B, \p beta or \p C pointer is invalid.
  *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
+ *              \p trans_A != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  *
  *  \par Example
- *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
- *  storage format. The following example computes the incomplete LU factorization
- *  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
+ *  This example multiplies a CSR matrix with a dense matrix.
  *  \code{.c}
- *      // Create rocSPARSE handle
- *      rocsparse_handle handle;
- *      rocsparse_create_handle(&handle);
+ *      //     1 2 0 3 0
+ *      // A = 0 4 5 0 0
+ *      //     6 0 0 7 8
  *
- *      // Create matrix descriptor for M
- *      rocsparse_mat_descr descr_M;
- *      rocsparse_create_mat_descr(&descr_M);
+ *      rocsparse_int m   = 3;
+ *      rocsparse_int k   = 5;
+ *      rocsparse_int nnz = 8;
  *
- *      // Create matrix descriptor for L
- *      rocsparse_mat_descr descr_L;
- *      rocsparse_create_mat_descr(&descr_L);
- *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
- *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+ *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+ *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+ *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
  *
- *      // Create matrix descriptor for U
- *      rocsparse_mat_descr descr_U;
- *      rocsparse_create_mat_descr(&descr_U);
- *      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
- *      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
+ *      // Set dimension n of B
+ *      rocsparse_int n = 64;
  *
- *      // Create matrix info structure
- *      rocsparse_mat_info info;
- *      rocsparse_create_mat_info(&info);
+ *      // Allocate and generate dense matrix B
+ *      std::vector<float> hB(k * n);
+ *      for(rocsparse_int i = 0; i < k * n; ++i)
+ *      {
+ *          hB[i] = static_cast<float>(rand()) / RAND_MAX;
+ *      }
  *
- *      // Obtain required buffer size
- *      size_t buffer_size_M;
- *      size_t buffer_size_L;
- *      size_t buffer_size_U;
- *      rocsparse_dcsrilu0_buffer_size(handle,
- *                                    m,
- *                                    nnz,
- *                                    descr_M,
- *                                    csr_val,
- *                                    csr_row_ptr,
- *                                    csr_col_ind,
- *                                    info,
- *                                    &buffer_size_M);
- *      rocsparse_dcsrsv_buffer_size(handle,
- *                                   rocsparse_operation_none,
- *                                   m,
- *                                   nnz,
- *                                   descr_L,
- *                                   csr_val,
- *                                   csr_row_ptr,
- *                                   csr_col_ind,
- *                                   info,
- *                                   &buffer_size_L);
- *      rocsparse_dcsrsv_buffer_size(handle,
- *                                   rocsparse_operation_none,
- *                                   m,
- *                                   nnz,
- *                                   descr_U,
- *                                   csr_val,
- *                                   csr_row_ptr,
- *                                   csr_col_ind,
- *                                   info,
- *                                   &buffer_size_U);
+ *      // Copy B to the device
+ *      float* B;
+ *      hipMalloc((void**)&B, sizeof(float) * k * n);
+ *      hipMemcpy(B, hB.data(), sizeof(float) * k * n, hipMemcpyHostToDevice);
  *
- *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
+ *      // alpha and beta
+ *      float alpha = 1.0f;
+ *      float beta  = 0.0f;
+ *
+ *      // Allocate memory for the resulting matrix C
+ *      float* C;
+ *      hipMalloc((void**)&C, sizeof(float) * m * n);
+ *
+ *      // Perform the matrix multiplication
+ *      rocsparse_scsrmm(handle,
+ *                       rocsparse_operation_none,
+ *                       rocsparse_operation_none,
+ *                       m,
+ *                       n,
+ *                       k,
+ *                       nnz,
+ *                       &alpha,
+ *                       descr,
+ *                       csr_val,
+ *                       csr_row_ptr,
+ *                       csr_col_ind,
+ *                       B,
+ *                       k,
+ *                       &beta,
+ *                       C,
+ *                       m);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmm(rocsparse_handle handle,
+                                  rocsparse_operation trans_A,
+                                  rocsparse_operation trans_B,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int k,
+                                  rocsparse_int nnz,
+                                  const float* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  const float* B,
+                                  rocsparse_int ldb,
+                                  const float* beta,
+                                  float* C,
+                                  rocsparse_int ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmm(rocsparse_handle handle,
+                                  rocsparse_operation trans_A,
+                                  rocsparse_operation trans_B,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int k,
+                                  rocsparse_int nnz,
+                                  const double* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  const double* B,
+                                  rocsparse_int ldb,
+                                  const double* beta,
+                                  double* C,
+                                  rocsparse_int ldc);
+/*
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrmm(rocsparse_handle handle,
+                                  rocsparse_operation trans_A,
+                                  rocsparse_operation trans_B,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int k,
+                                  rocsparse_int nnz,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_float_complex* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  const rocsparse_float_complex* B,
+                                  rocsparse_int ldb,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex* C,
+                                  rocsparse_int ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrmm(rocsparse_handle handle,
+                                  rocsparse_operation trans_A,
+                                  rocsparse_operation trans_B,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int k,
+                                  rocsparse_int nnz,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_double_complex* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  const rocsparse_double_complex* B,
+                                  rocsparse_int ldb,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex* C,
+                                  rocsparse_int ldc);
+*/
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Sparse triangular system solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsm_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_scsrsm_solve() or
+ *  rocsparse_dcsrsm_solve() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
+ *  is stored in \p position, using same index base as the CSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note \p rocsparse_csrsm_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsm_zero_pivot(rocsparse_handle handle,
+                                            const rocsparse_mat_descr descr,
+                                            rocsparse_mat_info info,
+                                            rocsparse_int* position);
+
+/*! \ingroup level3_module
+ *  \brief Sparse triangular system solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsm_buffer_size returns the size of the temporary storage buffer that
+ *  is required by rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
+ *  rocsparse_scsrsm_solve() and rocsparse_dcsrsm_solve(). The temporary storage buffer
+ *  must be allocated by the user. The size of the temporary storage buffer is identical
+ *  to the size returned by rocsparse_scsrsv_buffer_size() and
+ *  rocsparse_dcsrsv_buffer_size() and does not depend on the number of right-hand sides.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A     matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B     matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nrhs        number of right-hand sides, the columns of \f$op(B)\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix \f$A\f$.
+ *  @param[in]
+ *  B           array of \p m \f$\times\f$ \p nrhs elements of the dense matrix \f$op(B)\f$.
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto, \ref rocsparse_solve_policy_sync_free
+ *              or \ref rocsparse_solve_policy_level.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
+ *              rocsparse_scsrsm_solve() and rocsparse_dcsrsm_solve().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nrhs or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none,
+ *              \p trans_B == \ref rocsparse_operation_conjugate_transpose or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsm_buffer_size(rocsparse_handle handle,
+                                              rocsparse_operation trans_A,
+                                              rocsparse_operation trans_B,
+                                              rocsparse_int m,
+                                              rocsparse_int nrhs,
+                                              rocsparse_int nnz,
+                                              const float* alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const float* csr_val,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              const float* B,
+                                              rocsparse_int ldb,
+                                              rocsparse_mat_info info,
+                                              rocsparse_solve_policy policy,
+                                              size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsm_buffer_size(rocsparse_handle handle,
+                                              rocsparse_operation trans_A,
+                                              rocsparse_operation trans_B,
+                                              rocsparse_int m,
+                                              rocsparse_int nrhs,
+                                              rocsparse_int nnz,
+                                              const double* alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const double* csr_val,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              const double* B,
+                                              rocsparse_int ldb,
+                                              rocsparse_mat_info info,
+                                              rocsparse_solve_policy policy,
+                                              size_t* buffer_size);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Sparse triangular system solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsm_analysis performs the analysis step for rocsparse_scsrsm_solve()
+ *  and rocsparse_dcsrsm_solve(). It is expected that this function will be executed only
+ *  once for a given matrix and particular operation type. The analysis meta data can be
+ *  cleared by rocsparse_csrsm_clear().
+ *
+ *  \p rocsparse_csrsm_analysis can share its meta data with
+ *  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+ *  rocsparse_scsrilu0_analysis() and rocsparse_dcsrilu0_analysis(). Selecting
+ *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+ *  performance of meta data. However, the user need to make sure that the sparsity
+ *  pattern remains unchanged. If this cannot be assured,
+ *  \ref rocsparse_analysis_policy_force has to be used.
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A     matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B     matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nrhs        number of right-hand sides, the columns of \f$op(B)\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix \f$A\f$.
+ *  @param[in]
+ *  B           array of \p m \f$\times\f$ \p nrhs elements of the dense matrix \f$op(B)\f$.
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$.
+ *  @param[out]
+ *  info        structure that holds the information collected during
+ *              the analysis step.
+ *  @param[in]
+ *  analysis    \ref rocsparse_analysis_policy_reuse or
+ *              \ref rocsparse_analysis_policy_force.
+ *  @param[in]
+ *  solve       \ref rocsparse_solve_policy_auto, \ref rocsparse_solve_policy_sync_free
+ *              or \ref rocsparse_solve_policy_level. If the solve is going to be level
+ *              scheduled, the level information is copied to the host.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nrhs or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \p analysis or \p solve is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none,
+ *              \p trans_B == \ref rocsparse_operation_conjugate_transpose or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsm_analysis(rocsparse_handle handle,
+                                           rocsparse_operation trans_A,
+                                           rocsparse_operation trans_B,
+                                           rocsparse_int m,
+                                           rocsparse_int nrhs,
+                                           rocsparse_int nnz,
+                                           const float* alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const float* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           const float* B,
+                                           rocsparse_int ldb,
+                                           rocsparse_mat_info info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy solve,
+                                           void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsm_analysis(rocsparse_handle handle,
+                                           rocsparse_operation trans_A,
+                                           rocsparse_operation trans_B,
+                                           rocsparse_int m,
+                                           rocsparse_int nrhs,
+                                           rocsparse_int nnz,
+                                           const double* alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const double* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           const double* B,
+                                           rocsparse_int ldb,
+                                           rocsparse_mat_info info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy solve,
+                                           void* temp_buffer);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Sparse triangular system solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsm_clear deallocates all memory that was allocated by
+ *  rocsparse_scsrsm_analysis() or rocsparse_dcsrsm_analysis(). This is especially
+ *  useful, if memory is an issue and the analysis data is not required for further
+ *  computation, e.g. when switching to another sparse matrix format. Calling
+ *  \p rocsparse_csrsm_clear is optional. All allocated resources will be cleared, when
+ *  the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsm_clear(rocsparse_handle handle,
+                                       const rocsparse_mat_descr descr,
+                                       rocsparse_mat_info info);
+
+/*! \ingroup level3_module
+ *  \brief Sparse triangular system solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsm_solve solves a sparse triangular linear system of a sparse
+ *  \f$m \times m\f$ matrix, defined in CSR storage format, for \p nrhs right-hand sides
+ *  at once. The dense matrix \f$op(B)\f$ holds the right-hand sides that are multiplied
+ *  by \f$\alpha\f$ and is overwritten with the solution \f$X\f$, such that
+ *  \f[
+ *    op(A) \cdot X = \alpha \cdot op(B),
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans_A == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *  and
+ *  \f[
+ *    op(B) = \left\{
+ *    \begin{array}{ll}
+ *        B,   & \text{if trans_B == rocsparse_operation_none} \\
+ *        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+ *        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  Thus, \f$B\f$ is stored column-major with \p ldb \f$\geq m\f$ if
+ *  \p trans_B == \ref rocsparse_operation_none and row-major with
+ *  \p ldb \f$\geq\f$ \p nrhs if \p trans_B == \ref rocsparse_operation_transpose.
+ *  The dependencies of each row are resolved once for all right-hand sides.
+ *
+ *  \p rocsparse_csrsm_solve requires a user allocated temporary buffer. Its size is
+ *  returned by rocsparse_scsrsm_buffer_size() or rocsparse_dcsrsm_buffer_size().
+ *  Furthermore, analysis meta data is required. It can be obtained by
+ *  rocsparse_scsrsm_analysis() or rocsparse_dcsrsm_analysis().
+ *  \p rocsparse_csrsm_solve reports the first zero pivot (either numerical or structural
+ *  zero). The zero pivot status can be checked calling rocsparse_csrsm_zero_pivot().
+ *  If \ref rocsparse_diag_type == \ref rocsparse_diag_type_unit, no zero pivot will be
+ *  reported, even if \f$A_{j,j} = 0\f$ for some \f$j\f$.
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans_A == \ref rocsparse_operation_none and
+ *  \p trans_B != \ref rocsparse_operation_conjugate_transpose is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A     matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B     matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nrhs        number of right-hand sides, the columns of \f$op(B)\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix \f$A\f$.
+ *  @param[inout]
+ *  B           array of \p m \f$\times\f$ \p nrhs elements of the dense matrix \f$op(B)\f$,
+ *              holding the right-hand sides on entry and the solution on exit.
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto, \ref rocsparse_solve_policy_sync_free
+ *              or \ref rocsparse_solve_policy_level. The level scheduled solve is not
+ *              available in \ref rocsparse_exec_mode_async, where the sync-free solve is
+ *              used instead.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nrhs, \p nnz or \p ldb is invalid.
+ *  \retval     rocsparse_status_invalid_value \p policy is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p B, \p info or \p temp_buffer pointer
+ *              is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none,
+ *              \p trans_B == \ref rocsparse_operation_conjugate_transpose or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsm_solve(rocsparse_handle handle,
+                                        rocsparse_operation trans_A,
+                                        rocsparse_operation trans_B,
+                                        rocsparse_int m,
+                                        rocsparse_int nrhs,
+                                        rocsparse_int nnz,
+                                        const float* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const float* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        float* B,
+                                        rocsparse_int ldb,
+                                        rocsparse_mat_info info,
+                                        rocsparse_solve_policy policy,
+                                        void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsm_solve(rocsparse_handle handle,
+                                        rocsparse_operation trans_A,
+                                        rocsparse_operation trans_B,
+                                        rocsparse_int m,
+                                        rocsparse_int nrhs,
+                                        rocsparse_int nnz,
+                                        const double* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const double* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        double* B,
+                                        rocsparse_int ldb,
+                                        rocsparse_mat_info info,
+                                        rocsparse_solve_policy policy,
+                                        void* temp_buffer);
+/**@}*/
+
+/*
+ * ===========================================================================
+ *    preconditioner SPARSE
+ * ===========================================================================
+ */
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_scsrilu0() or
+ *  rocsparse_dcsrilu0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
+ *  is stored in \p position, using same index base as the CSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note \p rocsparse_csrilu0_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int* position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_numeric_boost enables the user to replace tiny pivots during
+ *  rocsparse_scsrilu0() or rocsparse_dcsrilu0() computation. If \p enable_boost is
+ *  non-zero, each pivot \f$|A_{j,j}| \leq\f$ \p boost_tol is replaced by \p boost_val
+ *  once row \f$j\f$ has been factorized, and before any other row depends on it.
+ *  Replaced pivots are not reported as zero pivots, unless \p boost_val is zero. The
+ *  number of replaced pivots is counted on the device and can be obtained by calling
+ *  rocsparse_csrilu0_boost_count(). If \p enable_boost is zero, the numeric boost is
+ *  disabled and \p boost_tol and \p boost_val are ignored.
+ *
+ *  \note
+ *  The boost tolerance and value are read once during this call. If the pointer mode
+ *  is \ref rocsparse_pointer_mode_device, this function is blocking, thus it is not
+ *  supported in \ref rocsparse_exec_mode_async mode. The counter of replaced pivots
+ *  is served from the memory pool of the handle.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  enable_boost enable (non-zero) or disable (zero) the numeric boost.
+ *  @param[in]
+ *  boost_tol   tolerance \f$\geq 0\f$ to determine whether a pivot should be replaced,
+ *              can be in host or device memory.
+ *  @param[in]
+ *  boost_val   value that replaces the pivot, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p boost_tol is invalid, or the pointer
+ *              mode is \ref rocsparse_pointer_mode_device and the execution mode is
+ *              \ref rocsparse_exec_mode_async.
+ *  \retval     rocsparse_status_invalid_pointer \p info, \p boost_tol or \p boost_val
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the counter of replaced pivots could not be
+ *              allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_numeric_boost(rocsparse_handle handle,
+                                                  rocsparse_mat_info info,
+                                                  int enable_boost,
+                                                  const float* boost_tol,
+                                                  const float* boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_numeric_boost(rocsparse_handle handle,
+                                                  rocsparse_mat_info info,
+                                                  int enable_boost,
+                                                  const double* boost_tol,
+                                                  const double* boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_numeric_boost(rocsparse_handle handle,
+                                                  rocsparse_mat_info info,
+                                                  int enable_boost,
+                                                  const float* boost_tol,
+                                                  const rocsparse_float_complex* boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_numeric_boost(rocsparse_handle handle,
+                                                  rocsparse_mat_info info,
+                                                  int enable_boost,
+                                                  const double* boost_tol,
+                                                  const rocsparse_double_complex* boost_val);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_boost_count returns the number of pivots that have been
+ *  replaced during the last rocsparse_scsrilu0() or rocsparse_dcsrilu0() computation,
+ *  see rocsparse_scsrilu0_numeric_boost(). If the numeric boost is disabled, \p count
+ *  is set to 0.
+ *
+ *  \p count can be in host or device memory. If \p count is in host memory, this
+ *  function is blocking.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[out]
+ *  count       pointer to the number of replaced pivots, can be in host or device
+ *              memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p count pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_boost_count(rocsparse_handle handle,
+                                               rocsparse_mat_info info,
+                                               rocsparse_int* count);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+ *  rocsparse_scsrilu0() and rocsparse_dcsrilu0(). The temporary storage buffer must
+ *  be allocated by the user. The size of the temporary storage buffer is identical to
+ *  the size returned by rocsparse_scsrsv_buffer_size() and
+ *  rocsparse_dcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
+ *  allocated buffer can thus be shared between subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+ *              rocsparse_scsrilu0() and rocsparse_dcsrilu0().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_buffer_size(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                rocsparse_int nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                rocsparse_mat_info info,
+                                                size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                rocsparse_int nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                rocsparse_mat_info info,
+                                                size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_buffer_size(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                rocsparse_int nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                rocsparse_mat_info info,
+                                                size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_buffer_size(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                rocsparse_int nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                rocsparse_mat_info info,
+                                                size_t* buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_analysis performs the analysis step for rocsparse_scsrilu0()
+ *  and rocsparse_dcsrilu0(). It is expected that this function will be executed only
+ *  once for a given matrix and particular operation type. The analysis meta data can be
+ *  cleared by rocsparse_csrilu0_clear().
+ *
+ *  \p rocsparse_csrilu0_analysis can share its meta data with
+ *  rocsparse_scsrsv_analysis() and rocsparse_dcsrsv_analysis(). Selecting
+ *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+ *  performance of meta data. However, the user need to make sure that the sparsity
+ *  pattern remains unchanged. If this cannot be assured,
+ *  \ref rocsparse_analysis_policy_force has to be used.
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during
+ *              the analysis step.
+ *  @param[in]
+ *  analysis    \ref rocsparse_analysis_policy_reuse or
+ *              \ref rocsparse_analysis_policy_force.
+ *  @param[in]
+ *  solve       \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle handle,
+                                             rocsparse_int m,
+                                             rocsparse_int nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const float* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_mat_info info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy solve,
+                                             void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle handle,
+                                             rocsparse_int m,
+                                             rocsparse_int nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const double* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_mat_info info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy solve,
+                                             void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_analysis(rocsparse_handle handle,
+                                             rocsparse_int m,
+                                             rocsparse_int nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_mat_info info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy solve,
+                                             void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_analysis(rocsparse_handle handle,
+                                             rocsparse_int m,
+                                             rocsparse_int nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_mat_info info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy solve,
+                                             void* temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_clear deallocates all memory that was allocated by
+ *  rocsparse_scsrilu0_analysis() or rocsparse_dcsrilu0_analysis(). This is especially
+ *  useful, if memory is an issue and the analysis data is not required for further
+ *  computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_csrilu0_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0 computes the incomplete LU factorization with 0 fill-ins and no
+ *  pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+ *  \f[
+ *    A \approx LU
+ *  \f]
+ *
+ *  \p rocsparse_csrilu0 requires a user allocated temporary buffer. Its size is returned
+ *  by rocsparse_scsrilu0_buffer_size() or rocsparse_dcsrilu0_buffer_size(). Furthermore,
+ *  analysis meta data is required. It can be obtained by rocsparse_scsrilu0_analysis()
+ *  or rocsparse_dcsrilu0_analysis(). \p rocsparse_csrilu0 reports the first zero pivot
+ *  (either numerical or structural zero). The zero pivot status can be obtained by
+ *  calling rocsparse_csrilu0_zero_pivot(). Alternatively, tiny pivots can be replaced
+ *  by a boost value, see rocsparse_scsrilu0_numeric_boost().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[inout]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
+ *              or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
+ *  storage format. The following example computes the incomplete LU factorization
+ *  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
+ *  \code{.c}
+ *      // Create rocSPARSE handle
+ *      rocsparse_handle handle;
+ *      rocsparse_create_handle(&handle);
+ *
+ *      // Create matrix descriptor for M
+ *      rocsparse_mat_descr descr_M;
+ *      rocsparse_create_mat_descr(&descr_M);
+ *
+ *      // Create matrix descriptor for L
+ *      rocsparse_mat_descr descr_L;
+ *      rocsparse_create_mat_descr(&descr_L);
+ *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+ *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+ *
+ *      // Create matrix descriptor for U
+ *      rocsparse_mat_descr descr_U;
+ *      rocsparse_create_mat_descr(&descr_U);
+ *      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
+ *      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
+ *
+ *      // Create matrix info structure
+ *      rocsparse_mat_info info;
+ *      rocsparse_create_mat_info(&info);
+ *
+ *      // Obtain required buffer size
+ *      size_t buffer_size_M;
+ *      size_t buffer_size_L;
+ *      size_t buffer_size_U;
+ *      rocsparse_dcsrilu0_buffer_size(handle,
+ *                                    m,
+ *                                    nnz,
+ *                                    descr_M,
+ *                                    csr_val,
+ *                                    csr_row_ptr,
+ *                                    csr_col_ind,
+ *                                    info,
+ *                                    &buffer_size_M);
+ *      rocsparse_dcsrsv_buffer_size(handle,
+ *                                   rocsparse_operation_none,
+ *                                   m,
+ *                                   nnz,
+ *                                   descr_L,
+ *                                   csr_val,
+ *                                   csr_row_ptr,
+ *                                   csr_col_ind,
+ *                                   info,
+ *                                   &buffer_size_L);
+ *      rocsparse_dcsrsv_buffer_size(handle,
+ *                                   rocsparse_operation_none,
+ *                                   m,
+ *                                   nnz,
+ *                                   descr_U,
+ *                                   csr_val,
+ *                                   csr_row_ptr,
+ *                                   csr_col_ind,
+ *                                   info,
+ *                                   &buffer_size_U);
+ *
+ *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
+ *
+ *      // Allocate temporary buffer
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+ *      // computation performance
+ *      rocsparse_dcsrilu0_analysis(handle,
+ *                                  m,
+ *                                  nnz,
+ *                                  descr_M,
+ *                                  csr_val,
+ *                                  csr_row_ptr,
+ *                                  csr_col_ind,
+ *                                  info,
+ *                                  rocsparse_analysis_policy_reuse,
+ *                                  rocsparse_solve_policy_auto,
+ *                                  temp_buffer);
+ *      rocsparse_dcsrsv_analysis(handle,
+ *                                rocsparse_operation_none,
+ *                                m,
+ *                                nnz,
+ *                                descr_L,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *      rocsparse_dcsrsv_analysis(handle,
+ *                                rocsparse_operation_none,
+ *                                m,
+ *                                nnz,
+ *                                descr_U,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      rocsparse_int position;
+ *      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
+ *                                                                     info,
+ *                                                                     &position))
+ *      {
+ *          printf("A has structural zero at A(%d,%d)\n", position, position);
+ *      }
+ *
+ *      // Compute incomplete LU factorization
+ *      rocsparse_dcsrilu0(handle,
+ *                         m,
+ *                         nnz,
+ *                         descr_M,
+ *                         csr_val,
+ *                         csr_row_ptr,
+ *                         csr_col_ind,
+ *                         info,
+ *                         rocsparse_solve_policy_auto,
+ *                         temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
+ *                                                                     info,
+ *                                                                     &position))
+ *      {
+ *          printf("U has structural and/or numerical zero at U(%d,%d)\n",
+ *                 position,
+ *                 position);
+ *      }
+ *
+ *      // Solve Lz = x
+ *      rocsparse_dcsrsv_solve(handle,
+ *                             rocsparse_operation_none,
+ *                             m,
+ *                             nnz,
+ *                             &alpha,
+ *                             descr_L,
+ *                             csr_val,
+ *                             csr_row_ptr,
+ *                             csr_col_ind,
+ *                             info,
+ *                             x,
+ *                             z,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Solve Uy = z
+ *      rocsparse_dcsrsv_solve(handle,
+ *                             rocsparse_operation_none,
+ *                             m,
+ *                             nnz,
+ *                             &alpha,
+ *                             descr_U,
+ *                             csr_val,
+ *                             csr_row_ptr,
+ *                             csr_col_ind,
+ *                             info,
+ *                             z,
+ *                             y,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *      rocsparse_destroy_mat_info(info);
+ *      rocsparse_destroy_mat_descr(descr_M);
+ *      rocsparse_destroy_mat_descr(descr_L);
+ *      rocsparse_destroy_mat_descr(descr_U);
+ *      rocsparse_destroy_handle(handle);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int nnz,
+                                    const rocsparse_mat_descr descr,
+                                    float* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_mat_info info,
+                                    rocsparse_solve_policy policy,
+                                    void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int nnz,
+                                    const rocsparse_mat_descr descr,
+                                    double* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_mat_info info,
+                                    rocsparse_solve_policy policy,
+                                    void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int nnz,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_mat_info info,
+                                    rocsparse_solve_policy policy,
+                                    void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int nnz,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_mat_info info,
+                                    rocsparse_solve_policy policy,
+                                    void* temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with level of fill and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_scsriluk_numeric() or
+ *  rocsparse_dcsriluk_numeric() computation. The first zero pivot \f$j\f$ at
+ *  \f$M_{j,j}\f$ is stored in \p position, using same index base as the CSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note \p rocsparse_csriluk_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the symbolic step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_zero_pivot(rocsparse_handle handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int* position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with level of fill and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_csriluk_symbolic(), rocsparse_scsriluk_numeric() and
+ *  rocsparse_dcsriluk_numeric(). The temporary storage buffer must be allocated by the
+ *  user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the symbolic step.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_csriluk_symbolic(), rocsparse_scsriluk_numeric() and
+ *              rocsparse_dcsriluk_numeric().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_buffer_size(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               size_t* buffer_size);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with level of fill and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk_nnz computes the sparsity pattern of the incomplete LU factors
+ *  \f$M = L + U - I\f$ of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, where a fill-in
+ *  entry is kept, if its level of fill does not exceed \p level. Entries of \f$A\f$
+ *  have level zero, a fill-in entry created by the elimination of \f$M_{i,k}\f$ has
+ *  level \f$lev(M_{i,k}) + lev(M_{k,j}) + 1\f$. \p level = 0 results in the sparsity
+ *  pattern of \f$A\f$, i.e. the incomplete LU factorization with 0 fill-ins.
+ *
+ *  \p rocsparse_csriluk_nnz fills the row offsets \p csr_row_ptr_M of \f$M\f$ and
+ *  returns the number of non-zero entries \p nnz_M, such that the column indices and
+ *  values of \f$M\f$ can be allocated. The column indices are obtained by
+ *  rocsparse_csriluk_symbolic().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  The sparsity pattern is computed on the host, since the pattern of each row depends
+ *  on the patterns of all previous rows. This function is blocking with respect to the
+ *  host and is expected to be executed only once for a given matrix sparsity pattern.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  level       level of fill \f$k \geq 0\f$.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the symbolic step.
+ *  @param[out]
+ *  csr_row_ptr_M array of \p m+1 elements that point to the start of every row of the
+ *              incomplete LU factors.
+ *  @param[out]
+ *  nnz_M       pointer to the number of non-zero entries of the incomplete LU factors.
+ *              \p nnz_M can be a host or device pointer.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \p level is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info, \p csr_row_ptr_M or \p nnz_M pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_nnz(rocsparse_handle handle,
+                                       rocsparse_int m,
+                                       rocsparse_int nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_int level,
+                                       rocsparse_mat_info info,
+                                       rocsparse_int* csr_row_ptr_M,
+                                       rocsparse_int* nnz_M);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with level of fill and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk_symbolic fills the column indices \p csr_col_ind_M of the
+ *  incomplete LU factors that have been determined by rocsparse_csriluk_nnz() and
+ *  performs the analysis step for rocsparse_scsriluk_numeric() and
+ *  rocsparse_dcsriluk_numeric(). It is expected that this function will be executed
+ *  only once for a given matrix sparsity pattern and level of fill. The meta data can
+ *  be cleared by rocsparse_csriluk_clear().
+ *
+ *  \note
+ *  The column indices are taken from the level of fill pattern that
+ *  rocsparse_csriluk_nnz() computes on the host. Together, the symbolic phase of the
+ *  incomplete LU factorization with level of fill is host-bound.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the symbolic step.
+ *  @param[in]
+ *  csr_row_ptr_M array of \p m+1 elements that point to the start of every row of the
+ *              incomplete LU factors.
+ *  @param[out]
+ *  csr_col_ind_M array of \p nnz_M elements containing the column indices of the
+ *              incomplete LU factors.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info, \p csr_row_ptr_M, \p csr_col_ind_M or
+ *              \p temp_buffer pointer is invalid, or rocsparse_csriluk_nnz() has not
+ *              been called.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_symbolic(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            const rocsparse_int* csr_row_ptr_M,
+                                            rocsparse_int* csr_col_ind_M,
+                                            void* temp_buffer);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with level of fill and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk_clear deallocates all memory that was allocated by
+ *  rocsparse_csriluk_nnz() or rocsparse_csriluk_symbolic(). This is especially useful,
+ *  if memory is an issue and the meta data is not required for further computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_csriluk_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the symbolic step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with level of fill and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk_numeric computes the incomplete LU factorization with level of
+ *  fill \f$k\f$ and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such
+ *  that
+ *  \f[
+ *    A \approx LU
+ *  \f]
+ *  The values of \f$A\f$ are scattered into the sparsity pattern of the incomplete LU
+ *  factors \f$M = L + U - I\f$, obtained by rocsparse_csriluk_nnz() and
+ *  rocsparse_csriluk_symbolic(), which is then factorized in place. The numeric
+ *  factorization can be repeated for matrices with different values but identical
+ *  sparsity pattern.
+ *
+ *  \p rocsparse_csriluk_numeric reports the first zero pivot (either numerical or
+ *  structural zero). The zero pivot status can be obtained by calling
+ *  rocsparse_csriluk_zero_pivot().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the symbolic step.
+ *  @param[out]
+ *  csr_val_M   array of \p nnz_M elements containing the incomplete LU factors.
+ *  @param[in]
+ *  csr_row_ptr_M array of \p m+1 elements that point to the start of every row of the
+ *              incomplete LU factors.
+ *  @param[in]
+ *  csr_col_ind_M array of \p nnz_M elements containing the column indices of the
+ *              incomplete LU factors.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info, \p csr_val_M, \p csr_row_ptr_M or
+ *              \p csr_col_ind_M pointer is invalid, or rocsparse_csriluk_symbolic() has
+ *              not been called.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsriluk_numeric(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            float* csr_val_M,
+                                            const rocsparse_int* csr_row_ptr_M,
+                                            const rocsparse_int* csr_col_ind_M,
+                                            rocsparse_solve_policy policy,
+                                            void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsriluk_numeric(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            double* csr_val_M,
+                                            const rocsparse_int* csr_row_ptr_M,
+                                            const rocsparse_int* csr_col_ind_M,
+                                            rocsparse_solve_policy policy,
+                                            void* temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with threshold dropping and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilut_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_scsrilut_numeric() or
+ *  rocsparse_dcsrilut_numeric() computation. The first zero pivot \f$j\f$ at
+ *  \f$M_{j,j}\f$ is stored in \p position, using same index base as the CSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note \p rocsparse_csrilut_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the symbolic step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilut_zero_pivot(rocsparse_handle handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int* position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with threshold dropping and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilut_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_scsrilut_numeric() and rocsparse_dcsrilut_numeric().
+ *  The temporary storage buffer must be allocated by the user.
+ *  It holds a dense work row of length \p m for each row that is factorized
+ *  concurrently.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the symbolic step.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrilut_numeric() and rocsparse_dcsrilut_numeric().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilut_buffer_size(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               size_t* buffer_size);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with threshold dropping and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilut_nnz prepares the incomplete LU factorization with threshold
+ *  dropping ILUT(\f$\tau\f$, \f$p\f$) of a sparse \f$m \times m\f$ CSR matrix
+ *  \f$A\f$, see rocsparse_scsrilut_numeric() and rocsparse_dcsrilut_numeric(). At most
+ *  the \f$p\f$ largest entries of the strictly lower part and the \f$p\f$ largest
+ *  entries of the strictly upper part of each row are kept, together with the diagonal
+ *  entry. Thus, row \f$i\f$ of the incomplete LU factors \f$M = L + U - I\f$ has at
+ *  most \f$\min(i, p) + 1 + \min(m - 1 - i, p)\f$ non-zero entries.
+ *
+ *  The entries that are dropped depend on the values of all previous rows of \f$M\f$,
+ *  thus \p rocsparse_csrilut_nnz does not determine the sparsity pattern of \f$M\f$.
+ *  Instead, it fills \p csr_row_ptr_M with the row offsets of this maximum sparsity
+ *  pattern and returns its number of non-zero entries \p nnz_M, such that the column
+ *  indices and values of \f$M\f$ can be allocated. The actual row offsets, column
+ *  indices and values are obtained by rocsparse_scsrilut_numeric() or
+ *  rocsparse_dcsrilut_numeric().
+ *
+ *  \note
+ *  \p nnz_M is only an upper bound for the number of non-zero entries of \f$M\f$. The
+ *  actual number of non-zero entries is \p csr_row_ptr_M[m] - \p csr_row_ptr_M[0] after
+ *  rocsparse_scsrilut_numeric() or rocsparse_dcsrilut_numeric(), and has to be passed
+ *  to rocsparse_scsrsv_analysis() and rocsparse_scsrsv_solve() (or their double
+ *  precision counterparts) when applying the incomplete LU factors.
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  tau         relative drop tolerance \f$\tau \geq 0\f$.
+ *  @param[in]
+ *  p           maximum number of entries \f$p \geq 0\f$ that are kept in the strictly
+ *              lower and in the strictly upper part of each row.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the symbolic step.
+ *  @param[out]
+ *  csr_row_ptr_M array of \p m+1 elements that point to the start of every row of the
+ *              maximum sparsity pattern of the incomplete LU factors.
+ *  @param[out]
+ *  nnz_M       pointer to the maximum number of non-zero entries of the incomplete LU
+ *              factors. \p nnz_M can be a host or device pointer.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid, or the maximum
+ *              number of non-zero entries of the incomplete LU factors exceeds the range
+ *              of \ref rocsparse_int.
+ *  \retval     rocsparse_status_invalid_value \p tau or \p p is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info, \p csr_row_ptr_M or \p nnz_M pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilut_nnz(rocsparse_handle handle,
+                                        rocsparse_int m,
+                                        rocsparse_int nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const float* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        float tau,
+                                        rocsparse_int p,
+                                        rocsparse_mat_info info,
+                                        rocsparse_int* csr_row_ptr_M,
+                                        rocsparse_int* nnz_M);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilut_nnz(rocsparse_handle handle,
+                                        rocsparse_int m,
+                                        rocsparse_int nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const double* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        double tau,
+                                        rocsparse_int p,
+                                        rocsparse_mat_info info,
+                                        rocsparse_int* csr_row_ptr_M,
+                                        rocsparse_int* nnz_M);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with threshold dropping and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilut_clear deallocates all memory that was allocated by
+ *  rocsparse_scsrilut_nnz(), rocsparse_dcsrilut_nnz(), rocsparse_scsrilut_numeric() or
+ *  rocsparse_dcsrilut_numeric(). This is especially useful, if memory is an issue and
+ *  the meta data is not required for further computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_csrilut_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the symbolic step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilut_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with threshold dropping and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilut_numeric computes the incomplete LU factorization with threshold
+ *  dropping ILUT(\f$\tau\f$, \f$p\f$) and no pivoting of a sparse \f$m \times m\f$
+ *  CSR matrix \f$A\f$, such that
+ *  \f[
+ *    A \approx LU
+ *  \f]
+ *  The rows of \f$A\f$ are eliminated in ascending order. During the elimination of row
+ *  \f$i\f$, an entry left of the diagonal is divided by the pivot of its row and then
+ *  dropped, if its magnitude is below \f$\tau \|A_{i,:}\|_2\f$. Otherwise, it is used to
+ *  eliminate the corresponding row of \f$U\f$ from row \f$i\f$, which may create fill-in
+ *  entries. Afterwards, all entries below the tolerance are dropped. Of the remaining
+ *  entries, only the \f$p\f$ largest entries of the strictly lower part and the
+ *  \f$p\f$ largest entries of the strictly upper part are kept. The diagonal entry is
+ *  never dropped. The factorization is computed on the device, where each row is
+ *  eliminated by a group of threads, whose size is chosen from the maximum row length of
+ *  \f$M\f$, and several rows are in flight. Each row is written to its slot of the
+ *  maximum sparsity pattern first, and all rows are moved to their final position once
+ *  the factorization has finished. The memory for this is taken from the memory pool
+ *  of the handle.
+ *
+ *  The incomplete LU factors \f$M = L + U - I\f$ are stored compactly at the beginning
+ *  of \p csr_col_ind_M and \p csr_val_M, which have been allocated with the maximum
+ *  number of non-zero entries returned by rocsparse_scsrilut_nnz() or
+ *  rocsparse_dcsrilut_nnz(). \p csr_row_ptr_M is overwritten with the row offsets of
+ *  \f$M\f$, such that its number of non-zero entries is given by
+ *  \p csr_row_ptr_M[m] - \p csr_row_ptr_M[0]. This number, and not the upper bound
+ *  returned by rocsparse_scsrilut_nnz() or rocsparse_dcsrilut_nnz(), has to be passed
+ *  to rocsparse_scsrsv_analysis() and rocsparse_scsrsv_solve(). The numeric factorization can be
+ *  repeated for matrices with different values but identical sparsity pattern, using
+ *  the maximum sparsity pattern of rocsparse_scsrilut_nnz() or
+ *  rocsparse_dcsrilut_nnz().
+ *
+ *  \f$L\f$ and \f$U\f$ can be applied by rocsparse_scsrsv_solve() or
+ *  rocsparse_dcsrsv_solve(), using a descriptor with
+ *  \ref rocsparse_fill_mode_lower and \ref rocsparse_diag_type_unit for \f$L\f$, and a
+ *  descriptor with \ref rocsparse_fill_mode_upper and
+ *  \ref rocsparse_diag_type_non_unit for \f$U\f$.
+ *
+ *  \p rocsparse_csrilut_numeric reports the first zero pivot (either numerical or
+ *  structural zero). The zero pivot status can be obtained by calling
+ *  rocsparse_csrilut_zero_pivot().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the symbolic step.
+ *  @param[out]
+ *  csr_val_M   array of \p nnz_M elements containing the incomplete LU factors.
+ *  @param[inout]
+ *  csr_row_ptr_M array of \p m+1 elements that point to the start of every row of the
+ *              incomplete LU factors.
+ *  @param[out]
+ *  csr_col_ind_M array of \p nnz_M elements containing the column indices of the
+ *              incomplete LU factors.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info, \p csr_val_M, \p csr_row_ptr_M,
+ *              \p csr_col_ind_M or \p temp_buffer pointer is invalid, or
+ *              rocsparse_scsrilut_nnz() or rocsparse_dcsrilut_nnz() has not been called.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilut_numeric(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            float* csr_val_M,
+                                            rocsparse_int* csr_row_ptr_M,
+                                            rocsparse_int* csr_col_ind_M,
+                                            rocsparse_solve_policy policy,
+                                            void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilut_numeric(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            double* csr_val_M,
+                                            rocsparse_int* csr_row_ptr_M,
+                                            rocsparse_int* csr_col_ind_M,
+                                            rocsparse_solve_policy policy,
+                                            void* temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Iterative incomplete LU factorization with 0 fill-ins and no pivoting using
+ *  CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csritilu0_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_scsritilu0() and rocsparse_dcsritilu0(). The temporary
+ *  storage buffer must be allocated by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsritilu0() and rocsparse_dcsritilu0().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsritilu0_buffer_size(rocsparse_handle handle,
+                                                  rocsparse_int m,
+                                                  rocsparse_int nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const float* csr_val,
+                                                  const rocsparse_int* csr_row_ptr,
+                                                  const rocsparse_int* csr_col_ind,
+                                                  size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsritilu0_buffer_size(rocsparse_handle handle,
+                                                  rocsparse_int m,
+                                                  rocsparse_int nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const double* csr_val,
+                                                  const rocsparse_int* csr_row_ptr,
+                                                  const rocsparse_int* csr_col_ind,
+                                                  size_t* buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Iterative incomplete LU factorization with 0 fill-ins and no pivoting using
+ *  CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csritilu0 computes the incomplete LU factorization with 0 fill-ins and
+ *  no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+ *  \f[
+ *    A \approx LU
+ *  \f]
+ *  by a fixed-point iteration. Instead of factorizing the rows in dependency order,
+ *  as done by rocsparse_scsrilu0(), \p nsweeps sweeps over all entries are performed,
+ *  where each entry of \f$L\f$ and \f$U\f$ is updated in parallel by
+ *  \f[
+ *    l_{ij} = \frac{1}{u_{jj}} \left(a_{ij} - \sum_{k < j} l_{ik} u_{kj}\right), \quad
+ *    u_{ij} = a_{ij} - \sum_{k < i} l_{ik} u_{kj},
+ *  \f]
+ *  using the most recent values of all other entries. The entries of \f$A\f$ serve as
+ *  initial guess. The iteration converges to the incomplete LU factorization computed by
+ *  rocsparse_scsrilu0() after a finite number of sweeps, although usually a few sweeps
+ *  are sufficient to obtain a preconditioner of similar quality. It is an alternative to
+ *  rocsparse_scsrilu0() for matrices with long dependency chains. The factors can be
+ *  applied by rocsparse_scsritsv_solve().
+ *
+ *  If \p residual is not a null pointer, the residual norm
+ *  \f$\|A - LU\|_F\f$, restricted to the sparsity pattern of \f$A\f$, is stored in
+ *  \p residual[k] after each sweep \f$k\f$. Computing the residual norms requires an
+ *  additional pass over the matrix per sweep.
+ *
+ *  \p rocsparse_csritilu0 requires a user allocated temporary buffer. Its size is
+ *  returned by rocsparse_scsritilu0_buffer_size() or
+ *  rocsparse_dcsritilu0_buffer_size().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  No zero pivots are reported. Entries of \f$L\f$ that depend on a structurally
+ *  missing or zero diagonal entry of \f$U\f$ are not updated.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host,
+ *  unless residuals are requested in \ref rocsparse_pointer_mode_host. It may return
+ *  before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[inout]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  nsweeps     number of fixed-point sweeps.
+ *  @param[out]
+ *  residual    array of \p nsweeps elements, holding the residual norm after each
+ *              sweep, or a null pointer. Can be in host or device memory.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \p nsweeps is negative, or residuals are
+ *              requested in \ref rocsparse_pointer_mode_host and
+ *              \ref rocsparse_exec_mode_async.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsritilu0(rocsparse_handle handle,
+                                      rocsparse_int m,
+                                      rocsparse_int nnz,
+                                      const rocsparse_mat_descr descr,
+                                      float* csr_val,
+                                      const rocsparse_int* csr_row_ptr,
+                                      const rocsparse_int* csr_col_ind,
+                                      rocsparse_int nsweeps,
+                                      float* residual,
+                                      void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsritilu0(rocsparse_handle handle,
+                                      rocsparse_int m,
+                                      rocsparse_int nnz,
+                                      const rocsparse_mat_descr descr,
+                                      double* csr_val,
+                                      const rocsparse_int* csr_row_ptr,
+                                      const rocsparse_int* csr_col_ind,
+                                      rocsparse_int nsweeps,
+                                      double* residual,
+                                      void* temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural zero or a non-positive pivot has been found during rocsparse_scsric0()
+ *  or rocsparse_dcsric0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
+ *  is stored in \p position, using same index base as the CSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note \p rocsparse_csric0_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle handle,
+                                             rocsparse_mat_info info,
+                                             rocsparse_int* position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+ *  rocsparse_scsric0() and rocsparse_dcsric0(). The temporary storage buffer must
+ *  be allocated by the user. The size of the temporary storage buffer is identical to
+ *  the size returned by rocsparse_scsrsv_buffer_size() and
+ *  rocsparse_dcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
+ *  allocated buffer can thus be shared between subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+ *              rocsparse_scsric0() and rocsparse_dcsric0().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0_buffer_size(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0_buffer_size(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               size_t* buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0_analysis performs the analysis step for rocsparse_scsric0()
+ *  and rocsparse_dcsric0(). It is expected that this function will be executed only
+ *  once for a given matrix and particular operation type. The analysis meta data can be
+ *  cleared by rocsparse_csric0_clear().
+ *
+ *  \p rocsparse_csric0_analysis can share its meta data with the lower triangular
+ *  analysis of rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+ *  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
+ *  rocsparse_scsrilu0_analysis() and rocsparse_dcsrilu0_analysis(). Selecting
+ *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+ *  performance of meta data. However, the user need to make sure that the sparsity
+ *  pattern remains unchanged. If this cannot be assured,
+ *  \ref rocsparse_analysis_policy_force has to be used.
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during
+ *              the analysis step.
+ *  @param[in]
+ *  analysis    \ref rocsparse_analysis_policy_reuse or
+ *              \ref rocsparse_analysis_policy_force.
+ *  @param[in]
+ *  solve       \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0_analysis(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy solve,
+                                            void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0_analysis(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy solve,
+                                            void* temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0_clear deallocates all memory that was allocated by
+ *  rocsparse_scsric0_analysis() or rocsparse_dcsric0_analysis(). This is especially
+ *  useful, if memory is an issue and the analysis data is not required for further
+ *  computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_csric0_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0 computes the incomplete Cholesky factorization with 0 fill-ins
+ *  and no pivoting of a sparse symmetric positive definite \f$m \times m\f$ CSR matrix
+ *  \f$A\f$, such that
+ *  \f[
+ *    A \approx LL^T
+ *  \f]
+ *
+ *  Only the lower triangular part of \f$A\f$ is accessed and overwritten by \f$L\f$,
+ *  the strictly upper triangular part remains unchanged. \f$L\f$ can be passed to
+ *  rocsparse_scsrsv_solve() and rocsparse_dcsrsv_solve() with
+ *  \ref rocsparse_fill_mode_lower, using \ref rocsparse_operation_none for \f$L\f$ and
+ *  \ref rocsparse_operation_transpose for \f$L^T\f$.
+ *
+ *  \p rocsparse_csric0 requires a user allocated temporary buffer. Its size is returned
+ *  by rocsparse_scsric0_buffer_size() or rocsparse_dcsric0_buffer_size(). Furthermore,
+ *  analysis meta data is required. It can be obtained by rocsparse_scsric0_analysis()
+ *  or rocsparse_dcsric0_analysis(). \p rocsparse_csric0 reports the first zero pivot
+ *  (either structural zero or non-positive pivot). The zero pivot status can be obtained
+ *  by calling rocsparse_csric0_zero_pivot().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[inout]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
+ *              or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  Consider the sparse symmetric positive definite \f$m \times m\f$ matrix \f$A\f$,
+ *  stored in CSR storage format. The following example computes the incomplete
+ *  Cholesky factorization \f$M \approx LL^T\f$ and solves the preconditioned system
+ *  \f$My = x\f$.
+ *  \code{.c}
+ *      // Create rocSPARSE handle
+ *      rocsparse_handle handle;
+ *      rocsparse_create_handle(&handle);
+ *
+ *      // Create matrix descriptor for M
+ *      rocsparse_mat_descr descr_M;
+ *      rocsparse_create_mat_descr(&descr_M);
+ *
+ *      // Create matrix descriptor for L
+ *      rocsparse_mat_descr descr_L;
+ *      rocsparse_create_mat_descr(&descr_L);
+ *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+ *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_non_unit);
+ *
+ *      // Create matrix info structure
+ *      rocsparse_mat_info info;
+ *      rocsparse_create_mat_info(&info);
+ *
+ *      // Obtain required buffer size
+ *      size_t buffer_size_M;
+ *      size_t buffer_size_L;
+ *      size_t buffer_size_Lt;
+ *      rocsparse_dcsric0_buffer_size(handle,
+ *                                    m,
+ *                                    nnz,
+ *                                    descr_M,
+ *                                    csr_val,
+ *                                    csr_row_ptr,
+ *                                    csr_col_ind,
+ *                                    info,
+ *                                    &buffer_size_M);
+ *      rocsparse_dcsrsv_buffer_size(handle,
+ *                                   rocsparse_operation_none,
+ *                                   m,
+ *                                   nnz,
+ *                                   descr_L,
+ *                                   csr_val,
+ *                                   csr_row_ptr,
+ *                                   csr_col_ind,
+ *                                   info,
+ *                                   &buffer_size_L);
+ *      rocsparse_dcsrsv_buffer_size(handle,
+ *                                   rocsparse_operation_transpose,
+ *                                   m,
+ *                                   nnz,
+ *                                   descr_L,
+ *                                   csr_val,
+ *                                   csr_row_ptr,
+ *                                   csr_col_ind,
+ *                                   info,
+ *                                   &buffer_size_Lt);
+ *
+ *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
+ *
+ *      // Allocate temporary buffer
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+ *      // computation performance
+ *      rocsparse_dcsric0_analysis(handle,
+ *                                 m,
+ *                                 nnz,
+ *                                 descr_M,
+ *                                 csr_val,
+ *                                 csr_row_ptr,
+ *                                 csr_col_ind,
+ *                                 info,
+ *                                 rocsparse_analysis_policy_reuse,
+ *                                 rocsparse_solve_policy_auto,
+ *                                 temp_buffer);
+ *      rocsparse_dcsrsv_analysis(handle,
+ *                                rocsparse_operation_none,
+ *                                m,
+ *                                nnz,
+ *                                descr_L,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *      rocsparse_dcsrsv_analysis(handle,
+ *                                rocsparse_operation_transpose,
+ *                                m,
+ *                                nnz,
+ *                                descr_L,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      rocsparse_int position;
+ *      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
+ *                                                                    info,
+ *                                                                    &position))
+ *      {
+ *          printf("A has structural zero at A(%d,%d)\n", position, position);
+ *      }
+ *
+ *      // Compute incomplete Cholesky factorization
+ *      rocsparse_dcsric0(handle,
+ *                        m,
+ *                        nnz,
+ *                        descr_M,
+ *                        csr_val,
+ *                        csr_row_ptr,
+ *                        csr_col_ind,
+ *                        info,
+ *                        rocsparse_solve_policy_auto,
+ *                        temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
+ *                                                                    info,
+ *                                                                    &position))
+ *      {
+ *          printf("L has structural and/or numerical zero at L(%d,%d)\n",
+ *                 position,
+ *                 position);
+ *      }
+ *
+ *      // Solve Lz = x
+ *      rocsparse_dcsrsv_solve(handle,
+ *                             rocsparse_operation_none,
+ *                             m,
+ *                             nnz,
+ *                             &alpha,
+ *                             descr_L,
+ *                             csr_val,
+ *                             csr_row_ptr,
+ *                             csr_col_ind,
+ *                             info,
+ *                             x,
+ *                             z,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Solve L^Ty = z
+ *      rocsparse_dcsrsv_solve(handle,
+ *                             rocsparse_operation_transpose,
+ *                             m,
+ *                             nnz,
+ *                             &alpha,
+ *                             descr_L,
+ *                             csr_val,
+ *                             csr_row_ptr,
+ *                             csr_col_ind,
+ *                             info,
+ *                             z,
+ *                             y,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *      rocsparse_destroy_mat_info(info);
+ *      rocsparse_destroy_mat_descr(descr_M);
+ *      rocsparse_destroy_mat_descr(descr_L);
+ *      rocsparse_destroy_handle(handle);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int nnz,
+                                   const rocsparse_mat_descr descr,
+                                   float* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_mat_info info,
+                                   rocsparse_solve_policy policy,
+                                   void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int nnz,
+                                   const rocsparse_mat_descr descr,
+                                   double* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_mat_info info,
+                                   rocsparse_solve_policy policy,
+                                   void* temp_buffer);
+/**@}*/
+
+/*
+ * ===========================================================================
+ *    Sparse Format Conversions
+ * ===========================================================================
+ */
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse COO matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2coo converts the CSR array containing the row offsets, that point
+ *  to the start of every row, into a COO array of row indices. 
+ *
+ *  \note
+ *  It can also be used to convert a CSC array containing the column offsets into a COO
+ *  array of column indices.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[out]
+ *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
+ *              matrix.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p coo_row_ind
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *
+ *  \par Example
+ *  This example converts a CSR matrix into a COO matrix.
+ *  \code{.c}
+ *      //     1 2 0 3 0
+ *      // A = 0 4 5 0 0
+ *      //     6 0 0 7 8
+ *
+ *      rocsparse_int m   = 3;
+ *      rocsparse_int n   = 5;
+ *      rocsparse_int nnz = 8;
+ *
+ *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+ *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+ *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *
+ *      // Allocate COO matrix arrays
+ *      rocsparse_int* coo_row_ind;
+ *      rocsparse_int* coo_col_ind;
+ *      float* coo_val;
+ *
+ *      hipMalloc((void**)&coo_row_ind, sizeof(rocsparse_int) * nnz);
+ *      hipMalloc((void**)&coo_col_ind, sizeof(rocsparse_int) * nnz);
+ *      hipMalloc((void**)&coo_val, sizeof(float) * nnz);
+ *
+ *      // Convert the csr row offsets into coo row indices
+ *      rocsparse_csr2coo(handle,
+ *                        csr_row_ptr,
+ *                        nnz,
+ *                        m,
+ *                        coo_row_ind,
+ *                        rocsparse_index_base_zero);
+ *
+ *      // Copy the column and value arrays
+ *      hipMemcpy(coo_col_ind,
+ *                csr_col_ind,
+ *                sizeof(rocsparse_int) * nnz,
+ *                hipMemcpyDeviceToDevice);
+ *
+ *      hipMemcpy(coo_val,
+ *                csr_val,
+ *                sizeof(float) * nnz,
+ *                hipMemcpyDeviceToDevice);
+ *  \endcode
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2coo(rocsparse_handle handle,
+                                   const rocsparse_int* csr_row_ptr,
+                                   rocsparse_int nnz,
+                                   rocsparse_int m,
+                                   rocsparse_int* coo_row_ind,
+                                   rocsparse_index_base idx_base);
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2csc_buffer_size returns the size of the temporary storage buffer
+ *  required by rocsparse_scsr2csc() and rocsparse_dcsr2csc(). The temporary storage
+ *  buffer must be allocated by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              sparse_csr2csc().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
+ *              \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               rocsparse_int nnz,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_action copy_values,
+                                               size_t* buffer_size);
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2csc converts a CSR matrix into a CSC matrix. \p rocsparse_csr2csc
+ *  can also be used to convert a CSC matrix into a CSR matrix. \p copy_values decides
+ *  whether \p csc_val is being filled during conversion (\ref rocsparse_action_numeric)
+ *  or not (\ref rocsparse_action_symbolic).
+ *
+ *  \p rocsparse_csr2csc requires extra temporary storage buffer that has to be allocated
+ *  by the user. Storage buffer size can be determined by rocsparse_csr2csc_buffer_size().
+ *
+ *  \note
+ *  The resulting matrix can also be seen as the transpose of the input matrix.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  csc_val     array of \p nnz elements of the sparse CSC matrix.
+ *  @param[out]
+ *  csc_row_ind array of \p nnz elements containing the row indices of the sparse CSC
+ *              matrix.
+ *  @param[out]
+ *  csc_col_ptr array of \p n+1 elements that point to the start of every column of the
+ *              sparse CSC matrix.
+ *  @param[in]
+ *  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user, size is returned by
+ *              rocsparse_csr2csc_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p csc_val, \p csc_row_ind, \p csc_col_ptr or
+ *              \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *
+ *  \par Example
+ *  This example computes the transpose of a CSR matrix.
+ *  \code{.c}
+ *      //     1 2 0 3 0
+ *      // A = 0 4 5 0 0
+ *      //     6 0 0 7 8
+ *
+ *      rocsparse_int m_A   = 3;
+ *      rocsparse_int n_A   = 5;
+ *      rocsparse_int nnz_A = 8;
+ *
+ *      csr_row_ptr_A[m+1] = {0, 3, 5, 8};             // device memory
+ *      csr_col_ind_A[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+ *      csr_val_A[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *
+ *      // Allocate memory for transposed CSR matrix
+ *      rocsparse_int m_T   = n_A;
+ *      rocsparse_int n_T   = m_A;
+ *      rocsparse_int nnz_T = nnz_A;
+ *
+ *      rocsparse_int* csr_row_ptr_T;
+ *      rocsparse_int* csr_col_ind_T;
+ *      float* csr_val_T;
+ *
+ *      hipMalloc((void**)&csr_row_ptr_T, sizeof(rocsparse_int) * (m_T + 1));
+ *      hipMalloc((void**)&csr_col_ind_T, sizeof(rocsparse_int) * nnz_T);
+ *      hipMalloc((void**)&csr_val_T, sizeof(float) * nnz_T);
+ *
+ *      // Obtain the temporary buffer size
+ *      size_t buffer_size;
+ *      rocsparse_csr2csc_buffer_size(handle,
+ *                                    m_A,
+ *                                    n_A,
+ *                                    nnz_A,
+ *                                    csr_row_ptr_A,
+ *                                    csr_col_ind_A,
+ *                                    rocsparse_action_numeric,
+ *                                    &buffer_size);
  *
  *      // Allocate temporary buffer
  *      void* temp_buffer;
  *      hipMalloc(&temp_buffer, buffer_size);
  *
- *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
- *      // computation performance
- *      rocsparse_dcsrilu0_analysis(handle,
- *                                  m,
- *                                  nnz,
- *                                  descr_M,
- *                                  csr_val,
- *                                  csr_row_ptr,
- *                                  csr_col_ind,
- *                                  info,
- *                                  rocsparse_analysis_policy_reuse,
- *                                  rocsparse_solve_policy_auto,
- *                                  temp_buffer);
- *      rocsparse_dcsrsv_analysis(handle,
- *                                rocsparse_operation_none,
- *                                m,
- *                                nnz,
- *                                descr_L,
- *                                csr_val,
- *                                csr_row_ptr,
- *                                csr_col_ind,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
- *      rocsparse_dcsrsv_analysis(handle,
- *                                rocsparse_operation_none,
- *                                m,
- *                                nnz,
- *                                descr_U,
- *                                csr_val,
- *                                csr_row_ptr,
- *                                csr_col_ind,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
+ *      rocsparse_scsr2csc(handle,
+ *                         m_A,
+ *                         n_A,
+ *                         nnz_A,
+ *                         csr_val_A,
+ *                         csr_row_ptr_A,
+ *                         csr_col_ind_A,
+ *                         csr_val_T,
+ *                         csr_col_ind_T,
+ *                         csr_row_ptr_T,
+ *                         rocsparse_action_numeric,
+ *                         rocsparse_index_base_zero,
+ *                         temp_buffer);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2csc(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    rocsparse_int nnz,
+                                    const float* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    float* csc_val,
+                                    rocsparse_int* csc_row_ind,
+                                    rocsparse_int* csc_col_ptr,
+                                    rocsparse_action copy_values,
+                                    rocsparse_index_base idx_base,
+                                    void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2csc(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    rocsparse_int nnz,
+                                    const double* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    double* csc_val,
+                                    rocsparse_int* csc_row_ind,
+                                    rocsparse_int* csc_col_ptr,
+                                    rocsparse_action copy_values,
+                                    rocsparse_index_base idx_base,
+                                    void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2csc(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    rocsparse_int nnz,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_float_complex* csc_val,
+                                    rocsparse_int* csc_row_ind,
+                                    rocsparse_int* csc_col_ptr,
+                                    rocsparse_action copy_values,
+                                    rocsparse_index_base idx_base,
+                                    void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2csc(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    rocsparse_int nnz,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_double_complex* csc_val,
+                                    rocsparse_int* csc_row_ind,
+                                    rocsparse_int* csc_col_ptr,
+                                    rocsparse_action copy_values,
+                                    rocsparse_index_base idx_base,
+                                    void* temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2ell_width computes the maximum of the per row non-zero elements
+ *  over all rows, the ELL \p width, for a given CSR matrix.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  ell_descr   descriptor of the sparse ELL matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[out]
+ *  ell_width   pointer to the number of non-zero elements per row in ELL storage
+ *              format.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr, or
+ *              \p ell_width pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2ell_width(rocsparse_handle handle,
+                                         rocsparse_int m,
+                                         const rocsparse_mat_descr csr_descr,
+                                         const rocsparse_int* csr_row_ptr,
+                                         const rocsparse_mat_descr ell_descr,
+                                         rocsparse_int* ell_width);
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2ell converts a CSR matrix into an ELL matrix. It is assumed,
+ *  that \p ell_val and \p ell_col_ind are allocated. Allocation size is computed by the
+ *  number of rows times the number of ELL non-zero elements per row, such that
+ *  \f$\text{nnz}_{\text{ELL}} = m \cdot \text{ell_width}\f$. The number of ELL
+ *  non-zero elements per row is obtained by rocsparse_csr2ell_width().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array containing the column indices of the sparse CSR matrix.
+ *  @param[in]
+ *  ell_descr   descriptor of the sparse ELL matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  ell_width   number of non-zero elements per row in ELL storage format.
+ *  @param[out]
+ *  ell_val     array of \p m times \p ell_width elements of the sparse ELL matrix.
+ *  @param[out]
+ *  ell_col_ind array of \p m times \p ell_width elements containing the column indices
+ *              of the sparse ELL matrix.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p ell_width is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p ell_descr, \p ell_val or
+ *              \p ell_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  This example converts a CSR matrix into an ELL matrix.
+ *  \code{.c}
+ *      //     1 2 0 3 0
+ *      // A = 0 4 5 0 0
+ *      //     6 0 0 7 8
+ *
+ *      rocsparse_int m   = 3;
+ *      rocsparse_int n   = 5;
+ *      rocsparse_int nnz = 8;
+ *
+ *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+ *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+ *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *
+ *      // Create ELL matrix descriptor
+ *      rocsparse_mat_descr ell_descr;
+ *      rocsparse_create_mat_descr(&ell_descr);
+ *
+ *      // Obtain the ELL width
+ *      rocsparse_int ell_width;
+ *      rocsparse_csr2ell_width(handle,
+ *                              m,
+ *                              csr_descr,
+ *                              csr_row_ptr,
+ *                              ell_descr,
+ *                              &ell_width);
+ *
+ *      // Compute ELL non-zero entries
+ *      rocsparse_int ell_nnz = m * ell_width;
+ *
+ *      // Allocate ELL column and value arrays
+ *      rocsparse_int* ell_col_ind;
+ *      hipMalloc((void**)&ell_col_ind, sizeof(rocsparse_int) * ell_nnz);
+ *
+ *      float* ell_val;
+ *      hipMalloc((void**)&ell_val, sizeof(float) * ell_nnz);
+ *
+ *      // Format conversion
+ *      rocsparse_scsr2ell(handle,
+ *                         m,
+ *                         csr_descr,
+ *                         csr_val,
+ *                         csr_row_ptr,
+ *                         csr_col_ind,
+ *                         ell_descr,
+ *                         ell_width,
+ *                         ell_val,
+ *                         ell_col_ind);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const float* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int ell_width,
+                                    float* ell_val,
+                                    rocsparse_int* ell_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2ell(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const double* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int ell_width,
+                                    double* ell_val,
+                                    rocsparse_int* ell_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2ell(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int ell_width,
+                                    rocsparse_float_complex* ell_val,
+                                    rocsparse_int* ell_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2ell(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int ell_width,
+                                    rocsparse_double_complex* ell_val,
+                                    rocsparse_int* ell_col_ind);
+
+/*
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int ell_width,
+                                    rocsparse_float_complex* ell_val,
+                                    rocsparse_int* ell_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int ell_width,
+                                    rocsparse_double_complex* ell_val,
+                                    rocsparse_int* ell_col_ind);
+*/
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse HYB matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2hyb converts a CSR matrix into a HYB matrix. It is assumed
+ *  that \p hyb has been initialized with rocsparse_create_hyb_mat().
+ *
+ *  With \ref rocsparse_hyb_partition_auto, the ELL width is chosen from a histogram
+ *  of the row lengths, such that the data moved by rocsparse_hybmv() is minimized.
+ *  ELL padding is weighed against the additional row indices and atomic updates of
+ *  the COO part.
+ *
+ *  \note
+ *  This function requires a significant amount of storage for the HYB matrix,
+ *  depending on the matrix structure.
+ *
+ *  \note
+ *  In \ref rocsparse_exec_mode_async mode, the ELL width and the size of the COO part
+ *  are derived from the bound set by rocsparse_set_hyb_mat_nnz_bound(), instead of
+ *  the actual number of non-zero entries.
+ *  With \ref rocsparse_hyb_partition_auto, the ELL width is the average number of
+ *  non-zero entries per row of the bound.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val         array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+ *  @param[out]
+ *  hyb             sparse matrix in HYB format.
+ *  @param[in]
+ *  user_ell_width  width of the ELL part of the HYB matrix (only required if
+ *                  \p partition_type == \ref rocsparse_hyb_partition_user).
+ *  @param[in]
+ *  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
+ *                  \ref rocsparse_hyb_partition_user or
+ *                  \ref rocsparse_hyb_partition_max.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p user_ell_width is invalid.
+ *  \retval     rocsparse_status_invalid_value \p partition_type is invalid, or
+ *              \ref rocsparse_exec_mode_async mode is used without a bound set by
+ *              rocsparse_set_hyb_mat_nnz_bound() or with
+ *              \ref rocsparse_hyb_partition_max.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_val,
+ *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the HYB matrix could not be
+ *              allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  *
- *      // Check for zero pivot
- *      rocsparse_int position;
- *      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
- *                                                                     info,
- *                                                                     &position))
- *      {
- *          printf("A has structural zero at A(%d,%d)\n", position, position);
- *      }
+ *  \par Example
+ *  This example converts a CSR matrix into a HYB matrix using user defined partitioning.
+ *  \code{.c}
+ *      // Create HYB matrix structure
+ *      rocsparse_hyb_mat hyb;
+ *      rocsparse_create_hyb_mat(&hyb);
  *
- *      // Compute incomplete LU factorization
- *      rocsparse_dcsrilu0(handle,
+ *      // User defined ell width
+ *      rocsparse_int user_ell_width = 5;
+ *
+ *      // Perform the conversion
+ *      rocsparse_scsr2hyb(handle,
  *                         m,
- *                         nnz,
- *                         descr_M,
+ *                         n,
+ *                         descr,
  *                         csr_val,
  *                         csr_row_ptr,
  *                         csr_col_ind,
- *                         info,
- *                         rocsparse_solve_policy_auto,
- *                         temp_buffer);
- *
- *      // Check for zero pivot
- *      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
- *                                                                     info,
- *                                                                     &position))
- *      {
- *          printf("U has structural and/or numerical zero at U(%d,%d)\n",
- *                 position,
- *                 position);
- *      }
- *
- *      // Solve Lz = x
- *      rocsparse_dcsrsv_solve(handle,
- *                             rocsparse_operation_none,
- *                             m,
- *                             nnz,
- *                             &alpha,
- *                             descr_L,
- *                             csr_val,
- *                             csr_row_ptr,
- *                             csr_col_ind,
- *                             info,
- *                             x,
- *                             z,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
+ *                         hyb,
+ *                         user_ell_width,
+ *                         rocsparse_hyb_partition_user);
  *
- *      // Solve Uy = z
- *      rocsparse_dcsrsv_solve(handle,
- *                             rocsparse_operation_none,
- *                             m,
- *                             nnz,
- *                             &alpha,
- *                             descr_U,
- *                             csr_val,
- *                             csr_row_ptr,
- *                             csr_col_ind,
- *                             info,
- *                             z,
- *                             y,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
+ *      // Do some work
  *
  *      // Clean up
- *      hipFree(temp_buffer);
- *      rocsparse_destroy_mat_info(info);
- *      rocsparse_destroy_mat_descr(descr_M);
- *      rocsparse_destroy_mat_descr(descr_L);
- *      rocsparse_destroy_mat_descr(descr_U);
- *      rocsparse_destroy_handle(handle);
+ *      rocsparse_destroy_hyb_mat(hyb);
  *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0(rocsparse_handle handle,
+rocsparse_status rocsparse_scsr2hyb(rocsparse_handle handle,
                                     rocsparse_int m,
-                                    rocsparse_int nnz,
+                                    rocsparse_int n,
                                     const rocsparse_mat_descr descr,
-                                    float* csr_val,
+                                    const float* csr_val,
                                     const rocsparse_int* csr_row_ptr,
                                     const rocsparse_int* csr_col_ind,
-                                    rocsparse_mat_info info,
-                                    rocsparse_solve_policy policy,
-                                    void* temp_buffer);
+                                    rocsparse_hyb_mat hyb,
+                                    rocsparse_int user_ell_width,
+                                    rocsparse_hyb_partition partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const double* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_hyb_mat hyb,
+                                    rocsparse_int user_ell_width,
+                                    rocsparse_hyb_partition partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2hyb(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_hyb_mat hyb,
+                                    rocsparse_int user_ell_width,
+                                    rocsparse_hyb_partition partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_hyb_mat hyb,
+                                    rocsparse_int user_ell_width,
+                                    rocsparse_hyb_partition partition_type);
+/*
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2hyb(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_hyb_mat hyb,
+                                    rocsparse_int user_ell_width,
+                                    rocsparse_hyb_partition partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_hyb_mat hyb,
+                                    rocsparse_int user_ell_width,
+                                    rocsparse_hyb_partition partition_type);
+*/
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse SELL-C-\f$\sigma\f$ matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2sellc converts a CSR matrix into a SELL-C-\f$\sigma\f$ matrix. It is
+ *  assumed that \p sellc has been initialized with rocsparse_create_sellc_mat().
+ *
+ *  Within each window of \p sigma consecutive rows, the rows are sorted by decreasing
+ *  number of non-zero entries. The sorted rows are then grouped into slices of \f$C\f$
+ *  rows, where \f$C\f$ is the wavefront size of the device, and each slice is padded to
+ *  the length of its longest row. Larger values of \p sigma reduce the padding at the
+ *  cost of a less regular access pattern of the dense vector in rocsparse_sellcmv().
+ *  \p sigma = 1 does not reorder any rows.
+ *
+ *  The number of stored entries and the relative padding overhead of the resulting
+ *  matrix can be queried using rocsparse_get_sellc_mat_padding().
+ *
+ *  \note
+ *  This function requires a significant amount of storage for the SELL-C-\f$\sigma\f$
+ *  matrix, depending on the matrix structure.
+ *
+ *  \note
+ *  The size of the SELL-C-\f$\sigma\f$ matrix depends on the matrix structure and
+ *  requires synchronization with the host. Therefore, this function is not supported
+ *  in \ref rocsparse_exec_mode_async mode.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val         array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+ *  @param[out]
+ *  sellc           sparse matrix in SELL-C-\f$\sigma\f$ format.
+ *  @param[in]
+ *  sigma           number of consecutive rows that are sorted by their length.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p sigma is invalid.
+ *  \retval     rocsparse_status_invalid_value \ref rocsparse_exec_mode_async mode is
+ *              used.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p sellc, \p csr_val,
+ *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_memory_error the buffer for the SELL-C-\f$\sigma\f$ matrix
+ *              could not be allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  This example converts a CSR matrix into a SELL-C-\f$\sigma\f$ matrix.
+ *  \code{.c}
+ *      // Create SELL-C-sigma matrix structure
+ *      rocsparse_sellc_mat sellc;
+ *      rocsparse_create_sellc_mat(&sellc);
+ *
+ *      // Sort windows of 256 rows
+ *      rocsparse_int sigma = 256;
+ *
+ *      // Perform the conversion
+ *      rocsparse_scsr2sellc(handle,
+ *                           m,
+ *                           n,
+ *                           descr,
+ *                           csr_val,
+ *                           csr_row_ptr,
+ *                           csr_col_ind,
+ *                           sellc,
+ *                           sigma);
+ *
+ *      // Query the padding overhead
+ *      rocsparse_int sell_nnz;
+ *      double padding;
+ *      rocsparse_get_sellc_mat_padding(sellc, &sell_nnz, &padding);
+ *
+ *      // Do some work
+ *
+ *      // Clean up
+ *      rocsparse_destroy_sellc_mat(sellc);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2sellc(rocsparse_handle handle,
+                                      rocsparse_int m,
+                                      rocsparse_int n,
+                                      const rocsparse_mat_descr descr,
+                                      const float* csr_val,
+                                      const rocsparse_int* csr_row_ptr,
+                                      const rocsparse_int* csr_col_ind,
+                                      rocsparse_sellc_mat sellc,
+                                      rocsparse_int sigma);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2sellc(rocsparse_handle handle,
+                                      rocsparse_int m,
+                                      rocsparse_int n,
+                                      const rocsparse_mat_descr descr,
+                                      const double* csr_val,
+                                      const rocsparse_int* csr_row_ptr,
+                                      const rocsparse_int* csr_col_ind,
+                                      rocsparse_sellc_mat sellc,
+                                      rocsparse_int sigma);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2sellc(rocsparse_handle handle,
+                                      rocsparse_int m,
+                                      rocsparse_int n,
+                                      const rocsparse_mat_descr descr,
+                                      const rocsparse_float_complex* csr_val,
+                                      const rocsparse_int* csr_row_ptr,
+                                      const rocsparse_int* csr_col_ind,
+                                      rocsparse_sellc_mat sellc,
+                                      rocsparse_int sigma);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int nnz,
-                                    const rocsparse_mat_descr descr,
-                                    double* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    rocsparse_mat_info info,
-                                    rocsparse_solve_policy policy,
-                                    void* temp_buffer);
+rocsparse_status rocsparse_zcsr2sellc(rocsparse_handle handle,
+                                      rocsparse_int m,
+                                      rocsparse_int n,
+                                      const rocsparse_mat_descr descr,
+                                      const rocsparse_double_complex* csr_val,
+                                      const rocsparse_int* csr_row_ptr,
+                                      const rocsparse_int* csr_col_ind,
+                                      rocsparse_sellc_mat sellc,
+                                      rocsparse_int sigma);
 /**@}*/
 
-/*
- * ===========================================================================
- *    Sparse Format Conversions
- * ===========================================================================
- */
-
 /*! \ingroup conv_module
- *  \brief Convert a sparse CSR matrix into a sparse COO matrix
+ *  \brief Convert a sparse CSR matrix into a sparse CSR5 matrix
  *
  *  \details
- *  \p rocsparse_csr2coo converts the CSR array containing the row offsets, that point
- *  to the start of every row, into a COO array of row indices. 
+ *  \p rocsparse_csr2csr5 computes the CSR5 tile descriptor of a CSR matrix. It is
+ *  assumed that \p csr5 has been initialized with rocsparse_create_csr5_mat().
  *
- *  \note
- *  It can also be used to convert a CSC array containing the column offsets into a COO
- *  array of column indices.
+ *  The non-zero entries are partitioned into tiles of \f$\omega \times \sigma\f$
+ *  consecutive entries, where \f$\omega\f$ is the wavefront size of the device and
+ *  \f$\sigma\f$ is chosen by the average number of non-zero entries per row. For
+ *  each tile, the row of its first entry and a compact descriptor, consisting of
+ *  row start bit flags, y offsets and segment offsets, are stored. The CSR arrays
+ *  are not copied and must be passed to rocsparse_csr5mv() unmodified, such that the
+ *  matrix remains usable by all CSR routines.
  *
  *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  The size of the tile descriptor of tiles that span empty rows depends on the
+ *  matrix structure and requires synchronization with the host. Therefore, this
+ *  function is not supported in \ref rocsparse_exec_mode_async mode.
  *
  *  @param[in]
- *  handle      handle to the rocsparse library context queue.
+ *  handle          handle to the rocsparse library context queue.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row
- *              of the sparse CSR matrix.
+ *  m               number of rows of the sparse CSR matrix.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  n               number of columns of the sparse CSR matrix.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
- *  @param[out]
- *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
- *              matrix.
+ *  nnz             number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
- *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[out]
+ *  csr5            tile descriptor of the sparse CSR matrix.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p coo_row_ind
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \ref rocsparse_exec_mode_async mode is
+ *              used.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr or \p csr5
  *              pointer is invalid.
  *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_memory_error the buffer for the tile descriptor could
+ *              not be allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  *
  *  \par Example
- *  This example converts a CSR matrix into a COO matrix.
+ *  This example computes the CSR5 tile descriptor of a CSR matrix.
  *  \code{.c}
- *      //     1 2 0 3 0
- *      // A = 0 4 5 0 0
- *      //     6 0 0 7 8
- *
- *      rocsparse_int m   = 3;
- *      rocsparse_int n   = 5;
- *      rocsparse_int nnz = 8;
- *
- *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
- *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
- *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
- *
- *      // Allocate COO matrix arrays
- *      rocsparse_int* coo_row_ind;
- *      rocsparse_int* coo_col_ind;
- *      float* coo_val;
+ *      // Create CSR5 matrix structure
+ *      rocsparse_csr5_mat csr5;
+ *      rocsparse_create_csr5_mat(&csr5);
  *
- *      hipMalloc((void**)&coo_row_ind, sizeof(rocsparse_int) * nnz);
- *      hipMalloc((void**)&coo_col_ind, sizeof(rocsparse_int) * nnz);
- *      hipMalloc((void**)&coo_val, sizeof(float) * nnz);
+ *      // Compute the tile descriptor
+ *      rocsparse_csr2csr5(handle, m, n, nnz, descr, csr_row_ptr, csr5);
  *
- *      // Convert the csr row offsets into coo row indices
- *      rocsparse_csr2coo(handle,
- *                        csr_row_ptr,
- *                        nnz,
+ *      // Compute y = alpha * A * x + beta * y
+ *      rocsparse_scsr5mv(handle,
+ *                        rocsparse_operation_none,
  *                        m,
- *                        coo_row_ind,
- *                        rocsparse_index_base_zero);
- *
- *      // Copy the column and value arrays
- *      hipMemcpy(coo_col_ind,
- *                csr_col_ind,
- *                sizeof(rocsparse_int) * nnz,
- *                hipMemcpyDeviceToDevice);
+ *                        n,
+ *                        nnz,
+ *                        &alpha,
+ *                        descr,
+ *                        csr_val,
+ *                        csr_row_ptr,
+ *                        csr_col_ind,
+ *                        csr5,
+ *                        x,
+ *                        &beta,
+ *                        y);
  *
- *      hipMemcpy(coo_val,
- *                csr_val,
- *                sizeof(float) * nnz,
- *                hipMemcpyDeviceToDevice);
+ *      // Clean up
+ *      rocsparse_destroy_csr5_mat(csr5);
  *  \endcode
  */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2coo(rocsparse_handle handle,
-                                   const rocsparse_int* csr_row_ptr,
-                                   rocsparse_int nnz,
-                                   rocsparse_int m,
-                                   rocsparse_int* coo_row_ind,
-                                   rocsparse_index_base idx_base);
+rocsparse_status rocsparse_csr2csr5(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    rocsparse_int nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_int* csr_row_ptr,
+                                    rocsparse_csr5_mat csr5);
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+ *  \brief Convert a sparse CSR matrix into a sparse DIA matrix
  *
  *  \details
- *  \p rocsparse_csr2csc_buffer_size returns the size of the temporary storage buffer
- *  required by rocsparse_scsr2csc() and rocsparse_dcsr2csc(). The temporary storage
- *  buffer must be allocated by the user.
+ *  \p rocsparse_csr2dia_ndiag computes the number of diagonals that contain at least
+ *  one non-zero element, \p ndiag, for a given CSR matrix.
+ *
+ *  The DIA matrix stores \p m elements per diagonal, including padding. If this
+ *  exceeds twice the number of non-zero elements of the CSR matrix, the DIA matrix
+ *  moves more data than the CSR matrix and
+ *  \ref rocsparse_status_invalid_value is returned, such that the caller can keep
+ *  the matrix in CSR storage format. \p ndiag is written regardless.
+ *
+ *  \note
+ *  The fill check requires synchronization. If \ref rocsparse_exec_mode_async is set
+ *  and \ref rocsparse_pointer_mode_device is used, only \p ndiag is computed.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
@@ -2507,50 +6611,55 @@ rocsparse_status rocsparse_csr2coo(rocsparse_handle handle,
  *  @param[in]
  *  n           number of columns of the sparse CSR matrix.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
  *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
  *              sparse CSR matrix.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
+ *  csr_col_ind array containing the column indices of the sparse CSR matrix.
  *  @param[in]
- *  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+ *  dia_descr   descriptor of the sparse DIA matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
  *  @param[out]
- *  buffer_size number of bytes of the temporary storage buffer required by
- *              sparse_csr2csc().
+ *  ndiag       pointer to the number of diagonals in DIA storage format.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
- *              \p buffer_size pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_size \p m or \p n is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p dia_descr or \p ndiag pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value the DIA matrix exceeds the fill limit,
+ *              or \ref rocsparse_exec_mode_async is set and \p ndiag is a host
+ *              pointer.
+ *  \retval     rocsparse_status_memory_error the buffer for the diagonal flags could
+ *              not be allocated.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle handle,
-                                               rocsparse_int m,
-                                               rocsparse_int n,
-                                               rocsparse_int nnz,
-                                               const rocsparse_int* csr_row_ptr,
-                                               const rocsparse_int* csr_col_ind,
-                                               rocsparse_action copy_values,
-                                               size_t* buffer_size);
+rocsparse_status rocsparse_csr2dia_ndiag(rocsparse_handle handle,
+                                         rocsparse_int m,
+                                         rocsparse_int n,
+                                         const rocsparse_mat_descr csr_descr,
+                                         const rocsparse_int* csr_row_ptr,
+                                         const rocsparse_int* csr_col_ind,
+                                         const rocsparse_mat_descr dia_descr,
+                                         rocsparse_int* ndiag);
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+ *  \brief Convert a sparse CSR matrix into a sparse DIA matrix
  *
  *  \details
- *  \p rocsparse_csr2csc converts a CSR matrix into a CSC matrix. \p rocsparse_csr2csc
- *  can also be used to convert a CSC matrix into a CSR matrix. \p copy_values decides
- *  whether \p csc_val is being filled during conversion (\ref rocsparse_action_numeric)
- *  or not (\ref rocsparse_action_symbolic).
- *
- *  \p rocsparse_csr2csc requires extra temporary storage buffer that has to be allocated
- *  by the user. Storage buffer size can be determined by rocsparse_csr2csc_buffer_size().
+ *  \p rocsparse_csr2dia converts a CSR matrix into a DIA matrix. It is assumed, that
+ *  \p dia_val and \p dia_offset are allocated. Allocation size is computed by the
+ *  number of rows times the number of diagonals, such that
+ *  \f$\text{nnz}_{\text{DIA}} = m \cdot \text{ndiag}\f$. The number of diagonals
+ *  is obtained by rocsparse_csr2dia_ndiag().
  *
- *  \note
- *  The resulting matrix can also be seen as the transpose of the input matrix.
+ *  The entry \f$A_{i,i+\text{dia_offset}[d]}\f$ is stored in
+ *  \f$\text{dia_val}[d \cdot m + i]\f$. Diagonal offsets are stored in increasing
+ *  order and do not depend on the index base. Padded elements are set to zero.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -2563,136 +6672,246 @@ rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle handle,
  *  @param[in]
  *  n           number of columns of the sparse CSR matrix.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  csr_val     array containing the values of the sparse CSR matrix.
  *  @param[in]
  *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
  *              sparse CSR matrix.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
+ *  csr_col_ind array containing the column indices of the sparse CSR matrix.
+ *  @param[in]
+ *  dia_descr   descriptor of the sparse DIA matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  ndiag       number of diagonals in DIA storage format.
  *  @param[out]
- *  csc_val     array of \p nnz elements of the sparse CSC matrix.
+ *  dia_val     array of \p m times \p ndiag elements of the sparse DIA matrix.
  *  @param[out]
- *  csc_row_ind array of \p nnz elements containing the row indices of the sparse CSC
+ *  dia_offset  array of \p ndiag elements containing the diagonal offsets of the
+ *              sparse DIA matrix.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ndiag is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p dia_descr, \p dia_val or
+ *              \p dia_offset pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the diagonal positions
+ *              could not be allocated.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  This example converts a CSR matrix into a DIA matrix.
+ *  \code{.c}
+ *      //     1 2 0 0
+ *      // A = 0 3 4 0
+ *      //     5 0 6 7
+ *
+ *      rocsparse_int m   = 3;
+ *      rocsparse_int n   = 4;
+ *      rocsparse_int nnz = 7;
+ *
+ *      csr_row_ptr[m+1] = {0, 2, 4, 7};          // device memory
+ *      csr_col_ind[nnz] = {0, 1, 1, 2, 0, 2, 3}; // device memory
+ *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7}; // device memory
+ *
+ *      // Create DIA matrix descriptor
+ *      rocsparse_mat_descr dia_descr;
+ *      rocsparse_create_mat_descr(&dia_descr);
+ *
+ *      // Obtain the number of diagonals, fall back to CSR if the
+ *      // DIA matrix would be too sparse
+ *      rocsparse_int ndiag;
+ *      if(rocsparse_csr2dia_ndiag(handle,
+ *                                 m,
+ *                                 n,
+ *                                 csr_descr,
+ *                                 csr_row_ptr,
+ *                                 csr_col_ind,
+ *                                 dia_descr,
+ *                                 &ndiag) != rocsparse_status_success)
+ *      {
+ *          return;
+ *      }
+ *
+ *      // Allocate DIA offset and value arrays
+ *      rocsparse_int* dia_offset;
+ *      hipMalloc((void**)&dia_offset, sizeof(rocsparse_int) * ndiag);
+ *
+ *      float* dia_val;
+ *      hipMalloc((void**)&dia_val, sizeof(float) * m * ndiag);
+ *
+ *      // Format conversion
+ *      rocsparse_scsr2dia(handle,
+ *                         m,
+ *                         n,
+ *                         csr_descr,
+ *                         csr_val,
+ *                         csr_row_ptr,
+ *                         csr_col_ind,
+ *                         dia_descr,
+ *                         ndiag,
+ *                         dia_val,
+ *                         dia_offset);
+ *
+ *      // dia_offset[ndiag]   = {-2, 0, 1}
+ *      // dia_val[m * ndiag] = {0, 0, 5, 1, 3, 6, 2, 4, 7}
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2dia(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const float* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    const rocsparse_mat_descr dia_descr,
+                                    rocsparse_int ndiag,
+                                    float* dia_val,
+                                    rocsparse_int* dia_offset);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2dia(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const double* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    const rocsparse_mat_descr dia_descr,
+                                    rocsparse_int ndiag,
+                                    double* dia_val,
+                                    rocsparse_int* dia_offset);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2dia(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    const rocsparse_mat_descr dia_descr,
+                                    rocsparse_int ndiag,
+                                    rocsparse_float_complex* dia_val,
+                                    rocsparse_int* dia_offset);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2dia(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    const rocsparse_mat_descr dia_descr,
+                                    rocsparse_int ndiag,
+                                    rocsparse_double_complex* dia_val,
+                                    rocsparse_int* dia_offset);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse COO matrix into a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_coo2csr converts the COO array containing the row indices into a
+ *  CSR array of row offsets, that point to the start of every row.
+ *  It is assumed that the COO row index array is sorted.
+ *
+ *  \note It can also be used, to convert a COO array containing the column indices into
+ *  a CSC array of column offsets, that point to the start of every column. Then, it is
+ *  assumed that the COO column index array is sorted, instead.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
  *              matrix.
- *  @param[out]
- *  csc_col_ptr array of \p n+1 elements that point to the start of every column of the
- *              sparse CSC matrix.
  *  @param[in]
- *  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
- *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[out]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
  *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user, size is returned by
- *              rocsparse_csr2csc_buffer_size().
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p csr_val, \p csr_row_ptr,
- *              \p csr_col_ind, \p csc_val, \p csc_row_ind, \p csc_col_ptr or
- *              \p temp_buffer pointer is invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p coo_row_ind or \p csr_row_ptr
+ *              pointer is invalid.
  *
  *  \par Example
- *  This example computes the transpose of a CSR matrix.
+ *  This example converts a COO matrix into a CSR matrix.
  *  \code{.c}
  *      //     1 2 0 3 0
  *      // A = 0 4 5 0 0
  *      //     6 0 0 7 8
  *
- *      rocsparse_int m_A   = 3;
- *      rocsparse_int n_A   = 5;
- *      rocsparse_int nnz_A = 8;
- *
- *      csr_row_ptr_A[m+1] = {0, 3, 5, 8};             // device memory
- *      csr_col_ind_A[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
- *      csr_val_A[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *      rocsparse_int m   = 3;
+ *      rocsparse_int n   = 5;
+ *      rocsparse_int nnz = 8;
  *
- *      // Allocate memory for transposed CSR matrix
- *      rocsparse_int m_T   = n_A;
- *      rocsparse_int n_T   = m_A;
- *      rocsparse_int nnz_T = nnz_A;
+ *      coo_row_ind[nnz] = {0, 0, 0, 1, 1, 2, 2, 2}; // device memory
+ *      coo_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+ *      coo_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
  *
- *      rocsparse_int* csr_row_ptr_T;
- *      rocsparse_int* csr_col_ind_T;
- *      float* csr_val_T;
+ *      // Allocate CSR matrix arrays
+ *      rocsparse_int* csr_row_ptr;
+ *      rocsparse_int* csr_col_ind;
+ *      float* csr_val;
  *
- *      hipMalloc((void**)&csr_row_ptr_T, sizeof(rocsparse_int) * (m_T + 1));
- *      hipMalloc((void**)&csr_col_ind_T, sizeof(rocsparse_int) * nnz_T);
- *      hipMalloc((void**)&csr_val_T, sizeof(float) * nnz_T);
+ *      hipMalloc((void**)&csr_row_ptr, sizeof(rocsparse_int) * (m + 1));
+ *      hipMalloc((void**)&csr_col_ind, sizeof(rocsparse_int) * nnz);
+ *      hipMalloc((void**)&csr_val, sizeof(float) * nnz);
  *
- *      // Obtain the temporary buffer size
- *      size_t buffer_size;
- *      rocsparse_csr2csc_buffer_size(handle,
- *                                    m_A,
- *                                    n_A,
- *                                    nnz_A,
- *                                    csr_row_ptr_A,
- *                                    csr_col_ind_A,
- *                                    rocsparse_action_numeric,
- *                                    &buffer_size);
+ *      // Convert the coo row indices into csr row offsets
+ *      rocsparse_coo2csr(handle,
+ *                        coo_row_ind,
+ *                        nnz,
+ *                        m,
+ *                        csr_row_ptr,
+ *                        rocsparse_index_base_zero);
  *
- *      // Allocate temporary buffer
- *      void* temp_buffer;
- *      hipMalloc(&temp_buffer, buffer_size);
+ *      // Copy the column and value arrays
+ *      hipMemcpy(csr_col_ind,
+ *                coo_col_ind,
+ *                sizeof(rocsparse_int) * nnz,
+ *                hipMemcpyDeviceToDevice);
  *
- *      rocsparse_scsr2csc(handle,
- *                         m_A,
- *                         n_A,
- *                         nnz_A,
- *                         csr_val_A,
- *                         csr_row_ptr_A,
- *                         csr_col_ind_A,
- *                         csr_val_T,
- *                         csr_col_ind_T,
- *                         csr_row_ptr_T,
- *                         rocsparse_action_numeric,
- *                         rocsparse_index_base_zero,
- *                         temp_buffer);
+ *      hipMemcpy(csr_val,
+ *                coo_val,
+ *                sizeof(float) * nnz,
+ *                hipMemcpyDeviceToDevice);
  *  \endcode
  */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2csc(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    rocsparse_int nnz,
-                                    const float* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    float* csc_val,
-                                    rocsparse_int* csc_row_ind,
-                                    rocsparse_int* csc_col_ptr,
-                                    rocsparse_action copy_values,
-                                    rocsparse_index_base idx_base,
-                                    void* temp_buffer);
-
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2csc(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    rocsparse_int nnz,
-                                    const double* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    double* csc_val,
-                                    rocsparse_int* csc_row_ind,
-                                    rocsparse_int* csc_col_ptr,
-                                    rocsparse_action copy_values,
-                                    rocsparse_index_base idx_base,
-                                    void* temp_buffer);
-/**@}*/
+rocsparse_status rocsparse_coo2csr(rocsparse_handle handle,
+                                   const rocsparse_int* coo_row_ind,
+                                   rocsparse_int nnz,
+                                   rocsparse_int m,
+                                   rocsparse_int* csr_row_ptr,
+                                   rocsparse_index_base idx_base);
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+ *  \brief Convert a sparse ELL matrix into a sparse CSR matrix
  *
  *  \details
- *  \p rocsparse_csr2ell_width computes the maximum of the per row non-zero elements
- *  over all rows, the ELL \p width, for a given CSR matrix.
+ *  \p rocsparse_ell2csr_nnz computes the total CSR non-zero elements and the CSR
+ *  row offsets, that point to the start of every row of the sparse CSR matrix, for
+ *  a given ELL matrix. It is assumed that \p csr_row_ptr has been allocated with
+ *  size \p m + 1.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -2701,46 +6920,55 @@ rocsparse_status rocsparse_dcsr2csc(rocsparse_handle handle,
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
+ *  m           number of rows of the sparse ELL matrix.
  *  @param[in]
- *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *  n           number of columns of the sparse ELL matrix.
+ *  @param[in]
+ *  ell_descr   descriptor of the sparse ELL matrix. Currently, only
  *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  ell_width   number of non-zero elements per row in ELL storage format.
  *  @param[in]
- *  ell_descr   descriptor of the sparse ELL matrix. Currently, only
+ *  ell_col_ind array of \p m times \p ell_width elements containing the column indices
+ *              of the sparse ELL matrix.
+ *  @param[in]
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
  *              \ref rocsparse_matrix_type_general is supported.
  *  @param[out]
- *  ell_width   pointer to the number of non-zero elements per row in ELL storage
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[out]
+ *  csr_nnz     pointer to the total number of non-zero elements in CSR storage
  *              format.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr, or
- *              \p ell_width pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ell_width is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p ell_descr, \p ell_col_ind,
+ *              \p csr_descr, \p csr_row_ptr or \p csr_nnz pointer is invalid.
  *  \retval     rocsparse_status_not_implemented
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2ell_width(rocsparse_handle handle,
-                                         rocsparse_int m,
-                                         const rocsparse_mat_descr csr_descr,
-                                         const rocsparse_int* csr_row_ptr,
-                                         const rocsparse_mat_descr ell_descr,
-                                         rocsparse_int* ell_width);
+rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle handle,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       const rocsparse_mat_descr ell_descr,
+                                       rocsparse_int ell_width,
+                                       const rocsparse_int* ell_col_ind,
+                                       const rocsparse_mat_descr csr_descr,
+                                       rocsparse_int* csr_row_ptr,
+                                       rocsparse_int* csr_nnz);
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+ *  \brief Convert a sparse ELL matrix into a sparse CSR matrix
  *
  *  \details
- *  \p rocsparse_csr2ell converts a CSR matrix into an ELL matrix. It is assumed,
- *  that \p ell_val and \p ell_col_ind are allocated. Allocation size is computed by the
- *  number of rows times the number of ELL non-zero elements per row, such that
- *  \f$\text{nnz}_{\text{ELL}} = m \cdot \text{ell_width}\f$. The number of ELL
- *  non-zero elements per row is obtained by rocsparse_csr2ell_width().
+ *  \p rocsparse_ell2csr converts an ELL matrix into a CSR matrix. It is assumed
+ *  that \p csr_row_ptr has already been filled and that \p csr_val and \p csr_col_ind
+ *  are allocated by the user. \p csr_row_ptr and allocation size of \p csr_col_ind and
+ *  \p csr_val is defined by the number of CSR non-zero elements. Both can be obtained
+ *  by rocsparse_ell2csr_nnz().
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -2749,31 +6977,33 @@ rocsparse_status rocsparse_csr2ell_width(rocsparse_handle handle,
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
- *  @param[in]
- *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
- *  @param[in]
- *  csr_val     array containing the values of the sparse CSR matrix.
- *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  m           number of rows of the sparse ELL matrix.
  *  @param[in]
- *  csr_col_ind array containing the column indices of the sparse CSR matrix.
+ *  n           number of columns of the sparse ELL matrix.
  *  @param[in]
  *  ell_descr   descriptor of the sparse ELL matrix. Currently, only
  *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
  *  ell_width   number of non-zero elements per row in ELL storage format.
- *  @param[out]
+ *  @param[in]
  *  ell_val     array of \p m times \p ell_width elements of the sparse ELL matrix.
- *  @param[out]
+ *  @param[in]
  *  ell_col_ind array of \p m times \p ell_width elements containing the column indices
  *              of the sparse ELL matrix.
+ *  @param[in]
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[out]
+ *  csr_val     array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[out]
+ *  csr_col_ind array containing the column indices of the sparse CSR matrix.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p ell_width is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ell_width is invalid.
  *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
  *              \p csr_row_ptr, \p csr_col_ind, \p ell_descr, \p ell_val or
  *              \p ell_col_ind pointer is invalid.
@@ -2781,251 +7011,228 @@ rocsparse_status rocsparse_csr2ell_width(rocsparse_handle handle,
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  *
  *  \par Example
- *  This example converts a CSR matrix into an ELL matrix.
+ *  This example converts an ELL matrix into a CSR matrix.
  *  \code{.c}
  *      //     1 2 0 3 0
  *      // A = 0 4 5 0 0
  *      //     6 0 0 7 8
  *
- *      rocsparse_int m   = 3;
- *      rocsparse_int n   = 5;
- *      rocsparse_int nnz = 8;
- *
- *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
- *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
- *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *      rocsparse_int m         = 3;
+ *      rocsparse_int n         = 5;
+ *      rocsparse_int nnz       = 9;
+ *      rocsparse_int ell_width = 3;
  *
- *      // Create ELL matrix descriptor
- *      rocsparse_mat_descr ell_descr;
- *      rocsparse_create_mat_descr(&ell_descr);
+ *      ell_col_ind[nnz] = {0, 1, 0, 1, 2, 3, 3, -1, 4}; // device memory
+ *      ell_val[nnz]     = {1, 4, 6, 2, 5, 7, 3, 0, 8};  // device memory
  *
- *      // Obtain the ELL width
- *      rocsparse_int ell_width;
- *      rocsparse_csr2ell_width(handle,
- *                              m,
- *                              csr_descr,
- *                              csr_row_ptr,
- *                              ell_descr,
- *                              &ell_width);
+ *      // Create CSR matrix descriptor
+ *      rocsparse_mat_descr csr_descr;
+ *      rocsparse_create_mat_descr(&csr_descr);
  *
- *      // Compute ELL non-zero entries
- *      rocsparse_int ell_nnz = m * ell_width;
+ *      // Allocate csr_row_ptr array for row offsets
+ *      rocsparse_int* csr_row_ptr;
+ *      hipMalloc((void**)&csr_row_ptr, sizeof(rocsparse_int) * (m + 1));
  *
- *      // Allocate ELL column and value arrays
- *      rocsparse_int* ell_col_ind;
- *      hipMalloc((void**)&ell_col_ind, sizeof(rocsparse_int) * ell_nnz);
+ *      // Obtain the number of CSR non-zero entries
+ *      // and fill csr_row_ptr array with row offsets
+ *      rocsparse_int csr_nnz;
+ *      rocsparse_ell2csr_nnz(handle,
+ *                            m,
+ *                            n,
+ *                            ell_descr,
+ *                            ell_width,
+ *                            ell_col_ind,
+ *                            csr_descr,
+ *                            csr_row_ptr,
+ *                            &csr_nnz);
  *
- *      float* ell_val;
- *      hipMalloc((void**)&ell_val, sizeof(float) * ell_nnz);
+ *      // Allocate CSR column and value arrays
+ *      rocsparse_int* csr_col_ind;
+ *      hipMalloc((void**)&csr_col_ind, sizeof(rocsparse_int) * csr_nnz);
+ *
+ *      float* csr_val;
+ *      hipMalloc((void**)&csr_val, sizeof(float) * csr_nnz);
  *
  *      // Format conversion
- *      rocsparse_scsr2ell(handle,
+ *      rocsparse_sell2csr(handle,
  *                         m,
- *                         csr_descr,
- *                         csr_val,
- *                         csr_row_ptr,
- *                         csr_col_ind,
+ *                         n,
  *                         ell_descr,
  *                         ell_width,
  *                         ell_val,
- *                         ell_col_ind);
+ *                         ell_col_ind,
+ *                         csr_descr,
+ *                         csr_val,
+ *                         csr_row_ptr,
+ *                         csr_col_ind);
  *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
+rocsparse_status rocsparse_sell2csr(rocsparse_handle handle,
                                     rocsparse_int m,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const float* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_int n,
                                     const rocsparse_mat_descr ell_descr,
                                     rocsparse_int ell_width,
-                                    float* ell_val,
-                                    rocsparse_int* ell_col_ind);
+                                    const float* ell_val,
+                                    const rocsparse_int* ell_col_ind,
+                                    const rocsparse_mat_descr csr_descr,
+                                    float* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    rocsparse_int* csr_col_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2ell(rocsparse_handle handle,
+rocsparse_status rocsparse_dell2csr(rocsparse_handle handle,
                                     rocsparse_int m,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const double* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_int n,
                                     const rocsparse_mat_descr ell_descr,
                                     rocsparse_int ell_width,
-                                    double* ell_val,
-                                    rocsparse_int* ell_col_ind);
+                                    const double* ell_val,
+                                    const rocsparse_int* ell_col_ind,
+                                    const rocsparse_mat_descr csr_descr,
+                                    double* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    rocsparse_int* csr_col_ind);
 
-/*
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
+rocsparse_status rocsparse_cell2csr(rocsparse_handle handle,
                                     rocsparse_int m,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const rocsparse_float_complex* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_int n,
                                     const rocsparse_mat_descr ell_descr,
                                     rocsparse_int ell_width,
-                                    rocsparse_float_complex* ell_val,
-                                    rocsparse_int* ell_col_ind);
+                                    const rocsparse_float_complex* ell_val,
+                                    const rocsparse_int* ell_col_ind,
+                                    const rocsparse_mat_descr csr_descr,
+                                    rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    rocsparse_int* csr_col_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
+rocsparse_status rocsparse_zell2csr(rocsparse_handle handle,
                                     rocsparse_int m,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const rocsparse_double_complex* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_int n,
                                     const rocsparse_mat_descr ell_descr,
                                     rocsparse_int ell_width,
-                                    rocsparse_double_complex* ell_val,
-                                    rocsparse_int* ell_col_ind);
-*/
+                                    const rocsparse_double_complex* ell_val,
+                                    const rocsparse_int* ell_col_ind,
+                                    const rocsparse_mat_descr csr_descr,
+                                    rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    rocsparse_int* csr_col_ind);
 /**@}*/
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse CSR matrix into a sparse HYB matrix
+ *  \brief Convert a sparse DIA matrix into a sparse CSR matrix
  *
  *  \details
- *  \p rocsparse_csr2hyb converts a CSR matrix into a HYB matrix. It is assumed
- *  that \p hyb has been initialized with rocsparse_create_hyb_mat().
- *
- *  \note
- *  This function requires a significant amount of storage for the HYB matrix,
- *  depending on the matrix structure.
+ *  \p rocsparse_dia2csr_nnz computes the total CSR non-zero elements and the CSR
+ *  row offsets, that point to the start of every row of the sparse CSR matrix, for
+ *  a given DIA matrix. It is assumed that \p csr_row_ptr has been allocated with
+ *  size \p m + 1. Only positions of a diagonal that lie outside of the matrix are
+ *  considered padding. All other elements are counted, including explicit zeros, such
+ *  that the CSR pattern only depends on \p dia_offset. A DIA matrix obtained by
+ *  rocsparse_csr2dia() thus converts back into a CSR matrix that also stores the zero
+ *  fill of each occupied diagonal.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
  *
  *  @param[in]
- *  handle          handle to the rocsparse library context queue.
- *  @param[in]
- *  m               number of rows of the sparse CSR matrix.
+ *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  n               number of columns of the sparse CSR matrix.
+ *  m           number of rows of the sparse DIA matrix.
  *  @param[in]
- *  descr           descriptor of the sparse CSR matrix. Currently, only
- *                  \ref rocsparse_matrix_type_general is supported.
+ *  n           number of columns of the sparse DIA matrix.
  *  @param[in]
- *  csr_val         array containing the values of the sparse CSR matrix.
+ *  dia_descr   descriptor of the sparse DIA matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
- *                  sparse CSR matrix.
+ *  ndiag       number of diagonals in DIA storage format.
  *  @param[in]
- *  csr_col_ind     array containing the column indices of the sparse CSR matrix.
- *  @param[out]
- *  hyb             sparse matrix in HYB format.
+ *  dia_val     array of \p m times \p ndiag elements of the sparse DIA matrix.
  *  @param[in]
- *  user_ell_width  width of the ELL part of the HYB matrix (only required if
- *                  \p partition_type == \ref rocsparse_hyb_partition_user).
+ *  dia_offset  array of \p ndiag elements containing the diagonal offsets of the
+ *              sparse DIA matrix.
  *  @param[in]
- *  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
- *                  \ref rocsparse_hyb_partition_user or
- *                  \ref rocsparse_hyb_partition_max.
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[out]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[out]
+ *  csr_nnz     pointer to the total number of non-zero elements in CSR storage
+ *              format.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p user_ell_width is invalid.
- *  \retval     rocsparse_status_invalid_value \p partition_type is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_val,
- *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer for the HYB matrix could not be
- *              allocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ndiag is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p dia_descr, \p dia_val,
+ *              \p dia_offset, \p csr_descr, \p csr_row_ptr or \p csr_nnz pointer is
+ *              invalid.
  *  \retval     rocsparse_status_not_implemented
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  This example converts a CSR matrix into a HYB matrix using user defined partitioning.
- *  \code{.c}
- *      // Create HYB matrix structure
- *      rocsparse_hyb_mat hyb;
- *      rocsparse_create_hyb_mat(&hyb);
- *
- *      // User defined ell width
- *      rocsparse_int user_ell_width = 5;
- *
- *      // Perform the conversion
- *      rocsparse_scsr2hyb(handle,
- *                         m,
- *                         n,
- *                         descr,
- *                         csr_val,
- *                         csr_row_ptr,
- *                         csr_col_ind,
- *                         hyb,
- *                         user_ell_width,
- *                         rocsparse_hyb_partition_user);
- *
- *      // Do some work
- *
- *      // Clean up
- *      rocsparse_destroy_hyb_mat(hyb);
- *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2hyb(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    const rocsparse_mat_descr descr,
-                                    const float* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    rocsparse_hyb_mat hyb,
-                                    rocsparse_int user_ell_width,
-                                    rocsparse_hyb_partition partition_type);
+rocsparse_status rocsparse_sdia2csr_nnz(rocsparse_handle handle,
+                                        rocsparse_int m,
+                                        rocsparse_int n,
+                                        const rocsparse_mat_descr dia_descr,
+                                        rocsparse_int ndiag,
+                                        const float* dia_val,
+                                        const rocsparse_int* dia_offset,
+                                        const rocsparse_mat_descr csr_descr,
+                                        rocsparse_int* csr_row_ptr,
+                                        rocsparse_int* csr_nnz);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    const rocsparse_mat_descr descr,
-                                    const double* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    rocsparse_hyb_mat hyb,
-                                    rocsparse_int user_ell_width,
-                                    rocsparse_hyb_partition partition_type);
-/*
+rocsparse_status rocsparse_ddia2csr_nnz(rocsparse_handle handle,
+                                        rocsparse_int m,
+                                        rocsparse_int n,
+                                        const rocsparse_mat_descr dia_descr,
+                                        rocsparse_int ndiag,
+                                        const double* dia_val,
+                                        const rocsparse_int* dia_offset,
+                                        const rocsparse_mat_descr csr_descr,
+                                        rocsparse_int* csr_row_ptr,
+                                        rocsparse_int* csr_nnz);
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2hyb(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    const rocsparse_mat_descr descr,
-                                    const rocsparse_float_complex* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    rocsparse_hyb_mat hyb,
-                                    rocsparse_int user_ell_width,
-                                    rocsparse_hyb_partition partition_type);
+rocsparse_status rocsparse_cdia2csr_nnz(rocsparse_handle handle,
+                                        rocsparse_int m,
+                                        rocsparse_int n,
+                                        const rocsparse_mat_descr dia_descr,
+                                        rocsparse_int ndiag,
+                                        const rocsparse_float_complex* dia_val,
+                                        const rocsparse_int* dia_offset,
+                                        const rocsparse_mat_descr csr_descr,
+                                        rocsparse_int* csr_row_ptr,
+                                        rocsparse_int* csr_nnz);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    const rocsparse_mat_descr descr,
-                                    const rocsparse_double_complex* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    rocsparse_hyb_mat hyb,
-                                    rocsparse_int user_ell_width,
-                                    rocsparse_hyb_partition partition_type);
-*/
+rocsparse_status rocsparse_zdia2csr_nnz(rocsparse_handle handle,
+                                        rocsparse_int m,
+                                        rocsparse_int n,
+                                        const rocsparse_mat_descr dia_descr,
+                                        rocsparse_int ndiag,
+                                        const rocsparse_double_complex* dia_val,
+                                        const rocsparse_int* dia_offset,
+                                        const rocsparse_mat_descr csr_descr,
+                                        rocsparse_int* csr_row_ptr,
+                                        rocsparse_int* csr_nnz);
 /**@}*/
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse COO matrix into a sparse CSR matrix
+ *  \brief Convert a sparse DIA matrix into a sparse CSR matrix
  *
  *  \details
- *  \p rocsparse_coo2csr converts the COO array containing the row indices into a
- *  CSR array of row offsets, that point to the start of every row.
- *  It is assumed that the COO row index array is sorted.
- *
- *  \note It can also be used, to convert a COO array containing the column indices into
- *  a CSC array of column offsets, that point to the start of every column. Then, it is
- *  assumed that the COO column index array is sorted, instead.
+ *  \p rocsparse_dia2csr converts a DIA matrix into a CSR matrix. It is assumed
+ *  that \p csr_row_ptr has already been filled and that \p csr_val and \p csr_col_ind
+ *  are allocated by the user. \p csr_row_ptr and allocation size of \p csr_col_ind and
+ *  \p csr_val is defined by the number of CSR non-zero elements. Both can be obtained
+ *  by rocsparse_dia2csr_nnz(). The CSR column indices are sorted, if the diagonal
+ *  offsets are stored in increasing order.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -3034,84 +7241,159 @@ rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle handle,
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
- *              matrix.
+ *  m           number of rows of the sparse DIA matrix.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  n           number of columns of the sparse DIA matrix.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
+ *  dia_descr   descriptor of the sparse DIA matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  ndiag       number of diagonals in DIA storage format.
+ *  @param[in]
+ *  dia_val     array of \p m times \p ndiag elements of the sparse DIA matrix.
+ *  @param[in]
+ *  dia_offset  array of \p ndiag elements containing the diagonal offsets of the
+ *              sparse DIA matrix.
+ *  @param[in]
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
  *  @param[out]
+ *  csr_val     array containing the values of the sparse CSR matrix.
+ *  @param[in]
  *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
  *              sparse CSR matrix.
- *  @param[in]
- *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *  @param[out]
+ *  csr_col_ind array containing the column indices of the sparse CSR matrix.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p coo_row_ind or \p csr_row_ptr
- *              pointer is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ndiag is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p dia_descr, \p dia_val,
+ *              \p dia_offset, \p csr_descr, \p csr_val, \p csr_row_ptr or
+ *              \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  *
  *  \par Example
- *  This example converts a COO matrix into a CSR matrix.
+ *  This example converts a DIA matrix into a CSR matrix.
  *  \code{.c}
- *      //     1 2 0 3 0
- *      // A = 0 4 5 0 0
- *      //     6 0 0 7 8
+ *      //     1 2 0 0
+ *      // A = 0 3 4 0
+ *      //     5 0 6 7
  *
- *      rocsparse_int m   = 3;
- *      rocsparse_int n   = 5;
- *      rocsparse_int nnz = 8;
+ *      rocsparse_int m     = 3;
+ *      rocsparse_int n     = 4;
+ *      rocsparse_int ndiag = 3;
  *
- *      coo_row_ind[nnz] = {0, 0, 0, 1, 1, 2, 2, 2}; // device memory
- *      coo_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
- *      coo_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *      dia_offset[ndiag]  = {-2, 0, 1};                  // device memory
+ *      dia_val[m * ndiag] = {0, 0, 5, 1, 3, 6, 2, 4, 7}; // device memory
  *
- *      // Allocate CSR matrix arrays
- *      rocsparse_int* csr_row_ptr;
- *      rocsparse_int* csr_col_ind;
- *      float* csr_val;
+ *      // Create CSR matrix descriptor
+ *      rocsparse_mat_descr csr_descr;
+ *      rocsparse_create_mat_descr(&csr_descr);
  *
+ *      // Allocate csr_row_ptr array for row offsets
+ *      rocsparse_int* csr_row_ptr;
  *      hipMalloc((void**)&csr_row_ptr, sizeof(rocsparse_int) * (m + 1));
- *      hipMalloc((void**)&csr_col_ind, sizeof(rocsparse_int) * nnz);
- *      hipMalloc((void**)&csr_val, sizeof(float) * nnz);
  *
- *      // Convert the coo row indices into csr row offsets
- *      rocsparse_coo2csr(handle,
- *                        coo_row_ind,
- *                        nnz,
- *                        m,
- *                        csr_row_ptr,
- *                        rocsparse_index_base_zero);
+ *      // Obtain the number of CSR non-zero entries
+ *      // and fill csr_row_ptr array with row offsets
+ *      rocsparse_int csr_nnz;
+ *      rocsparse_sdia2csr_nnz(handle,
+ *                             m,
+ *                             n,
+ *                             dia_descr,
+ *                             ndiag,
+ *                             dia_val,
+ *                             dia_offset,
+ *                             csr_descr,
+ *                             csr_row_ptr,
+ *                             &csr_nnz);
  *
- *      // Copy the column and value arrays
- *      hipMemcpy(csr_col_ind,
- *                coo_col_ind,
- *                sizeof(rocsparse_int) * nnz,
- *                hipMemcpyDeviceToDevice);
+ *      // Allocate CSR column and value arrays
+ *      rocsparse_int* csr_col_ind;
+ *      hipMalloc((void**)&csr_col_ind, sizeof(rocsparse_int) * csr_nnz);
  *
- *      hipMemcpy(csr_val,
- *                coo_val,
- *                sizeof(float) * nnz,
- *                hipMemcpyDeviceToDevice);
+ *      float* csr_val;
+ *      hipMalloc((void**)&csr_val, sizeof(float) * csr_nnz);
+ *
+ *      // Format conversion
+ *      rocsparse_sdia2csr(handle,
+ *                         m,
+ *                         n,
+ *                         dia_descr,
+ *                         ndiag,
+ *                         dia_val,
+ *                         dia_offset,
+ *                         csr_descr,
+ *                         csr_val,
+ *                         csr_row_ptr,
+ *                         csr_col_ind);
  *  \endcode
  */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_coo2csr(rocsparse_handle handle,
-                                   const rocsparse_int* coo_row_ind,
-                                   rocsparse_int nnz,
-                                   rocsparse_int m,
-                                   rocsparse_int* csr_row_ptr,
-                                   rocsparse_index_base idx_base);
+rocsparse_status rocsparse_sdia2csr(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr dia_descr,
+                                    rocsparse_int ndiag,
+                                    const float* dia_val,
+                                    const rocsparse_int* dia_offset,
+                                    const rocsparse_mat_descr csr_descr,
+                                    float* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    rocsparse_int* csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ddia2csr(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr dia_descr,
+                                    rocsparse_int ndiag,
+                                    const double* dia_val,
+                                    const rocsparse_int* dia_offset,
+                                    const rocsparse_mat_descr csr_descr,
+                                    double* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    rocsparse_int* csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cdia2csr(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr dia_descr,
+                                    rocsparse_int ndiag,
+                                    const rocsparse_float_complex* dia_val,
+                                    const rocsparse_int* dia_offset,
+                                    const rocsparse_mat_descr csr_descr,
+                                    rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    rocsparse_int* csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zdia2csr(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr dia_descr,
+                                    rocsparse_int ndiag,
+                                    const rocsparse_double_complex* dia_val,
+                                    const rocsparse_int* dia_offset,
+                                    const rocsparse_mat_descr csr_descr,
+                                    rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    rocsparse_int* csr_col_ind);
+/**@}*/
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse ELL matrix into a sparse CSR matrix
+ *  \brief Convert a sparse CSR matrix into a sparse BSR matrix
  *
  *  \details
- *  \p rocsparse_ell2csr_nnz computes the total CSR non-zero elements and the CSR
- *  row offsets, that point to the start of every row of the sparse CSR matrix, for
- *  a given ELL matrix. It is assumed that \p csr_row_ptr has been allocated with
- *  size \p m + 1.
+ *  \p rocsparse_csr2bsr_nnz computes the total number of non-zero blocks and the BSR
+ *  row offsets, that point to the start of every block row of the sparse BSR matrix,
+ *  for a given CSR matrix. A block is non-zero, if it contains at least one entry of
+ *  the CSR matrix. It is assumed that \p bsr_row_ptr has been allocated with size
+ *  \p mb + 1, where \f$mb = (m + \text{block_dim} - 1) / \text{block_dim}\f$.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -3120,55 +7402,59 @@ rocsparse_status rocsparse_coo2csr(rocsparse_handle handle,
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  m           number of rows of the sparse ELL matrix.
+ *  m           number of rows of the sparse CSR matrix.
  *  @param[in]
- *  n           number of columns of the sparse ELL matrix.
+ *  n           number of columns of the sparse CSR matrix.
  *  @param[in]
- *  ell_descr   descriptor of the sparse ELL matrix. Currently, only
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
  *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  ell_width   number of non-zero elements per row in ELL storage format.
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
  *  @param[in]
- *  ell_col_ind array of \p m times \p ell_width elements containing the column indices
- *              of the sparse ELL matrix.
+ *  csr_col_ind array containing the sorted column indices of the sparse CSR matrix.
  *  @param[in]
- *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *  block_dim   row and column dimension of the dense blocks.
+ *  @param[in]
+ *  bsr_descr   descriptor of the sparse BSR matrix. Currently, only
  *              \ref rocsparse_matrix_type_general is supported.
  *  @param[out]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of
+ *              the sparse BSR matrix.
  *  @param[out]
- *  csr_nnz     pointer to the total number of non-zero elements in CSR storage
- *              format.
+ *  bsr_nnz     pointer to the total number of non-zero blocks in BSR storage format.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ell_width is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p ell_descr, \p ell_col_ind,
- *              \p csr_descr, \p csr_row_ptr or \p csr_nnz pointer is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p bsr_descr, \p bsr_row_ptr or \p bsr_nnz pointer is
+ *              invalid.
  *  \retval     rocsparse_status_not_implemented
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle handle,
+rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle handle,
                                        rocsparse_int m,
                                        rocsparse_int n,
-                                       const rocsparse_mat_descr ell_descr,
-                                       rocsparse_int ell_width,
-                                       const rocsparse_int* ell_col_ind,
                                        const rocsparse_mat_descr csr_descr,
-                                       rocsparse_int* csr_row_ptr,
-                                       rocsparse_int* csr_nnz);
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_int block_dim,
+                                       const rocsparse_mat_descr bsr_descr,
+                                       rocsparse_int* bsr_row_ptr,
+                                       rocsparse_int* bsr_nnz);
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse ELL matrix into a sparse CSR matrix
+ *  \brief Convert a sparse CSR matrix into a sparse BSR matrix
  *
  *  \details
- *  \p rocsparse_ell2csr converts an ELL matrix into a CSR matrix. It is assumed
- *  that \p csr_row_ptr has already been filled and that \p csr_val and \p csr_col_ind
- *  are allocated by the user. \p csr_row_ptr and allocation size of \p csr_col_ind and
- *  \p csr_val is defined by the number of CSR non-zero elements. Both can be obtained
- *  by rocsparse_ell2csr_nnz().
+ *  \p rocsparse_csr2bsr converts a CSR matrix into a BSR matrix with square blocks of
+ *  dimension \p block_dim. It is assumed that \p bsr_row_ptr has already been filled by
+ *  rocsparse_csr2bsr_nnz() and that \p bsr_val and \p bsr_col_ind are allocated with
+ *  \p bsr_nnz times \p block_dim times \p block_dim and \p bsr_nnz elements,
+ *  respectively. Entries of a non-zero block that are not part of the CSR matrix are
+ *  explicitly set to zero, as are the rows and columns that exceed \p m and \p n.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -3177,41 +7463,46 @@ rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle handle,
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  m           number of rows of the sparse ELL matrix.
+ *  dir         storage order of the dense blocks, either row-major or column-major.
  *  @param[in]
- *  n           number of columns of the sparse ELL matrix.
+ *  m           number of rows of the sparse CSR matrix.
  *  @param[in]
- *  ell_descr   descriptor of the sparse ELL matrix. Currently, only
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
  *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  ell_width   number of non-zero elements per row in ELL storage format.
+ *  csr_val     array containing the values of the sparse CSR matrix.
  *  @param[in]
- *  ell_val     array of \p m times \p ell_width elements of the sparse ELL matrix.
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
  *  @param[in]
- *  ell_col_ind array of \p m times \p ell_width elements containing the column indices
- *              of the sparse ELL matrix.
+ *  csr_col_ind array containing the sorted column indices of the sparse CSR matrix.
  *  @param[in]
- *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *  block_dim   row and column dimension of the dense blocks.
+ *  @param[in]
+ *  bsr_descr   descriptor of the sparse BSR matrix. Currently, only
  *              \ref rocsparse_matrix_type_general is supported.
  *  @param[out]
- *  csr_val     array containing the values of the sparse CSR matrix.
+ *  bsr_val     array containing the blocks of the sparse BSR matrix.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of
+ *              the sparse BSR matrix.
  *  @param[out]
- *  csr_col_ind array containing the column indices of the sparse CSR matrix.
+ *  bsr_col_ind array containing the block column indices of the sparse BSR matrix.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ell_width is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_value \p dir is invalid.
  *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
- *              \p csr_row_ptr, \p csr_col_ind, \p ell_descr, \p ell_val or
- *              \p ell_col_ind pointer is invalid.
+ *              \p csr_row_ptr, \p csr_col_ind, \p bsr_descr, \p bsr_val,
+ *              \p bsr_row_ptr or \p bsr_col_ind pointer is invalid.
  *  \retval     rocsparse_status_not_implemented
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  *
  *  \par Example
- *  This example converts an ELL matrix into a CSR matrix.
+ *  This example converts a CSR matrix into a BSR matrix with 2 x 2 blocks.
  *  \code{.c}
  *      //     1 2 0 3 0
  *      // A = 0 4 5 0 0
@@ -3219,107 +7510,232 @@ rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle handle,
  *
  *      rocsparse_int m         = 3;
  *      rocsparse_int n         = 5;
- *      rocsparse_int nnz       = 9;
- *      rocsparse_int ell_width = 3;
- *
- *      ell_col_ind[nnz] = {0, 1, 0, 1, 2, 3, 3, -1, 4}; // device memory
- *      ell_val[nnz]     = {1, 4, 6, 2, 5, 7, 3, 0, 8};  // device memory
+ *      rocsparse_int block_dim = 2;
+ *      rocsparse_int mb        = (m + block_dim - 1) / block_dim;
  *
- *      // Create CSR matrix descriptor
- *      rocsparse_mat_descr csr_descr;
- *      rocsparse_create_mat_descr(&csr_descr);
+ *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+ *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+ *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
  *
- *      // Allocate csr_row_ptr array for row offsets
- *      rocsparse_int* csr_row_ptr;
- *      hipMalloc((void**)&csr_row_ptr, sizeof(rocsparse_int) * (m + 1));
+ *      // Allocate bsr_row_ptr array for block row offsets
+ *      rocsparse_int* bsr_row_ptr;
+ *      hipMalloc((void**)&bsr_row_ptr, sizeof(rocsparse_int) * (mb + 1));
  *
- *      // Obtain the number of CSR non-zero entries
- *      // and fill csr_row_ptr array with row offsets
- *      rocsparse_int csr_nnz;
- *      rocsparse_ell2csr_nnz(handle,
+ *      // Obtain the number of BSR non-zero blocks
+ *      // and fill bsr_row_ptr array with block row offsets
+ *      rocsparse_int bsr_nnz;
+ *      rocsparse_csr2bsr_nnz(handle,
  *                            m,
  *                            n,
- *                            ell_descr,
- *                            ell_width,
- *                            ell_col_ind,
  *                            csr_descr,
  *                            csr_row_ptr,
- *                            &csr_nnz);
+ *                            csr_col_ind,
+ *                            block_dim,
+ *                            bsr_descr,
+ *                            bsr_row_ptr,
+ *                            &bsr_nnz);
  *
- *      // Allocate CSR column and value arrays
- *      rocsparse_int* csr_col_ind;
- *      hipMalloc((void**)&csr_col_ind, sizeof(rocsparse_int) * csr_nnz);
+ *      // Allocate BSR column and value arrays
+ *      rocsparse_int* bsr_col_ind;
+ *      hipMalloc((void**)&bsr_col_ind, sizeof(rocsparse_int) * bsr_nnz);
  *
- *      float* csr_val;
- *      hipMalloc((void**)&csr_val, sizeof(float) * csr_nnz);
+ *      float* bsr_val;
+ *      hipMalloc((void**)&bsr_val, sizeof(float) * bsr_nnz * block_dim * block_dim);
  *
  *      // Format conversion
- *      rocsparse_sell2csr(handle,
+ *      rocsparse_scsr2bsr(handle,
+ *                         rocsparse_direction_row,
  *                         m,
  *                         n,
- *                         ell_descr,
- *                         ell_width,
- *                         ell_val,
- *                         ell_col_ind,
  *                         csr_descr,
  *                         csr_val,
  *                         csr_row_ptr,
- *                         csr_col_ind);
+ *                         csr_col_ind,
+ *                         block_dim,
+ *                         bsr_descr,
+ *                         bsr_val,
+ *                         bsr_row_ptr,
+ *                         bsr_col_ind);
  *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sell2csr(rocsparse_handle handle,
+rocsparse_status rocsparse_scsr2bsr(rocsparse_handle handle,
+                                    rocsparse_direction dir,
                                     rocsparse_int m,
                                     rocsparse_int n,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int ell_width,
-                                    const float* ell_val,
-                                    const rocsparse_int* ell_col_ind,
                                     const rocsparse_mat_descr csr_descr,
-                                    float* csr_val,
+                                    const float* csr_val,
                                     const rocsparse_int* csr_row_ptr,
-                                    rocsparse_int* csr_col_ind);
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_int block_dim,
+                                    const rocsparse_mat_descr bsr_descr,
+                                    float* bsr_val,
+                                    const rocsparse_int* bsr_row_ptr,
+                                    rocsparse_int* bsr_col_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dell2csr(rocsparse_handle handle,
+rocsparse_status rocsparse_dcsr2bsr(rocsparse_handle handle,
+                                    rocsparse_direction dir,
                                     rocsparse_int m,
                                     rocsparse_int n,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int ell_width,
-                                    const double* ell_val,
-                                    const rocsparse_int* ell_col_ind,
                                     const rocsparse_mat_descr csr_descr,
-                                    double* csr_val,
+                                    const double* csr_val,
                                     const rocsparse_int* csr_row_ptr,
-                                    rocsparse_int* csr_col_ind);
-/*
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_int block_dim,
+                                    const rocsparse_mat_descr bsr_descr,
+                                    double* bsr_val,
+                                    const rocsparse_int* bsr_row_ptr,
+                                    rocsparse_int* bsr_col_ind);
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cell2csr(rocsparse_handle handle,
+rocsparse_status rocsparse_ccsr2bsr(rocsparse_handle handle,
+                                    rocsparse_direction dir,
                                     rocsparse_int m,
                                     rocsparse_int n,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int ell_width,
-                                    const rocsparse_float_complex* ell_val,
-                                    const rocsparse_int* ell_col_ind,
                                     const rocsparse_mat_descr csr_descr,
-                                    rocsparse_float_complex* csr_val,
+                                    const rocsparse_float_complex* csr_val,
                                     const rocsparse_int* csr_row_ptr,
-                                    rocsparse_int* csr_col_ind);
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_int block_dim,
+                                    const rocsparse_mat_descr bsr_descr,
+                                    rocsparse_float_complex* bsr_val,
+                                    const rocsparse_int* bsr_row_ptr,
+                                    rocsparse_int* bsr_col_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zell2csr(rocsparse_handle handle,
+rocsparse_status rocsparse_zcsr2bsr(rocsparse_handle handle,
+                                    rocsparse_direction dir,
                                     rocsparse_int m,
                                     rocsparse_int n,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int ell_width,
-                                    const rocsparse_double_complex* ell_val,
-                                    const rocsparse_int* ell_col_ind,
                                     const rocsparse_mat_descr csr_descr,
-                                    rocsparse_double_complex* csr_val,
+                                    const rocsparse_double_complex* csr_val,
                                     const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_int block_dim,
+                                    const rocsparse_mat_descr bsr_descr,
+                                    rocsparse_double_complex* bsr_val,
+                                    const rocsparse_int* bsr_row_ptr,
+                                    rocsparse_int* bsr_col_ind);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse BSR matrix into a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_bsr2csr converts a BSR matrix into a CSR matrix with
+ *  \f$m = mb \cdot \text{block_dim}\f$ rows and \f$n = nb \cdot \text{block_dim}\f$
+ *  columns. All entries of the non-zero blocks are kept, including explicit zeros,
+ *  thus \p csr_val and \p csr_col_ind need to be allocated with \p nnzb times
+ *  \p block_dim times \p block_dim elements and \p csr_row_ptr with \p m + 1
+ *  elements.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir         storage order of the dense blocks, either row-major or column-major.
+ *  @param[in]
+ *  mb          number of block rows of the sparse BSR matrix.
+ *  @param[in]
+ *  nb          number of block columns of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_descr   descriptor of the sparse BSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  bsr_val     array containing the blocks of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of
+ *              the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   row and column dimension of the dense blocks.
+ *  @param[in]
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[out]
+ *  csr_val     array containing the values of the sparse CSR matrix.
+ *  @param[out]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[out]
+ *  csr_col_ind array containing the column indices of the sparse CSR matrix.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nb or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_value \p dir is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p bsr_descr, \p bsr_val,
+ *              \p bsr_row_ptr, \p bsr_col_ind, \p csr_descr, \p csr_val,
+ *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsr2csr(rocsparse_handle handle,
+                                    rocsparse_direction dir,
+                                    rocsparse_int mb,
+                                    rocsparse_int nb,
+                                    const rocsparse_mat_descr bsr_descr,
+                                    const float* bsr_val,
+                                    const rocsparse_int* bsr_row_ptr,
+                                    const rocsparse_int* bsr_col_ind,
+                                    rocsparse_int block_dim,
+                                    const rocsparse_mat_descr csr_descr,
+                                    float* csr_val,
+                                    rocsparse_int* csr_row_ptr,
+                                    rocsparse_int* csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsr2csr(rocsparse_handle handle,
+                                    rocsparse_direction dir,
+                                    rocsparse_int mb,
+                                    rocsparse_int nb,
+                                    const rocsparse_mat_descr bsr_descr,
+                                    const double* bsr_val,
+                                    const rocsparse_int* bsr_row_ptr,
+                                    const rocsparse_int* bsr_col_ind,
+                                    rocsparse_int block_dim,
+                                    const rocsparse_mat_descr csr_descr,
+                                    double* csr_val,
+                                    rocsparse_int* csr_row_ptr,
+                                    rocsparse_int* csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsr2csr(rocsparse_handle handle,
+                                    rocsparse_direction dir,
+                                    rocsparse_int mb,
+                                    rocsparse_int nb,
+                                    const rocsparse_mat_descr bsr_descr,
+                                    const rocsparse_float_complex* bsr_val,
+                                    const rocsparse_int* bsr_row_ptr,
+                                    const rocsparse_int* bsr_col_ind,
+                                    rocsparse_int block_dim,
+                                    const rocsparse_mat_descr csr_descr,
+                                    rocsparse_float_complex* csr_val,
+                                    rocsparse_int* csr_row_ptr,
+                                    rocsparse_int* csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsr2csr(rocsparse_handle handle,
+                                    rocsparse_direction dir,
+                                    rocsparse_int mb,
+                                    rocsparse_int nb,
+                                    const rocsparse_mat_descr bsr_descr,
+                                    const rocsparse_double_complex* bsr_val,
+                                    const rocsparse_int* bsr_row_ptr,
+                                    const rocsparse_int* bsr_col_ind,
+                                    rocsparse_int block_dim,
+                                    const rocsparse_mat_descr csr_descr,
+                                    rocsparse_double_complex* csr_val,
+                                    rocsparse_int* csr_row_ptr,
                                     rocsparse_int* csr_col_ind);
-*/
 /**@}*/
 
 /*! \ingroup conv_module
@@ -29,6 +29,8 @@
 #ifndef _ROCSPARSE_TYPES_H_
 #define _ROCSPARSE_TYPES_H_
 
+#include "rocsparse-complex-types.h"
+
 #include <stdint.h>
 
 /*! \ingroup types_module
@@ -73,6 +75,29 @@ typedef struct _rocsparse_mat_descr* rocsparse_mat_descr;
  */
 typedef struct _rocsparse_hyb_mat* rocsparse_hyb_mat;
 
+/*! \ingroup types_module
+ *  \brief SELL-C-\f$\sigma\f$ matrix storage format.
+ *
+ *  \details
+ *  The rocSPARSE SELL-C-\f$\sigma\f$ matrix structure holds the sliced ELL matrix. It
+ *  must be initialized using rocsparse_create_sellc_mat() and the returned matrix must be
+ *  passed to all subsequent library calls that involve the matrix. It should be
+ *  destroyed at the end using rocsparse_destroy_sellc_mat().
+ */
+typedef struct _rocsparse_sellc_mat* rocsparse_sellc_mat;
+
+/*! \ingroup types_module
+ *  \brief CSR5 matrix tile descriptor.
+ *
+ *  \details
+ *  The rocSPARSE CSR5 matrix structure holds the tile descriptor of a CSR matrix. The
+ *  CSR arrays themselves are not copied and remain in use by the application. It must
+ *  be initialized using rocsparse_create_csr5_mat() and the returned matrix must be
+ *  passed to all subsequent library calls that involve the matrix. It should be
+ *  destroyed at the end using rocsparse_destroy_csr5_mat().
+ */
+typedef struct _rocsparse_csr5_mat* rocsparse_csr5_mat;
+
 /*! \ingroup types_module
  *  \brief Info structure to hold all matrix meta data.
  *
@@ -174,6 +199,18 @@ typedef enum rocsparse_action_ {
     rocsparse_action_numeric  = 1  /**< Operate on data and indices. */
 } rocsparse_action;
 
+/*! \ingroup types_module
+ *  \brief Specify the storage order of dense blocks.
+ *
+ *  \details
+ *  The \ref rocsparse_direction indicates whether the dense blocks of a BSR matrix
+ *  are stored in row-major or in column-major order.
+ */
+typedef enum rocsparse_direction_ {
+    rocsparse_direction_row    = 0, /**< Blocks are stored in row-major order. */
+    rocsparse_direction_column = 1  /**< Blocks are stored in column-major order. */
+} rocsparse_direction;
+
 /*! \ingroup types_module
  *  \brief HYB matrix partitioning type.
  *
@@ -187,6 +224,20 @@ typedef enum rocsparse_hyb_partition_ {
     rocsparse_hyb_partition_max  = 2  /**< max ELL nnz per row, no COO part. */
 } rocsparse_hyb_partition;
 
+/*! \ingroup types_module
+ *  \brief List of csrmv algorithms.
+ *
+ *  \details
+ *  The \ref rocsparse_csrmv_alg indicates which algorithm is used by rocsparse_csrmv()
+ *  when analysis meta data is available. For a given \ref rocsparse_mat_info, the
+ *  \ref rocsparse_csrmv_alg can be set using rocsparse_set_mat_info_csrmv_alg() prior
+ *  to rocsparse_csrmv_analysis().
+ */
+typedef enum rocsparse_csrmv_alg_ {
+    rocsparse_csrmv_alg_adaptive = 0, /**< CSR-Adaptive, rows are grouped into row blocks. */
+    rocsparse_csrmv_alg_merge    = 1  /**< merge path, non-zeros and rows are evenly split. */
+} rocsparse_csrmv_alg;
+
 /*! \ingroup types_module
  *  \brief Specify policy in analysis functions.
  *
@@ -205,10 +256,17 @@ typedef enum rocsparse_analysis_policy_ {
  *  \brief Specify policy in triangular solvers and factorizations.
  *
  *  \details
- *  This is a placeholder.
+ *  The \ref rocsparse_solve_policy specifies how dependencies between rows are
+ *  resolved. The sync-free algorithm solves all rows in a single kernel, where rows
+ *  wait for their dependencies to be resolved. The level scheduled algorithm launches
+ *  a kernel per level of the dependency graph and works best for wide levels. With
+ *  \ref rocsparse_solve_policy_auto, the algorithm is chosen from the number of levels
+ *  and the waiting time observed during the analysis.
  */
 typedef enum rocsparse_solve_policy_ {
-    rocsparse_solve_policy_auto = 0 /**< automatically decide on level information. */
+    rocsparse_solve_policy_auto      = 0, /**< automatically decide on level information. */
+    rocsparse_solve_policy_sync_free = 1, /**< sync-free solve in a single kernel. */
+    rocsparse_solve_policy_level     = 2  /**< level scheduled solve. */
 } rocsparse_solve_policy;
 
 /*! \ingroup types_module
@@ -225,6 +283,21 @@ typedef enum rocsparse_pointer_mode_ {
     rocsparse_pointer_mode_device = 1  /**< scalar pointers are in device memory. */
 } rocsparse_pointer_mode;
 
+/*! \ingroup types_module
+ *  \brief Indicates if rocSPARSE routines may block the host.
+ *
+ *  \details
+ *  The \ref rocsparse_exec_mode indicates whether rocSPARSE routines are allowed to
+ *  synchronize with the device, e.g. to copy scalar results or sizes of output
+ *  structures to the host. The \ref rocsparse_exec_mode can be changed by
+ *  rocsparse_set_exec_mode(). The currently used execution mode can be obtained by
+ *  rocsparse_get_exec_mode().
+ */
+typedef enum rocsparse_exec_mode_ {
+    rocsparse_exec_mode_sync  = 0, /**< routines may synchronize with the device. */
+    rocsparse_exec_mode_async = 1  /**< routines do not synchronize with the device. */
+} rocsparse_exec_mode;
+
 /*! \ingroup types_module
  *  \brief Indicates if layer is active with bitmask.
  *
@@ -0,0 +1,88 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSR2CSR_DEVICE_H
+#define BSR2CSR_DEVICE_H
+
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// Expand each block row into block_dim CSR rows, one sub-wavefront per block row.
+// The CSR entries of a block row are contiguous, such that consecutive threads write
+// consecutive CSR entries.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsr2csr_kernel(rocsparse_direction dir,
+                        rocsparse_int mb,
+                        rocsparse_int block_dim,
+                        const T* __restrict__ bsr_val,
+                        const rocsparse_int* __restrict__ bsr_row_ptr,
+                        const rocsparse_int* __restrict__ bsr_col_ind,
+                        rocsparse_index_base bsr_base,
+                        T* __restrict__ csr_val,
+                        rocsparse_int* __restrict__ csr_row_ptr,
+                        rocsparse_int* __restrict__ csr_col_ind,
+                        rocsparse_index_base csr_base)
+{
+    rocsparse_int tid  = hipThreadIdx_x;
+    rocsparse_int lid  = tid & (WF_SIZE - 1);
+    rocsparse_int brow = static_cast<rocsparse_int>(hipBlockIdx_x) * (BLOCKSIZE / WF_SIZE)
+                         + tid / WF_SIZE;
+
+    if(brow >= mb)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = bsr_row_ptr[brow] - bsr_base;
+    rocsparse_int row_end   = bsr_row_ptr[brow + 1] - bsr_base;
+
+    // Number of entries of each CSR row of this block row
+    rocsparse_int row_nnz   = (row_end - row_begin) * block_dim;
+    rocsparse_int csr_begin = row_begin * block_dim * block_dim;
+
+    for(rocsparse_int r = lid; r < block_dim; r += WF_SIZE)
+    {
+        csr_row_ptr[brow * block_dim + r] = csr_begin + r * row_nnz + csr_base;
+    }
+
+    if(brow == mb - 1 && lid == 0)
+    {
+        csr_row_ptr[mb * block_dim] = csr_begin + block_dim * row_nnz + csr_base;
+    }
+
+    for(rocsparse_int k = lid; k < block_dim * row_nnz; k += WF_SIZE)
+    {
+        rocsparse_int r = k / row_nnz;
+        rocsparse_int j = row_begin + (k % row_nnz) / block_dim;
+        rocsparse_int c = k % block_dim;
+
+        csr_col_ind[csr_begin + k] = (bsr_col_ind[j] - bsr_base) * block_dim + c + csr_base;
+        csr_val[csr_begin + k]
+            = bsr_val[j * block_dim * block_dim + BSR_IND(r, c, block_dim, dir)];
+    }
+}
+
+#endif // BSR2CSR_DEVICE_H
@@ -57,7 +57,7 @@ __global__ void coo2csr_kernel(rocsparse_int m,
                                rocsparse_int* csr_row_ptr,
                                rocsparse_index_base idx_base)
 {
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
 
     if(gid >= m)
     {
@@ -33,7 +33,7 @@ __global__ void coosort_permute_kernel(rocsparse_int nnz,
                                        const rocsparse_int* perm,
                                        rocsparse_int* out)
 {
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
 
     if(gid >= nnz)
     {
@@ -0,0 +1,244 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2BSR_DEVICE_H
+#define CSR2BSR_DEVICE_H
+
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+__global__ void csr2bsr_index_base(rocsparse_int* __restrict__ nnz)
+{
+    --(*nnz);
+}
+
+// Minimum of val over the WF_SIZE threads of a sub-wavefront
+template <rocsparse_int WF_SIZE>
+static __device__ __forceinline__ rocsparse_int csr2bsr_wf_min(rocsparse_int val)
+{
+    for(rocsparse_int i = WF_SIZE >> 1; i > 0; i >>= 1)
+    {
+#if defined(__HIP_PLATFORM_HCC__)
+        val = min(val, __shfl_xor(val, i, WF_SIZE));
+#elif defined(__HIP_PLATFORM_NVCC__)
+        val = min(val, __shfl_xor_sync(0xffffffff, val, i, WF_SIZE));
+#endif
+    }
+
+    return val;
+}
+
+// First position in [begin, end) of a sorted CSR row with column index not below col
+static __device__ __forceinline__ rocsparse_int
+    csr2bsr_lower_bound(const rocsparse_int* __restrict__ csr_col_ind,
+                        rocsparse_int begin,
+                        rocsparse_int end,
+                        rocsparse_int col,
+                        rocsparse_index_base idx_base)
+{
+    while(begin < end)
+    {
+        rocsparse_int mid = begin + ((end - begin) >> 1);
+
+        if(csr_col_ind[mid] - idx_base < col)
+        {
+            begin = mid + 1;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+
+    return begin;
+}
+
+// Smallest non-zero block column of block row brow that is not below bcol, or nb if
+// there is none. Each thread of the sub-wavefront searches a subset of the rows of
+// the block row, thus the result is uniform across the sub-wavefront.
+template <rocsparse_int WF_SIZE>
+static __device__ rocsparse_int
+    csr2bsr_next_block_column(rocsparse_int lid,
+                              rocsparse_int m,
+                              rocsparse_int nb,
+                              rocsparse_int block_dim,
+                              rocsparse_int brow,
+                              rocsparse_int bcol,
+                              const rocsparse_int* __restrict__ csr_row_ptr,
+                              const rocsparse_int* __restrict__ csr_col_ind,
+                              rocsparse_index_base idx_base)
+{
+    rocsparse_int next = nb;
+
+    for(rocsparse_int r = lid; r < block_dim; r += WF_SIZE)
+    {
+        rocsparse_int row = brow * block_dim + r;
+
+        if(row >= m)
+        {
+            break;
+        }
+
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        rocsparse_int j
+            = csr2bsr_lower_bound(csr_col_ind, row_begin, row_end, bcol * block_dim, idx_base);
+
+        if(j < row_end)
+        {
+            next = min(next, (csr_col_ind[j] - idx_base) / block_dim);
+        }
+    }
+
+    return csr2bsr_wf_min<WF_SIZE>(next);
+}
+
+// Count the non-zero blocks of each block row, one sub-wavefront per block row
+template <rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2bsr_nnz_per_row(rocsparse_int m,
+                             rocsparse_int mb,
+                             rocsparse_int nb,
+                             rocsparse_int block_dim,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             rocsparse_index_base csr_base,
+                             rocsparse_int* __restrict__ bsr_row_ptr,
+                             rocsparse_index_base bsr_base)
+{
+    rocsparse_int tid  = hipThreadIdx_x;
+    rocsparse_int lid  = tid & (WF_SIZE - 1);
+    rocsparse_int brow = static_cast<rocsparse_int>(hipBlockIdx_x) * (BLOCKSIZE / WF_SIZE)
+                         + tid / WF_SIZE;
+
+    if(brow >= mb)
+    {
+        return;
+    }
+
+    if(brow == 0 && lid == 0)
+    {
+        bsr_row_ptr[0] = bsr_base;
+    }
+
+    rocsparse_int nnzb = 0;
+
+    for(rocsparse_int bcol = csr2bsr_next_block_column<WF_SIZE>(
+            lid, m, nb, block_dim, brow, 0, csr_row_ptr, csr_col_ind, csr_base);
+        bcol < nb;
+        bcol = csr2bsr_next_block_column<WF_SIZE>(
+            lid, m, nb, block_dim, brow, bcol + 1, csr_row_ptr, csr_col_ind, csr_base))
+    {
+        ++nnzb;
+    }
+
+    if(lid == 0)
+    {
+        bsr_row_ptr[brow + 1] = nnzb;
+    }
+}
+
+// Fill the non-zero blocks of each block row, one sub-wavefront per block row. Each
+// thread writes complete rows of a block, padding them with zeros.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2bsr_fill(rocsparse_direction dir,
+                      rocsparse_int m,
+                      rocsparse_int mb,
+                      rocsparse_int nb,
+                      rocsparse_int block_dim,
+                      const T* __restrict__ csr_val,
+                      const rocsparse_int* __restrict__ csr_row_ptr,
+                      const rocsparse_int* __restrict__ csr_col_ind,
+                      rocsparse_index_base csr_base,
+                      T* __restrict__ bsr_val,
+                      const rocsparse_int* __restrict__ bsr_row_ptr,
+                      rocsparse_int* __restrict__ bsr_col_ind,
+                      rocsparse_index_base bsr_base)
+{
+    rocsparse_int tid  = hipThreadIdx_x;
+    rocsparse_int lid  = tid & (WF_SIZE - 1);
+    rocsparse_int brow = static_cast<rocsparse_int>(hipBlockIdx_x) * (BLOCKSIZE / WF_SIZE)
+                         + tid / WF_SIZE;
+
+    if(brow >= mb)
+    {
+        return;
+    }
+
+    rocsparse_int idx = bsr_row_ptr[brow] - bsr_base;
+
+    for(rocsparse_int bcol = csr2bsr_next_block_column<WF_SIZE>(
+            lid, m, nb, block_dim, brow, 0, csr_row_ptr, csr_col_ind, csr_base);
+        bcol < nb;
+        bcol = csr2bsr_next_block_column<WF_SIZE>(
+            lid, m, nb, block_dim, brow, bcol + 1, csr_row_ptr, csr_col_ind, csr_base))
+    {
+        if(lid == 0)
+        {
+            bsr_col_ind[idx] = bcol + bsr_base;
+        }
+
+        T* block = bsr_val + idx * block_dim * block_dim;
+
+        for(rocsparse_int r = lid; r < block_dim; r += WF_SIZE)
+        {
+            for(rocsparse_int c = 0; c < block_dim; ++c)
+            {
+                block[BSR_IND(r, c, block_dim, dir)] = static_cast<T>(0);
+            }
+
+            rocsparse_int row = brow * block_dim + r;
+
+            if(row >= m)
+            {
+                continue;
+            }
+
+            rocsparse_int row_begin = csr_row_ptr[row] - csr_base;
+            rocsparse_int row_end   = csr_row_ptr[row + 1] - csr_base;
+
+            for(rocsparse_int j = csr2bsr_lower_bound(
+                    csr_col_ind, row_begin, row_end, bcol * block_dim, csr_base);
+                j < row_end;
+                ++j)
+            {
+                rocsparse_int c = csr_col_ind[j] - csr_base - bcol * block_dim;
+
+                if(c >= block_dim)
+                {
+                    break;
+                }
+
+                block[BSR_IND(r, c, block_dim, dir)] = csr_val[j];
+            }
+        }
+
+        ++idx;
+    }
+}
+
+#endif // CSR2BSR_DEVICE_H
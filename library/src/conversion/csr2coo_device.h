@@ -35,7 +35,7 @@ __global__ void csr2coo_kernel(rocsparse_int m,
                                rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
     rocsparse_int lid = tid & (WF_SIZE - 1);
     rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
 
@@ -35,7 +35,7 @@ __global__ void csr2csc_permute_kernel(rocsparse_int nnz,
                                        rocsparse_int* out1,
                                        T* out2)
 {
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
 
     if(gid >= nnz)
     {
@@ -0,0 +1,273 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2CSR5_DEVICE_H
+#define CSR2CSR5_DEVICE_H
+
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// Returns the row that contains the (zero based) non-zero entry j, that is the
+// largest row whose first entry is not behind j. Empty rows are skipped.
+static __device__ rocsparse_int csr2csr5_row_search(rocsparse_int m,
+                                                    const rocsparse_int* csr_row_ptr,
+                                                    rocsparse_int j,
+                                                    rocsparse_index_base idx_base)
+{
+    rocsparse_int left  = 0;
+    rocsparse_int right = m - 1;
+
+    while(left < right)
+    {
+        rocsparse_int mid = left + (right - left + 1) / 2;
+
+        if(csr_row_ptr[mid] - idx_base <= j)
+        {
+            left = mid;
+        }
+        else
+        {
+            right = mid - 1;
+        }
+    }
+
+    return left;
+}
+
+// Compute the row that contains the first entry of each tile
+template <rocsparse_int BLOCKSIZE>
+__global__ void csr2csr5_tile_ptr(rocsparse_int m,
+                                  rocsparse_int ntiles,
+                                  rocsparse_int tile_size,
+                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                  rocsparse_int* __restrict__ tile_ptr,
+                                  rocsparse_index_base idx_base)
+{
+    rocsparse_int tile = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(tile >= ntiles)
+    {
+        return;
+    }
+
+    tile_ptr[tile] = csr2csr5_row_search(m, csr_row_ptr, tile * tile_size, idx_base);
+}
+
+// Compute the tile descriptor. Each block processes a tile, where each thread
+// owns SIGMA consecutive entries. Bit s of the flag is set if the s-th entry of
+// the thread starts a row. The y offset is the number of row starts in preceding
+// threads of the tile and the segment offset is the number of subsequent threads
+// without any row start. The number of row starts of the tile is stored in
+// tile_desc_rows_ptr[tile + 1].
+template <rocsparse_int OMEGA, rocsparse_int SIGMA>
+__launch_bounds__(OMEGA) __global__
+    void csr2csr5_tile_desc(rocsparse_int m,
+                            rocsparse_int nnz,
+                            const rocsparse_int* __restrict__ csr_row_ptr,
+                            uint32_t* __restrict__ tile_desc_flag,
+                            uint32_t* __restrict__ tile_desc_offset,
+                            rocsparse_int* __restrict__ tile_desc_rows_ptr,
+                            rocsparse_index_base idx_base)
+{
+    rocsparse_int lid  = hipThreadIdx_x;
+    rocsparse_int tile = hipBlockIdx_x;
+
+    __shared__ rocsparse_int sdata[OMEGA];
+
+    rocsparse_int begin = tile * OMEGA * SIGMA + lid * SIGMA;
+
+    uint32_t flag = 0;
+
+    if(begin < nnz)
+    {
+        rocsparse_int row = csr2csr5_row_search(m, csr_row_ptr, begin, idx_base);
+
+        for(rocsparse_int s = 0; s < SIGMA; ++s)
+        {
+            rocsparse_int j = begin + s;
+
+            if(j >= nnz)
+            {
+                break;
+            }
+
+            // Move on to the row that contains entry j
+            if(csr_row_ptr[row + 1] - idx_base <= j)
+            {
+                row = csr2csr5_row_search(m, csr_row_ptr, j, idx_base);
+            }
+
+            if(csr_row_ptr[row] - idx_base == j)
+            {
+                flag |= (1u << s);
+            }
+        }
+    }
+
+    // Inclusive scan of the number of row starts
+    rocsparse_int nstart = __popc(flag);
+
+    sdata[lid] = nstart;
+    __syncthreads();
+
+    for(rocsparse_int d = 1; d < OMEGA; d <<= 1)
+    {
+        rocsparse_int val = (lid >= d) ? sdata[lid - d] : 0;
+        __syncthreads();
+        sdata[lid] += val;
+        __syncthreads();
+    }
+
+    rocsparse_int inclusive = sdata[lid];
+
+    // Number of subsequent threads without row start
+    rocsparse_int seg_offset = 0;
+    for(rocsparse_int k = lid + 1; k < OMEGA && sdata[k] == inclusive; ++k)
+    {
+        ++seg_offset;
+    }
+
+    uint32_t y_offset = static_cast<uint32_t>(inclusive - nstart);
+
+    tile_desc_flag[tile * OMEGA + lid]   = flag;
+    tile_desc_offset[tile * OMEGA + lid] = y_offset | (static_cast<uint32_t>(seg_offset) << 16);
+
+    if(lid == OMEGA - 1)
+    {
+        tile_desc_rows_ptr[tile + 1] = inclusive;
+    }
+}
+
+// Mark empty rows, entry m is zero such that a subsequent exclusive scan holds
+// the total number of empty rows
+template <rocsparse_int BLOCKSIZE>
+__global__ void csr2csr5_empty_rows_mark(rocsparse_int m,
+                                         const rocsparse_int* __restrict__ csr_row_ptr,
+                                         rocsparse_int* __restrict__ mark)
+{
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row > m)
+    {
+        return;
+    }
+
+    mark[row] = (row < m && csr_row_ptr[row + 1] == csr_row_ptr[row]) ? 1 : 0;
+}
+
+// Gather the empty rows, given their exclusive scanned positions
+template <rocsparse_int BLOCKSIZE>
+__global__ void csr2csr5_empty_rows_fill(rocsparse_int m,
+                                         const rocsparse_int* __restrict__ csr_row_ptr,
+                                         const rocsparse_int* __restrict__ pos,
+                                         rocsparse_int* __restrict__ empty_rows)
+{
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    if(csr_row_ptr[row + 1] == csr_row_ptr[row])
+    {
+        empty_rows[pos[row]] = row;
+    }
+}
+
+// Only tiles that span empty rows require explicit segment rows. Clear the row
+// count of all other tiles, such that a subsequent scan yields the offsets.
+template <rocsparse_int BLOCKSIZE>
+__global__ void csr2csr5_tile_rows_count(rocsparse_int m,
+                                         rocsparse_int nnz,
+                                         rocsparse_int ntiles,
+                                         rocsparse_int tile_size,
+                                         const rocsparse_int* __restrict__ csr_row_ptr,
+                                         const rocsparse_int* __restrict__ tile_ptr,
+                                         const rocsparse_int* __restrict__ pos,
+                                         rocsparse_int* __restrict__ tile_desc_rows_ptr,
+                                         rocsparse_index_base idx_base)
+{
+    rocsparse_int tile = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(tile == 0)
+    {
+        tile_desc_rows_ptr[0] = 0;
+    }
+
+    if(tile >= ntiles)
+    {
+        return;
+    }
+
+    rocsparse_int tile_begin = tile * tile_size;
+    rocsparse_int last       = tile_begin + min(tile_size, nnz - tile_begin) - 1;
+
+    rocsparse_int row_begin = tile_ptr[tile];
+    rocsparse_int row_end   = csr2csr5_row_search(m, csr_row_ptr, last, idx_base);
+
+    if(pos[row_end] == pos[row_begin])
+    {
+        tile_desc_rows_ptr[tile + 1] = 0;
+    }
+}
+
+// Store the row of each segment for tiles that span empty rows
+template <rocsparse_int BLOCKSIZE>
+__global__ void csr2csr5_tile_rows_fill(rocsparse_int ntiles,
+                                        rocsparse_int tile_size,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        const rocsparse_int* __restrict__ tile_ptr,
+                                        const rocsparse_int* __restrict__ tile_desc_rows_ptr,
+                                        rocsparse_int* __restrict__ tile_desc_rows,
+                                        rocsparse_index_base idx_base)
+{
+    rocsparse_int tile = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(tile >= ntiles)
+    {
+        return;
+    }
+
+    rocsparse_int rows_begin = tile_desc_rows_ptr[tile];
+    rocsparse_int nrows      = tile_desc_rows_ptr[tile + 1] - rows_begin;
+
+    rocsparse_int tile_begin = tile * tile_size;
+    rocsparse_int row        = tile_ptr[tile];
+
+    // Collect the non-empty rows that start within the tile
+    for(rocsparse_int k = 0; k < nrows; ++row)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+
+        if(row_begin >= tile_begin && csr_row_ptr[row + 1] - idx_base > row_begin)
+        {
+            tile_desc_rows[rows_begin + k] = row;
+            ++k;
+        }
+    }
+}
+
+#endif // CSR2CSR5_DEVICE_H
@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2DIA_DEVICE_H
+#define CSR2DIA_DEVICE_H
+
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// Flag all diagonals that hold at least one entry, one thread per row. The
+// entry (i, j) lies on diagonal j - i + m - 1, such that diag_flag holds
+// m + n - 1 flags.
+template <rocsparse_int BLOCKSIZE>
+__global__ void csr2dia_flag_diag(rocsparse_int m,
+                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                  rocsparse_int* __restrict__ diag_flag,
+                                  rocsparse_index_base idx_base)
+{
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        diag_flag[csr_col_ind[j] - idx_base - row + m - 1] = 1;
+    }
+}
+
+// Store the offset of each flagged diagonal at its position within the DIA
+// matrix. Diagonal positions are obtained by an exclusive scan of the flags,
+// thus offsets are stored in increasing order.
+template <rocsparse_int BLOCKSIZE>
+__global__ void csr2dia_offset(rocsparse_int m,
+                               rocsparse_int n,
+                               rocsparse_int ndiag,
+                               const rocsparse_int* __restrict__ diag_flag,
+                               const rocsparse_int* __restrict__ diag_pos,
+                               rocsparse_int* __restrict__ dia_offset)
+{
+    rocsparse_int diag = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(diag >= m + n - 1)
+    {
+        return;
+    }
+
+    rocsparse_int pos = diag_pos[diag];
+
+    if(diag_flag[diag] != 0 && pos < ndiag)
+    {
+        dia_offset[pos] = diag - m + 1;
+    }
+}
+
+// CSR to DIA format conversion kernel, one thread per row. The DIA values have
+// been zero initialized, such that only the CSR entries have to be scattered.
+template <typename T, rocsparse_int BLOCKSIZE>
+__global__ void csr2dia_fill(rocsparse_int m,
+                             rocsparse_int ndiag,
+                             const T* __restrict__ csr_val,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             const rocsparse_int* __restrict__ diag_pos,
+                             T* __restrict__ dia_val,
+                             rocsparse_index_base idx_base)
+{
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int d = diag_pos[csr_col_ind[j] - idx_base - row + m - 1];
+
+        if(d < ndiag)
+        {
+            dia_val[DIA_IND(row, d, m)] = csr_val[j];
+        }
+    }
+}
+
+#endif // CSR2DIA_DEVICE_H
@@ -53,7 +53,7 @@ __global__ void
 ell_width_kernel_part1(rocsparse_int m, const rocsparse_int* csr_row_ptr, rocsparse_int* workspace)
 {
     rocsparse_int tid = hipThreadIdx_x;
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
 
     __shared__ rocsparse_int sdata[NB];
     sdata[tid] = 0;
@@ -121,7 +121,7 @@ __global__ void csr2ell_kernel(rocsparse_int m,
                                T* ell_val,
                                rocsparse_index_base ell_idx_base)
 {
-    rocsparse_int ai = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int ai = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
 
     if(ai >= m)
     {
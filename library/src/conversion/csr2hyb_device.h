@@ -37,7 +37,7 @@ __global__ void hyb_coo_nnz(rocsparse_int m,
                             rocsparse_int* coo_row_nnz,
                             rocsparse_index_base idx_base)
 {
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
 
     if(gid < m)
     {
@@ -60,6 +60,26 @@ __global__ void hyb_coo_nnz(rocsparse_int m,
     }
 }
 
+// Histogram of the CSR row lengths. Rows exceeding max_width are gathered in
+// the last bin max_width + 1.
+template <rocsparse_int NB>
+__global__ void hyb_row_nnz_histogram(rocsparse_int m,
+                                      rocsparse_int max_width,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      rocsparse_int* __restrict__ hist)
+{
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_nnz = csr_row_ptr[gid + 1] - csr_row_ptr[gid];
+
+    atomicAdd(&hist[(row_nnz > max_width) ? max_width + 1 : row_nnz], 1);
+}
+
 // CSR to HYB format conversion kernel
 template <typename T>
 __global__ void csr2hyb_kernel(rocsparse_int m,
@@ -69,13 +89,14 @@ __global__ void csr2hyb_kernel(rocsparse_int m,
                                rocsparse_int ell_width,
                                rocsparse_int* ell_col_ind,
                                T* ell_val,
+                               rocsparse_int coo_nnz,
                                rocsparse_int* coo_row_ind,
                                rocsparse_int* coo_col_ind,
                                T* coo_val,
                                rocsparse_int* workspace,
                                rocsparse_index_base idx_base)
 {
-    rocsparse_int ai = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int ai = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
 
     if(ai >= m)
     {
@@ -98,9 +119,10 @@ __global__ void csr2hyb_kernel(rocsparse_int m,
             ell_col_ind[idx]  = csr_col_ind[aj];
             ell_val[idx]      = csr_val[aj];
         }
-        else
+        else if(coo_idx < coo_nnz)
         {
-            // Fill COO part
+            // Fill COO part, entries beyond its size are discarded. This can only
+            // happen in async mode, if the matrix exceeds the user given bound.
             coo_row_ind[coo_idx] = ai + idx_base;
             coo_col_ind[coo_idx] = csr_col_ind[aj];
             coo_val[coo_idx]     = csr_val[aj];
@@ -117,4 +139,26 @@ __global__ void csr2hyb_kernel(rocsparse_int m,
     }
 }
 
+// Pad the COO part behind its actual non-zero entries. Padded entries hold the
+// row index -1 (after index base correction), which is skipped by coomv.
+template <typename T>
+__global__ void hyb_coo_pad(rocsparse_int coo_nnz_bound,
+                            const rocsparse_int* __restrict__ coo_nnz,
+                            rocsparse_int* __restrict__ coo_row_ind,
+                            rocsparse_int* __restrict__ coo_col_ind,
+                            T* __restrict__ coo_val,
+                            rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= coo_nnz_bound || gid < *coo_nnz - idx_base)
+    {
+        return;
+    }
+
+    coo_row_ind[gid] = idx_base - 1;
+    coo_col_ind[gid] = idx_base;
+    coo_val[gid]     = static_cast<T>(0);
+}
+
 #endif // CSR2HYB_DEVICE_H
@@ -0,0 +1,151 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2SELLC_DEVICE_H
+#define CSR2SELLC_DEVICE_H
+
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// Compute the sort keys that order the rows by sorting window and, within each
+// window, by descending row length. Initializes the row permutation.
+template <rocsparse_int BLOCKSIZE>
+__global__ void csr2sellc_sort_keys(rocsparse_int m,
+                                    rocsparse_int sigma,
+                                    rocsparse_int max_row_nnz,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    int64_t* __restrict__ keys,
+                                    rocsparse_int* __restrict__ perm)
+{
+    rocsparse_int ai = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_nnz = csr_row_ptr[ai + 1] - csr_row_ptr[ai];
+
+    keys[ai] = static_cast<int64_t>(ai / sigma) * (max_row_nnz + 1) + (max_row_nnz - row_nnz);
+    perm[ai] = ai;
+}
+
+// Compute the padded size of each slice, that is the maximum row length of the
+// slice times the slice size. Slice offsets are obtained by a subsequent scan.
+template <rocsparse_int BLOCKSIZE, rocsparse_int SLICE_SIZE>
+__global__ void csr2sellc_slice_size(rocsparse_int m,
+                                     rocsparse_int nslices,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ perm,
+                                     rocsparse_int* __restrict__ slice_ptr)
+{
+    rocsparse_int slice = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(slice == 0)
+    {
+        slice_ptr[0] = 0;
+    }
+
+    if(slice >= nslices)
+    {
+        return;
+    }
+
+    rocsparse_int width = 0;
+
+    for(rocsparse_int r = 0; r < SLICE_SIZE; ++r)
+    {
+        rocsparse_int p = slice * SLICE_SIZE + r;
+
+        if(p >= m)
+        {
+            break;
+        }
+
+        rocsparse_int row = perm[p];
+
+        width = max(width, csr_row_ptr[row + 1] - csr_row_ptr[row]);
+    }
+
+    slice_ptr[slice + 1] = width * SLICE_SIZE;
+}
+
+// CSR to SELL-C-sigma format conversion kernel, one thread per sorted row.
+// Entries are stored column-major within each slice, padded with -1 (column
+// index) and zero (value) up to the slice width.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int SLICE_SIZE>
+__global__ void csr2sellc_fill(rocsparse_int m,
+                               rocsparse_int nslices,
+                               const T* __restrict__ csr_val,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               const rocsparse_int* __restrict__ slice_ptr,
+                               const rocsparse_int* __restrict__ perm,
+                               rocsparse_int* __restrict__ sell_col_ind,
+                               T* __restrict__ sell_val,
+                               rocsparse_index_base idx_base)
+{
+    rocsparse_int p = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(p >= nslices * SLICE_SIZE)
+    {
+        return;
+    }
+
+    rocsparse_int slice = p / SLICE_SIZE;
+    rocsparse_int lane  = p % SLICE_SIZE;
+
+    rocsparse_int slice_begin = slice_ptr[slice];
+    rocsparse_int width       = (slice_ptr[slice + 1] - slice_begin) / SLICE_SIZE;
+
+    rocsparse_int k = 0;
+
+    // Copy the CSR row that has been sorted to position p
+    if(p < m)
+    {
+        rocsparse_int row       = perm[p];
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j, ++k)
+        {
+            rocsparse_int idx = slice_begin + k * SLICE_SIZE + lane;
+
+            sell_col_ind[idx] = csr_col_ind[j];
+            sell_val[idx]     = csr_val[j];
+        }
+    }
+
+    // Pad up to the slice width
+    for(; k < width; ++k)
+    {
+        rocsparse_int idx = slice_begin + k * SLICE_SIZE + lane;
+
+        sell_col_ind[idx] = -1;
+        sell_val[idx]     = static_cast<T>(0);
+    }
+}
+
+#endif // CSR2SELLC_DEVICE_H
@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef DIA2CSR_DEVICE_H
+#define DIA2CSR_DEVICE_H
+
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+__global__ void dia2csr_index_base(rocsparse_int* __restrict__ nnz)
+{
+    --(*nnz);
+}
+
+// Count the non-zero entries of each row, one thread per row. Only positions of a
+// diagonal that lie outside of the matrix are padding, explicit zeros are kept.
+template <rocsparse_int BLOCKSIZE>
+__global__ void dia2csr_nnz_per_row(rocsparse_int m,
+                                    rocsparse_int n,
+                                    rocsparse_int ndiag,
+                                    const rocsparse_int* __restrict__ dia_offset,
+                                    rocsparse_int* __restrict__ csr_row_ptr,
+                                    rocsparse_index_base csr_base)
+{
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    if(row == 0)
+    {
+        csr_row_ptr[0] = csr_base;
+    }
+
+    rocsparse_int nnz = 0;
+
+    for(rocsparse_int d = 0; d < ndiag; ++d)
+    {
+        rocsparse_int col = row + dia_offset[d];
+
+        if(col >= 0 && col < n)
+        {
+            ++nnz;
+        }
+    }
+
+    csr_row_ptr[row + 1] = nnz;
+}
+
+// DIA to CSR format conversion kernel, one thread per row. Column indices are
+// sorted, if the diagonal offsets are sorted.
+template <typename T, rocsparse_int BLOCKSIZE>
+__global__ void dia2csr_fill(rocsparse_int m,
+                             rocsparse_int n,
+                             rocsparse_int ndiag,
+                             const T* __restrict__ dia_val,
+                             const rocsparse_int* __restrict__ dia_offset,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             rocsparse_int* __restrict__ csr_col_ind,
+                             T* __restrict__ csr_val,
+                             rocsparse_index_base csr_base)
+{
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int csr_idx = csr_row_ptr[row] - csr_base;
+
+    for(rocsparse_int d = 0; d < ndiag; ++d)
+    {
+        rocsparse_int col = row + dia_offset[d];
+
+        if(col >= 0 && col < n)
+        {
+            csr_col_ind[csr_idx] = col + csr_base;
+            csr_val[csr_idx]     = dia_val[DIA_IND(row, d, m)];
+            ++csr_idx;
+        }
+    }
+}
+
+#endif // DIA2CSR_DEVICE_H
@@ -0,0 +1,247 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_BSR2CSR_HPP
+#define ROCSPARSE_BSR2CSR_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "grid.h"
+#include "bsr2csr_device.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T, rocsparse_int WF_SIZE>
+static rocsparse_status rocsparse_bsr2csr_launch(rocsparse_handle handle,
+                                                 rocsparse_direction dir,
+                                                 rocsparse_int mb,
+                                                 const rocsparse_mat_descr bsr_descr,
+                                                 const T* bsr_val,
+                                                 const rocsparse_int* bsr_row_ptr,
+                                                 const rocsparse_int* bsr_col_ind,
+                                                 rocsparse_int block_dim,
+                                                 const rocsparse_mat_descr csr_descr,
+                                                 T* csr_val,
+                                                 rocsparse_int* csr_row_ptr,
+                                                 rocsparse_int* csr_col_ind)
+{
+#define BSR2CSR_DIM 256
+    // One sub-wavefront per block row
+    dim3 bsr2csr_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_grid_dim(static_cast<int64_t>(WF_SIZE) * mb, BSR2CSR_DIM, bsr2csr_blocks));
+    dim3 bsr2csr_threads(BSR2CSR_DIM);
+
+    hipLaunchKernelGGL((bsr2csr_kernel<T, BSR2CSR_DIM, WF_SIZE>),
+                       bsr2csr_blocks,
+                       bsr2csr_threads,
+                       0,
+                       handle->stream,
+                       dir,
+                       mb,
+                       block_dim,
+                       bsr_val,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       bsr_descr->base,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_descr->base);
+#undef BSR2CSR_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsr2csr_template(rocsparse_handle handle,
+                                            rocsparse_direction dir,
+                                            rocsparse_int mb,
+                                            rocsparse_int nb,
+                                            const rocsparse_mat_descr bsr_descr,
+                                            const T* bsr_val,
+                                            const rocsparse_int* bsr_row_ptr,
+                                            const rocsparse_int* bsr_col_ind,
+                                            rocsparse_int block_dim,
+                                            const rocsparse_mat_descr csr_descr,
+                                            T* csr_val,
+                                            rocsparse_int* csr_row_ptr,
+                                            rocsparse_int* csr_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(bsr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsr2csr"),
+              dir,
+              mb,
+              nb,
+              (const void*&)bsr_descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)csr_descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind);
+
+    log_bench(handle,
+              "./rocsparse-bench -f bsr2csr -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> "
+              "--blockdim",
+              block_dim,
+              "--direction",
+              dir);
+
+    // Check direction
+    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check index base
+    if(bsr_descr->base != rocsparse_index_base_zero && bsr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(bsr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0 || nb < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(bsr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Larger blocks come with more entries per block row
+    if(block_dim <= 2)
+    {
+        return rocsparse_bsr2csr_launch<T, 8>(handle,
+                                              dir,
+                                              mb,
+                                              bsr_descr,
+                                              bsr_val,
+                                              bsr_row_ptr,
+                                              bsr_col_ind,
+                                              block_dim,
+                                              csr_descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind);
+    }
+    else if(block_dim <= 4)
+    {
+        return rocsparse_bsr2csr_launch<T, 16>(handle,
+                                               dir,
+                                               mb,
+                                               bsr_descr,
+                                               bsr_val,
+                                               bsr_row_ptr,
+                                               bsr_col_ind,
+                                               block_dim,
+                                               csr_descr,
+                                               csr_val,
+                                               csr_row_ptr,
+                                               csr_col_ind);
+    }
+    else
+    {
+        return rocsparse_bsr2csr_launch<T, 32>(handle,
+                                               dir,
+                                               mb,
+                                               bsr_descr,
+                                               bsr_val,
+                                               bsr_row_ptr,
+                                               bsr_col_ind,
+                                               block_dim,
+                                               csr_descr,
+                                               csr_val,
+                                               csr_row_ptr,
+                                               csr_col_ind);
+    }
+}
+
+#endif // ROCSPARSE_BSR2CSR_HPP
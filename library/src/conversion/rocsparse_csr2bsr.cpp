@@ -0,0 +1,407 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "utility.h"
+#include "rocsparse.h"
+#include "grid.h"
+#include "csr2bsr_device.h"
+#include "rocsparse_csr2bsr.hpp"
+
+#include <hip/hip_runtime.h>
+#include <hipcub/hipcub.hpp>
+
+template <rocsparse_int WF_SIZE>
+static rocsparse_status rocsparse_csr2bsr_nnz_launch(rocsparse_handle handle,
+                                                     rocsparse_int m,
+                                                     rocsparse_int mb,
+                                                     rocsparse_int nb,
+                                                     const rocsparse_mat_descr csr_descr,
+                                                     const rocsparse_int* csr_row_ptr,
+                                                     const rocsparse_int* csr_col_ind,
+                                                     rocsparse_int block_dim,
+                                                     const rocsparse_mat_descr bsr_descr,
+                                                     rocsparse_int* bsr_row_ptr)
+{
+#define CSR2BSR_DIM 256
+    // One sub-wavefront per block row
+    dim3 csr2bsr_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_grid_dim(static_cast<int64_t>(WF_SIZE) * mb, CSR2BSR_DIM, csr2bsr_blocks));
+    dim3 csr2bsr_threads(CSR2BSR_DIM);
+
+    hipLaunchKernelGGL((csr2bsr_nnz_per_row<CSR2BSR_DIM, WF_SIZE>),
+                       csr2bsr_blocks,
+                       csr2bsr_threads,
+                       0,
+                       handle->stream,
+                       m,
+                       mb,
+                       nb,
+                       block_dim,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_descr->base,
+                       bsr_row_ptr,
+                       bsr_descr->base);
+#undef CSR2BSR_DIM
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle handle,
+                                                  rocsparse_int m,
+                                                  rocsparse_int n,
+                                                  const rocsparse_mat_descr csr_descr,
+                                                  const rocsparse_int* csr_row_ptr,
+                                                  const rocsparse_int* csr_col_ind,
+                                                  rocsparse_int block_dim,
+                                                  const rocsparse_mat_descr bsr_descr,
+                                                  rocsparse_int* bsr_row_ptr,
+                                                  rocsparse_int* bsr_nnz)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2bsr_nnz",
+              m,
+              n,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              block_dim,
+              (const void*&)bsr_descr,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_nnz);
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(bsr_descr->base != rocsparse_index_base_zero && bsr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(bsr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(bsr_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *bsr_nnz = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    rocsparse_int mb = (m + block_dim - 1) / block_dim;
+    rocsparse_int nb = (n + block_dim - 1) / block_dim;
+
+    // Count non-zero blocks per block row, each thread of a sub-wavefront processes at
+    // least one row of a block row
+    if(block_dim <= 4)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz_launch<4>(handle,
+                                                                  m,
+                                                                  mb,
+                                                                  nb,
+                                                                  csr_descr,
+                                                                  csr_row_ptr,
+                                                                  csr_col_ind,
+                                                                  block_dim,
+                                                                  bsr_descr,
+                                                                  bsr_row_ptr));
+    }
+    else if(block_dim <= 8)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz_launch<8>(handle,
+                                                                  m,
+                                                                  mb,
+                                                                  nb,
+                                                                  csr_descr,
+                                                                  csr_row_ptr,
+                                                                  csr_col_ind,
+                                                                  block_dim,
+                                                                  bsr_descr,
+                                                                  bsr_row_ptr));
+    }
+    else if(block_dim <= 16)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz_launch<16>(handle,
+                                                                   m,
+                                                                   mb,
+                                                                   nb,
+                                                                   csr_descr,
+                                                                   csr_row_ptr,
+                                                                   csr_col_ind,
+                                                                   block_dim,
+                                                                   bsr_descr,
+                                                                   bsr_row_ptr));
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz_launch<32>(handle,
+                                                                   m,
+                                                                   mb,
+                                                                   nb,
+                                                                   csr_descr,
+                                                                   csr_row_ptr,
+                                                                   csr_col_ind,
+                                                                   block_dim,
+                                                                   bsr_descr,
+                                                                   bsr_row_ptr));
+    }
+
+    // Inclusive sum to obtain bsr_row_ptr array and number of non-zero blocks
+    size_t temp_storage_bytes = 0;
+
+    // Obtain hipcub buffer size
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
+        nullptr, temp_storage_bytes, bsr_row_ptr, bsr_row_ptr, mb + 1, stream));
+
+    // Get hipcub buffer
+    bool d_temp_alloc;
+    void* d_temp_storage;
+
+    // Device buffer should be sufficient for hipcub in most cases
+    if(handle->buffer_size >= temp_storage_bytes)
+    {
+        d_temp_storage = handle->buffer;
+        d_temp_alloc   = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
+        d_temp_alloc = true;
+    }
+
+    // Perform actual inclusive sum
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
+        d_temp_storage, temp_storage_bytes, bsr_row_ptr, bsr_row_ptr, mb + 1, stream));
+
+    // Extract and adjust nnz
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            bsr_nnz, bsr_row_ptr + mb, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+
+        // Adjust nnz according to index base
+        if(bsr_descr->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csr2bsr_index_base), dim3(1), dim3(1), 0, stream, bsr_nnz);
+        }
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(bsr_nnz, bsr_row_ptr + mb, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Adjust nnz according to index base
+        *bsr_nnz -= bsr_descr->base;
+    }
+
+    // Free hipcub buffer, if allocated
+    if(d_temp_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(handle->deallocate(d_temp_storage));
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsr2bsr(rocsparse_handle handle,
+                                               rocsparse_direction dir,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr csr_descr,
+                                               const float* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_int block_dim,
+                                               const rocsparse_mat_descr bsr_descr,
+                                               float* bsr_val,
+                                               const rocsparse_int* bsr_row_ptr,
+                                               rocsparse_int* bsr_col_ind)
+{
+    return rocsparse_csr2bsr_template<float>(handle,
+                                             dir,
+                                             m,
+                                             n,
+                                             csr_descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             block_dim,
+                                             bsr_descr,
+                                             bsr_val,
+                                             bsr_row_ptr,
+                                             bsr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2bsr(rocsparse_handle handle,
+                                               rocsparse_direction dir,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr csr_descr,
+                                               const double* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_int block_dim,
+                                               const rocsparse_mat_descr bsr_descr,
+                                               double* bsr_val,
+                                               const rocsparse_int* bsr_row_ptr,
+                                               rocsparse_int* bsr_col_ind)
+{
+    return rocsparse_csr2bsr_template<double>(handle,
+                                              dir,
+                                              m,
+                                              n,
+                                              csr_descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              block_dim,
+                                              bsr_descr,
+                                              bsr_val,
+                                              bsr_row_ptr,
+                                              bsr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_ccsr2bsr(rocsparse_handle handle,
+                                               rocsparse_direction dir,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr csr_descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_int block_dim,
+                                               const rocsparse_mat_descr bsr_descr,
+                                               rocsparse_float_complex* bsr_val,
+                                               const rocsparse_int* bsr_row_ptr,
+                                               rocsparse_int* bsr_col_ind)
+{
+    return rocsparse_csr2bsr_template<rocsparse_float_complex>(handle,
+                                                               dir,
+                                                               m,
+                                                               n,
+                                                               csr_descr,
+                                                               csr_val,
+                                                               csr_row_ptr,
+                                                               csr_col_ind,
+                                                               block_dim,
+                                                               bsr_descr,
+                                                               bsr_val,
+                                                               bsr_row_ptr,
+                                                               bsr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_zcsr2bsr(rocsparse_handle handle,
+                                               rocsparse_direction dir,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr csr_descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_int block_dim,
+                                               const rocsparse_mat_descr bsr_descr,
+                                               rocsparse_double_complex* bsr_val,
+                                               const rocsparse_int* bsr_row_ptr,
+                                               rocsparse_int* bsr_col_ind)
+{
+    return rocsparse_csr2bsr_template<rocsparse_double_complex>(handle,
+                                                                dir,
+                                                                m,
+                                                                n,
+                                                                csr_descr,
+                                                                csr_val,
+                                                                csr_row_ptr,
+                                                                csr_col_ind,
+                                                                block_dim,
+                                                                bsr_descr,
+                                                                bsr_val,
+                                                                bsr_row_ptr,
+                                                                bsr_col_ind);
+}
@@ -0,0 +1,393 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "grid.h"
+#include "csr2csr5_device.h"
+
+#include <hip/hip_runtime.h>
+#include <hipcub/hipcub.hpp>
+
+#define CSR2CSR5_DIM 256
+
+template <rocsparse_int OMEGA, rocsparse_int SIGMA>
+static rocsparse_status rocsparse_csr2csr5_tile_desc_launch(rocsparse_handle handle,
+                                                            const rocsparse_mat_descr descr,
+                                                            const rocsparse_int* csr_row_ptr,
+                                                            rocsparse_csr5_mat csr5)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    hipLaunchKernelGGL((csr2csr5_tile_desc<OMEGA, SIGMA>),
+                       dim3(csr5->ntiles),
+                       dim3(OMEGA),
+                       0,
+                       stream,
+                       csr5->m,
+                       csr5->nnz,
+                       csr_row_ptr,
+                       csr5->tile_desc_flag,
+                       csr5->tile_desc_offset,
+                       csr5->tile_desc_rows_ptr,
+                       descr->base);
+
+    return rocsparse_status_success;
+}
+
+template <rocsparse_int OMEGA>
+static rocsparse_status rocsparse_csr2csr5_tile_desc_dispatch(rocsparse_handle handle,
+                                                              const rocsparse_mat_descr descr,
+                                                              const rocsparse_int* csr_row_ptr,
+                                                              rocsparse_csr5_mat csr5)
+{
+    if(csr5->sigma == 4)
+    {
+        return rocsparse_csr2csr5_tile_desc_launch<OMEGA, 4>(handle, descr, csr_row_ptr, csr5);
+    }
+    else if(csr5->sigma == 8)
+    {
+        return rocsparse_csr2csr5_tile_desc_launch<OMEGA, 8>(handle, descr, csr_row_ptr, csr5);
+    }
+    else
+    {
+        return rocsparse_csr2csr5_tile_desc_launch<OMEGA, 16>(handle, descr, csr_row_ptr, csr5);
+    }
+}
+
+extern "C" rocsparse_status rocsparse_csr2csr5(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_int* csr_row_ptr,
+                                               rocsparse_csr5_mat csr5)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr5 == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2csr5",
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr5);
+
+    log_bench(handle, "./rocsparse-bench -f csr2csr5 ", "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The tile descriptor depends on the matrix, it cannot be sized without
+    // synchronization
+    if(handle->exec_mode == rocsparse_exec_mode_async)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Tiles are as wide as a wavefront
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    // Clear CSR5 structure if already allocated, device arrays are returned to the
+    // memory pool that allocated them
+    if(csr5->pool != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(csr5->pool->deallocate(csr5->tile_ptr, csr5->stream));
+        RETURN_IF_HIP_ERROR(csr5->pool->deallocate(csr5->tile_desc_flag, csr5->stream));
+        RETURN_IF_HIP_ERROR(csr5->pool->deallocate(csr5->tile_desc_offset, csr5->stream));
+        RETURN_IF_HIP_ERROR(csr5->pool->deallocate(csr5->tile_desc_rows_ptr, csr5->stream));
+        RETURN_IF_HIP_ERROR(csr5->pool->deallocate(csr5->tile_desc_rows, csr5->stream));
+        RETURN_IF_HIP_ERROR(csr5->pool->deallocate(csr5->empty_rows, csr5->stream));
+    }
+
+    csr5->m                  = m;
+    csr5->n                  = n;
+    csr5->nnz                = nnz;
+    csr5->omega              = handle->wavefront_size;
+    csr5->sigma              = 0;
+    csr5->ntiles             = 0;
+    csr5->tile_ptr           = nullptr;
+    csr5->tile_desc_flag     = nullptr;
+    csr5->tile_desc_offset   = nullptr;
+    csr5->tile_desc_rows_ptr = nullptr;
+    csr5->tile_desc_rows     = nullptr;
+    csr5->nempty             = 0;
+    csr5->empty_rows         = nullptr;
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Device arrays are served from the memory pool, which is kept alive by the CSR5
+    // matrix until the arrays are returned
+    csr5->pool   = handle->pool;
+    csr5->stream = stream;
+
+    // Entries per thread, short rows favor small tiles such that fewer rows span
+    // several tiles
+    rocsparse_int nnz_per_row = nnz / m;
+
+    if(nnz_per_row <= 4)
+    {
+        csr5->sigma = 4;
+    }
+    else if(nnz_per_row <= 8)
+    {
+        csr5->sigma = 8;
+    }
+    else
+    {
+        csr5->sigma = 16;
+    }
+
+    rocsparse_int tile_size = csr5->omega * csr5->sigma;
+
+    csr5->ntiles = (nnz - 1) / tile_size + 1;
+
+    // Allocate tile descriptor
+    size_t ndesc = static_cast<size_t>(csr5->omega) * csr5->ntiles;
+
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&csr5->tile_ptr, sizeof(rocsparse_int) * csr5->ntiles));
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&csr5->tile_desc_flag, sizeof(uint32_t) * ndesc));
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&csr5->tile_desc_offset, sizeof(uint32_t) * ndesc));
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&csr5->tile_desc_rows_ptr,
+                                         sizeof(rocsparse_int) * (csr5->ntiles + 1)));
+
+    // Row of the first entry of each tile
+    dim3 tile_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(csr5->ntiles, CSR2CSR5_DIM, tile_blocks));
+    dim3 tile_threads(CSR2CSR5_DIM);
+
+    hipLaunchKernelGGL((csr2csr5_tile_ptr<CSR2CSR5_DIM>),
+                       tile_blocks,
+                       tile_threads,
+                       0,
+                       stream,
+                       m,
+                       csr5->ntiles,
+                       tile_size,
+                       csr_row_ptr,
+                       csr5->tile_ptr,
+                       descr->base);
+
+    // Bit flags, y and segment offsets
+    if(csr5->omega == 32)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csr2csr5_tile_desc_dispatch<32>(handle, descr, csr_row_ptr, csr5));
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csr2csr5_tile_desc_dispatch<64>(handle, descr, csr_row_ptr, csr5));
+    }
+
+    // Determine empty rows
+    rocsparse_int* pos = nullptr;
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&pos, sizeof(rocsparse_int) * (m + 1)));
+
+    dim3 row_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(m + 1, CSR2CSR5_DIM, row_blocks));
+    dim3 row_threads(CSR2CSR5_DIM);
+
+    hipLaunchKernelGGL((csr2csr5_empty_rows_mark<CSR2CSR5_DIM>),
+                       row_blocks,
+                       row_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       pos);
+
+    void* d_temp_storage      = nullptr;
+    size_t temp_storage_bytes = 0;
+
+    // Obtain hipcub buffer size
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::ExclusiveSum(
+        d_temp_storage, temp_storage_bytes, pos, pos, m + 1, stream));
+
+    // Allocate hipcub buffer
+    RETURN_IF_HIP_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
+
+    // Do exclusive sum
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::ExclusiveSum(
+        d_temp_storage, temp_storage_bytes, pos, pos, m + 1, stream));
+
+    // Clear hipcub buffer
+    RETURN_IF_HIP_ERROR(handle->deallocate(d_temp_storage));
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&csr5->nempty, pos + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    if(csr5->nempty == 0)
+    {
+        // Segment rows follow from the tile pointer
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(
+            csr5->tile_desc_rows_ptr, 0, sizeof(rocsparse_int) * (csr5->ntiles + 1), stream));
+        RETURN_IF_HIP_ERROR(handle->deallocate(pos));
+
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&csr5->empty_rows, sizeof(rocsparse_int) * csr5->nempty));
+
+    hipLaunchKernelGGL((csr2csr5_empty_rows_fill<CSR2CSR5_DIM>),
+                       row_blocks,
+                       row_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       pos,
+                       csr5->empty_rows);
+
+    // Tiles that span empty rows store the row of each segment explicitly
+    hipLaunchKernelGGL((csr2csr5_tile_rows_count<CSR2CSR5_DIM>),
+                       tile_blocks,
+                       tile_threads,
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       csr5->ntiles,
+                       tile_size,
+                       csr_row_ptr,
+                       csr5->tile_ptr,
+                       pos,
+                       csr5->tile_desc_rows_ptr,
+                       descr->base);
+
+    RETURN_IF_HIP_ERROR(handle->deallocate(pos));
+
+    d_temp_storage     = nullptr;
+    temp_storage_bytes = 0;
+
+    // Obtain hipcub buffer size
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(d_temp_storage,
+                                                         temp_storage_bytes,
+                                                         csr5->tile_desc_rows_ptr,
+                                                         csr5->tile_desc_rows_ptr,
+                                                         csr5->ntiles + 1,
+                                                         stream));
+
+    // Allocate hipcub buffer
+    RETURN_IF_HIP_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
+
+    // Do inclusive sum
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(d_temp_storage,
+                                                         temp_storage_bytes,
+                                                         csr5->tile_desc_rows_ptr,
+                                                         csr5->tile_desc_rows_ptr,
+                                                         csr5->ntiles + 1,
+                                                         stream));
+
+    // Clear hipcub buffer
+    RETURN_IF_HIP_ERROR(handle->deallocate(d_temp_storage));
+
+    rocsparse_int nrows;
+    RETURN_IF_HIP_ERROR(hipMemcpy(&nrows,
+                                  csr5->tile_desc_rows_ptr + csr5->ntiles,
+                                  sizeof(rocsparse_int),
+                                  hipMemcpyDeviceToHost));
+
+    if(nrows > 0)
+    {
+        RETURN_IF_HIP_ERROR(
+            handle->allocate((void**)&csr5->tile_desc_rows, sizeof(rocsparse_int) * nrows));
+
+        hipLaunchKernelGGL((csr2csr5_tile_rows_fill<CSR2CSR5_DIM>),
+                           tile_blocks,
+                           tile_threads,
+                           0,
+                           stream,
+                           csr5->ntiles,
+                           tile_size,
+                           csr_row_ptr,
+                           csr5->tile_ptr,
+                           csr5->tile_desc_rows_ptr,
+                           csr5->tile_desc_rows,
+                           descr->base);
+    }
+
+    return rocsparse_status_success;
+}
+
+#undef CSR2CSR5_DIM
@@ -0,0 +1,330 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+#include "rocsparse_csr2dia.hpp"
+
+#include <hip/hip_runtime.h>
+#include <hipcub/hipcub.hpp>
+
+// Largest ratio of padded DIA entries to CSR non-zero entries. Beyond this
+// ratio, the DIA matrix moves more bytes than the CSR matrix with its column
+// indices.
+#define CSR2DIA_MAX_FILL 2
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csr2dia_ndiag(rocsparse_handle handle,
+                                                    rocsparse_int m,
+                                                    rocsparse_int n,
+                                                    const rocsparse_mat_descr csr_descr,
+                                                    const rocsparse_int* csr_row_ptr,
+                                                    const rocsparse_int* csr_col_ind,
+                                                    const rocsparse_mat_descr dia_descr,
+                                                    rocsparse_int* ndiag)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dia_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2dia_ndiag",
+              m,
+              n,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)dia_descr,
+              (const void*&)ndiag);
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(dia_descr->base != rocsparse_index_base_zero && dia_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(dia_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ndiag == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Result on the host requires synchronization
+    if(handle->exec_mode == rocsparse_exec_mode_async
+       && handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(ndiag, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *ndiag = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+#define CSR2DIA_DIM 256
+    // Number of diagonals of the m x n matrix
+    size_t ndiag_max = static_cast<size_t>(m) + n - 1;
+
+    // Diagonal flags, followed by the number of flagged diagonals
+    rocsparse_int* diag_flag = nullptr;
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&diag_flag, sizeof(rocsparse_int) * (ndiag_max + 1)));
+
+    rocsparse_int* diag_count = diag_flag + ndiag_max;
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(diag_flag, 0, sizeof(rocsparse_int) * ndiag_max, stream));
+
+    dim3 csr2dia_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(m, CSR2DIA_DIM, csr2dia_blocks));
+    dim3 csr2dia_threads(CSR2DIA_DIM);
+
+    hipLaunchKernelGGL((csr2dia_flag_diag<CSR2DIA_DIM>),
+                       csr2dia_blocks,
+                       csr2dia_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       diag_flag,
+                       csr_descr->base);
+#undef CSR2DIA_DIM
+
+    void* d_temp_storage      = nullptr;
+    size_t temp_storage_bytes = 0;
+
+    // Obtain hipcub buffer size
+    RETURN_IF_HIP_ERROR(hipcub::DeviceReduce::Sum(
+        d_temp_storage, temp_storage_bytes, diag_flag, diag_count, ndiag_max, stream));
+
+    // Allocate hipcub buffer
+    RETURN_IF_HIP_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
+
+    // Count flagged diagonals
+    RETURN_IF_HIP_ERROR(hipcub::DeviceReduce::Sum(
+        d_temp_storage, temp_storage_bytes, diag_flag, diag_count, ndiag_max, stream));
+
+    // Clear hipcub buffer
+    RETURN_IF_HIP_ERROR(handle->deallocate(d_temp_storage));
+
+    // Copy number of diagonals back to host, if handle says so
+    rocsparse_int h_ndiag;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            ndiag, diag_count, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+
+        // The fill ratio cannot be checked without synchronization
+        if(handle->exec_mode == rocsparse_exec_mode_async)
+        {
+            RETURN_IF_HIP_ERROR(handle->deallocate(diag_flag));
+            return rocsparse_status_success;
+        }
+
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&h_ndiag, diag_count, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(ndiag, diag_count, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        h_ndiag = *ndiag;
+    }
+
+    RETURN_IF_HIP_ERROR(handle->deallocate(diag_flag));
+
+    // Number of CSR non-zero entries
+    rocsparse_int start;
+    rocsparse_int end;
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&start, csr_row_ptr, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&end, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    // Reject matrices where DIA padding exceeds the savings in column indices
+    if(static_cast<int64_t>(h_ndiag) * m > static_cast<int64_t>(end - start) * CSR2DIA_MAX_FILL)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsr2dia(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr csr_descr,
+                                               const float* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               const rocsparse_mat_descr dia_descr,
+                                               rocsparse_int ndiag,
+                                               float* dia_val,
+                                               rocsparse_int* dia_offset)
+{
+    return rocsparse_csr2dia_template<float>(handle,
+                                             m,
+                                             n,
+                                             csr_descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             dia_descr,
+                                             ndiag,
+                                             dia_val,
+                                             dia_offset);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2dia(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr csr_descr,
+                                               const double* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               const rocsparse_mat_descr dia_descr,
+                                               rocsparse_int ndiag,
+                                               double* dia_val,
+                                               rocsparse_int* dia_offset)
+{
+    return rocsparse_csr2dia_template<double>(handle,
+                                              m,
+                                              n,
+                                              csr_descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              dia_descr,
+                                              ndiag,
+                                              dia_val,
+                                              dia_offset);
+}
+
+extern "C" rocsparse_status rocsparse_ccsr2dia(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr csr_descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               const rocsparse_mat_descr dia_descr,
+                                               rocsparse_int ndiag,
+                                               rocsparse_float_complex* dia_val,
+                                               rocsparse_int* dia_offset)
+{
+    return rocsparse_csr2dia_template<rocsparse_float_complex>(handle,
+                                                               m,
+                                                               n,
+                                                               csr_descr,
+                                                               csr_val,
+                                                               csr_row_ptr,
+                                                               csr_col_ind,
+                                                               dia_descr,
+                                                               ndiag,
+                                                               dia_val,
+                                                               dia_offset);
+}
+
+extern "C" rocsparse_status rocsparse_zcsr2dia(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr csr_descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               const rocsparse_mat_descr dia_descr,
+                                               rocsparse_int ndiag,
+                                               rocsparse_double_complex* dia_val,
+                                               rocsparse_int* dia_offset)
+{
+    return rocsparse_csr2dia_template<rocsparse_double_complex>(handle,
+                                                                m,
+                                                                n,
+                                                                csr_descr,
+                                                                csr_val,
+                                                                csr_row_ptr,
+                                                                csr_col_ind,
+                                                                dia_descr,
+                                                                ndiag,
+                                                                dia_val,
+                                                                dia_offset);
+}
@@ -0,0 +1,226 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR2DIA_HPP
+#define ROCSPARSE_CSR2DIA_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "grid.h"
+#include "csr2dia_device.h"
+
+#include <hip/hip_runtime.h>
+#include <hipcub/hipcub.hpp>
+
+#define CSR2DIA_DIM 256
+
+template <typename T>
+rocsparse_status rocsparse_csr2dia_template(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int n,
+                                            const rocsparse_mat_descr csr_descr,
+                                            const T* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            const rocsparse_mat_descr dia_descr,
+                                            rocsparse_int ndiag,
+                                            T* dia_val,
+                                            rocsparse_int* dia_offset)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dia_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2dia"),
+              m,
+              n,
+              (const void*&)csr_descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)dia_descr,
+              ndiag,
+              (const void*&)dia_val,
+              (const void*&)dia_offset);
+
+    log_bench(handle, "./rocsparse-bench -f csr2dia -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(dia_descr->base != rocsparse_index_base_zero && dia_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(dia_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || ndiag < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dia_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dia_offset == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || ndiag == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Number of diagonals of the m x n matrix
+    size_t ndiag_max = static_cast<size_t>(m) + n - 1;
+
+    // Diagonal flags and their positions within the DIA matrix
+    rocsparse_int* diag_flag = nullptr;
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&diag_flag, sizeof(rocsparse_int) * ndiag_max * 2));
+
+    rocsparse_int* diag_pos = diag_flag + ndiag_max;
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(diag_flag, 0, sizeof(rocsparse_int) * ndiag_max, stream));
+
+    dim3 row_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(m, CSR2DIA_DIM, row_blocks));
+    dim3 csr2dia_threads(CSR2DIA_DIM);
+
+    hipLaunchKernelGGL((csr2dia_flag_diag<CSR2DIA_DIM>),
+                       row_blocks,
+                       csr2dia_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       diag_flag,
+                       csr_descr->base);
+
+    void* d_temp_storage      = nullptr;
+    size_t temp_storage_bytes = 0;
+
+    // Obtain hipcub buffer size
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::ExclusiveSum(
+        d_temp_storage, temp_storage_bytes, diag_flag, diag_pos, ndiag_max, stream));
+
+    // Allocate hipcub buffer
+    RETURN_IF_HIP_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
+
+    // Do exclusive sum
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::ExclusiveSum(
+        d_temp_storage, temp_storage_bytes, diag_flag, diag_pos, ndiag_max, stream));
+
+    // Clear hipcub buffer
+    RETURN_IF_HIP_ERROR(handle->deallocate(d_temp_storage));
+
+    // Padded entries are zero
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(dia_val, 0, sizeof(T) * static_cast<size_t>(ndiag) * m, stream));
+
+    dim3 diag_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(ndiag_max, CSR2DIA_DIM, diag_blocks));
+
+    hipLaunchKernelGGL((csr2dia_offset<CSR2DIA_DIM>),
+                       diag_blocks,
+                       csr2dia_threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       ndiag,
+                       diag_flag,
+                       diag_pos,
+                       dia_offset);
+
+    hipLaunchKernelGGL((csr2dia_fill<T, CSR2DIA_DIM>),
+                       row_blocks,
+                       csr2dia_threads,
+                       0,
+                       stream,
+                       m,
+                       ndiag,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       diag_pos,
+                       dia_val,
+                       csr_descr->base);
+
+    RETURN_IF_HIP_ERROR(handle->deallocate(diag_flag));
+
+    return rocsparse_status_success;
+}
+
+#undef CSR2DIA_DIM
+
+#endif // ROCSPARSE_CSR2DIA_HPP
@@ -75,3 +75,51 @@ extern "C" rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle handle,
                                       user_ell_width,
                                       partition_type);
 }
+
+extern "C" rocsparse_status rocsparse_ccsr2hyb(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_hyb_mat hyb,
+                                               rocsparse_int user_ell_width,
+                                               rocsparse_hyb_partition partition_type)
+{
+
+    return rocsparse_csr2hyb_template(handle,
+                                      m,
+                                      n,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      hyb,
+                                      user_ell_width,
+                                      partition_type);
+}
+
+extern "C" rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_hyb_mat hyb,
+                                               rocsparse_int user_ell_width,
+                                               rocsparse_hyb_partition partition_type)
+{
+
+    return rocsparse_csr2hyb_template(handle,
+                                      m,
+                                      n,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      hyb,
+                                      user_ell_width,
+                                      partition_type);
+}
@@ -34,6 +34,7 @@
 
 #include <hip/hip_runtime.h>
 #include <hipcub/hipcub.hpp>
+#include <vector>
 
 template <typename T>
 rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
@@ -119,6 +120,23 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // In async mode, the HYB matrix is sized by the user given bound
+    bool async = handle->exec_mode == rocsparse_exec_mode_async;
+
+    if(async)
+    {
+        // ELL width of max partition cannot be bounded
+        if(partition_type == rocsparse_hyb_partition_max)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        if(hyb->nnz_bound < 0)
+        {
+            return rocsparse_status_invalid_value;
+        }
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0)
     {
@@ -127,11 +145,19 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
 
     // Get number of CSR non-zeros
     rocsparse_int csr_nnz;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&csr_nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
 
-    // Correct by index base
-    csr_nnz -= descr->base;
+    if(async)
+    {
+        csr_nnz = hyb->nnz_bound;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&csr_nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Correct by index base
+        csr_nnz -= descr->base;
+    }
 
     // Maximum ELL row width allowed
     rocsparse_int max_row_nnz = (2 * csr_nnz - 1) / m + 1;
@@ -162,27 +188,29 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
     hyb->ell_width = 0;
     hyb->coo_nnz   = 0;
 
-    if(hyb->ell_col_ind)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->ell_col_ind));
-    }
-    if(hyb->ell_val)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->ell_val));
-    }
-    if(hyb->coo_row_ind)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->coo_row_ind));
-    }
-    if(hyb->coo_col_ind)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->coo_col_ind));
-    }
-    if(hyb->coo_val)
+    hyb->predicted_bytes = 0;
+
+    // Return the arrays of a previous conversion to the memory pool that allocated them
+    if(hyb->pool != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->coo_val));
+        RETURN_IF_HIP_ERROR(hyb->pool->deallocate(hyb->ell_col_ind, hyb->stream));
+        RETURN_IF_HIP_ERROR(hyb->pool->deallocate(hyb->ell_val, hyb->stream));
+        RETURN_IF_HIP_ERROR(hyb->pool->deallocate(hyb->coo_row_ind, hyb->stream));
+        RETURN_IF_HIP_ERROR(hyb->pool->deallocate(hyb->coo_col_ind, hyb->stream));
+        RETURN_IF_HIP_ERROR(hyb->pool->deallocate(hyb->coo_val, hyb->stream));
     }
 
+    hyb->ell_col_ind = nullptr;
+    hyb->ell_val     = nullptr;
+    hyb->coo_row_ind = nullptr;
+    hyb->coo_col_ind = nullptr;
+    hyb->coo_val     = nullptr;
+
+    // ELL and COO arrays are served from the memory pool, which is kept alive by the
+    // HYB matrix until the arrays are returned
+    hyb->pool   = handle->pool;
+    hyb->stream = stream;
+
 // Determine ELL width
 
 #define CSR2ELL_DIM 512
@@ -194,16 +222,73 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
         // ELL width given by user
         hyb->ell_width = user_ell_width;
     }
-    else if(partition_type == rocsparse_hyb_partition_auto)
+    else if(partition_type == rocsparse_hyb_partition_auto && async)
     {
-        // ELL width determined by average nnz per row
+        // Row lengths cannot be inspected without synchronization, ELL width is
+        // determined by average nnz per row of the bound
         hyb->ell_width = (csr_nnz - 1) / m + 1;
     }
+    else if(partition_type == rocsparse_hyb_partition_auto)
+    {
+        // Histogram of the row lengths, rows exceeding the maximum ELL width are
+        // gathered in the last bin
+        size_t hist_size = sizeof(rocsparse_int) * (max_row_nnz + 2);
+
+        rocsparse_int* hist = nullptr;
+        RETURN_IF_HIP_ERROR(handle->allocate((void**)&hist, hist_size));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(hist, 0, hist_size, stream));
+
+        hipLaunchKernelGGL((hyb_row_nnz_histogram<CSR2ELL_DIM>),
+                           dim3(blocks),
+                           dim3(CSR2ELL_DIM),
+                           0,
+                           stream,
+                           m,
+                           max_row_nnz,
+                           csr_row_ptr,
+                           hist);
+
+        std::vector<rocsparse_int> hhist(max_row_nnz + 2);
+        RETURN_IF_HIP_ERROR(hipMemcpy(hhist.data(), hist, hist_size, hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(handle->deallocate(hist));
+
+        // Bytes moved by hybmv for a given ELL width. ELL loads value and column index
+        // of all m * ell_width entries, padding included. COO loads value, row and
+        // column index of the remaining entries, and each row holding COO entries
+        // updates y atomically. Loading x and writing y is independent of the width.
+        size_t ell_entry_bytes = sizeof(T) + sizeof(rocsparse_int);
+        size_t coo_entry_bytes = sizeof(T) + 2 * sizeof(rocsparse_int);
+        size_t coo_row_bytes   = 2 * sizeof(T);
+        size_t xy_bytes        = sizeof(T) * (static_cast<size_t>(csr_nnz) + m);
+
+        // Pure COO
+        rocsparse_int coo_nnz  = csr_nnz;
+        rocsparse_int coo_rows = m - hhist[0];
+
+        hyb->predicted_bytes = xy_bytes + coo_entry_bytes * coo_nnz + coo_row_bytes * coo_rows;
+
+        for(rocsparse_int width = 1; width <= max_row_nnz; ++width)
+        {
+            // Rows longer than width - 1 lose one entry to the ELL part
+            coo_nnz -= coo_rows;
+            coo_rows -= hhist[width];
+
+            size_t bytes = xy_bytes + ell_entry_bytes * m * width + coo_entry_bytes * coo_nnz +
+                           coo_row_bytes * coo_rows;
+
+            // Smallest width wins on ties
+            if(bytes < hyb->predicted_bytes)
+            {
+                hyb->ell_width       = width;
+                hyb->predicted_bytes = bytes;
+            }
+        }
+    }
     else
     {
         // Allocate workspace
         rocsparse_int* workspace = nullptr;
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace, sizeof(rocsparse_int) * blocks));
+        RETURN_IF_HIP_ERROR(handle->allocate((void**)&workspace, sizeof(rocsparse_int) * blocks));
 
         // HYB == ELL - no COO part - compute maximum nnz per row
         hipLaunchKernelGGL((ell_width_kernel_part1<CSR2ELL_DIM>),
@@ -226,7 +311,7 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
         RETURN_IF_HIP_ERROR(
             hipMemcpy(&hyb->ell_width, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
 
-        RETURN_IF_HIP_ERROR(hipFree(workspace));
+        RETURN_IF_HIP_ERROR(handle->deallocate(workspace));
     }
 
     // Re-check ELL width
@@ -242,13 +327,13 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
     if(hyb->ell_nnz > 0)
     {
         RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&hyb->ell_col_ind, sizeof(rocsparse_int) * hyb->ell_nnz));
-        RETURN_IF_HIP_ERROR(hipMalloc(&hyb->ell_val, sizeof(T) * hyb->ell_nnz));
+            handle->allocate((void**)&hyb->ell_col_ind, sizeof(rocsparse_int) * hyb->ell_nnz));
+        RETURN_IF_HIP_ERROR(handle->allocate(&hyb->ell_val, sizeof(T) * hyb->ell_nnz));
     }
 
     // Allocate workspace
     rocsparse_int* workspace = NULL;
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace, sizeof(rocsparse_int) * (m + 1)));
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&workspace, sizeof(rocsparse_int) * (m + 1)));
 
     // If there is a COO part, compute the COO non-zero elements per row
     if(partition_type != rocsparse_hyb_partition_max)
@@ -257,8 +342,11 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
         if(hyb->ell_nnz == 0)
         {
             hyb->coo_nnz = csr_nnz;
-            RETURN_IF_HIP_ERROR(hipMemcpy(
-                workspace, csr_row_ptr, sizeof(rocsparse_int) * (m + 1), hipMemcpyDeviceToDevice));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(workspace,
+                                               csr_row_ptr,
+                                               sizeof(rocsparse_int) * (m + 1),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
         }
         else
         {
@@ -279,23 +367,30 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
 
             // Obtain hipcub buffer size
             RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
-                d_temp_storage, temp_storage_bytes, workspace, workspace, m + 1));
+                d_temp_storage, temp_storage_bytes, workspace, workspace, m + 1, stream));
 
             // Allocate hipcub buffer
-            RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
+            RETURN_IF_HIP_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
 
             // Do inclusive sum
             RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
-                d_temp_storage, temp_storage_bytes, workspace, workspace, m + 1));
+                d_temp_storage, temp_storage_bytes, workspace, workspace, m + 1, stream));
 
             // Clear hipcub buffer
-            RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
-
-            // Obtain coo nnz from workspace
-            RETURN_IF_HIP_ERROR(hipMemcpy(
-                &hyb->coo_nnz, workspace + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-
-            hyb->coo_nnz -= descr->base;
+            RETURN_IF_HIP_ERROR(handle->deallocate(d_temp_storage));
+
+            // Obtain coo nnz from workspace, async mode keeps the bound
+            if(async)
+            {
+                hyb->coo_nnz = csr_nnz;
+            }
+            else
+            {
+                RETURN_IF_HIP_ERROR(hipMemcpy(
+                    &hyb->coo_nnz, workspace + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+                hyb->coo_nnz -= descr->base;
+            }
         }
     }
 
@@ -303,10 +398,10 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
     if(hyb->coo_nnz > 0)
     {
         RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&hyb->coo_row_ind, sizeof(rocsparse_int) * hyb->coo_nnz));
+            handle->allocate((void**)&hyb->coo_row_ind, sizeof(rocsparse_int) * hyb->coo_nnz));
         RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&hyb->coo_col_ind, sizeof(rocsparse_int) * hyb->coo_nnz));
-        RETURN_IF_HIP_ERROR(hipMalloc(&hyb->coo_val, sizeof(T) * hyb->coo_nnz));
+            handle->allocate((void**)&hyb->coo_col_ind, sizeof(rocsparse_int) * hyb->coo_nnz));
+        RETURN_IF_HIP_ERROR(handle->allocate(&hyb->coo_val, sizeof(T) * hyb->coo_nnz));
     }
 
     dim3 csr2ell_blocks((m - 1) / CSR2ELL_DIM + 1);
@@ -324,13 +419,30 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
                        hyb->ell_width,
                        hyb->ell_col_ind,
                        (T*)hyb->ell_val,
+                       hyb->coo_nnz,
                        hyb->coo_row_ind,
                        hyb->coo_col_ind,
                        (T*)hyb->coo_val,
                        workspace,
                        descr->base);
 
-    RETURN_IF_HIP_ERROR(hipFree(workspace));
+    // Pad the COO part up to its bound
+    if(async && hyb->coo_nnz > 0)
+    {
+        hipLaunchKernelGGL((hyb_coo_pad<T>),
+                           dim3((hyb->coo_nnz - 1) / CSR2ELL_DIM + 1),
+                           dim3(CSR2ELL_DIM),
+                           0,
+                           stream,
+                           hyb->coo_nnz,
+                           workspace + m,
+                           hyb->coo_row_ind,
+                           hyb->coo_col_ind,
+                           (T*)hyb->coo_val,
+                           descr->base);
+    }
+
+    RETURN_IF_HIP_ERROR(handle->deallocate(workspace));
 #undef CSR2ELL_DIM
 
     return rocsparse_status_success;
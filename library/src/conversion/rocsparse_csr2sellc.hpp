@@ -0,0 +1,396 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR2SELLC_HPP
+#define ROCSPARSE_CSR2SELLC_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "grid.h"
+#include "csr2ell_device.h"
+#include "csr2sellc_device.h"
+
+#include <hip/hip_runtime.h>
+#include <hipcub/hipcub.hpp>
+
+#define CSR2SELLC_DIM 256
+
+template <typename T, rocsparse_int SLICE_SIZE>
+rocsparse_status rocsparse_csr2sellc_launch(rocsparse_handle handle,
+                                            const rocsparse_mat_descr descr,
+                                            const T* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_sellc_mat sellc)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int m       = sellc->m;
+    rocsparse_int nslices = sellc->nslices;
+
+    // Padded size of each slice
+    dim3 slice_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(nslices, CSR2SELLC_DIM, slice_blocks));
+    dim3 slice_threads(CSR2SELLC_DIM);
+
+    hipLaunchKernelGGL((csr2sellc_slice_size<CSR2SELLC_DIM, SLICE_SIZE>),
+                       slice_blocks,
+                       slice_threads,
+                       0,
+                       stream,
+                       m,
+                       nslices,
+                       csr_row_ptr,
+                       sellc->perm,
+                       sellc->slice_ptr);
+
+    // Inclusive sum to obtain the slice offsets
+    void* d_temp_storage      = nullptr;
+    size_t temp_storage_bytes = 0;
+
+    // Obtain hipcub buffer size
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(d_temp_storage,
+                                                         temp_storage_bytes,
+                                                         sellc->slice_ptr,
+                                                         sellc->slice_ptr,
+                                                         nslices + 1,
+                                                         stream));
+
+    // Allocate hipcub buffer
+    RETURN_IF_HIP_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
+
+    // Do inclusive sum
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(d_temp_storage,
+                                                         temp_storage_bytes,
+                                                         sellc->slice_ptr,
+                                                         sellc->slice_ptr,
+                                                         nslices + 1,
+                                                         stream));
+
+    // Clear hipcub buffer
+    RETURN_IF_HIP_ERROR(handle->deallocate(d_temp_storage));
+
+    // Number of stored entries, including padding
+    RETURN_IF_HIP_ERROR(hipMemcpy(&sellc->sell_nnz,
+                                  sellc->slice_ptr + nslices,
+                                  sizeof(rocsparse_int),
+                                  hipMemcpyDeviceToHost));
+
+    // Padding overhead with respect to the CSR matrix
+    sellc->padding = (sellc->nnz > 0)
+                         ? static_cast<double>(sellc->sell_nnz - sellc->nnz) / sellc->nnz
+                         : 0.0;
+
+    // Allocate SELL-C-sigma entries
+    if(sellc->sell_nnz > 0)
+    {
+        RETURN_IF_HIP_ERROR(
+            handle->allocate((void**)&sellc->col_ind, sizeof(rocsparse_int) * sellc->sell_nnz));
+        RETURN_IF_HIP_ERROR(handle->allocate(&sellc->val, sizeof(T) * sellc->sell_nnz));
+
+        dim3 fill_blocks;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(
+            static_cast<int64_t>(SLICE_SIZE) * nslices, CSR2SELLC_DIM, fill_blocks));
+        dim3 fill_threads(CSR2SELLC_DIM);
+
+        hipLaunchKernelGGL((csr2sellc_fill<T, CSR2SELLC_DIM, SLICE_SIZE>),
+                           fill_blocks,
+                           fill_threads,
+                           0,
+                           stream,
+                           m,
+                           nslices,
+                           csr_val,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           sellc->slice_ptr,
+                           sellc->perm,
+                           sellc->col_ind,
+                           (T*)sellc->val,
+                           descr->base);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr2sellc_template(rocsparse_handle handle,
+                                              rocsparse_int m,
+                                              rocsparse_int n,
+                                              const rocsparse_mat_descr descr,
+                                              const T* csr_val,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              rocsparse_sellc_mat sellc,
+                                              rocsparse_int sigma)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sellc == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2sellc"),
+              m,
+              n,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)sellc,
+              sigma);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csr2sellc -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> "
+              "--sigma",
+              sigma);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(sigma <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The slice layout depends on the matrix, it cannot be sized without synchronization
+    if(handle->exec_mode == rocsparse_exec_mode_async)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Slices are as high as a wavefront
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    // Clear SELL-C-sigma structure if already allocated, device arrays are returned to
+    // the memory pool that allocated them
+    if(sellc->pool != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(sellc->pool->deallocate(sellc->slice_ptr, sellc->stream));
+        RETURN_IF_HIP_ERROR(sellc->pool->deallocate(sellc->perm, sellc->stream));
+        RETURN_IF_HIP_ERROR(sellc->pool->deallocate(sellc->col_ind, sellc->stream));
+        RETURN_IF_HIP_ERROR(sellc->pool->deallocate(sellc->val, sellc->stream));
+    }
+
+    sellc->m          = m;
+    sellc->n          = n;
+    sellc->nnz        = 0;
+    sellc->slice_size = handle->wavefront_size;
+    sellc->sigma      = sigma;
+    sellc->nslices    = 0;
+    sellc->sell_nnz   = 0;
+    sellc->padding    = 0.0;
+    sellc->slice_ptr  = nullptr;
+    sellc->perm       = nullptr;
+    sellc->col_ind    = nullptr;
+    sellc->val        = nullptr;
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Device arrays are served from the memory pool, which is kept alive by the
+    // SELL-C-sigma matrix until the arrays are returned
+    sellc->pool   = handle->pool;
+    sellc->stream = stream;
+
+    // Get number of CSR non-zeros
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&sellc->nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    // Correct by index base
+    sellc->nnz -= descr->base;
+
+    sellc->nslices = (m - 1) / sellc->slice_size + 1;
+
+    // Allocate slice offsets and row permutation
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&sellc->slice_ptr,
+                                         sizeof(rocsparse_int) * (sellc->nslices + 1)));
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&sellc->perm, sizeof(rocsparse_int) * m));
+
+// Determine maximum row length, that bounds the sort keys
+#define CSR2ELL_DIM 512
+    rocsparse_int blocks = (m - 1) / CSR2ELL_DIM + 1;
+
+    rocsparse_int* workspace = nullptr;
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&workspace, sizeof(rocsparse_int) * blocks));
+
+    hipLaunchKernelGGL((ell_width_kernel_part1<CSR2ELL_DIM>),
+                       dim3(blocks),
+                       dim3(CSR2ELL_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       workspace);
+
+    hipLaunchKernelGGL((ell_width_kernel_part2<CSR2ELL_DIM>),
+                       dim3(1),
+                       dim3(CSR2ELL_DIM),
+                       0,
+                       stream,
+                       blocks,
+                       workspace);
+#undef CSR2ELL_DIM
+
+    rocsparse_int max_row_nnz;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&max_row_nnz, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    RETURN_IF_HIP_ERROR(handle->deallocate(workspace));
+
+    // Sort keys and their double buffers
+    int64_t* keys           = nullptr;
+    int64_t* keys_alt       = nullptr;
+    rocsparse_int* perm_alt = nullptr;
+
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&keys, sizeof(int64_t) * m));
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&keys_alt, sizeof(int64_t) * m));
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&perm_alt, sizeof(rocsparse_int) * m));
+
+    dim3 sort_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(m, CSR2SELLC_DIM, sort_blocks));
+    dim3 sort_threads(CSR2SELLC_DIM);
+
+    hipLaunchKernelGGL((csr2sellc_sort_keys<CSR2SELLC_DIM>),
+                       sort_blocks,
+                       sort_threads,
+                       0,
+                       stream,
+                       m,
+                       sigma,
+                       max_row_nnz,
+                       csr_row_ptr,
+                       keys,
+                       sellc->perm);
+
+    // Largest possible key, an empty row of the last window
+    int64_t nwindows = (m - 1) / sigma + 1;
+    int64_t max_key  = (nwindows - 1) * (max_row_nnz + 1) + max_row_nnz;
+
+    // Stable sort of the rows by window and descending length, windows of a single
+    // row are already sorted
+    if(sigma > 1 && max_key > 0)
+    {
+        int endbit = 64 - __builtin_clzll(static_cast<unsigned long long>(max_key));
+
+        hipcub::DoubleBuffer<int64_t> sort_keys(keys, keys_alt);
+        hipcub::DoubleBuffer<rocsparse_int> sort_vals(sellc->perm, perm_alt);
+
+        void* d_temp_storage      = nullptr;
+        size_t temp_storage_bytes = 0;
+
+        RETURN_IF_HIP_ERROR(hipcub::DeviceRadixSort::SortPairs(
+            d_temp_storage, temp_storage_bytes, sort_keys, sort_vals, m, 0, endbit, stream));
+        RETURN_IF_HIP_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
+        RETURN_IF_HIP_ERROR(hipcub::DeviceRadixSort::SortPairs(
+            d_temp_storage, temp_storage_bytes, sort_keys, sort_vals, m, 0, endbit, stream));
+        RETURN_IF_HIP_ERROR(handle->deallocate(d_temp_storage));
+
+        // Copy sorted permutation, if stored in buffer
+        if(sort_vals.Current() != sellc->perm)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(sellc->perm,
+                                               sort_vals.Current(),
+                                               sizeof(rocsparse_int) * m,
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+        }
+    }
+
+    RETURN_IF_HIP_ERROR(handle->deallocate(perm_alt));
+    RETURN_IF_HIP_ERROR(handle->deallocate(keys_alt));
+    RETURN_IF_HIP_ERROR(handle->deallocate(keys));
+
+    // Build slices
+    if(sellc->slice_size == 32)
+    {
+        return rocsparse_csr2sellc_launch<T, 32>(
+            handle, descr, csr_val, csr_row_ptr, csr_col_ind, sellc);
+    }
+    else
+    {
+        return rocsparse_csr2sellc_launch<T, 64>(
+            handle, descr, csr_val, csr_row_ptr, csr_col_ind, sellc);
+    }
+}
+
+#undef CSR2SELLC_DIM
+
+#endif // ROCSPARSE_CSR2SELLC_HPP
@@ -0,0 +1,223 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+#include "rocsparse_dia2csr.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_sdia2csr_nnz(rocsparse_handle handle,
+                                                   rocsparse_int m,
+                                                   rocsparse_int n,
+                                                   const rocsparse_mat_descr dia_descr,
+                                                   rocsparse_int ndiag,
+                                                   const float* dia_val,
+                                                   const rocsparse_int* dia_offset,
+                                                   const rocsparse_mat_descr csr_descr,
+                                                   rocsparse_int* csr_row_ptr,
+                                                   rocsparse_int* csr_nnz)
+{
+    return rocsparse_dia2csr_nnz_template<float>(handle,
+                                                 m,
+                                                 n,
+                                                 dia_descr,
+                                                 ndiag,
+                                                 dia_val,
+                                                 dia_offset,
+                                                 csr_descr,
+                                                 csr_row_ptr,
+                                                 csr_nnz);
+}
+
+extern "C" rocsparse_status rocsparse_ddia2csr_nnz(rocsparse_handle handle,
+                                                   rocsparse_int m,
+                                                   rocsparse_int n,
+                                                   const rocsparse_mat_descr dia_descr,
+                                                   rocsparse_int ndiag,
+                                                   const double* dia_val,
+                                                   const rocsparse_int* dia_offset,
+                                                   const rocsparse_mat_descr csr_descr,
+                                                   rocsparse_int* csr_row_ptr,
+                                                   rocsparse_int* csr_nnz)
+{
+    return rocsparse_dia2csr_nnz_template<double>(handle,
+                                                  m,
+                                                  n,
+                                                  dia_descr,
+                                                  ndiag,
+                                                  dia_val,
+                                                  dia_offset,
+                                                  csr_descr,
+                                                  csr_row_ptr,
+                                                  csr_nnz);
+}
+
+extern "C" rocsparse_status rocsparse_cdia2csr_nnz(rocsparse_handle handle,
+                                                   rocsparse_int m,
+                                                   rocsparse_int n,
+                                                   const rocsparse_mat_descr dia_descr,
+                                                   rocsparse_int ndiag,
+                                                   const rocsparse_float_complex* dia_val,
+                                                   const rocsparse_int* dia_offset,
+                                                   const rocsparse_mat_descr csr_descr,
+                                                   rocsparse_int* csr_row_ptr,
+                                                   rocsparse_int* csr_nnz)
+{
+    return rocsparse_dia2csr_nnz_template<rocsparse_float_complex>(handle,
+                                                                   m,
+                                                                   n,
+                                                                   dia_descr,
+                                                                   ndiag,
+                                                                   dia_val,
+                                                                   dia_offset,
+                                                                   csr_descr,
+                                                                   csr_row_ptr,
+                                                                   csr_nnz);
+}
+
+extern "C" rocsparse_status rocsparse_zdia2csr_nnz(rocsparse_handle handle,
+                                                   rocsparse_int m,
+                                                   rocsparse_int n,
+                                                   const rocsparse_mat_descr dia_descr,
+                                                   rocsparse_int ndiag,
+                                                   const rocsparse_double_complex* dia_val,
+                                                   const rocsparse_int* dia_offset,
+                                                   const rocsparse_mat_descr csr_descr,
+                                                   rocsparse_int* csr_row_ptr,
+                                                   rocsparse_int* csr_nnz)
+{
+    return rocsparse_dia2csr_nnz_template<rocsparse_double_complex>(handle,
+                                                                    m,
+                                                                    n,
+                                                                    dia_descr,
+                                                                    ndiag,
+                                                                    dia_val,
+                                                                    dia_offset,
+                                                                    csr_descr,
+                                                                    csr_row_ptr,
+                                                                    csr_nnz);
+}
+
+extern "C" rocsparse_status rocsparse_sdia2csr(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr dia_descr,
+                                               rocsparse_int ndiag,
+                                               const float* dia_val,
+                                               const rocsparse_int* dia_offset,
+                                               const rocsparse_mat_descr csr_descr,
+                                               float* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               rocsparse_int* csr_col_ind)
+{
+    return rocsparse_dia2csr_template<float>(handle,
+                                             m,
+                                             n,
+                                             dia_descr,
+                                             ndiag,
+                                             dia_val,
+                                             dia_offset,
+                                             csr_descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_ddia2csr(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr dia_descr,
+                                               rocsparse_int ndiag,
+                                               const double* dia_val,
+                                               const rocsparse_int* dia_offset,
+                                               const rocsparse_mat_descr csr_descr,
+                                               double* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               rocsparse_int* csr_col_ind)
+{
+    return rocsparse_dia2csr_template<double>(handle,
+                                              m,
+                                              n,
+                                              dia_descr,
+                                              ndiag,
+                                              dia_val,
+                                              dia_offset,
+                                              csr_descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_cdia2csr(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr dia_descr,
+                                               rocsparse_int ndiag,
+                                               const rocsparse_float_complex* dia_val,
+                                               const rocsparse_int* dia_offset,
+                                               const rocsparse_mat_descr csr_descr,
+                                               rocsparse_float_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               rocsparse_int* csr_col_ind)
+{
+    return rocsparse_dia2csr_template<rocsparse_float_complex>(handle,
+                                                               m,
+                                                               n,
+                                                               dia_descr,
+                                                               ndiag,
+                                                               dia_val,
+                                                               dia_offset,
+                                                               csr_descr,
+                                                               csr_val,
+                                                               csr_row_ptr,
+                                                               csr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_zdia2csr(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr dia_descr,
+                                               rocsparse_int ndiag,
+                                               const rocsparse_double_complex* dia_val,
+                                               const rocsparse_int* dia_offset,
+                                               const rocsparse_mat_descr csr_descr,
+                                               rocsparse_double_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               rocsparse_int* csr_col_ind)
+{
+    return rocsparse_dia2csr_template<rocsparse_double_complex>(handle,
+                                                                m,
+                                                                n,
+                                                                dia_descr,
+                                                                ndiag,
+                                                                dia_val,
+                                                                dia_offset,
+                                                                csr_descr,
+                                                                csr_val,
+                                                                csr_row_ptr,
+                                                                csr_col_ind);
+}
@@ -0,0 +1,326 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_DIA2CSR_HPP
+#define ROCSPARSE_DIA2CSR_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "grid.h"
+#include "dia2csr_device.h"
+
+#include <hip/hip_runtime.h>
+#include <hipcub/hipcub.hpp>
+
+#define DIA2CSR_DIM 256
+
+template <typename T>
+rocsparse_status rocsparse_dia2csr_nnz_template(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                rocsparse_int n,
+                                                const rocsparse_mat_descr dia_descr,
+                                                rocsparse_int ndiag,
+                                                const T* dia_val,
+                                                const rocsparse_int* dia_offset,
+                                                const rocsparse_mat_descr csr_descr,
+                                                rocsparse_int* csr_row_ptr,
+                                                rocsparse_int* csr_nnz)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(dia_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xdia2csr_nnz"),
+              m,
+              n,
+              (const void*&)dia_descr,
+              ndiag,
+              (const void*&)dia_val,
+              (const void*&)dia_offset,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_nnz);
+
+    // Check index base
+    if(dia_descr->base != rocsparse_index_base_zero && dia_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(dia_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || ndiag < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(dia_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dia_offset == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || ndiag == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(csr_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *csr_nnz = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Count nnz per row, which only depends on the diagonal offsets
+    dim3 dia2csr_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(m, DIA2CSR_DIM, dia2csr_blocks));
+    dim3 dia2csr_threads(DIA2CSR_DIM);
+
+    hipLaunchKernelGGL((dia2csr_nnz_per_row<DIA2CSR_DIM>),
+                       dia2csr_blocks,
+                       dia2csr_threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       ndiag,
+                       dia_offset,
+                       csr_row_ptr,
+                       csr_descr->base);
+
+    // Inclusive sum to obtain csr_row_ptr array and number of non-zero elements
+    void* d_temp_storage      = nullptr;
+    size_t temp_storage_bytes = 0;
+
+    // Obtain hipcub buffer size
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
+        d_temp_storage, temp_storage_bytes, csr_row_ptr, csr_row_ptr, m + 1, stream));
+
+    // Allocate hipcub buffer
+    RETURN_IF_HIP_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
+
+    // Do inclusive sum
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
+        d_temp_storage, temp_storage_bytes, csr_row_ptr, csr_row_ptr, m + 1, stream));
+
+    // Clear hipcub buffer
+    RETURN_IF_HIP_ERROR(handle->deallocate(d_temp_storage));
+
+    // Extract and adjust nnz
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            csr_nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+
+        // Adjust nnz according to index base
+        if(csr_descr->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((dia2csr_index_base), dim3(1), dim3(1), 0, stream, csr_nnz);
+        }
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(csr_nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Adjust nnz according to index base
+        *csr_nnz -= csr_descr->base;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_dia2csr_template(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int n,
+                                            const rocsparse_mat_descr dia_descr,
+                                            rocsparse_int ndiag,
+                                            const T* dia_val,
+                                            const rocsparse_int* dia_offset,
+                                            const rocsparse_mat_descr csr_descr,
+                                            T* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            rocsparse_int* csr_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(dia_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xdia2csr"),
+              m,
+              n,
+              (const void*&)dia_descr,
+              ndiag,
+              (const void*&)dia_val,
+              (const void*&)dia_offset,
+              (const void*&)csr_descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind);
+
+    log_bench(handle, "./rocsparse-bench -f dia2csr -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(dia_descr->base != rocsparse_index_base_zero && dia_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(dia_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || ndiag < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(dia_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dia_offset == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || ndiag == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    dim3 dia2csr_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(m, DIA2CSR_DIM, dia2csr_blocks));
+    dim3 dia2csr_threads(DIA2CSR_DIM);
+
+    hipLaunchKernelGGL((dia2csr_fill<T, DIA2CSR_DIM>),
+                       dia2csr_blocks,
+                       dia2csr_threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       ndiag,
+                       dia_val,
+                       dia_offset,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       csr_descr->base);
+
+    return rocsparse_status_success;
+}
+
+#undef DIA2CSR_DIM
+
+#endif // ROCSPARSE_DIA2CSR_HPP
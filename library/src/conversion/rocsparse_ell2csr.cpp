@@ -154,7 +154,7 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle handle,
 
     // Obtain hipcub buffer size
     RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
-        nullptr, temp_storage_bytes, csr_row_ptr, csr_row_ptr, m + 1));
+        nullptr, temp_storage_bytes, csr_row_ptr, csr_row_ptr, m + 1, stream));
 
     // Get hipcub buffer
     bool d_temp_alloc;
@@ -168,13 +168,13 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle handle,
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
+        RETURN_IF_HIP_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
         d_temp_alloc = true;
     }
 
     // Perform actual inclusive sum
     RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
-        d_temp_storage, temp_storage_bytes, csr_row_ptr, csr_row_ptr, m + 1));
+        d_temp_storage, temp_storage_bytes, csr_row_ptr, csr_row_ptr, m + 1, stream));
 
     // Extract and adjust nnz
     if(csr_descr->base == rocsparse_index_base_one)
@@ -216,7 +216,7 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle handle,
     // Free hipcub buffer, if allocated
     if(d_temp_alloc == true)
     {
-        RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
+        RETURN_IF_HIP_ERROR(handle->deallocate(d_temp_storage));
     }
 
     return rocsparse_status_success;
@@ -271,3 +271,53 @@ extern "C" rocsparse_status rocsparse_dell2csr(rocsparse_handle handle,
                                               csr_row_ptr,
                                               csr_col_ind);
 }
+
+extern "C" rocsparse_status rocsparse_cell2csr(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr ell_descr,
+                                               rocsparse_int ell_width,
+                                               const rocsparse_float_complex* ell_val,
+                                               const rocsparse_int* ell_col_ind,
+                                               const rocsparse_mat_descr csr_descr,
+                                               rocsparse_float_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               rocsparse_int* csr_col_ind)
+{
+    return rocsparse_ell2csr_template<rocsparse_float_complex>(handle,
+                                                               m,
+                                                               n,
+                                                               ell_descr,
+                                                               ell_width,
+                                                               ell_val,
+                                                               ell_col_ind,
+                                                               csr_descr,
+                                                               csr_val,
+                                                               csr_row_ptr,
+                                                               csr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_zell2csr(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr ell_descr,
+                                               rocsparse_int ell_width,
+                                               const rocsparse_double_complex* ell_val,
+                                               const rocsparse_int* ell_col_ind,
+                                               const rocsparse_mat_descr csr_descr,
+                                               rocsparse_double_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               rocsparse_int* csr_col_ind)
+{
+    return rocsparse_ell2csr_template<rocsparse_double_complex>(handle,
+                                                                m,
+                                                                n,
+                                                                ell_descr,
+                                                                ell_width,
+                                                                ell_val,
+                                                                ell_col_ind,
+                                                                csr_descr,
+                                                                csr_val,
+                                                                csr_row_ptr,
+                                                                csr_col_ind);
+}
@@ -65,12 +65,20 @@ _rocsparse_handle::_rocsparse_handle()
     // Device one
     THROW_IF_HIP_ERROR(hipMalloc(&sone, sizeof(float)));
     THROW_IF_HIP_ERROR(hipMalloc(&done, sizeof(double)));
+    THROW_IF_HIP_ERROR(hipMalloc(&cone, sizeof(rocsparse_float_complex)));
+    THROW_IF_HIP_ERROR(hipMalloc(&zone, sizeof(rocsparse_double_complex)));
 
-    float hsone  = 1.0f;
-    double hdone = 1.0;
+    float hsone                    = 1.0f;
+    double hdone                   = 1.0;
+    rocsparse_float_complex hcone  = 1.0f;
+    rocsparse_double_complex hzone = 1.0;
 
     THROW_IF_HIP_ERROR(hipMemcpy(sone, &hsone, sizeof(float), hipMemcpyHostToDevice));
     THROW_IF_HIP_ERROR(hipMemcpy(done, &hdone, sizeof(double), hipMemcpyHostToDevice));
+    THROW_IF_HIP_ERROR(
+        hipMemcpy(cone, &hcone, sizeof(rocsparse_float_complex), hipMemcpyHostToDevice));
+    THROW_IF_HIP_ERROR(
+        hipMemcpy(zone, &hzone, sizeof(rocsparse_double_complex), hipMemcpyHostToDevice));
 
     // Open log file
     if(layer_mode & rocsparse_layer_mode_log_trace)
@@ -93,6 +101,18 @@ _rocsparse_handle::~_rocsparse_handle()
     PRINT_IF_HIP_ERROR(hipFree(buffer));
     PRINT_IF_HIP_ERROR(hipFree(sone));
     PRINT_IF_HIP_ERROR(hipFree(done));
+    PRINT_IF_HIP_ERROR(hipFree(cone));
+    PRINT_IF_HIP_ERROR(hipFree(zone));
+
+    // Free csrmv analysis cache
+    for(auto& entry : csrmv_cache)
+    {
+        PRINT_IF_HIP_ERROR(pool->deallocate(entry.csr_row_ptr, stream));
+        PRINT_IF_HIP_ERROR(pool->deallocate(entry.row_blocks, stream));
+    }
+
+    // Cached pool memory is released by the pool itself, once the handle and all
+    // analysis data that has been allocated from it are destroyed
 
     // Close log files
     if(log_trace_ofs.is_open())
@@ -130,6 +150,153 @@ rocsparse_status _rocsparse_handle::get_stream(hipStream_t* user_stream) const
     return rocsparse_status_success;
 }
 
+/*******************************************************************************
+ * allocate temporary device memory:
+   Blocks are served from the handle memory pool, such that repeated calls do
+   not synchronize the device through hipMalloc / hipFree
+ ******************************************************************************/
+hipError_t _rocsparse_handle::allocate(void** ptr, size_t size)
+{
+    return pool->allocate(ptr, size, stream);
+}
+
+/*******************************************************************************
+ * deallocate temporary device memory:
+   The block is cached for reuse, work that is queued on the handle stream may
+   still access it
+ ******************************************************************************/
+hipError_t _rocsparse_handle::deallocate(void* ptr)
+{
+    return pool->deallocate(ptr, stream);
+}
+
+/*******************************************************************************
+ * set csrmv analysis cache capacity:
+   Least recently used entries are evicted until the cache fits the capacity,
+   a capacity of zero disables the cache
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::set_csrmv_cache_capacity(rocsparse_int capacity)
+{
+    csrmv_cache_capacity = capacity;
+
+    while(csrmv_cache.size() > static_cast<size_t>(capacity))
+    {
+        RETURN_IF_HIP_ERROR(deallocate(csrmv_cache.back().csr_row_ptr));
+        RETURN_IF_HIP_ERROR(deallocate(csrmv_cache.back().row_blocks));
+        csrmv_cache.pop_back();
+    }
+
+    return rocsparse_status_success;
+}
+
+/*******************************************************************************
+ * csrmv analysis cache lookup:
+   The entry with matching dimensions and fingerprint becomes the most recently
+   used one. Its row pointers have to be verified by the caller, since different
+   patterns may share a fingerprint.
+ ******************************************************************************/
+_rocsparse_csrmv_cache_entry* _rocsparse_handle::csrmv_cache_find(rocsparse_int m,
+                                                                  rocsparse_int n,
+                                                                  rocsparse_int nnz,
+                                                                  unsigned long long hash)
+{
+    for(auto it = csrmv_cache.begin(); it != csrmv_cache.end(); ++it)
+    {
+        if(it->m != m || it->n != n || it->nnz != nnz || it->hash != hash)
+        {
+            continue;
+        }
+
+        // Move entry to the front
+        csrmv_cache.splice(csrmv_cache.begin(), csrmv_cache, it);
+
+        return &csrmv_cache.front();
+    }
+
+    return nullptr;
+}
+
+/*******************************************************************************
+ * csrmv analysis cache hit:
+   The cached row blocks are copied into the csrmv info
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::csrmv_cache_copy(const _rocsparse_csrmv_cache_entry* entry,
+                                                     rocsparse_csrmv_info info)
+{
+    // Each csrmv info owns its row blocks
+    info->size = entry->size;
+
+    RETURN_IF_HIP_ERROR(
+        allocate((void**)&info->row_blocks, sizeof(unsigned long long) * info->size));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->row_blocks,
+                                       entry->row_blocks,
+                                       sizeof(unsigned long long) * info->size,
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+
+    ++csrmv_cache_hits;
+
+    return rocsparse_status_success;
+}
+
+/*******************************************************************************
+ * csrmv analysis cache insertion:
+   The row pointers and row blocks of the csrmv info are copied into a new entry.
+   An entry with the same fingerprint, that failed verification, is replaced and
+   the least recently used entry is evicted if the cache is full.
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::csrmv_cache_insert(rocsparse_int m,
+                                                       rocsparse_int n,
+                                                       rocsparse_int nnz,
+                                                       unsigned long long hash,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       rocsparse_csrmv_info info)
+{
+    if(csrmv_cache_capacity <= 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    ++csrmv_cache_misses;
+
+    for(auto it = csrmv_cache.begin(); it != csrmv_cache.end(); ++it)
+    {
+        if(it->m == m && it->n == n && it->nnz == nnz && it->hash == hash)
+        {
+            RETURN_IF_HIP_ERROR(deallocate(it->csr_row_ptr));
+            RETURN_IF_HIP_ERROR(deallocate(it->row_blocks));
+            csrmv_cache.erase(it);
+            break;
+        }
+    }
+
+    _rocsparse_csrmv_cache_entry entry;
+
+    entry.m    = m;
+    entry.n    = n;
+    entry.nnz  = nnz;
+    entry.hash = hash;
+    entry.size = info->size;
+
+    RETURN_IF_HIP_ERROR(allocate((void**)&entry.csr_row_ptr, sizeof(rocsparse_int) * (m + 1)));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(entry.csr_row_ptr,
+                                       csr_row_ptr,
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+    RETURN_IF_HIP_ERROR(
+        allocate((void**)&entry.row_blocks, sizeof(unsigned long long) * entry.size));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(entry.row_blocks,
+                                       info->row_blocks,
+                                       sizeof(unsigned long long) * entry.size,
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+
+    csrmv_cache.push_front(entry);
+
+    return set_csrmv_cache_capacity(csrmv_cache_capacity);
+}
+
 /********************************************************************************
  * \brief rocsparse_csrmv_info is a structure holding the rocsparse csrmv info
  * data gathered during csrmv_analysis. It must be initialized using the
@@ -167,10 +334,27 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
         return rocsparse_status_success;
     }
 
-    // Clean up row blocks
-    if(info->size > 0)
+    // Clean up row blocks, merge path partitions and cached transpose, device arrays
+    // are returned to the memory pool that allocated them
+    if(info->pool != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->row_blocks));
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->row_blocks, info->stream));
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->merge_row, info->stream));
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->merge_nnz, info->stream));
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->carry_row, info->stream));
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->carry_val, info->stream));
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->csc_col_ptr, info->stream));
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->csc_row_ind, info->stream));
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->csc_perm, info->stream));
+
+        info->row_blocks  = nullptr;
+        info->merge_row   = nullptr;
+        info->merge_nnz   = nullptr;
+        info->carry_row   = nullptr;
+        info->carry_val   = nullptr;
+        info->csc_col_ptr = nullptr;
+        info->csc_row_ind = nullptr;
+        info->csc_perm    = nullptr;
     }
 
     // Destruct
@@ -222,31 +406,139 @@ rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info)
         return rocsparse_status_success;
     }
 
-    // Clean up
-    if(info->d_row_map != nullptr)
+    // Clean up, device arrays are returned to the memory pool that allocated them
+    if(info->pool != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->d_row_map));
-        info->d_row_map = nullptr;
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->d_row_map, info->stream));
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->d_rows_per_level, info->stream));
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->csr_diag_ind, info->stream));
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->zero_pivot, info->stream));
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->d_in_degree, info->stream));
+
+        info->d_row_map        = nullptr;
+        info->d_rows_per_level = nullptr;
+        info->csr_diag_ind     = nullptr;
+        info->zero_pivot       = nullptr;
+        info->d_in_degree      = nullptr;
     }
 
-    if(info->h_row_map != nullptr)
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
     {
-        RETURN_IF_HIP_ERROR(hipHostFree(info->h_row_map));
-        info->h_row_map = nullptr;
+        return status;
     }
+    return rocsparse_status_success;
+}
 
-    if(info->csr_diag_ind != nullptr)
+/********************************************************************************
+ * \brief rocsparse_csriluk_info is a structure holding the level of fill pattern
+ * of the incomplete factors gathered during csriluk_nnz and their dependency
+ * analysis gathered during csriluk_symbolic. It must be initialized using the
+ * rocsparse_create_csriluk_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csriluk_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csriluk_info(rocsparse_csriluk_info* info)
+{
+    if(info == nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->csr_diag_ind));
-        info->csr_diag_ind = nullptr;
+        return rocsparse_status_invalid_pointer;
     }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csriluk_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy csriluk info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csriluk_info(rocsparse_csriluk_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clean up, device arrays are returned to the memory pool that allocated them
+    if(info->pool != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->csr_col_ind_M, info->stream));
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->scatter, info->stream));
+    }
+
+    info->csr_col_ind_M = nullptr;
+    info->scatter       = nullptr;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrtr));
+    info->csrtr = nullptr;
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csrilut_info is a structure holding the drop parameters and
+ * the maximum number of entries of the incomplete factors gathered during
+ * csrilut_nnz, and the zero pivot of csrilut_numeric. It must be initialized
+ * using the rocsparse_create_csrilut_info() routine. It should be destroyed at
+ * the end using rocsparse_destroy_csrilut_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrilut_info(rocsparse_csrilut_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csrilut_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
 
-    if(info->zero_pivot != nullptr)
+/********************************************************************************
+ * \brief Destroy csrilut info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrilut_info(rocsparse_csrilut_info info)
+{
+    if(info == nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->zero_pivot));
-        info->zero_pivot = nullptr;
+        return rocsparse_status_success;
     }
 
+    // Clean up
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->zero_pivot_info));
+    info->zero_pivot_info = nullptr;
+
     // Destruct
     try
     {
@@ -258,3 +550,36 @@ rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info)
     }
     return rocsparse_status_success;
 }
+
+/********************************************************************************
+ * \brief Copy the number of rows per level to the host, if not already present.
+ * This synchronizes with the handle stream.
+ *******************************************************************************/
+rocsparse_status rocsparse_csrtr_rows_per_level(rocsparse_handle handle, rocsparse_csrtr_info info)
+{
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Already available or no levels
+    if(!info->rows_per_level.empty() || info->d_rows_per_level == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    info->rows_per_level.resize(info->max_depth);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->rows_per_level.data(),
+                                       info->d_rows_per_level,
+                                       sizeof(rocsparse_int) * info->max_depth,
+                                       hipMemcpyDeviceToHost,
+                                       handle->stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+
+    return rocsparse_status_success;
+}
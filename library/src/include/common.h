@@ -0,0 +1,215 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef COMMON_H
+#define COMMON_H
+
+#include "rocsparse.h"
+
+#include <hip/hip_runtime.h>
+
+// Device functions that are overloaded for real and complex types, such that
+// kernels can be instantiated for all of them
+
+// Fused multiply-add p * q + r
+__device__ __forceinline__ float rocsparse_fma(float p, float q, float r)
+{
+    return fma(p, q, r);
+}
+
+__device__ __forceinline__ double rocsparse_fma(double p, double q, double r)
+{
+    return fma(p, q, r);
+}
+
+template <typename T>
+__device__ __forceinline__ rocsparse_complex_num<T> rocsparse_fma(rocsparse_complex_num<T> p,
+                                                                  rocsparse_complex_num<T> q,
+                                                                  rocsparse_complex_num<T> r)
+{
+    return std::fma(p, q, r);
+}
+
+// Complex conjugate, identity for real types
+__device__ __forceinline__ float rocsparse_conj(float x)
+{
+    return x;
+}
+
+__device__ __forceinline__ double rocsparse_conj(double x)
+{
+    return x;
+}
+
+template <typename T>
+__device__ __forceinline__ rocsparse_complex_num<T> rocsparse_conj(rocsparse_complex_num<T> z)
+{
+    return std::conj(z);
+}
+
+// Absolute value, the modulus for complex types
+__device__ __forceinline__ float rocsparse_abs(float x)
+{
+    return fabs(x);
+}
+
+__device__ __forceinline__ double rocsparse_abs(double x)
+{
+    return fabs(x);
+}
+
+template <typename T>
+__device__ __forceinline__ T rocsparse_abs(rocsparse_complex_num<T> z)
+{
+    return std::abs(z);
+}
+
+// Load through the read-only data cache
+template <typename T>
+__device__ __forceinline__ T rocsparse_ldg(const T* ptr)
+{
+    return __ldg(ptr);
+}
+
+template <typename T>
+__device__ __forceinline__ rocsparse_complex_num<T>
+    rocsparse_ldg(const rocsparse_complex_num<T>* ptr)
+{
+    return rocsparse_complex_num<T>(__ldg(&ptr->x), __ldg(&ptr->y));
+}
+
+// Atomic addition, complex types add the real and imaginary part independently
+__device__ __forceinline__ float rocsparse_atomic_add(float* ptr, float val)
+{
+    return atomicAdd(ptr, val);
+}
+
+__device__ __forceinline__ double rocsparse_atomic_add(double* ptr, double val)
+{
+    return atomicAdd(ptr, val);
+}
+
+template <typename T>
+__device__ __forceinline__ rocsparse_complex_num<T>
+    rocsparse_atomic_add(rocsparse_complex_num<T>* ptr, rocsparse_complex_num<T> val)
+{
+    return rocsparse_complex_num<T>(atomicAdd(&ptr->x, val.x), atomicAdd(&ptr->y, val.y));
+}
+
+#if defined(rocsparse_ILP64)
+// Integer atomics on 64 bit rocsparse_int. Addition and bitwise operations are
+// identical for signed and unsigned two's complement integers, min and max
+// require a compare and swap loop.
+__device__ __forceinline__ int64_t atomicAdd(int64_t* ptr, int64_t val)
+{
+    return atomicAdd(reinterpret_cast<unsigned long long*>(ptr),
+                     static_cast<unsigned long long>(val));
+}
+
+__device__ __forceinline__ int64_t atomicSub(int64_t* ptr, int64_t val)
+{
+    return atomicAdd(ptr, -val);
+}
+
+__device__ __forceinline__ int64_t atomicOr(int64_t* ptr, int64_t val)
+{
+    return atomicOr(reinterpret_cast<unsigned long long*>(ptr),
+                    static_cast<unsigned long long>(val));
+}
+
+__device__ __forceinline__ int64_t atomicMin(int64_t* ptr, int64_t val)
+{
+    unsigned long long* address = reinterpret_cast<unsigned long long*>(ptr);
+    unsigned long long  old     = *address;
+    unsigned long long  assumed;
+
+    do
+    {
+        assumed = old;
+        old     = atomicCAS(address,
+                        assumed,
+                        static_cast<unsigned long long>(min(static_cast<int64_t>(assumed), val)));
+    } while(assumed != old);
+
+    return static_cast<int64_t>(old);
+}
+
+__device__ __forceinline__ int64_t atomicMax(int64_t* ptr, int64_t val)
+{
+    unsigned long long* address = reinterpret_cast<unsigned long long*>(ptr);
+    unsigned long long  old     = *address;
+    unsigned long long  assumed;
+
+    do
+    {
+        assumed = old;
+        old     = atomicCAS(address,
+                        assumed,
+                        static_cast<unsigned long long>(max(static_cast<int64_t>(assumed), val)));
+    } while(assumed != old);
+
+    return static_cast<int64_t>(old);
+}
+#endif
+
+#if defined(__HIP_PLATFORM_HCC__)
+// Atomic load and store with memory order, used to bypass caches. There are no
+// 128 bit atomics, thus complex types load and store both parts separately. This
+// is sufficient, as the values are synchronized by a separate flag.
+template <typename T>
+__device__ __forceinline__ T rocsparse_atomic_load(const T* ptr, int memorder)
+{
+    T val;
+    __atomic_load(ptr, &val, memorder);
+    return val;
+}
+
+template <typename T>
+__device__ __forceinline__ rocsparse_complex_num<T>
+    rocsparse_atomic_load(const rocsparse_complex_num<T>* ptr, int memorder)
+{
+    rocsparse_complex_num<T> val;
+    __atomic_load(&ptr->x, &val.x, memorder);
+    __atomic_load(&ptr->y, &val.y, memorder);
+    return val;
+}
+
+template <typename T>
+__device__ __forceinline__ void rocsparse_atomic_store(T* ptr, T val, int memorder)
+{
+    __atomic_store(ptr, &val, memorder);
+}
+
+template <typename T>
+__device__ __forceinline__ void rocsparse_atomic_store(rocsparse_complex_num<T>* ptr,
+                                                      rocsparse_complex_num<T> val,
+                                                      int memorder)
+{
+    __atomic_store(&ptr->x, &val.x, memorder);
+    __atomic_store(&ptr->y, &val.y, memorder);
+}
+#endif
+
+#endif // COMMON_H
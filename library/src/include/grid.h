@@ -0,0 +1,66 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef GRID_H
+#define GRID_H
+
+#include "rocsparse.h"
+
+#include <stdint.h>
+#include <hip/hip_runtime_api.h>
+
+// Largest number of work items a single kernel launch can address
+#define ROCSPARSE_GRID_MAX_ITEMS ((int64_t(1) << 32) - 1)
+
+/********************************************************************************
+ * \brief Returns the number of blocks of size dim that are required to cover
+ * items work items. The computation is performed in 64 bit, such that products
+ * like wavefront_size * m do not overflow rocsparse_int.
+ *******************************************************************************/
+static inline int64_t rocsparse_grid_size(int64_t items, int64_t dim)
+{
+    return (items <= 0) ? 1 : (items - 1) / dim + 1;
+}
+
+/********************************************************************************
+ * \brief Computes the grid of a launch with blocks of size dim that covers items
+ * work items. Returns rocsparse_status_invalid_size if the launch exceeds the
+ * addressable range of a single grid.
+ *******************************************************************************/
+static inline rocsparse_status rocsparse_grid_dim(int64_t items, int64_t dim, dim3& grid)
+{
+    int64_t blocks = rocsparse_grid_size(items, dim);
+
+    if(blocks > ROCSPARSE_GRID_MAX_ITEMS / dim)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    grid = dim3(static_cast<unsigned int>(blocks));
+
+    return rocsparse_status_success;
+}
+
+#endif // GRID_H
@@ -25,16 +25,43 @@
 #ifndef HANDLE_H
 #define HANDLE_H
 
+#include "memory_pool.h"
 #include "rocsparse.h"
 
 #include <iostream>
 #include <fstream>
+#include <list>
+#include <memory>
 #include <vector>
 #include <hip/hip_runtime_api.h>
 
 /*! \brief typedefs to opaque info structs */
 typedef struct _rocsparse_csrmv_info* rocsparse_csrmv_info;
 typedef struct _rocsparse_csrtr_info* rocsparse_csrtr_info;
+typedef struct _rocsparse_csriluk_info* rocsparse_csriluk_info;
+typedef struct _rocsparse_csrilut_info* rocsparse_csrilut_info;
+
+/********************************************************************************
+ * \brief rocsparse_csrmv_cache_entry holds the csrmv row blocks of a sparsity
+ * pattern, identified by its dimensions and a fingerprint of the row pointers. A
+ * copy of the row pointers verifies that a matching fingerprint is no collision.
+ *******************************************************************************/
+struct _rocsparse_csrmv_cache_entry
+{
+    // matrix dimensions
+    rocsparse_int m   = 0;
+    rocsparse_int n   = 0;
+    rocsparse_int nnz = 0;
+    // fingerprint of the row pointer array
+    unsigned long long hash = 0;
+    // copy of the row pointer array
+    rocsparse_int* csr_row_ptr = nullptr;
+
+    // num row blocks
+    size_t size = 0;
+    // row blocks
+    unsigned long long* row_blocks = nullptr;
+};
 
 /********************************************************************************
  * \brief rocsparse_handle is a structure holding the rocsparse library context.
@@ -55,6 +82,29 @@ struct _rocsparse_handle
     // get stream
     rocsparse_status get_stream(hipStream_t* user_stream) const;
 
+    // set csrmv analysis cache capacity, evicts entries that exceed the capacity
+    rocsparse_status set_csrmv_cache_capacity(rocsparse_int capacity);
+    // look up the entry with matching dimensions and fingerprint, nullptr if unknown
+    _rocsparse_csrmv_cache_entry* csrmv_cache_find(rocsparse_int m,
+                                                   rocsparse_int n,
+                                                   rocsparse_int nnz,
+                                                   unsigned long long hash);
+    // copy the row blocks of a verified entry into csrmv info
+    rocsparse_status csrmv_cache_copy(const _rocsparse_csrmv_cache_entry* entry,
+                                      rocsparse_csrmv_info info);
+    // insert the row blocks of csrmv info as most recently used entry
+    rocsparse_status csrmv_cache_insert(rocsparse_int m,
+                                        rocsparse_int n,
+                                        rocsparse_int nnz,
+                                        unsigned long long hash,
+                                        const rocsparse_int* csr_row_ptr,
+                                        rocsparse_csrmv_info info);
+
+    // allocate temporary device memory from the memory pool, to be used on stream
+    hipError_t allocate(void** ptr, size_t size);
+    // return temporary device memory to the memory pool
+    hipError_t deallocate(void* ptr);
+
     // device id
     int device;
     // device properties
@@ -65,6 +115,8 @@ struct _rocsparse_handle
     hipStream_t stream = 0;
     // pointer mode ; default mode is host
     rocsparse_pointer_mode pointer_mode = rocsparse_pointer_mode_host;
+    // execution mode ; default mode is sync
+    rocsparse_exec_mode exec_mode = rocsparse_exec_mode_sync;
     // logging mode
     rocsparse_layer_mode layer_mode;
     // device buffer
@@ -73,6 +125,19 @@ struct _rocsparse_handle
     // device one
     float* sone;
     double* done;
+    rocsparse_float_complex* cone;
+    rocsparse_double_complex* zone;
+
+    // csrmv analysis cache, most recently used entry first ; disabled by default
+    rocsparse_int csrmv_cache_capacity = 0;
+    std::list<_rocsparse_csrmv_cache_entry> csrmv_cache;
+    // csrmv analysis cache statistics
+    size_t csrmv_cache_hits   = 0;
+    size_t csrmv_cache_misses = 0;
+
+    // caching pool for temporary device memory, shared with analysis data that has
+    // been allocated from it and may outlive the handle
+    std::shared_ptr<rocsparse_memory_pool> pool = std::make_shared<rocsparse_memory_pool>();
 
     // logging streams
     std::ofstream log_trace_ofs;
@@ -117,6 +182,9 @@ struct _rocsparse_hyb_mat
     // partition type
     rocsparse_hyb_partition partition = rocsparse_hyb_partition_auto;
 
+    // upper bound of the non-zero entries, used to size the HYB matrix in async mode
+    rocsparse_int nnz_bound = -1;
+
     // ELL matrix part
     rocsparse_int ell_nnz      = 0;
     rocsparse_int ell_width    = 0;
@@ -128,6 +196,101 @@ struct _rocsparse_hyb_mat
     rocsparse_int* coo_row_ind = nullptr;
     rocsparse_int* coo_col_ind = nullptr;
     void* coo_val              = nullptr;
+
+    // bytes moved by hybmv as predicted for the ELL width chosen by the auto
+    // partition, 0 if not predicted
+    size_t predicted_bytes = 0;
+
+    // memory pool of the handle that allocated the ELL and COO arrays, and the
+    // stream they have been used on
+    std::shared_ptr<rocsparse_memory_pool> pool;
+    hipStream_t stream = 0;
+};
+
+/********************************************************************************
+ * \brief rocsparse_sellc_mat is a structure holding the rocsparse SELL-C-sigma
+ * matrix. It must be initialized using rocsparse_create_sellc_mat() and the
+ * returned handle must be passed to all subsequent library function calls that
+ * involve the SELL-C-sigma matrix.
+ * It should be destroyed at the end using rocsparse_destroy_sellc_mat().
+ *******************************************************************************/
+struct _rocsparse_sellc_mat
+{
+    // num rows
+    rocsparse_int m = 0;
+    // num cols
+    rocsparse_int n = 0;
+    // num non-zero entries of the CSR matrix
+    rocsparse_int nnz = 0;
+
+    // rows per slice (C) and rows per sorting window (sigma)
+    rocsparse_int slice_size = 0;
+    rocsparse_int sigma      = 0;
+
+    // num slices
+    rocsparse_int nslices = 0;
+    // num stored entries, including padding
+    rocsparse_int sell_nnz = 0;
+    // relative padding overhead (sell_nnz - nnz) / nnz, computed on the host
+    double padding = 0.0;
+
+    // slice offsets into col_ind and val, nslices + 1 entries
+    rocsparse_int* slice_ptr = nullptr;
+    // row of the CSR matrix that is stored at each sorted position, m entries
+    rocsparse_int* perm = nullptr;
+    // column indices and values, column-major within each slice
+    rocsparse_int* col_ind = nullptr;
+    void* val              = nullptr;
+
+    // memory pool of the handle that allocated the device arrays above, and the
+    // stream they have been used on
+    std::shared_ptr<rocsparse_memory_pool> pool;
+    hipStream_t stream = 0;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csr5_mat is a structure holding the tile descriptor of a CSR
+ * matrix in CSR5 format. The non-zero entries are partitioned into tiles of
+ * omega x sigma consecutive entries, the CSR arrays are not copied. It must be
+ * initialized using rocsparse_create_csr5_mat() and the returned handle must be
+ * passed to all subsequent library function calls that involve the CSR5 matrix.
+ *******************************************************************************/
+struct _rocsparse_csr5_mat
+{
+    // num rows
+    rocsparse_int m = 0;
+    // num cols
+    rocsparse_int n = 0;
+    // num non-zero entries
+    rocsparse_int nnz = 0;
+
+    // threads per tile (omega) and consecutive entries per thread (sigma)
+    rocsparse_int omega = 0;
+    rocsparse_int sigma = 0;
+
+    // num tiles
+    rocsparse_int ntiles = 0;
+    // row that contains the first entry of each tile, ntiles entries
+    rocsparse_int* tile_ptr = nullptr;
+    // row start bit flags of each thread, omega * ntiles entries
+    uint32_t* tile_desc_flag = nullptr;
+    // y offset (lower 16 bits) and segment offset (upper 16 bits) of each thread,
+    // omega * ntiles entries
+    uint32_t* tile_desc_offset = nullptr;
+    // offsets into tile_desc_rows, ntiles + 1 entries
+    rocsparse_int* tile_desc_rows_ptr = nullptr;
+    // explicit row of each segment, only stored for tiles that contain empty rows
+    rocsparse_int* tile_desc_rows = nullptr;
+
+    // num empty rows
+    rocsparse_int nempty = 0;
+    // empty rows, that are only scaled by beta
+    rocsparse_int* empty_rows = nullptr;
+
+    // memory pool of the handle that allocated the device arrays above, and the
+    // stream they have been used on
+    std::shared_ptr<rocsparse_memory_pool> pool;
+    hipStream_t stream = 0;
 };
 
 /********************************************************************************
@@ -139,11 +302,37 @@ struct _rocsparse_hyb_mat
  *******************************************************************************/
 struct _rocsparse_mat_info
 {
+    // csrmv algorithm
+    rocsparse_csrmv_alg csrmv_alg = rocsparse_csrmv_alg_adaptive;
+
     // info structs
     rocsparse_csrmv_info csrmv_info       = nullptr;
     rocsparse_csrtr_info csrilu0_info     = nullptr;
+    rocsparse_csrtr_info csric0_info      = nullptr;
     rocsparse_csrtr_info csrsv_upper_info = nullptr;
     rocsparse_csrtr_info csrsv_lower_info = nullptr;
+    rocsparse_csrtr_info csrsm_upper_info = nullptr;
+    rocsparse_csrtr_info csrsm_lower_info = nullptr;
+    // transposed triangular solve, op(A) = A^T or A^H
+    rocsparse_csrtr_info csrsvt_upper_info = nullptr;
+    rocsparse_csrtr_info csrsvt_lower_info = nullptr;
+    // incomplete LU factorization with level of fill
+    rocsparse_csriluk_info csriluk_info = nullptr;
+    // incomplete LU factorization with threshold dropping
+    rocsparse_csrilut_info csrilut_info = nullptr;
+
+    // csrilu0 numeric boost, pivots with magnitude of at most boost_tol are
+    // replaced by boost_val, which is wide enough to hold all value types
+    int boost_enable                   = 0;
+    double boost_tol                   = 0.0;
+    rocsparse_double_complex boost_val = 0.0;
+    // device pointer to hold the number of boosted pivots
+    rocsparse_int* boost_count = nullptr;
+
+    // memory pool of the handle that allocated the boost counter, and the stream it
+    // has been used on
+    std::shared_ptr<rocsparse_memory_pool> pool;
+    hipStream_t stream = 0;
 };
 
 /********************************************************************************
@@ -154,11 +343,34 @@ struct _rocsparse_mat_info
  *******************************************************************************/
 struct _rocsparse_csrmv_info
 {
+    // algorithm
+    rocsparse_csrmv_alg alg = rocsparse_csrmv_alg_adaptive;
+
     // num row blocks
     size_t size = 0;
     // row blocks
     unsigned long long* row_blocks = nullptr;
 
+    // num merge path partitions
+    rocsparse_int nparts = 0;
+    // merge path partition start coordinates (row, nnz), nparts + 1 entries
+    rocsparse_int* merge_row = nullptr;
+    rocsparse_int* merge_nnz = nullptr;
+    // merge path carry-out of each partition (row, value)
+    rocsparse_int* carry_row = nullptr;
+    void* carry_val          = nullptr;
+
+    // cached transpose (CSC pattern) for transposed csrmv, values are gathered from
+    // the CSR values through the permutation csc_perm
+    rocsparse_int* csc_col_ptr = nullptr;
+    rocsparse_int* csc_row_ind = nullptr;
+    rocsparse_int* csc_perm    = nullptr;
+
+    // memory pool of the handle that allocated the device arrays above, and the
+    // stream they have been used on
+    std::shared_ptr<rocsparse_memory_pool> pool;
+    hipStream_t stream = 0;
+
     // some data to verify correct execution
     rocsparse_operation trans;
     rocsparse_int m;
@@ -191,18 +403,27 @@ struct _rocsparse_csrtr_info
     // maximum non-zero entries of a single row
     rocsparse_int max_nnz;
 
-    // host array to hold number of rows per level
+    // device array to hold the accumulated number of rows per level
+    rocsparse_int* d_rows_per_level = nullptr;
+    // host copy of d_rows_per_level, created on demand
     std::vector<rocsparse_int> rows_per_level;
-    // device array to hold row permutation
+    // device array to hold row permutation, rows ordered by level
     rocsparse_int* d_row_map = nullptr;
-    // host array to hold row permutation
-    rocsparse_int* h_row_map = nullptr;
     // device array to hold pointer to diagonal entry
     rocsparse_int* csr_diag_ind = nullptr;
     // device pointer to hold zero pivot
     rocsparse_int* zero_pivot = nullptr;
+    // device array to hold the number of dependencies of each row of op(A),
+    // only required for transposed solves
+    rocsparse_int* d_in_degree = nullptr;
+
+    // memory pool of the handle that allocated the device arrays above, and the
+    // stream they have been used on
+    std::shared_ptr<rocsparse_memory_pool> pool;
+    hipStream_t stream = 0;
 
     // some data to verify correct execution
+    rocsparse_operation trans;
     rocsparse_int m;
     rocsparse_int nnz;
     const _rocsparse_mat_descr* descr;
@@ -223,6 +444,83 @@ rocsparse_status rocsparse_create_csrtr_info(rocsparse_csrtr_info* info);
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info);
 
+/********************************************************************************
+ * \brief Copy the number of rows per level to the host, if not already present.
+ * This synchronizes with the handle stream.
+ *******************************************************************************/
+rocsparse_status rocsparse_csrtr_rows_per_level(rocsparse_handle handle,
+                                               rocsparse_csrtr_info info);
+
+struct _rocsparse_csriluk_info
+{
+    // level of fill
+    rocsparse_int level = 0;
+    // number of non-zero entries of the incomplete factors
+    rocsparse_int nnz_M = 0;
+
+    // device array to hold the column indices of the incomplete factors, that are
+    // copied to the user by csriluk_symbolic
+    rocsparse_int* csr_col_ind_M = nullptr;
+    // device array to hold the position of each entry of A in the incomplete factors
+    rocsparse_int* scatter = nullptr;
+    // dependency analysis of the incomplete factors
+    rocsparse_csrtr_info csrtr = nullptr;
+
+    // memory pool of the handle that allocated the device arrays above, and the
+    // stream they have been used on
+    std::shared_ptr<rocsparse_memory_pool> pool;
+    hipStream_t stream = 0;
+
+    // some data to verify correct execution
+    rocsparse_int m;
+    rocsparse_int nnz;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csriluk_info is a structure holding the level of fill pattern
+ * of the incomplete factors gathered during csriluk_nnz and their dependency
+ * analysis gathered during csriluk_symbolic. It must be initialized using the
+ * rocsparse_create_csriluk_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csriluk_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csriluk_info(rocsparse_csriluk_info* info);
+
+/********************************************************************************
+ * \brief Destroy csriluk info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csriluk_info(rocsparse_csriluk_info info);
+
+struct _rocsparse_csrilut_info
+{
+    // relative drop tolerance
+    double tau = 0.0;
+    // maximum number of entries in the strictly lower and upper part of each row
+    rocsparse_int p = 0;
+    // maximum number of non-zero entries of the incomplete factors
+    rocsparse_int nnz_M = 0;
+
+    // zero pivot of the numeric factorization
+    rocsparse_csrtr_info zero_pivot_info = nullptr;
+
+    // some data to verify correct execution
+    rocsparse_int m;
+    rocsparse_int nnz;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csrilut_info is a structure holding the drop parameters and
+ * the maximum number of entries of the incomplete factors gathered during
+ * csrilut_nnz, and the zero pivot of csrilut_numeric. It must be initialized
+ * using the rocsparse_create_csrilut_info() routine. It should be destroyed at
+ * the end using rocsparse_destroy_csrilut_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrilut_info(rocsparse_csrilut_info* info);
+
+/********************************************************************************
+ * \brief Destroy csrilut info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrilut_info(rocsparse_csrilut_info info);
+
 /********************************************************************************
  * \brief ELL format indexing
  *******************************************************************************/
@@ -230,4 +528,17 @@ rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info);
 #define ELL_IND_EL(i, el, m, width) (el) + (width) * (i)
 #define ELL_IND(i, el, m, width) ELL_IND_ROW(i, el, m, width)
 
+/********************************************************************************
+ * \brief DIA format indexing, entry of row i on the d-th stored diagonal
+ *******************************************************************************/
+#define DIA_IND(i, d, m) (d) * (m) + (i)
+
+/********************************************************************************
+ * \brief BSR format indexing, position of entry (r, c) inside a dense block
+ *******************************************************************************/
+#define BSR_IND_R(r, c, dim) ((c) + (dim) * (r))
+#define BSR_IND_C(r, c, dim) ((r) + (dim) * (c))
+#define BSR_IND(r, c, dim, dir) \
+    (((dir) == rocsparse_direction_row) ? BSR_IND_R(r, c, dim) : BSR_IND_C(r, c, dim))
+
 #endif // HANDLE_H
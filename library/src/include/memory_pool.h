@@ -0,0 +1,293 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef MEMORY_POOL_H
+#define MEMORY_POOL_H
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+#include <hip/hip_runtime_api.h>
+
+// Smallest size class is 256 bytes, size classes are powers of two
+#define ROCSPARSE_POOL_MIN_BIN_BITS 8
+#define ROCSPARSE_POOL_NUM_BINS 56
+
+// Default limit of idle device memory that is kept for reuse
+#define ROCSPARSE_POOL_DEFAULT_LIMIT (size_t(256) << 20)
+
+/********************************************************************************
+ * \brief Returns the size class of a request of size bytes.
+ *******************************************************************************/
+static inline int rocsparse_memory_pool_bin(size_t size)
+{
+    int bin = 0;
+    while(bin < ROCSPARSE_POOL_NUM_BINS - 1
+          && (size_t(1) << (bin + ROCSPARSE_POOL_MIN_BIN_BITS)) < size)
+    {
+        ++bin;
+    }
+
+    return bin;
+}
+
+/********************************************************************************
+ * \brief Returns the number of bytes of a block in size class bin.
+ *******************************************************************************/
+static inline size_t rocsparse_memory_pool_bin_size(int bin)
+{
+    return size_t(1) << (bin + ROCSPARSE_POOL_MIN_BIN_BITS);
+}
+
+/********************************************************************************
+ * \brief rocsparse_hip_allocator is the device memory backend of the memory pool.
+ *******************************************************************************/
+struct rocsparse_hip_allocator
+{
+    static hipError_t allocate(void** ptr, size_t size)
+    {
+        return hipMalloc(ptr, size);
+    }
+
+    static hipError_t deallocate(void* ptr)
+    {
+        return hipFree(ptr);
+    }
+
+    // All work that has been queued on stream has completed
+    static bool idle(hipStream_t stream)
+    {
+        return hipStreamQuery(stream) == hipSuccess;
+    }
+};
+
+/********************************************************************************
+ * \brief rocsparse_memory_pool_t is a caching allocator for temporary device
+ * memory. Requests are rounded up to their size class and returned blocks are
+ * kept per size class, together with the stream they have been released on.
+ * A cached block is handed out again without synchronization on the same
+ * stream, since all work that used it has been queued before. On any other
+ * stream, it is reused only once its stream became idle. Idle memory above
+ * the limit is returned to the backend.
+ *******************************************************************************/
+template <typename ALLOCATOR>
+class rocsparse_memory_pool_t
+{
+    public:
+    rocsparse_memory_pool_t() = default;
+    rocsparse_memory_pool_t(const rocsparse_memory_pool_t&) = delete;
+    rocsparse_memory_pool_t& operator=(const rocsparse_memory_pool_t&) = delete;
+
+    ~rocsparse_memory_pool_t()
+    {
+        release(0);
+
+        // Blocks that have not been returned, e.g. due to an error
+        for(auto& it : used)
+        {
+            ALLOCATOR::deallocate(it.first);
+        }
+    }
+
+    // allocate a block of at least size bytes to be used on stream
+    hipError_t allocate(void** ptr, size_t size, hipStream_t stream)
+    {
+        int bin = rocsparse_memory_pool_bin(size);
+        std::vector<block>& cached = bins[bin];
+
+        // Prefer a block that has been released on the same stream, then a block
+        // of any stream that is idle
+        int pos = -1;
+        for(int i = static_cast<int>(cached.size()) - 1; i >= 0; --i)
+        {
+            if(cached[i].stream == stream)
+            {
+                pos = i;
+                break;
+            }
+        }
+
+        for(int i = static_cast<int>(cached.size()) - 1; pos < 0 && i >= 0; --i)
+        {
+            if(ALLOCATOR::idle(cached[i].stream))
+            {
+                pos = i;
+            }
+        }
+
+        if(pos >= 0)
+        {
+            *ptr = cached[pos].ptr;
+            cached.erase(cached.begin() + pos);
+
+            bytes_cached -= rocsparse_memory_pool_bin_size(bin);
+            ++num_hits;
+        }
+        else
+        {
+            hipError_t status = ALLOCATOR::allocate(ptr, rocsparse_memory_pool_bin_size(bin));
+
+            // Out of memory, return all idle memory and try again
+            if(status != hipSuccess && bytes_cached > 0)
+            {
+                release(0);
+                status = ALLOCATOR::allocate(ptr, rocsparse_memory_pool_bin_size(bin));
+            }
+
+            if(status != hipSuccess)
+            {
+                *ptr = nullptr;
+                return status;
+            }
+
+            ++num_misses;
+        }
+
+        used[*ptr] = bin;
+        bytes_in_use += rocsparse_memory_pool_bin_size(bin);
+
+        return hipSuccess;
+    }
+
+    // return a block to the pool, work on stream may still be using it
+    hipError_t deallocate(void* ptr, hipStream_t stream)
+    {
+        if(ptr == nullptr)
+        {
+            return hipSuccess;
+        }
+
+        auto it = used.find(ptr);
+        if(it == used.end())
+        {
+            return hipErrorInvalidValue;
+        }
+
+        int bin     = it->second;
+        size_t size = rocsparse_memory_pool_bin_size(bin);
+
+        used.erase(it);
+        bytes_in_use -= size;
+
+        if(bytes_cached + size > limit)
+        {
+            // Make room for the block, if it fits at all
+            if(size > limit)
+            {
+                return ALLOCATOR::deallocate(ptr);
+            }
+
+            hipError_t status = release(limit - size);
+            if(status != hipSuccess)
+            {
+                ALLOCATOR::deallocate(ptr);
+                return status;
+            }
+        }
+
+        bins[bin].push_back({ptr, stream});
+        bytes_cached += size;
+
+        return hipSuccess;
+    }
+
+    // set the limit of idle memory, idle memory above the limit is released
+    hipError_t set_limit(size_t bytes)
+    {
+        limit = bytes;
+        return release(limit);
+    }
+
+    // release idle blocks, largest first, until at most bytes are cached
+    hipError_t release(size_t bytes)
+    {
+        for(int bin = ROCSPARSE_POOL_NUM_BINS - 1; bin >= 0 && bytes_cached > bytes; --bin)
+        {
+            while(!bins[bin].empty() && bytes_cached > bytes)
+            {
+                hipError_t status = ALLOCATOR::deallocate(bins[bin].back().ptr);
+                if(status != hipSuccess)
+                {
+                    return status;
+                }
+
+                bins[bin].pop_back();
+                bytes_cached -= rocsparse_memory_pool_bin_size(bin);
+            }
+        }
+
+        return hipSuccess;
+    }
+
+    size_t get_limit() const
+    {
+        return limit;
+    }
+
+    // device memory handed out to the library
+    size_t get_bytes_in_use() const
+    {
+        return bytes_in_use;
+    }
+
+    // idle device memory that is kept for reuse
+    size_t get_bytes_cached() const
+    {
+        return bytes_cached;
+    }
+
+    // requests served from cached blocks
+    size_t get_hits() const
+    {
+        return num_hits;
+    }
+
+    // requests served by the backend
+    size_t get_misses() const
+    {
+        return num_misses;
+    }
+
+    private:
+    struct block
+    {
+        void* ptr;
+        hipStream_t stream;
+    };
+
+    // idle blocks per size class
+    std::vector<block> bins[ROCSPARSE_POOL_NUM_BINS];
+    // size class of the blocks in use
+    std::unordered_map<void*, int> used;
+
+    size_t limit        = ROCSPARSE_POOL_DEFAULT_LIMIT;
+    size_t bytes_in_use = 0;
+    size_t bytes_cached = 0;
+    size_t num_hits     = 0;
+    size_t num_misses   = 0;
+};
+
+typedef rocsparse_memory_pool_t<rocsparse_hip_allocator> rocsparse_memory_pool;
+
+#endif // MEMORY_POOL_H
@@ -0,0 +1,70 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef MERGE_PATH_H
+#define MERGE_PATH_H
+
+#include "rocsparse.h"
+
+#include <stdint.h>
+#include <hip/hip_runtime.h>
+
+/********************************************************************************
+ * \brief Merge path search. Finds the coordinate (row, nz) where the given
+ * diagonal intersects the merge path of the row end offsets and the non-zero
+ * indices, starting at nnz_begin. Diagonals range up to nrows + nnz and are
+ * computed in 64 bit, such that the sum does not overflow rocsparse_int.
+ *******************************************************************************/
+static __device__ __host__ __inline__ void
+    rocsparse_merge_path_search(int64_t diagonal,
+                                rocsparse_int nrows,
+                                rocsparse_int nnz,
+                                const rocsparse_int* row_end,
+                                rocsparse_int nnz_begin,
+                                rocsparse_index_base idx_base,
+                                rocsparse_int& row,
+                                rocsparse_int& nz)
+{
+    int64_t lo = (diagonal > nnz) ? diagonal - nnz : 0;
+    int64_t hi = (diagonal < nrows) ? diagonal : nrows;
+
+    while(lo < hi)
+    {
+        int64_t mid = (lo + hi) >> 1;
+
+        if(row_end[mid] - idx_base <= nnz_begin + diagonal - mid - 1)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    row = static_cast<rocsparse_int>(lo);
+    nz  = static_cast<rocsparse_int>(diagonal - lo);
+}
+
+#endif // MERGE_PATH_H
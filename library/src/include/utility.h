@@ -32,6 +32,7 @@
 #include <fstream>
 #include <string>
 #include <algorithm>
+#include <type_traits>
 
 // Return the leftmost significant bit position
 #if defined(rocsparse_ILP64)
@@ -51,6 +52,16 @@ static inline void rocsparse_one(const rocsparse_handle handle, double** one)
     *one = handle->done;
 }
 
+static inline void rocsparse_one(const rocsparse_handle handle, rocsparse_float_complex** one)
+{
+    *one = handle->cone;
+}
+
+static inline void rocsparse_one(const rocsparse_handle handle, rocsparse_double_complex** one)
+{
+    *one = handle->zone;
+}
+
 // if trace logging is turned on with
 // (handle->layer_mode & rocsparse_layer_mode_log_trace) == true
 // then
@@ -103,7 +114,6 @@ std::string replaceX(std::string input_string)
     {
         std::replace(input_string.begin(), input_string.end(), 'X', 'd');
     }
-    /*
     else if(std::is_same<T, rocsparse_float_complex>::value)
     {
         std::replace(input_string.begin(), input_string.end(), 'X', 'c');
@@ -112,6 +122,7 @@ std::string replaceX(std::string input_string)
     {
         std::replace(input_string.begin(), input_string.end(), 'X', 'z');
     }
+    /*
     else if(std::is_same<T, rocsparse_half>::value)
     {
         std::replace(input_string.begin(), input_string.end(), 'X', 'h');
@@ -120,4 +131,27 @@ std::string replaceX(std::string input_string)
     return input_string;
 }
 
+// replaces X in string with the precisions of a mixed precision routine, that is
+// with the precision of T followed by the precision of A, e.g. ds for double
+// precision vectors and a single precision matrix
+template <typename T, typename A>
+std::string replaceX(std::string input_string)
+{
+    if(std::is_same<T, A>::value)
+    {
+        return replaceX<T>(input_string);
+    }
+
+    std::string precision = replaceX<T>("X") + replaceX<A>("X");
+
+    size_t pos = input_string.find('X');
+    while(pos != std::string::npos)
+    {
+        input_string.replace(pos, 1, precision);
+        pos = input_string.find('X', pos + precision.size());
+    }
+
+    return input_string;
+}
+
 #endif // UTILITY_H
@@ -36,7 +36,7 @@ __device__ void axpyi_device(rocsparse_int nnz,
                              T* y,
                              rocsparse_index_base idx_base)
 {
-    rocsparse_int idx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int idx = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
 
     if(idx >= nnz)
     {
@@ -34,7 +34,7 @@ __global__ void gthr_kernel(rocsparse_int nnz,
                             const rocsparse_int* x_ind,
                             rocsparse_index_base idx_base)
 {
-    rocsparse_int idx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int idx = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
 
     if(idx >= nnz)
     {
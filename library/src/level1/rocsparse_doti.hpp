@@ -104,15 +104,31 @@ rocsparse_status rocsparse_doti_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
-    // Quick return if possible
-    if(nnz == 0)
+    // Result on the host requires synchronization
+    if(handle->exec_mode == rocsparse_exec_mode_async
+       && handle->pointer_mode == rocsparse_pointer_mode_host)
     {
-        return rocsparse_status_success;
+        return rocsparse_status_invalid_value;
     }
 
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Quick return if possible
+    if(nnz == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(result, 0, sizeof(T), stream));
+        }
+        else
+        {
+            *result = static_cast<T>(0);
+        }
+
+        return rocsparse_status_success;
+    }
+
 #define DOTI_DIM 1024
     rocsparse_int nblocks = DOTI_DIM;
 
@@ -0,0 +1,209 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSRMV_DEVICE_H
+#define BSRMV_DEVICE_H
+
+#include "common.h"
+#include "csrmv_device.h"
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// Accumulate the product of a BSR_BLOCK_DIM x BSR_BLOCK_DIM block with the x segment
+// held in registers
+template <typename T, rocsparse_int BSR_BLOCK_DIM, rocsparse_direction DIR>
+static __device__ __forceinline__ void bsrmv_block_product(const T* block, const T* xr, T* sum)
+{
+#pragma unroll
+    for(rocsparse_int r = 0; r < BSR_BLOCK_DIM; ++r)
+    {
+#pragma unroll
+        for(rocsparse_int c = 0; c < BSR_BLOCK_DIM; ++c)
+        {
+            sum[r] = rocsparse_fma(block[BSR_IND(r, c, BSR_BLOCK_DIM, DIR)], xr[c], sum[r]);
+        }
+    }
+}
+
+// BSR SpMV for general, non-transposed matrices with block dimension BSR_BLOCK_DIM.
+// Each sub-wavefront of WF_SIZE threads processes one block row, where each thread
+// processes whole blocks and keeps the corresponding segment of x in registers.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int BSR_BLOCK_DIM, rocsparse_int WF_SIZE>
+static __device__ void bsrmvn_device(rocsparse_direction dir,
+                                     rocsparse_int mb,
+                                     T alpha,
+                                     const rocsparse_int* __restrict__ bsr_row_ptr,
+                                     const rocsparse_int* __restrict__ bsr_col_ind,
+                                     const T* __restrict__ bsr_val,
+                                     const T* __restrict__ x,
+                                     T beta,
+                                     T* __restrict__ y,
+                                     rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * (BLOCKSIZE / WF_SIZE)
+                        + tid / WF_SIZE;
+
+    // Do not run out of bounds
+    if(row >= mb)
+    {
+        return;
+    }
+
+    T sum[BSR_BLOCK_DIM];
+
+#pragma unroll
+    for(rocsparse_int r = 0; r < BSR_BLOCK_DIM; ++r)
+    {
+        sum[r] = static_cast<T>(0);
+    }
+
+    rocsparse_int row_begin = bsr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = bsr_row_ptr[row + 1] - idx_base;
+
+    // Loop over the blocks of this block row
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int col = bsr_col_ind[j] - idx_base;
+
+        // Load the x segment that is multiplied with this block into registers
+        T xr[BSR_BLOCK_DIM];
+
+#pragma unroll
+        for(rocsparse_int c = 0; c < BSR_BLOCK_DIM; ++c)
+        {
+            xr[c] = rocsparse_ldg(x + col * BSR_BLOCK_DIM + c);
+        }
+
+        const T* block = bsr_val + j * BSR_BLOCK_DIM * BSR_BLOCK_DIM;
+
+        if(dir == rocsparse_direction_row)
+        {
+            bsrmv_block_product<T, BSR_BLOCK_DIM, rocsparse_direction_row>(block, xr, sum);
+        }
+        else
+        {
+            bsrmv_block_product<T, BSR_BLOCK_DIM, rocsparse_direction_column>(block, xr, sum);
+        }
+    }
+
+    // Obtain the block row sums
+#pragma unroll
+    for(rocsparse_int r = 0; r < BSR_BLOCK_DIM; ++r)
+    {
+        sum[r] = wf_reduce<WF_SIZE>(sum[r]);
+    }
+
+    if(lid != 0)
+    {
+        return;
+    }
+
+    // First thread of each sub-wavefront writes the block row into y
+#pragma unroll
+    for(rocsparse_int r = 0; r < BSR_BLOCK_DIM; ++r)
+    {
+        rocsparse_int idx = row * BSR_BLOCK_DIM + r;
+        T val             = alpha * sum[r];
+
+        if(beta != static_cast<T>(0))
+        {
+            y[idx] = rocsparse_fma(beta, y[idx], val);
+        }
+        else
+        {
+            y[idx] = val;
+        }
+    }
+}
+
+// BSR SpMV for general, non-transposed matrices with arbitrary block dimension.
+// Each sub-wavefront of WF_SIZE threads processes one row of a block row.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+static __device__ void bsrmvn_general_device(rocsparse_direction dir,
+                                             rocsparse_int mb,
+                                             T alpha,
+                                             const rocsparse_int* __restrict__ bsr_row_ptr,
+                                             const rocsparse_int* __restrict__ bsr_col_ind,
+                                             const T* __restrict__ bsr_val,
+                                             rocsparse_int block_dim,
+                                             const T* __restrict__ x,
+                                             T beta,
+                                             T* __restrict__ y,
+                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * (BLOCKSIZE / WF_SIZE)
+                        + tid / WF_SIZE;
+
+    // Do not run out of bounds
+    if(row >= mb * block_dim)
+    {
+        return;
+    }
+
+    rocsparse_int brow = row / block_dim;
+    rocsparse_int r    = row % block_dim;
+
+    rocsparse_int row_begin = bsr_row_ptr[brow] - idx_base;
+    rocsparse_int row_end   = bsr_row_ptr[brow + 1] - idx_base;
+
+    T sum = static_cast<T>(0);
+
+    // Loop over all (block, column) pairs of this row
+    for(rocsparse_int k = lid; k < (row_end - row_begin) * block_dim; k += WF_SIZE)
+    {
+        rocsparse_int j   = row_begin + k / block_dim;
+        rocsparse_int c   = k % block_dim;
+        rocsparse_int col = bsr_col_ind[j] - idx_base;
+
+        sum = rocsparse_fma(bsr_val[j * block_dim * block_dim + BSR_IND(r, c, block_dim, dir)],
+                            rocsparse_ldg(x + col * block_dim + c),
+                            sum);
+    }
+
+    // Obtain the row sum
+    sum = wf_reduce<WF_SIZE>(sum);
+
+    if(lid != 0)
+    {
+        return;
+    }
+
+    T val = alpha * sum;
+
+    if(beta != static_cast<T>(0))
+    {
+        y[row] = rocsparse_fma(beta, y[row], val);
+    }
+    else
+    {
+        y[row] = val;
+    }
+}
+
+#endif // BSRMV_DEVICE_H
@@ -25,13 +25,15 @@
 #ifndef COOMV_DEVICE_H
 #define COOMV_DEVICE_H
 
+#include "common.h"
+
 #include <hip/hip_runtime.h>
 
 // Scale kernel for beta != 1.0
 template <typename T>
 __device__ void coomv_scale_device(rocsparse_int size, T beta, T* __restrict__ data)
 {
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
 
     if(gid >= size)
     {
@@ -44,20 +46,20 @@ __device__ void coomv_scale_device(rocsparse_int size, T beta, T* __restrict__ d
 // Implementation motivated by papers 'Efficient Sparse Matrix-Vector Multiplication on CUDA',
 // 'Implementing Sparse Matrix-Vector Multiplication on Throughput-Oriented Processors' and
 // 'Segmented operations for sparse matrix computation on vector multiprocessors'
-template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+template <typename T, typename A, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
 static __device__ void coomvn_general_wf_reduce(rocsparse_int nnz,
                                                 rocsparse_int loops,
                                                 T alpha,
                                                 const rocsparse_int* coo_row_ind,
                                                 const rocsparse_int* coo_col_ind,
-                                                const T* coo_val,
+                                                const A* coo_val,
                                                 const T* x,
                                                 T* y,
                                                 rocsparse_int* row_block_red,
                                                 T* val_block_red,
                                                 rocsparse_index_base idx_base)
 {
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
     rocsparse_int tid = hipThreadIdx_x;
 
     // Lane index (0,...,WF_SIZE)
@@ -106,7 +108,7 @@ static __device__ void coomvn_general_wf_reduce(rocsparse_int nnz,
         if(idx < nnz)
         {
             row = coo_row_ind[idx] - idx_base;
-            val = alpha * coo_val[idx] * __ldg(x + coo_col_ind[idx] - idx_base);
+            val = alpha * coo_val[idx] * rocsparse_ldg(x + coo_col_ind[idx] - idx_base);
         }
         else
         {
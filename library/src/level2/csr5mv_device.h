@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR5MV_DEVICE_H
+#define CSR5MV_DEVICE_H
+
+#include "common.h"
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// CSR5 SpMV for general, non-transposed matrices. Each block processes a tile of
+// OMEGA x SIGMA consecutive entries, where each thread owns SIGMA entries. The
+// tile is staged through LDS, such that the CSR arrays are read coalesced. Each
+// thread computes the segments that start within its entries, the last segment is
+// completed by the heads of the subsequent threads, given by the segment offset.
+// The part of a row that started in a preceding tile is stored as carry.
+template <typename T, rocsparse_int OMEGA, rocsparse_int SIGMA>
+static __device__ void csr5mvn_device(rocsparse_int nnz,
+                                      T alpha,
+                                      const rocsparse_int* tile_ptr,
+                                      const uint32_t* tile_desc_flag,
+                                      const uint32_t* tile_desc_offset,
+                                      const rocsparse_int* tile_desc_rows_ptr,
+                                      const rocsparse_int* tile_desc_rows,
+                                      const T* csr_val,
+                                      const rocsparse_int* csr_col_ind,
+                                      const T* x,
+                                      T beta,
+                                      T* y,
+                                      T* carry,
+                                      rocsparse_index_base idx_base)
+{
+    rocsparse_int lid  = hipThreadIdx_x;
+    rocsparse_int tile = hipBlockIdx_x;
+
+    __shared__ rocsparse_int scol[OMEGA * SIGMA];
+    __shared__ T sval[OMEGA * SIGMA];
+    __shared__ T shead[OMEGA];
+
+    rocsparse_int tile_begin = tile * OMEGA * SIGMA;
+    rocsparse_int tile_nnz   = min(OMEGA * SIGMA, nnz - tile_begin);
+
+    // Stage the tile
+    for(rocsparse_int i = lid; i < tile_nnz; i += OMEGA)
+    {
+        scol[i] = csr_col_ind[tile_begin + i] - idx_base;
+        sval[i] = csr_val[tile_begin + i];
+    }
+
+    __syncthreads();
+
+    uint32_t flag       = tile_desc_flag[tile * OMEGA + lid];
+    uint32_t offset     = tile_desc_offset[tile * OMEGA + lid];
+    rocsparse_int y_off = offset & 0xffff;
+    rocsparse_int s_off = offset >> 16;
+
+    // Segment rows are either consecutive or explicitly stored, if the tile
+    // spans empty rows
+    rocsparse_int rows_begin = tile_desc_rows_ptr[tile];
+    bool explicit_rows       = tile_desc_rows_ptr[tile + 1] > rows_begin;
+    rocsparse_int row_begin  = tile_ptr[tile] + ((tile_desc_flag[tile * OMEGA] & 1) ? 0 : 1);
+
+    T sum  = static_cast<T>(0);
+    T head = static_cast<T>(0);
+
+    bool started = false;
+
+    for(rocsparse_int s = 0; s < SIGMA; ++s)
+    {
+        rocsparse_int idx = lid * SIGMA + s;
+
+        if(idx >= tile_nnz)
+        {
+            break;
+        }
+
+        if(flag & (1u << s))
+        {
+            if(started)
+            {
+                // Segment is complete
+                rocsparse_int row
+                    = explicit_rows ? tile_desc_rows[rows_begin + y_off] : row_begin + y_off;
+
+                if(beta != static_cast<T>(0))
+                {
+                    y[row] = rocsparse_fma(beta, y[row], alpha * sum);
+                }
+                else
+                {
+                    y[row] = alpha * sum;
+                }
+
+                ++y_off;
+            }
+            else
+            {
+                // Entries in front of the first row start belong to the preceding
+                // segment
+                head    = sum;
+                started = true;
+            }
+
+            sum = static_cast<T>(0);
+        }
+
+        sum = rocsparse_fma(sval[idx], rocsparse_ldg(x + scol[idx]), sum);
+    }
+
+    if(!started)
+    {
+        head = sum;
+        sum  = static_cast<T>(0);
+    }
+
+    shead[lid] = head;
+
+    __syncthreads();
+
+    // Heads of the subsequent threads that belong to the last segment
+    T rest = static_cast<T>(0);
+
+    if(started || lid == 0)
+    {
+        rocsparse_int last = min(lid + s_off + 1, OMEGA - 1);
+
+        for(rocsparse_int k = lid + 1; k <= last; ++k)
+        {
+            rest = rest + shead[k];
+        }
+    }
+
+    if(started)
+    {
+        rocsparse_int row = explicit_rows ? tile_desc_rows[rows_begin + y_off] : row_begin + y_off;
+
+        if(beta != static_cast<T>(0))
+        {
+            y[row] = rocsparse_fma(beta, y[row], alpha * (sum + rest));
+        }
+        else
+        {
+            y[row] = alpha * (sum + rest);
+        }
+    }
+
+    if(lid == 0)
+    {
+        carry[tile] = alpha * (started ? head : head + rest);
+    }
+}
+
+// Add the carries to the rows that span several tiles. The first tile that does
+// not start with a row start accumulates the carries of all subsequent tiles that
+// continue the same row.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int OMEGA>
+__global__ void csr5mvn_calibrate(rocsparse_int ntiles,
+                                  const rocsparse_int* __restrict__ tile_ptr,
+                                  const uint32_t* __restrict__ tile_desc_flag,
+                                  const T* __restrict__ carry,
+                                  T* __restrict__ y)
+{
+    rocsparse_int tile = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(tile >= ntiles)
+    {
+        return;
+    }
+
+    if(tile_desc_flag[tile * OMEGA] & 1)
+    {
+        return;
+    }
+
+    rocsparse_int row = tile_ptr[tile];
+
+    if(tile > 0 && tile_ptr[tile - 1] == row && !(tile_desc_flag[(tile - 1) * OMEGA] & 1))
+    {
+        return;
+    }
+
+    T sum = carry[tile];
+
+    for(rocsparse_int t = tile + 1; t < ntiles && tile_ptr[t] == row; ++t)
+    {
+        sum = sum + carry[t];
+    }
+
+    y[row] = y[row] + sum;
+}
+
+// Scale the empty rows, that are not covered by any tile
+template <typename T, rocsparse_int BLOCKSIZE>
+static __device__ void csr5mvn_empty_rows_device(rocsparse_int nempty,
+                                                 const rocsparse_int* empty_rows,
+                                                 T beta,
+                                                 T* y)
+{
+    rocsparse_int ai = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(ai >= nempty)
+    {
+        return;
+    }
+
+    rocsparse_int row = empty_rows[ai];
+
+    if(beta != static_cast<T>(0))
+    {
+        y[row] = beta * y[row];
+    }
+    else
+    {
+        y[row] = static_cast<T>(0);
+    }
+}
+
+#endif // CSR5MV_DEVICE_H
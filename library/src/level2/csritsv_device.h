@@ -0,0 +1,130 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRITSV_DEVICE_H
+#define CSRITSV_DEVICE_H
+
+#include "../level1/doti_device.h"
+
+#include <hip/hip_runtime.h>
+
+// One Jacobi sweep y_new = D^-1 * (alpha * x - (T - D) * y_old) for the triangular
+// part T of A, where D is the diagonal of T. Each thread processes a row. If UPDATE
+// is false, y_old is left unchanged and the squared residual of y_old is stored per
+// block instead.
+template <typename T, rocsparse_int BLOCKSIZE, bool UPDATE>
+__device__ void csritsv_sweep_device(rocsparse_int m,
+                                     T alpha,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const T* __restrict__ csr_val,
+                                     const T* __restrict__ x,
+                                     const T* __restrict__ y_old,
+                                     T* __restrict__ y_new,
+                                     T* __restrict__ partial,
+                                     rocsparse_index_base idx_base,
+                                     rocsparse_fill_mode fill_mode,
+                                     rocsparse_diag_type diag_type)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + tid;
+
+    __shared__ T sdata[BLOCKSIZE];
+
+    T res = static_cast<T>(0);
+
+    if(row < m)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum  = alpha * x[row];
+        T diag = static_cast<T>(1);
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            if(col == row)
+            {
+                if(diag_type == rocsparse_diag_type_non_unit)
+                {
+                    diag = csr_val[j];
+                }
+            }
+            else if((fill_mode == rocsparse_fill_mode_lower && col < row)
+                    || (fill_mode == rocsparse_fill_mode_upper && col > row))
+            {
+                sum -= csr_val[j] * y_old[col];
+            }
+        }
+
+        if(UPDATE)
+        {
+            y_new[row] = sum / diag;
+        }
+        else
+        {
+            res = sum - diag * y_old[row];
+        }
+    }
+
+    if(!UPDATE)
+    {
+        sdata[tid] = res * res;
+
+        rocsparse_sum_reduce<BLOCKSIZE, T>(tid, sdata);
+
+        if(tid == 0)
+        {
+            partial[hipBlockIdx_x] = sdata[0];
+        }
+    }
+}
+
+// Reduce the squared residuals of all blocks and store their 2-norm in nrm
+template <typename T, rocsparse_int NB>
+__global__ void csrit_nrm2_kernel(rocsparse_int n, const T* __restrict__ partial, T* nrm)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    __shared__ T sdata[NB];
+
+    sdata[tid] = static_cast<T>(0);
+
+    for(rocsparse_int i = tid; i < n; i += NB)
+    {
+        sdata[tid] += partial[i];
+    }
+
+    rocsparse_sum_reduce<NB, T>(tid, sdata);
+
+    if(tid == 0)
+    {
+        *nrm = sqrt(sdata[0]);
+    }
+}
+
+#endif // CSRITSV_DEVICE_H
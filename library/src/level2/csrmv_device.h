@@ -25,6 +25,9 @@
 #ifndef CSRMV_DEVICE_H
 #define CSRMV_DEVICE_H
 
+#include "common.h"
+#include "merge_path.h"
+
 #include <hip/hip_runtime.h>
 
 #if defined(__HIP_PLATFORM_HCC__)
@@ -159,19 +162,26 @@ __device__ T wf_reduce(T sum)
 }
 #endif
 
-template <typename T, rocsparse_int WF_SIZE>
+// Complex wavefront reduction, real and imaginary part are reduced separately
+template <rocsparse_int WF_SIZE, typename T>
+__device__ rocsparse_complex_num<T> wf_reduce(rocsparse_complex_num<T> sum)
+{
+    return rocsparse_complex_num<T>(wf_reduce<WF_SIZE>(sum.x), wf_reduce<WF_SIZE>(sum.y));
+}
+
+template <typename T, typename A, rocsparse_int WF_SIZE>
 static __device__ void csrmvn_general_device(rocsparse_int m,
                                              T alpha,
                                              const rocsparse_int* row_offset,
                                              const rocsparse_int* csr_col_ind,
-                                             const T* csr_val,
+                                             const A* csr_val,
                                              const T* x,
                                              T beta,
                                              T* y,
                                              rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
     rocsparse_int lid = tid & (WF_SIZE - 1);
     rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
 
@@ -264,6 +274,7 @@ static inline __device__ T sum2_reduce(
 }
 
 template <typename T,
+          typename A,
           rocsparse_int BLOCKSIZE,
           rocsparse_int BLOCK_MULTIPLIER,
           rocsparse_int ROWS_FOR_VECTOR,
@@ -274,7 +285,7 @@ __device__ void csrmvn_adaptive_device(unsigned long long* row_blocks,
                                        T alpha,
                                        const rocsparse_int* csr_row_ptr,
                                        const rocsparse_int* csr_col_ind,
-                                       const T* csr_val,
+                                       const A* csr_val,
                                        const T* x,
                                        T beta,
                                        T* y,
@@ -615,4 +626,1067 @@ __device__ void csrmvn_adaptive_device(unsigned long long* row_blocks,
     }
 }
 
+// Row blocks are built in parallel. Each row computes the row block that would start at
+// this row. The row blocks that are actually used form a chain starting at row 0, which
+// is marked by pointer jumping and then emitted using the exclusive sum of its sizes.
+
+// Flag long rows, they separate regions of short rows
+template <rocsparse_int BLOCKSIZE>
+__global__ void csrmv_row_blocks_flag_kernel(rocsparse_int m,
+                                             const rocsparse_int* __restrict__ csr_row_ptr,
+                                             rocsparse_int* __restrict__ long_pos)
+{
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row > m)
+    {
+        return;
+    }
+
+    long_pos[row] = (row < m) ? (csr_row_ptr[row + 1] - csr_row_ptr[row] > 128) : 0;
+}
+
+// Compaction of long row indices, using the exclusive sum of the long row flags
+template <rocsparse_int BLOCKSIZE>
+__global__ void csrmv_row_blocks_compact_kernel(rocsparse_int m,
+                                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                                const rocsparse_int* __restrict__ long_pos,
+                                                rocsparse_int* __restrict__ long_rows)
+{
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row > m)
+    {
+        return;
+    }
+
+    // Row m is the sentinel
+    if(row == m || csr_row_ptr[row + 1] - csr_row_ptr[row] > 128)
+    {
+        long_rows[long_pos[row]] = row;
+    }
+}
+
+// Compute the row block starting at each row, same as the serial row blocks computation
+// would do if a row block started at this row
+template <rocsparse_int BLOCKSIZE,
+          rocsparse_int ROW_BLOCK_SIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_BITS,
+          rocsparse_int WG_SIZE>
+__global__ void csrmv_row_blocks_segment_kernel(rocsparse_int m,
+                                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                                const rocsparse_int* __restrict__ long_pos,
+                                                const rocsparse_int* __restrict__ long_rows,
+                                                rocsparse_int* __restrict__ next,
+                                                rocsparse_int* __restrict__ count,
+                                                unsigned long long* __restrict__ bits,
+                                                rocsparse_int* __restrict__ label)
+{
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row > m)
+    {
+        return;
+    }
+
+    // Chain starts at row 0
+    label[row] = (row == 0);
+
+    if(row == m)
+    {
+        next[row]  = m;
+        count[row] = 0;
+        bits[row]  = 0ULL;
+
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row];
+    rocsparse_int row_len   = csr_row_ptr[row + 1] - row_begin;
+    rocsparse_int row_next;
+    rocsparse_int row_count = 1;
+
+    bool last = false;
+
+    if(row_len > ROW_BLOCK_SIZE)
+    {
+        // CSR-LongRows, row is processed by multiple workgroups
+        row_count = (row_len - 1) / (BLOCK_MULTIPLIER * ROW_BLOCK_SIZE) + 1;
+        row_count = min(row_count, 1 << WG_BITS);
+        row_next  = row + 1;
+    }
+    else if(row_len == ROW_BLOCK_SIZE)
+    {
+        row_next = row + 1;
+    }
+    else if(row_len > 128)
+    {
+        // Long row region, ends with a short row or a full block
+        row_next = m;
+        last     = true;
+
+        for(rocsparse_int r = row + 1; r < m; ++r)
+        {
+            rocsparse_int sum = csr_row_ptr[r + 1] - row_begin;
+
+            if(csr_row_ptr[r + 1] - csr_row_ptr[r] < 32 || sum > ROW_BLOCK_SIZE)
+            {
+                row_next = r;
+                last     = false;
+                break;
+            }
+            else if(sum == ROW_BLOCK_SIZE)
+            {
+                row_next = r + 1;
+                last     = false;
+                break;
+            }
+        }
+    }
+    else
+    {
+        // Short row region, ends with the next long row or a full block
+        rocsparse_int nl = long_rows[long_pos[row]];
+        rocsparse_int lo = row;
+        rocsparse_int hi = nl;
+
+        while(lo < hi)
+        {
+            rocsparse_int mid = lo + ((hi - lo) >> 1);
+
+            if(csr_row_ptr[mid + 1] - row_begin >= ROW_BLOCK_SIZE)
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid + 1;
+            }
+        }
+
+        if(lo < nl)
+        {
+            row_next = (csr_row_ptr[lo + 1] - row_begin == ROW_BLOCK_SIZE) ? lo + 1 : lo;
+        }
+        else
+        {
+            row_next = nl;
+            last     = (nl == m);
+        }
+    }
+
+    // Number of threads for reduction, the final block of rows counts one more row
+    rocsparse_int nrows   = row_next - row;
+    unsigned long long nt = 0ULL;
+
+    if(nrows > ROWS_FOR_VECTOR)
+    {
+        rocsparse_int nr = last ? nrows + 1 : nrows;
+        nt               = WG_SIZE >> (32 - __clz(nr - 1));
+    }
+
+    next[row]  = row_next;
+    count[row] = row_count;
+    bits[row]  = nt;
+}
+
+// One pointer jumping step to mark all rows that start a row block
+template <rocsparse_int BLOCKSIZE>
+__global__ void csrmv_row_blocks_chain_kernel(rocsparse_int m,
+                                              const rocsparse_int* __restrict__ jump_in,
+                                              rocsparse_int* __restrict__ jump_out,
+                                              rocsparse_int* label)
+{
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row > m)
+    {
+        return;
+    }
+
+    // Labels are only ever set, reading a label set in the same step is fine
+    if(label[row])
+    {
+        label[jump_in[row]] = 1;
+    }
+
+    jump_out[row] = jump_in[jump_in[row]];
+}
+
+// Number of row block entries of each row that starts a row block
+template <rocsparse_int BLOCKSIZE>
+__global__ void csrmv_row_blocks_count_kernel(rocsparse_int m,
+                                              const rocsparse_int* __restrict__ label,
+                                              rocsparse_int* __restrict__ count)
+{
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    if(!label[row])
+    {
+        count[row] = 0;
+    }
+}
+
+// Write row blocks, offset holds the exclusive sum of the row block entries
+template <rocsparse_int BLOCKSIZE, rocsparse_int ROW_BITS>
+__global__ void csrmv_row_blocks_fill_kernel(rocsparse_int m,
+                                             const rocsparse_int* __restrict__ next,
+                                             const rocsparse_int* __restrict__ offset,
+                                             const unsigned long long* __restrict__ bits,
+                                             unsigned long long* __restrict__ row_blocks)
+{
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    if(row == 0)
+    {
+        row_blocks[0] = bits[0];
+    }
+
+    rocsparse_int begin = offset[row];
+    rocsparse_int end   = offset[row + 1];
+
+    if(begin == end)
+    {
+        return;
+    }
+
+    // Additional workgroups of a long row
+    for(rocsparse_int w = 1; w < end - begin; ++w)
+    {
+        row_blocks[begin + w] = (static_cast<unsigned long long>(row) << (64 - ROW_BITS)) |
+                                static_cast<unsigned long long>(w);
+    }
+
+    // Start of the next row block
+    row_blocks[end] = (static_cast<unsigned long long>(next[row]) << (64 - ROW_BITS)) |
+                      bits[next[row]];
+}
+
+// Fingerprint of the row pointer array, used to identify sparsity patterns in the
+// csrmv analysis cache. Each row pointer is mixed with its position (splitmix64
+// finalizer) and the mixed values are summed up, such that the result does not
+// depend on the order of the reduction.
+template <rocsparse_int BLOCKSIZE>
+__global__ void csrmv_row_ptr_hash_kernel(rocsparse_int m,
+                                          const rocsparse_int* __restrict__ csr_row_ptr,
+                                          unsigned long long* __restrict__ hash)
+{
+    __shared__ unsigned long long sdata[BLOCKSIZE];
+
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + tid;
+
+    unsigned long long h = 0;
+
+    if(gid <= m)
+    {
+        h = static_cast<unsigned long long>(gid) * 0x9e3779b97f4a7c15ULL
+            ^ static_cast<unsigned long long>(csr_row_ptr[gid]);
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        h = h ^ (h >> 31);
+    }
+
+    sdata[tid] = h;
+    __syncthreads();
+
+    for(rocsparse_int i = BLOCKSIZE >> 1; i > 0; i >>= 1)
+    {
+        if(tid < i)
+        {
+            sdata[tid] += sdata[tid + i];
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        atomicAdd(hash, sdata[0]);
+    }
+}
+
+// Compare the row pointer array against a cached copy, any difference is flagged
+template <rocsparse_int BLOCKSIZE>
+__global__ void csrmv_row_ptr_compare_kernel(rocsparse_int m,
+                                             const rocsparse_int* __restrict__ csr_row_ptr,
+                                             const rocsparse_int* __restrict__ cached_row_ptr,
+                                             int* __restrict__ mismatch)
+{
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid <= m && csr_row_ptr[gid] != cached_row_ptr[gid])
+    {
+        *mismatch = 1;
+    }
+}
+
+// Compute the merge path start coordinate of each partition
+template <rocsparse_int BLOCKSIZE, rocsparse_int TILE>
+__global__ void csrmv_merge_path_partition_kernel(rocsparse_int m,
+                                                  rocsparse_int nnz,
+                                                  rocsparse_int nparts,
+                                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                                  rocsparse_int* __restrict__ merge_row,
+                                                  rocsparse_int* __restrict__ merge_nnz,
+                                                  rocsparse_index_base idx_base)
+{
+    rocsparse_int part = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(part > nparts)
+    {
+        return;
+    }
+
+    // Diagonals range up to m + nnz and are computed in 64 bit
+    int64_t diagonal = min(static_cast<int64_t>(part) * TILE, static_cast<int64_t>(m) + nnz);
+
+    rocsparse_merge_path_search(
+        diagonal, m, nnz, csr_row_ptr + 1, 0, idx_base, merge_row[part], merge_nnz[part]);
+}
+
+// Merge path SpMV, each workgroup consumes BLOCKSIZE * ITEMS merge path items, that is
+// row end offsets and non-zero entries. Rows that are not completed within the workgroup
+// are written as carry-out and are fixed up afterwards.
+template <typename T, typename A, rocsparse_int BLOCKSIZE, rocsparse_int ITEMS>
+static __device__ void csrmvn_merge_device(T alpha,
+                                           const rocsparse_int* __restrict__ csr_row_ptr,
+                                           const rocsparse_int* __restrict__ csr_col_ind,
+                                           const A* __restrict__ csr_val,
+                                           const rocsparse_int* __restrict__ merge_row,
+                                           const rocsparse_int* __restrict__ merge_nnz,
+                                           const T* __restrict__ x,
+                                           T beta,
+                                           T* __restrict__ y,
+                                           rocsparse_int* __restrict__ carry_row,
+                                           T* __restrict__ carry_val,
+                                           rocsparse_index_base idx_base)
+{
+    __shared__ rocsparse_int s_row_end[BLOCKSIZE * ITEMS];
+    __shared__ T s_val[BLOCKSIZE * ITEMS];
+    __shared__ rocsparse_int s_key[BLOCKSIZE];
+    __shared__ T s_sum[BLOCKSIZE];
+
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int bid = hipBlockIdx_x;
+
+    // Partition of the merge path
+    rocsparse_int row_begin = merge_row[bid];
+    rocsparse_int nnz_begin = merge_nnz[bid];
+    rocsparse_int nrows     = merge_row[bid + 1] - row_begin;
+    rocsparse_int nnz       = merge_nnz[bid + 1] - nnz_begin;
+
+    // Load row end offsets and products into LDS
+    for(rocsparse_int i = tid; i < nrows; i += BLOCKSIZE)
+    {
+        s_row_end[i] = csr_row_ptr[row_begin + i + 1] - idx_base;
+    }
+
+    for(rocsparse_int i = tid; i < nnz; i += BLOCKSIZE)
+    {
+        rocsparse_int j = nnz_begin + i;
+        s_val[i]        = alpha * csr_val[j] * x[csr_col_ind[j] - idx_base];
+    }
+
+    __syncthreads();
+
+    // Start coordinate of this thread
+    rocsparse_int diagonal = min(tid * ITEMS, nrows + nnz);
+    rocsparse_int row;
+    rocsparse_int nz;
+
+    rocsparse_merge_path_search(
+        diagonal, nrows, nnz, s_row_end, nnz_begin, rocsparse_index_base_zero, row, nz);
+
+    // Consume merge path items, keys hold the current row
+    rocsparse_int key[ITEMS];
+    T val[ITEMS];
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int k = 0; k < ITEMS; ++k)
+    {
+        val[k] = static_cast<T>(0);
+
+        if(diagonal + k < nrows + nnz)
+        {
+            if(nz < nnz && (row == nrows || nnz_begin + nz < s_row_end[row]))
+            {
+                // Move down, accumulate non-zero
+                val[k] = s_val[nz];
+                sum += val[k];
+                ++nz;
+            }
+            else
+            {
+                // Move right, row is complete
+                sum = static_cast<T>(0);
+                ++row;
+            }
+        }
+
+        key[k] = row;
+    }
+
+    // Inclusive reduce by key scan of the partial sums of all threads
+    s_key[tid] = row;
+    s_sum[tid] = sum;
+
+    __syncthreads();
+
+    for(rocsparse_int offset = 1; offset < BLOCKSIZE; offset <<= 1)
+    {
+        rocsparse_int prev_key = -1;
+        T prev_sum             = static_cast<T>(0);
+
+        if(tid >= offset)
+        {
+            prev_key = s_key[tid - offset];
+            prev_sum = s_sum[tid - offset];
+        }
+
+        __syncthreads();
+
+        if(prev_key == s_key[tid])
+        {
+            s_sum[tid] += prev_sum;
+        }
+
+        __syncthreads();
+    }
+
+    // Carry-in of this thread
+    rocsparse_int carry_key = (tid == 0) ? 0 : s_key[tid - 1];
+    T carry                 = (tid == 0) ? static_cast<T>(0) : s_sum[tid - 1];
+
+    // Scatter completed rows into LDS, products are not required anymore
+    T* s_partial = s_val;
+
+    if(carry_key != key[0])
+    {
+        s_partial[carry_key] = carry;
+    }
+    else
+    {
+        val[0] += carry;
+    }
+
+    for(rocsparse_int k = 1; k < ITEMS; ++k)
+    {
+        if(key[k - 1] != key[k])
+        {
+            s_partial[key[k - 1]] = val[k - 1];
+        }
+        else
+        {
+            val[k] += val[k - 1];
+        }
+    }
+
+    __syncthreads();
+
+    // Write completed rows
+    for(rocsparse_int i = tid; i < nrows; i += BLOCKSIZE)
+    {
+        if(beta == static_cast<T>(0))
+        {
+            y[row_begin + i] = s_partial[i];
+        }
+        else
+        {
+            y[row_begin + i] = fma(beta, y[row_begin + i], s_partial[i]);
+        }
+    }
+
+    // Carry-out of the partition
+    if(tid == BLOCKSIZE - 1)
+    {
+        carry_row[bid] = row_begin + s_key[tid];
+        carry_val[bid] = s_sum[tid];
+    }
+}
+
+// Add the carry-outs of rows that span multiple partitions. Carry-outs have been reduced
+// by row beforehand, thus each row is updated by exactly one thread.
+template <typename T, rocsparse_int BLOCKSIZE>
+__global__ void csrmvn_merge_fixup_kernel(rocsparse_int m,
+                                          const rocsparse_int* __restrict__ nruns,
+                                          const rocsparse_int* __restrict__ carry_row,
+                                          const T* __restrict__ carry_val,
+                                          T* __restrict__ y)
+{
+    rocsparse_int run = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(run >= *nruns)
+    {
+        return;
+    }
+
+    rocsparse_int row = carry_row[run];
+
+    // Rows beyond m are carry-outs of the trailing partition
+    if(row < m)
+    {
+        y[row] += carry_val[run];
+    }
+}
+
+// Scale y = beta * y, required prior to the scatter of the transposed product
+template <typename T>
+static __device__ void csrmvt_scale_device(rocsparse_int size, T beta, T* __restrict__ y)
+{
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    if(beta == static_cast<T>(0))
+    {
+        y[gid] = static_cast<T>(0);
+    }
+    else
+    {
+        y[gid] *= beta;
+    }
+}
+
+// Transposed product y += alpha * A^T * x, each row of A is scattered into y
+template <typename T, typename A, rocsparse_int WF_SIZE>
+static __device__ void csrmvt_general_device(rocsparse_int m,
+                                             T alpha,
+                                             const rocsparse_int* __restrict__ row_offset,
+                                             const rocsparse_int* __restrict__ csr_col_ind,
+                                             const A* __restrict__ csr_val,
+                                             const T* __restrict__ x,
+                                             T* __restrict__ y,
+                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T val = alpha * __ldg(x + row);
+
+        // Rows without contribution can be skipped
+        if(val == static_cast<T>(0))
+        {
+            continue;
+        }
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            atomic_add(&y[csr_col_ind[j] - idx_base], val * csr_val[j]);
+        }
+    }
+}
+
+// Transposed product y = alpha * A^T * x + beta * y using the cached transpose of A,
+// values are gathered from the CSR values through the permutation csc_perm
+template <typename T, typename A, rocsparse_int WF_SIZE>
+static __device__ void csrmvt_transpose_device(rocsparse_int n,
+                                               T alpha,
+                                               const rocsparse_int* __restrict__ csc_col_ptr,
+                                               const rocsparse_int* __restrict__ csc_row_ind,
+                                               const rocsparse_int* __restrict__ csc_perm,
+                                               const A* __restrict__ csr_val,
+                                               const T* __restrict__ x,
+                                               T beta,
+                                               T* __restrict__ y,
+                                               rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over columns
+    for(rocsparse_int col = gid / WF_SIZE; col < n; col += nwf)
+    {
+        // Each wavefront processes one column
+        rocsparse_int col_start = csc_col_ptr[col] - idx_base;
+        rocsparse_int col_end   = csc_col_ptr[col + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = col_start + lid; j < col_end; j += WF_SIZE)
+        {
+            sum = fma(alpha * csr_val[csc_perm[j]], __ldg(x + csc_row_ind[j] - idx_base), sum);
+        }
+
+        // Obtain column sum using parallel reduction
+        sum = wf_reduce<WF_SIZE>(sum);
+
+        // First thread of each wavefront writes result into global memory
+        if(lid == 0)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                y[col] = sum;
+            }
+            else
+            {
+                y[col] = fma(beta, y[col], sum);
+            }
+        }
+    }
+}
+
+// Gather the row indices of the transpose, csc_row_ind[j] = coo_row_ind[csc_perm[j]]
+template <rocsparse_int BLOCKSIZE>
+__global__ void csrmvt_transpose_permute_kernel(rocsparse_int nnz,
+                                                const rocsparse_int* __restrict__ coo_row_ind,
+                                                const rocsparse_int* __restrict__ csc_perm,
+                                                rocsparse_int* __restrict__ csc_row_ind)
+{
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    csc_row_ind[gid] = coo_row_ind[csc_perm[gid]];
+}
+
+// Symmetric product y += alpha * A * x, where only one triangle of A is stored. Each
+// row of the triangle is gathered into y[row] and its off-diagonal entries are
+// scattered into y[col], such that the triangle is read only once. Hermitian matrices
+// scatter the conjugate of the stored entries. y has to be scaled by beta in advance.
+template <typename T, typename A, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_symm_general_device(rocsparse_int m,
+                                                  T alpha,
+                                                  const rocsparse_int* __restrict__ row_offset,
+                                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                                  const A* __restrict__ csr_val,
+                                                  const T* __restrict__ x,
+                                                  T* __restrict__ y,
+                                                  bool hermitian,
+                                                  rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T xr  = alpha * __ldg(x + row);
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+            T val             = csr_val[j];
+
+            sum = fma(alpha * val, __ldg(x + col), sum);
+
+            // Mirrored entry of the triangle that is not stored
+            if(col != row)
+            {
+                atomic_add(&y[col], (hermitian ? rocsparse_conj(val) : val) * xr);
+            }
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = wf_reduce<WF_SIZE>(sum);
+
+        // First thread of each wavefront adds the result, other rows may scatter into it
+        if(lid == 0)
+        {
+            atomic_add(&y[row], sum);
+        }
+    }
+}
+
+// Scatter the off-diagonal entries of the stored triangle of a symmetric matrix,
+// y += alpha * (A - D)^T * x, or y += alpha * (A - D)^H * x for a hermitian matrix.
+// The stored triangle itself has been processed by the row based kernels before.
+template <typename T, typename A, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_symm_scatter_device(rocsparse_int m,
+                                                  T alpha,
+                                                  const rocsparse_int* __restrict__ row_offset,
+                                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                                  const A* __restrict__ csr_val,
+                                                  const T* __restrict__ x,
+                                                  T* __restrict__ y,
+                                                  bool hermitian,
+                                                  rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T xr = alpha * __ldg(x + row);
+
+        // Rows without contribution can be skipped
+        if(xr == static_cast<T>(0))
+        {
+            continue;
+        }
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            if(col != row)
+            {
+                T val = csr_val[j];
+
+                atomic_add(&y[col], (hermitian ? rocsparse_conj(val) : val) * xr);
+            }
+        }
+    }
+}
+
+// Multi-vector product Y = alpha * A * X + beta * Y with k <= K right-hand sides. X and Y
+// are stored interleaved, such that the k entries of a row are contiguous, e.g.
+// x[col * k + v]. Each non-zero entry of A is read once and multiplied with the k
+// entries of the corresponding row of X, accumulating into K registers.
+template <typename T, rocsparse_int K>
+static __device__ void csrmvn_multi_accumulate(rocsparse_int k,
+                                               rocsparse_int start,
+                                               rocsparse_int end,
+                                               rocsparse_int stride,
+                                               T alpha,
+                                               const rocsparse_int* __restrict__ csr_col_ind,
+                                               const T* __restrict__ csr_val,
+                                               const T* __restrict__ x,
+                                               T* sum,
+                                               rocsparse_index_base idx_base)
+{
+    for(rocsparse_int j = start; j < end; j += stride)
+    {
+        const T* xrow = x + (csr_col_ind[j] - idx_base) * k;
+        T val         = alpha * csr_val[j];
+
+#pragma unroll
+        for(rocsparse_int v = 0; v < K; ++v)
+        {
+            if(v < k)
+            {
+                sum[v] = fma(val, __ldg(xrow + v), sum[v]);
+            }
+        }
+    }
+}
+
+// Reduce the K partial sums of nthreads adjacent threads, where nthreads is a power of
+// two. The first thread of each group ends up with the row sums.
+template <typename T, rocsparse_int K, rocsparse_int WG_SIZE>
+static __device__ void csrmvn_multi_reduce(T* sum,
+                                           T* partialSums,
+                                           rocsparse_int lid,
+                                           rocsparse_int nthreads)
+{
+    __syncthreads();
+
+#pragma unroll
+    for(rocsparse_int v = 0; v < K; ++v)
+    {
+        partialSums[v * WG_SIZE + lid] = sum[v];
+    }
+
+    for(rocsparse_int i = nthreads >> 1; i > 0; i >>= 1)
+    {
+        __syncthreads();
+
+        if((lid & (nthreads - 1)) < i)
+        {
+#pragma unroll
+            for(rocsparse_int v = 0; v < K; ++v)
+            {
+                sum[v] += partialSums[v * WG_SIZE + lid + i];
+                partialSums[v * WG_SIZE + lid] = sum[v];
+            }
+        }
+    }
+}
+
+// Write the k row sums, y[row * k + v] = sum[v] + beta * y[row * k + v]
+template <typename T, rocsparse_int K>
+static __device__ void
+    csrmvn_multi_write(rocsparse_int k, rocsparse_int row, const T* sum, T beta, T* y)
+{
+#pragma unroll
+    for(rocsparse_int v = 0; v < K; ++v)
+    {
+        if(v < k)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                y[row * k + v] = sum[v];
+            }
+            else
+            {
+                y[row * k + v] = fma(beta, y[row * k + v], sum[v]);
+            }
+        }
+    }
+}
+
+// Multi-vector product without row blocks, each wavefront of size WF_SIZE processes one
+// row and reduces its K sums
+template <typename T, rocsparse_int K, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_multi_general_device(rocsparse_int m,
+                                                   rocsparse_int k,
+                                                   T alpha,
+                                                   const rocsparse_int* __restrict__ row_offset,
+                                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                                   const T* __restrict__ csr_val,
+                                                   const T* __restrict__ x,
+                                                   T beta,
+                                                   T* __restrict__ y,
+                                                   rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        T sum[K];
+
+#pragma unroll
+        for(rocsparse_int v = 0; v < K; ++v)
+        {
+            sum[v] = static_cast<T>(0);
+        }
+
+        // Loop over non-zero elements
+        csrmvn_multi_accumulate<T, K>(k,
+                                      row_offset[row] - idx_base + lid,
+                                      row_offset[row + 1] - idx_base,
+                                      WF_SIZE,
+                                      alpha,
+                                      csr_col_ind,
+                                      csr_val,
+                                      x,
+                                      sum,
+                                      idx_base);
+
+        // Obtain row sums using parallel reduction
+#pragma unroll
+        for(rocsparse_int v = 0; v < K; ++v)
+        {
+            sum[v] = wf_reduce<WF_SIZE>(sum[v]);
+        }
+
+        // First thread of each wavefront writes result into global memory
+        if(lid == 0)
+        {
+            csrmvn_multi_write<T, K>(k, row, sum, beta, y);
+        }
+    }
+}
+
+// Multi-vector product using the CSR-Adaptive row blocks, see csrmvn_adaptive_device()
+// for the row block encoding. Short rows of a row block are processed by groups of
+// threads (the group size is stored in the row block), single rows by the whole
+// workgroup and long rows by multiple workgroups that accumulate into y atomically.
+template <typename T,
+          rocsparse_int K,
+          rocsparse_int BLOCKSIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_BITS,
+          rocsparse_int ROW_BITS,
+          rocsparse_int WG_SIZE>
+__device__ void csrmvn_multi_adaptive_device(rocsparse_int k,
+                                             unsigned long long* row_blocks,
+                                             T alpha,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             const T* csr_val,
+                                             const T* x,
+                                             T beta,
+                                             T* y,
+                                             rocsparse_index_base idx_base)
+{
+    __shared__ T partialSums[K * WG_SIZE];
+    rocsparse_int gid = hipBlockIdx_x;
+    rocsparse_int lid = hipThreadIdx_x;
+
+    rocsparse_int row = ((row_blocks[gid] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
+    rocsparse_int stop_row =
+        ((row_blocks[gid + 1] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
+    rocsparse_int num_rows = stop_row - row;
+
+    // Get the workgroup within this long row ID out of the bottom bits of the row block.
+    rocsparse_int wg = row_blocks[gid] & ((1 << WG_BITS) - 1);
+
+    T sum[K];
+
+    if(num_rows > ROWS_FOR_VECTOR)
+    {
+        // CSR-Stream row block. Groups of nthreads threads reduce one row each, the
+        // group size has been computed on the host.
+        rocsparse_int nthreads = (wg > 1) ? wg : 1;
+        rocsparse_int nrows    = WG_SIZE >> (31 - __clz(nthreads));
+        rocsparse_int tig      = lid & (nthreads - 1);
+
+        for(rocsparse_int first_row = row; first_row < stop_row; first_row += nrows)
+        {
+            rocsparse_int local_row = first_row + (lid >> (31 - __clz(nthreads)));
+
+#pragma unroll
+            for(rocsparse_int v = 0; v < K; ++v)
+            {
+                sum[v] = static_cast<T>(0);
+            }
+
+            if(local_row < stop_row)
+            {
+                csrmvn_multi_accumulate<T, K>(k,
+                                              csr_row_ptr[local_row] - idx_base + tig,
+                                              csr_row_ptr[local_row + 1] - idx_base,
+                                              nthreads,
+                                              alpha,
+                                              csr_col_ind,
+                                              csr_val,
+                                              x,
+                                              sum,
+                                              idx_base);
+            }
+
+            csrmvn_multi_reduce<T, K, WG_SIZE>(sum, partialSums, lid, nthreads);
+
+            if(tig == 0 && local_row < stop_row)
+            {
+                csrmvn_multi_write<T, K>(k, local_row, sum, beta, y);
+            }
+        }
+    }
+    else if(num_rows >= 1 && !wg)
+    {
+        // CSR-Vector row block, the whole workgroup processes each row
+        for(; row < stop_row; ++row)
+        {
+#pragma unroll
+            for(rocsparse_int v = 0; v < K; ++v)
+            {
+                sum[v] = static_cast<T>(0);
+            }
+
+            csrmvn_multi_accumulate<T, K>(k,
+                                          csr_row_ptr[row] - idx_base + lid,
+                                          csr_row_ptr[row + 1] - idx_base,
+                                          WG_SIZE,
+                                          alpha,
+                                          csr_col_ind,
+                                          csr_val,
+                                          x,
+                                          sum,
+                                          idx_base);
+
+            csrmvn_multi_reduce<T, K, WG_SIZE>(sum, partialSums, lid, WG_SIZE);
+
+            if(lid == 0)
+            {
+                csrmvn_multi_write<T, K>(k, row, sum, beta, y);
+            }
+        }
+    }
+    else
+    {
+        // CSR-LongRows, multiple workgroups process this row. The flag protocol has to
+        // match csrmvn_adaptive_device(), as both kernels share the same row blocks.
+        rocsparse_int vecStart =
+            rocsparse_mad24(wg, BLOCK_MULTIPLIER * BLOCKSIZE, csr_row_ptr[row] - idx_base);
+        rocsparse_int vecEnd =
+            ((csr_row_ptr[row + 1] - idx_base) > vecStart + BLOCK_MULTIPLIER * BLOCKSIZE)
+                ? vecStart + BLOCK_MULTIPLIER * BLOCKSIZE
+                : (csr_row_ptr[row + 1] - idx_base);
+
+        rocsparse_int first_wg_in_row = gid - (row_blocks[gid] & ((1ULL << WG_BITS) - 1ULL));
+        rocsparse_int compare_value   = row_blocks[gid] & (1ULL << WG_BITS);
+
+#pragma unroll
+        for(rocsparse_int v = 0; v < K; ++v)
+        {
+            sum[v] = static_cast<T>(0);
+        }
+
+        // The first workgroup handles the output initialization.
+        if(gid == first_wg_in_row && lid == 0)
+        {
+#pragma unroll
+            for(rocsparse_int v = 0; v < K; ++v)
+            {
+                if(v < k)
+                {
+                    sum[v] = (beta - static_cast<T>(1)) * y[row * k + v];
+                }
+            }
+
+            atomicXor(&row_blocks[first_wg_in_row], (1ULL << WG_BITS));
+        }
+
+        __syncthreads();
+        while(
+            gid != first_wg_in_row && lid == 0 &&
+            ((atomicMax(&row_blocks[first_wg_in_row], 0ULL) & (1ULL << WG_BITS)) == compare_value))
+            ;
+        __syncthreads();
+
+        if(gid != first_wg_in_row && lid == 0)
+            row_blocks[gid] ^= (1ULL << WG_BITS);
+
+        csrmvn_multi_accumulate<T, K>(
+            k, vecStart + lid, vecEnd, WG_SIZE, alpha, csr_col_ind, csr_val, x, sum, idx_base);
+
+        csrmvn_multi_reduce<T, K, WG_SIZE>(sum, partialSums, lid, WG_SIZE);
+
+        if(lid == 0)
+        {
+#pragma unroll
+            for(rocsparse_int v = 0; v < K; ++v)
+            {
+                if(v < k)
+                {
+                    atomic_add(&y[row * k + v], sum[v]);
+                }
+            }
+        }
+    }
+}
+
 #endif // CSRMV_DEVICE_H
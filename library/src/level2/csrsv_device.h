@@ -25,6 +25,8 @@
 #ifndef CSRSV_DEVICE_H
 #define CSRSV_DEVICE_H
 
+#include "common.h"
+
 #include <hip/hip_runtime.h>
 
 // Compute intra wavefront maximum and spin summation
@@ -104,7 +106,7 @@ __global__ void csrsv_analysis_kernel(rocsparse_int m,
                                       rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
     rocsparse_int lid = tid & (WF_SIZE - 1);
     rocsparse_int row = gid / WF_SIZE;
 
@@ -217,6 +219,160 @@ __global__ void csrsv_analysis_kernel(rocsparse_int m,
     }
 }
 
+// Count the dependencies of each row of op(A) = A^T, which are the off-diagonal
+// entries of the corresponding column in the triangular part of A
+template <rocsparse_int WF_SIZE, rocsparse_fill_mode FILL_MODE>
+__global__ void csrsv_transpose_count_kernel(rocsparse_int m,
+                                             const rocsparse_int* __restrict__ csr_row_ptr,
+                                             const rocsparse_int* __restrict__ csr_col_ind,
+                                             rocsparse_int* __restrict__ csr_diag_ind,
+                                             rocsparse_int* __restrict__ in_degree,
+                                             rocsparse_int* __restrict__ max_nnz,
+                                             rocsparse_int* __restrict__ zero_pivot,
+                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int row = gid / WF_SIZE;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Initialize matrix diagonal index
+    if(lid == 0)
+    {
+        csr_diag_ind[row] = -1;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+
+        // Store diagonal index
+        if(local_col == row)
+        {
+            csr_diag_ind[row] = j;
+        }
+
+        // Row local_col of op(A) depends on this row
+        if((FILL_MODE == rocsparse_fill_mode_lower && local_col < row) ||
+           (FILL_MODE == rocsparse_fill_mode_upper && local_col > row))
+        {
+            atomicAdd(&in_degree[local_col], 1);
+        }
+    }
+
+    if(lid == 0)
+    {
+        atomicMax(max_nnz, row_end - row_begin);
+
+        if(csr_diag_ind[row] == -1)
+        {
+            // We are looking for the first zero pivot
+            atomicMin(zero_pivot, row + idx_base);
+        }
+    }
+}
+
+// Sync-free analysis of op(A) = A^T. Each row of A waits until all of its
+// dependencies have been resolved, i.e. its in degree dropped to zero, and then
+// pushes its depth to all rows of op(A) that depend on it. The done array holds
+// the maximum depth of the resolved dependencies of each row.
+template <rocsparse_int WF_SIZE, rocsparse_fill_mode FILL_MODE>
+__global__ void csrsv_transpose_analysis_kernel(rocsparse_int m,
+                                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                                const rocsparse_int* __restrict__ csr_col_ind,
+                                                rocsparse_int* __restrict__ in_degree,
+                                                rocsparse_int* __restrict__ done_array,
+                                                rocsparse_int* __restrict__ rows_per_level,
+                                                rocsparse_int* __restrict__ max_depth,
+                                                unsigned long long* __restrict__ total_spin,
+                                                rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int row = gid / WF_SIZE;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // The transpose of a lower triangular matrix is upper triangular, thus we
+    // need to access with reverse index
+    if(FILL_MODE == rocsparse_fill_mode_lower)
+    {
+        row = m - 1 - row;
+    }
+
+    rocsparse_int local_spin = 0;
+
+// Spin loop until all dependencies have been resolved
+#if defined(__HIP_PLATFORM_HCC__)
+    while(__atomic_load_n(&in_degree[row], __ATOMIC_ACQUIRE))
+    {
+        ++local_spin;
+    }
+
+    rocsparse_int local_depth = __atomic_load_n(&done_array[row], __ATOMIC_ACQUIRE) + 1;
+#elif defined(__HIP_PLATFORM_NVCC__)
+    while(atomicOr(&in_degree[row], 0))
+    {
+        ++local_spin;
+    }
+
+    rocsparse_int local_depth = atomicOr(&done_array[row], 0) + 1;
+#endif
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Push the depth to all dependent rows
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+
+        if((FILL_MODE == rocsparse_fill_mode_lower && local_col < row) ||
+           (FILL_MODE == rocsparse_fill_mode_upper && local_col > row))
+        {
+            atomicMax(&done_array[local_col], local_depth);
+        }
+    }
+
+    // Depths must be visible before the dependencies are resolved
+    __threadfence();
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+
+        if((FILL_MODE == rocsparse_fill_mode_lower && local_col < row) ||
+           (FILL_MODE == rocsparse_fill_mode_upper && local_col > row))
+        {
+            atomicSub(&in_degree[local_col], 1);
+        }
+    }
+
+    if(lid == 0)
+    {
+        // All dependencies have been pushed, the depth of this row is final
+        done_array[row] = local_depth;
+
+        atomicAdd(&rows_per_level[local_depth - 1], 1);
+        atomicMax(max_depth, local_depth);
+        atomicAdd(total_spin, local_spin);
+    }
+}
+
 #if defined(__HIP_PLATFORM_HCC__)
 // While HIP does not contain llvm intrinsics
 __device__ int __llvm_amdgcn_readlane(int index, int offset) __asm("llvm.amdgcn.readlane");
@@ -348,6 +504,14 @@ static __device__ __inline__ T wf_reduce(T temp_sum)
 }
 #endif
 
+// Intra wavefront reduction sum of complex numbers, real and imaginary part are
+// reduced separately
+template <rocsparse_int WF_SIZE, typename T>
+static __device__ __inline__ rocsparse_complex_num<T> wf_reduce(rocsparse_complex_num<T> temp_sum)
+{
+    return rocsparse_complex_num<T>(wf_reduce<WF_SIZE>(temp_sum.x), wf_reduce<WF_SIZE>(temp_sum.y));
+}
+
 template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
 __device__ void csrsv_device(rocsparse_int m,
                              T alpha,
@@ -365,7 +529,7 @@ __device__ void csrsv_device(rocsparse_int m,
                              rocsparse_diag_type diag_type)
 {
     rocsparse_int tid = hipThreadIdx_x;
-    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + tid;
     rocsparse_int lid = tid & (WF_SIZE - 1);
     rocsparse_int wid = tid / WF_SIZE;
 
@@ -474,14 +638,13 @@ __device__ void csrsv_device(rocsparse_int m,
 
 // Load y value bypassing caches
 #if defined(__HIP_PLATFORM_HCC__)
-        T out_val;
-        __atomic_load(&y[local_col], &out_val, __ATOMIC_ACQUIRE);
+        T out_val = rocsparse_atomic_load(&y[local_col], __ATOMIC_ACQUIRE);
 #elif defined(__HIP_PLATFORM_NVCC__)
         T out_val = y[local_col];
 #endif
 
         // Local sum computation for each lane
-        local_sum -= local_val * out_val;
+        local_sum = rocsparse_fma(-local_val, out_val, local_sum);
     }
 
     // Gather all local sums for each lane
@@ -498,7 +661,7 @@ __device__ void csrsv_device(rocsparse_int m,
     {
 // Lane 0 writes the "row is done" flag and stores the rows result in y
 #if defined(__HIP_PLATFORM_HCC__)
-        __atomic_store(&y[row], &local_sum, __ATOMIC_RELEASE);
+        rocsparse_atomic_store(&y[row], local_sum, __ATOMIC_RELEASE);
         __atomic_store_n(&done_array[row], 1, __ATOMIC_RELEASE);
 #elif defined(__HIP_PLATFORM_NVCC__)
         y[row]    = local_sum;
@@ -507,4 +670,158 @@ __device__ void csrsv_device(rocsparse_int m,
     }
 }
 
+template <typename T>
+__device__ void csrsv_transpose_init_device(rocsparse_int m,
+                                            T alpha,
+                                            const T* __restrict__ x,
+                                            T* __restrict__ y)
+{
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(gid >= m)
+    {
+        return;
+    }
+
+    y[gid] = alpha * x[gid];
+}
+
+// Solves op(A) * y = alpha * x with op(A) = A^T or op(A) = A^H, without transposing
+// A. Each wavefront processes a single row of A, once all of its dependencies have
+// been resolved, and pushes its solution to all rows of op(A) that depend on it.
+// Thus, y accumulates the updates and has to be initialized with alpha * x.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_transpose_kernel(rocsparse_int m,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                const T* __restrict__ csr_val,
+                                const rocsparse_int* __restrict__ csr_diag_ind,
+                                T* __restrict__ y,
+                                rocsparse_int* __restrict__ in_degree,
+                                rocsparse_int* __restrict__ map,
+                                rocsparse_int offset,
+                                rocsparse_int* __restrict__ zero_pivot,
+                                rocsparse_operation trans,
+                                rocsparse_index_base idx_base,
+                                rocsparse_fill_mode fill_mode,
+                                rocsparse_diag_type diag_type)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+
+    // Conjugate entries of A for op(A) = A^H
+    bool conj = (trans == rocsparse_operation_conjugate_transpose);
+
+    // Index into the row map
+    rocsparse_int idx = gid / WF_SIZE;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Get the row this wavefront will operate on
+    rocsparse_int row = map[idx + offset];
+
+// Spin loop until all dependencies have been resolved
+#if defined(__HIP_PLATFORM_HCC__)
+    while(__atomic_load_n(&in_degree[row], __ATOMIC_ACQUIRE))
+        ;
+
+    // Load accumulated value bypassing caches
+    T local_sum = rocsparse_atomic_load(&y[row], __ATOMIC_ACQUIRE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+    while(atomicOr(&in_degree[row], 0))
+        ;
+
+    T local_sum = y[row];
+#endif
+
+    // If we have non unit diagonal, take the diagonal into account
+    if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        rocsparse_int diag = csr_diag_ind[row];
+
+        // Structural zero pivots have been found during analysis
+        if(diag != -1)
+        {
+            T diag_val = conj ? rocsparse_conj(csr_val[diag]) : csr_val[diag];
+
+            // Check for numerical zero
+            if(diag_val == static_cast<T>(0))
+            {
+                // Numerical zero pivot found, avoid division by 0
+                // and store index for later use.
+                if(lid == 0)
+                {
+                    atomicMin(zero_pivot, row + idx_base);
+                }
+
+                diag_val = static_cast<T>(1);
+            }
+
+            local_sum *= static_cast<T>(1) / diag_val;
+        }
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Push the solution to all dependent rows
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+
+        if((fill_mode == rocsparse_fill_mode_lower && local_col < row) ||
+           (fill_mode == rocsparse_fill_mode_upper && local_col > row))
+        {
+            T local_val = conj ? rocsparse_conj(csr_val[j]) : csr_val[j];
+
+            rocsparse_atomic_add(&y[local_col], -local_val * local_sum);
+        }
+    }
+
+    // Updates must be visible before the dependencies are resolved
+    __threadfence();
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+
+        if((fill_mode == rocsparse_fill_mode_lower && local_col < row) ||
+           (fill_mode == rocsparse_fill_mode_upper && local_col > row))
+        {
+            atomicSub(&in_degree[local_col], 1);
+        }
+    }
+
+    if(lid == 0)
+    {
+        // No other row updates y[row] anymore
+        y[row] = local_sum;
+    }
+}
+
+// Reset the zero pivot to none, at the full width of T
+template <typename T>
+__global__ void csrtr_zero_pivot_init_kernel(T none, T* __restrict__ zero_pivot)
+{
+    *zero_pivot = none;
+}
+
+// Write the zero pivot to position, or -1 if no zero pivot has been found
+template <typename T>
+__global__ void csrtr_zero_pivot_kernel(T none,
+                                        const T* __restrict__ zero_pivot,
+                                        T* __restrict__ position)
+{
+    T pivot = *zero_pivot;
+
+    *position = (pivot == none) ? -1 : pivot;
+}
+
 #endif // CSRSV_DEVICE_H
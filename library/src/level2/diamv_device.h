@@ -0,0 +1,102 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef DIAMV_DEVICE_H
+#define DIAMV_DEVICE_H
+
+#include "common.h"
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// DIA SpMV for general, non-transposed matrices. Each thread processes one row,
+// such that a wavefront reads contiguous values of a diagonal and a contiguous
+// range of x. The diagonal offsets are uniform across the block and are staged
+// through LDS, chunk by chunk.
+template <typename T, rocsparse_int BLOCKSIZE>
+static __device__ void diamvn_device(rocsparse_int m,
+                                     rocsparse_int n,
+                                     rocsparse_int ndiag,
+                                     T alpha,
+                                     const rocsparse_int* dia_offset,
+                                     const T* dia_val,
+                                     const T* x,
+                                     T beta,
+                                     T* y)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + tid;
+
+    __shared__ rocsparse_int sdata[BLOCKSIZE];
+
+    T sum = static_cast<T>(0);
+
+    // All threads of the block take part in loading the offsets, even if their
+    // row is out of bounds
+    for(rocsparse_int chunk = 0; chunk < ndiag; chunk += BLOCKSIZE)
+    {
+        __syncthreads();
+
+        if(chunk + tid < ndiag)
+        {
+            sdata[tid] = dia_offset[chunk + tid];
+        }
+
+        __syncthreads();
+
+        if(row >= m)
+        {
+            continue;
+        }
+
+        rocsparse_int chunk_end = min(BLOCKSIZE, ndiag - chunk);
+
+        for(rocsparse_int k = 0; k < chunk_end; ++k)
+        {
+            rocsparse_int col = row + sdata[k];
+
+            if(col >= 0 && col < n)
+            {
+                sum = rocsparse_fma(
+                    dia_val[DIA_IND(row, chunk + k, m)], rocsparse_ldg(x + col), sum);
+            }
+        }
+    }
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    if(beta != static_cast<T>(0))
+    {
+        y[row] = rocsparse_fma(beta, y[row], alpha * sum);
+    }
+    else
+    {
+        y[row] = alpha * sum;
+    }
+}
+
+#endif // DIAMV_DEVICE_H
@@ -25,18 +25,19 @@
 #ifndef ELLMV_DEVICE_H
 #define ELLMV_DEVICE_H
 
+#include "common.h"
 #include "handle.h"
 
 #include <hip/hip_runtime.h>
 
 // ELL SpMV for general, non-transposed matrices
-template <typename T>
+template <typename T, typename A>
 static __device__ void ellmvn_device(rocsparse_int m,
                                      rocsparse_int n,
                                      rocsparse_int ell_width,
                                      T alpha,
                                      const rocsparse_int* ell_col_ind,
-                                     const T* ell_val,
+                                     const A* ell_val,
                                      const T* x,
                                      T beta,
                                      T* y,
@@ -57,7 +58,7 @@ static __device__ void ellmvn_device(rocsparse_int m,
 
         if(col >= 0 && col < n)
         {
-            sum = fma(ell_val[idx], __ldg(x + col), sum);
+            sum = rocsparse_fma(ell_val[idx], rocsparse_ldg(x + col), sum);
         }
         else
         {
@@ -67,7 +68,7 @@ static __device__ void ellmvn_device(rocsparse_int m,
 
     if(beta != static_cast<T>(0))
     {
-        y[ai] = fma(beta, y[ai], alpha * sum);
+        y[ai] = rocsparse_fma(beta, y[ai], alpha * sum);
     }
     else
     {
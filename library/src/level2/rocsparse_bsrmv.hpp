@@ -0,0 +1,558 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_BSRMV_HPP
+#define ROCSPARSE_BSRMV_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "grid.h"
+#include "bsrmv_device.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int BSR_BLOCK_DIM, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmvn_kernel_host_pointer(rocsparse_direction dir,
+                                    rocsparse_int mb,
+                                    T alpha,
+                                    const rocsparse_int* __restrict__ bsr_row_ptr,
+                                    const rocsparse_int* __restrict__ bsr_col_ind,
+                                    const T* __restrict__ bsr_val,
+                                    const T* __restrict__ x,
+                                    T beta,
+                                    T* __restrict__ y,
+                                    rocsparse_index_base idx_base)
+{
+    bsrmvn_device<T, BLOCKSIZE, BSR_BLOCK_DIM, WF_SIZE>(
+        dir, mb, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, beta, y, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int BSR_BLOCK_DIM, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmvn_kernel_device_pointer(rocsparse_direction dir,
+                                      rocsparse_int mb,
+                                      const T* alpha,
+                                      const rocsparse_int* __restrict__ bsr_row_ptr,
+                                      const rocsparse_int* __restrict__ bsr_col_ind,
+                                      const T* __restrict__ bsr_val,
+                                      const T* __restrict__ x,
+                                      const T* beta,
+                                      T* __restrict__ y,
+                                      rocsparse_index_base idx_base)
+{
+    bsrmvn_device<T, BLOCKSIZE, BSR_BLOCK_DIM, WF_SIZE>(
+        dir, mb, *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, *beta, y, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmvn_general_kernel_host_pointer(rocsparse_direction dir,
+                                            rocsparse_int mb,
+                                            T alpha,
+                                            const rocsparse_int* __restrict__ bsr_row_ptr,
+                                            const rocsparse_int* __restrict__ bsr_col_ind,
+                                            const T* __restrict__ bsr_val,
+                                            rocsparse_int block_dim,
+                                            const T* __restrict__ x,
+                                            T beta,
+                                            T* __restrict__ y,
+                                            rocsparse_index_base idx_base)
+{
+    bsrmvn_general_device<T, BLOCKSIZE, WF_SIZE>(
+        dir, mb, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, block_dim, x, beta, y, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmvn_general_kernel_device_pointer(rocsparse_direction dir,
+                                              rocsparse_int mb,
+                                              const T* alpha,
+                                              const rocsparse_int* __restrict__ bsr_row_ptr,
+                                              const rocsparse_int* __restrict__ bsr_col_ind,
+                                              const T* __restrict__ bsr_val,
+                                              rocsparse_int block_dim,
+                                              const T* __restrict__ x,
+                                              const T* beta,
+                                              T* __restrict__ y,
+                                              rocsparse_index_base idx_base)
+{
+    bsrmvn_general_device<T, BLOCKSIZE, WF_SIZE>(
+        dir, mb, *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, block_dim, x, *beta, y, idx_base);
+}
+
+#define BSRMVN_DIM 128
+
+template <typename T, rocsparse_int BSR_BLOCK_DIM, rocsparse_int WF_SIZE>
+static rocsparse_status rocsparse_bsrmvn_launch(rocsparse_handle handle,
+                                                rocsparse_direction dir,
+                                                rocsparse_int mb,
+                                                const T* alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T* bsr_val,
+                                                const rocsparse_int* bsr_row_ptr,
+                                                const rocsparse_int* bsr_col_ind,
+                                                const T* x,
+                                                const T* beta,
+                                                T* y)
+{
+    // One sub-wavefront per block row
+    dim3 bsrmvn_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_grid_dim(static_cast<int64_t>(WF_SIZE) * mb, BSRMVN_DIM, bsrmvn_blocks));
+    dim3 bsrmvn_threads(BSRMVN_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((bsrmvn_kernel_device_pointer<T, BSRMVN_DIM, BSR_BLOCK_DIM, WF_SIZE>),
+                           bsrmvn_blocks,
+                           bsrmvn_threads,
+                           0,
+                           handle->stream,
+                           dir,
+                           mb,
+                           alpha,
+                           bsr_row_ptr,
+                           bsr_col_ind,
+                           bsr_val,
+                           x,
+                           beta,
+                           y,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((bsrmvn_kernel_host_pointer<T, BSRMVN_DIM, BSR_BLOCK_DIM, WF_SIZE>),
+                           bsrmvn_blocks,
+                           bsrmvn_threads,
+                           0,
+                           handle->stream,
+                           dir,
+                           mb,
+                           *alpha,
+                           bsr_row_ptr,
+                           bsr_col_ind,
+                           bsr_val,
+                           x,
+                           *beta,
+                           y,
+                           descr->base);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+static rocsparse_status rocsparse_bsrmvn_general_launch(rocsparse_handle handle,
+                                                        rocsparse_direction dir,
+                                                        rocsparse_int mb,
+                                                        const T* alpha,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T* bsr_val,
+                                                        const rocsparse_int* bsr_row_ptr,
+                                                        const rocsparse_int* bsr_col_ind,
+                                                        rocsparse_int block_dim,
+                                                        const T* x,
+                                                        const T* beta,
+                                                        T* y)
+{
+    // One sub-wavefront per row
+    dim3 bsrmvn_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(
+        static_cast<int64_t>(WF_SIZE) * mb * block_dim, BSRMVN_DIM, bsrmvn_blocks));
+    dim3 bsrmvn_threads(BSRMVN_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((bsrmvn_general_kernel_device_pointer<T, BSRMVN_DIM, WF_SIZE>),
+                           bsrmvn_blocks,
+                           bsrmvn_threads,
+                           0,
+                           handle->stream,
+                           dir,
+                           mb,
+                           alpha,
+                           bsr_row_ptr,
+                           bsr_col_ind,
+                           bsr_val,
+                           block_dim,
+                           x,
+                           beta,
+                           y,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((bsrmvn_general_kernel_host_pointer<T, BSRMVN_DIM, WF_SIZE>),
+                           bsrmvn_blocks,
+                           bsrmvn_threads,
+                           0,
+                           handle->stream,
+                           dir,
+                           mb,
+                           *alpha,
+                           bsr_row_ptr,
+                           bsr_col_ind,
+                           bsr_val,
+                           block_dim,
+                           x,
+                           *beta,
+                           y,
+                           descr->base);
+    }
+
+    return rocsparse_status_success;
+}
+
+#undef BSRMVN_DIM
+
+// Pick the sub-wavefront size from the average number of blocks per block row
+template <typename T, rocsparse_int BSR_BLOCK_DIM>
+static rocsparse_status rocsparse_bsrmvn_dispatch(rocsparse_handle handle,
+                                                  rocsparse_direction dir,
+                                                  rocsparse_int mb,
+                                                  rocsparse_int nnzb,
+                                                  const T* alpha,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T* bsr_val,
+                                                  const rocsparse_int* bsr_row_ptr,
+                                                  const rocsparse_int* bsr_col_ind,
+                                                  const T* x,
+                                                  const T* beta,
+                                                  T* y)
+{
+    rocsparse_int nnzb_per_row = nnzb / mb;
+
+    if(nnzb_per_row < 8)
+    {
+        return rocsparse_bsrmvn_launch<T, BSR_BLOCK_DIM, 4>(
+            handle, dir, mb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, x, beta, y);
+    }
+    else if(nnzb_per_row < 16)
+    {
+        return rocsparse_bsrmvn_launch<T, BSR_BLOCK_DIM, 8>(
+            handle, dir, mb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, x, beta, y);
+    }
+    else if(nnzb_per_row < 32)
+    {
+        return rocsparse_bsrmvn_launch<T, BSR_BLOCK_DIM, 16>(
+            handle, dir, mb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, x, beta, y);
+    }
+    else
+    {
+        return rocsparse_bsrmvn_launch<T, BSR_BLOCK_DIM, 32>(
+            handle, dir, mb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, x, beta, y);
+    }
+}
+
+// Pick the sub-wavefront size from the average number of entries per row
+template <typename T>
+static rocsparse_status rocsparse_bsrmvn_general_dispatch(rocsparse_handle handle,
+                                                          rocsparse_direction dir,
+                                                          rocsparse_int mb,
+                                                          rocsparse_int nnzb,
+                                                          const T* alpha,
+                                                          const rocsparse_mat_descr descr,
+                                                          const T* bsr_val,
+                                                          const rocsparse_int* bsr_row_ptr,
+                                                          const rocsparse_int* bsr_col_ind,
+                                                          rocsparse_int block_dim,
+                                                          const T* x,
+                                                          const T* beta,
+                                                          T* y)
+{
+    int64_t nnz_per_row = static_cast<int64_t>(nnzb) * block_dim / mb;
+
+    if(nnz_per_row < 8)
+    {
+        return rocsparse_bsrmvn_general_launch<T, 4>(handle,
+                                                     dir,
+                                                     mb,
+                                                     alpha,
+                                                     descr,
+                                                     bsr_val,
+                                                     bsr_row_ptr,
+                                                     bsr_col_ind,
+                                                     block_dim,
+                                                     x,
+                                                     beta,
+                                                     y);
+    }
+    else if(nnz_per_row < 16)
+    {
+        return rocsparse_bsrmvn_general_launch<T, 8>(handle,
+                                                     dir,
+                                                     mb,
+                                                     alpha,
+                                                     descr,
+                                                     bsr_val,
+                                                     bsr_row_ptr,
+                                                     bsr_col_ind,
+                                                     block_dim,
+                                                     x,
+                                                     beta,
+                                                     y);
+    }
+    else if(nnz_per_row < 32)
+    {
+        return rocsparse_bsrmvn_general_launch<T, 16>(handle,
+                                                      dir,
+                                                      mb,
+                                                      alpha,
+                                                      descr,
+                                                      bsr_val,
+                                                      bsr_row_ptr,
+                                                      bsr_col_ind,
+                                                      block_dim,
+                                                      x,
+                                                      beta,
+                                                      y);
+    }
+    else
+    {
+        return rocsparse_bsrmvn_general_launch<T, 32>(handle,
+                                                      dir,
+                                                      mb,
+                                                      alpha,
+                                                      descr,
+                                                      bsr_val,
+                                                      bsr_row_ptr,
+                                                      bsr_col_ind,
+                                                      block_dim,
+                                                      x,
+                                                      beta,
+                                                      y);
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrmv_template(rocsparse_handle handle,
+                                          rocsparse_direction dir,
+                                          rocsparse_operation trans,
+                                          rocsparse_int mb,
+                                          rocsparse_int nb,
+                                          rocsparse_int nnzb,
+                                          const T* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const T* bsr_val,
+                                          const rocsparse_int* bsr_row_ptr,
+                                          const rocsparse_int* bsr_col_ind,
+                                          rocsparse_int block_dim,
+                                          const T* x,
+                                          const T* beta,
+                                          T* y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrmv"),
+                  dir,
+                  trans,
+                  mb,
+                  nb,
+                  nnzb,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr_val,
+                  (const void*&)bsr_row_ptr,
+                  (const void*&)bsr_col_ind,
+                  block_dim,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f bsrmv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--blockdim",
+                  block_dim,
+                  "--direction",
+                  dir,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrmv"),
+                  dir,
+                  trans,
+                  mb,
+                  nb,
+                  nnzb,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr_val,
+                  (const void*&)bsr_row_ptr,
+                  (const void*&)bsr_col_ind,
+                  block_dim,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check direction
+    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(bsr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0 || nnzb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+    }
+
+    // Block dimensions up to 8 are unrolled, such that the x segment of each block fits
+    // into registers
+    switch(block_dim)
+    {
+    case 2:
+        return rocsparse_bsrmvn_dispatch<T, 2>(
+            handle, dir, mb, nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, x, beta, y);
+    case 3:
+        return rocsparse_bsrmvn_dispatch<T, 3>(
+            handle, dir, mb, nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, x, beta, y);
+    case 4:
+        return rocsparse_bsrmvn_dispatch<T, 4>(
+            handle, dir, mb, nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, x, beta, y);
+    case 5:
+        return rocsparse_bsrmvn_dispatch<T, 5>(
+            handle, dir, mb, nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, x, beta, y);
+    case 6:
+        return rocsparse_bsrmvn_dispatch<T, 6>(
+            handle, dir, mb, nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, x, beta, y);
+    case 7:
+        return rocsparse_bsrmvn_dispatch<T, 7>(
+            handle, dir, mb, nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, x, beta, y);
+    case 8:
+        return rocsparse_bsrmvn_dispatch<T, 8>(
+            handle, dir, mb, nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, x, beta, y);
+    default:
+        return rocsparse_bsrmvn_general_dispatch<T>(handle,
+                                                    dir,
+                                                    mb,
+                                                    nnzb,
+                                                    alpha,
+                                                    descr,
+                                                    bsr_val,
+                                                    bsr_row_ptr,
+                                                    bsr_col_ind,
+                                                    block_dim,
+                                                    x,
+                                                    beta,
+                                                    y);
+    }
+}
+
+#endif // ROCSPARSE_BSRMV_HPP
@@ -51,61 +51,61 @@ coomv_scale_device_pointer(rocsparse_int size, const T* __restrict__ beta, T* __
     coomv_scale_device<T>(size, *beta, data);
 }
 
-template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+template <typename T, typename A, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
 __launch_bounds__(128) __global__
     void coomvn_wf_host_pointer(rocsparse_int nnz,
                                 rocsparse_int loops,
                                 T alpha,
                                 const rocsparse_int* __restrict__ coo_row_ind,
                                 const rocsparse_int* __restrict__ coo_col_ind,
-                                const T* __restrict__ coo_val,
+                                const A* __restrict__ coo_val,
                                 const T* __restrict__ x,
                                 T* __restrict__ y,
                                 rocsparse_int* __restrict__ row_block_red,
                                 T* __restrict__ val_block_red,
                                 rocsparse_index_base idx_base)
 {
-    coomvn_general_wf_reduce<T, BLOCKSIZE, WF_SIZE>(nnz,
-                                                    loops,
-                                                    alpha,
-                                                    coo_row_ind,
-                                                    coo_col_ind,
-                                                    coo_val,
-                                                    x,
-                                                    y,
-                                                    row_block_red,
-                                                    val_block_red,
-                                                    idx_base);
+    coomvn_general_wf_reduce<T, A, BLOCKSIZE, WF_SIZE>(nnz,
+                                                       loops,
+                                                       alpha,
+                                                       coo_row_ind,
+                                                       coo_col_ind,
+                                                       coo_val,
+                                                       x,
+                                                       y,
+                                                       row_block_red,
+                                                       val_block_red,
+                                                       idx_base);
 }
 
-template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+template <typename T, typename A, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
 __launch_bounds__(128) __global__
     void coomvn_wf_device_pointer(rocsparse_int nnz,
                                   rocsparse_int loops,
                                   const T* alpha,
                                   const rocsparse_int* __restrict__ coo_row_ind,
                                   const rocsparse_int* __restrict__ coo_col_ind,
-                                  const T* __restrict__ coo_val,
+                                  const A* __restrict__ coo_val,
                                   const T* __restrict__ x,
                                   T* __restrict__ y,
                                   rocsparse_int* __restrict__ row_block_red,
                                   T* __restrict__ val_block_red,
                                   rocsparse_index_base idx_base)
 {
-    coomvn_general_wf_reduce<T, BLOCKSIZE, WF_SIZE>(nnz,
-                                                    loops,
-                                                    *alpha,
-                                                    coo_row_ind,
-                                                    coo_col_ind,
-                                                    coo_val,
-                                                    x,
-                                                    y,
-                                                    row_block_red,
-                                                    val_block_red,
-                                                    idx_base);
+    coomvn_general_wf_reduce<T, A, BLOCKSIZE, WF_SIZE>(nnz,
+                                                       loops,
+                                                       *alpha,
+                                                       coo_row_ind,
+                                                       coo_col_ind,
+                                                       coo_val,
+                                                       x,
+                                                       y,
+                                                       row_block_red,
+                                                       val_block_red,
+                                                       idx_base);
 }
 
-template <typename T>
+template <typename T, typename A>
 rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
                                           rocsparse_operation trans,
                                           rocsparse_int m,
@@ -113,7 +113,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
                                           rocsparse_int nnz,
                                           const T* alpha,
                                           const rocsparse_mat_descr descr,
-                                          const T* coo_val,
+                                          const A* coo_val,
                                           const rocsparse_int* coo_row_ind,
                                           const rocsparse_int* coo_col_ind,
                                           const T* x,
@@ -134,7 +134,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcoomv"),
+                  replaceX<T, A>("rocsparse_Xcoomv"),
                   trans,
                   m,
                   n,
@@ -148,19 +148,23 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
                   *beta,
                   (const void*&)y);
 
-        log_bench(handle,
-                  "./rocsparse-bench -f coomv -r",
-                  replaceX<T>("X"),
-                  "--mtx <matrix.mtx> ",
-                  "--alpha",
-                  *alpha,
-                  "--beta",
-                  *beta);
+        // There is no benchmark for the mixed precision coomv
+        if(std::is_same<T, A>::value)
+        {
+            log_bench(handle,
+                      "./rocsparse-bench -f coomv -r",
+                      replaceX<T>("X"),
+                      "--mtx <matrix.mtx> ",
+                      "--alpha",
+                      *alpha,
+                      "--beta",
+                      *beta);
+        }
     }
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcoomv"),
+                  replaceX<T, A>("rocsparse_Xcoomv"),
                   trans,
                   m,
                   n,
@@ -281,7 +285,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
 
             if(handle->wavefront_size == 32)
             {
-                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, COOMVN_DIM, 32>),
+                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, A, COOMVN_DIM, 32>),
                                    coomvn_blocks,
                                    coomvn_threads,
                                    0,
@@ -300,7 +304,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
             }
             else if(handle->wavefront_size == 64)
             {
-                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, COOMVN_DIM, 64>),
+                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, A, COOMVN_DIM, 64>),
                                    coomvn_blocks,
                                    coomvn_threads,
                                    0,
@@ -348,7 +352,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
 
             if(handle->wavefront_size == 32)
             {
-                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, COOMVN_DIM, 32>),
+                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, A, COOMVN_DIM, 32>),
                                    coomvn_blocks,
                                    coomvn_threads,
                                    0,
@@ -367,7 +371,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
             }
             else if(handle->wavefront_size == 64)
             {
-                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, COOMVN_DIM, 64>),
+                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, A, COOMVN_DIM, 64>),
                                    coomvn_blocks,
                                    coomvn_threads,
                                    0,
@@ -0,0 +1,472 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR5MV_HPP
+#define ROCSPARSE_CSR5MV_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "grid.h"
+#include "csr5mv_device.h"
+
+#include <hip/hip_runtime.h>
+
+#define CSR5MVN_DIM 256
+
+template <typename T, rocsparse_int OMEGA, rocsparse_int SIGMA>
+__launch_bounds__(OMEGA) __global__
+    void csr5mvn_kernel_host_pointer(rocsparse_int nnz,
+                                     T alpha,
+                                     const rocsparse_int* __restrict__ tile_ptr,
+                                     const uint32_t* __restrict__ tile_desc_flag,
+                                     const uint32_t* __restrict__ tile_desc_offset,
+                                     const rocsparse_int* __restrict__ tile_desc_rows_ptr,
+                                     const rocsparse_int* __restrict__ tile_desc_rows,
+                                     const T* __restrict__ csr_val,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const T* __restrict__ x,
+                                     T beta,
+                                     T* __restrict__ y,
+                                     T* __restrict__ carry,
+                                     rocsparse_index_base idx_base)
+{
+    csr5mvn_device<T, OMEGA, SIGMA>(nnz,
+                                    alpha,
+                                    tile_ptr,
+                                    tile_desc_flag,
+                                    tile_desc_offset,
+                                    tile_desc_rows_ptr,
+                                    tile_desc_rows,
+                                    csr_val,
+                                    csr_col_ind,
+                                    x,
+                                    beta,
+                                    y,
+                                    carry,
+                                    idx_base);
+}
+
+template <typename T, rocsparse_int OMEGA, rocsparse_int SIGMA>
+__launch_bounds__(OMEGA) __global__
+    void csr5mvn_kernel_device_pointer(rocsparse_int nnz,
+                                       const T* alpha,
+                                       const rocsparse_int* __restrict__ tile_ptr,
+                                       const uint32_t* __restrict__ tile_desc_flag,
+                                       const uint32_t* __restrict__ tile_desc_offset,
+                                       const rocsparse_int* __restrict__ tile_desc_rows_ptr,
+                                       const rocsparse_int* __restrict__ tile_desc_rows,
+                                       const T* __restrict__ csr_val,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const T* __restrict__ x,
+                                       const T* beta,
+                                       T* __restrict__ y,
+                                       T* __restrict__ carry,
+                                       rocsparse_index_base idx_base)
+{
+    csr5mvn_device<T, OMEGA, SIGMA>(nnz,
+                                    *alpha,
+                                    tile_ptr,
+                                    tile_desc_flag,
+                                    tile_desc_offset,
+                                    tile_desc_rows_ptr,
+                                    tile_desc_rows,
+                                    csr_val,
+                                    csr_col_ind,
+                                    x,
+                                    *beta,
+                                    y,
+                                    carry,
+                                    idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr5mvn_empty_rows_kernel_host_pointer(rocsparse_int nempty,
+                                                const rocsparse_int* __restrict__ empty_rows,
+                                                T beta,
+                                                T* __restrict__ y)
+{
+    csr5mvn_empty_rows_device<T, BLOCKSIZE>(nempty, empty_rows, beta, y);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr5mvn_empty_rows_kernel_device_pointer(rocsparse_int nempty,
+                                                  const rocsparse_int* __restrict__ empty_rows,
+                                                  const T* beta,
+                                                  T* __restrict__ y)
+{
+    csr5mvn_empty_rows_device<T, BLOCKSIZE>(nempty, empty_rows, *beta, y);
+}
+
+template <typename T, rocsparse_int OMEGA, rocsparse_int SIGMA>
+rocsparse_status rocsparse_csr5mvn_launch(rocsparse_handle handle,
+                                          const T* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const T* csr_val,
+                                          const rocsparse_int* csr_col_ind,
+                                          const rocsparse_csr5_mat csr5,
+                                          const T* x,
+                                          const T* beta,
+                                          T* y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Carry of each tile
+    T* carry = nullptr;
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&carry, sizeof(T) * csr5->ntiles));
+
+    dim3 csr5mvn_blocks(csr5->ntiles);
+    dim3 csr5mvn_threads(OMEGA);
+
+    dim3 calibrate_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(csr5->ntiles, CSR5MVN_DIM, calibrate_blocks));
+    dim3 calibrate_threads(CSR5MVN_DIM);
+
+    dim3 empty_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(csr5->nempty, CSR5MVN_DIM, empty_blocks));
+    dim3 empty_threads(CSR5MVN_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csr5mvn_kernel_device_pointer<T, OMEGA, SIGMA>),
+                           csr5mvn_blocks,
+                           csr5mvn_threads,
+                           0,
+                           stream,
+                           csr5->nnz,
+                           alpha,
+                           csr5->tile_ptr,
+                           csr5->tile_desc_flag,
+                           csr5->tile_desc_offset,
+                           csr5->tile_desc_rows_ptr,
+                           csr5->tile_desc_rows,
+                           csr_val,
+                           csr_col_ind,
+                           x,
+                           beta,
+                           y,
+                           carry,
+                           descr->base);
+
+        if(csr5->nempty > 0)
+        {
+            hipLaunchKernelGGL((csr5mvn_empty_rows_kernel_device_pointer<T, CSR5MVN_DIM>),
+                               empty_blocks,
+                               empty_threads,
+                               0,
+                               stream,
+                               csr5->nempty,
+                               csr5->empty_rows,
+                               beta,
+                               y);
+        }
+    }
+    else
+    {
+        hipLaunchKernelGGL((csr5mvn_kernel_host_pointer<T, OMEGA, SIGMA>),
+                           csr5mvn_blocks,
+                           csr5mvn_threads,
+                           0,
+                           stream,
+                           csr5->nnz,
+                           *alpha,
+                           csr5->tile_ptr,
+                           csr5->tile_desc_flag,
+                           csr5->tile_desc_offset,
+                           csr5->tile_desc_rows_ptr,
+                           csr5->tile_desc_rows,
+                           csr_val,
+                           csr_col_ind,
+                           x,
+                           *beta,
+                           y,
+                           carry,
+                           descr->base);
+
+        if(csr5->nempty > 0)
+        {
+            hipLaunchKernelGGL((csr5mvn_empty_rows_kernel_host_pointer<T, CSR5MVN_DIM>),
+                               empty_blocks,
+                               empty_threads,
+                               0,
+                               stream,
+                               csr5->nempty,
+                               csr5->empty_rows,
+                               *beta,
+                               y);
+        }
+    }
+
+    // Add carries of rows that span several tiles
+    hipLaunchKernelGGL((csr5mvn_calibrate<T, CSR5MVN_DIM, OMEGA>),
+                       calibrate_blocks,
+                       calibrate_threads,
+                       0,
+                       stream,
+                       csr5->ntiles,
+                       csr5->tile_ptr,
+                       csr5->tile_desc_flag,
+                       carry,
+                       y);
+
+    RETURN_IF_HIP_ERROR(handle->deallocate(carry));
+
+    return rocsparse_status_success;
+}
+
+template <typename T, rocsparse_int OMEGA>
+rocsparse_status rocsparse_csr5mvn_dispatch(rocsparse_handle handle,
+                                            const T* alpha,
+                                            const rocsparse_mat_descr descr,
+                                            const T* csr_val,
+                                            const rocsparse_int* csr_col_ind,
+                                            const rocsparse_csr5_mat csr5,
+                                            const T* x,
+                                            const T* beta,
+                                            T* y)
+{
+    if(csr5->sigma == 4)
+    {
+        return rocsparse_csr5mvn_launch<T, OMEGA, 4>(
+            handle, alpha, descr, csr_val, csr_col_ind, csr5, x, beta, y);
+    }
+    else if(csr5->sigma == 8)
+    {
+        return rocsparse_csr5mvn_launch<T, OMEGA, 8>(
+            handle, alpha, descr, csr_val, csr_col_ind, csr5, x, beta, y);
+    }
+    else
+    {
+        return rocsparse_csr5mvn_launch<T, OMEGA, 16>(
+            handle, alpha, descr, csr_val, csr_col_ind, csr5, x, beta, y);
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr5mv_template(rocsparse_handle handle,
+                                           rocsparse_operation trans,
+                                           rocsparse_int m,
+                                           rocsparse_int n,
+                                           rocsparse_int nnz,
+                                           const T* alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const T* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           const rocsparse_csr5_mat csr5,
+                                           const T* x,
+                                           const T* beta,
+                                           T* y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr5 == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsr5mv"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)csr5,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csr5mv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsr5mv"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)csr5,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The CSR5 tile descriptor must match the CSR matrix
+    if(csr5->m != m || csr5->n != n || csr5->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check CSR5 structure
+    if(csr5->omega != 32 && csr5->omega != 64)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(csr5->sigma != 4 && csr5->sigma != 8 && csr5->sigma != 16)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(csr5->tile_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr5->tile_desc_flag == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr5->tile_desc_offset == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr5->tile_desc_rows_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Run different csr5mv kernels
+    if(trans == rocsparse_operation_none)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            {
+                return rocsparse_status_success;
+            }
+        }
+
+        if(csr5->omega == 32)
+        {
+            return rocsparse_csr5mvn_dispatch<T, 32>(
+                handle, alpha, descr, csr_val, csr_col_ind, csr5, x, beta, y);
+        }
+        else
+        {
+            return rocsparse_csr5mvn_dispatch<T, 64>(
+                handle, alpha, descr, csr_val, csr_col_ind, csr5, x, beta, y);
+        }
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+}
+
+#undef CSR5MVN_DIM
+
+#endif // ROCSPARSE_CSR5MV_HPP
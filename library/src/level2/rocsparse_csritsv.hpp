@@ -0,0 +1,514 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_CSRITSV_HPP
+#define ROCSPARSE_CSRITSV_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "csritsv_device.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_csritsv_buffer_size_template(rocsparse_handle handle,
+                                                        rocsparse_operation trans,
+                                                        rocsparse_int m,
+                                                        rocsparse_int nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T* csr_val,
+                                                        const rocsparse_int* csr_row_ptr,
+                                                        const rocsparse_int* csr_col_ind,
+                                                        size_t* buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsritsv_buffer_size"),
+              trans,
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+#define CSRITSV_DIM 256
+    rocsparse_int nblocks = (m - 1) / CSRITSV_DIM + 1;
+#undef CSRITSV_DIM
+
+    // T y_tmp[m]
+    *buffer_size = sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+    // T partial[nblocks]
+    *buffer_size += sizeof(T) * ((nblocks - 1) / 256 + 1) * 256;
+
+    // T nrm
+    *buffer_size += 256;
+
+    return rocsparse_status_success;
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, bool UPDATE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csritsv_sweep_host_pointer(rocsparse_int m,
+                                    T alpha,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                    const T* __restrict__ csr_val,
+                                    const T* __restrict__ x,
+                                    const T* __restrict__ y_old,
+                                    T* __restrict__ y_new,
+                                    T* __restrict__ partial,
+                                    rocsparse_index_base idx_base,
+                                    rocsparse_fill_mode fill_mode,
+                                    rocsparse_diag_type diag_type)
+{
+    csritsv_sweep_device<T, BLOCKSIZE, UPDATE>(m,
+                                               alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               x,
+                                               y_old,
+                                               y_new,
+                                               partial,
+                                               idx_base,
+                                               fill_mode,
+                                               diag_type);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, bool UPDATE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csritsv_sweep_device_pointer(rocsparse_int m,
+                                      const T* alpha,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                      const T* __restrict__ csr_val,
+                                      const T* __restrict__ x,
+                                      const T* __restrict__ y_old,
+                                      T* __restrict__ y_new,
+                                      T* __restrict__ partial,
+                                      rocsparse_index_base idx_base,
+                                      rocsparse_fill_mode fill_mode,
+                                      rocsparse_diag_type diag_type)
+{
+    csritsv_sweep_device<T, BLOCKSIZE, UPDATE>(m,
+                                               *alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               x,
+                                               y_old,
+                                               y_new,
+                                               partial,
+                                               idx_base,
+                                               fill_mode,
+                                               diag_type);
+}
+
+// Launch a single Jacobi sweep, or the residual computation if UPDATE is false
+template <typename T, bool UPDATE>
+static rocsparse_status rocsparse_csritsv_sweep(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                const T* alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                const T* x,
+                                                const T* y_old,
+                                                T* y_new,
+                                                T* partial)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRITSV_DIM 256
+    dim3 csritsv_blocks((m - 1) / CSRITSV_DIM + 1);
+    dim3 csritsv_threads(CSRITSV_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csritsv_sweep_device_pointer<T, CSRITSV_DIM, UPDATE>),
+                           csritsv_blocks,
+                           csritsv_threads,
+                           0,
+                           stream,
+                           m,
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y_old,
+                           y_new,
+                           partial,
+                           descr->base,
+                           descr->fill_mode,
+                           descr->diag_type);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csritsv_sweep_host_pointer<T, CSRITSV_DIM, UPDATE>),
+                           csritsv_blocks,
+                           csritsv_threads,
+                           0,
+                           stream,
+                           m,
+                           *alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y_old,
+                           y_new,
+                           partial,
+                           descr->base,
+                           descr->fill_mode,
+                           descr->diag_type);
+    }
+#undef CSRITSV_DIM
+
+    return rocsparse_status_success;
+}
+
+// Reduce the partial sums of n blocks to the 2-norm. The norm is written to nrm, which
+// is a device buffer that is copied to the host array residual in host pointer mode.
+template <typename T>
+static rocsparse_status rocsparse_csrit_nrm2(rocsparse_handle handle,
+                                             rocsparse_int n,
+                                             const T* partial,
+                                             T* nrm,
+                                             T* residual)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define NRM2_DIM 256
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrit_nrm2_kernel<T, NRM2_DIM>),
+                           dim3(1),
+                           dim3(NRM2_DIM),
+                           0,
+                           stream,
+                           n,
+                           partial,
+                           residual);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrit_nrm2_kernel<T, NRM2_DIM>),
+                           dim3(1),
+                           dim3(NRM2_DIM),
+                           0,
+                           stream,
+                           n,
+                           partial,
+                           nrm);
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(residual, nrm, sizeof(T), hipMemcpyDeviceToHost));
+    }
+#undef NRM2_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csritsv_solve_template(rocsparse_handle handle,
+                                                  rocsparse_operation trans,
+                                                  rocsparse_int m,
+                                                  rocsparse_int nnz,
+                                                  const T* alpha,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T* csr_val,
+                                                  const rocsparse_int* csr_row_ptr,
+                                                  const rocsparse_int* csr_col_ind,
+                                                  const T* x,
+                                                  T* y,
+                                                  rocsparse_int nsweeps,
+                                                  T* residual,
+                                                  void* temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsritsv"),
+                  trans,
+                  m,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  (const void*&)y,
+                  nsweeps,
+                  (const void*&)residual,
+                  (const void*&)temp_buffer);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csritsv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> ",
+                  "--alpha",
+                  *alpha,
+                  "--sweeps",
+                  nsweeps);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsritsv"),
+                  trans,
+                  m,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  (const void*&)y,
+                  nsweeps,
+                  (const void*&)residual,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check number of sweeps
+    if(nsweeps < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Residuals on the host require synchronization
+    if(residual != nullptr && handle->exec_mode == rocsparse_exec_mode_async
+       && handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // y_tmp
+    T* y_tmp = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+#define CSRITSV_DIM 256
+    rocsparse_int nblocks = (m - 1) / CSRITSV_DIM + 1;
+#undef CSRITSV_DIM
+
+    // partial
+    T* partial = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((nblocks - 1) / 256 + 1) * 256;
+
+    // nrm
+    T* nrm = reinterpret_cast<T*>(ptr);
+
+    // Jacobi sweeps alternate between y and y_tmp, such that the last sweep writes
+    // to y. The initial guess is zero.
+    T* y_buf[2] = {y, y_tmp};
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(y_buf[nsweeps & 1], 0, sizeof(T) * m, stream));
+
+    for(rocsparse_int iter = 0; iter < nsweeps; ++iter)
+    {
+        T* y_old = y_buf[(nsweeps - iter) & 1];
+        T* y_new = y_buf[(nsweeps - iter - 1) & 1];
+
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse_csritsv_sweep<T, true>(handle,
+                                                                     m,
+                                                                     alpha,
+                                                                     descr,
+                                                                     csr_val,
+                                                                     csr_row_ptr,
+                                                                     csr_col_ind,
+                                                                     x,
+                                                                     y_old,
+                                                                     y_new,
+                                                                     partial)));
+
+        // Residual of the current iterate
+        if(residual != nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csritsv_sweep<T, false>(handle,
+                                                                          m,
+                                                                          alpha,
+                                                                          descr,
+                                                                          csr_val,
+                                                                          csr_row_ptr,
+                                                                          csr_col_ind,
+                                                                          x,
+                                                                          y_new,
+                                                                          nullptr,
+                                                                          partial)));
+
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_csrit_nrm2(handle, nblocks, partial, nrm, residual + iter));
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRITSV_HPP
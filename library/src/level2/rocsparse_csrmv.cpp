@@ -160,3 +160,100 @@ extern "C" rocsparse_status rocsparse_dcsrmv(rocsparse_handle handle,
                                             beta,
                                             y);
 }
+
+extern "C" rocsparse_status rocsparse_dscsrmv(rocsparse_handle handle,
+                                              rocsparse_operation trans,
+                                              rocsparse_int m,
+                                              rocsparse_int n,
+                                              rocsparse_int nnz,
+                                              const double* alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const float* csr_val,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              rocsparse_mat_info info,
+                                              const double* x,
+                                              const double* beta,
+                                              double* y)
+{
+    return rocsparse_csrmv_template<double, float>(handle,
+                                                   trans,
+                                                   m,
+                                                   n,
+                                                   nnz,
+                                                   alpha,
+                                                   descr,
+                                                   csr_val,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   info,
+                                                   x,
+                                                   beta,
+                                                   y);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmv_multi(rocsparse_handle handle,
+                                                   rocsparse_operation trans,
+                                                   rocsparse_int m,
+                                                   rocsparse_int n,
+                                                   rocsparse_int nnz,
+                                                   rocsparse_int k,
+                                                   const float* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const float* csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   rocsparse_mat_info info,
+                                                   const float* x,
+                                                   const float* beta,
+                                                   float* y)
+{
+    return rocsparse_csrmv_multi_template<float>(handle,
+                                                 trans,
+                                                 m,
+                                                 n,
+                                                 nnz,
+                                                 k,
+                                                 alpha,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 info,
+                                                 x,
+                                                 beta,
+                                                 y);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_multi(rocsparse_handle handle,
+                                                   rocsparse_operation trans,
+                                                   rocsparse_int m,
+                                                   rocsparse_int n,
+                                                   rocsparse_int nnz,
+                                                   rocsparse_int k,
+                                                   const double* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const double* csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   rocsparse_mat_info info,
+                                                   const double* x,
+                                                   const double* beta,
+                                                   double* y)
+{
+    return rocsparse_csrmv_multi_template<double>(handle,
+                                                  trans,
+                                                  m,
+                                                  n,
+                                                  nnz,
+                                                  k,
+                                                  alpha,
+                                                  descr,
+                                                  csr_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  info,
+                                                  x,
+                                                  beta,
+                                                  y);
+}
@@ -28,9 +28,12 @@
 #include "rocsparse.h"
 #include "handle.h"
 #include "utility.h"
+#include "grid.h"
 #include "csrmv_device.h"
 
+#include <limits>
 #include <hip/hip_runtime.h>
+#include <hipcub/hipcub.hpp>
 
 #define BLOCKSIZE 1024
 #define BLOCK_MULTIPLIER 3
@@ -38,259 +41,385 @@
 #define WG_BITS 24
 #define ROW_BITS 32
 #define WG_SIZE 256
-
-__attribute__((unused)) static unsigned int flp2(unsigned int x)
+#define MERGE_BLOCKSIZE 256
+#define MERGE_ITEMS 4
+#define MERGE_TILE (MERGE_BLOCKSIZE * MERGE_ITEMS)
+#define TRANSPOSE_NNZ_PER_ROW 16
+
+static rocsparse_status rocsparse_csrmv_adaptive_analysis(rocsparse_handle handle,
+                                                          rocsparse_int m,
+                                                          rocsparse_int n,
+                                                          rocsparse_int nnz,
+                                                          const rocsparse_int* csr_row_ptr,
+                                                          rocsparse_csrmv_info info)
 {
-    x |= (x >> 1);
-    x |= (x >> 2);
-    x |= (x >> 4);
-    x |= (x >> 8);
-    x |= (x >> 16);
-    return x - (x >> 1);
-}
+    // Row block entries store the row index in the upper ROW_BITS bits, including
+    // the final entry that holds m
+    if(static_cast<unsigned long long>(m) >= (1ULL << ROW_BITS))
+    {
+        return rocsparse_status_invalid_size;
+    }
 
-// Short rows in CSR-Adaptive are batched together into a single row block.
-// If there are a relatively small number of these, then we choose to do
-// a horizontal reduction (groups of threads all reduce the same row).
-// If there are many threads (e.g. more threads than the maximum size
-// of our workgroup) then we choose to have each thread serially reduce
-// the row.
-// This function calculates the number of threads that could team up
-// to reduce these groups of rows. For instance, if you have a
-// workgroup size of 256 and 4 rows, you could have 64 threads
-// working on each row. If you have 5 rows, only 32 threads could
-// reliably work on each row because our reduction assumes power-of-2.
-static unsigned long long numThreadsForReduction(unsigned long long num_rows)
-{
-#if defined(__INTEL_COMPILER)
-    return WG_SIZE >> (_bit_scan_reverse(num_rows - 1) + 1);
-#elif(defined(__HIP_PLATFORM_NVCC__))
-    return flp2(WG_SIZE / num_rows);
-#elif(defined(__clang__) && __has_builtin(__builtin_clz)) || \
-    !defined(__clang) && defined(__GNUG__) &&                \
-        ((__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__) > 30202)
-    return (WG_SIZE >> (8 * sizeof(int) - __builtin_clz(num_rows - 1)));
-#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
-    unsigned long long bit_returned;
-    _BitScanReverse(&bit_returned, (num_rows - 1));
-    return WG_SIZE >> (bit_returned + 1);
-#else
-    return flp2(WG_SIZE / num_rows);
-#endif
-}
+    // The number of row blocks depends on the matrix structure and requires
+    // synchronization with the host
+    if(handle->exec_mode == rocsparse_exec_mode_async)
+    {
+        return rocsparse_status_invalid_value;
+    }
 
-static void ComputeRowBlocks(unsigned long long* rowBlocks,
-                             size_t& rowBlockSize,
-                             const rocsparse_int* rowDelimiters,
-                             rocsparse_int nRows,
-                             bool allocate_row_blocks = true)
-{
-    unsigned long long* rowBlocksBase;
+    // Stream
+    hipStream_t stream = handle->stream;
 
-    // Start at one because of rowBlock[0]
-    rocsparse_int total_row_blocks = 1;
+    // Fingerprint of the sparsity pattern, if the csrmv analysis cache is enabled
+    unsigned long long hash = 0;
 
-    if(allocate_row_blocks)
+    if(handle->csrmv_cache_capacity > 0)
     {
-        rowBlocksBase = rowBlocks;
-        *rowBlocks    = 0;
-        ++rowBlocks;
-    }
+        // The device buffer holds the hash accumulator
+        unsigned long long* d_hash = reinterpret_cast<unsigned long long*>(handle->buffer);
 
-    unsigned long long sum = 0;
-    unsigned long long i;
-    unsigned long long last_i = 0;
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_hash, 0, sizeof(unsigned long long), stream));
 
-    // Check to ensure nRows can fit in 32 bits
-    if(static_cast<unsigned long long>(nRows) >
-       static_cast<unsigned long long>(std::pow(2, ROW_BITS)))
-    {
-        fprintf(stderr, "nrow does not fit in 32 bits\n");
-        exit(1);
-    }
+#define CSRMV_HASH_DIM 256
+        hipLaunchKernelGGL((csrmv_row_ptr_hash_kernel<CSRMV_HASH_DIM>),
+                           dim3(m / CSRMV_HASH_DIM + 1),
+                           dim3(CSRMV_HASH_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           d_hash);
+#undef CSRMV_HASH_DIM
 
-    rocsparse_int consecutive_long_rows = 0;
-    for(i = 1; i <= static_cast<unsigned long long>(nRows); ++i)
-    {
-        rocsparse_int row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
-        sum += row_length;
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&hash, d_hash, sizeof(unsigned long long), hipMemcpyDeviceToHost));
 
-        // The following section of code calculates whether you're moving between
-        // a series of "short" rows and a series of "long" rows.
-        // This is because the reduction in CSR-Adaptive likes things to be
-        // roughly the same length. Long rows can be reduced horizontally.
-        // Short rows can be reduced one-thread-per-row. Try not to mix them.
-        if(row_length > 128)
-        {
-            ++consecutive_long_rows;
-        }
-        else if(consecutive_long_rows > 0)
-        {
-            // If it turns out we WERE in a long-row region, cut if off now.
-            if(row_length < 32) // Now we're in a short-row region
-            {
-                consecutive_long_rows = -1;
-            }
-            else
-            {
-                consecutive_long_rows++;
-            }
-        }
+        // Skip the row blocks computation if the pattern is known
+        _rocsparse_csrmv_cache_entry* entry = handle->csrmv_cache_find(m, n, nnz, hash);
 
-        // If you just entered into a "long" row from a series of short rows,
-        // then we need to make sure we cut off those short rows. Put them in
-        // their own workgroup.
-        if(consecutive_long_rows == 1)
+        if(entry != nullptr)
         {
-            // Assuming there *was* a previous workgroup. If not, nothing to do here.
-            if(i - last_i > 1)
-            {
-                if(allocate_row_blocks)
-                {
-                    *rowBlocks = ((i - 1) << (64 - ROW_BITS));
+            // Verify the row pointers, such that a fingerprint collision does not hand
+            // out the row blocks of a different pattern
+            int* d_mismatch = reinterpret_cast<int*>(handle->buffer);
 
-                    // If this row fits into CSR-Stream, calculate how many rows
-                    // can be used to do a parallel reduction.
-                    // Fill in the low-order bits with the numThreadsForRed
-                    if(((i - 1) - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                    {
-                        *(rowBlocks - 1) |= numThreadsForReduction((i - 1) - last_i);
-                    }
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(d_mismatch, 0, sizeof(int), stream));
 
-                    ++rowBlocks;
-                }
+#define CSRMV_COMPARE_DIM 256
+            hipLaunchKernelGGL((csrmv_row_ptr_compare_kernel<CSRMV_COMPARE_DIM>),
+                               dim3(m / CSRMV_COMPARE_DIM + 1),
+                               dim3(CSRMV_COMPARE_DIM),
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               entry->csr_row_ptr,
+                               d_mismatch);
+#undef CSRMV_COMPARE_DIM
 
-                ++total_row_blocks;
-                last_i = i - 1;
-                sum    = row_length;
+            int mismatch;
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy(&mismatch, d_mismatch, sizeof(int), hipMemcpyDeviceToHost));
+
+            if(mismatch == 0)
+            {
+                return handle->csrmv_cache_copy(entry, info);
             }
         }
-        else if(consecutive_long_rows == -1)
-        {
-            // We see the first short row after some long ones that
-            // didn't previously fill up a row block.
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = ((i - 1) << (64 - ROW_BITS));
-                if(((i - 1) - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                {
-                    *(rowBlocks - 1) |= numThreadsForReduction((i - 1) - last_i);
-                }
+    }
 
-                ++rowBlocks;
-            }
+    // hipcub buffer size
+    size_t hipcub_size = 0;
+    rocsparse_int* ptr = nullptr;
+    RETURN_IF_HIP_ERROR(
+        hipcub::DeviceScan::ExclusiveSum(nullptr, hipcub_size, ptr, ptr, m + 1, stream));
+
+    // Temporary storage, each array holds m + 1 entries
+    size_t int_size = sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+    size_t ull_size = sizeof(unsigned long long) * (m / 256 + 1) * 256;
+
+    char* workspace = nullptr;
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&workspace, int_size * 5 + ull_size + hipcub_size));
+
+    rocsparse_int* d_next      = reinterpret_cast<rocsparse_int*>(workspace);
+    rocsparse_int* d_count     = reinterpret_cast<rocsparse_int*>(workspace + int_size);
+    rocsparse_int* d_label     = reinterpret_cast<rocsparse_int*>(workspace + int_size * 2);
+    rocsparse_int* d_work1     = reinterpret_cast<rocsparse_int*>(workspace + int_size * 3);
+    rocsparse_int* d_work2     = reinterpret_cast<rocsparse_int*>(workspace + int_size * 4);
+    unsigned long long* d_bits = reinterpret_cast<unsigned long long*>(workspace + int_size * 5);
+    void* hipcub_buffer        = reinterpret_cast<void*>(workspace + int_size * 5 + ull_size);
+
+#define CSRMV_ROW_BLOCKS_DIM 256
+    dim3 row_blocks_blocks(m / CSRMV_ROW_BLOCKS_DIM + 1);
+    dim3 row_blocks_threads(CSRMV_ROW_BLOCKS_DIM);
+
+    // Position of the next long row for each row, obtained by compaction of the long rows
+    hipLaunchKernelGGL((csrmv_row_blocks_flag_kernel<CSRMV_ROW_BLOCKS_DIM>),
+                       row_blocks_blocks,
+                       row_blocks_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       d_work1);
+
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::ExclusiveSum(
+        hipcub_buffer, hipcub_size, d_work1, d_work1, m + 1, stream));
+
+    hipLaunchKernelGGL((csrmv_row_blocks_compact_kernel<CSRMV_ROW_BLOCKS_DIM>),
+                       row_blocks_blocks,
+                       row_blocks_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       d_work1,
+                       d_work2);
+
+    // Row block that would start at each row
+    hipLaunchKernelGGL((csrmv_row_blocks_segment_kernel<CSRMV_ROW_BLOCKS_DIM,
+                                                        BLOCKSIZE,
+                                                        BLOCK_MULTIPLIER,
+                                                        ROWS_FOR_VECTOR,
+                                                        WG_BITS,
+                                                        WG_SIZE>),
+                       row_blocks_blocks,
+                       row_blocks_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       d_work1,
+                       d_work2,
+                       d_next,
+                       d_count,
+                       d_bits,
+                       d_label);
+
+    // Mark the chain of row blocks starting at row 0 using pointer jumping,
+    // after k steps all row blocks up to distance 2^k are marked
+    const rocsparse_int* jump_in = d_next;
+    rocsparse_int* jump_out      = d_work1;
+
+    for(rocsparse_int k = 0; (static_cast<int64_t>(1) << k) <= m; ++k)
+    {
+        hipLaunchKernelGGL((csrmv_row_blocks_chain_kernel<CSRMV_ROW_BLOCKS_DIM>),
+                           row_blocks_blocks,
+                           row_blocks_threads,
+                           0,
+                           stream,
+                           m,
+                           jump_in,
+                           jump_out,
+                           d_label);
+
+        jump_in  = jump_out;
+        jump_out = (jump_out == d_work1) ? d_work2 : d_work1;
+    }
 
-            ++total_row_blocks;
-            last_i                = i - 1;
-            sum                   = row_length;
-            consecutive_long_rows = 0;
-        }
+    // Row block entries of the chain
+    hipLaunchKernelGGL((csrmv_row_blocks_count_kernel<CSRMV_ROW_BLOCKS_DIM>),
+                       row_blocks_blocks,
+                       row_blocks_threads,
+                       0,
+                       stream,
+                       m,
+                       d_label,
+                       d_count);
+
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::ExclusiveSum(
+        hipcub_buffer, hipcub_size, d_count, d_count, m + 1, stream));
+
+    // Total number of row block entries, required to size the row blocks array
+    rocsparse_int nentries;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&nentries, d_count + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    // Row blocks size is twice the number of entries, the extended precision form of
+    // CSR-Adaptive requires more space for the final global reduction
+    info->size = 2 * (nentries + 1);
+
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&info->row_blocks, sizeof(unsigned long long) * info->size));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(info->row_blocks,
+                                       0,
+                                       sizeof(unsigned long long) * info->size,
+                                       stream));
+
+    // Write row blocks
+    hipLaunchKernelGGL((csrmv_row_blocks_fill_kernel<CSRMV_ROW_BLOCKS_DIM, ROW_BITS>),
+                       row_blocks_blocks,
+                       row_blocks_threads,
+                       0,
+                       stream,
+                       m,
+                       d_next,
+                       d_count,
+                       d_bits,
+                       info->row_blocks);
+#undef CSRMV_ROW_BLOCKS_DIM
+
+    // Free temporary storage
+    RETURN_IF_HIP_ERROR(handle->deallocate(workspace));
+
+    // Keep a copy of the row blocks for subsequent analysis calls on the same pattern
+    if(handle->csrmv_cache_capacity > 0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->csrmv_cache_insert(m, n, nnz, hash, csr_row_ptr, info));
+    }
 
-        // Now, what's up with this row? What did it do?
+    return rocsparse_status_success;
+}
 
-        // exactly one row results in non-zero elements to be greater than blockSize
-        // This is csr-vector case; bottom WGBITS == workgroup ID
-        if((i - last_i == 1) && sum > static_cast<unsigned long long>(BLOCKSIZE))
-        {
-            rocsparse_int numWGReq = static_cast<rocsparse_int>(
-                std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCKSIZE)));
+template <typename T>
+static rocsparse_status rocsparse_csrmv_merge_analysis(rocsparse_handle handle,
+                                                       rocsparse_int m,
+                                                       rocsparse_int nnz,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       rocsparse_csrmv_info info,
+                                                       rocsparse_index_base idx_base)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
 
-            // Check to ensure #workgroups can fit in WGBITS bits, if not
-            // then the last workgroup will do all the remaining work
-            numWGReq = (numWGReq < static_cast<rocsparse_int>(std::pow(2, WG_BITS)))
-                           ? numWGReq
-                           : static_cast<rocsparse_int>(std::pow(2, WG_BITS));
+    // Number of merge path partitions, each partition consumes MERGE_TILE items. The
+    // merge path holds m + nnz items, which is computed in 64 bit.
+    int64_t nparts = rocsparse_grid_size(static_cast<int64_t>(m) + nnz, MERGE_TILE);
 
-            if(allocate_row_blocks)
-            {
-                for(rocsparse_int w = 1; w < numWGReq; ++w)
-                {
-                    *rowBlocks = ((i - 1) << (64 - ROW_BITS));
-                    *rowBlocks |= static_cast<unsigned long long>(w);
-                    ++rowBlocks;
-                }
+    // Partition indices and the launch of one workgroup per partition have to be
+    // representable
+    if(nparts >= std::numeric_limits<rocsparse_int>::max() || nparts > ROCSPARSE_GRID_MAX_ITEMS)
+    {
+        return rocsparse_status_invalid_size;
+    }
 
-                *rowBlocks = (i << (64 - ROW_BITS));
-                ++rowBlocks;
-            }
+    info->nparts = static_cast<rocsparse_int>(nparts);
+
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&info->merge_row, sizeof(rocsparse_int) * (info->nparts + 1)));
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&info->merge_nnz, sizeof(rocsparse_int) * (info->nparts + 1)));
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&info->carry_row, sizeof(rocsparse_int) * info->nparts));
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&info->carry_val, sizeof(T) * info->nparts));
+
+    // Search the start coordinates of all partitions
+#define CSRMV_PARTITION_DIM 256
+    dim3 partition_blocks(info->nparts / CSRMV_PARTITION_DIM + 1);
+    dim3 partition_threads(CSRMV_PARTITION_DIM);
+
+    hipLaunchKernelGGL((csrmv_merge_path_partition_kernel<CSRMV_PARTITION_DIM, MERGE_TILE>),
+                       partition_blocks,
+                       partition_threads,
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       info->nparts,
+                       csr_row_ptr,
+                       info->merge_row,
+                       info->merge_nnz,
+                       idx_base);
+#undef CSRMV_PARTITION_DIM
 
-            total_row_blocks += numWGReq;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-        // more than one row results in non-zero elements to be greater than blockSize
-        // This is csr-stream case; bottom WGBITS = number of parallel reduction threads
-        else if((i - last_i > 1) && sum > static_cast<unsigned long long>(BLOCKSIZE))
-        {
-            // This row won't fit, so back off one.
-            --i;
+    return rocsparse_status_success;
+}
 
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = (i << (64 - ROW_BITS));
-                if((i - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                {
-                    *(rowBlocks - 1) |= numThreadsForReduction(i - last_i);
-                }
+static rocsparse_status rocsparse_csrmvt_analysis(rocsparse_handle handle,
+                                                  rocsparse_int m,
+                                                  rocsparse_int n,
+                                                  rocsparse_int nnz,
+                                                  const rocsparse_int* csr_row_ptr,
+                                                  const rocsparse_int* csr_col_ind,
+                                                  rocsparse_csrmv_info info,
+                                                  rocsparse_index_base idx_base)
+{
+    // Short rows are scattered into y with only a few atomics each. Longer rows
+    // cause contention on y, thus the transpose is cached to gather instead.
+    if(nnz / m < TRANSPOSE_NNZ_PER_ROW)
+    {
+        return rocsparse_status_success;
+    }
 
-                ++rowBlocks;
-            }
+    // Stream
+    hipStream_t stream = handle->stream;
 
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-        // This is csr-stream case; bottom WGBITS = number of parallel reduction threads
-        else if(sum == static_cast<unsigned long long>(BLOCKSIZE))
-        {
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = (i << (64 - ROW_BITS));
-                if((i - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                {
-                    *(rowBlocks - 1) |= numThreadsForReduction(i - last_i);
-                }
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(n);
 
-                ++rowBlocks;
-            }
+    // hipcub buffer size
+    size_t hipcub_size = 0;
+    rocsparse_int* ptr = nullptr;
+    hipcub::DoubleBuffer<rocsparse_int> dummy(ptr, ptr);
+    RETURN_IF_HIP_ERROR(hipcub::DeviceRadixSort::SortPairs(
+        nullptr, hipcub_size, dummy, dummy, nnz, startbit, endbit, stream));
 
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-    }
+    // Temporary storage, each array holds nnz entries
+    size_t int_size = sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
 
-    // If we didn't fill a row block with the last row, make sure we don't lose it.
-    if(allocate_row_blocks &&
-       (*(rowBlocks - 1) >> (64 - ROW_BITS)) != static_cast<unsigned long long>(nRows))
-    {
-        *rowBlocks = (static_cast<unsigned long long>(nRows) << (64 - ROW_BITS));
-        if((nRows - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-        {
-            *(rowBlocks - 1) |= numThreadsForReduction(i - last_i);
-        }
+    char* workspace = nullptr;
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&workspace, int_size * 4 + hipcub_size));
 
-        ++rowBlocks;
-    }
+    rocsparse_int* d_keys1   = reinterpret_cast<rocsparse_int*>(workspace);
+    rocsparse_int* d_keys2   = reinterpret_cast<rocsparse_int*>(workspace + int_size);
+    rocsparse_int* d_perm    = reinterpret_cast<rocsparse_int*>(workspace + int_size * 2);
+    rocsparse_int* d_coo_row = reinterpret_cast<rocsparse_int*>(workspace + int_size * 3);
+    void* hipcub_buffer      = reinterpret_cast<void*>(workspace + int_size * 4);
 
-    ++total_row_blocks;
+    // Transposed matrix pattern
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&info->csc_col_ptr, sizeof(rocsparse_int) * (n + 1)));
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&info->csc_row_ind, sizeof(rocsparse_int) * nnz));
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&info->csc_perm, sizeof(rocsparse_int) * nnz));
 
-    if(allocate_row_blocks)
-    {
-        size_t dist = std::distance(rowBlocksBase, rowBlocks);
-        assert((2 * dist) <= rowBlockSize);
-        // Update the size of rowBlocks to reflect the actual amount of memory used
-        // We're multiplying the size by two because the extended precision form of
-        // CSR-Adaptive requires more space for the final global reduction.
-        rowBlockSize = 2 * dist;
-    }
-    else
+    // Stable sort of the non-zero positions by column
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        d_keys1, csr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, nnz, info->csc_perm));
+
+    hipcub::DoubleBuffer<rocsparse_int> keys(d_keys1, d_keys2);
+    hipcub::DoubleBuffer<rocsparse_int> vals(info->csc_perm, d_perm);
+
+    RETURN_IF_HIP_ERROR(hipcub::DeviceRadixSort::SortPairs(
+        hipcub_buffer, hipcub_size, keys, vals, nnz, startbit, endbit, stream));
+
+    if(vals.Current() != info->csc_perm)
     {
-        rowBlockSize = 2 * total_row_blocks;
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csc_perm,
+                                           vals.Current(),
+                                           sizeof(rocsparse_int) * nnz,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
+
+    // Create column pointers
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_coo2csr(handle, keys.Current(), nnz, n, info->csc_col_ptr, idx_base));
+
+    // Create row indices
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2coo(handle, csr_row_ptr, nnz, m, d_coo_row, idx_base));
+
+#define CSRMVT_PERMUTE_DIM 512
+    dim3 permute_blocks((nnz - 1) / CSRMVT_PERMUTE_DIM + 1);
+    dim3 permute_threads(CSRMVT_PERMUTE_DIM);
+
+    hipLaunchKernelGGL((csrmvt_transpose_permute_kernel<CSRMVT_PERMUTE_DIM>),
+                       permute_blocks,
+                       permute_threads,
+                       0,
+                       stream,
+                       nnz,
+                       d_coo_row,
+                       info->csc_perm,
+                       info->csc_row_ind);
+#undef CSRMVT_PERMUTE_DIM
+
+    // Free temporary storage
+    RETURN_IF_HIP_ERROR(handle->deallocate(workspace));
+
+    return rocsparse_status_success;
 }
 
 template <typename T>
@@ -337,7 +466,9 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle handle,
     {
         return rocsparse_status_invalid_value;
     }
-    if(descr->type != rocsparse_matrix_type_general)
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_symmetric
+       && descr->type != rocsparse_matrix_type_hermitian)
     {
         // TODO
         return rocsparse_status_not_implemented;
@@ -356,6 +487,10 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle handle,
     {
         return rocsparse_status_invalid_size;
     }
+    else if(descr->type != rocsparse_matrix_type_general && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
 
     // Check pointer arguments
     if(csr_row_ptr == nullptr)
@@ -383,33 +518,28 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle handle,
     // Create csrmv info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(&info->csrmv_info));
 
-    // row blocks size
-    info->csrmv_info->size = 0;
+    // Device arrays of the analysis are served from the memory pool, which is kept
+    // alive by info until the arrays are returned
+    info->csrmv_info->pool   = handle->pool;
+    info->csrmv_info->stream = handle->stream;
 
-    // Temporary arrays to hold device data
-    std::vector<rocsparse_int> hptr(m + 1);
-    RETURN_IF_HIP_ERROR(hipMemcpy(
-        hptr.data(), csr_row_ptr, sizeof(rocsparse_int) * (m + 1), hipMemcpyDeviceToHost));
+    // Analyse the matrix for the requested algorithm
+    info->csrmv_info->alg = info->csrmv_alg;
 
-    // Determine row blocks array size
-    ComputeRowBlocks((unsigned long long*)NULL, info->csrmv_info->size, hptr.data(), m, false);
-
-    // Create row blocks structure
-    std::vector<unsigned long long> row_blocks(info->csrmv_info->size, 0);
-
-    ComputeRowBlocks(row_blocks.data(), info->csrmv_info->size, hptr.data(), m, true);
-
-    // Allocate memory on device to hold csrmv info, if required
-    if(info->csrmv_info->size > 0)
+    if(trans != rocsparse_operation_none && descr->type == rocsparse_matrix_type_general)
     {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csrmv_info->row_blocks,
-                                      sizeof(unsigned long long) * info->csrmv_info->size));
-
-        // Copy row blocks information to device
-        RETURN_IF_HIP_ERROR(hipMemcpy(info->csrmv_info->row_blocks,
-                                      row_blocks.data(),
-                                      sizeof(unsigned long long) * info->csrmv_info->size,
-                                      hipMemcpyHostToDevice));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmvt_analysis(
+            handle, m, n, nnz, csr_row_ptr, csr_col_ind, info->csrmv_info, descr->base));
+    }
+    else if(info->csrmv_alg == rocsparse_csrmv_alg_merge)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_merge_analysis<T>(
+            handle, m, nnz, csr_row_ptr, info->csrmv_info, descr->base));
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrmv_adaptive_analysis(handle, m, n, nnz, csr_row_ptr, info->csrmv_info));
     }
 
     // Store some pointers to verify correct execution
@@ -424,49 +554,50 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle handle,
     return rocsparse_status_success;
 }
 
-template <typename T, rocsparse_int WF_SIZE>
+template <typename T, typename A, rocsparse_int WF_SIZE>
 __global__ void csrmvn_general_kernel_host_pointer(rocsparse_int m,
                                                    T alpha,
                                                    const rocsparse_int* __restrict__ csr_row_ptr,
                                                    const rocsparse_int* __restrict__ csr_col_ind,
-                                                   const T* __restrict__ csr_val,
+                                                   const A* __restrict__ csr_val,
                                                    const T* __restrict__ x,
                                                    T beta,
                                                    T* __restrict__ y,
                                                    rocsparse_index_base idx_base)
 {
-    csrmvn_general_device<T, WF_SIZE>(
+    csrmvn_general_device<T, A, WF_SIZE>(
         m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
 }
 
-template <typename T, rocsparse_int WF_SIZE>
+template <typename T, typename A, rocsparse_int WF_SIZE>
 __global__ void csrmvn_general_kernel_device_pointer(rocsparse_int m,
                                                      const T* alpha,
                                                      const rocsparse_int* __restrict__ csr_row_ptr,
                                                      const rocsparse_int* __restrict__ csr_col_ind,
-                                                     const T* __restrict__ csr_val,
+                                                     const A* __restrict__ csr_val,
                                                      const T* __restrict__ x,
                                                      const T* beta,
                                                      T* __restrict__ y,
                                                      rocsparse_index_base idx_base)
 {
-    csrmvn_general_device<T, WF_SIZE>(
+    csrmvn_general_device<T, A, WF_SIZE>(
         m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename A>
 __launch_bounds__(WG_SIZE) __global__
     void csrmvn_adaptive_kernel_host_pointer(unsigned long long* __restrict__ row_blocks,
                                              T alpha,
                                              const rocsparse_int* __restrict__ csr_row_ptr,
                                              const rocsparse_int* __restrict__ csr_col_ind,
-                                             const T* __restrict__ csr_val,
+                                             const A* __restrict__ csr_val,
                                              const T* __restrict__ x,
                                              T beta,
                                              T* __restrict__ y,
                                              rocsparse_index_base idx_base)
 {
     csrmvn_adaptive_device<T,
+                           A,
                            BLOCKSIZE,
                            BLOCK_MULTIPLIER,
                            ROWS_FOR_VECTOR,
@@ -476,19 +607,20 @@ __launch_bounds__(WG_SIZE) __global__
         row_blocks, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename A>
 __launch_bounds__(WG_SIZE) __global__
     void csrmvn_adaptive_kernel_device_pointer(unsigned long long* __restrict__ row_blocks,
                                                const T* alpha,
                                                const rocsparse_int* __restrict__ csr_row_ptr,
                                                const rocsparse_int* __restrict__ csr_col_ind,
-                                               const T* __restrict__ csr_val,
+                                               const A* __restrict__ csr_val,
                                                const T* __restrict__ x,
                                                const T* beta,
                                                T* __restrict__ y,
                                                rocsparse_index_base idx_base)
 {
     csrmvn_adaptive_device<T,
+                           A,
                            BLOCKSIZE,
                            BLOCK_MULTIPLIER,
                            ROWS_FOR_VECTOR,
@@ -498,7 +630,283 @@ __launch_bounds__(WG_SIZE) __global__
         row_blocks, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
 }
 
+template <typename T, typename A>
+__launch_bounds__(MERGE_BLOCKSIZE) __global__
+    void csrmvn_merge_kernel_host_pointer(T alpha,
+                                          const rocsparse_int* __restrict__ csr_row_ptr,
+                                          const rocsparse_int* __restrict__ csr_col_ind,
+                                          const A* __restrict__ csr_val,
+                                          const rocsparse_int* __restrict__ merge_row,
+                                          const rocsparse_int* __restrict__ merge_nnz,
+                                          const T* __restrict__ x,
+                                          T beta,
+                                          T* __restrict__ y,
+                                          rocsparse_int* __restrict__ carry_row,
+                                          T* __restrict__ carry_val,
+                                          rocsparse_index_base idx_base)
+{
+    csrmvn_merge_device<T, A, MERGE_BLOCKSIZE, MERGE_ITEMS>(alpha,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            csr_val,
+                                                            merge_row,
+                                                            merge_nnz,
+                                                            x,
+                                                            beta,
+                                                            y,
+                                                            carry_row,
+                                                            carry_val,
+                                                            idx_base);
+}
+
+template <typename T, typename A>
+__launch_bounds__(MERGE_BLOCKSIZE) __global__
+    void csrmvn_merge_kernel_device_pointer(const T* alpha,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            const A* __restrict__ csr_val,
+                                            const rocsparse_int* __restrict__ merge_row,
+                                            const rocsparse_int* __restrict__ merge_nnz,
+                                            const T* __restrict__ x,
+                                            const T* beta,
+                                            T* __restrict__ y,
+                                            rocsparse_int* __restrict__ carry_row,
+                                            T* __restrict__ carry_val,
+                                            rocsparse_index_base idx_base)
+{
+    csrmvn_merge_device<T, A, MERGE_BLOCKSIZE, MERGE_ITEMS>(*alpha,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            csr_val,
+                                                            merge_row,
+                                                            merge_nnz,
+                                                            x,
+                                                            *beta,
+                                                            y,
+                                                            carry_row,
+                                                            carry_val,
+                                                            idx_base);
+}
+
 template <typename T>
+__global__ void csrmvt_scale_kernel_host_pointer(rocsparse_int size, T beta, T* __restrict__ y)
+{
+    csrmvt_scale_device(size, beta, y);
+}
+
+template <typename T>
+__global__ void csrmvt_scale_kernel_device_pointer(rocsparse_int size,
+                                                   const T* beta,
+                                                   T* __restrict__ y)
+{
+    csrmvt_scale_device(size, *beta, y);
+}
+
+template <typename T, typename A, rocsparse_int WF_SIZE>
+__global__ void csrmvt_general_kernel_host_pointer(rocsparse_int m,
+                                                   T alpha,
+                                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                                   const A* __restrict__ csr_val,
+                                                   const T* __restrict__ x,
+                                                   T* __restrict__ y,
+                                                   rocsparse_index_base idx_base)
+{
+    csrmvt_general_device<T, A, WF_SIZE>(
+        m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base);
+}
+
+template <typename T, typename A, rocsparse_int WF_SIZE>
+__global__ void csrmvt_general_kernel_device_pointer(rocsparse_int m,
+                                                     const T* alpha,
+                                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                                     const A* __restrict__ csr_val,
+                                                     const T* __restrict__ x,
+                                                     T* __restrict__ y,
+                                                     rocsparse_index_base idx_base)
+{
+    csrmvt_general_device<T, A, WF_SIZE>(
+        m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base);
+}
+
+template <typename T, typename A, rocsparse_int WF_SIZE>
+__global__ void csrmvt_transpose_kernel_host_pointer(rocsparse_int n,
+                                                     T alpha,
+                                                     const rocsparse_int* __restrict__ csc_col_ptr,
+                                                     const rocsparse_int* __restrict__ csc_row_ind,
+                                                     const rocsparse_int* __restrict__ csc_perm,
+                                                     const A* __restrict__ csr_val,
+                                                     const T* __restrict__ x,
+                                                     T beta,
+                                                     T* __restrict__ y,
+                                                     rocsparse_index_base idx_base)
+{
+    csrmvt_transpose_device<T, A, WF_SIZE>(
+        n, alpha, csc_col_ptr, csc_row_ind, csc_perm, csr_val, x, beta, y, idx_base);
+}
+
+template <typename T, typename A, rocsparse_int WF_SIZE>
+__global__ void
+    csrmvt_transpose_kernel_device_pointer(rocsparse_int n,
+                                           const T* alpha,
+                                           const rocsparse_int* __restrict__ csc_col_ptr,
+                                           const rocsparse_int* __restrict__ csc_row_ind,
+                                           const rocsparse_int* __restrict__ csc_perm,
+                                           const A* __restrict__ csr_val,
+                                           const T* __restrict__ x,
+                                           const T* beta,
+                                           T* __restrict__ y,
+                                           rocsparse_index_base idx_base)
+{
+    csrmvt_transpose_device<T, A, WF_SIZE>(
+        n, *alpha, csc_col_ptr, csc_row_ind, csc_perm, csr_val, x, *beta, y, idx_base);
+}
+
+template <typename T, typename A, rocsparse_int WF_SIZE>
+__global__ void csrmvn_symm_general_kernel_host_pointer(rocsparse_int m,
+                                                        T alpha,
+                                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                                        const rocsparse_int* __restrict__ csr_col_ind,
+                                                        const A* __restrict__ csr_val,
+                                                        const T* __restrict__ x,
+                                                        T* __restrict__ y,
+                                                        bool hermitian,
+                                                        rocsparse_index_base idx_base)
+{
+    csrmvn_symm_general_device<T, A, WF_SIZE>(
+        m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, hermitian, idx_base);
+}
+
+template <typename T, typename A, rocsparse_int WF_SIZE>
+__global__ void
+    csrmvn_symm_general_kernel_device_pointer(rocsparse_int m,
+                                              const T* alpha,
+                                              const rocsparse_int* __restrict__ csr_row_ptr,
+                                              const rocsparse_int* __restrict__ csr_col_ind,
+                                              const A* __restrict__ csr_val,
+                                              const T* __restrict__ x,
+                                              T* __restrict__ y,
+                                              bool hermitian,
+                                              rocsparse_index_base idx_base)
+{
+    csrmvn_symm_general_device<T, A, WF_SIZE>(
+        m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, hermitian, idx_base);
+}
+
+template <typename T, typename A, rocsparse_int WF_SIZE>
+__global__ void csrmvn_symm_scatter_kernel_host_pointer(rocsparse_int m,
+                                                        T alpha,
+                                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                                        const rocsparse_int* __restrict__ csr_col_ind,
+                                                        const A* __restrict__ csr_val,
+                                                        const T* __restrict__ x,
+                                                        T* __restrict__ y,
+                                                        bool hermitian,
+                                                        rocsparse_index_base idx_base)
+{
+    csrmvn_symm_scatter_device<T, A, WF_SIZE>(
+        m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, hermitian, idx_base);
+}
+
+template <typename T, typename A, rocsparse_int WF_SIZE>
+__global__ void
+    csrmvn_symm_scatter_kernel_device_pointer(rocsparse_int m,
+                                              const T* alpha,
+                                              const rocsparse_int* __restrict__ csr_row_ptr,
+                                              const rocsparse_int* __restrict__ csr_col_ind,
+                                              const A* __restrict__ csr_val,
+                                              const T* __restrict__ x,
+                                              T* __restrict__ y,
+                                              bool hermitian,
+                                              rocsparse_index_base idx_base)
+{
+    csrmvn_symm_scatter_device<T, A, WF_SIZE>(
+        m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, hermitian, idx_base);
+}
+
+template <typename T, rocsparse_int K, rocsparse_int WF_SIZE>
+__global__ void csrmvn_multi_general_kernel_host_pointer(rocsparse_int m,
+                                                         rocsparse_int k,
+                                                         T alpha,
+                                                         const rocsparse_int* __restrict__ csr_row_ptr,
+                                                         const rocsparse_int* __restrict__ csr_col_ind,
+                                                         const T* __restrict__ csr_val,
+                                                         const T* __restrict__ x,
+                                                         T beta,
+                                                         T* __restrict__ y,
+                                                         rocsparse_index_base idx_base)
+{
+    csrmvn_multi_general_device<T, K, WF_SIZE>(
+        m, k, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
+}
+
+template <typename T, rocsparse_int K, rocsparse_int WF_SIZE>
+__global__ void
+    csrmvn_multi_general_kernel_device_pointer(rocsparse_int m,
+                                               rocsparse_int k,
+                                               const T* alpha,
+                                               const rocsparse_int* __restrict__ csr_row_ptr,
+                                               const rocsparse_int* __restrict__ csr_col_ind,
+                                               const T* __restrict__ csr_val,
+                                               const T* __restrict__ x,
+                                               const T* beta,
+                                               T* __restrict__ y,
+                                               rocsparse_index_base idx_base)
+{
+    csrmvn_multi_general_device<T, K, WF_SIZE>(
+        m, k, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
+}
+
+template <typename T, rocsparse_int K>
+__launch_bounds__(WG_SIZE) __global__
+    void csrmvn_multi_adaptive_kernel_host_pointer(rocsparse_int k,
+                                                   unsigned long long* __restrict__ row_blocks,
+                                                   T alpha,
+                                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                                   const T* __restrict__ csr_val,
+                                                   const T* __restrict__ x,
+                                                   T beta,
+                                                   T* __restrict__ y,
+                                                   rocsparse_index_base idx_base)
+{
+    csrmvn_multi_adaptive_device<T,
+                                 K,
+                                 BLOCKSIZE,
+                                 BLOCK_MULTIPLIER,
+                                 ROWS_FOR_VECTOR,
+                                 WG_BITS,
+                                 ROW_BITS,
+                                 WG_SIZE>(
+        k, row_blocks, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
+}
+
+template <typename T, rocsparse_int K>
+__launch_bounds__(WG_SIZE) __global__
+    void csrmvn_multi_adaptive_kernel_device_pointer(rocsparse_int k,
+                                                     unsigned long long* __restrict__ row_blocks,
+                                                     const T* alpha,
+                                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                                     const T* __restrict__ csr_val,
+                                                     const T* __restrict__ x,
+                                                     const T* beta,
+                                                     T* __restrict__ y,
+                                                     rocsparse_index_base idx_base)
+{
+    csrmvn_multi_adaptive_device<T,
+                                 K,
+                                 BLOCKSIZE,
+                                 BLOCK_MULTIPLIER,
+                                 ROWS_FOR_VECTOR,
+                                 WG_BITS,
+                                 ROW_BITS,
+                                 WG_SIZE>(
+        k, row_blocks, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
+}
+
+template <typename T, typename A>
 rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
                                           rocsparse_operation trans,
                                           rocsparse_int m,
@@ -506,7 +914,7 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
                                           rocsparse_int nnz,
                                           const T* alpha,
                                           const rocsparse_mat_descr descr,
-                                          const T* csr_val,
+                                          const A* csr_val,
                                           const rocsparse_int* csr_row_ptr,
                                           const rocsparse_int* csr_col_ind,
                                           rocsparse_mat_info info,
@@ -528,7 +936,7 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrmv"),
+                  replaceX<T, A>("rocsparse_Xcsrmv"),
                   trans,
                   m,
                   n,
@@ -543,8 +951,10 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
                   (const void*&)y,
                   (const void*&)info);
 
+        // Mixed precision is benchmarked by csrmv_mixed in the precision of the vectors
         log_bench(handle,
-                  "./rocsparse-bench -f csrmv -r",
+                  std::is_same<T, A>::value ? "./rocsparse-bench -f csrmv -r"
+                                            : "./rocsparse-bench -f csrmv_mixed -r",
                   replaceX<T>("X"),
                   "--mtx <matrix.mtx> "
                   "--alpha",
@@ -555,7 +965,7 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrmv"),
+                  replaceX<T, A>("rocsparse_Xcsrmv"),
                   trans,
                   m,
                   n,
@@ -575,12 +985,25 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
     {
         return rocsparse_status_invalid_value;
     }
-    if(descr->type != rocsparse_matrix_type_general)
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_symmetric
+       && descr->type != rocsparse_matrix_type_hermitian)
     {
         // TODO
         return rocsparse_status_not_implemented;
     }
 
+    // Symmetric and hermitian matrices satisfy op(A) == A, unless op conjugates the
+    // values of a complex matrix, that is A^H of a symmetric or A^T of a hermitian one
+    if(!std::is_floating_point<T>::value
+       && ((descr->type == rocsparse_matrix_type_symmetric
+            && trans == rocsparse_operation_conjugate_transpose)
+           || (descr->type == rocsparse_matrix_type_hermitian
+               && trans == rocsparse_operation_transpose)))
+    {
+        return rocsparse_status_not_implemented;
+    }
+
     // Check sizes
     if(m < 0)
     {
@@ -594,6 +1017,10 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
     {
         return rocsparse_status_invalid_size;
     }
+    else if(descr->type != rocsparse_matrix_type_general && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
 
     // Check pointer arguments
     if(csr_val == nullptr)
@@ -643,6 +1070,42 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
         return rocsparse_csrmv_general_template(
             handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
     }
+    else if(trans != rocsparse_operation_none && descr->type == rocsparse_matrix_type_general)
+    {
+        // Transposed product, either scattered or using the cached transpose
+        return rocsparse_csrmvt_template(handle,
+                                         trans,
+                                         m,
+                                         n,
+                                         nnz,
+                                         alpha,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         info->csrmv_info,
+                                         x,
+                                         beta,
+                                         y);
+    }
+    else if(info->csrmv_info->alg == rocsparse_csrmv_alg_merge)
+    {
+        // If csrmv info holds merge path partitions, call csrmv merge
+        return rocsparse_csrmv_merge_template(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              nnz,
+                                              alpha,
+                                              descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              info->csrmv_info,
+                                              x,
+                                              beta,
+                                              y);
+    }
     else
     {
         // If csrmv info is available, call csrmv adaptive
@@ -663,7 +1126,7 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
     }
 }
 
-template <typename T>
+template <typename T, typename A>
 rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                                                   rocsparse_operation trans,
                                                   rocsparse_int m,
@@ -671,13 +1134,20 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                                                   rocsparse_int nnz,
                                                   const T* alpha,
                                                   const rocsparse_mat_descr descr,
-                                                  const T* csr_val,
+                                                  const A* csr_val,
                                                   const rocsparse_int* csr_row_ptr,
                                                   const rocsparse_int* csr_col_ind,
                                                   const T* x,
                                                   const T* beta,
                                                   T* y)
 {
+    // Symmetric matrices only store one triangle, op(A) == A has been verified before
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_csrmv_symm_general_template(
+            handle, m, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -696,7 +1166,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
             {
                 if(nnz_per_row < 4)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 2>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, A, 2>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -713,7 +1183,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 8)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 4>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, A, 4>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -730,7 +1200,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 16)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 8>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, A, 8>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -747,7 +1217,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 32)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 16>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, A, 16>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -764,7 +1234,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 32>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, A, 32>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -784,7 +1254,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
             {
                 if(nnz_per_row < 4)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 2>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, A, 2>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -801,7 +1271,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 8)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 4>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, A, 4>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -818,7 +1288,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 16)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 8>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, A, 8>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -835,7 +1305,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 32)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 16>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, A, 16>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -852,7 +1322,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 64)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 32>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, A, 32>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -869,7 +1339,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 64>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, A, 64>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -901,7 +1371,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
             {
                 if(nnz_per_row < 4)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 2>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, A, 2>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -918,7 +1388,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 8)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 4>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, A, 4>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -935,7 +1405,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 16)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 8>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, A, 8>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -952,7 +1422,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 32)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 16>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, A, 16>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -969,7 +1439,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 32>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, A, 32>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -989,7 +1459,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
             {
                 if(nnz_per_row < 4)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 2>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, A, 2>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -1006,7 +1476,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 8)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 4>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, A, 4>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -1023,7 +1493,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 16)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 8>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, A, 8>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -1040,7 +1510,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 32)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 16>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, A, 16>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -1057,7 +1527,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 64)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 32>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, A, 32>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -1074,7 +1544,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 64>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, A, 64>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -1099,13 +1569,14 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
     }
     else
     {
-        // TODO
-        return rocsparse_status_not_implemented;
+        // Transposed product, scatter rows into y
+        return rocsparse_csrmvt_general_template(
+            handle, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
     }
     return rocsparse_status_success;
 }
 
-template <typename T>
+template <typename T, typename A>
 rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle handle,
                                                    rocsparse_operation trans,
                                                    rocsparse_int m,
@@ -1113,7 +1584,7 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle handle,
                                                    rocsparse_int nnz,
                                                    const T* alpha,
                                                    const rocsparse_mat_descr descr,
-                                                   const T* csr_val,
+                                                   const A* csr_val,
                                                    const rocsparse_int* csr_row_ptr,
                                                    const rocsparse_int* csr_col_ind,
                                                    rocsparse_csrmv_info info,
@@ -1154,15 +1625,15 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle handle,
     // Stream
     hipStream_t stream = handle->stream;
 
-    // Run different csrmv kernels
-    if(trans == rocsparse_operation_none)
+    // Run different csrmv kernels, symmetric matrices satisfy op(A) == A, see csrmv_template
+    if(trans == rocsparse_operation_none || descr->type != rocsparse_matrix_type_general)
     {
         dim3 csrmvn_blocks((info->size / 2) - 1);
         dim3 csrmvn_threads(WG_SIZE);
 
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            hipLaunchKernelGGL((csrmvn_adaptive_kernel_device_pointer<T>),
+            hipLaunchKernelGGL((csrmvn_adaptive_kernel_device_pointer<T, A>),
                                csrmvn_blocks,
                                csrmvn_threads,
                                0,
@@ -1184,7 +1655,7 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle handle,
                 return rocsparse_status_success;
             }
 
-            hipLaunchKernelGGL((csrmvn_adaptive_kernel_host_pointer<T>),
+            hipLaunchKernelGGL((csrmvn_adaptive_kernel_host_pointer<T, A>),
                                csrmvn_blocks,
                                csrmvn_threads,
                                0,
@@ -1199,6 +1670,13 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle handle,
                                y,
                                descr->base);
         }
+
+        // Scatter the triangle that is not stored
+        if(descr->type != rocsparse_matrix_type_general)
+        {
+            return rocsparse_csrmv_symm_scatter_template(
+                handle, m, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+        }
     }
     else
     {
@@ -1208,4 +1686,1114 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle handle,
     return rocsparse_status_success;
 }
 
+template <typename T, typename A>
+rocsparse_status rocsparse_csrmv_merge_template(rocsparse_handle handle,
+                                                rocsparse_operation trans,
+                                                rocsparse_int m,
+                                                rocsparse_int n,
+                                                rocsparse_int nnz,
+                                                const T* alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const A* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                rocsparse_csrmv_info info,
+                                                const T* x,
+                                                const T* beta,
+                                                T* y)
+{
+    // Check if info matches current matrix and options
+    if(info->trans != trans)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(info->m != m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(info->n != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(info->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(info->descr != descr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(info->csr_row_ptr != csr_row_ptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info->csr_col_ind != csr_col_ind)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Run different csrmv kernels, symmetric matrices satisfy op(A) == A, see csrmv_template
+    if(trans == rocsparse_operation_none || descr->type != rocsparse_matrix_type_general)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            if(*alpha == 0.0 && *beta == 1.0)
+            {
+                return rocsparse_status_success;
+            }
+        }
+
+        // The carry-out buffer of the analysis holds values of the matrix value type,
+        // mixed precision products carry out values of the wider vector type instead
+        T* carry_val = (T*)info->carry_val;
+
+        if(sizeof(T) > sizeof(A))
+        {
+            RETURN_IF_HIP_ERROR(handle->allocate((void**)&carry_val, sizeof(T) * info->nparts));
+        }
+
+        dim3 csrmvn_blocks(info->nparts);
+        dim3 csrmvn_threads(MERGE_BLOCKSIZE);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrmvn_merge_kernel_device_pointer<T, A>),
+                               csrmvn_blocks,
+                               csrmvn_threads,
+                               0,
+                               stream,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               info->merge_row,
+                               info->merge_nnz,
+                               x,
+                               beta,
+                               y,
+                               info->carry_row,
+                               carry_val,
+                               descr->base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrmvn_merge_kernel_host_pointer<T, A>),
+                               csrmvn_blocks,
+                               csrmvn_threads,
+                               0,
+                               stream,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               info->merge_row,
+                               info->merge_nnz,
+                               x,
+                               *beta,
+                               y,
+                               info->carry_row,
+                               carry_val,
+                               descr->base);
+        }
+
+        // Add carry-outs of rows that span multiple partitions. Consecutive partitions
+        // carry out into the same row, thus carry-outs are reduced by row first.
+        rocsparse_int* run_row;
+        rocsparse_int* nruns;
+        T* run_val;
+
+        RETURN_IF_HIP_ERROR(
+            handle->allocate((void**)&run_row, sizeof(rocsparse_int) * (info->nparts + 1)));
+        RETURN_IF_HIP_ERROR(handle->allocate((void**)&run_val, sizeof(T) * info->nparts));
+
+        nruns = run_row + info->nparts;
+
+        size_t temp_size;
+        void* temp_buffer;
+
+        RETURN_IF_HIP_ERROR(hipcub::DeviceReduce::ReduceByKey(nullptr,
+                                                              temp_size,
+                                                              info->carry_row,
+                                                              run_row,
+                                                              carry_val,
+                                                              run_val,
+                                                              nruns,
+                                                              hipcub::Sum(),
+                                                              info->nparts,
+                                                              stream));
+        RETURN_IF_HIP_ERROR(handle->allocate(&temp_buffer, temp_size));
+        RETURN_IF_HIP_ERROR(hipcub::DeviceReduce::ReduceByKey(temp_buffer,
+                                                              temp_size,
+                                                              info->carry_row,
+                                                              run_row,
+                                                              carry_val,
+                                                              run_val,
+                                                              nruns,
+                                                              hipcub::Sum(),
+                                                              info->nparts,
+                                                              stream));
+        RETURN_IF_HIP_ERROR(handle->deallocate(temp_buffer));
+
+#define CSRMVN_FIXUP_DIM 256
+        dim3 fixup_blocks((info->nparts - 1) / CSRMVN_FIXUP_DIM + 1);
+        dim3 fixup_threads(CSRMVN_FIXUP_DIM);
+
+        hipLaunchKernelGGL((csrmvn_merge_fixup_kernel<T, CSRMVN_FIXUP_DIM>),
+                           fixup_blocks,
+                           fixup_threads,
+                           0,
+                           stream,
+                           m,
+                           nruns,
+                           run_row,
+                           run_val,
+                           y);
+#undef CSRMVN_FIXUP_DIM
+
+        RETURN_IF_HIP_ERROR(handle->deallocate(run_val));
+        RETURN_IF_HIP_ERROR(handle->deallocate(run_row));
+
+        if(carry_val != info->carry_val)
+        {
+            RETURN_IF_HIP_ERROR(handle->deallocate(carry_val));
+        }
+
+        // Scatter the triangle that is not stored
+        if(descr->type != rocsparse_matrix_type_general)
+        {
+            return rocsparse_csrmv_symm_scatter_template(
+                handle, m, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+        }
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    return rocsparse_status_success;
+}
+
+template <typename T>
+static void rocsparse_csrmv_scale_launch(rocsparse_handle handle,
+                                         rocsparse_int size,
+                                         const T* beta,
+                                         T* y)
+{
+#define CSRMV_SCALE_DIM 1024
+    dim3 scale_blocks((size - 1) / CSRMV_SCALE_DIM + 1);
+    dim3 scale_threads(CSRMV_SCALE_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmvt_scale_kernel_device_pointer<T>),
+                           scale_blocks,
+                           scale_threads,
+                           0,
+                           handle->stream,
+                           size,
+                           beta,
+                           y);
+    }
+    else if(*beta != static_cast<T>(1))
+    {
+        hipLaunchKernelGGL((csrmvt_scale_kernel_host_pointer<T>),
+                           scale_blocks,
+                           scale_threads,
+                           0,
+                           handle->stream,
+                           size,
+                           *beta,
+                           y);
+    }
+#undef CSRMV_SCALE_DIM
+}
+
+template <typename T, typename A, rocsparse_int WF_SIZE>
+static void rocsparse_csrmvt_general_launch(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            const T* alpha,
+                                            const rocsparse_mat_descr descr,
+                                            const A* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            const T* x,
+                                            T* y)
+{
+#define CSRMVT_DIM 512
+    dim3 csrmvt_blocks((m - 1) / CSRMVT_DIM + 1);
+    dim3 csrmvt_threads(CSRMVT_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmvt_general_kernel_device_pointer<T, A, WF_SIZE>),
+                           csrmvt_blocks,
+                           csrmvt_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmvt_general_kernel_host_pointer<T, A, WF_SIZE>),
+                           csrmvt_blocks,
+                           csrmvt_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           *alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y,
+                           descr->base);
+    }
+#undef CSRMVT_DIM
+}
+
+template <typename T, typename A>
+rocsparse_status rocsparse_csrmvt_general_template(rocsparse_handle handle,
+                                                   rocsparse_int m,
+                                                   rocsparse_int n,
+                                                   rocsparse_int nnz,
+                                                   const T* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const A* csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   const T* x,
+                                                   const T* beta,
+                                                   T* y)
+{
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        if(*alpha == 0.0 && *beta == 1.0)
+        {
+            return rocsparse_status_success;
+        }
+    }
+
+    // Scale y with beta
+    rocsparse_csrmv_scale_launch(handle, n, beta, y);
+
+    // Scatter rows into y
+    rocsparse_int nnz_per_row = nnz / m;
+
+    if(nnz_per_row < 4)
+    {
+        rocsparse_csrmvt_general_launch<T, A, 2>(
+            handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else if(nnz_per_row < 8)
+    {
+        rocsparse_csrmvt_general_launch<T, A, 4>(
+            handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else if(nnz_per_row < 16)
+    {
+        rocsparse_csrmvt_general_launch<T, A, 8>(
+            handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else if(nnz_per_row < 32)
+    {
+        rocsparse_csrmvt_general_launch<T, A, 16>(
+            handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        rocsparse_csrmvt_general_launch<T, A, 32>(
+            handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else
+    {
+        rocsparse_csrmvt_general_launch<T, A, 64>(
+            handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename A, rocsparse_int WF_SIZE>
+static void rocsparse_csrmvt_transpose_launch(rocsparse_handle handle,
+                                              rocsparse_int n,
+                                              const T* alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const A* csr_val,
+                                              rocsparse_csrmv_info info,
+                                              const T* x,
+                                              const T* beta,
+                                              T* y)
+{
+#define CSRMVT_DIM 512
+    dim3 csrmvt_blocks((n - 1) / CSRMVT_DIM + 1);
+    dim3 csrmvt_threads(CSRMVT_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmvt_transpose_kernel_device_pointer<T, A, WF_SIZE>),
+                           csrmvt_blocks,
+                           csrmvt_threads,
+                           0,
+                           handle->stream,
+                           n,
+                           alpha,
+                           info->csc_col_ptr,
+                           info->csc_row_ind,
+                           info->csc_perm,
+                           csr_val,
+                           x,
+                           beta,
+                           y,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmvt_transpose_kernel_host_pointer<T, A, WF_SIZE>),
+                           csrmvt_blocks,
+                           csrmvt_threads,
+                           0,
+                           handle->stream,
+                           n,
+                           *alpha,
+                           info->csc_col_ptr,
+                           info->csc_row_ind,
+                           info->csc_perm,
+                           csr_val,
+                           x,
+                           *beta,
+                           y,
+                           descr->base);
+    }
+#undef CSRMVT_DIM
+}
+
+template <typename T, typename A>
+rocsparse_status rocsparse_csrmvt_template(rocsparse_handle handle,
+                                           rocsparse_operation trans,
+                                           rocsparse_int m,
+                                           rocsparse_int n,
+                                           rocsparse_int nnz,
+                                           const T* alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const A* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_csrmv_info info,
+                                           const T* x,
+                                           const T* beta,
+                                           T* y)
+{
+    // Check if info matches current matrix and options
+    if(info->trans != trans)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(info->m != m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(info->n != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(info->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(info->descr != descr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(info->csr_row_ptr != csr_row_ptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info->csr_col_ind != csr_col_ind)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // If the transpose has not been cached, scatter rows into y
+    if(info->csc_perm == nullptr)
+    {
+        return rocsparse_csrmvt_general_template(
+            handle, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        if(*alpha == 0.0 && *beta == 1.0)
+        {
+            return rocsparse_status_success;
+        }
+    }
+
+    // Gather columns of A, one wavefront segment per column
+    rocsparse_int nnz_per_col = nnz / n;
+
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+    else if(nnz_per_col < 4)
+    {
+        rocsparse_csrmvt_transpose_launch<T, A, 2>(
+            handle, n, alpha, descr, csr_val, info, x, beta, y);
+    }
+    else if(nnz_per_col < 8)
+    {
+        rocsparse_csrmvt_transpose_launch<T, A, 4>(
+            handle, n, alpha, descr, csr_val, info, x, beta, y);
+    }
+    else if(nnz_per_col < 16)
+    {
+        rocsparse_csrmvt_transpose_launch<T, A, 8>(
+            handle, n, alpha, descr, csr_val, info, x, beta, y);
+    }
+    else if(nnz_per_col < 32)
+    {
+        rocsparse_csrmvt_transpose_launch<T, A, 16>(
+            handle, n, alpha, descr, csr_val, info, x, beta, y);
+    }
+    else if(nnz_per_col < 64 || handle->wavefront_size == 32)
+    {
+        rocsparse_csrmvt_transpose_launch<T, A, 32>(
+            handle, n, alpha, descr, csr_val, info, x, beta, y);
+    }
+    else
+    {
+        rocsparse_csrmvt_transpose_launch<T, A, 64>(
+            handle, n, alpha, descr, csr_val, info, x, beta, y);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename A, rocsparse_int WF_SIZE>
+static void rocsparse_csrmv_symm_launch(rocsparse_handle handle,
+                                        bool scatter_only,
+                                        rocsparse_int m,
+                                        const T* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const A* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        const T* x,
+                                        T* y)
+{
+#define CSRMVN_SYMM_DIM 512
+    dim3 csrmvn_blocks((m - 1) / CSRMVN_SYMM_DIM + 1);
+    dim3 csrmvn_threads(CSRMVN_SYMM_DIM);
+
+    // Hermitian matrices mirror the conjugate of the stored triangle
+    bool hermitian = (descr->type == rocsparse_matrix_type_hermitian);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        if(scatter_only)
+        {
+            hipLaunchKernelGGL((csrmvn_symm_scatter_kernel_device_pointer<T, A, WF_SIZE>),
+                               csrmvn_blocks,
+                               csrmvn_threads,
+                               0,
+                               handle->stream,
+                               m,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               hermitian,
+                               descr->base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrmvn_symm_general_kernel_device_pointer<T, A, WF_SIZE>),
+                               csrmvn_blocks,
+                               csrmvn_threads,
+                               0,
+                               handle->stream,
+                               m,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               hermitian,
+                               descr->base);
+        }
+    }
+    else
+    {
+        if(scatter_only)
+        {
+            hipLaunchKernelGGL((csrmvn_symm_scatter_kernel_host_pointer<T, A, WF_SIZE>),
+                               csrmvn_blocks,
+                               csrmvn_threads,
+                               0,
+                               handle->stream,
+                               m,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               hermitian,
+                               descr->base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrmvn_symm_general_kernel_host_pointer<T, A, WF_SIZE>),
+                               csrmvn_blocks,
+                               csrmvn_threads,
+                               0,
+                               handle->stream,
+                               m,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               hermitian,
+                               descr->base);
+        }
+    }
+#undef CSRMVN_SYMM_DIM
+}
+
+template <typename T, typename A>
+static rocsparse_status rocsparse_csrmv_symm_dispatch(rocsparse_handle handle,
+                                                      bool scatter_only,
+                                                      rocsparse_int m,
+                                                      rocsparse_int nnz,
+                                                      const T* alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const A* csr_val,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      const T* x,
+                                                      T* y)
+{
+    rocsparse_int nnz_per_row = nnz / m;
+
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+    else if(nnz_per_row < 4)
+    {
+        rocsparse_csrmv_symm_launch<T, A, 2>(
+            handle, scatter_only, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else if(nnz_per_row < 8)
+    {
+        rocsparse_csrmv_symm_launch<T, A, 4>(
+            handle, scatter_only, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else if(nnz_per_row < 16)
+    {
+        rocsparse_csrmv_symm_launch<T, A, 8>(
+            handle, scatter_only, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else if(nnz_per_row < 32)
+    {
+        rocsparse_csrmv_symm_launch<T, A, 16>(
+            handle, scatter_only, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        rocsparse_csrmv_symm_launch<T, A, 32>(
+            handle, scatter_only, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else
+    {
+        rocsparse_csrmv_symm_launch<T, A, 64>(
+            handle, scatter_only, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename A>
+rocsparse_status rocsparse_csrmv_symm_general_template(rocsparse_handle handle,
+                                                       rocsparse_int m,
+                                                       rocsparse_int nnz,
+                                                       const T* alpha,
+                                                       const rocsparse_mat_descr descr,
+                                                       const A* csr_val,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       const T* x,
+                                                       const T* beta,
+                                                       T* y)
+{
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        if(*alpha == 0.0 && *beta == 1.0)
+        {
+            return rocsparse_status_success;
+        }
+    }
+
+    // Scale y with beta, rows are accumulated into y by the symmetric kernel
+    rocsparse_csrmv_scale_launch(handle, m, beta, y);
+
+    // Gather and scatter each row of the stored triangle in a single pass
+    return rocsparse_csrmv_symm_dispatch(
+        handle, false, m, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+}
+
+template <typename T, typename A>
+rocsparse_status rocsparse_csrmv_symm_scatter_template(rocsparse_handle handle,
+                                                       rocsparse_int m,
+                                                       rocsparse_int nnz,
+                                                       const T* alpha,
+                                                       const rocsparse_mat_descr descr,
+                                                       const A* csr_val,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       const T* x,
+                                                       T* y)
+{
+    // Scatter the off-diagonal entries of the stored triangle
+    return rocsparse_csrmv_symm_dispatch(
+        handle, true, m, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+}
+
+template <typename T, rocsparse_int K, rocsparse_int WF_SIZE>
+static void rocsparse_csrmv_multi_general_launch(rocsparse_handle handle,
+                                                 rocsparse_int m,
+                                                 rocsparse_int k,
+                                                 const T* alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T* csr_val,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 const rocsparse_int* csr_col_ind,
+                                                 const T* x,
+                                                 const T* beta,
+                                                 T* y)
+{
+#define CSRMVN_MULTI_DIM 256
+    dim3 csrmvn_blocks((m - 1) / (CSRMVN_MULTI_DIM / WF_SIZE) + 1);
+    dim3 csrmvn_threads(CSRMVN_MULTI_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmvn_multi_general_kernel_device_pointer<T, K, WF_SIZE>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           k,
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           beta,
+                           y,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmvn_multi_general_kernel_host_pointer<T, K, WF_SIZE>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           k,
+                           *alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           *beta,
+                           y,
+                           descr->base);
+    }
+#undef CSRMVN_MULTI_DIM
+}
+
+template <typename T, rocsparse_int K>
+static rocsparse_status rocsparse_csrmv_multi_dispatch(rocsparse_handle handle,
+                                                       rocsparse_int m,
+                                                       rocsparse_int nnz,
+                                                       rocsparse_int k,
+                                                       const T* alpha,
+                                                       const rocsparse_mat_descr descr,
+                                                       const T* csr_val,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       rocsparse_csrmv_info info,
+                                                       const T* x,
+                                                       const T* beta,
+                                                       T* y)
+{
+    if(info != nullptr && info->row_blocks != nullptr)
+    {
+        // Row blocks are available, each row of A is read once by a single workgroup
+        dim3 csrmvn_blocks((info->size / 2) - 1);
+        dim3 csrmvn_threads(WG_SIZE);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrmvn_multi_adaptive_kernel_device_pointer<T, K>),
+                               csrmvn_blocks,
+                               csrmvn_threads,
+                               0,
+                               handle->stream,
+                               k,
+                               info->row_blocks,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               beta,
+                               y,
+                               descr->base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrmvn_multi_adaptive_kernel_host_pointer<T, K>),
+                               csrmvn_blocks,
+                               csrmvn_threads,
+                               0,
+                               handle->stream,
+                               k,
+                               info->row_blocks,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               *beta,
+                               y,
+                               descr->base);
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Without row blocks, each row is processed by a (sub-)wavefront
+    rocsparse_int nnz_per_row = nnz / m;
+
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+    else if(nnz_per_row < 4)
+    {
+        rocsparse_csrmv_multi_general_launch<T, K, 2>(
+            handle, m, k, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+    else if(nnz_per_row < 8)
+    {
+        rocsparse_csrmv_multi_general_launch<T, K, 4>(
+            handle, m, k, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+    else if(nnz_per_row < 16)
+    {
+        rocsparse_csrmv_multi_general_launch<T, K, 8>(
+            handle, m, k, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+    else if(nnz_per_row < 32)
+    {
+        rocsparse_csrmv_multi_general_launch<T, K, 16>(
+            handle, m, k, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        rocsparse_csrmv_multi_general_launch<T, K, 32>(
+            handle, m, k, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+    else
+    {
+        rocsparse_csrmv_multi_general_launch<T, K, 64>(
+            handle, m, k, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_multi_template(rocsparse_handle handle,
+                                                rocsparse_operation trans,
+                                                rocsparse_int m,
+                                                rocsparse_int n,
+                                                rocsparse_int nnz,
+                                                rocsparse_int k,
+                                                const T* alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                rocsparse_mat_info info,
+                                                const T* x,
+                                                const T* beta,
+                                                T* y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_multi"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  k,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrmv_multi -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--sizek",
+                  k,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_multi"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  k,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0 || k > 16)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0 || k == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        if(*alpha == 0.0 && *beta == 1.0)
+        {
+            return rocsparse_status_success;
+        }
+    }
+
+    // Row blocks of the csrmv analysis, if available
+    rocsparse_csrmv_info csrmv_info = (info != nullptr) ? info->csrmv_info : nullptr;
+
+    if(csrmv_info != nullptr)
+    {
+        // Check if info matches current matrix and options
+        if(csrmv_info->trans != trans)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(csrmv_info->m != m)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(csrmv_info->n != n)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(csrmv_info->nnz != nnz)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(csrmv_info->descr != descr)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(csrmv_info->csr_row_ptr != csr_row_ptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(csrmv_info->csr_col_ind != csr_col_ind)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    // Number of accumulators per row, rounded up to the next power of two
+    if(k <= 2)
+    {
+        return rocsparse_csrmv_multi_dispatch<T, 2>(handle,
+                                                    m,
+                                                    nnz,
+                                                    k,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    csrmv_info,
+                                                    x,
+                                                    beta,
+                                                    y);
+    }
+    else if(k <= 4)
+    {
+        return rocsparse_csrmv_multi_dispatch<T, 4>(handle,
+                                                    m,
+                                                    nnz,
+                                                    k,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    csrmv_info,
+                                                    x,
+                                                    beta,
+                                                    y);
+    }
+    else if(k <= 8)
+    {
+        return rocsparse_csrmv_multi_dispatch<T, 8>(handle,
+                                                    m,
+                                                    nnz,
+                                                    k,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    csrmv_info,
+                                                    x,
+                                                    beta,
+                                                    y);
+    }
+    else
+    {
+        return rocsparse_csrmv_multi_dispatch<T, 16>(handle,
+                                                     m,
+                                                     nnz,
+                                                     k,
+                                                     alpha,
+                                                     descr,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     csrmv_info,
+                                                     x,
+                                                     beta,
+                                                     y);
+    }
+}
+
 #endif // ROCSPARSE_CSRMV_HPP
@@ -62,6 +62,36 @@ extern "C" rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle handle
         handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
 }
 
+extern "C" rocsparse_status rocsparse_ccsrsv_buffer_size(rocsparse_handle handle,
+                                                         rocsparse_operation trans,
+                                                         rocsparse_int m,
+                                                         rocsparse_int nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const rocsparse_float_complex* csr_val,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         const rocsparse_int* csr_col_ind,
+                                                         rocsparse_mat_info info,
+                                                         size_t* buffer_size)
+{
+    return rocsparse_csrsv_buffer_size_template<rocsparse_float_complex>(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrsv_buffer_size(rocsparse_handle handle,
+                                                         rocsparse_operation trans,
+                                                         rocsparse_int m,
+                                                         rocsparse_int nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const rocsparse_double_complex* csr_val,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         const rocsparse_int* csr_col_ind,
+                                                         rocsparse_mat_info info,
+                                                         size_t* buffer_size)
+{
+    return rocsparse_csrsv_buffer_size_template<rocsparse_double_complex>(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
 extern "C" rocsparse_status rocsparse_scsrsv_analysis(rocsparse_handle handle,
                                                       rocsparse_operation trans,
                                                       rocsparse_int m,
@@ -116,6 +146,60 @@ extern "C" rocsparse_status rocsparse_dcsrsv_analysis(rocsparse_handle handle,
                                                      temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_ccsrsv_analysis(rocsparse_handle handle,
+                                                      rocsparse_operation trans,
+                                                      rocsparse_int m,
+                                                      rocsparse_int nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const rocsparse_float_complex* csr_val,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      rocsparse_mat_info info,
+                                                      rocsparse_analysis_policy analysis,
+                                                      rocsparse_solve_policy solve,
+                                                      void* temp_buffer)
+{
+    return rocsparse_csrsv_analysis_template<rocsparse_float_complex>(handle,
+                                                                      trans,
+                                                                      m,
+                                                                      nnz,
+                                                                      descr,
+                                                                      csr_val,
+                                                                      csr_row_ptr,
+                                                                      csr_col_ind,
+                                                                      info,
+                                                                      analysis,
+                                                                      solve,
+                                                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrsv_analysis(rocsparse_handle handle,
+                                                      rocsparse_operation trans,
+                                                      rocsparse_int m,
+                                                      rocsparse_int nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const rocsparse_double_complex* csr_val,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      rocsparse_mat_info info,
+                                                      rocsparse_analysis_policy analysis,
+                                                      rocsparse_solve_policy solve,
+                                                      void* temp_buffer)
+{
+    return rocsparse_csrsv_analysis_template<rocsparse_double_complex>(handle,
+                                                                       trans,
+                                                                       m,
+                                                                       nnz,
+                                                                       descr,
+                                                                       csr_val,
+                                                                       csr_row_ptr,
+                                                                       csr_col_ind,
+                                                                       info,
+                                                                       analysis,
+                                                                       solve,
+                                                                       temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrsv_clear(rocsparse_handle handle,
                                                   const rocsparse_mat_descr descr,
                                                   rocsparse_mat_info info)
@@ -140,8 +224,14 @@ extern "C" rocsparse_status rocsparse_csrsv_clear(rocsparse_handle handle,
     // Determine which info meta data should be deleted
     if(descr->fill_mode == rocsparse_fill_mode_lower)
     {
+        // Transposed meta data is never shared
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsvt_lower_info));
+        info->csrsvt_lower_info = nullptr;
+
         // If meta data is shared, do not delete anything
-        if(info->csrilu0_info == info->csrsv_lower_info)
+        if(info->csrilu0_info == info->csrsv_lower_info
+           || info->csric0_info == info->csrsv_lower_info
+           || info->csrsm_lower_info == info->csrsv_lower_info)
         {
             info->csrsv_lower_info = nullptr;
 
@@ -153,7 +243,18 @@ extern "C" rocsparse_status rocsparse_csrsv_clear(rocsparse_handle handle,
     }
     else if(descr->fill_mode == rocsparse_fill_mode_upper)
     {
-        // Upper info has no shares (yet)
+        // Transposed meta data is never shared
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsvt_upper_info));
+        info->csrsvt_upper_info = nullptr;
+
+        // If meta data is shared, do not delete anything
+        if(info->csrsm_upper_info == info->csrsv_upper_info)
+        {
+            info->csrsv_upper_info = nullptr;
+
+            return rocsparse_status_success;
+        }
+
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_upper_info));
         info->csrsv_upper_info = nullptr;
     }
@@ -223,6 +324,68 @@ extern "C" rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle handle,
                                                   temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_ccsrsv_solve(rocsparse_handle handle,
+                                                   rocsparse_operation trans,
+                                                   rocsparse_int m,
+                                                   rocsparse_int nnz,
+                                                   const rocsparse_float_complex* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const rocsparse_float_complex* csr_val,
+                                                   const rocsparse_int* csr_row_ind,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   rocsparse_mat_info info,
+                                                   const rocsparse_float_complex* x,
+                                                   rocsparse_float_complex* y,
+                                                   rocsparse_solve_policy policy,
+                                                   void* temp_buffer)
+{
+    return rocsparse_csrsv_solve_template<rocsparse_float_complex>(handle,
+                                                                   trans,
+                                                                   m,
+                                                                   nnz,
+                                                                   alpha,
+                                                                   descr,
+                                                                   csr_val,
+                                                                   csr_row_ind,
+                                                                   csr_col_ind,
+                                                                   info,
+                                                                   x,
+                                                                   y,
+                                                                   policy,
+                                                                   temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrsv_solve(rocsparse_handle handle,
+                                                   rocsparse_operation trans,
+                                                   rocsparse_int m,
+                                                   rocsparse_int nnz,
+                                                   const rocsparse_double_complex* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const rocsparse_double_complex* csr_val,
+                                                   const rocsparse_int* csr_row_ind,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   rocsparse_mat_info info,
+                                                   const rocsparse_double_complex* x,
+                                                   rocsparse_double_complex* y,
+                                                   rocsparse_solve_policy policy,
+                                                   void* temp_buffer)
+{
+    return rocsparse_csrsv_solve_template<rocsparse_double_complex>(handle,
+                                                                    trans,
+                                                                    m,
+                                                                    nnz,
+                                                                    alpha,
+                                                                    descr,
+                                                                    csr_val,
+                                                                    csr_row_ind,
+                                                                    csr_col_ind,
+                                                                    info,
+                                                                    x,
+                                                                    y,
+                                                                    policy,
+                                                                    temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
                                                        const rocsparse_mat_descr descr,
                                                        rocsparse_mat_info info,
@@ -247,9 +410,6 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
-    // Stream
-    hipStream_t stream = handle->stream;
-
     // Determine the info meta data place
     rocsparse_csrtr_info csrsv = nullptr;
 
@@ -262,77 +422,34 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
         {
             csrsv = info->csrsv_lower_info;
         }
-        else
-        {
-            csrsv = info->csrsv_upper_info;
-        }
-    }
-    else
-    {
-        // Switch between upper and lower triangular
-        if(descr->fill_mode == rocsparse_fill_mode_lower)
-        {
-            csrsv = info->csrsv_lower_info;
-        }
-        else
+        else if(info->csrsv_upper_info != nullptr)
         {
             csrsv = info->csrsv_upper_info;
         }
-    }
-
-    // If m == 0 || nnz == 0 it can happen, that info structure is not created.
-    // In this case, always return -1.
-    if(csrsv == nullptr)
-    {
-        if(handle->pointer_mode == rocsparse_pointer_mode_device)
-        {
-            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
-        }
-        else
-        {
-            *position = -1;
-        }
-
-        return rocsparse_status_success;
-    }
-
-    // Differentiate between pointer modes
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        // rocsparse_pointer_mode_device
-        rocsparse_int pivot;
-
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&pivot, csrsv->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-
-        if(pivot == std::numeric_limits<rocsparse_int>::max())
+        else if(info->csrsvt_lower_info != nullptr)
         {
-            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+            csrsv = info->csrsvt_lower_info;
         }
         else
         {
-            RETURN_IF_HIP_ERROR(hipMemcpy(
-                position, csrsv->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToDevice));
-
-            return rocsparse_status_zero_pivot;
+            csrsv = info->csrsvt_upper_info;
         }
     }
     else
     {
-        // rocsparse_pointer_mode_host
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(position, csrsv->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-
-        // If no zero pivot is found, set -1
-        if(*position == std::numeric_limits<rocsparse_int>::max())
+        // Switch between upper and lower triangular, the non-transposed meta
+        // data takes precedence over the transposed one
+        if(descr->fill_mode == rocsparse_fill_mode_lower)
         {
-            *position = -1;
+            csrsv = (info->csrsv_lower_info != nullptr) ? info->csrsv_lower_info
+                                                        : info->csrsvt_lower_info;
         }
         else
         {
-            return rocsparse_status_zero_pivot;
+            csrsv = (info->csrsv_upper_info != nullptr) ? info->csrsv_upper_info
+                                                        : info->csrsvt_upper_info;
         }
     }
 
-    return rocsparse_status_success;
+    return rocsparse_csrtr_zero_pivot(handle, csrsv, position);
 }
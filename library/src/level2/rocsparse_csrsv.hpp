@@ -27,14 +27,68 @@
 
 #include "rocsparse.h"
 #include "definitions.h"
+#include "grid.h"
 #include "handle.h"
 #include "utility.h"
 #include "csrsv_device.h"
 
+#include <algorithm>
 #include <limits>
 #include <hip/hip_runtime.h>
 #include <hipcub/hipcub.hpp>
 
+// Temporary storage required by csrtr analysis and the triangular solves
+static rocsparse_status rocsparse_csrtr_buffer_size(rocsparse_int m, size_t* buffer_size)
+{
+    // rocsparse_int max depth
+    *buffer_size = 256;
+
+    // unsigned long long total_spin
+    *buffer_size += 256;
+
+    // rocsparse_int max_nnz
+    *buffer_size += 256;
+
+    // rocsparse_int done_array[m]
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // rocsparse_int rows_per_level[m]
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // rocsparse_int rows[m]
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    size_t scan_size   = 0;
+    size_t sort_size   = 0;
+    rocsparse_int* ptr = nullptr;
+    hipcub::DoubleBuffer<rocsparse_int> dummy(ptr, ptr);
+
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(nullptr, scan_size, ptr, ptr, m));
+    RETURN_IF_HIP_ERROR(
+        hipcub::DeviceRadixSort::SortPairs(nullptr, sort_size, dummy, dummy, m, 0, 32));
+
+    // hipcub buffer
+    *buffer_size += std::max(scan_size, sort_size);
+
+    return rocsparse_status_success;
+}
+
+// Reset a zero pivot, no zero pivot is marked by the largest rocsparse_int. A 32 bit
+// memset would leave the upper half of a 64 bit rocsparse_int untouched.
+static rocsparse_status rocsparse_csrtr_zero_pivot_init(rocsparse_int* zero_pivot,
+                                                        hipStream_t stream)
+{
+    hipLaunchKernelGGL((csrtr_zero_pivot_init_kernel<rocsparse_int>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       std::numeric_limits<rocsparse_int>::max(),
+                       zero_pivot);
+
+    return rocsparse_status_success;
+}
+
 template <typename T>
 rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle handle,
                                                       rocsparse_operation trans,
@@ -121,27 +175,75 @@ rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle handle,
         return rocsparse_status_success;
     }
 
-    // rocsparse_int max depth
-    *buffer_size = 256;
-
-    // unsigned long long total_spin
-    *buffer_size += 256;
-
-    // rocsparse_int max_nnz
-    *buffer_size += 256;
+    return rocsparse_csrtr_buffer_size(m, buffer_size);
+}
 
-    // rocsparse_int done_array[m]
-    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+// Dependency analysis of op(A) = A^T. Instead of transposing A, each row of A
+// resolves the dependencies of all rows of op(A) that are given by its strictly
+// triangular entries. The number of dependencies of each row of op(A) is kept in
+// info, since the transposed solve requires them as initial counters.
+template <rocsparse_int WF_SIZE, rocsparse_fill_mode FILL_MODE>
+static rocsparse_status rocsparse_csrtr_transpose_analysis(rocsparse_handle handle,
+                                                           rocsparse_int m,
+                                                           const rocsparse_int* csr_row_ptr,
+                                                           const rocsparse_int* csr_col_ind,
+                                                           rocsparse_csrtr_info info,
+                                                           rocsparse_int* d_in_degree,
+                                                           rocsparse_int* d_done_array,
+                                                           rocsparse_int* d_rows_per_level,
+                                                           rocsparse_int* d_max_depth,
+                                                           unsigned long long* d_total_spin,
+                                                           rocsparse_int* d_max_nnz,
+                                                           rocsparse_index_base base)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
 
-    // rocsparse_int rows_per_level[m]
-    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+#define CSRSV_DIM 1024
+    dim3 csrsv_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_grid_dim(static_cast<int64_t>(WF_SIZE) * m, CSRSV_DIM, csrsv_blocks));
+    dim3 csrsv_threads(CSRSV_DIM);
+#undef CSRSV_DIM
 
-    size_t hipcub_size = 0;
-    rocsparse_int* ptr = nullptr;
-    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(nullptr, hipcub_size, ptr, ptr, m));
+    // Count the dependencies of each row of op(A)
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(info->d_in_degree, 0, sizeof(rocsparse_int) * m, stream));
+
+    hipLaunchKernelGGL((csrsv_transpose_count_kernel<WF_SIZE, FILL_MODE>),
+                       csrsv_blocks,
+                       csrsv_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       info->csr_diag_ind,
+                       info->d_in_degree,
+                       d_max_nnz,
+                       info->zero_pivot,
+                       base);
+
+    // The analysis consumes a copy of the counters
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(d_in_degree,
+                                       info->d_in_degree,
+                                       sizeof(rocsparse_int) * m,
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
 
-    // hipcub buffer
-    *buffer_size += hipcub_size;
+    hipLaunchKernelGGL((csrsv_transpose_analysis_kernel<WF_SIZE, FILL_MODE>),
+                       csrsv_blocks,
+                       csrsv_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       d_in_degree,
+                       d_done_array,
+                       d_rows_per_level,
+                       d_max_depth,
+                       d_total_spin,
+                       base);
 
     return rocsparse_status_success;
 }
@@ -189,179 +291,402 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle handle,
     rocsparse_int* d_rows_per_level = reinterpret_cast<rocsparse_int*>(ptr);
     ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
 
+    // rows
+    rocsparse_int* d_rows = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
     // hipcub buffer
     void* hipcub_buffer = reinterpret_cast<void*>(ptr);
 
+    // Device arrays of the analysis are served from the memory pool, which is kept
+    // alive by info until the arrays are returned
+    info->pool   = handle->pool;
+    info->stream = stream;
+
     // Allocate buffer to hold diagonal entry point
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csr_diag_ind, sizeof(rocsparse_int) * m));
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&info->csr_diag_ind, sizeof(rocsparse_int) * m));
 
     // Allocate buffer to hold zero pivot
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->zero_pivot, sizeof(rocsparse_int)));
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&info->zero_pivot, sizeof(rocsparse_int)));
 
     // Allocate buffer to hold row map
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->d_row_map, sizeof(rocsparse_int) * (m + 1)));
-
-    // Allocate host buffer to hold row map
-    RETURN_IF_HIP_ERROR(hipHostMalloc((void**)&info->h_row_map, sizeof(rocsparse_int) * (m + 1)));
-
-    // Initialize row map
-    memset(info->h_row_map, 0, sizeof(rocsparse_int) * (m + 1));
-
-    // Initialize zero pivot
-    rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
     RETURN_IF_HIP_ERROR(
-        hipMemcpy(info->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice));
+        handle->allocate((void**)&info->d_row_map, sizeof(rocsparse_int) * (m + 1)));
 
-// Run analysis
-#define CSRILU0_DIM 1024
-    dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRILU0_DIM + 1);
-    dim3 csrsv_threads(CSRILU0_DIM);
-#undef CSRILU0_DIM
+    // Initialize zero pivot
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_zero_pivot_init(info->zero_pivot, stream));
 
-    if(handle->wavefront_size == 32)
+    // Transposed analysis
+    if(trans != rocsparse_operation_none)
     {
-        if(descr->fill_mode == rocsparse_fill_mode_upper)
+        // Allocate buffer to hold the number of dependencies of each row
+        RETURN_IF_HIP_ERROR(
+            handle->allocate((void**)&info->d_in_degree, sizeof(rocsparse_int) * m));
+
+        // The rows buffer is free until the row map is created
+        rocsparse_int* d_in_degree = d_rows;
+
+        if(handle->wavefront_size == 32)
         {
-            hipLaunchKernelGGL((csrsv_analysis_kernel<32, rocsparse_fill_mode_upper>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               info->csr_diag_ind,
-                               d_done_array,
-                               d_rows_per_level,
-                               d_max_depth,
-                               d_total_spin,
-                               d_max_nnz,
-                               info->zero_pivot,
-                               descr->base);
+            if(descr->fill_mode == rocsparse_fill_mode_upper)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(
+                    (rocsparse_csrtr_transpose_analysis<32, rocsparse_fill_mode_upper>(
+                        handle,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        info,
+                        d_in_degree,
+                        d_done_array,
+                        d_rows_per_level,
+                        d_max_depth,
+                        d_total_spin,
+                        d_max_nnz,
+                        descr->base)));
+            }
+            else if(descr->fill_mode == rocsparse_fill_mode_lower)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(
+                    (rocsparse_csrtr_transpose_analysis<32, rocsparse_fill_mode_lower>(
+                        handle,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        info,
+                        d_in_degree,
+                        d_done_array,
+                        d_rows_per_level,
+                        d_max_depth,
+                        d_total_spin,
+                        d_max_nnz,
+                        descr->base)));
+            }
         }
-        else if(descr->fill_mode == rocsparse_fill_mode_lower)
+        else if(handle->wavefront_size == 64)
         {
-            hipLaunchKernelGGL((csrsv_analysis_kernel<32, rocsparse_fill_mode_lower>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               info->csr_diag_ind,
-                               d_done_array,
-                               d_rows_per_level,
-                               d_max_depth,
-                               d_total_spin,
-                               d_max_nnz,
-                               info->zero_pivot,
-                               descr->base);
+            if(descr->fill_mode == rocsparse_fill_mode_upper)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(
+                    (rocsparse_csrtr_transpose_analysis<64, rocsparse_fill_mode_upper>(
+                        handle,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        info,
+                        d_in_degree,
+                        d_done_array,
+                        d_rows_per_level,
+                        d_max_depth,
+                        d_total_spin,
+                        d_max_nnz,
+                        descr->base)));
+            }
+            else if(descr->fill_mode == rocsparse_fill_mode_lower)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(
+                    (rocsparse_csrtr_transpose_analysis<64, rocsparse_fill_mode_lower>(
+                        handle,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        info,
+                        d_in_degree,
+                        d_done_array,
+                        d_rows_per_level,
+                        d_max_depth,
+                        d_total_spin,
+                        d_max_nnz,
+                        descr->base)));
+            }
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
         }
     }
-    else if(handle->wavefront_size == 64)
+    else
     {
-        if(descr->fill_mode == rocsparse_fill_mode_upper)
+// Run analysis
+#define CSRILU0_DIM 1024
+        dim3 csrsv_blocks;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(
+            static_cast<int64_t>(handle->wavefront_size) * m, CSRILU0_DIM, csrsv_blocks));
+        dim3 csrsv_threads(CSRILU0_DIM);
+#undef CSRILU0_DIM
+
+        if(handle->wavefront_size == 32)
         {
-            hipLaunchKernelGGL((csrsv_analysis_kernel<64, rocsparse_fill_mode_upper>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               info->csr_diag_ind,
-                               d_done_array,
-                               d_rows_per_level,
-                               d_max_depth,
-                               d_total_spin,
-                               d_max_nnz,
-                               info->zero_pivot,
-                               descr->base);
+            if(descr->fill_mode == rocsparse_fill_mode_upper)
+            {
+                hipLaunchKernelGGL((csrsv_analysis_kernel<32, rocsparse_fill_mode_upper>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   m,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   info->csr_diag_ind,
+                                   d_done_array,
+                                   d_rows_per_level,
+                                   d_max_depth,
+                                   d_total_spin,
+                                   d_max_nnz,
+                                   info->zero_pivot,
+                                   descr->base);
+            }
+            else if(descr->fill_mode == rocsparse_fill_mode_lower)
+            {
+                hipLaunchKernelGGL((csrsv_analysis_kernel<32, rocsparse_fill_mode_lower>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   m,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   info->csr_diag_ind,
+                                   d_done_array,
+                                   d_rows_per_level,
+                                   d_max_depth,
+                                   d_total_spin,
+                                   d_max_nnz,
+                                   info->zero_pivot,
+                                   descr->base);
+            }
         }
-        else if(descr->fill_mode == rocsparse_fill_mode_lower)
+        else if(handle->wavefront_size == 64)
         {
-            hipLaunchKernelGGL((csrsv_analysis_kernel<64, rocsparse_fill_mode_lower>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               info->csr_diag_ind,
-                               d_done_array,
-                               d_rows_per_level,
-                               d_max_depth,
-                               d_total_spin,
-                               d_max_nnz,
-                               info->zero_pivot,
-                               descr->base);
+            if(descr->fill_mode == rocsparse_fill_mode_upper)
+            {
+                hipLaunchKernelGGL((csrsv_analysis_kernel<64, rocsparse_fill_mode_upper>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   m,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   info->csr_diag_ind,
+                                   d_done_array,
+                                   d_rows_per_level,
+                                   d_max_depth,
+                                   d_total_spin,
+                                   d_max_nnz,
+                                   info->zero_pivot,
+                                   descr->base);
+            }
+            else if(descr->fill_mode == rocsparse_fill_mode_lower)
+            {
+                hipLaunchKernelGGL((csrsv_analysis_kernel<64, rocsparse_fill_mode_lower>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   m,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   info->csr_diag_ind,
+                                   d_done_array,
+                                   d_rows_per_level,
+                                   d_max_depth,
+                                   d_total_spin,
+                                   d_max_nnz,
+                                   info->zero_pivot,
+                                   descr->base);
+            }
         }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+
+    // Post processing
+    if(handle->exec_mode == rocsparse_exec_mode_async)
+    {
+        // Meta data stays in device memory, the host only keeps upper bounds
+        info->max_depth  = m;
+        info->total_spin = 0;
+        info->max_nnz    = m;
     }
     else
     {
-        return rocsparse_status_arch_mismatch;
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&info->max_depth, d_max_depth, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            &info->total_spin, d_total_spin, sizeof(unsigned long long), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&info->max_nnz, d_max_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
     }
 
-    // Post processing
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&info->max_depth, d_max_depth, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-    RETURN_IF_HIP_ERROR(hipMemcpy(
-        &info->total_spin, d_total_spin, sizeof(unsigned long long), hipMemcpyDeviceToHost));
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&info->max_nnz, d_max_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    // Allocate buffer to hold rows per level
+    RETURN_IF_HIP_ERROR(handle->allocate((void**)&info->d_rows_per_level,
+                                         sizeof(rocsparse_int) * info->max_depth));
 
-    // Inclusive sum to obtain rows per level
+    // Inclusive sum to obtain rows per level, the host copy is created on demand
     size_t hipcub_size = 0;
-    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
-        nullptr, hipcub_size, d_rows_per_level, d_rows_per_level, info->max_depth));
-    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
-        hipcub_buffer, hipcub_size, d_rows_per_level, d_rows_per_level, info->max_depth));
-
-    // Allocate host memory for meta data
-    info->rows_per_level.resize(info->max_depth);
-    std::vector<rocsparse_int> done_array(m);
-
-    // Move meta data to host (required for kernel launching)
-    RETURN_IF_HIP_ERROR(hipMemcpy(info->rows_per_level.data(),
-                                  d_rows_per_level,
-                                  sizeof(rocsparse_int) * info->max_depth,
-                                  hipMemcpyDeviceToHost));
-    RETURN_IF_HIP_ERROR(hipMemcpy(
-        done_array.data(), d_done_array, sizeof(rocsparse_int) * m, hipMemcpyDeviceToHost));
-
-    std::vector<rocsparse_int> counter(info->max_depth, 0);
-
-    // Create row map
-    for(rocsparse_int i = 0; i < m; ++i)
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(nullptr,
+                                                        hipcub_size,
+                                                        d_rows_per_level,
+                                                        info->d_rows_per_level,
+                                                        info->max_depth,
+                                                        stream));
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(hipcub_buffer,
+                                                        hipcub_size,
+                                                        d_rows_per_level,
+                                                        info->d_rows_per_level,
+                                                        info->max_depth,
+                                                        stream));
+
+    info->rows_per_level.clear();
+
+    // Create row map by stable sorting the rows by their level, such that rows of
+    // the same level keep their natural order. The level of each row is stored in
+    // the done array and bounded by max_depth.
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(info->max_depth);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, m, d_rows));
+
+    // rows_per_level buffer is not used anymore and holds the sorted levels
+    hipcub::DoubleBuffer<rocsparse_int> keys(d_done_array, d_rows_per_level);
+    hipcub::DoubleBuffer<rocsparse_int> vals(d_rows, info->d_row_map);
+
+    RETURN_IF_HIP_ERROR(hipcub::DeviceRadixSort::SortPairs(
+        nullptr, hipcub_size, keys, vals, m, startbit, endbit, stream));
+    RETURN_IF_HIP_ERROR(hipcub::DeviceRadixSort::SortPairs(
+        hipcub_buffer, hipcub_size, keys, vals, m, startbit, endbit, stream));
+
+    // Copy row map if not current
+    if(vals.Current() != info->d_row_map)
     {
-        rocsparse_int level        = done_array[i] - 1;
-        rocsparse_int prev_level   = level - 1;
-        rocsparse_int depth_offset = (level == 0) ? 0 : info->rows_per_level[prev_level];
-
-        info->h_row_map[depth_offset + counter[level]] = i;
-        ++counter[level];
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->d_row_map,
+                                           vals.Current(),
+                                           sizeof(rocsparse_int) * m,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
 
-    // Copy row map to device
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->d_row_map,
-                                       info->h_row_map,
-                                       sizeof(rocsparse_int) * (m + 1),
-                                       hipMemcpyHostToDevice,
-                                       stream));
-
     // Store some pointers to verify correct execution
     info->m           = m;
     info->nnz         = nnz;
     info->descr       = descr;
     info->csr_row_ptr = csr_row_ptr;
     info->csr_col_ind = csr_col_ind;
+    info->trans       = trans;
+
+    return rocsparse_status_success;
+}
+
+// Obtain the first zero pivot of csrtr info, or -1 if there is none
+static rocsparse_status rocsparse_csrtr_zero_pivot(rocsparse_handle handle,
+                                                   rocsparse_csrtr_info info,
+                                                   rocsparse_int* position)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If m == 0 || nnz == 0 it can happen, that info structure is not created.
+    // In this case, always return -1.
+    if(info == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *position = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device
+       && handle->exec_mode == rocsparse_exec_mode_async)
+    {
+        // rocsparse_pointer_mode_device without synchronization, the zero pivot
+        // status cannot be returned
+        hipLaunchKernelGGL((csrtr_zero_pivot_kernel<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           std::numeric_limits<rocsparse_int>::max(),
+                           info->zero_pivot,
+                           position);
+    }
+    else if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        rocsparse_int pivot;
+
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        if(pivot == std::numeric_limits<rocsparse_int>::max())
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpy(
+                position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToDevice));
+
+            return rocsparse_status_zero_pivot;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // If no zero pivot is found, set -1
+        if(*position == std::numeric_limits<rocsparse_int>::max())
+        {
+            *position = -1;
+        }
+        else
+        {
+            return rocsparse_status_zero_pivot;
+        }
+    }
 
     return rocsparse_status_success;
 }
 
+// Level scheduling pays off if the levels are wide enough to amortize one kernel
+// launch per level, and the sync-free analysis spent many spin loops per row
+#define CSRSV_LEVEL_MIN_ROWS 1024
+#define CSRSV_LEVEL_MIN_SPIN 16
+
+static inline bool rocsparse_csrsv_level_scheduled(rocsparse_handle handle,
+                                                   rocsparse_csrtr_info info,
+                                                   rocsparse_solve_policy policy)
+{
+    // Level information is not available on the host in async mode
+    if(handle->exec_mode == rocsparse_exec_mode_async)
+    {
+        return false;
+    }
+
+    if(policy == rocsparse_solve_policy_level)
+    {
+        return true;
+    }
+    else if(policy == rocsparse_solve_policy_sync_free)
+    {
+        return false;
+    }
+
+    return info->m >= static_cast<long long>(CSRSV_LEVEL_MIN_ROWS) * info->max_depth
+           && info->total_spin >= static_cast<unsigned long long>(CSRSV_LEVEL_MIN_SPIN) * info->m;
+}
+
 template <typename T>
 rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle handle,
                                                    rocsparse_operation trans,
@@ -425,7 +750,8 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle handle,
     }
 
     // Check solve policy
-    if(solve != rocsparse_solve_policy_auto)
+    if(solve != rocsparse_solve_policy_auto && solve != rocsparse_solve_policy_sync_free &&
+       solve != rocsparse_solve_policy_level)
     {
         return rocsparse_status_invalid_value;
     }
@@ -464,17 +790,25 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle handle,
         return rocsparse_status_success;
     }
 
-    // Switch between lower and upper triangular analysis
-    if(descr->fill_mode == rocsparse_fill_mode_upper)
+    // Transposed triangular solves have their own meta data, since the dependencies
+    // of op(A) differ from those of A
+    if(trans != rocsparse_operation_none)
     {
-        // This is currently the only case where we need upper triangular analysis,
-        // therefore we ignore the analysis policy
+        rocsparse_csrtr_info* csrsvt = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                           ? &info->csrsvt_upper_info
+                                           : &info->csrsvt_lower_info;
+
+        // If csrsv meta data is already available, do nothing
+        if(analysis == rocsparse_analysis_policy_reuse && *csrsvt != nullptr)
+        {
+            return rocsparse_status_success;
+        }
 
         // Clear csrsv info
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_upper_info));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(*csrsvt));
 
         // Create csrsv info
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&info->csrsv_upper_info));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(csrsvt));
 
         // Perform analysis
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis(handle,
@@ -484,15 +818,55 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle handle,
                                                            descr,
                                                            csr_row_ptr,
                                                            csr_col_ind,
-                                                           info->csrsv_upper_info,
+                                                           *csrsvt,
                                                            temp_buffer));
+
+        // Move the level information to the host, if the solve is going to be level scheduled
+        if(rocsparse_csrsv_level_scheduled(handle, *csrsvt, solve))
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_rows_per_level(handle, *csrsvt));
+        }
+
+        return rocsparse_status_success;
     }
-    else
+
+    // Switch between lower and upper triangular analysis
+    if(descr->fill_mode == rocsparse_fill_mode_upper)
     {
-        // Differentiate the analysis policies
-        if(analysis == rocsparse_analysis_policy_reuse)
+        // Upper triangular analysis can only be shared with csrsm
+        if(analysis == rocsparse_analysis_policy_reuse && info->csrsm_upper_info != nullptr)
         {
-            // We try to re-use already analyzed lower part, if available.
+            info->csrsv_upper_info = info->csrsm_upper_info;
+
+            return rocsparse_status_success;
+        }
+
+        // Clear csrsv info, unless it is shared
+        if(info->csrsv_upper_info != info->csrsm_upper_info)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_upper_info));
+        }
+
+        // Create csrsv info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&info->csrsv_upper_info));
+
+        // Perform analysis
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis(handle,
+                                                           trans,
+                                                           m,
+                                                           nnz,
+                                                           descr,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           info->csrsv_upper_info,
+                                                           temp_buffer));
+    }
+    else
+    {
+        // Differentiate the analysis policies
+        if(analysis == rocsparse_analysis_policy_reuse)
+        {
+            // We try to re-use already analyzed lower part, if available.
             // It is the user's responsibility that this data is still valid,
             // since he passed the 'reuse' flag.
 
@@ -510,6 +884,16 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle handle,
             {
                 reuse = info->csrilu0_info;
             }
+            // csric0 meta data
+            else if(info->csric0_info != nullptr)
+            {
+                reuse = info->csric0_info;
+            }
+            // csrsm meta data
+            else if(info->csrsm_lower_info != nullptr)
+            {
+                reuse = info->csrsm_lower_info;
+            }
 
             // TODO add more crossover data here
 
@@ -525,8 +909,13 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle handle,
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used.
 
-        // Clear csrsv info
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
+        // Clear csrsv info, unless it is shared
+        if(info->csrsv_lower_info != info->csrilu0_info
+           && info->csrsv_lower_info != info->csric0_info
+           && info->csrsv_lower_info != info->csrsm_lower_info)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
+        }
 
         // Create csrsv info
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&info->csrsv_lower_info));
@@ -543,6 +932,16 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle handle,
                                                            temp_buffer));
     }
 
+    // Move the level information to the host, if the solve is going to be level scheduled
+    rocsparse_csrtr_info csrsv = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                     ? info->csrsv_upper_info
+                                     : info->csrsv_lower_info;
+
+    if(rocsparse_csrsv_level_scheduled(handle, csrsv, solve))
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_rows_per_level(handle, csrsv));
+    }
+
     return rocsparse_status_success;
 }
 
@@ -612,6 +1011,296 @@ __launch_bounds__(BLOCKSIZE) __global__
                                         diag_type);
 }
 
+template <typename T>
+__global__ void csrsv_transpose_init_host_pointer(rocsparse_int m,
+                                                  T alpha,
+                                                  const T* __restrict__ x,
+                                                  T* __restrict__ y)
+{
+    csrsv_transpose_init_device(m, alpha, x, y);
+}
+
+template <typename T>
+__global__ void csrsv_transpose_init_device_pointer(rocsparse_int m,
+                                                    const T* alpha,
+                                                    const T* __restrict__ x,
+                                                    T* __restrict__ y)
+{
+    csrsv_transpose_init_device(m, *alpha, x, y);
+}
+
+// Initialize y with alpha * x, transposed solves accumulate their updates in y
+template <typename T>
+static rocsparse_status rocsparse_csrsv_transpose_init(rocsparse_handle handle,
+                                                       rocsparse_int m,
+                                                       const T* alpha,
+                                                       const T* x,
+                                                       T* y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRSV_DIM 1024
+    dim3 csrsv_blocks((m - 1) / CSRSV_DIM + 1);
+    dim3 csrsv_threads(CSRSV_DIM);
+#undef CSRSV_DIM
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrsv_transpose_init_device_pointer<T>),
+                           csrsv_blocks,
+                           csrsv_threads,
+                           0,
+                           stream,
+                           m,
+                           alpha,
+                           x,
+                           y);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrsv_transpose_init_host_pointer<T>),
+                           csrsv_blocks,
+                           csrsv_threads,
+                           0,
+                           stream,
+                           m,
+                           *alpha,
+                           x,
+                           y);
+    }
+
+    return rocsparse_status_success;
+}
+
+// Solve the rows map[offset] to map[offset + rows - 1] of op(A) = A^T, rows wait
+// until their in degree dropped to zero
+template <typename T>
+static rocsparse_status rocsparse_csrsv_transpose_launch(rocsparse_handle handle,
+                                                         rocsparse_operation trans,
+                                                         rocsparse_int rows,
+                                                         rocsparse_int offset,
+                                                         const rocsparse_mat_descr descr,
+                                                         const T* csr_val,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         const rocsparse_int* csr_col_ind,
+                                                         rocsparse_csrtr_info csrsv,
+                                                         T* y,
+                                                         rocsparse_int* d_in_degree)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRSV_DIM 1024
+    dim3 csrsv_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(
+        static_cast<int64_t>(handle->wavefront_size) * rows, CSRSV_DIM, csrsv_blocks));
+    dim3 csrsv_threads(CSRSV_DIM);
+
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrsv_transpose_kernel<T, CSRSV_DIM, 32>),
+                           csrsv_blocks,
+                           csrsv_threads,
+                           0,
+                           stream,
+                           rows,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           csrsv->csr_diag_ind,
+                           y,
+                           d_in_degree,
+                           csrsv->d_row_map,
+                           offset,
+                           csrsv->zero_pivot,
+                           trans,
+                           descr->base,
+                           descr->fill_mode,
+                           descr->diag_type);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        hipLaunchKernelGGL((csrsv_transpose_kernel<T, CSRSV_DIM, 64>),
+                           csrsv_blocks,
+                           csrsv_threads,
+                           0,
+                           stream,
+                           rows,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           csrsv->csr_diag_ind,
+                           y,
+                           d_in_degree,
+                           csrsv->d_row_map,
+                           offset,
+                           csrsv->zero_pivot,
+                           trans,
+                           descr->base,
+                           descr->fill_mode,
+                           descr->diag_type);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+#undef CSRSV_DIM
+
+    return rocsparse_status_success;
+}
+
+// Solve the rows map[offset] to map[offset + rows - 1], rows wait for their
+// dependencies to be resolved
+template <typename T>
+static rocsparse_status rocsparse_csrsv_launch(rocsparse_handle handle,
+                                               rocsparse_operation trans,
+                                               rocsparse_int rows,
+                                               rocsparse_int offset,
+                                               const T* alpha,
+                                               const rocsparse_mat_descr descr,
+                                               const T* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_csrtr_info csrsv,
+                                               const T* x,
+                                               T* y,
+                                               rocsparse_int* d_done_array)
+{
+    // Transposed solves do not depend on alpha, since y has been initialized
+    if(trans != rocsparse_operation_none)
+    {
+        return rocsparse_csrsv_transpose_launch(handle,
+                                                trans,
+                                                rows,
+                                                offset,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                csrsv,
+                                                y,
+                                                d_done_array);
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRSV_DIM 1024
+    dim3 csrsv_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(
+        static_cast<int64_t>(handle->wavefront_size) * rows, CSRSV_DIM, csrsv_blocks));
+    dim3 csrsv_threads(CSRSV_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 32>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               rows,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               d_done_array,
+                               csrsv->d_row_map,
+                               offset,
+                               csrsv->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 64>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               rows,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               d_done_array,
+                               csrsv->d_row_map,
+                               offset,
+                               csrsv->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 32>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               rows,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               d_done_array,
+                               csrsv->d_row_map,
+                               offset,
+                               csrsv->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 64>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               rows,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               d_done_array,
+                               csrsv->d_row_map,
+                               offset,
+                               csrsv->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+#undef CSRSV_DIM
+
+    return rocsparse_status_success;
+}
+
 template <typename T>
 rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle handle,
                                                 rocsparse_operation trans,
@@ -698,6 +1387,13 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle handle,
         return rocsparse_status_not_implemented;
     }
 
+    // Check solve policy
+    if(policy != rocsparse_solve_policy_auto && policy != rocsparse_solve_policy_sync_free &&
+       policy != rocsparse_solve_policy_level)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
     // Check sizes
     if(m < 0)
     {
@@ -757,375 +1453,83 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle handle,
     // done array
     rocsparse_int* d_done_array = reinterpret_cast<rocsparse_int*>(ptr);
 
-    // Initialize buffers
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(rocsparse_int) * m, stream));
-
-    rocsparse_csrtr_info csrsv = (descr->fill_mode == rocsparse_fill_mode_upper)
-                                     ? info->csrsv_upper_info
-                                     : info->csrsv_lower_info;
+    rocsparse_csrtr_info csrsv;
 
-    // If diag type is unit, re-initialize zero pivot to remove structural zeros
-    if(descr->diag_type == rocsparse_diag_type_unit)
+    if(trans == rocsparse_operation_none)
     {
-        rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(csrsv->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice));
-    }
+        csrsv = (descr->fill_mode == rocsparse_fill_mode_upper) ? info->csrsv_upper_info
+                                                                : info->csrsv_lower_info;
 
-/*
-#define CSRSV_DIM 1024
-    rocsparse_int depth_offset = 0;
-    rocsparse_int running_total = 0;
-    rocsparse_int wf_size = handle->wavefront_size;
-    rocsparse_int wf_per_wg = CSRSV_DIM / wf_size;
-    rocsparse_int cutoff = (m / csrsv->max_depth < 32) ? 2560 : 81920;
-
-    for(rocsparse_int level = 0; level < csrsv->max_depth; ++level)
+        // Initialize buffers
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(rocsparse_int) * m, stream));
+    }
+    else
     {
-        if(level != 0 && running_total == 0)
-        {
-            depth_offset = csrsv->rows_per_level[level - 1];
-        }
+        csrsv = (descr->fill_mode == rocsparse_fill_mode_upper) ? info->csrsvt_upper_info
+                                                                : info->csrsvt_lower_info;
 
-        running_total = csrsv->rows_per_level[level] - depth_offset;
-
-        if(running_total >= cutoff)
-        {
-            dim3 csrsv_blocks(((running_total + (running_total % wf_per_wg)) * wf_size - 1) /
-CSRSV_DIM + 1);
-            dim3 csrsv_threads(CSRSV_DIM);
-
-            if(handle->pointer_mode == rocsparse_pointer_mode_device)
-            {
-                // rocsparse_pointer_mode_device
-                if(wf_size == 32)
-                {
-                    hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 32>),
-                                       csrsv_blocks,
-                                       csrsv_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       y,
-                                       d_done_array,
-                                       csrsv->d_row_map,
-                                       depth_offset,
-                                       csrsv->zero_pivot,
-                                       descr->base,
-                                       descr->fill_mode,
-                                       descr->diag_type);
-                }
-                else if(wf_size == 64)
-                {
-                    hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 64>),
-                                       csrsv_blocks,
-                                       csrsv_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       y,
-                                       d_done_array,
-                                       csrsv->d_row_map,
-                                       depth_offset,
-                                       csrsv->zero_pivot,
-                                       descr->base,
-                                       descr->fill_mode,
-                                       descr->diag_type);
-                }
-                else
-                {
-                    return rocsparse_status_arch_mismatch;
-                }
-            }
-            else
-            {
-                // rocsparse_pointer_mode_host
-                if(wf_size == 32)
-                {
-                    hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 32>),
-                                       csrsv_blocks,
-                                       csrsv_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       y,
-                                       d_done_array,
-                                       csrsv->d_row_map,
-                                       depth_offset,
-                                       csrsv->zero_pivot,
-                                       descr->base,
-                                       descr->fill_mode,
-                                       descr->diag_type);
-                }
-                else if(wf_size == 64)
-                {
-                    hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 64>),
-                                       csrsv_blocks,
-                                       csrsv_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       y,
-                                       d_done_array,
-                                       csrsv->d_row_map,
-                                       depth_offset,
-                                       csrsv->zero_pivot,
-                                       descr->base,
-                                       descr->fill_mode,
-                                       descr->diag_type);
-                }
-                else
-                {
-                    return rocsparse_status_arch_mismatch;
-                }
-            }
+        // The done array counts down the dependencies of each row
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(d_done_array,
+                                           csrsv->d_in_degree,
+                                           sizeof(rocsparse_int) * m,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
 
-            running_total = 0;
-        }
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_transpose_init(handle, m, alpha, x, y));
     }
 
-    if(running_total)
+    // If diag type is unit, re-initialize zero pivot to remove structural zeros
+    if(descr->diag_type == rocsparse_diag_type_unit)
     {
-        dim3 csrsv_blocks(((running_total + (running_total % wf_per_wg)) * wf_size - 1) / CSRSV_DIM
-+ 1);
-        dim3 csrsv_threads(CSRSV_DIM);
-
-        if(handle->pointer_mode == rocsparse_pointer_mode_device)
-        {
-            // rocsparse_pointer_mode_device
-            if(wf_size == 32)
-            {
-                hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 32>),
-                                   csrsv_blocks,
-                                   csrsv_threads,
-                                   0,
-                                   stream,
-                                   m,
-                                   alpha,
-                                   csr_row_ptr,
-                                   csr_col_ind,
-                                   csr_val,
-                                   x,
-                                   y,
-                                   d_done_array,
-                                   csrsv->d_row_map,
-                                   depth_offset,
-                                   csrsv->zero_pivot,
-                                   descr->base,
-                                   descr->fill_mode,
-                                   descr->diag_type);
-            }
-            else if(wf_size == 64)
-            {
-                hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 64>),
-                                   csrsv_blocks,
-                                   csrsv_threads,
-                                   0,
-                                   stream,
-                                   m,
-                                   alpha,
-                                   csr_row_ptr,
-                                   csr_col_ind,
-                                   csr_val,
-                                   x,
-                                   y,
-                                   d_done_array,
-                                   csrsv->d_row_map,
-                                   depth_offset,
-                                   csrsv->zero_pivot,
-                                   descr->base,
-                                   descr->fill_mode,
-                                   descr->diag_type);
-            }
-            else
-            {
-                return rocsparse_status_arch_mismatch;
-            }
-        }
-        else
-        {
-            // rocsparse_pointer_mode_host
-            if(wf_size == 32)
-            {
-                hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 32>),
-                                   csrsv_blocks,
-                                   csrsv_threads,
-                                   0,
-                                   stream,
-                                   m,
-                                   *alpha,
-                                   csr_row_ptr,
-                                   csr_col_ind,
-                                   csr_val,
-                                   x,
-                                   y,
-                                   d_done_array,
-                                   csrsv->d_row_map,
-                                   depth_offset,
-                                   csrsv->zero_pivot,
-                                   descr->base,
-                                   descr->fill_mode,
-                                   descr->diag_type);
-            }
-            else if(wf_size == 64)
-            {
-                hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 64>),
-                                   csrsv_blocks,
-                                   csrsv_threads,
-                                   0,
-                                   stream,
-                                   m,
-                                   *alpha,
-                                   csr_row_ptr,
-                                   csr_col_ind,
-                                   csr_val,
-                                   x,
-                                   y,
-                                   d_done_array,
-                                   csrsv->d_row_map,
-                                   depth_offset,
-                                   csrsv->zero_pivot,
-                                   descr->base,
-                                   descr->fill_mode,
-                                   descr->diag_type);
-            }
-            else
-            {
-                return rocsparse_status_arch_mismatch;
-            }
-        }
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_zero_pivot_init(csrsv->zero_pivot, stream));
     }
-#undef CSRSV_DIM
-*/
-#define CSRSV_DIM 1024
-    dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1);
-    dim3 csrsv_threads(CSRSV_DIM);
 
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    if(rocsparse_csrsv_level_scheduled(handle, csrsv, policy))
     {
-        // rocsparse_pointer_mode_device
-        if(handle->wavefront_size == 32)
-        {
-            hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 32>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               alpha,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               csr_val,
-                               x,
-                               y,
-                               d_done_array,
-                               csrsv->d_row_map,
-                               0,
-                               csrsv->zero_pivot,
-                               descr->base,
-                               descr->fill_mode,
-                               descr->diag_type);
-        }
-        else if(handle->wavefront_size == 64)
-        {
-            hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 64>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               alpha,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               csr_val,
-                               x,
-                               y,
-                               d_done_array,
-                               csrsv->d_row_map,
-                               0,
-                               csrsv->zero_pivot,
-                               descr->base,
-                               descr->fill_mode,
-                               descr->diag_type);
-        }
-        else
+        // Level scheduling, one kernel launch per level. Rows of previous levels
+        // are done when the next level starts, such that no wavefront spins.
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_rows_per_level(handle, csrsv));
+
+        rocsparse_int depth_offset = 0;
+
+        for(rocsparse_int level = 0; level < csrsv->max_depth; ++level)
         {
-            return rocsparse_status_arch_mismatch;
+            rocsparse_int rows = csrsv->rows_per_level[level] - depth_offset;
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_launch(handle,
+                                                             trans,
+                                                             rows,
+                                                             depth_offset,
+                                                             alpha,
+                                                             descr,
+                                                             csr_val,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             csrsv,
+                                                             x,
+                                                             y,
+                                                             d_done_array));
+
+            depth_offset = csrsv->rows_per_level[level];
         }
     }
     else
     {
-        // rocsparse_pointer_mode_host
-        if(handle->wavefront_size == 32)
-        {
-            hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 32>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               *alpha,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               csr_val,
-                               x,
-                               y,
-                               d_done_array,
-                               csrsv->d_row_map,
-                               0,
-                               csrsv->zero_pivot,
-                               descr->base,
-                               descr->fill_mode,
-                               descr->diag_type);
-        }
-        else if(handle->wavefront_size == 64)
-        {
-            hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 64>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               *alpha,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               csr_val,
-                               x,
-                               y,
-                               d_done_array,
-                               csrsv->d_row_map,
-                               0,
-                               csrsv->zero_pivot,
-                               descr->base,
-                               descr->fill_mode,
-                               descr->diag_type);
-        }
-        else
-        {
-            return rocsparse_status_arch_mismatch;
-        }
+        // Sync-free, all rows in a single kernel launch
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_launch(handle,
+                                                         trans,
+                                                         m,
+                                                         0,
+                                                         alpha,
+                                                         descr,
+                                                         csr_val,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         csrsv,
+                                                         x,
+                                                         y,
+                                                         d_done_array));
     }
-#undef CSRSV_DIM
 
     return rocsparse_status_success;
 }
@@ -33,13 +33,13 @@
 
 #include <hip/hip_runtime.h>
 
-template <typename T>
+template <typename T, typename A>
 __global__ void ellmvn_kernel_host_pointer(rocsparse_int m,
                                            rocsparse_int n,
                                            rocsparse_int ell_width,
                                            T alpha,
                                            const rocsparse_int* __restrict__ ell_col_ind,
-                                           const T* __restrict__ ell_val,
+                                           const A* __restrict__ ell_val,
                                            const T* __restrict__ x,
                                            T beta,
                                            T* __restrict__ y,
@@ -48,13 +48,13 @@ __global__ void ellmvn_kernel_host_pointer(rocsparse_int m,
     ellmvn_device(m, n, ell_width, alpha, ell_col_ind, ell_val, x, beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename A>
 __global__ void ellmvn_kernel_device_pointer(rocsparse_int m,
                                              rocsparse_int n,
                                              rocsparse_int ell_width,
                                              const T* alpha,
                                              const rocsparse_int* __restrict__ ell_col_ind,
-                                             const T* __restrict__ ell_val,
+                                             const A* __restrict__ ell_val,
                                              const T* __restrict__ x,
                                              const T* beta,
                                              T* __restrict__ y,
@@ -63,14 +63,14 @@ __global__ void ellmvn_kernel_device_pointer(rocsparse_int m,
     ellmvn_device(m, n, ell_width, *alpha, ell_col_ind, ell_val, x, *beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename A>
 rocsparse_status rocsparse_ellmv_template(rocsparse_handle handle,
                                           rocsparse_operation trans,
                                           rocsparse_int m,
                                           rocsparse_int n,
                                           const T* alpha,
                                           const rocsparse_mat_descr descr,
-                                          const T* ell_val,
+                                          const A* ell_val,
                                           const rocsparse_int* ell_col_ind,
                                           rocsparse_int ell_width,
                                           const T* x,
@@ -91,7 +91,7 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle handle,
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xellmv"),
+                  replaceX<T, A>("rocsparse_Xellmv"),
                   trans,
                   m,
                   n,
@@ -104,19 +104,23 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle handle,
                   *beta,
                   (const void*&)y);
 
-        log_bench(handle,
-                  "./rocsparse-bench -f ellmv -r",
-                  replaceX<T>("X"),
-                  "--mtx <matrix.mtx> "
-                  "--alpha",
-                  *alpha,
-                  "--beta",
-                  *beta);
+        // There is no benchmark for the mixed precision ellmv
+        if(std::is_same<T, A>::value)
+        {
+            log_bench(handle,
+                      "./rocsparse-bench -f ellmv -r",
+                      replaceX<T>("X"),
+                      "--mtx <matrix.mtx> "
+                      "--alpha",
+                      *alpha,
+                      "--beta",
+                      *beta);
+        }
     }
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xellmv"),
+                  replaceX<T, A>("rocsparse_Xellmv"),
                   trans,
                   m,
                   n,
@@ -205,7 +209,7 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle handle,
 
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            hipLaunchKernelGGL((ellmvn_kernel_device_pointer<T>),
+            hipLaunchKernelGGL((ellmvn_kernel_device_pointer<T, A>),
                                ellmvn_blocks,
                                ellmvn_threads,
                                0,
@@ -228,7 +232,7 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle handle,
                 return rocsparse_status_success;
             }
 
-            hipLaunchKernelGGL((ellmvn_kernel_host_pointer<T>),
+            hipLaunchKernelGGL((ellmvn_kernel_host_pointer<T, A>),
                                ellmvn_blocks,
                                ellmvn_threads,
                                0,
@@ -34,7 +34,8 @@
 
 #include <hip/hip_runtime_api.h>
 
-template <typename T>
+// A is the value type the HYB matrix has been converted with
+template <typename T, typename A = T>
 rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
                                           rocsparse_operation trans,
                                           const T* alpha,
@@ -62,7 +63,7 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xhybmv"),
+                  replaceX<T, A>("rocsparse_Xhybmv"),
                   trans,
                   *alpha,
                   (const void*&)descr,
@@ -71,8 +72,10 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
                   *beta,
                   (const void*&)y);
 
+        // Mixed precision is benchmarked by hybmv_mixed in the precision of the vectors
         log_bench(handle,
-                  "./rocsparse-bench -f hybmv -r",
+                  std::is_same<T, A>::value ? "./rocsparse-bench -f hybmv -r"
+                                            : "./rocsparse-bench -f hybmv_mixed -r",
                   replaceX<T>("X"),
                   "--mtx <matrix.mtx> "
                   "--alpha",
@@ -83,7 +86,7 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xhybmv"),
+                  replaceX<T, A>("rocsparse_Xhybmv"),
                   trans,
                   (const void*&)alpha,
                   (const void*&)descr,
@@ -196,7 +199,7 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
                                                                hyb->n,
                                                                alpha,
                                                                descr,
-                                                               (T*)hyb->ell_val,
+                                                               (const A*)hyb->ell_val,
                                                                hyb->ell_col_ind,
                                                                hyb->ell_width,
                                                                x,
@@ -222,7 +225,7 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
                                                                        hyb->coo_nnz,
                                                                        alpha,
                                                                        descr,
-                                                                       (T*)hyb->coo_val,
+                                                                       (const A*)hyb->coo_val,
                                                                        hyb->coo_row_ind,
                                                                        hyb->coo_col_ind,
                                                                        x,
@@ -238,7 +241,7 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
                                                                        hyb->coo_nnz,
                                                                        alpha,
                                                                        descr,
-                                                                       (T*)hyb->coo_val,
+                                                                       (const A*)hyb->coo_val,
                                                                        hyb->coo_row_ind,
                                                                        hyb->coo_col_ind,
                                                                        x,
@@ -263,7 +266,7 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
                                                                    hyb->coo_nnz,
                                                                    alpha,
                                                                    descr,
-                                                                   (T*)hyb->coo_val,
+                                                                   (const A*)hyb->coo_val,
                                                                    hyb->coo_row_ind,
                                                                    hyb->coo_col_ind,
                                                                    x,
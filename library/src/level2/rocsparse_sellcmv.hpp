@@ -0,0 +1,298 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_SELLCMV_HPP
+#define ROCSPARSE_SELLCMV_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "grid.h"
+#include "sellcmv_device.h"
+
+#include <hip/hip_runtime.h>
+
+#define SELLCMVN_DIM 256
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int SLICE_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void sellcmvn_kernel_host_pointer(rocsparse_int m,
+                                      rocsparse_int n,
+                                      T alpha,
+                                      const rocsparse_int* __restrict__ slice_ptr,
+                                      const rocsparse_int* __restrict__ perm,
+                                      const rocsparse_int* __restrict__ sell_col_ind,
+                                      const T* __restrict__ sell_val,
+                                      const T* __restrict__ x,
+                                      T beta,
+                                      T* __restrict__ y,
+                                      rocsparse_index_base idx_base)
+{
+    sellcmvn_device<T, BLOCKSIZE, SLICE_SIZE>(
+        m, n, alpha, slice_ptr, perm, sell_col_ind, sell_val, x, beta, y, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int SLICE_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void sellcmvn_kernel_device_pointer(rocsparse_int m,
+                                        rocsparse_int n,
+                                        const T* alpha,
+                                        const rocsparse_int* __restrict__ slice_ptr,
+                                        const rocsparse_int* __restrict__ perm,
+                                        const rocsparse_int* __restrict__ sell_col_ind,
+                                        const T* __restrict__ sell_val,
+                                        const T* __restrict__ x,
+                                        const T* beta,
+                                        T* __restrict__ y,
+                                        rocsparse_index_base idx_base)
+{
+    sellcmvn_device<T, BLOCKSIZE, SLICE_SIZE>(
+        m, n, *alpha, slice_ptr, perm, sell_col_ind, sell_val, x, *beta, y, idx_base);
+}
+
+template <typename T, rocsparse_int SLICE_SIZE>
+rocsparse_status rocsparse_sellcmvn_launch(rocsparse_handle handle,
+                                           const T* alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_sellc_mat sellc,
+                                           const T* x,
+                                           const T* beta,
+                                           T* y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    dim3 sellcmvn_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(sellc->m, SELLCMVN_DIM, sellcmvn_blocks));
+    dim3 sellcmvn_threads(SELLCMVN_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((sellcmvn_kernel_device_pointer<T, SELLCMVN_DIM, SLICE_SIZE>),
+                           sellcmvn_blocks,
+                           sellcmvn_threads,
+                           0,
+                           stream,
+                           sellc->m,
+                           sellc->n,
+                           alpha,
+                           sellc->slice_ptr,
+                           sellc->perm,
+                           sellc->col_ind,
+                           (const T*)sellc->val,
+                           x,
+                           beta,
+                           y,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((sellcmvn_kernel_host_pointer<T, SELLCMVN_DIM, SLICE_SIZE>),
+                           sellcmvn_blocks,
+                           sellcmvn_threads,
+                           0,
+                           stream,
+                           sellc->m,
+                           sellc->n,
+                           *alpha,
+                           sellc->slice_ptr,
+                           sellc->perm,
+                           sellc->col_ind,
+                           (const T*)sellc->val,
+                           x,
+                           *beta,
+                           y,
+                           descr->base);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_sellcmv_template(rocsparse_handle handle,
+                                            rocsparse_operation trans,
+                                            const T* alpha,
+                                            const rocsparse_mat_descr descr,
+                                            const rocsparse_sellc_mat sellc,
+                                            const T* x,
+                                            const T* beta,
+                                            T* y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sellc == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xsellcmv"),
+                  trans,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)sellc,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f sellcmv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--sigma",
+                  sellc->sigma,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xsellcmv"),
+                  trans,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)sellc,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(sellc->m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(sellc->n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(sellc->sell_nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check SELL-C-sigma structure
+    if(sellc->sell_nnz > 0)
+    {
+        if(sellc->slice_size != 32 && sellc->slice_size != 64)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(sellc->slice_ptr == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(sellc->perm == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(sellc->col_ind == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(sellc->val == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    // Check pointer arguments
+    if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(sellc->m == 0 || sellc->n == 0 || sellc->sell_nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Run different sellcmv kernels
+    if(trans == rocsparse_operation_none)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            {
+                return rocsparse_status_success;
+            }
+        }
+
+        if(sellc->slice_size == 32)
+        {
+            return rocsparse_sellcmvn_launch<T, 32>(handle, alpha, descr, sellc, x, beta, y);
+        }
+        else
+        {
+            return rocsparse_sellcmvn_launch<T, 64>(handle, alpha, descr, sellc, x, beta, y);
+        }
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+}
+
+#undef SELLCMVN_DIM
+
+#endif // ROCSPARSE_SELLCMV_HPP
@@ -0,0 +1,90 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef SELLCMV_DEVICE_H
+#define SELLCMV_DEVICE_H
+
+#include "common.h"
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// SELL-C-sigma SpMV for general, non-transposed matrices. Each thread processes
+// one sorted row, such that a wavefront walks the columns of a slice with
+// coalesced loads. The result is written back to the original row.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int SLICE_SIZE>
+static __device__ void sellcmvn_device(rocsparse_int m,
+                                       rocsparse_int n,
+                                       T alpha,
+                                       const rocsparse_int* slice_ptr,
+                                       const rocsparse_int* perm,
+                                       const rocsparse_int* sell_col_ind,
+                                       const T* sell_val,
+                                       const T* x,
+                                       T beta,
+                                       T* y,
+                                       rocsparse_index_base idx_base)
+{
+    rocsparse_int p = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(p >= m)
+    {
+        return;
+    }
+
+    rocsparse_int slice = p / SLICE_SIZE;
+    rocsparse_int lane  = p % SLICE_SIZE;
+
+    rocsparse_int slice_begin = slice_ptr[slice];
+    rocsparse_int width       = (slice_ptr[slice + 1] - slice_begin) / SLICE_SIZE;
+
+    T sum = static_cast<T>(0);
+    for(rocsparse_int k = 0; k < width; ++k)
+    {
+        rocsparse_int idx = slice_begin + k * SLICE_SIZE + lane;
+        rocsparse_int col = sell_col_ind[idx] - idx_base;
+
+        if(col >= 0 && col < n)
+        {
+            sum = rocsparse_fma(sell_val[idx], rocsparse_ldg(x + col), sum);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    rocsparse_int row = perm[p];
+
+    if(beta != static_cast<T>(0))
+    {
+        y[row] = rocsparse_fma(beta, y[row], alpha * sum);
+    }
+    else
+    {
+        y[row] = alpha * sum;
+    }
+}
+
+#endif // SELLCMV_DEVICE_H
@@ -44,7 +44,7 @@ static __device__ void csrmmnn_general_device(rocsparse_int M,
                                               rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
     rocsparse_int lid = gid & (WF_SIZE - 1);
     rocsparse_int wid = tid / WF_SIZE;
     rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
@@ -113,7 +113,7 @@ static __device__ void csrmmnt_general_device(rocsparse_int offset,
                                               rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
     rocsparse_int row = gid / WF_SIZE;
     rocsparse_int lid = tid & (WF_SIZE - 1);
     rocsparse_int wid = tid / WF_SIZE;
@@ -0,0 +1,203 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRSM_DEVICE_H
+#define CSRSM_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Solves op(A) * X = alpha * op(B) for all right-hand sides, where X overwrites B.
+// Each wavefront processes a single row, each lane a single right-hand side.
+// Dependencies are waited for once per row entry and chunk of WF_SIZE right-hand
+// sides, such that the waiting is shared by all right-hand sides of a chunk.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__device__ void csrsm_device(rocsparse_int m,
+                             rocsparse_int nrhs,
+                             T alpha,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             const T* __restrict__ csr_val,
+                             T* __restrict__ B,
+                             rocsparse_int ldb,
+                             rocsparse_operation trans_B,
+                             rocsparse_int* __restrict__ done_array,
+                             rocsparse_int* __restrict__ map,
+                             rocsparse_int offset,
+                             rocsparse_int* __restrict__ zero_pivot,
+                             rocsparse_index_base idx_base,
+                             rocsparse_fill_mode fill_mode,
+                             rocsparse_diag_type diag_type)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+
+    // Index into the row map
+    rocsparse_int idx = gid / WF_SIZE;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Get the row this wavefront will operate on
+    rocsparse_int row = map[idx + offset];
+
+    // Current row entry point and exit point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Stride between two rows and two right-hand sides of B
+    rocsparse_int row_stride = (trans_B == rocsparse_operation_none) ? 1 : ldb;
+    rocsparse_int rhs_stride = (trans_B == rocsparse_operation_none) ? ldb : 1;
+
+    // Loop over chunks of right-hand sides
+    for(rocsparse_int rhs_begin = 0; rhs_begin < nrhs; rhs_begin += WF_SIZE)
+    {
+        // Right-hand side this lane operates on
+        rocsparse_int rhs = rhs_begin + lid;
+        bool active       = rhs < nrhs;
+
+        // Local summation variable
+        T local_sum = static_cast<T>(0);
+
+        if(active)
+        {
+            local_sum = alpha * B[row * row_stride + rhs * rhs_stride];
+        }
+
+        // Inverse of the diagonal entry
+        T diagonal = static_cast<T>(1);
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            // Current column and value, equal for all lanes
+            rocsparse_int local_col = csr_col_ind[j] - idx_base;
+            T local_val             = csr_val[j];
+
+            // Diagonal entry
+            if(local_col == row)
+            {
+                if(diag_type == rocsparse_diag_type_non_unit)
+                {
+                    // Check for numerical zero
+                    if(local_val == static_cast<T>(0))
+                    {
+                        // Numerical zero pivot found, avoid division by 0
+                        // and store index for later use.
+                        if(lid == 0 && rhs_begin == 0)
+                        {
+                            atomicMin(zero_pivot, row + idx_base);
+                        }
+
+                        local_val = static_cast<T>(1);
+                    }
+
+                    diagonal = static_cast<T>(1) / local_val;
+                }
+
+                if(fill_mode == rocsparse_fill_mode_lower)
+                {
+                    break;
+                }
+
+                continue;
+            }
+
+            // Differentiate upper and lower triangular mode
+            if(fill_mode == rocsparse_fill_mode_upper)
+            {
+                // Ignore all entries that are below the diagonal
+                if(local_col < row)
+                {
+                    continue;
+                }
+            }
+            else if(fill_mode == rocsparse_fill_mode_lower)
+            {
+                // Ignore all entries that are above the diagonal
+                if(local_col > row)
+                {
+                    break;
+                }
+            }
+
+// Spin loop until dependency has been resolved
+#if defined(__HIP_PLATFORM_HCC__)
+            while(!__atomic_load_n(&done_array[local_col], __ATOMIC_ACQUIRE))
+                ;
+#elif defined(__HIP_PLATFORM_NVCC__)
+            while(!atomicOr(&done_array[local_col], 0))
+                ;
+#endif
+
+            if(active)
+            {
+// Load solution value bypassing caches
+#if defined(__HIP_PLATFORM_HCC__)
+                T out_val;
+                __atomic_load(
+                    &B[local_col * row_stride + rhs * rhs_stride], &out_val, __ATOMIC_ACQUIRE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+                T out_val = B[local_col * row_stride + rhs * rhs_stride];
+#endif
+
+                local_sum -= local_val * out_val;
+            }
+        }
+
+        // If we have non unit diagonal, take the diagonal into account
+        if(diag_type == rocsparse_diag_type_non_unit)
+        {
+            local_sum *= diagonal;
+        }
+
+        if(active)
+        {
+#if defined(__HIP_PLATFORM_HCC__)
+            __atomic_store(&B[row * row_stride + rhs * rhs_stride], &local_sum, __ATOMIC_RELEASE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+            B[row * row_stride + rhs * rhs_stride] = local_sum;
+#endif
+        }
+    }
+
+    // Make the results of all lanes visible before the row is flagged as done
+    __threadfence();
+
+    if(lid == 0)
+    {
+// Lane 0 writes the "row is done" flag
+#if defined(__HIP_PLATFORM_HCC__)
+        __atomic_store_n(&done_array[row], 1, __ATOMIC_RELEASE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+        atomicOr(&done_array[row], 1);
+#endif
+    }
+}
+
+#endif // CSRSM_DEVICE_H
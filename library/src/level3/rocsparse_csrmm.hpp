@@ -26,6 +26,8 @@
 #define ROCSPARSE_CSRMM_HPP
 
 #include "rocsparse.h"
+#include "definitions.h"
+#include "grid.h"
 #include "handle.h"
 #include "utility.h"
 #include "csrmm_device.h"
@@ -349,7 +351,10 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle handle,
         {
 #define CSRMMNN_DIM 256
 #define SUB_WF_SIZE 8
-            dim3 csrmmnn_blocks((SUB_WF_SIZE * m - 1) / CSRMMNN_DIM + 1, (n - 1) / SUB_WF_SIZE + 1);
+            dim3 csrmmnn_blocks;
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(
+                static_cast<int64_t>(SUB_WF_SIZE) * m, CSRMMNN_DIM, csrmmnn_blocks));
+            csrmmnn_blocks.y = (n - 1) / SUB_WF_SIZE + 1;
             dim3 csrmmnn_threads(CSRMMNN_DIM);
 
             if(handle->pointer_mode == rocsparse_pointer_mode_device)
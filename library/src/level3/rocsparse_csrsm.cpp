@@ -0,0 +1,356 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+#include "rocsparse_csrsm.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_scsrsm_buffer_size(rocsparse_handle handle,
+                                                         rocsparse_operation trans_A,
+                                                         rocsparse_operation trans_B,
+                                                         rocsparse_int m,
+                                                         rocsparse_int nrhs,
+                                                         rocsparse_int nnz,
+                                                         const float* alpha,
+                                                         const rocsparse_mat_descr descr,
+                                                         const float* csr_val,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         const rocsparse_int* csr_col_ind,
+                                                         const float* B,
+                                                         rocsparse_int ldb,
+                                                         rocsparse_mat_info info,
+                                                         rocsparse_solve_policy policy,
+                                                         size_t* buffer_size)
+{
+    return rocsparse_csrsm_buffer_size_template<float>(handle,
+                                                       trans_A,
+                                                       trans_B,
+                                                       m,
+                                                       nrhs,
+                                                       nnz,
+                                                       alpha,
+                                                       descr,
+                                                       csr_val,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       B,
+                                                       ldb,
+                                                       info,
+                                                       policy,
+                                                       buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrsm_buffer_size(rocsparse_handle handle,
+                                                         rocsparse_operation trans_A,
+                                                         rocsparse_operation trans_B,
+                                                         rocsparse_int m,
+                                                         rocsparse_int nrhs,
+                                                         rocsparse_int nnz,
+                                                         const double* alpha,
+                                                         const rocsparse_mat_descr descr,
+                                                         const double* csr_val,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         const rocsparse_int* csr_col_ind,
+                                                         const double* B,
+                                                         rocsparse_int ldb,
+                                                         rocsparse_mat_info info,
+                                                         rocsparse_solve_policy policy,
+                                                         size_t* buffer_size)
+{
+    return rocsparse_csrsm_buffer_size_template<double>(handle,
+                                                        trans_A,
+                                                        trans_B,
+                                                        m,
+                                                        nrhs,
+                                                        nnz,
+                                                        alpha,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        B,
+                                                        ldb,
+                                                        info,
+                                                        policy,
+                                                        buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_scsrsm_analysis(rocsparse_handle handle,
+                                                      rocsparse_operation trans_A,
+                                                      rocsparse_operation trans_B,
+                                                      rocsparse_int m,
+                                                      rocsparse_int nrhs,
+                                                      rocsparse_int nnz,
+                                                      const float* alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const float* csr_val,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      const float* B,
+                                                      rocsparse_int ldb,
+                                                      rocsparse_mat_info info,
+                                                      rocsparse_analysis_policy analysis,
+                                                      rocsparse_solve_policy solve,
+                                                      void* temp_buffer)
+{
+    return rocsparse_csrsm_analysis_template<float>(handle,
+                                                    trans_A,
+                                                    trans_B,
+                                                    m,
+                                                    nrhs,
+                                                    nnz,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    B,
+                                                    ldb,
+                                                    info,
+                                                    analysis,
+                                                    solve,
+                                                    temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrsm_analysis(rocsparse_handle handle,
+                                                      rocsparse_operation trans_A,
+                                                      rocsparse_operation trans_B,
+                                                      rocsparse_int m,
+                                                      rocsparse_int nrhs,
+                                                      rocsparse_int nnz,
+                                                      const double* alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const double* csr_val,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      const double* B,
+                                                      rocsparse_int ldb,
+                                                      rocsparse_mat_info info,
+                                                      rocsparse_analysis_policy analysis,
+                                                      rocsparse_solve_policy solve,
+                                                      void* temp_buffer)
+{
+    return rocsparse_csrsm_analysis_template<double>(handle,
+                                                     trans_A,
+                                                     trans_B,
+                                                     m,
+                                                     nrhs,
+                                                     nnz,
+                                                     alpha,
+                                                     descr,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     B,
+                                                     ldb,
+                                                     info,
+                                                     analysis,
+                                                     solve,
+                                                     temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_csrsm_clear(rocsparse_handle handle,
+                                                  const rocsparse_mat_descr descr,
+                                                  rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrsm_clear", (const void*&)descr, (const void*&)info);
+
+    // Determine which info meta data should be deleted
+    if(descr->fill_mode == rocsparse_fill_mode_lower)
+    {
+        // If meta data is shared, do not delete anything
+        if(info->csrsm_lower_info == info->csrilu0_info
+           || info->csrsm_lower_info == info->csric0_info
+           || info->csrsm_lower_info == info->csrsv_lower_info)
+        {
+            info->csrsm_lower_info = nullptr;
+
+            return rocsparse_status_success;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsm_lower_info));
+        info->csrsm_lower_info = nullptr;
+    }
+    else if(descr->fill_mode == rocsparse_fill_mode_upper)
+    {
+        // If meta data is shared, do not delete anything
+        if(info->csrsm_upper_info == info->csrsv_upper_info)
+        {
+            info->csrsm_upper_info = nullptr;
+
+            return rocsparse_status_success;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsm_upper_info));
+        info->csrsm_upper_info = nullptr;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsrsm_solve(rocsparse_handle handle,
+                                                   rocsparse_operation trans_A,
+                                                   rocsparse_operation trans_B,
+                                                   rocsparse_int m,
+                                                   rocsparse_int nrhs,
+                                                   rocsparse_int nnz,
+                                                   const float* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const float* csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   float* B,
+                                                   rocsparse_int ldb,
+                                                   rocsparse_mat_info info,
+                                                   rocsparse_solve_policy policy,
+                                                   void* temp_buffer)
+{
+    return rocsparse_csrsm_solve_template<float>(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 m,
+                                                 nrhs,
+                                                 nnz,
+                                                 alpha,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 B,
+                                                 ldb,
+                                                 info,
+                                                 policy,
+                                                 temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrsm_solve(rocsparse_handle handle,
+                                                   rocsparse_operation trans_A,
+                                                   rocsparse_operation trans_B,
+                                                   rocsparse_int m,
+                                                   rocsparse_int nrhs,
+                                                   rocsparse_int nnz,
+                                                   const double* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const double* csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   double* B,
+                                                   rocsparse_int ldb,
+                                                   rocsparse_mat_info info,
+                                                   rocsparse_solve_policy policy,
+                                                   void* temp_buffer)
+{
+    return rocsparse_csrsm_solve_template<double>(handle,
+                                                  trans_A,
+                                                  trans_B,
+                                                  m,
+                                                  nrhs,
+                                                  nnz,
+                                                  alpha,
+                                                  descr,
+                                                  csr_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  B,
+                                                  ldb,
+                                                  info,
+                                                  policy,
+                                                  temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_csrsm_zero_pivot(rocsparse_handle handle,
+                                                       const rocsparse_mat_descr descr,
+                                                       rocsparse_mat_info info,
+                                                       rocsparse_int* position)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrsm_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Determine the info meta data place
+    rocsparse_csrtr_info csrsm = nullptr;
+
+    // For hipSPARSE compatibility mode, we allow descr == nullptr
+    // In this case, only lower OR upper is populated and we can use the right
+    // info meta data
+    if(descr == nullptr)
+    {
+        if(info->csrsm_lower_info != nullptr)
+        {
+            csrsm = info->csrsm_lower_info;
+        }
+        else
+        {
+            csrsm = info->csrsm_upper_info;
+        }
+    }
+    else
+    {
+        // Switch between upper and lower triangular
+        if(descr->fill_mode == rocsparse_fill_mode_lower)
+        {
+            csrsm = info->csrsm_lower_info;
+        }
+        else
+        {
+            csrsm = info->csrsm_upper_info;
+        }
+    }
+
+    return rocsparse_csrtr_zero_pivot(handle, csrsm, position);
+}
@@ -0,0 +1,835 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRSM_HPP
+#define ROCSPARSE_CSRSM_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "grid.h"
+#include "handle.h"
+#include "utility.h"
+#include "../level2/rocsparse_csrsv.hpp"
+#include "csrsm_device.h"
+
+#include <algorithm>
+#include <limits>
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_csrsm_buffer_size_template(rocsparse_handle handle,
+                                                      rocsparse_operation trans_A,
+                                                      rocsparse_operation trans_B,
+                                                      rocsparse_int m,
+                                                      rocsparse_int nrhs,
+                                                      rocsparse_int nnz,
+                                                      const T* alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T* csr_val,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      const T* B,
+                                                      rocsparse_int ldb,
+                                                      rocsparse_mat_info info,
+                                                      rocsparse_solve_policy policy,
+                                                      size_t* buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrsm_buffer_size"),
+              trans_A,
+              trans_B,
+              m,
+              nrhs,
+              nnz,
+              (const void*&)alpha,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)B,
+              ldb,
+              (const void*&)info,
+              policy,
+              (const void*&)buffer_size);
+
+    // Check operation
+    if(trans_A != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    else if(trans_B != rocsparse_operation_none && trans_B != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nrhs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nrhs == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Same temporary storage as csrsv, the done array is shared by all right-hand sides
+    return rocsparse_csrtr_buffer_size(m, buffer_size);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle handle,
+                                                   rocsparse_operation trans_A,
+                                                   rocsparse_operation trans_B,
+                                                   rocsparse_int m,
+                                                   rocsparse_int nrhs,
+                                                   rocsparse_int nnz,
+                                                   const T* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T* csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   const T* B,
+                                                   rocsparse_int ldb,
+                                                   rocsparse_mat_info info,
+                                                   rocsparse_analysis_policy analysis,
+                                                   rocsparse_solve_policy solve,
+                                                   void* temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrsm_analysis"),
+              trans_A,
+              trans_B,
+              m,
+              nrhs,
+              nnz,
+              (const void*&)alpha,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)B,
+              ldb,
+              (const void*&)info,
+              analysis,
+              solve,
+              (const void*&)temp_buffer);
+
+    // Check operation
+    if(trans_A != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    else if(trans_B != rocsparse_operation_none && trans_B != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check analysis policy
+    if(analysis != rocsparse_analysis_policy_reuse && analysis != rocsparse_analysis_policy_force)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check solve policy
+    if(solve != rocsparse_solve_policy_auto && solve != rocsparse_solve_policy_sync_free &&
+       solve != rocsparse_solve_policy_level)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nrhs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nrhs == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // The dependency graph only depends on the sparsity pattern of the triangular part,
+    // thus meta data of other triangular routines can be shared
+    bool upper = descr->fill_mode == rocsparse_fill_mode_upper;
+
+    rocsparse_csrtr_info* csrsm = upper ? &info->csrsm_upper_info : &info->csrsm_lower_info;
+
+    // Differentiate the analysis policies
+    if(analysis == rocsparse_analysis_policy_reuse)
+    {
+        // We try to re-use already analyzed meta data, if available.
+        // It is the user's responsibility that this data is still valid,
+        // since he passed the 'reuse' flag.
+
+        // Check for other meta data of the same triangular part
+        rocsparse_csrtr_info reuse = *csrsm;
+
+        if(reuse == nullptr)
+        {
+            reuse = upper ? info->csrsv_upper_info : info->csrsv_lower_info;
+        }
+
+        if(reuse == nullptr && !upper)
+        {
+            reuse = info->csrilu0_info;
+        }
+
+        if(reuse == nullptr && !upper)
+        {
+            reuse = info->csric0_info;
+        }
+
+        // If data has been found, use it
+        if(reuse != nullptr)
+        {
+            *csrsm = reuse;
+
+            // Move the level information to the host, if the solve is going to be
+            // level scheduled
+            if(rocsparse_csrsv_level_scheduled(handle, reuse, solve))
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_rows_per_level(handle, reuse));
+            }
+
+            return rocsparse_status_success;
+        }
+    }
+
+    // User is explicitly asking to force a re-analysis, or no valid data has been
+    // found to be re-used.
+
+    // Clear csrsm info, unless it is shared
+    if(*csrsm != info->csrsv_upper_info && *csrsm != info->csrsv_lower_info
+       && *csrsm != info->csrilu0_info && *csrsm != info->csric0_info)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(*csrsm));
+    }
+
+    // Create csrsm info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(csrsm));
+
+    // Perform analysis
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis(
+        handle, trans_A, m, nnz, descr, csr_row_ptr, csr_col_ind, *csrsm, temp_buffer));
+
+    // Move the level information to the host, if the solve is going to be level scheduled
+    if(rocsparse_csrsv_level_scheduled(handle, *csrsm, solve))
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_rows_per_level(handle, *csrsm));
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsm_host_pointer(rocsparse_int m,
+                            rocsparse_int nrhs,
+                            T alpha,
+                            const rocsparse_int* __restrict__ csr_row_ptr,
+                            const rocsparse_int* __restrict__ csr_col_ind,
+                            const T* __restrict__ csr_val,
+                            T* __restrict__ B,
+                            rocsparse_int ldb,
+                            rocsparse_operation trans_B,
+                            rocsparse_int* __restrict__ done_array,
+                            rocsparse_int* __restrict__ map,
+                            rocsparse_int offset,
+                            rocsparse_int* __restrict__ zero_pivot,
+                            rocsparse_index_base idx_base,
+                            rocsparse_fill_mode fill_mode,
+                            rocsparse_diag_type diag_type)
+{
+    csrsm_device<T, BLOCKSIZE, WF_SIZE>(m,
+                                        nrhs,
+                                        alpha,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        csr_val,
+                                        B,
+                                        ldb,
+                                        trans_B,
+                                        done_array,
+                                        map,
+                                        offset,
+                                        zero_pivot,
+                                        idx_base,
+                                        fill_mode,
+                                        diag_type);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsm_device_pointer(rocsparse_int m,
+                              rocsparse_int nrhs,
+                              const T* alpha,
+                              const rocsparse_int* __restrict__ csr_row_ptr,
+                              const rocsparse_int* __restrict__ csr_col_ind,
+                              const T* __restrict__ csr_val,
+                              T* __restrict__ B,
+                              rocsparse_int ldb,
+                              rocsparse_operation trans_B,
+                              rocsparse_int* __restrict__ done_array,
+                              rocsparse_int* __restrict__ map,
+                              rocsparse_int offset,
+                              rocsparse_int* __restrict__ zero_pivot,
+                              rocsparse_index_base idx_base,
+                              rocsparse_fill_mode fill_mode,
+                              rocsparse_diag_type diag_type)
+{
+    csrsm_device<T, BLOCKSIZE, WF_SIZE>(m,
+                                        nrhs,
+                                        *alpha,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        csr_val,
+                                        B,
+                                        ldb,
+                                        trans_B,
+                                        done_array,
+                                        map,
+                                        offset,
+                                        zero_pivot,
+                                        idx_base,
+                                        fill_mode,
+                                        diag_type);
+}
+
+// Solve the rows map[offset] to map[offset + rows - 1] for all right-hand sides,
+// rows wait for their dependencies to be resolved
+template <typename T>
+static rocsparse_status rocsparse_csrsm_launch(rocsparse_handle handle,
+                                               rocsparse_operation trans_B,
+                                               rocsparse_int rows,
+                                               rocsparse_int offset,
+                                               rocsparse_int nrhs,
+                                               const T* alpha,
+                                               const rocsparse_mat_descr descr,
+                                               const T* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               T* B,
+                                               rocsparse_int ldb,
+                                               rocsparse_csrtr_info csrsm,
+                                               rocsparse_int* d_done_array)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRSM_DIM 256
+    dim3 csrsm_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(
+        static_cast<int64_t>(handle->wavefront_size) * rows, CSRSM_DIM, csrsm_blocks));
+    dim3 csrsm_threads(CSRSM_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrsm_device_pointer<T, CSRSM_DIM, 32>),
+                               csrsm_blocks,
+                               csrsm_threads,
+                               0,
+                               stream,
+                               rows,
+                               nrhs,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               B,
+                               ldb,
+                               trans_B,
+                               d_done_array,
+                               csrsm->d_row_map,
+                               offset,
+                               csrsm->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrsm_device_pointer<T, CSRSM_DIM, 64>),
+                               csrsm_blocks,
+                               csrsm_threads,
+                               0,
+                               stream,
+                               rows,
+                               nrhs,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               B,
+                               ldb,
+                               trans_B,
+                               d_done_array,
+                               csrsm->d_row_map,
+                               offset,
+                               csrsm->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrsm_host_pointer<T, CSRSM_DIM, 32>),
+                               csrsm_blocks,
+                               csrsm_threads,
+                               0,
+                               stream,
+                               rows,
+                               nrhs,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               B,
+                               ldb,
+                               trans_B,
+                               d_done_array,
+                               csrsm->d_row_map,
+                               offset,
+                               csrsm->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrsm_host_pointer<T, CSRSM_DIM, 64>),
+                               csrsm_blocks,
+                               csrsm_threads,
+                               0,
+                               stream,
+                               rows,
+                               nrhs,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               B,
+                               ldb,
+                               trans_B,
+                               d_done_array,
+                               csrsm->d_row_map,
+                               offset,
+                               csrsm->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+#undef CSRSM_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle handle,
+                                                rocsparse_operation trans_A,
+                                                rocsparse_operation trans_B,
+                                                rocsparse_int m,
+                                                rocsparse_int nrhs,
+                                                rocsparse_int nnz,
+                                                const T* alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                T* B,
+                                                rocsparse_int ldb,
+                                                rocsparse_mat_info info,
+                                                rocsparse_solve_policy policy,
+                                                void* temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsm_solve"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  nrhs,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)info,
+                  policy,
+                  (const void*&)temp_buffer);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrsm -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> ",
+                  "--sizek",
+                  nrhs,
+                  "--alpha",
+                  *alpha);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsm_solve"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  nrhs,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)info,
+                  policy,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check operation
+    if(trans_A != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    else if(trans_B != rocsparse_operation_none && trans_B != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check solve policy
+    if(policy != rocsparse_solve_policy_auto && policy != rocsparse_solve_policy_sync_free &&
+       policy != rocsparse_solve_policy_level)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nrhs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check leading dimension of B
+    rocsparse_int one = 1;
+
+    if(trans_B == rocsparse_operation_none)
+    {
+        if(ldb < std::max(one, m))
+        {
+            return rocsparse_status_invalid_size;
+        }
+    }
+    else
+    {
+        if(ldb < std::max(one, nrhs))
+        {
+            return rocsparse_status_invalid_size;
+        }
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nrhs == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    rocsparse_csrtr_info csrsm = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                     ? info->csrsm_upper_info
+                                     : info->csrsm_lower_info;
+
+    // Analysis is required
+    if(csrsm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    ptr += 256;
+    ptr += 256;
+    ptr += 256;
+
+    // done array
+    rocsparse_int* d_done_array = reinterpret_cast<rocsparse_int*>(ptr);
+
+    // Initialize buffers, once for all right-hand sides
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(rocsparse_int) * m, stream));
+
+    // If diag type is unit, re-initialize zero pivot to remove structural zeros
+    if(descr->diag_type == rocsparse_diag_type_unit)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_zero_pivot_init(csrsm->zero_pivot, stream));
+    }
+
+    if(rocsparse_csrsv_level_scheduled(handle, csrsm, policy))
+    {
+        // Level scheduling, one kernel launch per level
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_rows_per_level(handle, csrsm));
+
+        rocsparse_int depth_offset = 0;
+
+        for(rocsparse_int level = 0; level < csrsm->max_depth; ++level)
+        {
+            rocsparse_int rows = csrsm->rows_per_level[level] - depth_offset;
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsm_launch(handle,
+                                                             trans_B,
+                                                             rows,
+                                                             depth_offset,
+                                                             nrhs,
+                                                             alpha,
+                                                             descr,
+                                                             csr_val,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             B,
+                                                             ldb,
+                                                             csrsm,
+                                                             d_done_array));
+
+            depth_offset = csrsm->rows_per_level[level];
+        }
+    }
+    else
+    {
+        // Sync-free, all rows in a single kernel launch
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsm_launch(handle,
+                                                         trans_B,
+                                                         m,
+                                                         0,
+                                                         nrhs,
+                                                         alpha,
+                                                         descr,
+                                                         csr_val,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         B,
+                                                         ldb,
+                                                         csrsm,
+                                                         d_done_array));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRSM_HPP
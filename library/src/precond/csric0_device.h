@@ -0,0 +1,403 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRIC0_DEVICE_H
+#define CSRIC0_DEVICE_H
+
+#include "../level2/csrsv_device.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, unsigned int HASH>
+__global__ void csric0_hash_kernel(rocsparse_int m,
+                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                   T* __restrict__ csr_val,
+                                   const rocsparse_int* __restrict__ csr_diag_ind,
+                                   rocsparse_int* __restrict__ done,
+                                   rocsparse_int* __restrict__ map,
+                                   rocsparse_int* __restrict__ zero_pivot,
+                                   rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int idx = gid / WF_SIZE;
+
+    __shared__ rocsparse_int stable[BLOCKSIZE * HASH];
+    __shared__ rocsparse_int sdata[BLOCKSIZE * HASH];
+
+    // Pointer to each wavefronts shared data
+    rocsparse_int* table = &stable[(tid / WF_SIZE) * WF_SIZE * HASH];
+    rocsparse_int* data  = &sdata[(tid / WF_SIZE) * WF_SIZE * HASH];
+
+    // Initialize hash table with -1
+    for(rocsparse_int j = lid; j < WF_SIZE * HASH; j += WF_SIZE)
+    {
+        table[j] = -1;
+    }
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Current row this wavefront is working on
+    rocsparse_int row = map[idx];
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag  = csr_diag_ind[row];
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+
+    // Structural zero pivot, nothing to factorize
+    if(row_diag == -1)
+    {
+        row_diag = row_begin;
+    }
+
+    // Fill hash table
+    // Loop over the strictly lower columns of current row and fill hash table with
+    // row dependencies. Each lane processes one entry
+    for(rocsparse_int j = row_begin + lid; j < row_diag; j += WF_SIZE)
+    {
+        // Insert key into hash table
+        rocsparse_int key = csr_col_ind[j];
+        // Compute hash
+        rocsparse_int hash = (key * 103) & (WF_SIZE * HASH - 1);
+
+        // Hash operation
+        while(true)
+        {
+            if(table[hash] == key)
+            {
+                // key is already inserted, done
+                break;
+            }
+            else if(atomicCAS(&table[hash], -1, key) == -1)
+            {
+                // inserted key into the table, done
+                data[hash] = j;
+                break;
+            }
+            else
+            {
+                // collision, compute new hash
+                hash = (hash + 1) & (WF_SIZE * HASH - 1);
+            }
+        }
+    }
+
+    // Loop over the strictly lower columns of current row
+    rocsparse_int j;
+    for(j = row_begin; j < row_diag; ++j)
+    {
+        // Column index currently being processes
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+        // Begin of the row that corresponds to local_col
+        rocsparse_int local_begin = csr_row_ptr[local_col] - idx_base;
+        // Diagonal entry point of row local_col
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+
+        // Structural zero pivot, do not process this row
+        if(local_diag == -1)
+        {
+            break;
+        }
+
+        // Spin loop until dependency has been resolved
+        rocsparse_int local_done = 0;
+        while(!local_done)
+        {
+#if defined(__HIP_PLATFORM_HCC__)
+            local_done = __atomic_load_n(&done[local_col], __ATOMIC_ACQUIRE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+            local_done      = atomicOr(&done[local_col], 0);
+#endif
+        }
+
+        // Inner product of the rows of L, that have been computed so far
+        // Each lane processes one entry of the row the current column index depends on
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int k = local_begin + lid; k < local_diag; k += WF_SIZE)
+        {
+            // Get value from hash table
+            rocsparse_int key = csr_col_ind[k];
+            // Compute hash
+            rocsparse_int hash = (key * 103) & (WF_SIZE * HASH - 1);
+
+            // Hash operation
+            while(true)
+            {
+                rocsparse_int val = table[hash];
+
+                if(val == -1)
+                {
+                    // No entry for the key, done
+                    break;
+                }
+                else if(val == key)
+                {
+// Entry found, accumulate
+#if defined(__HIP_PLATFORM_HCC__)
+                    T val_k;
+                    __atomic_load(&csr_val[k], &val_k, __ATOMIC_ACQUIRE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+                    T val_k = csr_val[k];
+#endif
+                    sum += val_k * csr_val[data[hash]];
+                    break;
+                }
+
+                // Collision, compute new hash
+                hash = (hash + 1) & (WF_SIZE * HASH - 1);
+            }
+        }
+
+        // Sum up the partial inner products
+        sum = wf_reduce<WF_SIZE>(sum);
+
+        if(lid == 0)
+        {
+// Load diagonal entry
+#if defined(__HIP_PLATFORM_HCC__)
+            T diag_val;
+            __atomic_load(&csr_val[local_diag], &diag_val, __ATOMIC_ACQUIRE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+            T diag_val = csr_val[local_diag];
+#endif
+
+            csr_val[j] = (csr_val[j] - sum) / diag_val;
+        }
+
+        // Make the new entry of L visible to all lanes
+        __threadfence_block();
+    }
+
+    // Compute the diagonal entry, unless the row has been skipped
+    if(j == row_diag && csr_diag_ind[row] != -1)
+    {
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int k = row_begin + lid; k < row_diag; k += WF_SIZE)
+        {
+            T val_k = csr_val[k];
+            sum += val_k * val_k;
+        }
+
+        sum = wf_reduce<WF_SIZE>(sum);
+
+        if(lid == 0)
+        {
+            T diag_val = csr_val[row_diag] - sum;
+
+            // Matrix is not positive definite
+            if(diag_val <= static_cast<T>(0))
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, row + idx_base);
+            }
+            else
+            {
+                csr_val[row_diag] = sqrt(diag_val);
+            }
+        }
+    }
+
+    if(lid == 0)
+    {
+// Lane 0 write "we are done" flag
+#if defined(__HIP_PLATFORM_HCC__)
+        __atomic_store_n(&done[row], 1, __ATOMIC_RELEASE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+        atomicOr(&done[row], 1);
+#endif
+    }
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__global__ void csric0_binsearch_kernel(rocsparse_int m,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        const rocsparse_int* __restrict__ csr_col_ind,
+                                        T* __restrict__ csr_val,
+                                        const rocsparse_int* __restrict__ csr_diag_ind,
+                                        rocsparse_int* __restrict__ done,
+                                        rocsparse_int* __restrict__ map,
+                                        rocsparse_int* __restrict__ zero_pivot,
+                                        rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int idx = gid / WF_SIZE;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Current row this wavefront is working on
+    rocsparse_int row = map[idx];
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag  = csr_diag_ind[row];
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+
+    // Structural zero pivot, nothing to factorize
+    if(row_diag == -1)
+    {
+        row_diag = row_begin;
+    }
+
+    // Loop over the strictly lower columns of current row
+    rocsparse_int j;
+    for(j = row_begin; j < row_diag; ++j)
+    {
+        // Column index currently being processes
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+        // Begin of the row that corresponds to local_col
+        rocsparse_int local_begin = csr_row_ptr[local_col] - idx_base;
+        // Diagonal entry point of row local_col
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+
+        // Structural zero pivot, do not process this row
+        if(local_diag == -1)
+        {
+            break;
+        }
+
+        // Spin loop until dependency has been resolved
+        rocsparse_int local_done = 0;
+        while(!local_done)
+        {
+#if defined(__HIP_PLATFORM_HCC__)
+            local_done = __atomic_load_n(&done[local_col], __ATOMIC_ACQUIRE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+            local_done = atomicOr(&done[local_col], 0);
+#endif
+        }
+
+        // Inner product of the rows of L, that have been computed so far
+        // Each lane processes one entry of the row the current column index depends on
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int k = local_begin + lid; k < local_diag; k += WF_SIZE)
+        {
+            // Perform a binary search to find matching columns in the already
+            // computed part of the current row
+            rocsparse_int l     = row_begin;
+            rocsparse_int r     = j;
+            rocsparse_int col_k = csr_col_ind[k];
+
+            while(l < r)
+            {
+                rocsparse_int mid = (l + r) >> 1;
+
+                if(csr_col_ind[mid] < col_k)
+                {
+                    l = mid + 1;
+                }
+                else
+                {
+                    r = mid;
+                }
+            }
+
+            // Check if a match has been found
+            if(l < j && csr_col_ind[l] == col_k)
+            {
+#if defined(__HIP_PLATFORM_HCC__)
+                T val_k;
+                __atomic_load(&csr_val[k], &val_k, __ATOMIC_ACQUIRE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+                volatile T val_k = csr_val[k];
+#endif
+
+                sum += val_k * csr_val[l];
+            }
+        }
+
+        // Sum up the partial inner products
+        sum = wf_reduce<WF_SIZE>(sum);
+
+        if(lid == 0)
+        {
+// Load diagonal entry
+#if defined(__HIP_PLATFORM_HCC__)
+            T diag_val;
+            __atomic_load(&csr_val[local_diag], &diag_val, __ATOMIC_ACQUIRE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+            volatile T diag_val = csr_val[local_diag];
+#endif
+
+            csr_val[j] = (csr_val[j] - sum) / diag_val;
+        }
+
+        // Make the new entry of L visible to all lanes
+        __threadfence_block();
+    }
+
+    // Compute the diagonal entry, unless the row has been skipped
+    if(j == row_diag && csr_diag_ind[row] != -1)
+    {
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int k = row_begin + lid; k < row_diag; k += WF_SIZE)
+        {
+            T val_k = csr_val[k];
+            sum += val_k * val_k;
+        }
+
+        sum = wf_reduce<WF_SIZE>(sum);
+
+        if(lid == 0)
+        {
+            T diag_val = csr_val[row_diag] - sum;
+
+            // Matrix is not positive definite
+            if(diag_val <= static_cast<T>(0))
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, row + idx_base);
+            }
+            else
+            {
+                csr_val[row_diag] = sqrt(diag_val);
+            }
+        }
+    }
+
+    if(lid == 0)
+    {
+// Lane 0 write "we are done" flag
+#if defined(__HIP_PLATFORM_HCC__)
+        __atomic_store_n(&done[row], 1, __ATOMIC_RELEASE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+        atomicOr(&done[row], 1);
+#endif
+    }
+}
+
+#endif // CSRIC0_DEVICE_H
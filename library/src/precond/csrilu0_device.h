@@ -25,6 +25,8 @@
 #ifndef CSRILU0_DEVICE_H
 #define CSRILU0_DEVICE_H
 
+#include "common.h"
+
 #include <hip/hip_runtime.h>
 
 template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, unsigned int HASH>
@@ -36,10 +38,14 @@ __global__ void csrilu0_hash_kernel(rocsparse_int m,
                                     rocsparse_int* __restrict__ done,
                                     rocsparse_int* __restrict__ map,
                                     rocsparse_int* __restrict__ zero_pivot,
+                                    int boost,
+                                    double boost_tol,
+                                    T boost_val,
+                                    rocsparse_int* __restrict__ boost_count,
                                     rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
     rocsparse_int lid = tid & (WF_SIZE - 1);
     rocsparse_int idx = gid / WF_SIZE;
 
@@ -132,8 +138,7 @@ __global__ void csrilu0_hash_kernel(rocsparse_int m,
 
 // Load diagonal entry
 #if defined(__HIP_PLATFORM_HCC__)
-        T diag_val;
-        __atomic_load(&csr_val[local_diag], &diag_val, __ATOMIC_ACQUIRE);
+        T diag_val = rocsparse_atomic_load(&csr_val[local_diag], __ATOMIC_ACQUIRE);
 #elif defined(__HIP_PLATFORM_NVCC__)
         T diag_val          = csr_val[local_diag];
 #endif
@@ -176,12 +181,11 @@ __global__ void csrilu0_hash_kernel(rocsparse_int m,
                 {
 // Entry found, do ILU computation
 #if defined(__HIP_PLATFORM_HCC__)
-                    T val_k;
-                    __atomic_load(&csr_val[k], &val_k, __ATOMIC_ACQUIRE);
+                    T val_k = rocsparse_atomic_load(&csr_val[k], __ATOMIC_ACQUIRE);
 #elif defined(__HIP_PLATFORM_NVCC__)
                     T val_k = csr_val[k];
 #endif
-                    csr_val[data[hash]] -= local_val * val_k;
+                    csr_val[data[hash]] = rocsparse_fma(-local_val, val_k, csr_val[data[hash]]);
                     break;
                 }
 
@@ -191,6 +195,18 @@ __global__ void csrilu0_hash_kernel(rocsparse_int m,
         }
     }
 
+    // Boost a tiny pivot of the current row, before the dependent rows are released
+    if(boost)
+    {
+        __threadfence_block();
+
+        if(lid == 0 && row_diag != -1 && rocsparse_abs(csr_val[row_diag]) <= boost_tol)
+        {
+            csr_val[row_diag] = boost_val;
+            atomicAdd(boost_count, 1);
+        }
+    }
+
     if(lid == 0)
     {
 // Lane 0 write "we are done" flag
@@ -211,10 +227,14 @@ __global__ void csrilu0_binsearch_kernel(rocsparse_int m,
                                          rocsparse_int* __restrict__ done,
                                          rocsparse_int* __restrict__ map,
                                          rocsparse_int* __restrict__ zero_pivot,
+                                         int boost,
+                                         double boost_tol,
+                                         T boost_val,
+                                         rocsparse_int* __restrict__ boost_count,
                                          rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + tid;
     rocsparse_int lid = tid & (WF_SIZE - 1);
     rocsparse_int idx = gid / WF_SIZE;
 
@@ -262,8 +282,7 @@ __global__ void csrilu0_binsearch_kernel(rocsparse_int m,
 
 // Load diagonal entry
 #if defined(__HIP_PLATFORM_HCC__)
-        T diag_val;
-        __atomic_load(&csr_val[local_diag], &diag_val, __ATOMIC_ACQUIRE);
+        T diag_val = rocsparse_atomic_load(&csr_val[local_diag], __ATOMIC_ACQUIRE);
 #elif defined(__HIP_PLATFORM_NVCC__)
         // TODO
         volatile T diag_val      = csr_val[local_diag];
@@ -317,17 +336,28 @@ __global__ void csrilu0_binsearch_kernel(rocsparse_int m,
             {
 // If a match has been found, do ILU computation
 #if defined(__HIP_PLATFORM_HCC__)
-                T val_k;
-                __atomic_load(&csr_val[k], &val_k, __ATOMIC_ACQUIRE);
+                T val_k = rocsparse_atomic_load(&csr_val[k], __ATOMIC_ACQUIRE);
 #elif defined(__HIP_PLATFORM_NVCC__)
                 volatile T val_k = csr_val[k];
 #endif
 
-                csr_val[l] -= local_val * val_k;
+                csr_val[l] = rocsparse_fma(-local_val, val_k, csr_val[l]);
             }
         }
     }
 
+    // Boost a tiny pivot of the current row, before the dependent rows are released
+    if(boost)
+    {
+        __threadfence_block();
+
+        if(lid == 0 && row_diag != -1 && rocsparse_abs(csr_val[row_diag]) <= boost_tol)
+        {
+            csr_val[row_diag] = boost_val;
+            atomicAdd(boost_count, 1);
+        }
+    }
+
     if(lid == 0)
     {
 // Lane 0 write "we are done" flag
@@ -0,0 +1,55 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRILUK_DEVICE_H
+#define CSRILUK_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// Copy the entries of A into the sparsity pattern of the incomplete factors, entries
+// that are not part of the pattern are marked by -1
+template <typename T>
+__global__ void csriluk_scatter_kernel(rocsparse_int nnz,
+                                       const rocsparse_int* __restrict__ scatter,
+                                       const T* __restrict__ csr_val,
+                                       T* __restrict__ csr_val_M)
+{
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int idx = scatter[gid];
+
+    if(idx >= 0)
+    {
+        csr_val_M[idx] = csr_val[gid];
+    }
+}
+
+#endif // CSRILUK_DEVICE_H
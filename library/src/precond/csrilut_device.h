@@ -0,0 +1,543 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRILUT_DEVICE_H
+#define CSRILUT_DEVICE_H
+
+#include "common.h"
+
+#include <limits>
+#include <hip/hip_runtime.h>
+
+// Sum of min(t, p) over t = 0, ..., n - 1
+static __device__ __host__ __inline__ int64_t rocsparse_csrilut_part_sum(int64_t n, int64_t p)
+{
+    return (n <= p + 1) ? n * (n - 1) / 2 : p * (p + 1) / 2 + (n - 1 - p) * p;
+}
+
+// Maximum number of entries of the incomplete factors in rows 0, ..., i - 1. Row j holds
+// at most min(j, p) entries in its strictly lower part, the diagonal entry and at most
+// min(m - 1 - j, p) entries in its strictly upper part
+static __device__ __host__ __inline__ int64_t
+    rocsparse_csrilut_row_offset(int64_t i, int64_t m, int64_t p)
+{
+    return rocsparse_csrilut_part_sum(i, p) + i + rocsparse_csrilut_part_sum(m, p) -
+           rocsparse_csrilut_part_sum(m - i, p);
+}
+
+// Row offsets of the maximum sparsity pattern of the incomplete factors
+template <rocsparse_int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrilut_nnz_kernel(rocsparse_int m,
+                            rocsparse_int p,
+                            rocsparse_int nnz,
+                            rocsparse_int* __restrict__ csr_row_ptr_M,
+                            rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(gid > m)
+    {
+        return;
+    }
+
+    // The incomplete factors of a zero matrix do not have any entries
+    int64_t offset = (nnz > 0) ? rocsparse_csrilut_row_offset(gid, m, p) : 0;
+
+    csr_row_ptr_M[gid] = static_cast<rocsparse_int>(offset) + idx_base;
+}
+
+// Reset the progress of the numeric factorization
+template <rocsparse_int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrilut_init_kernel(rocsparse_int m,
+                             rocsparse_int* __restrict__ done,
+                             rocsparse_int* __restrict__ next_row,
+                             rocsparse_int* __restrict__ zero_pivot)
+{
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid == 0)
+    {
+        *next_row   = 0;
+        *zero_pivot = std::numeric_limits<rocsparse_int>::max();
+    }
+
+    // Do not run out of bounds
+    if(gid >= m)
+    {
+        return;
+    }
+
+    done[gid] = 0;
+}
+
+// Larger magnitude first, ties are broken by the column index
+template <typename T>
+static __device__ __forceinline__ bool
+    csrilut_larger(rocsparse_int a, rocsparse_int b, const T* __restrict__ w)
+{
+    T wa = rocsparse_abs(w[a]);
+    T wb = rocsparse_abs(w[b]);
+
+    return wa > wb || (wa == wb && a < b);
+}
+
+// Sum of val over the WF_SIZE threads of a sub-wavefront, returned to all of them
+template <rocsparse_int WF_SIZE, typename T>
+static __device__ __forceinline__ T csrilut_wf_sum(T val)
+{
+    for(rocsparse_int i = WF_SIZE >> 1; i > 0; i >>= 1)
+    {
+#if defined(__HIP_PLATFORM_HCC__)
+        val += __shfl_xor(val, i, WF_SIZE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+        val += __shfl_xor_sync(0xffffffff, val, i, WF_SIZE);
+#endif
+    }
+
+    return val;
+}
+
+// Minimum of val over the WF_SIZE threads of a sub-wavefront, returned to all of them
+template <rocsparse_int WF_SIZE>
+static __device__ __forceinline__ rocsparse_int csrilut_wf_min(rocsparse_int val)
+{
+    for(rocsparse_int i = WF_SIZE >> 1; i > 0; i >>= 1)
+    {
+#if defined(__HIP_PLATFORM_HCC__)
+        val = min(val, __shfl_xor(val, i, WF_SIZE));
+#elif defined(__HIP_PLATFORM_NVCC__)
+        val = min(val, __shfl_xor_sync(0xffffffff, val, i, WF_SIZE));
+#endif
+    }
+
+    return val;
+}
+
+// Wait until row has been written to the incomplete factors
+static __device__ __forceinline__ void csrilut_wait(rocsparse_int* __restrict__ done,
+                                                    rocsparse_int row)
+{
+    rocsparse_int row_done = 0;
+    while(!row_done)
+    {
+#if defined(__HIP_PLATFORM_HCC__)
+        row_done = __atomic_load_n(&done[row], __ATOMIC_ACQUIRE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+        row_done = atomicOr(&done[row], 0);
+#endif
+    }
+
+#if defined(__HIP_PLATFORM_NVCC__)
+    __threadfence();
+#endif
+}
+
+// Add column col to the work row, if it is not part of it yet. Columns left of the
+// diagonal are appended to the lower list at the front of part, columns right of the
+// diagonal to the upper list at the back of part.
+template <typename T>
+static __device__ __forceinline__ void csrilut_insert(rocsparse_int m,
+                                                      rocsparse_int i,
+                                                      rocsparse_int col,
+                                                      T val,
+                                                      T* __restrict__ w,
+                                                      rocsparse_int* __restrict__ stamp,
+                                                      rocsparse_int* __restrict__ part,
+                                                      rocsparse_int* __restrict__ nlow,
+                                                      rocsparse_int* __restrict__ nup)
+{
+    if(stamp[col] == i)
+    {
+        return;
+    }
+
+    stamp[col] = i;
+    w[col]     = val;
+
+    if(col < i)
+    {
+        part[atomicAdd(nlow, 1)] = col;
+    }
+    else if(col > i)
+    {
+        part[m - 1 - atomicAdd(nup, 1)] = col;
+    }
+}
+
+// Incomplete LU factorization with threshold dropping. The elimination of a row is
+// sequential in its pivots, thus each sub-wavefront factorizes one row at a time,
+// while several rows are in flight. The sub-wavefront size is chosen from the maximum
+// row length of the incomplete factors, which bounds the length of the pivot rows that
+// are processed in parallel. Rows are handed out in ascending order, such that all rows
+// a sub-wavefront waits for have been picked up by a running sub-wavefront.
+//
+// Row i of A is scattered into the dense work row w of the sub-wavefront. stamp marks
+// the columns of w that belong to row i, which are listed in part. The entries left of
+// the diagonal are eliminated in ascending order, including fill-in entries inserted
+// on the way. Each of them is divided by the pivot of its row and, if its magnitude is
+// not below tau times the 2-norm of row i of A, used to subtract the upper part of that
+// row. Of the remaining entries that are not below the tolerance, the p largest of the
+// strictly lower and of the strictly upper part are kept, while the diagonal entry is
+// always kept. Row i is written sorted to its slot of the maximum sparsity pattern in
+// work_col_M and work_val_M, and its length is stored in csr_row_ptr_M[i + 1], such
+// that rows do not wait for their predecessors to be written.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrilut_numeric_kernel(rocsparse_int m,
+                                T tau,
+                                rocsparse_int p,
+                                rocsparse_int slots,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                const T* __restrict__ csr_val,
+                                rocsparse_int* __restrict__ csr_row_ptr_M,
+                                rocsparse_int* __restrict__ work_col_M,
+                                T* __restrict__ work_val_M,
+                                rocsparse_int* __restrict__ diag_ind,
+                                rocsparse_int* __restrict__ done,
+                                rocsparse_int* __restrict__ next_row,
+                                T* __restrict__ work_val,
+                                rocsparse_int* __restrict__ work_stamp,
+                                rocsparse_int* __restrict__ work_part,
+                                rocsparse_int* __restrict__ zero_pivot,
+                                rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int wid = tid / WF_SIZE;
+    rocsparse_int idx = gid / WF_SIZE;
+
+    // Length of the lower and upper list of each sub-wavefront, and the next row
+    __shared__ rocsparse_int snlow[BLOCKSIZE / WF_SIZE];
+    __shared__ rocsparse_int snup[BLOCKSIZE / WF_SIZE];
+    __shared__ rocsparse_int srow[BLOCKSIZE / WF_SIZE];
+
+    // Do not run out of bounds
+    if(idx >= slots)
+    {
+        return;
+    }
+
+    // Work row of this sub-wavefront
+    T* w                 = work_val + static_cast<size_t>(idx) * m;
+    rocsparse_int* stamp = work_stamp + static_cast<size_t>(idx) * (m + 1);
+    rocsparse_int* part  = work_part + static_cast<size_t>(idx) * m;
+
+    rocsparse_int* nlow = &snlow[wid];
+    rocsparse_int* nup  = &snup[wid];
+
+    rocsparse_int pm = min(p, m);
+
+    while(true)
+    {
+        if(lid == 0)
+        {
+            srow[wid] = atomicAdd(next_row, static_cast<rocsparse_int>(1));
+            *nlow     = 0;
+            *nup      = 0;
+        }
+
+        __threadfence_block();
+
+        rocsparse_int i = srow[wid];
+
+        // All rows have been handed out
+        if(i >= m)
+        {
+            return;
+        }
+
+        rocsparse_int row_begin = csr_row_ptr[i] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - idx_base;
+
+        // Scatter the entries of A, which have to be sorted. Only the first of
+        // duplicated entries is used.
+        T norm = static_cast<T>(0);
+
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            if(j > row_begin && csr_col_ind[j - 1] - idx_base >= col)
+            {
+                continue;
+            }
+
+            T val = csr_val[j];
+
+            csrilut_insert(m, i, col, val, w, stamp, part, nlow, nup);
+            norm += val * val;
+        }
+
+        __threadfence_block();
+
+        // Drop tolerance relative to row i of A
+        T tol = tau * sqrt(csrilut_wf_sum<WF_SIZE>(norm));
+
+        // Eliminate the entries left of the diagonal in ascending order
+        rocsparse_int k = -1;
+
+        while(true)
+        {
+            // Next pivot is the smallest column of the lower list that exceeds k
+            rocsparse_int k_next = i;
+
+            for(rocsparse_int j = lid; j < *nlow; j += WF_SIZE)
+            {
+                rocsparse_int col = part[j];
+                k_next            = (col > k && col < k_next) ? col : k_next;
+            }
+
+            k = csrilut_wf_min<WF_SIZE>(k_next);
+
+            if(k == i)
+            {
+                break;
+            }
+
+            csrilut_wait(done, k);
+
+            rocsparse_int k_diag = diag_ind[k];
+
+            // Rows with zero pivot do not contribute
+            if(k_diag == -1)
+            {
+                continue;
+            }
+
+            T wk = w[k] / work_val_M[k_diag];
+
+            // Dropped entries do not contribute to the remaining row
+            if(rocsparse_abs(wk) < tol)
+            {
+                if(lid == 0)
+                {
+                    w[k] = wk;
+                }
+
+                __threadfence_block();
+                continue;
+            }
+
+            // Subtract the upper part of row k, each lane processes one entry
+            rocsparse_int k_end
+                = static_cast<rocsparse_int>(rocsparse_csrilut_row_offset(k, m, pm)) +
+                  csr_row_ptr_M[k + 1];
+
+            for(rocsparse_int q = k_diag + 1 + lid; q < k_end; q += WF_SIZE)
+            {
+                rocsparse_int col = work_col_M[q];
+
+                // New fill-in entry
+                csrilut_insert(m, i, col, static_cast<T>(0), w, stamp, part, nlow, nup);
+
+                w[col] -= wk * work_val_M[q];
+            }
+
+            if(lid == 0)
+            {
+                w[k] = wk;
+            }
+
+            __threadfence_block();
+        }
+
+        // Apply the threshold, count the candidates of each part
+        rocsparse_int* upper = part + m - *nup;
+
+        rocsparse_int clow = 0;
+        rocsparse_int cup  = 0;
+
+        for(rocsparse_int j = lid; j < *nlow; j += WF_SIZE)
+        {
+            clow += (rocsparse_abs(w[part[j]]) >= tol);
+        }
+
+        for(rocsparse_int j = lid; j < *nup; j += WF_SIZE)
+        {
+            cup += (rocsparse_abs(w[upper[j]]) >= tol);
+        }
+
+        clow = csrilut_wf_sum<WF_SIZE>(clow);
+        cup  = csrilut_wf_sum<WF_SIZE>(cup);
+
+        // Mark the kept entries of each part, a candidate is kept if less than p
+        // candidates are larger. Marks do not match any row index.
+        rocsparse_int klow = 0;
+        rocsparse_int kup  = 0;
+
+        for(rocsparse_int j = lid; j < *nlow + *nup; j += WF_SIZE)
+        {
+            bool is_low          = j < *nlow;
+            rocsparse_int* list  = is_low ? part : upper;
+            rocsparse_int length = is_low ? *nlow : *nup;
+            rocsparse_int ncand  = is_low ? clow : cup;
+            rocsparse_int col    = is_low ? part[j] : upper[j - *nlow];
+
+            if(rocsparse_abs(w[col]) < tol)
+            {
+                continue;
+            }
+
+            bool keep = ncand <= p;
+
+            if(!keep && p > 0)
+            {
+                rocsparse_int rank = 0;
+
+                for(rocsparse_int q = 0; q < length && rank < p; ++q)
+                {
+                    rocsparse_int other = list[q];
+
+                    rank += (rocsparse_abs(w[other]) >= tol && csrilut_larger(other, col, w));
+                }
+
+                keep = rank < p;
+            }
+
+            if(keep)
+            {
+                stamp[col] = m;
+                klow += is_low;
+                kup += !is_low;
+            }
+        }
+
+        klow = csrilut_wf_sum<WF_SIZE>(klow);
+        kup  = csrilut_wf_sum<WF_SIZE>(kup);
+
+        __threadfence_block();
+
+        // The diagonal entry is kept if it is part of the row, zero pivots are not used
+        // to eliminate subsequent rows
+        bool has_diag = stamp[i] == i;
+
+        rocsparse_int row_start
+            = static_cast<rocsparse_int>(rocsparse_csrilut_row_offset(i, m, pm));
+        rocsparse_int row_diag = (has_diag && w[i] != static_cast<T>(0)) ? row_start + klow : -1;
+
+        // Write the kept entries sorted by column, the position of each entry is the
+        // number of kept entries of its part with smaller column
+        for(rocsparse_int j = lid; j < *nlow + *nup; j += WF_SIZE)
+        {
+            bool is_low          = j < *nlow;
+            rocsparse_int* list  = is_low ? part : upper;
+            rocsparse_int length = is_low ? *nlow : *nup;
+            rocsparse_int col    = is_low ? part[j] : upper[j - *nlow];
+
+            if(stamp[col] != m)
+            {
+                continue;
+            }
+
+            rocsparse_int pos = is_low ? row_start : row_start + klow + has_diag;
+
+            for(rocsparse_int q = 0; q < length; ++q)
+            {
+                rocsparse_int other = list[q];
+
+                pos += (stamp[other] == m && other < col);
+            }
+
+            work_col_M[pos] = col;
+            work_val_M[pos] = w[col];
+        }
+
+        if(lid == 0)
+        {
+            if(has_diag)
+            {
+                work_col_M[row_start + klow] = i;
+                work_val_M[row_start + klow] = w[i];
+            }
+
+            // Row lengths are turned into row offsets after the factorization
+            if(i == 0)
+            {
+                csr_row_ptr_M[0] = idx_base;
+            }
+
+            csr_row_ptr_M[i + 1] = klow + has_diag + kup;
+            diag_ind[i]          = row_diag;
+
+            // We are looking for the first zero pivot
+            if(row_diag == -1)
+            {
+                atomicMin(zero_pivot, i + idx_base);
+            }
+
+            __threadfence();
+
+            // Row i has been written
+#if defined(__HIP_PLATFORM_HCC__)
+            __atomic_store_n(&done[i], 1, __ATOMIC_RELEASE);
+#elif defined(__HIP_PLATFORM_NVCC__)
+            atomicOr(&done[i], 1);
+#endif
+        }
+    }
+}
+
+// Move each row of the incomplete factors from its slot of the maximum sparsity pattern
+// to its final position, each sub-wavefront moves one row
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrilut_compact_kernel(rocsparse_int m,
+                                rocsparse_int p,
+                                const rocsparse_int* __restrict__ csr_row_ptr_M,
+                                const rocsparse_int* __restrict__ work_col_M,
+                                const T* __restrict__ work_val_M,
+                                rocsparse_int* __restrict__ csr_col_ind_M,
+                                T* __restrict__ csr_val_M,
+                                rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int row = gid / WF_SIZE;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_start
+        = static_cast<rocsparse_int>(rocsparse_csrilut_row_offset(row, m, min(p, m)));
+    rocsparse_int row_begin = csr_row_ptr_M[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr_M[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        csr_col_ind_M[j] = work_col_M[row_start + j - row_begin] + idx_base;
+        csr_val_M[j]     = work_val_M[row_start + j - row_begin];
+    }
+}
+
+#endif // CSRILUT_DEVICE_H
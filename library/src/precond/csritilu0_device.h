@@ -0,0 +1,188 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRITILU0_DEVICE_H
+#define CSRITILU0_DEVICE_H
+
+#include "../level2/csritsv_device.h"
+
+#include <hip/hip_runtime.h>
+
+// Each thread processes a row. The row index of each entry is stored, together with
+// the position of the first entry of the upper triangular part of each row.
+template <rocsparse_int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csritilu0_init_kernel(rocsparse_int m,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               rocsparse_int* __restrict__ csr_row_ind,
+                               rocsparse_int* __restrict__ csr_upper_ptr,
+                               rocsparse_index_base idx_base)
+{
+    rocsparse_int row = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+    rocsparse_int upper     = row_end;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        csr_row_ind[j] = row;
+
+        if(upper == row_end && csr_col_ind[j] - idx_base >= row)
+        {
+            upper = j;
+        }
+    }
+
+    csr_upper_ptr[row] = upper;
+}
+
+// One asynchronous fixed-point sweep over all entries of M = L + U - I. Each thread
+// processes an entry (i, j) and updates it from the current values of M
+//
+//   l_ij = (a_ij - sum_{k < j} l_ik * u_kj) / u_jj    if i > j
+//   u_ij =  a_ij - sum_{k < i} l_ik * u_kj            if i <= j
+//
+// If UPDATE is false, M is left unchanged and the squared residual of A - L * U on the
+// sparsity pattern of A is stored per block instead.
+template <typename T, rocsparse_int BLOCKSIZE, bool UPDATE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csritilu0_sweep_kernel(rocsparse_int nnz,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_row_ind,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                const rocsparse_int* __restrict__ csr_upper_ptr,
+                                const T* __restrict__ a_val,
+                                T* csr_val,
+                                T* __restrict__ partial,
+                                rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int idx = static_cast<rocsparse_int>(hipBlockIdx_x) * BLOCKSIZE + tid;
+
+    __shared__ T sdata[BLOCKSIZE];
+
+    T res = static_cast<T>(0);
+
+    if(idx < nnz)
+    {
+        rocsparse_int row  = csr_row_ind[idx];
+        rocsparse_int col  = csr_col_ind[idx] - idx_base;
+        rocsparse_int kend = min(row, col);
+
+        T sum = a_val[idx];
+
+        // Loop over l_ik with k < min(i, j)
+        for(rocsparse_int k = csr_row_ptr[row] - idx_base; k < csr_upper_ptr[row]; ++k)
+        {
+            rocsparse_int col_k = csr_col_ind[k] - idx_base;
+
+            if(col_k >= kend)
+            {
+                break;
+            }
+
+            // Binary search for u_kj in the upper part of row k
+            rocsparse_int left  = csr_upper_ptr[col_k];
+            rocsparse_int right = csr_row_ptr[col_k + 1] - idx_base;
+            rocsparse_int end   = right;
+
+            while(left < right)
+            {
+                rocsparse_int mid = (left + right) >> 1;
+
+                if(csr_col_ind[mid] - idx_base < col)
+                {
+                    left = mid + 1;
+                }
+                else
+                {
+                    right = mid;
+                }
+            }
+
+            if(left < end && csr_col_ind[left] - idx_base == col)
+            {
+                sum -= csr_val[k] * csr_val[left];
+            }
+        }
+
+        if(row > col)
+        {
+            // Diagonal entry u_jj, a missing diagonal entry is treated as zero pivot
+            rocsparse_int diag = csr_upper_ptr[col];
+            T u_jj             = static_cast<T>(0);
+
+            if(diag < csr_row_ptr[col + 1] - idx_base && csr_col_ind[diag] - idx_base == col)
+            {
+                u_jj = csr_val[diag];
+            }
+
+            if(UPDATE)
+            {
+                // Entries that depend on a zero pivot are not updated
+                if(u_jj != static_cast<T>(0))
+                {
+                    csr_val[idx] = sum / u_jj;
+                }
+            }
+            else
+            {
+                res = sum - csr_val[idx] * u_jj;
+            }
+        }
+        else
+        {
+            if(UPDATE)
+            {
+                csr_val[idx] = sum;
+            }
+            else
+            {
+                res = sum - csr_val[idx];
+            }
+        }
+    }
+
+    if(!UPDATE)
+    {
+        sdata[tid] = res * res;
+
+        rocsparse_sum_reduce<BLOCKSIZE, T>(tid, sdata);
+
+        if(tid == 0)
+        {
+            partial[hipBlockIdx_x] = sdata[0];
+        }
+    }
+}
+
+#endif // CSRITILU0_DEVICE_H
@@ -75,6 +75,52 @@ extern "C" rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle hand
                                         buffer_size);
 }
 
+extern "C" rocsparse_status rocsparse_ccsrilu0_buffer_size(rocsparse_handle handle,
+                                                           rocsparse_int m,
+                                                           rocsparse_int nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const rocsparse_float_complex* csr_val,
+                                                           const rocsparse_int* csr_row_ptr,
+                                                           const rocsparse_int* csr_col_ind,
+                                                           rocsparse_mat_info info,
+                                                           size_t* buffer_size)
+{
+
+    return rocsparse_ccsrsv_buffer_size(handle,
+                                        rocsparse_operation_none,
+                                        m,
+                                        nnz,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrilu0_buffer_size(rocsparse_handle handle,
+                                                           rocsparse_int m,
+                                                           rocsparse_int nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const rocsparse_double_complex* csr_val,
+                                                           const rocsparse_int* csr_row_ptr,
+                                                           const rocsparse_int* csr_col_ind,
+                                                           rocsparse_mat_info info,
+                                                           size_t* buffer_size)
+{
+
+    return rocsparse_zcsrsv_buffer_size(handle,
+                                        rocsparse_operation_none,
+                                        m,
+                                        nnz,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        buffer_size);
+}
+
 extern "C" rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle handle,
                                                         rocsparse_int m,
                                                         rocsparse_int nnz,
@@ -125,6 +171,56 @@ extern "C" rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle handle,
                                                        temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_ccsrilu0_analysis(rocsparse_handle handle,
+                                                        rocsparse_int m,
+                                                        rocsparse_int nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const rocsparse_float_complex* csr_val,
+                                                        const rocsparse_int* csr_row_ptr,
+                                                        const rocsparse_int* csr_col_ind,
+                                                        rocsparse_mat_info info,
+                                                        rocsparse_analysis_policy analysis,
+                                                        rocsparse_solve_policy solve,
+                                                        void* temp_buffer)
+{
+    return rocsparse_csrilu0_analysis_template<rocsparse_float_complex>(handle,
+                                                                        m,
+                                                                        nnz,
+                                                                        descr,
+                                                                        csr_val,
+                                                                        csr_row_ptr,
+                                                                        csr_col_ind,
+                                                                        info,
+                                                                        analysis,
+                                                                        solve,
+                                                                        temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrilu0_analysis(rocsparse_handle handle,
+                                                        rocsparse_int m,
+                                                        rocsparse_int nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const rocsparse_double_complex* csr_val,
+                                                        const rocsparse_int* csr_row_ptr,
+                                                        const rocsparse_int* csr_col_ind,
+                                                        rocsparse_mat_info info,
+                                                        rocsparse_analysis_policy analysis,
+                                                        rocsparse_solve_policy solve,
+                                                        void* temp_buffer)
+{
+    return rocsparse_csrilu0_analysis_template<rocsparse_double_complex>(handle,
+                                                                         m,
+                                                                         nnz,
+                                                                         descr,
+                                                                         csr_val,
+                                                                         csr_row_ptr,
+                                                                         csr_col_ind,
+                                                                         info,
+                                                                         analysis,
+                                                                         solve,
+                                                                         temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle,
                                                     rocsparse_mat_info info)
 {
@@ -142,7 +238,8 @@ extern "C" rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle,
     log_trace(handle, "rocsparse_csrilu0_clear", (const void*&)info);
 
     // If meta data is shared, do not delete anything
-    if(info->csrilu0_info == info->csrsv_lower_info || info->csrilu0_info == info->csrsv_upper_info)
+    if(info->csrilu0_info == info->csrsv_lower_info || info->csrilu0_info == info->csrsv_upper_info
+       || info->csrilu0_info == info->csrsm_lower_info || info->csrilu0_info == info->csric0_info)
     {
         info->csrilu0_info = nullptr;
 
@@ -185,6 +282,36 @@ extern "C" rocsparse_status rocsparse_dcsrilu0(rocsparse_handle handle,
         handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_ccsrilu0(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               rocsparse_float_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               rocsparse_solve_policy policy,
+                                               void* temp_buffer)
+{
+    return rocsparse_csrilu0_template<rocsparse_float_complex>(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrilu0(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               rocsparse_double_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               rocsparse_solve_policy policy,
+                                               void* temp_buffer)
+{
+    return rocsparse_csrilu0_template<rocsparse_double_complex>(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle handle,
                                                          rocsparse_mat_info info,
                                                          rocsparse_int* position)
@@ -208,65 +335,101 @@ extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle handle
         return rocsparse_status_invalid_pointer;
     }
 
+    return rocsparse_csrtr_zero_pivot(handle, info->csrilu0_info, position);
+}
+
+extern "C" rocsparse_status rocsparse_scsrilu0_numeric_boost(rocsparse_handle handle,
+                                                             rocsparse_mat_info info,
+                                                             int enable_boost,
+                                                             const float* boost_tol,
+                                                             const float* boost_val)
+{
+    return rocsparse_csrilu0_numeric_boost_template<float>(
+        handle, info, enable_boost, boost_tol, boost_val);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilu0_numeric_boost(rocsparse_handle handle,
+                                                             rocsparse_mat_info info,
+                                                             int enable_boost,
+                                                             const double* boost_tol,
+                                                             const double* boost_val)
+{
+    return rocsparse_csrilu0_numeric_boost_template<double>(
+        handle, info, enable_boost, boost_tol, boost_val);
+}
+
+extern "C" rocsparse_status
+rocsparse_ccsrilu0_numeric_boost(rocsparse_handle handle,
+                                 rocsparse_mat_info info,
+                                 int enable_boost,
+                                 const float* boost_tol,
+                                 const rocsparse_float_complex* boost_val)
+{
+    return rocsparse_csrilu0_numeric_boost_template<rocsparse_float_complex, float>(
+        handle, info, enable_boost, boost_tol, boost_val);
+}
+
+extern "C" rocsparse_status
+rocsparse_zcsrilu0_numeric_boost(rocsparse_handle handle,
+                                 rocsparse_mat_info info,
+                                 int enable_boost,
+                                 const double* boost_tol,
+                                 const rocsparse_double_complex* boost_val)
+{
+    return rocsparse_csrilu0_numeric_boost_template<rocsparse_double_complex, double>(
+        handle, info, enable_boost, boost_tol, boost_val);
+}
+
+extern "C" rocsparse_status rocsparse_csrilu0_boost_count(rocsparse_handle handle,
+                                                          rocsparse_mat_info info,
+                                                          rocsparse_int* count)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrilu0_boost_count", (const void*&)info, (const void*&)count);
+
+    // Check pointer arguments
+    if(count == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
     // Stream
     hipStream_t stream = handle->stream;
 
-    // If m == 0 || nnz == 0 it can happen, that info structure is not created.
-    // In this case, always return -1.
-    if(info->csrilu0_info == nullptr)
+    // No pivots have been boosted, if boost is disabled
+    if(info->boost_enable == 0 || info->boost_count == nullptr)
     {
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(count, 0, sizeof(rocsparse_int), stream));
         }
         else
         {
-            *position = -1;
+            *count = 0;
         }
 
         return rocsparse_status_success;
     }
 
-    // Differentiate between pointer modes
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
-        // rocsparse_pointer_mode_device
-        rocsparse_int pivot;
-
-        RETURN_IF_HIP_ERROR(hipMemcpy(
-            &pivot, info->csrilu0_info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-
-        if(pivot == std::numeric_limits<rocsparse_int>::max())
-        {
-            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipMemcpy(position,
-                                          info->csrilu0_info->zero_pivot,
-                                          sizeof(rocsparse_int),
-                                          hipMemcpyDeviceToDevice));
-
-            return rocsparse_status_zero_pivot;
-        }
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            count, info->boost_count, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
     }
     else
     {
-        // rocsparse_pointer_mode_host
-        RETURN_IF_HIP_ERROR(hipMemcpy(position,
-                                      info->csrilu0_info->zero_pivot,
-                                      sizeof(rocsparse_int),
-                                      hipMemcpyDeviceToHost));
-
-        // If no zero pivot is found, set -1
-        if(*position == std::numeric_limits<rocsparse_int>::max())
-        {
-            *position = -1;
-        }
-        else
-        {
-            return rocsparse_status_zero_pivot;
-        }
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(count, info->boost_count, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
     }
 
     return rocsparse_status_success;
@@ -26,6 +26,7 @@
 #define ROCSPARSE_CSRILU0_HPP
 
 #include "definitions.h"
+#include "grid.h"
 #include "rocsparse.h"
 #include "utility.h"
 #include "csrilu0_device.h"
@@ -151,6 +152,16 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle handle,
         {
             reuse = info->csrsv_lower_info;
         }
+        // csrsm_lower meta data
+        else if(info->csrsm_lower_info != nullptr)
+        {
+            reuse = info->csrsm_lower_info;
+        }
+        // csric0 meta data
+        else if(info->csric0_info != nullptr)
+        {
+            reuse = info->csric0_info;
+        }
 
         // TODO add more crossover data here
 
@@ -166,8 +177,12 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle handle,
     // User is explicitly asking to force a re-analysis, or no valid data has been
     // found to be re-used.
 
-    // Clear csrilu0 info
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrilu0_info));
+    // Clear csrilu0 info, unless it is shared
+    if(info->csrilu0_info != info->csrsv_lower_info && info->csrilu0_info != info->csrsm_lower_info
+       && info->csrilu0_info != info->csric0_info)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrilu0_info));
+    }
 
     // Create csrilu0 info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&info->csrilu0_info));
@@ -186,92 +201,23 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle handle,
     return rocsparse_status_success;
 }
 
+// Incomplete LU factorization with zero fill-in on the sparsity pattern of the given
+// matrix, using the dependency analysis of csrilu0. If boost is set, pivots with
+// magnitude of at most boost_tol are replaced by boost_val and counted in boost_count.
 template <typename T>
-rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
-                                            rocsparse_int m,
-                                            rocsparse_int nnz,
-                                            const rocsparse_mat_descr descr,
-                                            T* csr_val,
-                                            const rocsparse_int* csr_row_ptr,
-                                            const rocsparse_int* csr_col_ind,
-                                            rocsparse_mat_info info,
-                                            rocsparse_solve_policy policy,
-                                            void* temp_buffer)
+static rocsparse_status rocsparse_csrilu0_launch(rocsparse_handle handle,
+                                                 rocsparse_int m,
+                                                 const rocsparse_mat_descr descr,
+                                                 T* csr_val,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 const rocsparse_int* csr_col_ind,
+                                                 rocsparse_csrtr_info csrilu0,
+                                                 int boost,
+                                                 double boost_tol,
+                                                 T boost_val,
+                                                 rocsparse_int* boost_count,
+                                                 void* temp_buffer)
 {
-    // Check for valid handle and matrix descriptor
-    if(handle == nullptr)
-    {
-        return rocsparse_status_invalid_handle;
-    }
-    else if(descr == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(info == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
-    // Logging
-    log_trace(handle,
-              replaceX<T>("rocsparse_Xcsrilu0"),
-              m,
-              nnz,
-              (const void*&)descr,
-              (const void*&)csr_val,
-              (const void*&)csr_row_ptr,
-              (const void*&)csr_col_ind,
-              (const void*&)info,
-              policy,
-              (const void*&)temp_buffer);
-
-    log_bench(handle, "./rocsparse-bench -f csrilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
-
-    // Check index base
-    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
-    {
-        return rocsparse_status_invalid_value;
-    }
-    if(descr->type != rocsparse_matrix_type_general)
-    {
-        // TODO
-        return rocsparse_status_not_implemented;
-    }
-
-    // Check sizes
-    if(m < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-    else if(nnz < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-
-    // Check pointer arguments
-    if(csr_val == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_row_ptr == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_col_ind == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(temp_buffer == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
-    // Quick return if possible
-    if(m == 0 || nnz == 0)
-    {
-        return rocsparse_status_success;
-    }
-
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -288,13 +234,21 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
     // Initialize buffers
     RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(rocsparse_int) * m, stream));
 
+    // Reset the number of boosted pivots
+    if(boost)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(boost_count, 0, sizeof(rocsparse_int), stream));
+    }
+
 #define CSRILU0_DIM 256
-    dim3 csrilu0_blocks((m * handle->wavefront_size - 1) / CSRILU0_DIM + 1);
+    dim3 csrilu0_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(
+        static_cast<int64_t>(handle->wavefront_size) * m, CSRILU0_DIM, csrilu0_blocks));
     dim3 csrilu0_threads(CSRILU0_DIM);
 
     if(handle->wavefront_size == 32)
     {
-        if(info->csrilu0_info->max_nnz <= 32)
+        if(csrilu0->max_nnz <= 32)
         {
             hipLaunchKernelGGL((csrilu0_hash_kernel<T, CSRILU0_DIM, 32, 1>),
                                csrilu0_blocks,
@@ -305,13 +259,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrilu0->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               csrilu0->d_row_map,
+                               csrilu0->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
                                descr->base);
         }
-        else if(info->csrilu0_info->max_nnz <= 64)
+        else if(csrilu0->max_nnz <= 64)
         {
             hipLaunchKernelGGL((csrilu0_hash_kernel<T, CSRILU0_DIM, 32, 2>),
                                csrilu0_blocks,
@@ -322,13 +280,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrilu0->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               csrilu0->d_row_map,
+                               csrilu0->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
                                descr->base);
         }
-        else if(info->csrilu0_info->max_nnz <= 128)
+        else if(csrilu0->max_nnz <= 128)
         {
             hipLaunchKernelGGL((csrilu0_hash_kernel<T, CSRILU0_DIM, 32, 4>),
                                csrilu0_blocks,
@@ -339,13 +301,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrilu0->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               csrilu0->d_row_map,
+                               csrilu0->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
                                descr->base);
         }
-        else if(info->csrilu0_info->max_nnz <= 256)
+        else if(csrilu0->max_nnz <= 256)
         {
             hipLaunchKernelGGL((csrilu0_hash_kernel<T, CSRILU0_DIM, 32, 8>),
                                csrilu0_blocks,
@@ -356,13 +322,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrilu0->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               csrilu0->d_row_map,
+                               csrilu0->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
                                descr->base);
         }
-        else if(info->csrilu0_info->max_nnz <= 512)
+        else if(csrilu0->max_nnz <= 512)
         {
             hipLaunchKernelGGL((csrilu0_hash_kernel<T, CSRILU0_DIM, 32, 16>),
                                csrilu0_blocks,
@@ -373,10 +343,14 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrilu0->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               csrilu0->d_row_map,
+                               csrilu0->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
                                descr->base);
         }
         else
@@ -390,16 +364,20 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrilu0->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               csrilu0->d_row_map,
+                               csrilu0->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
                                descr->base);
         }
     }
     else if(handle->wavefront_size == 64)
     {
-        if(info->csrilu0_info->max_nnz <= 64)
+        if(csrilu0->max_nnz <= 64)
         {
             hipLaunchKernelGGL((csrilu0_hash_kernel<T, CSRILU0_DIM, 64, 1>),
                                csrilu0_blocks,
@@ -410,13 +388,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrilu0->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               csrilu0->d_row_map,
+                               csrilu0->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
                                descr->base);
         }
-        else if(info->csrilu0_info->max_nnz <= 128)
+        else if(csrilu0->max_nnz <= 128)
         {
             hipLaunchKernelGGL((csrilu0_hash_kernel<T, CSRILU0_DIM, 64, 2>),
                                csrilu0_blocks,
@@ -427,13 +409,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrilu0->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               csrilu0->d_row_map,
+                               csrilu0->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
                                descr->base);
         }
-        else if(info->csrilu0_info->max_nnz <= 256)
+        else if(csrilu0->max_nnz <= 256)
         {
             hipLaunchKernelGGL((csrilu0_hash_kernel<T, CSRILU0_DIM, 64, 4>),
                                csrilu0_blocks,
@@ -444,13 +430,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrilu0->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               csrilu0->d_row_map,
+                               csrilu0->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
                                descr->base);
         }
-        else if(info->csrilu0_info->max_nnz <= 512)
+        else if(csrilu0->max_nnz <= 512)
         {
             hipLaunchKernelGGL((csrilu0_hash_kernel<T, CSRILU0_DIM, 64, 8>),
                                csrilu0_blocks,
@@ -461,13 +451,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrilu0->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               csrilu0->d_row_map,
+                               csrilu0->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
                                descr->base);
         }
-        else if(info->csrilu0_info->max_nnz <= 1024)
+        else if(csrilu0->max_nnz <= 1024)
         {
             hipLaunchKernelGGL((csrilu0_hash_kernel<T, CSRILU0_DIM, 64, 16>),
                                csrilu0_blocks,
@@ -478,10 +472,14 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrilu0->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               csrilu0->d_row_map,
+                               csrilu0->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
                                descr->base);
         }
         else
@@ -495,10 +493,14 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrilu0->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               csrilu0->d_row_map,
+                               csrilu0->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
                                descr->base);
         }
     }
@@ -511,4 +513,216 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
     return rocsparse_status_success;
 }
 
+// Boost value of the matrix info in the precision of T
+template <typename T>
+static inline T rocsparse_csrilu0_boost_val(const rocsparse_double_complex& boost_val)
+{
+    return static_cast<T>(std::real(boost_val));
+}
+
+template <>
+inline rocsparse_float_complex rocsparse_csrilu0_boost_val<rocsparse_float_complex>(
+    const rocsparse_double_complex& boost_val)
+{
+    return rocsparse_float_complex(boost_val);
+}
+
+template <>
+inline rocsparse_double_complex rocsparse_csrilu0_boost_val<rocsparse_double_complex>(
+    const rocsparse_double_complex& boost_val)
+{
+    return boost_val;
+}
+
+// The boost tolerance U is the real type of T
+template <typename T, typename U>
+rocsparse_status rocsparse_csrilu0_numeric_boost_template(rocsparse_handle handle,
+                                                          rocsparse_mat_info info,
+                                                          int enable_boost,
+                                                          const U* boost_tol,
+                                                          const T* boost_val)
+{
+    // Check for valid handle and matrix info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0_numeric_boost"),
+              (const void*&)info,
+              enable_boost,
+              (const void*&)boost_tol,
+              (const void*&)boost_val);
+
+    // Disable boost
+    if(enable_boost == 0)
+    {
+        info->boost_enable = 0;
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(boost_tol == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(boost_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Boost tolerance and value are kept on the host, reading them from device memory
+    // requires synchronization
+    U tol;
+    T val;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        if(handle->exec_mode == rocsparse_exec_mode_async)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(&tol, boost_tol, sizeof(U), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(&val, boost_val, sizeof(T), hipMemcpyDeviceToHost));
+    }
+    else
+    {
+        tol = *boost_tol;
+        val = *boost_val;
+    }
+
+    // Check boost tolerance
+    if(tol < static_cast<U>(0))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Allocate the counter of boosted pivots. It is served from the memory pool, which
+    // is kept alive by info until the counter is returned
+    if(info->boost_count == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(handle->allocate((void**)&info->boost_count, sizeof(rocsparse_int)));
+
+        info->pool   = handle->pool;
+        info->stream = handle->stream;
+    }
+
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(info->boost_count, 0, sizeof(rocsparse_int), handle->stream));
+
+    info->boost_enable = 1;
+    info->boost_tol    = static_cast<double>(tol);
+    info->boost_val    = rocsparse_double_complex(val);
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            T* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            rocsparse_solve_policy policy,
+                                            void* temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    return rocsparse_csrilu0_launch(handle,
+                                    m,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    info->csrilu0_info,
+                                    info->boost_enable,
+                                    info->boost_tol,
+                                    rocsparse_csrilu0_boost_val<T>(info->boost_val),
+                                    info->boost_count,
+                                    temp_buffer);
+}
+
 #endif // ROCSPARSE_CSRILU0_HPP
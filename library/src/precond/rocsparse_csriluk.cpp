@@ -0,0 +1,667 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "definitions.h"
+#include "rocsparse.h"
+#include "rocsparse_csriluk.hpp"
+
+#include <algorithm>
+#include <vector>
+
+// Symbolic incomplete LU factorization with level of fill. Entries of A have level
+// zero. A fill-in entry (i, j) that is created by eliminating (i, k) has level
+// lev(i, k) + lev(k, j) + 1 and is kept if its level does not exceed the level of
+// fill. Rows are processed in ascending order, the current row is held as a linked
+// list of its sorted column indices. Additionally, the position of each entry of A
+// within the incomplete factors is determined.
+static void rocsparse_csriluk_fill(rocsparse_int m,
+                                   const std::vector<rocsparse_int>& csr_row_ptr,
+                                   const std::vector<rocsparse_int>& csr_col_ind,
+                                   rocsparse_int level,
+                                   rocsparse_index_base base,
+                                   std::vector<rocsparse_int>& csr_row_ptr_M,
+                                   std::vector<rocsparse_int>& csr_col_ind_M,
+                                   std::vector<rocsparse_int>& scatter)
+{
+    // Level of each entry of the incomplete factors
+    std::vector<rocsparse_int> lev_M;
+    // Position of the first entry right of the diagonal of each row
+    std::vector<rocsparse_int> upper(m);
+
+    // Linked list of the current row, next[m] is the head of the list
+    std::vector<rocsparse_int> next(m + 1);
+    std::vector<rocsparse_int> lev(m);
+
+    csr_row_ptr_M.resize(m + 1);
+    csr_col_ind_M.clear();
+    scatter.resize(csr_row_ptr[m] - base);
+
+    csr_row_ptr_M[0] = base;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr[i] - base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+        // Insert the entries of A, which have to be sorted
+        rocsparse_int prev = m;
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - base;
+
+            // Skip duplicates, they would corrupt the list
+            if(prev != m && col <= prev)
+            {
+                continue;
+            }
+
+            next[prev] = col;
+            lev[col]   = 0;
+            prev       = col;
+        }
+
+        next[prev] = -1;
+
+        // Eliminate the entries left of the diagonal in ascending order, this
+        // includes fill-in entries inserted on the way
+        for(rocsparse_int k = next[m]; k != -1 && k < i; k = next[k])
+        {
+            // Columns of the upper part of row k are sorted, the insert position
+            // only moves forward
+            rocsparse_int pos = k;
+
+            for(rocsparse_int p = upper[k]; p < csr_row_ptr_M[k + 1] - base; ++p)
+            {
+                rocsparse_int fill = lev[k] + lev_M[p] + 1;
+
+                if(fill > level)
+                {
+                    continue;
+                }
+
+                rocsparse_int col = csr_col_ind_M[p] - base;
+
+                while(next[pos] != -1 && next[pos] < col)
+                {
+                    pos = next[pos];
+                }
+
+                if(next[pos] == col)
+                {
+                    lev[col] = std::min(lev[col], fill);
+                }
+                else
+                {
+                    // New fill-in entry
+                    next[col] = next[pos];
+                    next[pos] = col;
+                    lev[col]  = fill;
+                }
+
+                pos = col;
+            }
+        }
+
+        // Store row i
+        upper[i] = static_cast<rocsparse_int>(csr_col_ind_M.size());
+
+        for(rocsparse_int k = next[m]; k != -1; k = next[k])
+        {
+            csr_col_ind_M.push_back(k + base);
+            lev_M.push_back(lev[k]);
+
+            if(k <= i)
+            {
+                upper[i] = static_cast<rocsparse_int>(csr_col_ind_M.size());
+            }
+        }
+
+        csr_row_ptr_M[i + 1] = static_cast<rocsparse_int>(csr_col_ind_M.size()) + base;
+
+        // Entries of A are part of the incomplete factors
+        rocsparse_int p     = csr_row_ptr_M[i] - base;
+        rocsparse_int p_end = csr_row_ptr_M[i + 1] - base;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            while(p < p_end - 1 && csr_col_ind_M[p] < csr_col_ind[j])
+            {
+                ++p;
+            }
+
+            scatter[j] = p;
+        }
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csriluk_buffer_size(rocsparse_handle handle,
+                                                          rocsparse_int m,
+                                                          rocsparse_int nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const rocsparse_int* csr_row_ptr,
+                                                          const rocsparse_int* csr_col_ind,
+                                                          rocsparse_mat_info info,
+                                                          size_t* buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csriluk_buffer_size",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // The incomplete factors have the same number of rows as A
+    return rocsparse_csrtr_buffer_size(m, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_nnz(rocsparse_handle handle,
+                                                  rocsparse_int m,
+                                                  rocsparse_int nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const rocsparse_int* csr_row_ptr,
+                                                  const rocsparse_int* csr_col_ind,
+                                                  rocsparse_int level,
+                                                  rocsparse_mat_info info,
+                                                  rocsparse_int* csr_row_ptr_M,
+                                                  rocsparse_int* nnz_M)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csriluk_nnz",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              level,
+              (const void*&)info,
+              (const void*&)csr_row_ptr_M,
+              (const void*&)nnz_M);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check level of fill
+    if(level < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_M, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_M = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // The level of fill pattern is determined on the host, since the length of each
+    // row depends on the pattern of all previous rows
+    std::vector<rocsparse_int> hcsr_row_ptr(m + 1);
+    std::vector<rocsparse_int> hcsr_col_ind(nnz);
+
+    RETURN_IF_HIP_ERROR(hipMemcpy(hcsr_row_ptr.data(),
+                                  csr_row_ptr,
+                                  sizeof(rocsparse_int) * (m + 1),
+                                  hipMemcpyDeviceToHost));
+    RETURN_IF_HIP_ERROR(hipMemcpy(
+        hcsr_col_ind.data(), csr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+
+    std::vector<rocsparse_int> hcsr_row_ptr_M;
+    std::vector<rocsparse_int> hcsr_col_ind_M;
+    std::vector<rocsparse_int> hscatter;
+
+    rocsparse_csriluk_fill(m,
+                           hcsr_row_ptr,
+                           hcsr_col_ind,
+                           level,
+                           descr->base,
+                           hcsr_row_ptr_M,
+                           hcsr_col_ind_M,
+                           hscatter);
+
+    rocsparse_int hnnz_M = static_cast<rocsparse_int>(hcsr_col_ind_M.size());
+
+    // Clear csriluk info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    info->csriluk_info = nullptr;
+
+    // Create csriluk info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csriluk_info(&info->csriluk_info));
+
+    rocsparse_csriluk_info csriluk = info->csriluk_info;
+
+    csriluk->level = level;
+    csriluk->nnz_M = hnnz_M;
+    csriluk->m     = m;
+    csriluk->nnz   = nnz;
+
+    // Device arrays are served from the memory pool, which is kept alive by info
+    // until the arrays are returned
+    csriluk->pool   = handle->pool;
+    csriluk->stream = stream;
+
+    // Keep the column indices, such that csriluk_symbolic can hand them out
+    if(hnnz_M > 0)
+    {
+        RETURN_IF_HIP_ERROR(
+            handle->allocate((void**)&csriluk->csr_col_ind_M, sizeof(rocsparse_int) * hnnz_M));
+        RETURN_IF_HIP_ERROR(hipMemcpy(csriluk->csr_col_ind_M,
+                                      hcsr_col_ind_M.data(),
+                                      sizeof(rocsparse_int) * hnnz_M,
+                                      hipMemcpyHostToDevice));
+    }
+
+    if(nnz > 0)
+    {
+        RETURN_IF_HIP_ERROR(
+            handle->allocate((void**)&csriluk->scatter, sizeof(rocsparse_int) * nnz));
+        RETURN_IF_HIP_ERROR(hipMemcpy(csriluk->scatter,
+                                      hscatter.data(),
+                                      sizeof(rocsparse_int) * nnz,
+                                      hipMemcpyHostToDevice));
+    }
+
+    RETURN_IF_HIP_ERROR(hipMemcpy(csr_row_ptr_M,
+                                  hcsr_row_ptr_M.data(),
+                                  sizeof(rocsparse_int) * (m + 1),
+                                  hipMemcpyHostToDevice));
+
+    // Copy number of non-zero entries of the incomplete factors
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnz_M, &hnnz_M, sizeof(rocsparse_int), hipMemcpyHostToDevice));
+    }
+    else
+    {
+        *nnz_M = hnnz_M;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_symbolic(rocsparse_handle handle,
+                                                       rocsparse_int m,
+                                                       rocsparse_int nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       rocsparse_mat_info info,
+                                                       const rocsparse_int* csr_row_ptr_M,
+                                                       rocsparse_int* csr_col_ind_M,
+                                                       void* temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csriluk_symbolic",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)csr_row_ptr_M,
+              (const void*&)csr_col_ind_M,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Level of fill pattern is required
+    rocsparse_csriluk_info csriluk = info->csriluk_info;
+
+    if(csriluk == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Hand out the column indices of the incomplete factors, they are kept such that
+    // repeated calls fill csr_col_ind_M as well
+    if(csriluk->csr_col_ind_M != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr_col_ind_M,
+                                           csriluk->csr_col_ind_M,
+                                           sizeof(rocsparse_int) * csriluk->nnz_M,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+    }
+
+    // Clear dependency analysis
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(csriluk->csrtr));
+    csriluk->csrtr = nullptr;
+
+    // Create dependency analysis
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&csriluk->csrtr));
+
+    // Analyse the dependencies of the incomplete factors, such that the numeric
+    // factorization can use the csrilu0 kernels
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis(handle,
+                                                       rocsparse_operation_none,
+                                                       m,
+                                                       csriluk->nnz_M,
+                                                       descr,
+                                                       csr_row_ptr_M,
+                                                       csr_col_ind_M,
+                                                       csriluk->csrtr,
+                                                       temp_buffer));
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsriluk_numeric(rocsparse_handle handle,
+                                                       rocsparse_int m,
+                                                       rocsparse_int nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const float* csr_val,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       rocsparse_mat_info info,
+                                                       float* csr_val_M,
+                                                       const rocsparse_int* csr_row_ptr_M,
+                                                       const rocsparse_int* csr_col_ind_M,
+                                                       rocsparse_solve_policy policy,
+                                                       void* temp_buffer)
+{
+    return rocsparse_csriluk_numeric_template<float>(handle,
+                                                     m,
+                                                     nnz,
+                                                     descr,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     info,
+                                                     csr_val_M,
+                                                     csr_row_ptr_M,
+                                                     csr_col_ind_M,
+                                                     policy,
+                                                     temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsriluk_numeric(rocsparse_handle handle,
+                                                       rocsparse_int m,
+                                                       rocsparse_int nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const double* csr_val,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       rocsparse_mat_info info,
+                                                       double* csr_val_M,
+                                                       const rocsparse_int* csr_row_ptr_M,
+                                                       const rocsparse_int* csr_col_ind_M,
+                                                       rocsparse_solve_policy policy,
+                                                       void* temp_buffer)
+{
+    return rocsparse_csriluk_numeric_template<double>(handle,
+                                                      m,
+                                                      nnz,
+                                                      descr,
+                                                      csr_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      info,
+                                                      csr_val_M,
+                                                      csr_row_ptr_M,
+                                                      csr_col_ind_M,
+                                                      policy,
+                                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_zero_pivot(rocsparse_handle handle,
+                                                         rocsparse_mat_info info,
+                                                         rocsparse_int* position)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csriluk_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_csrtr_zero_pivot(
+        handle, (info->csriluk_info != nullptr) ? info->csriluk_info->csrtr : nullptr, position);
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_clear(rocsparse_handle handle,
+                                                    rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csriluk_clear", (const void*&)info);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    info->csriluk_info = nullptr;
+
+    return rocsparse_status_success;
+}
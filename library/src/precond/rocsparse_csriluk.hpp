@@ -0,0 +1,191 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_CSRILUK_HPP
+#define ROCSPARSE_CSRILUK_HPP
+
+#include "definitions.h"
+#include "rocsparse.h"
+#include "utility.h"
+#include "csriluk_device.h"
+#include "rocsparse_csrilu0.hpp"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_csriluk_numeric_template(rocsparse_handle handle,
+                                                    rocsparse_int m,
+                                                    rocsparse_int nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T* csr_val,
+                                                    const rocsparse_int* csr_row_ptr,
+                                                    const rocsparse_int* csr_col_ind,
+                                                    rocsparse_mat_info info,
+                                                    T* csr_val_M,
+                                                    const rocsparse_int* csr_row_ptr_M,
+                                                    const rocsparse_int* csr_col_ind_M,
+                                                    rocsparse_solve_policy policy,
+                                                    void* temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsriluk_numeric"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)csr_val_M,
+              (const void*&)csr_row_ptr_M,
+              (const void*&)csr_col_ind_M,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csriluk -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check solve policy
+    if(policy != rocsparse_solve_policy_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Symbolic factorization is required
+    rocsparse_csriluk_info csriluk = info->csriluk_info;
+
+    if(csriluk == nullptr || csriluk->csrtr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Initialize the incomplete factors with A, fill-in entries start from zero
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(csr_val_M, 0, sizeof(T) * csriluk->nnz_M, stream));
+
+#define CSRILUK_DIM 256
+    dim3 csriluk_blocks((nnz - 1) / CSRILUK_DIM + 1);
+    dim3 csriluk_threads(CSRILUK_DIM);
+
+    hipLaunchKernelGGL((csriluk_scatter_kernel<T>),
+                       csriluk_blocks,
+                       csriluk_threads,
+                       0,
+                       stream,
+                       nnz,
+                       csriluk->scatter,
+                       csr_val,
+                       csr_val_M);
+#undef CSRILUK_DIM
+
+    // ILU(k) is ILU(0) on the level of fill pattern
+    return rocsparse_csrilu0_launch(handle,
+                                    m,
+                                    descr,
+                                    csr_val_M,
+                                    csr_row_ptr_M,
+                                    csr_col_ind_M,
+                                    csriluk->csrtr,
+                                    0,
+                                    0.0,
+                                    static_cast<T>(0),
+                                    nullptr,
+                                    temp_buffer);
+}
+
+#endif // ROCSPARSE_CSRILUK_HPP
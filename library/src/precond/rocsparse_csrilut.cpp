@@ -0,0 +1,275 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "rocsparse.h"
+#include "rocsparse_csrilut.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csrilut_buffer_size(rocsparse_handle handle,
+                                                          rocsparse_int m,
+                                                          rocsparse_int nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const rocsparse_int* csr_row_ptr,
+                                                          const rocsparse_int* csr_col_ind,
+                                                          rocsparse_mat_info info,
+                                                          size_t* buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrilut_buffer_size",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    return rocsparse_csrilut_buffer_size_template(m, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_scsrilut_nnz(rocsparse_handle handle,
+                                                   rocsparse_int m,
+                                                   rocsparse_int nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const float* csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   float tau,
+                                                   rocsparse_int p,
+                                                   rocsparse_mat_info info,
+                                                   rocsparse_int* csr_row_ptr_M,
+                                                   rocsparse_int* nnz_M)
+{
+    return rocsparse_csrilut_nnz_template<float>(handle,
+                                                 m,
+                                                 nnz,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 tau,
+                                                 p,
+                                                 info,
+                                                 csr_row_ptr_M,
+                                                 nnz_M);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilut_nnz(rocsparse_handle handle,
+                                                   rocsparse_int m,
+                                                   rocsparse_int nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const double* csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   double tau,
+                                                   rocsparse_int p,
+                                                   rocsparse_mat_info info,
+                                                   rocsparse_int* csr_row_ptr_M,
+                                                   rocsparse_int* nnz_M)
+{
+    return rocsparse_csrilut_nnz_template<double>(handle,
+                                                  m,
+                                                  nnz,
+                                                  descr,
+                                                  csr_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  tau,
+                                                  p,
+                                                  info,
+                                                  csr_row_ptr_M,
+                                                  nnz_M);
+}
+
+extern "C" rocsparse_status rocsparse_scsrilut_numeric(rocsparse_handle handle,
+                                                       rocsparse_int m,
+                                                       rocsparse_int nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const float* csr_val,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       rocsparse_mat_info info,
+                                                       float* csr_val_M,
+                                                       rocsparse_int* csr_row_ptr_M,
+                                                       rocsparse_int* csr_col_ind_M,
+                                                       rocsparse_solve_policy policy,
+                                                       void* temp_buffer)
+{
+    return rocsparse_csrilut_numeric_template<float>(handle,
+                                                     m,
+                                                     nnz,
+                                                     descr,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     info,
+                                                     csr_val_M,
+                                                     csr_row_ptr_M,
+                                                     csr_col_ind_M,
+                                                     policy,
+                                                     temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilut_numeric(rocsparse_handle handle,
+                                                       rocsparse_int m,
+                                                       rocsparse_int nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const double* csr_val,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       rocsparse_mat_info info,
+                                                       double* csr_val_M,
+                                                       rocsparse_int* csr_row_ptr_M,
+                                                       rocsparse_int* csr_col_ind_M,
+                                                       rocsparse_solve_policy policy,
+                                                       void* temp_buffer)
+{
+    return rocsparse_csrilut_numeric_template<double>(handle,
+                                                      m,
+                                                      nnz,
+                                                      descr,
+                                                      csr_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      info,
+                                                      csr_val_M,
+                                                      csr_row_ptr_M,
+                                                      csr_col_ind_M,
+                                                      policy,
+                                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_csrilut_zero_pivot(rocsparse_handle handle,
+                                                         rocsparse_mat_info info,
+                                                         rocsparse_int* position)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrilut_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_csrtr_zero_pivot(
+        handle,
+        (info->csrilut_info != nullptr) ? info->csrilut_info->zero_pivot_info : nullptr,
+        position);
+}
+
+extern "C" rocsparse_status rocsparse_csrilut_clear(rocsparse_handle handle,
+                                                    rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrilut_clear", (const void*&)info);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrilut_info(info->csrilut_info));
+    info->csrilut_info = nullptr;
+
+    return rocsparse_status_success;
+}
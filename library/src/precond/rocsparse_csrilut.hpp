@@ -0,0 +1,604 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_CSRILUT_HPP
+#define ROCSPARSE_CSRILUT_HPP
+
+#include "definitions.h"
+#include "rocsparse.h"
+#include "grid.h"
+#include "handle.h"
+#include "utility.h"
+#include "csrilut_device.h"
+#include "../level2/rocsparse_csrsv.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <hip/hip_runtime.h>
+#include <hipcub/hipcub.hpp>
+
+// Device memory that is spent on the work rows of csrilut numeric, which determines the
+// number of rows that are factorized concurrently
+#define CSRILUT_WORK_BYTES (size_t(256) << 20)
+#define CSRILUT_MAX_SLOTS 1024
+
+// Number of rows that are factorized concurrently. The work row of each of them holds
+// a dense value array, the stamps that mark its columns and the lists of its columns.
+static rocsparse_int rocsparse_csrilut_slots(rocsparse_int m)
+{
+    // Values are sized for double, such that the buffer size does not depend on the type
+    size_t slot_size = (sizeof(double) + 2 * sizeof(rocsparse_int)) * m + sizeof(rocsparse_int);
+    size_t slots     = CSRILUT_WORK_BYTES / slot_size;
+
+    slots = std::min(slots, static_cast<size_t>(std::min(m, CSRILUT_MAX_SLOTS)));
+
+    return std::max(static_cast<rocsparse_int>(slots), static_cast<rocsparse_int>(1));
+}
+
+// Temporary storage required by csrilut numeric
+static rocsparse_status rocsparse_csrilut_buffer_size_template(rocsparse_int m,
+                                                               size_t* buffer_size)
+{
+    size_t slots = rocsparse_csrilut_slots(m);
+
+    // rocsparse_int next_row
+    *buffer_size = 256;
+
+    // rocsparse_int done[m]
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // rocsparse_int diag_ind[m]
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // double work_val[slots * m]
+    *buffer_size += sizeof(double) * ((slots * m - 1) / 256 + 1) * 256;
+
+    // rocsparse_int work_stamp[slots * (m + 1)]
+    *buffer_size += sizeof(rocsparse_int) * ((slots * (m + 1) - 1) / 256 + 1) * 256;
+
+    // rocsparse_int work_part[slots * m]
+    *buffer_size += sizeof(rocsparse_int) * ((slots * m - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+// Factorize the rows into their slots of the maximum sparsity pattern, with one
+// sub-wavefront of WF_SIZE threads per row, and move them to their final position
+template <typename T, rocsparse_int WF_SIZE>
+rocsparse_status rocsparse_csrilut_numeric_launch(rocsparse_handle handle,
+                                                  rocsparse_int m,
+                                                  rocsparse_int slots,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T* csr_val,
+                                                  const rocsparse_int* csr_row_ptr,
+                                                  const rocsparse_int* csr_col_ind,
+                                                  rocsparse_csrilut_info csrilut,
+                                                  T* csr_val_M,
+                                                  rocsparse_int* csr_row_ptr_M,
+                                                  rocsparse_int* csr_col_ind_M,
+                                                  rocsparse_int* diag_ind,
+                                                  rocsparse_int* done,
+                                                  rocsparse_int* next_row,
+                                                  T* work_val,
+                                                  rocsparse_int* work_stamp,
+                                                  rocsparse_int* work_part)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // hipcub buffer size
+    size_t hipcub_size = 0;
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
+        nullptr, hipcub_size, csr_row_ptr_M, csr_row_ptr_M, m + 1, stream));
+
+    // Rows are written to the slots of the maximum sparsity pattern first, such that
+    // rows do not wait for their predecessors to be written
+    size_t col_size = sizeof(rocsparse_int) * ((csrilut->nnz_M - 1) / 256 + 1) * 256;
+    size_t val_size = sizeof(T) * ((csrilut->nnz_M - 1) / 256 + 1) * 256;
+
+    char* workspace = nullptr;
+    RETURN_IF_HIP_ERROR(
+        handle->allocate((void**)&workspace, col_size + val_size + hipcub_size));
+
+    rocsparse_int* work_col_M = reinterpret_cast<rocsparse_int*>(workspace);
+    T* work_val_M             = reinterpret_cast<T*>(workspace + col_size);
+    void* hipcub_buffer       = reinterpret_cast<void*>(workspace + col_size + val_size);
+
+#define CSRILUT_DIM 256
+    dim3 csrilut_blocks((static_cast<int64_t>(slots) * WF_SIZE - 1) / CSRILUT_DIM + 1);
+    dim3 csrilut_threads(CSRILUT_DIM);
+
+    hipLaunchKernelGGL((csrilut_numeric_kernel<T, CSRILUT_DIM, WF_SIZE>),
+                       csrilut_blocks,
+                       csrilut_threads,
+                       0,
+                       stream,
+                       m,
+                       static_cast<T>(csrilut->tau),
+                       csrilut->p,
+                       slots,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       csr_row_ptr_M,
+                       work_col_M,
+                       work_val_M,
+                       diag_ind,
+                       done,
+                       next_row,
+                       work_val,
+                       work_stamp,
+                       work_part,
+                       csrilut->zero_pivot_info->zero_pivot,
+                       descr->base);
+
+    // Turn the row lengths into row offsets
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
+        hipcub_buffer, hipcub_size, csr_row_ptr_M, csr_row_ptr_M, m + 1, stream));
+
+    dim3 compact_blocks;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_grid_dim(static_cast<int64_t>(m) * WF_SIZE, CSRILUT_DIM, compact_blocks));
+
+    hipLaunchKernelGGL((csrilut_compact_kernel<T, CSRILUT_DIM, WF_SIZE>),
+                       compact_blocks,
+                       csrilut_threads,
+                       0,
+                       stream,
+                       m,
+                       csrilut->p,
+                       csr_row_ptr_M,
+                       work_col_M,
+                       work_val_M,
+                       csr_col_ind_M,
+                       csr_val_M,
+                       descr->base);
+#undef CSRILUT_DIM
+
+    RETURN_IF_HIP_ERROR(handle->deallocate(workspace));
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_nnz_template(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                rocsparse_int nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const T* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                T tau,
+                                                rocsparse_int p,
+                                                rocsparse_mat_info info,
+                                                rocsparse_int* csr_row_ptr_M,
+                                                rocsparse_int* nnz_M)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilut_nnz"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              tau,
+              p,
+              (const void*&)info,
+              (const void*&)csr_row_ptr_M,
+              (const void*&)nnz_M);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check drop tolerance and maximum fill
+    if(tau < static_cast<T>(0) || p < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_M, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_M = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // The entries that are dropped depend on the values of all previous rows of the
+    // incomplete factors, thus only the maximum number of entries of each row is
+    // determined here. Row i holds at most min(i, p) entries in its strictly lower
+    // part, the diagonal entry and at most min(m - 1 - i, p) entries in its strictly
+    // upper part.
+    int64_t max_nnz_M = 0;
+
+    if(nnz > 0)
+    {
+        int64_t max_p = std::min(static_cast<int64_t>(p), static_cast<int64_t>(m));
+
+        // The bound must not overflow during its computation
+        if(m > std::numeric_limits<int64_t>::max() / (2 * max_p + 1))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        max_nnz_M = rocsparse_csrilut_row_offset(m, m, max_p);
+
+        if(max_nnz_M > std::numeric_limits<rocsparse_int>::max())
+        {
+            return rocsparse_status_invalid_size;
+        }
+    }
+
+    rocsparse_int hnnz_M = static_cast<rocsparse_int>(max_nnz_M);
+
+#define CSRILUT_DIM 256
+    dim3 csrilut_blocks;
+    dim3 csrilut_threads(CSRILUT_DIM);
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_grid_dim(static_cast<int64_t>(m) + 1, CSRILUT_DIM, csrilut_blocks));
+
+    hipLaunchKernelGGL((csrilut_nnz_kernel<CSRILUT_DIM>),
+                       csrilut_blocks,
+                       csrilut_threads,
+                       0,
+                       stream,
+                       m,
+                       std::min(p, m),
+                       nnz,
+                       csr_row_ptr_M,
+                       descr->base);
+#undef CSRILUT_DIM
+
+    // Clear csrilut info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrilut_info(info->csrilut_info));
+    info->csrilut_info = nullptr;
+
+    // Create csrilut info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrilut_info(&info->csrilut_info));
+
+    rocsparse_csrilut_info csrilut = info->csrilut_info;
+
+    csrilut->tau   = static_cast<double>(tau);
+    csrilut->p     = p;
+    csrilut->nnz_M = hnnz_M;
+    csrilut->m     = m;
+    csrilut->nnz   = nnz;
+
+    // The zero pivot of the numeric factorization is reported through a csrtr info,
+    // whose device memory is served from the memory pool of the handle
+    if(nnz > 0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&csrilut->zero_pivot_info));
+
+        csrilut->zero_pivot_info->pool   = handle->pool;
+        csrilut->zero_pivot_info->stream = stream;
+        csrilut->zero_pivot_info->m      = m;
+        csrilut->zero_pivot_info->nnz    = hnnz_M;
+
+        RETURN_IF_HIP_ERROR(handle->allocate((void**)&csrilut->zero_pivot_info->zero_pivot,
+                                             sizeof(rocsparse_int)));
+    }
+
+    // Copy maximum number of non-zero entries of the incomplete factors
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnz_M, &hnnz_M, sizeof(rocsparse_int), hipMemcpyHostToDevice));
+    }
+    else
+    {
+        *nnz_M = hnnz_M;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_numeric_template(rocsparse_handle handle,
+                                                    rocsparse_int m,
+                                                    rocsparse_int nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T* csr_val,
+                                                    const rocsparse_int* csr_row_ptr,
+                                                    const rocsparse_int* csr_col_ind,
+                                                    rocsparse_mat_info info,
+                                                    T* csr_val_M,
+                                                    rocsparse_int* csr_row_ptr_M,
+                                                    rocsparse_int* csr_col_ind_M,
+                                                    rocsparse_solve_policy policy,
+                                                    void* temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilut_numeric"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)csr_val_M,
+              (const void*&)csr_row_ptr_M,
+              (const void*&)csr_col_ind_M,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrilut -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check solve policy
+    if(policy != rocsparse_solve_policy_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Maximum sparsity pattern of the incomplete factors is required
+    rocsparse_csrilut_info csrilut = info->csrilut_info;
+
+    if(csrilut == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int slots = rocsparse_csrilut_slots(m);
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // rocsparse_int next_row
+    rocsparse_int* next_row = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += 256;
+
+    // rocsparse_int done[m]
+    rocsparse_int* done = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // rocsparse_int diag_ind[m]
+    rocsparse_int* diag_ind = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // T work_val[slots * m]
+    T* work_val = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(double) * ((static_cast<size_t>(slots) * m - 1) / 256 + 1) * 256;
+
+    // rocsparse_int work_stamp[slots * (m + 1)]
+    rocsparse_int* work_stamp = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((static_cast<size_t>(slots) * (m + 1) - 1) / 256 + 1) * 256;
+
+    // rocsparse_int work_part[slots * m]
+    rocsparse_int* work_part = reinterpret_cast<rocsparse_int*>(ptr);
+
+#define CSRILUT_DIM 256
+    dim3 csrilut_blocks;
+    dim3 csrilut_threads(CSRILUT_DIM);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_grid_dim(m, CSRILUT_DIM, csrilut_blocks));
+
+    // Reset the progress and the zero pivot of previous calls
+    hipLaunchKernelGGL((csrilut_init_kernel<CSRILUT_DIM>),
+                       csrilut_blocks,
+                       csrilut_threads,
+                       0,
+                       stream,
+                       m,
+                       done,
+                       next_row,
+                       csrilut->zero_pivot_info->zero_pivot);
+#undef CSRILUT_DIM
+
+    // Columns of the work rows are unmarked
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(
+        work_stamp, -1, sizeof(rocsparse_int) * static_cast<size_t>(slots) * (m + 1), stream));
+
+    // Each row is factorized by a sub-wavefront, chosen from the maximum row length of
+    // the incomplete factors, i.e. the maximum length of the pivot rows
+    int64_t max_row = std::min(2 * static_cast<int64_t>(std::min(csrilut->p, m)) + 1,
+                               static_cast<int64_t>(m));
+
+#define CSRILUT_LAUNCH(WF_SIZE)                                                     \
+    rocsparse_csrilut_numeric_launch<T, WF_SIZE>(handle,                             \
+                                                 m,                                  \
+                                                 slots,                              \
+                                                 descr,                              \
+                                                 csr_val,                            \
+                                                 csr_row_ptr,                        \
+                                                 csr_col_ind,                        \
+                                                 csrilut,                            \
+                                                 csr_val_M,                          \
+                                                 csr_row_ptr_M,                      \
+                                                 csr_col_ind_M,                      \
+                                                 diag_ind,                           \
+                                                 done,                               \
+                                                 next_row,                           \
+                                                 work_val,                           \
+                                                 work_stamp,                         \
+                                                 work_part)
+
+    if(max_row <= 8)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(CSRILUT_LAUNCH(8));
+    }
+    else if(max_row <= 16)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(CSRILUT_LAUNCH(16));
+    }
+    else if(max_row <= 32 || handle->wavefront_size == 32)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(CSRILUT_LAUNCH(32));
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(CSRILUT_LAUNCH(64));
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+#undef CSRILUT_LAUNCH
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRILUT_HPP
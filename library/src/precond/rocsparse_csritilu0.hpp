@@ -0,0 +1,325 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_CSRITILU0_HPP
+#define ROCSPARSE_CSRITILU0_HPP
+
+#include "definitions.h"
+#include "rocsparse.h"
+#include "utility.h"
+#include "csritilu0_device.h"
+#include "../level2/rocsparse_csritsv.hpp"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_csritilu0_buffer_size_template(rocsparse_handle handle,
+                                                          rocsparse_int m,
+                                                          rocsparse_int nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const T* csr_val,
+                                                          const rocsparse_int* csr_row_ptr,
+                                                          const rocsparse_int* csr_col_ind,
+                                                          size_t* buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsritilu0_buffer_size"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+#define CSRITILU0_DIM 256
+    rocsparse_int nblocks = (nnz - 1) / CSRITILU0_DIM + 1;
+#undef CSRITILU0_DIM
+
+    // T a_val[nnz]
+    *buffer_size = sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
+
+    // rocsparse_int csr_row_ind[nnz]
+    *buffer_size += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // rocsparse_int csr_upper_ptr[m]
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // T partial[nblocks]
+    *buffer_size += sizeof(T) * ((nblocks - 1) / 256 + 1) * 256;
+
+    // T nrm
+    *buffer_size += 256;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csritilu0_template(rocsparse_handle handle,
+                                              rocsparse_int m,
+                                              rocsparse_int nnz,
+                                              const rocsparse_mat_descr descr,
+                                              T* csr_val,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              rocsparse_int nsweeps,
+                                              T* residual,
+                                              void* temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsritilu0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              nsweeps,
+              (const void*&)residual,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csritilu0 -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "--sweeps",
+              nsweeps);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check number of sweeps
+    if(nsweeps < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Residuals on the host require synchronization
+    if(residual != nullptr && handle->exec_mode == rocsparse_exec_mode_async
+       && handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || nsweeps == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRITILU0_DIM 256
+    rocsparse_int nblocks = (nnz - 1) / CSRITILU0_DIM + 1;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // a_val
+    T* a_val = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
+
+    // csr_row_ind
+    rocsparse_int* csr_row_ind = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // csr_upper_ptr
+    rocsparse_int* csr_upper_ptr = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // partial
+    T* partial = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((nblocks - 1) / 256 + 1) * 256;
+
+    // nrm
+    T* nrm = reinterpret_cast<T*>(ptr);
+
+    // The entries of A are kept, M is initialized with A
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(a_val, csr_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    hipLaunchKernelGGL((csritilu0_init_kernel<CSRITILU0_DIM>),
+                       dim3((m - 1) / CSRITILU0_DIM + 1),
+                       dim3(CSRITILU0_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_row_ind,
+                       csr_upper_ptr,
+                       descr->base);
+
+    for(rocsparse_int iter = 0; iter < nsweeps; ++iter)
+    {
+        hipLaunchKernelGGL((csritilu0_sweep_kernel<T, CSRITILU0_DIM, true>),
+                           dim3(nblocks),
+                           dim3(CSRITILU0_DIM),
+                           0,
+                           stream,
+                           nnz,
+                           csr_row_ptr,
+                           csr_row_ind,
+                           csr_col_ind,
+                           csr_upper_ptr,
+                           a_val,
+                           csr_val,
+                           partial,
+                           descr->base);
+
+        // Residual of the current iterate
+        if(residual != nullptr)
+        {
+            hipLaunchKernelGGL((csritilu0_sweep_kernel<T, CSRITILU0_DIM, false>),
+                               dim3(nblocks),
+                               dim3(CSRITILU0_DIM),
+                               0,
+                               stream,
+                               nnz,
+                               csr_row_ptr,
+                               csr_row_ind,
+                               csr_col_ind,
+                               csr_upper_ptr,
+                               a_val,
+                               csr_val,
+                               partial,
+                               descr->base);
+
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_csrit_nrm2(handle, nblocks, partial, nrm, residual + iter));
+        }
+    }
+#undef CSRITILU0_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRITILU0_HPP
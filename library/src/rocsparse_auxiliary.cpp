@@ -112,6 +112,45 @@ rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle handle, rocsparse_p
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Indicates whether routines may synchronize with the device.
+ * Set execution mode, can be sync or async
+ *******************************************************************************/
+rocsparse_status rocsparse_set_exec_mode(rocsparse_handle handle, rocsparse_exec_mode mode)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    if(mode != rocsparse_exec_mode_sync && mode != rocsparse_exec_mode_async)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    handle->exec_mode = mode;
+    log_trace(handle, "rocsparse_set_exec_mode", mode);
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get execution mode, can be sync or async.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_exec_mode(rocsparse_handle handle, rocsparse_exec_mode* mode)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    if(mode == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    *mode = handle->exec_mode;
+    log_trace(handle, "rocsparse_get_exec_mode", *mode);
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  *! \brief Set rocsparse stream used for all subsequent library function calls.
  * If not set, all hip kernels will take the default NULL stream.
@@ -162,6 +201,116 @@ rocsparse_status rocsparse_get_version(rocsparse_handle handle, int* version)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Set the capacity of the csrmv analysis cache, 0 disables the cache.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_csrmv_cache_capacity(rocsparse_handle handle,
+                                                    rocsparse_int capacity)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle, "rocsparse_set_csrmv_cache_capacity", capacity);
+
+    if(capacity < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    return handle->set_csrmv_cache_capacity(capacity);
+}
+
+/********************************************************************************
+ * \brief Get the number of csrmv analysis cache hits and misses.
+ *******************************************************************************/
+rocsparse_status
+    rocsparse_get_csrmv_cache_stats(rocsparse_handle handle, size_t* hits, size_t* misses)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(hits == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(misses == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *hits   = handle->csrmv_cache_hits;
+    *misses = handle->csrmv_cache_misses;
+
+    log_trace(handle, "rocsparse_get_csrmv_cache_stats", *hits, *misses);
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Set the amount of idle device memory kept in the memory pool.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_memory_pool_limit(rocsparse_handle handle, size_t limit)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle, "rocsparse_set_memory_pool_limit", limit);
+
+    RETURN_IF_HIP_ERROR(handle->pool->set_limit(limit));
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get the memory pool usage and the number of hits and misses.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_memory_pool_stats(rocsparse_handle handle,
+                                                 size_t* bytes_in_use,
+                                                 size_t* bytes_cached,
+                                                 size_t* hits,
+                                                 size_t* misses)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(bytes_in_use == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bytes_cached == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(hits == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(misses == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *bytes_in_use = handle->pool->get_bytes_in_use();
+    *bytes_cached = handle->pool->get_bytes_cached();
+    *hits         = handle->pool->get_hits();
+    *misses       = handle->pool->get_misses();
+
+    log_trace(
+        handle, "rocsparse_get_memory_pool_stats", *bytes_in_use, *bytes_cached, *hits, *misses);
+
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  * \brief rocsparse_create_mat_descr_t is a structure holding the rocsparse matrix
  * descriptor. It must be initialized using rocsparse_create_mat_descr()
@@ -380,31 +529,176 @@ rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb)
     // Destruct
     try
     {
-        // Clean up ELL part
-        if(hyb->ell_col_ind != nullptr)
+        // Clean up ELL and COO part, device arrays are returned to the memory pool
+        // that allocated them
+        if(hyb->pool != nullptr)
         {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->ell_col_ind));
+            RETURN_IF_HIP_ERROR(hyb->pool->deallocate(hyb->ell_col_ind, hyb->stream));
+            RETURN_IF_HIP_ERROR(hyb->pool->deallocate(hyb->ell_val, hyb->stream));
+            RETURN_IF_HIP_ERROR(hyb->pool->deallocate(hyb->coo_row_ind, hyb->stream));
+            RETURN_IF_HIP_ERROR(hyb->pool->deallocate(hyb->coo_col_ind, hyb->stream));
+            RETURN_IF_HIP_ERROR(hyb->pool->deallocate(hyb->coo_val, hyb->stream));
         }
-        if(hyb->ell_val != nullptr)
+
+        delete hyb;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Set the upper bound of the HYB matrix non-zero entries, that is used to
+ * size the HYB matrix without synchronization.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_hyb_mat_nnz_bound(rocsparse_hyb_mat hyb, rocsparse_int nnz_bound)
+{
+    // Check if hyb structure is valid
+    if(hyb == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    if(nnz_bound < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    hyb->nnz_bound = nnz_bound;
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_create_sellc_mat is a structure holding the rocsparse
+ * SELL-C-sigma matrix. It must be initialized using rocsparse_create_sellc_mat()
+ * and the retured handle must be passed to all subsequent library function
+ * calls that involve the SELL-C-sigma matrix.
+ * It should be destroyed at the end using rocsparse_destroy_sellc_mat().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_sellc_mat(rocsparse_sellc_mat* sellc)
+{
+    if(sellc == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
         {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->ell_val));
+            *sellc = new _rocsparse_sellc_mat;
         }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
 
-        // Clean up COO part
-        if(hyb->coo_row_ind != nullptr)
+/********************************************************************************
+ * \brief Destroy SELL-C-sigma matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_sellc_mat(rocsparse_sellc_mat sellc)
+{
+    // Destruct
+    try
+    {
+        // Device arrays are returned to the memory pool that allocated them
+        if(sellc->pool != nullptr)
         {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_row_ind));
+            RETURN_IF_HIP_ERROR(sellc->pool->deallocate(sellc->slice_ptr, sellc->stream));
+            RETURN_IF_HIP_ERROR(sellc->pool->deallocate(sellc->perm, sellc->stream));
+            RETURN_IF_HIP_ERROR(sellc->pool->deallocate(sellc->col_ind, sellc->stream));
+            RETURN_IF_HIP_ERROR(sellc->pool->deallocate(sellc->val, sellc->stream));
         }
-        if(hyb->coo_col_ind != nullptr)
+
+        delete sellc;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get the number of stored entries and the relative padding overhead of a
+ * SELL-C-sigma matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_sellc_mat_padding(const rocsparse_sellc_mat sellc,
+                                                 rocsparse_int* sell_nnz,
+                                                 double* padding)
+{
+    // Check if sellc structure is valid
+    if(sellc == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(padding == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *sell_nnz = sellc->sell_nnz;
+    *padding  = sellc->padding;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_create_csr5_mat is a structure holding the rocsparse CSR5
+ * tile descriptor. It must be initialized using rocsparse_create_csr5_mat()
+ * and the retured handle must be passed to all subsequent library function
+ * calls that involve the CSR5 matrix.
+ * It should be destroyed at the end using rocsparse_destroy_csr5_mat().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csr5_mat(rocsparse_csr5_mat* csr5)
+{
+    if(csr5 == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
         {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_col_ind));
+            *csr5 = new _rocsparse_csr5_mat;
         }
-        if(hyb->coo_val != nullptr)
+        catch(const rocsparse_status& status)
         {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_val));
+            return status;
         }
+        return rocsparse_status_success;
+    }
+}
 
-        delete hyb;
+/********************************************************************************
+ * \brief Destroy CSR5 matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csr5_mat(rocsparse_csr5_mat csr5)
+{
+    // Destruct
+    try
+    {
+        // Device arrays are returned to the memory pool that allocated them
+        if(csr5->pool != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(csr5->pool->deallocate(csr5->tile_ptr, csr5->stream));
+            RETURN_IF_HIP_ERROR(csr5->pool->deallocate(csr5->tile_desc_flag, csr5->stream));
+            RETURN_IF_HIP_ERROR(csr5->pool->deallocate(csr5->tile_desc_offset, csr5->stream));
+            RETURN_IF_HIP_ERROR(
+                csr5->pool->deallocate(csr5->tile_desc_rows_ptr, csr5->stream));
+            RETURN_IF_HIP_ERROR(csr5->pool->deallocate(csr5->tile_desc_rows, csr5->stream));
+            RETURN_IF_HIP_ERROR(csr5->pool->deallocate(csr5->empty_rows, csr5->stream));
+        }
+
+        delete csr5;
     }
     catch(const rocsparse_status& status)
     {
@@ -453,11 +747,29 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
 
     // Uncouple shared meta data
     // TODO add more crossover data here
-    if(info->csrsv_lower_info == info->csrilu0_info)
+    if(info->csric0_info == info->csrilu0_info)
+    {
+        info->csric0_info = nullptr;
+    }
+
+    if(info->csrsv_lower_info == info->csrilu0_info
+       || info->csrsv_lower_info == info->csric0_info)
     {
         info->csrsv_lower_info = nullptr;
     }
 
+    if(info->csrsm_lower_info == info->csrilu0_info
+       || info->csrsm_lower_info == info->csric0_info
+       || info->csrsm_lower_info == info->csrsv_lower_info)
+    {
+        info->csrsm_lower_info = nullptr;
+    }
+
+    if(info->csrsm_upper_info == info->csrsv_upper_info)
+    {
+        info->csrsm_upper_info = nullptr;
+    }
+
     // Clear csrmv info struct
     if(info->csrmv_info != nullptr)
     {
@@ -470,6 +782,12 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrilu0_info));
     }
 
+    // Clear csric0 info struct
+    if(info->csric0_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csric0_info));
+    }
+
     // Clear csrsv upper info struct
     if(info->csrsv_upper_info != nullptr)
     {
@@ -482,6 +800,48 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
     }
 
+    // Clear csrsm upper info struct
+    if(info->csrsm_upper_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsm_upper_info));
+    }
+
+    // Clear csrsm lower info struct
+    if(info->csrsm_lower_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsm_lower_info));
+    }
+
+    // Clear transposed csrsv upper info struct
+    if(info->csrsvt_upper_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsvt_upper_info));
+    }
+
+    // Clear transposed csrsv lower info struct
+    if(info->csrsvt_lower_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsvt_lower_info));
+    }
+
+    // Clear csriluk info struct
+    if(info->csriluk_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    }
+
+    // Clear csrilut info struct
+    if(info->csrilut_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrilut_info(info->csrilut_info));
+    }
+
+    // Clear csrilu0 boost counter
+    if(info->boost_count != nullptr && info->pool != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(info->pool->deallocate(info->boost_count, info->stream));
+    }
+
     // Destruct
     try
     {
@@ -494,6 +854,38 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Set the csrmv algorithm of the matrix info structure.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_mat_info_csrmv_alg(rocsparse_mat_info info,
+                                                  rocsparse_csrmv_alg alg)
+{
+    // Check if info is valid
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    if(alg != rocsparse_csrmv_alg_adaptive && alg != rocsparse_csrmv_alg_merge)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    info->csrmv_alg = alg;
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Returns the csrmv algorithm of the matrix info structure.
+ *******************************************************************************/
+rocsparse_csrmv_alg rocsparse_get_mat_info_csrmv_alg(const rocsparse_mat_info info)
+{
+    // If info is invalid, default algorithm is returned
+    if(info == nullptr)
+    {
+        return rocsparse_csrmv_alg_adaptive;
+    }
+    return info->csrmv_alg;
+}
+
 #ifdef __cplusplus
 }
 #endif